@@ -26,6 +26,25 @@ struct PS_INPUT
     float4 color : COLOR;			// Color to pass to the pixel shader
 };
 
+// Instancing: world matrix rows and color come from vertex buffer slot 2
+struct VS_INSTANCE_INPUT
+{
+    float4 position : POSITION;
+    float4 color : COLOR;
+    float4 world0 : INSTANCE_WORLD0;
+    float4 world1 : INSTANCE_WORLD1;
+    float4 world2 : INSTANCE_WORLD2;
+    float4 world3 : INSTANCE_WORLD3;
+    float4 instanceColor : INSTANCE_COLOR;
+};
+
+struct PS_INSTANCE_INPUT
+{
+    float4 position : SV_POSITION;
+    float4 color : COLOR;
+    float4 instanceColor : COLOR1;
+};
+
 PS_INPUT mainVS(VS_INPUT input)
 {
     PS_INPUT output;
@@ -46,3 +65,27 @@ float4 mainPS(PS_INPUT input) : SV_TARGET
 
 	return finalColor;
 }
+
+PS_INSTANCE_INPUT mainVSInstanced(VS_INSTANCE_INPUT input)
+{
+    PS_INSTANCE_INPUT output;
+    float4x4 instanceWorld = float4x4(input.world0, input.world1, input.world2, input.world3);
+
+	float4 tmp = input.position;
+    tmp = mul(tmp, instanceWorld);
+    tmp = mul(tmp, View);
+    tmp = mul(tmp, Projection);
+
+	output.position = tmp;
+    output.color = input.color;
+    output.instanceColor = input.instanceColor;
+
+    return output;
+}
+
+float4 mainPSInstanced(PS_INSTANCE_INPUT input) : SV_TARGET
+{
+	float4 finalColor = lerp(input.color, input.instanceColor, input.instanceColor.a);
+
+	return finalColor;
+}
@@ -18,7 +18,13 @@ cbuffer MaterialConstants : register(b2)
 	float Ni;		// Index of refraction
 	float D;		// Dissolve factor
 	uint MaterialFlags;	// Which textures are available (bitfield)
+};
+
+// Per-draw values that are not part of the material (updated only when they change)
+cbuffer MaterialDrawConstants : register(b3)
+{
 	float Time;
+	float3 MaterialDrawPadding;
 };
 
 Texture2D DiffuseTexture : register(t0);	// map_Kd
@@ -38,10 +44,11 @@ SamplerState SamplerWrap : register(s0);
 #define HAS_ALPHA_MAP	 (1 << 4)
 #define HAS_BUMP_MAP	 (1 << 5)
 
+// Cooked vertex streams: slot 0 = float3 position, slot 1 = octahedral normal (snorm16x2) + half UV
 struct VS_INPUT
 {
 	float4 position : POSITION; // Input position from vertex buffer
-	float3 normal : NORMAL;
+	float2 octNormal : NORMAL;
 	float2 tex : TEXCOORD0;
 };
 
@@ -52,6 +59,27 @@ struct PS_INPUT
 	float2 tex : TEXCOORD1;
 };
 
+// Instancing: world matrix rows come from vertex buffer slot 2
+struct VS_INSTANCE_INPUT
+{
+	float4 position : POSITION;
+	float2 octNormal : NORMAL;
+	float2 tex : TEXCOORD0;
+	float4 world0 : INSTANCE_WORLD0;
+	float4 world1 : INSTANCE_WORLD1;
+	float4 world2 : INSTANCE_WORLD2;
+	float4 world3 : INSTANCE_WORLD3;
+};
+
+// Must match FMeshVertexCooker::EncodeOctNormal
+float3 DecodeOctNormal(float2 encoded)
+{
+	float3 n = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+	float t = saturate(-n.z);
+	n.xy += (n.xy >= 0.0f) ? -t : t;
+	return normalize(n);
+}
+
 PS_INPUT mainVS(VS_INPUT input)
 {
 	PS_INPUT output;
@@ -61,7 +89,23 @@ PS_INPUT mainVS(VS_INPUT input)
 	tmp = mul(tmp, View);
 	tmp = mul(tmp, Projection);
 	output.position = tmp;
-	//output.normal = normalize(mul(float4(input.normal, 0.0f), world).xyz);
+	//output.normal = normalize(mul(float4(DecodeOctNormal(input.octNormal), 0.0f), world).xyz);
+	output.tex = input.tex;
+
+	return output;
+}
+
+PS_INPUT mainVSInstanced(VS_INSTANCE_INPUT input)
+{
+	PS_INPUT output;
+	float4x4 instanceWorld = float4x4(input.world0, input.world1, input.world2, input.world3);
+
+	float4 tmp = input.position;
+	tmp = mul(tmp, instanceWorld);
+	tmp = mul(tmp, View);
+	tmp = mul(tmp, Projection);
+	output.position = tmp;
+	output.normal = DecodeOctNormal(input.octNormal);
 	output.tex = input.tex;
 
 	return output;
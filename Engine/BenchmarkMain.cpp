@@ -0,0 +1,69 @@
+#include "pch.h"
+#include "Source/Benchmark/Public/Benchmark.h"
+
+/**
+ * @brief 벤치마크 진입점 (GTLBenchmark 타깃 전용)
+ * 사용법: GTLBenchmark [--filter S] [--json out.json] [--baseline base.json] [--label S]
+ *                      [--max-primitives N] [--min-time MS] [--data DIR] [--quick]
+ * 기준 JSON과 비교해 회귀가 있으면 종료 코드 1을 돌려준다
+ */
+int main(int argc, char** argv)
+{
+	FBenchmarkOptions Options;
+
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const FString Argument = argv[Index];
+		const bool bHasValue = Index + 1 < argc;
+
+		if (Argument == "--filter" && bHasValue)
+		{
+			Options.Filter = argv[++Index];
+		}
+		else if (Argument == "--json" && bHasValue)
+		{
+			Options.JsonPath = argv[++Index];
+		}
+		else if (Argument == "--baseline" && bHasValue)
+		{
+			Options.BaselinePath = argv[++Index];
+		}
+		else if (Argument == "--label" && bHasValue)
+		{
+			Options.Label = argv[++Index];
+		}
+		else if (Argument == "--data" && bHasValue)
+		{
+			Options.DataDirectory = argv[++Index];
+		}
+		else if (Argument == "--max-primitives" && bHasValue)
+		{
+			Options.MaxPrimitives = static_cast<uint32>(std::max(1000, atoi(argv[++Index])));
+		}
+		else if (Argument == "--min-time" && bHasValue)
+		{
+			Options.MinTimeMs = std::max(0.0, atof(argv[++Index]));
+		}
+		else if (Argument == "--quick")
+		{
+			// 스모크 테스트용: 작은 데이터셋, 짧은 측정
+			Options.MaxPrimitives = 10000;
+			Options.MinIterations = 1;
+			Options.MinTimeMs = 0.0;
+		}
+		else
+		{
+			printf("Usage: %s [--filter S] [--json out.json] [--baseline base.json] [--label S] "
+				"[--max-primitives N] [--min-time MS] [--data DIR] [--quick]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FBenchmarkRunner Runner;
+	Runner.AddSuite("Spatial", RunSpatialBenchmarks);
+	Runner.AddSuite("Asset", RunAssetBenchmarks);
+	Runner.AddSuite("Core", RunCoreBenchmarks);
+	Runner.AddSuite("Render", RunRenderBenchmarks);
+
+	return Runner.Run(Options);
+}
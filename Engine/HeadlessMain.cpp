@@ -0,0 +1,76 @@
+#include "pch.h"
+#include "Source/Headless/Public/HeadlessRunner.h"
+
+/**
+ * @brief 헤드리스 러너 진입점 (GTLHeadless 타깃 전용)
+ * 사용법: GTLHeadless <scene> [--frames N] [--replicate N] [--picks N] [--no-instancing] [--render-thread] [--trace out.json]
+ *                     [--pvs] [--pvs-cells N] [--pvs-out out.scene]
+ */
+int main(int argc, char** argv)
+{
+	FHeadlessRunnerOptions Options;
+	Options.ScenePath = "Data/DefaultScene/simple.scene";
+
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const FString Argument = argv[Index];
+		const bool bHasValue = Index + 1 < argc;
+
+		if (Argument == "--frames" && bHasValue)
+		{
+			Options.NumFrames = static_cast<uint32>(std::max(1, atoi(argv[++Index])));
+		}
+		else if (Argument == "--replicate" && bHasValue)
+		{
+			Options.NumReplicas = static_cast<uint32>(std::max(1, atoi(argv[++Index])));
+		}
+		else if (Argument == "--picks" && bHasValue)
+		{
+			Options.NumPicksPerFrame = static_cast<uint32>(std::max(0, atoi(argv[++Index])));
+		}
+		else if (Argument == "--trace" && bHasValue)
+		{
+			Options.TracePath = argv[++Index];
+		}
+		else if (Argument == "--pvs-cells" && bHasValue)
+		{
+			Options.bBakePVS = true;
+			Options.PVSCellsPerAxis = static_cast<uint32>(std::max(1, atoi(argv[++Index])));
+		}
+		else if (Argument == "--pvs-out" && bHasValue)
+		{
+			Options.bBakePVS = true;
+			Options.PVSOutputPath = argv[++Index];
+		}
+		else if (Argument == "--pvs")
+		{
+			Options.bBakePVS = true;
+		}
+		else if (Argument == "--no-instancing")
+		{
+			Options.bEnableInstancing = false;
+		}
+		else if (Argument == "--render-thread")
+		{
+			Options.bRenderThread = true;
+		}
+		else if (!Argument.empty() && Argument[0] != '-')
+		{
+			Options.ScenePath = Argument;
+		}
+		else
+		{
+			printf("Usage: %s <scene> [--frames N] [--replicate N] [--picks N] [--no-instancing] [--render-thread] [--trace out.json] [--pvs] [--pvs-cells N] [--pvs-out out.scene]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FHeadlessRunner Runner;
+	if (!Runner.LoadScene(Options))
+	{
+		return 1;
+	}
+
+	Runner.Run();
+	return 0;
+}
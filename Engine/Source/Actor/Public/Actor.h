@@ -78,6 +78,8 @@ public:
 	}
 
 private:
+	friend class FWorldCloner;
+
 	TObjectPtr<USceneComponent> RootComponent = nullptr;
 	TArray<TObjectPtr<UActorComponent>> OwnedComponents;
 
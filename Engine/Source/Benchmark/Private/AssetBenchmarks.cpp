@@ -0,0 +1,472 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
+#include "Component/Mesh/Public/MeshOptimizer.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Manager/Asset/Public/LODMaker.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+#include "Texture/Public/CookedTextureCache.h"
+#include "Texture/Public/SyntheticTexture.h"
+#include "Texture/Public/TextureCooker.h"
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+using JSON = json::JSON;
+
+namespace
+{
+	// 단순화는 느리므로 작은 메시만 잰다
+	const TArray<FString> LOD_MESH_NAMES = { "JungleApples/apple_mid", "grenade/grenade" };
+	constexpr float LOD_REDUCTION_RATIO = 0.5f;
+
+	const TArray<uint32> LEVEL_PRIMITIVE_COUNTS = { 1000, 10000 };
+
+	// 합성 텍스처 한 변 크기와 캐시 로드 측정에 넣는 텍스처 수
+	constexpr uint32 TEXTURE_SIZE = 512;
+	constexpr uint32 TEXTURE_CACHE_ENTRIES = 8;
+	const char* LEVEL_PRIMITIVE_TYPES[] = { "Cube", "Sphere", "Triangle", "Square", "StaticMeshComp" };
+
+	uint64 GetFileSize(const FString& InPath)
+	{
+		std::error_code ErrorCode;
+		const uintmax_t Size = std::filesystem::file_size(InPath, ErrorCode);
+		return ErrorCode ? 0 : static_cast<uint64>(Size);
+	}
+
+	void RunObjBenchmarks(FBenchmarkContext& InContext)
+	{
+		const std::filesystem::path TempBinPath = std::filesystem::temp_directory_path() / "gtl_benchmark.objbin";
+
+		for (const FString& MeshName : GetBenchmarkMeshNames())
+		{
+			const FString ObjPath = InContext.GetDataPath(MeshName + ".obj");
+			const FString BinPath = InContext.GetDataPath(MeshName + ".objbin");
+			if (!std::filesystem::exists(ObjPath) || !std::filesystem::exists(BinPath))
+			{
+				UE_LOG_WARNING("Benchmark: 메시를 찾을 수 없어 건너뜁니다: %s", MeshName.c_str());
+				continue;
+			}
+
+			// 텍스트 파싱만 재도록 바이너리 캐시는 끈다 (처리량 단위는 바이트)
+			FObjImporter::Configuration Config;
+			Config.bIsBinaryEnabled = false;
+			InContext.Run("ObjImport/" + MeshName, GetFileSize(ObjPath), [&]
+			{
+				FObjInfo ObjInfo;
+				FObjImporter::LoadObj(ObjPath, &ObjInfo, Config);
+				InContext.Consume(ObjInfo.VertexList.size());
+			});
+
+			InContext.Run("ObjbinLoad/" + MeshName, GetFileSize(BinPath), [&]
+			{
+				FObjInfo ObjInfo;
+				FWindowsBinReader Reader(BinPath);
+				Reader << ObjInfo;
+				InContext.Consume(ObjInfo.VertexList.size());
+			});
+
+			FObjInfo SourceInfo;
+			{
+				FWindowsBinReader Reader(BinPath);
+				Reader << SourceInfo;
+			}
+			InContext.Run("ObjbinSave/" + MeshName, GetFileSize(BinPath), [&]
+			{
+				FWindowsBinWriter Writer(TempBinPath);
+				Writer << SourceInfo;
+			});
+		}
+
+		std::error_code ErrorCode;
+		std::filesystem::remove(TempBinPath, ErrorCode);
+	}
+
+	void RunLODBenchmarks(FBenchmarkContext& InContext)
+	{
+		for (const FString& MeshName : LOD_MESH_NAMES)
+		{
+			const FString ObjPath = InContext.GetDataPath(MeshName + ".obj");
+
+			FMeshSimplifier SourceSimplifier;
+			if (!std::filesystem::exists(ObjPath) || !SourceSimplifier.LoadFromObj(ObjPath))
+			{
+				UE_LOG_WARNING("Benchmark: 메시를 찾을 수 없어 건너뜁니다: %s", MeshName.c_str());
+				continue;
+			}
+
+			// 단순화는 입력을 바꾸므로 반복마다 원본 사본으로 되돌린다 (복사 시간은 제외)
+			FMeshSimplifier Simplifier;
+			InContext.RunWithSetup("LODSimplify/" + MeshName, GetFileSize(ObjPath),
+				[&] { Simplifier = SourceSimplifier; },
+				[&] { Simplifier.Simplify(LOD_REDUCTION_RATIO); });
+		}
+	}
+
+	/**
+	 * @brief ULevel::Serialize가 저장하는 것과 같은 모양의 레벨 JSON을 만든다
+	 */
+	JSON MakeLevelJson(FBenchmarkRandom& InRandom, uint32 InNumPrimitives)
+	{
+		JSON Level = json::Object();
+		Level["Version"] = 1;
+		Level["NextUUID"] = static_cast<int>(InNumPrimitives);
+
+		JSON Camera = json::Object();
+		Camera["FOV"] = FJsonSerializer::FloatToArrayJson(60.0f);
+		Camera["NearClip"] = FJsonSerializer::FloatToArrayJson(0.1f);
+		Camera["FarClip"] = FJsonSerializer::FloatToArrayJson(1000.0f);
+		Camera["Location"] = FJsonSerializer::VectorToJson(FVector(-10.0f, 0.0f, 5.0f));
+		Camera["Rotation"] = FJsonSerializer::VectorToJson(FVector::ZeroVector());
+		Level["PerspectiveCamera"] = Camera;
+
+		JSON Primitives = json::Object();
+		for (uint32 i = 0; i < InNumPrimitives; ++i)
+		{
+			const char* Type = LEVEL_PRIMITIVE_TYPES[InRandom.GetIndex(std::size(LEVEL_PRIMITIVE_TYPES))];
+
+			JSON Primitive = json::Object();
+			Primitive["Type"] = Type;
+			Primitive["Location"] = FJsonSerializer::VectorToJson(InRandom.GetVector(-100.0f, 100.0f));
+			Primitive["Rotation"] = FJsonSerializer::VectorToJson(InRandom.GetVector(-180.0f, 180.0f));
+			Primitive["Scale"] = FJsonSerializer::VectorToJson(InRandom.GetVector(0.5f, 2.0f));
+			if (strcmp(Type, "StaticMeshComp") == 0)
+			{
+				Primitive["ObjStaticMeshAsset"] = "Data/JungleApples/apple_mid.obj";
+			}
+			Primitives[std::to_string(i)] = Primitive;
+		}
+		Level["Primitives"] = Primitives;
+
+		return Level;
+	}
+
+	/** ULevel::Serialize(로드)처럼 프리미티브마다 타입과 트랜스폼을 읽는다 */
+	uint64 ReadLevelJson(const JSON& InLevel)
+	{
+		uint64 NumRead = 0;
+
+		JSON PrimitivesJson;
+		if (!FJsonSerializer::ReadObject(InLevel, "Primitives", PrimitivesJson, nullptr, false))
+		{
+			return 0;
+		}
+
+		for (auto& Pair : PrimitivesJson.ObjectRange())
+		{
+			const JSON& PrimitiveJson = Pair.second;
+
+			FString Type;
+			FVector Location;
+			FVector Rotation;
+			FVector Scale;
+			FJsonSerializer::ReadString(PrimitiveJson, "Type", Type);
+			FJsonSerializer::ReadVector(PrimitiveJson, "Location", Location, FVector::ZeroVector());
+			FJsonSerializer::ReadVector(PrimitiveJson, "Rotation", Rotation, FVector::ZeroVector());
+			FJsonSerializer::ReadVector(PrimitiveJson, "Scale", Scale, FVector::OneVector());
+			NumRead += Type.empty() ? 0 : 1;
+		}
+
+		return NumRead;
+	}
+
+	/**
+	 * @brief 레벨 JSON 저장(문자열화)과 로드(파싱 + 프리미티브 읽기)
+	 * 액터 생성은 D3D 리소스가 필요해 빼고, 직렬화 포맷 처리 비용만 잰다
+	 */
+	void RunLevelJsonBenchmarks(FBenchmarkContext& InContext)
+	{
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+
+		for (uint32 NumPrimitives : LEVEL_PRIMITIVE_COUNTS)
+		{
+			const FString Suffix = "/" + std::to_string(NumPrimitives);
+			const JSON Level = MakeLevelJson(Random, NumPrimitives);
+
+			FString LevelString;
+			InContext.Run("LevelJsonSave" + Suffix, NumPrimitives, [&]
+			{
+				// FJsonSerializer::SaveJsonToFile과 같은 경로로 문자열화한다
+				std::ostringstream Stream;
+				Stream << Level;
+				LevelString = Stream.str();
+			});
+
+			InContext.Run("LevelJsonLoad" + Suffix, NumPrimitives, [&]
+			{
+				const JSON Loaded = JSON::Load(LevelString);
+				InContext.Consume(ReadLevelJson(Loaded));
+			});
+		}
+	}
+
+	/**
+	 * @brief 디바이스 대신 넘겨받은 결과를 훑기만 하는 단계 (버퍼/SRV 생성에 넘길 바이트 수를 센다)
+	 */
+	uint64 CreateNullDeviceResources(FAssetLoader& InLoader)
+	{
+		uint64 NumBytes = 0;
+		for (const FLoadedTexture& Texture : InLoader.GetTextures())
+		{
+			NumBytes += Texture.FileBytes.size();
+		}
+		for (const FLoadedStaticMesh& Loaded : InLoader.GetStaticMeshes())
+		{
+			if (Loaded.Asset)
+			{
+				NumBytes += Loaded.Asset->Positions.size() * sizeof(FMeshPosition);
+				NumBytes += Loaded.Asset->Attributes.size() * sizeof(FMeshAttribute);
+				NumBytes += Loaded.Asset->Indices.size() * sizeof(uint32);
+			}
+		}
+		return NumBytes;
+	}
+
+	/**
+	 * @brief Data/ 전체 시작 로드 (등록 + 메시 파싱/쿠킹/BVH + 텍스처 읽기/중복 제거 + 널 디바이스)
+	 * 엔진과 같은 설정(objbin + 메시 최적화 캐시 사용)으로 호출 스레드에서 차례로 도는 경우와 작업 스레드로 나누는 경우를 비교한다
+	 * 메시 최적화 캐시는 임시 디렉토리에 두고 첫 Probe 로드가 채운다 (두 번째 실행부터의 엔진 시작과 같다)
+	 */
+	void RunStartupLoadBenchmarks(FBenchmarkContext& InContext)
+	{
+		FAssetLoadSettings Settings;
+		Settings.RootDirectory = InContext.GetOptions().DataDirectory;
+		Settings.ObjConfig.bFlipWindingOrder = false;
+		Settings.ObjConfig.bIsBinaryEnabled = true;
+		Settings.ObjConfig.bUVToUEBasis = true;
+		Settings.ObjConfig.bPositionToUEBasis = true;
+		Settings.CookedMeshCachePath = (std::filesystem::temp_directory_path() / "gtl_benchmark_meshes.gmc").string();
+
+		for (const bool bParallel : { false, true })
+		{
+			Settings.bParallel = bParallel;
+			const FString Name = FString("AssetStartup/") + (bParallel ? "Parallel" : "Serial");
+
+			FAssetLoader Probe;
+			const FAssetLoadStats Stats = Probe.Load(Settings);
+			if (Stats.NumStaticMeshes == 0)
+			{
+				UE_LOG_WARNING("Benchmark: 메시가 없어 건너뜁니다: %s", Settings.RootDirectory.c_str());
+				return;
+			}
+
+			InContext.Run(Name, Stats.NumStaticMeshes, [&]
+			{
+				FAssetLoader Loader;
+				Loader.Load(Settings);
+				InContext.Consume(CreateNullDeviceResources(Loader));
+			});
+
+			UE_LOG("%s: 메시 %u개 (최적화 캐시 %u), 텍스처 %u개 (고유 %u, %.1f MB) - 등록 %.2fms, 메시 %.2fms, 텍스처 %.2fms",
+				Name.c_str(), Stats.NumStaticMeshes, Stats.NumCachedStaticMeshes, Stats.NumTextures, Stats.NumUniqueTextures,
+				Stats.NumTextureBytes / (1024.0 * 1024.0), Stats.ScanMs, Stats.MeshMs, Stats.TextureMs);
+		}
+	}
+
+	/**
+	 * @brief Data/ 모든 메시의 정점 캐시 지표 (FIFO 16, ACMR/ATVR) 최적화 전후 비교와 최적화 시간
+	 * 지표는 참고용으로 출력만 하고, 삼각형 보존과 ACMR 검증은 GTLTests의 Asset/MeshOptimize.Data 에서 한다 (처리량 단위는 삼각형)
+	 */
+	void RunMeshOptimizeBenchmarks(FBenchmarkContext& InContext)
+	{
+		const FString Name = "MeshOptimize/Data";
+		if (!InContext.ShouldRun(Name))
+		{
+			return;
+		}
+
+		FAssetLoadSettings Settings;
+		Settings.RootDirectory = InContext.GetOptions().DataDirectory;
+		Settings.ObjConfig.bIsBinaryEnabled = true;
+		Settings.ObjConfig.bUVToUEBasis = true;
+		Settings.ObjConfig.bPositionToUEBasis = true;
+		Settings.ObjConfig.bOptimizeMesh = false;
+
+		FAssetLoader Loader;
+		Loader.Load(Settings);
+
+		TArray<const FStaticMesh*> SourceMeshes;
+		TArray<FName> SourcePaths;
+		uint64 NumTriangles = 0;
+		for (const FLoadedStaticMesh& Loaded : Loader.GetStaticMeshes())
+		{
+			if (Loaded.Asset)
+			{
+				SourceMeshes.push_back(Loaded.Asset.get());
+				SourcePaths.push_back(Loader.GetRegistry().GetEntry(Loaded.EntryIndex).Path);
+				NumTriangles += Loaded.Asset->Indices.size() / 3;
+			}
+		}
+		if (SourceMeshes.empty())
+		{
+			UE_LOG_WARNING("Benchmark: 메시가 없어 건너뜁니다: %s", Settings.RootDirectory.c_str());
+			return;
+		}
+
+		TArray<FStaticMesh> Meshes;
+		InContext.RunWithSetup(Name, NumTriangles,
+			[&]
+			{
+				Meshes.clear();
+				for (const FStaticMesh* Source : SourceMeshes)
+				{
+					Meshes.push_back(*Source);
+				}
+			},
+			[&]
+			{
+				for (FStaticMesh& Mesh : Meshes)
+				{
+					FMeshOptimizer::OptimizeStaticMesh(Mesh);
+				}
+				InContext.Consume(Meshes.size());
+			});
+
+		FVertexCacheStats TotalBefore;
+		FVertexCacheStats TotalAfter;
+		for (size_t i = 0; i < SourceMeshes.size(); ++i)
+		{
+			FStaticMesh Optimized = *SourceMeshes[i];
+			FMeshOptimizer::OptimizeStaticMesh(Optimized);
+
+			const FVertexCacheStats Before = FMeshOptimizer::AnalyzeStaticMesh(*SourceMeshes[i]);
+			const FVertexCacheStats After = FMeshOptimizer::AnalyzeStaticMesh(Optimized);
+			TotalBefore += Before;
+			TotalAfter += After;
+
+			const FString Path = SourcePaths[i].ToString();
+			UE_LOG("MeshOptimize: %s - 삼각형 %u, 정점 %u: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+				Path.c_str(), Before.NumTriangles, Before.NumVertices,
+				Before.GetACMR(), After.GetACMR(), Before.GetATVR(), After.GetATVR());
+		}
+
+		UE_LOG("MeshOptimize: 전체 %zu개 - ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+			SourceMeshes.size(), TotalBefore.GetACMR(), TotalAfter.GetACMR(), TotalBefore.GetATVR(), TotalAfter.GetATVR());
+	}
+
+	struct FTextureEncodeCase
+	{
+		ETextureFormat Format;
+		ESyntheticTexture Source;
+		// PSNR을 볼 채널
+		uint32 ChannelMask;
+	};
+
+	/**
+	 * @brief 텍스처 쿠커: 밉 생성(Box/Kaiser), 포맷별 인코딩 처리량과 PSNR, 쿠킹 캐시 한 번 읽기 로드
+	 * PSNR은 참고용으로 출력만 하고, 기준 검증은 GTLTests의 Asset/Texture.* 에서 한다 (처리량 단위는 픽셀, 캐시 로드는 바이트)
+	 */
+	void RunTextureCookBenchmarks(FBenchmarkContext& InContext)
+	{
+		const uint32 Seed = InContext.GetOptions().Seed;
+		const uint64 NumPixels = static_cast<uint64>(TEXTURE_SIZE) * TEXTURE_SIZE;
+		const FString SizeSuffix = "/" + std::to_string(TEXTURE_SIZE);
+		const FTextureImage ColorImage = FSyntheticTexture::Make(ESyntheticTexture::Color, TEXTURE_SIZE, Seed);
+
+		for (const EMipFilter Filter : { EMipFilter::Box, EMipFilter::Kaiser })
+		{
+			FTextureCookSettings Settings;
+			Settings.MipFilter = Filter;
+
+			TArray<FTextureImage> Mips;
+			InContext.Run(FString("TextureMips/") + (Filter == EMipFilter::Box ? "Box" : "Kaiser") + SizeSuffix, NumPixels, [&]
+			{
+				FTextureCooker::GenerateMips(ColorImage, Settings, Mips);
+				InContext.Consume(Mips.size());
+			});
+		}
+
+		const FTextureEncodeCase Cases[] =
+		{
+			{ ETextureFormat::BC1, ESyntheticTexture::Color, 0x7 },
+			{ ETextureFormat::BC3, ESyntheticTexture::ColorAlpha, 0xF },
+			{ ETextureFormat::BC5, ESyntheticTexture::Normal, 0x3 },
+			{ ETextureFormat::BC7, ESyntheticTexture::ColorAlpha, 0xF },
+		};
+
+		for (const FTextureEncodeCase& Case : Cases)
+		{
+			const FTextureImage Source = Case.Source == ESyntheticTexture::Color
+				? ColorImage : FSyntheticTexture::Make(Case.Source, TEXTURE_SIZE, Seed);
+			const FString Name = FString("TextureEncode/") + FTextureCooker::GetFormatName(Case.Format) + SizeSuffix;
+
+			TArray<uint8> Encoded;
+			InContext.Run(Name, NumPixels, [&]
+			{
+				FTextureCooker::Encode(Source, Case.Format, Encoded);
+				InContext.Consume(Encoded.size());
+			});
+
+			if (!InContext.ShouldRun(Name))
+			{
+				continue;
+			}
+
+			FTextureImage Decoded;
+			FTextureCooker::Encode(Source, Case.Format, Encoded);
+			if (FTextureCooker::Decode(Encoded.data(), Source.Width, Source.Height, Case.Format, Decoded))
+			{
+				UE_LOG("%s: PSNR %.2f dB (%.2f bpp)", Name.c_str(), FTextureCooker::ComputePSNR(Source, Decoded, Case.ChannelMask),
+					Encoded.size() * 8.0 / NumPixels);
+			}
+		}
+
+		// 밉 체인까지 포함한 한 장 쿠킹과, 여러 장을 담은 캐시 파일 로드
+		FTextureCookSettings CookSettings;
+		FCookedTexture Cooked;
+		InContext.Run("TextureCook/BC7/Kaiser" + SizeSuffix, NumPixels, [&]
+		{
+			FTextureCooker::Cook(ColorImage, CookSettings, Cooked);
+			InContext.Consume(Cooked.Data.size());
+		});
+
+		if (!InContext.ShouldRun("TextureCacheLoad"))
+		{
+			return;
+		}
+
+		const FString CachePath = (std::filesystem::temp_directory_path() / "gtl_benchmark.gtc").string();
+		{
+			FTextureCooker::Cook(ColorImage, CookSettings, Cooked);
+			FCookedTextureCache Cache;
+			for (uint32 i = 0; i < TEXTURE_CACHE_ENTRIES; ++i)
+			{
+				FCookedTexture Copy = Cooked;
+				Cache.Add(i + 1, CookSettings.GetHash(), std::move(Copy));
+			}
+			Cache.Save(CachePath);
+		}
+
+		const uint64 CacheFileSize = GetFileSize(CachePath);
+		InContext.Run("TextureCacheLoad/" + std::to_string(TEXTURE_CACHE_ENTRIES), CacheFileSize, [&]
+		{
+			FCookedTextureCache Cache;
+			Cache.Load(CachePath);
+			uint64 NumFound = 0;
+			for (uint32 i = 0; i < TEXTURE_CACHE_ENTRIES; ++i)
+			{
+				NumFound += Cache.Find(i + 1, CookSettings.GetHash()) ? 1 : 0;
+			}
+			InContext.Consume(NumFound);
+		});
+
+		std::error_code ErrorCode;
+		std::filesystem::remove(CachePath, ErrorCode);
+	}
+}
+
+/**
+ * @brief 애셋/직렬화 스위트: OBJ 텍스트 임포트, objbin 로드/저장, LOD 단순화, 레벨 JSON 저장/로드, Data/ 시작 로드, 메시 캐시 최적화, 텍스처 쿠킹
+ */
+void RunAssetBenchmarks(FBenchmarkContext& InContext)
+{
+	RunObjBenchmarks(InContext);
+	RunLODBenchmarks(InContext);
+	RunLevelJsonBenchmarks(InContext);
+	RunStartupLoadBenchmarks(InContext);
+	RunMeshOptimizeBenchmarks(InContext);
+	RunTextureCookBenchmarks(InContext);
+}
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+using JSON = json::JSON;
+
+bool FBenchmarkContext::ShouldRun(const FString& InName) const
+{
+	if (Options.Filter.empty())
+	{
+		return true;
+	}
+
+	return (Suite + "/" + InName).find(Options.Filter) != FString::npos;
+}
+
+TArray<uint32> FBenchmarkContext::GetPrimitiveCounts() const
+{
+	TArray<uint32> Counts;
+	for (uint32 Count = 1000; Count <= Options.MaxPrimitives; Count *= 10)
+	{
+		Counts.push_back(Count);
+	}
+	return Counts;
+}
+
+void FBenchmarkContext::AddResult(const FString& InName, uint64 InNumItems, TArray<double>& InSamples, uint64 InTotalAllocations)
+{
+	if (InSamples.empty())
+	{
+		return;
+	}
+
+	std::sort(InSamples.begin(), InSamples.end());
+
+	FBenchmarkResult Result;
+	Result.Suite = Suite;
+	Result.Name = InName;
+	Result.NumItems = InNumItems;
+	Result.NumIterations = static_cast<uint32>(InSamples.size());
+	Result.MinMs = InSamples.front();
+	Result.MaxMs = InSamples.back();
+	Result.MedianMs = InSamples[InSamples.size() / 2];
+
+	double TotalMs = 0.0;
+	for (double Sample : InSamples)
+	{
+		TotalMs += Sample;
+	}
+	Result.MeanMs = TotalMs / static_cast<double>(InSamples.size());
+	Result.AllocationsPerIteration = static_cast<double>(InTotalAllocations) / static_cast<double>(InSamples.size());
+
+	printf("  %-48s %10.4f ms  (x%u)\n", Result.GetKey().c_str(), Result.MedianMs, Result.NumIterations);
+	fflush(stdout);
+
+	Results.push_back(Result);
+}
+
+void FBenchmarkRunner::AddSuite(const FString& InName, FBenchmarkSuiteFunction InFunction)
+{
+	Suites.emplace_back(InName, InFunction);
+}
+
+int32 FBenchmarkRunner::Run(const FBenchmarkOptions& InOptions)
+{
+	Options = InOptions;
+	Results.clear();
+
+	for (const auto& [Name, Function] : Suites)
+	{
+		// 로거 스레드 출력과 결과 표가 섞이지 않도록 먼저 비운다
+		FLogger::Flush();
+		printf("[%s]\n", Name.c_str());
+		FBenchmarkContext Context(Options, Name, Results);
+		Function(Context);
+	}
+
+	FLogger::Flush();
+	PrintResults();
+
+	if (!Options.JsonPath.empty() && !WriteJson(Options.JsonPath))
+	{
+		UE_LOG_ERROR("Benchmark: 결과 파일을 쓸 수 없습니다: %s", Options.JsonPath.c_str());
+	}
+
+	if (!Options.BaselinePath.empty())
+	{
+		return CompareWithBaseline(Options.BaselinePath) ? 0 : 1;
+	}
+
+	return 0;
+}
+
+void FBenchmarkRunner::PrintResults() const
+{
+	printf("\n%-48s %12s %12s %12s %12s %14s %12s\n", "Benchmark", "Median(ms)", "Min(ms)", "Max(ms)", "Items", "Items/s", "Allocs/iter");
+	for (const FBenchmarkResult& Result : Results)
+	{
+		printf("%-48s %12.4f %12.4f %12.4f %12llu %14.0f %12.1f\n", Result.GetKey().c_str(), Result.MedianMs, Result.MinMs, Result.MaxMs,
+			static_cast<unsigned long long>(Result.NumItems), Result.GetItemsPerSecond(), Result.AllocationsPerIteration);
+	}
+}
+
+bool FBenchmarkRunner::WriteJson(const FString& InPath) const
+{
+	JSON Root = json::Object();
+	Root["Label"] = Options.Label;
+	Root["Seed"] = static_cast<int>(Options.Seed);
+	Root["MaxPrimitives"] = static_cast<int>(Options.MaxPrimitives);
+
+	JSON ResultsJson = json::Array();
+	for (const FBenchmarkResult& Result : Results)
+	{
+		JSON ResultJson = json::Object();
+		ResultJson["Suite"] = Result.Suite;
+		ResultJson["Name"] = Result.Name;
+		ResultJson["Items"] = static_cast<int64>(Result.NumItems);
+		ResultJson["Iterations"] = static_cast<int>(Result.NumIterations);
+		ResultJson["MedianMs"] = Result.MedianMs;
+		ResultJson["MinMs"] = Result.MinMs;
+		ResultJson["MeanMs"] = Result.MeanMs;
+		ResultJson["MaxMs"] = Result.MaxMs;
+		ResultJson["ItemsPerSecond"] = Result.GetItemsPerSecond();
+		ResultJson["AllocationsPerIteration"] = Result.AllocationsPerIteration;
+		ResultsJson.append(ResultJson);
+	}
+	Root["Results"] = ResultsJson;
+
+	return FJsonSerializer::SaveJsonToFile(Root, InPath);
+}
+
+/**
+ * @brief 이전 실행의 JSON과 중앙값을 비교한다
+ * @return 회귀(REGRESSION_THRESHOLD 이상 느려짐)가 없으면 true
+ */
+bool FBenchmarkRunner::CompareWithBaseline(const FString& InPath) const
+{
+	JSON Baseline;
+	if (!FJsonSerializer::LoadJsonFromFile(Baseline, InPath) || !Baseline.hasKey("Results"))
+	{
+		UE_LOG_ERROR("Benchmark: 기준 결과를 읽을 수 없습니다: %s", InPath.c_str());
+		return false;
+	}
+
+	TMap<FString, double> BaselineMedians;
+	for (const JSON& ResultJson : Baseline.at("Results").ArrayRange())
+	{
+		BaselineMedians[ResultJson.at("Suite").ToString() + "/" + ResultJson.at("Name").ToString()] = ResultJson.at("MedianMs").ToFloat();
+	}
+
+	FString BaselineLabel = Baseline.hasKey("Label") ? Baseline.at("Label").ToString() : InPath;
+	printf("\nCompared with %s\n%-48s %12s %12s %8s\n", BaselineLabel.c_str(), "Benchmark", "Base(ms)", "Now(ms)", "Ratio");
+
+	uint32 NumRegressions = 0;
+	for (const FBenchmarkResult& Result : Results)
+	{
+		auto Iter = BaselineMedians.find(Result.GetKey());
+		if (Iter == BaselineMedians.end() || Iter->second <= 0.0)
+		{
+			continue;
+		}
+
+		const double Ratio = Result.MedianMs / Iter->second;
+		const bool bRegressed = Ratio >= REGRESSION_THRESHOLD;
+		NumRegressions += bRegressed ? 1 : 0;
+
+		printf("%-48s %12.4f %12.4f %7.2fx%s\n", Result.GetKey().c_str(), Iter->second, Result.MedianMs, Ratio, bRegressed ? "  REGRESSION" : "");
+	}
+
+	printf("%u regression(s)\n", NumRegressions);
+	return NumRegressions == 0;
+}
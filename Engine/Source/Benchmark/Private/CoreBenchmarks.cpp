@@ -0,0 +1,313 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/ObjectIterator.h"
+#include "Core/Public/ScopeCycleCounter.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
+
+DECLARE_CYCLE_STAT("Benchmark Outer", STAT_BenchmarkOuter, Benchmark)
+DECLARE_CYCLE_STAT("Benchmark Inner", STAT_BenchmarkInner, Benchmark)
+
+namespace
+{
+	constexpr uint32 NUM_NAMES = 10000;
+	constexpr uint32 NUM_OBJECTS = 10000;
+	// 스레드 버퍼(16K 이벤트)를 넘지 않도록 반복마다 EndFrame으로 비운다
+	constexpr uint32 NUM_SCOPES = 4096;
+	constexpr uint32 NUM_PARALLEL_ITEMS = 1 << 20;
+	constexpr uint32 NUM_EMPTY_JOBS = 1024;
+	constexpr uint32 NUM_MATRICES = 4096;
+
+	void RunNameBenchmarks(FBenchmarkContext& InContext)
+	{
+		TArray<FString> Strings;
+		Strings.reserve(NUM_NAMES);
+		for (uint32 i = 0; i < NUM_NAMES; ++i)
+		{
+			Strings.push_back("BenchmarkName_" + std::to_string(i));
+		}
+
+		// 첫 생성은 이름 테이블에 등록하고, 측정은 이미 등록된 이름의 조회 비용을 본다
+		TArray<FName> Names;
+		Names.reserve(NUM_NAMES);
+		for (const FString& String : Strings)
+		{
+			Names.emplace_back(String);
+		}
+
+		InContext.Run("FName.Construct", NUM_NAMES, [&]
+		{
+			uint64 Sum = 0;
+			for (const FString& String : Strings)
+			{
+				Sum += static_cast<uint64>(FName(String).ComparisonIndex);
+			}
+			InContext.Consume(Sum);
+		});
+
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+		TArray<TPair<uint32, uint32>> Pairs;
+		Pairs.reserve(NUM_NAMES);
+		for (uint32 i = 0; i < NUM_NAMES; ++i)
+		{
+			Pairs.emplace_back(Random.GetIndex(NUM_NAMES), Random.GetIndex(NUM_NAMES));
+		}
+
+		InContext.Run("FName.Equals", NUM_NAMES, [&]
+		{
+			uint64 NumEqual = 0;
+			for (const auto& [A, B] : Pairs)
+			{
+				NumEqual += Names[A] == Names[B] ? 1 : 0;
+			}
+			InContext.Consume(NumEqual);
+		});
+
+		InContext.Run("FName.Compare", NUM_NAMES, [&]
+		{
+			int64 Sum = 0;
+			for (const auto& [A, B] : Pairs)
+			{
+				Sum += Names[A].Compare(Names[B]);
+			}
+			InContext.Consume(static_cast<uint64>(Sum));
+		});
+
+		InContext.Run("FName.ToString", NUM_NAMES, [&]
+		{
+			uint64 Length = 0;
+			for (const FName& Name : Names)
+			{
+				Length += Name.ToString().size();
+			}
+			InContext.Consume(Length);
+		});
+	}
+
+	void RunObjectBenchmarks(FBenchmarkContext& InContext)
+	{
+		// UObject와 UStaticMesh를 번갈아 섞어 Cast 성공/실패가 반반이 되게 한다
+		TArray<UObject*> Objects;
+		Objects.reserve(NUM_OBJECTS);
+		for (uint32 i = 0; i < NUM_OBJECTS; ++i)
+		{
+			if (i % 2 == 0)
+			{
+				Objects.push_back(new UStaticMesh());
+			}
+			else
+			{
+				Objects.push_back(new UObject());
+			}
+		}
+
+		InContext.Run("Cast", NUM_OBJECTS, [&]
+		{
+			uint64 NumCasted = 0;
+			for (UObject* Object : Objects)
+			{
+				NumCasted += Cast<UStaticMesh>(Object) ? 1 : 0;
+			}
+			InContext.Consume(NumCasted);
+		});
+
+		InContext.Run("TObjectIterator.Cached", NUM_OBJECTS, [&]
+		{
+			uint64 NumVisited = 0;
+			for (TObjectIterator<UStaticMesh> It; It; ++It)
+			{
+				++NumVisited;
+			}
+			InContext.Consume(NumVisited);
+		});
+
+		// 오브젝트 삭제 직후처럼 캐시가 무효화된 상태에서 전체 재구축 비용
+		InContext.RunWithSetup("TObjectIterator.Rebuild", NUM_OBJECTS,
+			[] { FObjectCacheManager::InvalidateCache(); },
+			[&]
+			{
+				uint64 NumVisited = 0;
+				for (TObjectIterator<UStaticMesh> It; It; ++It)
+				{
+					++NumVisited;
+				}
+				InContext.Consume(NumVisited);
+			});
+
+		for (UObject* Object : Objects)
+		{
+			delete Object;
+		}
+	}
+
+	/**
+	 * @brief 스코프 하나(시작/끝 타임스탬프 + 이벤트 기록)의 비용, 목표는 50ns 이하
+	 */
+	void RunProfilerBenchmarks(FBenchmarkContext& InContext)
+	{
+		UProfilerManager& Profiler = UProfilerManager::GetInstance();
+
+		InContext.RunWithSetup("Profiler.Scope", NUM_SCOPES,
+			[&] { Profiler.EndFrame(); },
+			[&]
+			{
+				for (uint32 i = 0; i < NUM_SCOPES / 2; ++i)
+				{
+					SCOPE_CYCLE_COUNTER(STAT_BenchmarkOuter);
+					SCOPE_CYCLE_COUNTER(STAT_BenchmarkInner);
+				}
+			});
+
+		InContext.RunWithSetup("Profiler.EndFrame", NUM_SCOPES,
+			[&]
+			{
+				for (uint32 i = 0; i < NUM_SCOPES / 2; ++i)
+				{
+					SCOPE_CYCLE_COUNTER(STAT_BenchmarkOuter);
+					SCOPE_CYCLE_COUNTER(STAT_BenchmarkInner);
+				}
+			},
+			[&] { Profiler.EndFrame(); });
+	}
+
+	/**
+	 * @brief 같은 작업을 직렬 / ParallelFor로 돌려 비교하고, 빈 잡 생성/실행/대기의 고정 비용을 잰다
+	 */
+	void RunJobSystemBenchmarks(FBenchmarkContext& InContext)
+	{
+		TArray<float> Values(NUM_PARALLEL_ITEMS);
+		for (uint32 i = 0; i < NUM_PARALLEL_ITEMS; ++i)
+		{
+			Values[i] = static_cast<float>(i % 1024) * 0.25f;
+		}
+
+		auto Transform = [&Values](uint32 InBegin, uint32 InEnd)
+		{
+			for (uint32 i = InBegin; i < InEnd; ++i)
+			{
+				Values[i] = sqrtf(Values[i] * Values[i] + 1.0f);
+			}
+		};
+
+		InContext.Run("JobSystem.SerialFor", NUM_PARALLEL_ITEMS, [&]
+		{
+			Transform(0, NUM_PARALLEL_ITEMS);
+			InContext.Consume(static_cast<uint64>(Values[NUM_PARALLEL_ITEMS - 1]));
+		});
+
+		InContext.Run("JobSystem.ParallelFor", NUM_PARALLEL_ITEMS, [&]
+		{
+			FJobSystem::ParallelFor(NUM_PARALLEL_ITEMS, Transform, 1024);
+			InContext.Consume(static_cast<uint64>(Values[NUM_PARALLEL_ITEMS - 1]));
+		});
+
+		InContext.Run("JobSystem.EmptyJobs", NUM_EMPTY_JOBS, [&]
+		{
+			FJobHandle Root = FJobSystem::CreateJob([] {});
+			for (uint32 i = 0; i < NUM_EMPTY_JOBS; ++i)
+			{
+				FJobSystem::Run(FJobSystem::CreateJob([] {}, Root));
+			}
+			FJobSystem::Run(Root);
+			FJobSystem::Wait(Root);
+		});
+	}
+
+	/**
+	 * @brief 행렬 커널 호출당 비용: 일반 / 아핀 / TRS 역행렬, 곱, 전치, 벡터 변환
+	 */
+	void RunMatrixBenchmarks(FBenchmarkContext& InContext)
+	{
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+
+		TArray<FVector> Locations;
+		TArray<FVector> Rotations;
+		TArray<FVector> Scales;
+		TArray<FMatrix> Matrices;
+		TArray<FVector4> Vectors;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			Locations.push_back(Random.GetVector(-100.0f, 100.0f));
+			Rotations.push_back(Random.GetVector(-PI, PI));
+			Scales.push_back(Random.GetVector(0.1f, 4.0f));
+			Matrices.push_back(FMatrix::GetModelMatrix(Locations[i], Rotations[i], Scales[i]));
+			Vectors.emplace_back(Random.GetRange(-1.0f, 1.0f), Random.GetRange(-1.0f, 1.0f), Random.GetRange(-1.0f, 1.0f), 1.0f);
+		}
+
+		TArray<FMatrix> Results(NUM_MATRICES);
+		auto ConsumeResults = [&]
+		{
+			InContext.Consume(static_cast<uint64>(std::fabs(Results[NUM_MATRICES - 1].Data[3][0])));
+		};
+
+		InContext.Run("Matrix.Inverse", NUM_MATRICES, [&]
+		{
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				Results[i] = Matrices[i].Inverse();
+			}
+			ConsumeResults();
+		});
+
+		InContext.Run("Matrix.InverseAffine", NUM_MATRICES, [&]
+		{
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				Results[i] = Matrices[i].InverseAffine();
+			}
+			ConsumeResults();
+		});
+
+		InContext.Run("Matrix.ModelMatrixInverse", NUM_MATRICES, [&]
+		{
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				Results[i] = FMatrix::GetModelMatrixInverse(Locations[i], Rotations[i], Scales[i]);
+			}
+			ConsumeResults();
+		});
+
+		InContext.Run("Matrix.Multiply", NUM_MATRICES, [&]
+		{
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				FMatrix Left = Matrices[i];
+				Results[i] = Left * Matrices[(i + 1) % NUM_MATRICES];
+			}
+			ConsumeResults();
+		});
+
+		InContext.Run("Matrix.Transpose", NUM_MATRICES, [&]
+		{
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				Results[i] = Matrices[i].Transpose();
+			}
+			ConsumeResults();
+		});
+
+		InContext.Run("Matrix.VectorMultiply", NUM_MATRICES, [&]
+		{
+			float Sum = 0.0f;
+			for (uint32 i = 0; i < NUM_MATRICES; ++i)
+			{
+				Sum += FMatrix::VectorMultiply(Vectors[i], Matrices[i]).X;
+			}
+			InContext.Consume(static_cast<uint64>(std::fabs(Sum)));
+		});
+	}
+}
+
+/**
+ * @brief 코어 오브젝트 시스템 스위트: FName 생성/비교, Cast, TObjectIterator, 프로파일러 스코프, 잡 시스템, 행렬 커널
+ */
+void RunCoreBenchmarks(FBenchmarkContext& InContext)
+{
+	RunNameBenchmarks(InContext);
+	RunObjectBenchmarks(InContext);
+	RunProfilerBenchmarks(InContext);
+	RunJobSystemBenchmarks(InContext);
+	RunMatrixBenchmarks(InContext);
+}
@@ -0,0 +1,154 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+#include "Core/Public/JobSystem.h"
+#include "Render/FontRenderer/Public/TextBatcher.h"
+#include "Render/Renderer/Public/DebugDraw.h"
+
+namespace
+{
+	constexpr uint32 NUM_LABELS = 1000;
+	constexpr uint32 NUM_DEBUG_BOXES = 10000;
+
+	void RunTextBenchmarks(FBenchmarkContext& InContext)
+	{
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+
+		// UUID 라벨처럼 짧고 서로 다른 문자열
+		TArray<FString> Labels;
+		TArray<FMatrix> WorldMatrices;
+		Labels.reserve(NUM_LABELS);
+		WorldMatrices.reserve(NUM_LABELS);
+		for (uint32 i = 0; i < NUM_LABELS; ++i)
+		{
+			Labels.push_back("UID: " + std::to_string(Random.GetIndex(1000000)));
+			WorldMatrices.push_back(FMatrix::GetModelMatrix(Random.GetVector(-100.0f, 100.0f), Random.GetVector(0.0f, 360.0f), FVector::OneVector()));
+		}
+
+		// 기존 경로: 라벨마다 정점 배열을 새로 만든다 (GPU 쪽 버퍼/스테이트 생성 6회는 여기서 재지 않는다)
+		InContext.Run("Text.Immediate", NUM_LABELS, [&]
+		{
+			uint64 NumVertices = 0;
+			for (const FString& Label : Labels)
+			{
+				TArray<FFontVertex> Vertices;
+				FTextBatcher::BuildLocalQuads(Label.c_str(), Label.size(), FTextLayout(), Vertices);
+				NumVertices += Vertices.size();
+			}
+			InContext.Consume(NumVertices);
+		});
+
+		// 캐시가 비어 있는 첫 프레임 (모든 라벨이 캐시 미스)
+		FTextBatcher* ColdBatcher = nullptr;
+		InContext.RunWithSetup("Text.BatchedColdCache", NUM_LABELS, [&]
+		{
+			delete ColdBatcher;
+			ColdBatcher = new FTextBatcher();
+		}, [&]
+		{
+			ColdBatcher->BeginFrame();
+			ColdBatcher->BeginBatch();
+			for (uint32 i = 0; i < NUM_LABELS; ++i)
+			{
+				ColdBatcher->AddText(Labels[i].c_str(), WorldMatrices[i]);
+			}
+			InContext.Consume(ColdBatcher->EndBatch().NumVertices);
+		});
+		delete ColdBatcher;
+
+		// 라벨이 바뀌지 않는 일반적인 프레임 (캐시 적중, 정점 배열 용량 재사용)
+		FTextBatcher Batcher;
+		InContext.Run("Text.Batched", NUM_LABELS, [&]
+		{
+			Batcher.BeginFrame();
+			Batcher.BeginBatch();
+			for (uint32 i = 0; i < NUM_LABELS; ++i)
+			{
+				Batcher.AddText(Labels[i].c_str(), WorldMatrices[i]);
+			}
+			InContext.Consume(Batcher.EndBatch().NumVertices);
+		});
+	}
+
+	/**
+	 * @brief 디버그 박스를 한 스레드 / 여러 스레드에서 넣고 MergeFrame으로 모은 뒤,
+	 * GPU 대신 CPU 배열을 링 버퍼 삼아 업로드 구간까지 잰다 (Null 백엔드)
+	 */
+	void RunDebugDrawBenchmarks(FBenchmarkContext& InContext)
+	{
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+
+		TArray<FAABB> Boxes;
+		Boxes.reserve(NUM_DEBUG_BOXES);
+		for (uint32 i = 0; i < NUM_DEBUG_BOXES; ++i)
+		{
+			const FVector Center = Random.GetVector(-500.0f, 500.0f);
+			const FVector Extent = Random.GetVector(0.5f, 5.0f);
+			Boxes.emplace_back(Center - Extent, Center + Extent);
+		}
+
+		const FVector4 Color(1.0f, 1.0f, 0.0f, 1.0f);
+		FRingBufferAllocator Ring(4096);
+		TArray<FDebugLineVertex> RingMemory(Ring.GetCapacity());
+
+		auto UploadFrame = [&]
+		{
+			const FDebugLineStream& Vertices = FDebugDraw::GetTransientVertices();
+			const FRingBufferAllocator::FAllocation Allocation = Ring.Allocate(Vertices.Num());
+			if (Allocation.bResized)
+			{
+				RingMemory.resize(Ring.GetCapacity());
+			}
+			std::copy_n(Vertices.GetData(), Vertices.Num(), RingMemory.data() + Allocation.FirstElement);
+			InContext.Consume(Allocation.FirstElement + Vertices.Num());
+		};
+
+		// 첫 MergeFrame 전 용량을 잡아 두어 측정 구간에서는 재할당이 없게 한다
+		for (const FAABB& Box : Boxes)
+		{
+			FDebugDraw::DrawBox(Box, Color);
+		}
+		FDebugDraw::MergeFrame();
+		UploadFrame();
+
+		InContext.Run("DebugDraw.Boxes", NUM_DEBUG_BOXES, [&]
+		{
+			for (const FAABB& Box : Boxes)
+			{
+				FDebugDraw::DrawBox(Box, Color);
+			}
+			FDebugDraw::MergeFrame();
+			UploadFrame();
+		});
+
+		InContext.Run("DebugDraw.BoxesParallel", NUM_DEBUG_BOXES, [&]
+		{
+			FJobSystem::ParallelFor(NUM_DEBUG_BOXES, [&](uint32 InBegin, uint32 InEnd)
+			{
+				for (uint32 i = InBegin; i < InEnd; ++i)
+				{
+					FDebugDraw::DrawBox(Boxes[i], Color);
+				}
+			}, 256);
+			FDebugDraw::MergeFrame();
+			UploadFrame();
+		});
+
+		// 레이어가 바뀌지 않는 프레임은 Persistent 스트림을 다시 만들지 않는다
+		TArray<FDebugLineVertex> GridVertices(1000, { FVector(), Color });
+		FDebugDraw::SetPersistentLayer(EDebugDrawLayer::Custom, std::move(GridVertices));
+		InContext.Run("DebugDraw.EmptyFrame", 1, [&]
+		{
+			FDebugDraw::MergeFrame();
+			InContext.Consume(FDebugDraw::GetPersistentVersion());
+		});
+		FDebugDraw::ClearPersistentLayer(EDebugDrawLayer::Custom);
+		FDebugDraw::MergeFrame();
+	}
+}
+
+void RunRenderBenchmarks(FBenchmarkContext& InContext)
+{
+	RunTextBenchmarks(InContext);
+	RunDebugDrawBenchmarks(InContext);
+}
@@ -0,0 +1,431 @@
+#include "pch.h"
+#include "Benchmark/Public/Benchmark.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Editor/Public/FrustumCull.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+#include "Manager/BVH/public/PrimitiveBVH.h"
+#include "Manager/Transform/Public/TransformHierarchy.h"
+
+namespace
+{
+	constexpr uint32 NUM_RAYS = 4096;
+	constexpr uint32 NUM_FRUSTUMS = 16;
+	// 선형 탐색 기준선은 이 크기까지만 잰다
+	constexpr uint32 MAX_LINEAR_PRIMITIVES = 100000;
+	// 트랜스폼 계층: 액터 하나 = 노드 NUM_NODES_PER_ROOT개 (루트 -> A -> B 체인 + 루트 -> C)
+	constexpr uint32 NUM_NODES_PER_ROOT = 4;
+	// 부분 갱신에서 프레임마다 움직이는 루트 비율의 역수
+	constexpr uint32 MOVED_ROOT_STRIDE = 10;
+
+	/**
+	 * @brief 밀도가 일정하도록 크기를 키운 정육면체 안에 무작위 박스를 뿌린다
+	 */
+	void MakeRandomBoxes(FBenchmarkRandom& InRandom, uint32 InCount, TArray<FBox>& OutBoxes)
+	{
+		const float HalfSize = 5.0f * std::cbrt(static_cast<float>(InCount));
+
+		OutBoxes.clear();
+		OutBoxes.reserve(InCount);
+		for (uint32 i = 0; i < InCount; ++i)
+		{
+			const FVector Center = InRandom.GetVector(-HalfSize, HalfSize);
+			const FVector Extent = InRandom.GetVector(0.25f, 1.0f);
+			OutBoxes.push_back(FBox::Make(Center - Extent, Center + Extent));
+		}
+	}
+
+	/**
+	 * @brief 바운드를 감싸는 구 바깥에서 바운드 안의 임의 점을 향하는 레이를 만든다
+	 */
+	void MakeRandomRays(FBenchmarkRandom& InRandom, const FBox& InBounds, uint32 InCount, TArray<FRay>& OutRays)
+	{
+		const FVector Center = InBounds.GetCenter();
+		const FVector HalfExtent = (InBounds.GetMax() - InBounds.GetMin()) * 0.5f;
+		const float Radius = std::max(HalfExtent.Length(), 1.0f) * 1.5f;
+
+		OutRays.clear();
+		OutRays.reserve(InCount);
+		for (uint32 i = 0; i < InCount; ++i)
+		{
+			FVector Offset = InRandom.GetVector(-1.0f, 1.0f);
+			if (Offset.Length() < 1e-3f)
+			{
+				Offset = FVector(1.0f, 0.0f, 0.0f);
+			}
+			Offset.Normalize();
+
+			const FVector Target = Center + FVector(
+				InRandom.GetRange(-HalfExtent.X, HalfExtent.X),
+				InRandom.GetRange(-HalfExtent.Y, HalfExtent.Y),
+				InRandom.GetRange(-HalfExtent.Z, HalfExtent.Z)) * 0.5f;
+			const FVector Origin = Center + Offset * Radius;
+
+			FVector Direction = Target - Origin;
+			Direction.Normalize();
+
+			FRay Ray;
+			Ray.Origin = FVector4(Origin.X, Origin.Y, Origin.Z, 1.0f);
+			Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+			OutRays.push_back(Ray);
+		}
+	}
+
+	/**
+	 * @brief 바운드 주위를 도는 카메라들의 View * Projection 행렬 (UCamera::UpdateMatrixByPers와 같은 규칙)
+	 */
+	void MakeOrbitViewProjections(const FBox& InBounds, uint32 InCount, TArray<FMatrix>& OutViewProjections)
+	{
+		const FVector Center = InBounds.GetCenter();
+		const float Radius = std::max((InBounds.GetMax() - InBounds.GetMin()).Length() * 0.5f, 1.0f);
+		const float NearClip = 0.1f;
+		const float FarClip = Radius * 4.0f;
+		const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(60.0f) * 0.5f);
+
+		FMatrix Projection = FMatrix::Identity();
+		Projection.Data[0][0] = F / (16.0f / 9.0f);
+		Projection.Data[1][1] = F;
+		Projection.Data[2][2] = FarClip / (FarClip - NearClip);
+		Projection.Data[2][3] = 1.0f;
+		Projection.Data[3][2] = (-NearClip * FarClip) / (FarClip - NearClip);
+		Projection.Data[3][3] = 0.0f;
+
+		OutViewProjections.clear();
+		for (uint32 i = 0; i < InCount; ++i)
+		{
+			// 절반은 씬 바깥에서 중심을, 절반은 씬 안에서 바깥쪽을 본다
+			const float Angle = 2.0f * PI * static_cast<float>(i) / static_cast<float>(InCount);
+			const bool bInside = (i % 2) == 1;
+			const float Distance = bInside ? Radius * 0.25f : Radius * 1.5f;
+			const FVector Location = Center + FVector(std::cos(Angle) * Distance, std::sin(Angle) * Distance, Radius * 0.2f);
+
+			FVector Forward = bInside ? FVector(std::cos(Angle), std::sin(Angle), -0.1f) : Center - Location;
+			Forward.Normalize();
+			FVector Right = Forward.Cross(FVector::UpVector());
+			Right.Normalize();
+			const FVector Up = Right.Cross(Forward);
+
+			FMatrix View = FMatrix::TranslationMatrixInverse(Location) * FMatrix(Right, Up, Forward).Transpose();
+			OutViewProjections.push_back(View * Projection);
+		}
+	}
+
+	/** objbin의 모든 오브젝트를 하나의 위치/인덱스 스트림으로 합친다 (삼각형 BVH 입력용) */
+	bool LoadMeshPositions(const FString& InPath, FStaticMesh& OutMesh)
+	{
+		if (!std::filesystem::exists(InPath))
+		{
+			return false;
+		}
+
+		FObjInfo ObjInfo;
+		FWindowsBinReader Reader(InPath);
+		Reader << ObjInfo;
+
+		OutMesh.PathFileName = FName(InPath);
+		OutMesh.Positions.assign(ObjInfo.VertexList.begin(), ObjInfo.VertexList.end());
+		OutMesh.Indices.clear();
+		for (const FObjectInfo& ObjectInfo : ObjInfo.ObjectInfoList)
+		{
+			for (size_t VertexIndex : ObjectInfo.VertexIndexList)
+			{
+				OutMesh.Indices.push_back(static_cast<uint32>(VertexIndex));
+			}
+		}
+		return !OutMesh.Indices.empty();
+	}
+
+	void RunPrimitiveBVHBenchmarks(FBenchmarkContext& InContext, uint32 InCount)
+	{
+		const FString Suffix = "/" + std::to_string(InCount);
+
+		// 크기마다 시드를 따로 두어 MaxPrimitives를 바꿔도 같은 크기의 입력은 그대로 유지된다
+		FBenchmarkRandom Random(InContext.GetOptions().Seed + InCount);
+
+		TArray<FBox> Boxes;
+		MakeRandomBoxes(Random, InCount, Boxes);
+
+		FBox SceneBounds = FBox::Empty();
+		for (const FBox& Box : Boxes)
+		{
+			SceneBounds.Expand(Box);
+		}
+
+		FPrimitiveBVH Tree;
+		InContext.Run("BVH.Build" + Suffix, InCount, [&]
+		{
+			Tree.Build(Boxes);
+		});
+		if (Tree.IsEmpty())
+		{
+			Tree.Build(Boxes);
+		}
+
+		// 모든 박스를 조금씩 옮긴 두 상태를 번갈아 리핏한다
+		TArray<FBox> MovedBoxes[2] = { Boxes, Boxes };
+		const __m128 Offset = _mm_setr_ps(0.5f, -0.25f, 0.125f, 0.0f);
+		for (FBox& Box : MovedBoxes[1])
+		{
+			Box.Store(_mm_add_ps(Box.LoadMin(), Offset), _mm_add_ps(Box.LoadMax(), Offset));
+		}
+		uint32 RefitIndex = 0;
+		InContext.Run("BVH.Refit" + Suffix, InCount, [&]
+		{
+			Tree.Refit(MovedBoxes[RefitIndex]);
+			RefitIndex ^= 1;
+		});
+		Tree.Refit(Boxes);
+
+		TArray<FRay> Rays;
+		MakeRandomRays(Random, SceneBounds, NUM_RAYS, Rays);
+		InContext.Run("BVH.Raycast" + Suffix, NUM_RAYS, [&]
+		{
+			uint64 NumHits = 0;
+			for (const FRay& Ray : Rays)
+			{
+				float ClosestHit = FLT_MAX;
+				const int HitIndex = Tree.Raycast(Ray, ClosestHit, [&](uint32 InIndex, float& InOutClosestHit)
+				{
+					float Distance = 0.0f;
+					if (Boxes[InIndex].RaycastHit(Ray, &Distance) && Distance < InOutClosestHit)
+					{
+						InOutClosestHit = Distance;
+						return true;
+					}
+					return false;
+				});
+				NumHits += HitIndex >= 0 ? 1 : 0;
+			}
+			InContext.Consume(NumHits);
+		});
+
+		TArray<FMatrix> ViewProjections;
+		MakeOrbitViewProjections(SceneBounds, NUM_FRUSTUMS, ViewProjections);
+		FFrustumCull Frustum;
+		TArray<uint32> VisibleIndices;
+
+		InContext.Run("BVH.FrustumCull" + Suffix, static_cast<uint64>(InCount) * NUM_FRUSTUMS, [&]
+		{
+			for (const FMatrix& ViewProjection : ViewProjections)
+			{
+				Frustum.Update(ViewProjection);
+				Tree.FrustumCull(Frustum, VisibleIndices);
+				InContext.Consume(VisibleIndices.size());
+			}
+		});
+
+		if (InCount <= MAX_LINEAR_PRIMITIVES)
+		{
+			InContext.Run("Linear.FrustumCull" + Suffix, static_cast<uint64>(InCount) * NUM_FRUSTUMS, [&]
+			{
+				for (const FMatrix& ViewProjection : ViewProjections)
+				{
+					Frustum.Update(ViewProjection);
+					VisibleIndices.clear();
+					for (uint32 i = 0; i < InCount; ++i)
+					{
+						if (Frustum.IsInFrustum(Boxes[i]) == EFrustumTestResult::Inside)
+						{
+							VisibleIndices.push_back(i);
+						}
+					}
+					InContext.Consume(VisibleIndices.size());
+				}
+			});
+		}
+	}
+
+	/**
+	 * @brief 기존 USceneComponent 방식(노드마다 조상 체인을 다시 곱함)과 FTransformHierarchy의 dirty 서브트리 갱신을 비교한다
+	 */
+	void RunTransformHierarchyBenchmarks(FBenchmarkContext& InContext, uint32 InCount)
+	{
+		const FString Suffix = "/" + std::to_string(InCount);
+		FBenchmarkRandom Random(InContext.GetOptions().Seed + InCount);
+
+		const uint32 NumRoots = std::max(1u, InCount / NUM_NODES_PER_ROOT);
+		const uint32 NumNodes = NumRoots * NUM_NODES_PER_ROOT;
+
+		TArray<uint32> Parents;
+		TArray<FVector> Locations;
+		TArray<FVector> Rotations;
+		TArray<FVector> Scales;
+		Parents.reserve(NumNodes);
+		for (uint32 Root = 0; Root < NumRoots; ++Root)
+		{
+			const uint32 RootIndex = static_cast<uint32>(Parents.size());
+			Parents.push_back(FTransformHierarchy::INVALID_HANDLE);
+			Parents.push_back(RootIndex);
+			Parents.push_back(RootIndex + 1);
+			Parents.push_back(RootIndex);
+		}
+		for (uint32 i = 0; i < NumNodes; ++i)
+		{
+			const bool bIsRoot = Parents[i] == FTransformHierarchy::INVALID_HANDLE;
+			Locations.push_back(bIsRoot ? Random.GetVector(-500.0f, 500.0f) : Random.GetVector(-2.0f, 2.0f));
+			Rotations.push_back(Random.GetVector(-180.0f, 180.0f));
+			Scales.push_back(Random.GetVector(0.5f, 1.5f));
+		}
+
+		TArray<FMatrix> WorldMatrices(NumNodes);
+		InContext.Run("Transform.AncestorChain" + Suffix, NumNodes, [&]
+		{
+			for (uint32 i = 0; i < NumNodes; ++i)
+			{
+				FMatrix World = FMatrix::GetModelMatrix(Locations[i], FVector::GetDegreeToRadian(Rotations[i]), Scales[i]);
+				for (uint32 Ancestor = Parents[i]; Ancestor != FTransformHierarchy::INVALID_HANDLE; Ancestor = Parents[Ancestor])
+				{
+					World *= FMatrix::GetModelMatrix(Locations[Ancestor], FVector::GetDegreeToRadian(Rotations[Ancestor]), Scales[Ancestor]);
+				}
+				WorldMatrices[i] = World;
+			}
+			InContext.Consume(static_cast<uint64>(std::fabs(WorldMatrices[NumNodes - 1].Data[3][0])));
+		});
+
+		// 핸들은 추가 순서대로 0부터 나온다
+		FTransformHierarchy Hierarchy;
+		for (uint32 i = 0; i < NumNodes; ++i)
+		{
+			Hierarchy.Add(nullptr, Parents[i], Locations[i], Rotations[i], Scales[i]);
+		}
+		Hierarchy.Update();
+
+		InContext.RunWithSetup("Transform.HierarchyUpdate" + Suffix, NumNodes,
+			[&]
+			{
+				for (uint32 Handle = 0; Handle < NumNodes; Handle += NUM_NODES_PER_ROOT)
+				{
+					Hierarchy.SetLocalTransform(Handle, Locations[Handle], Rotations[Handle], Scales[Handle]);
+				}
+			},
+			[&]
+			{
+				Hierarchy.Update();
+				InContext.Consume(Hierarchy.GetNumUpdatedNodes());
+			});
+
+		// 일부 액터만 움직인 프레임: 깨끗한 서브트리는 건너뛴다
+		InContext.RunWithSetup("Transform.HierarchyUpdatePartial" + Suffix, NumNodes,
+			[&]
+			{
+				for (uint32 Handle = 0; Handle < NumNodes; Handle += NUM_NODES_PER_ROOT * MOVED_ROOT_STRIDE)
+				{
+					Hierarchy.SetLocalTransform(Handle, Locations[Handle], Rotations[Handle], Scales[Handle]);
+				}
+			},
+			[&]
+			{
+				Hierarchy.Update();
+				InContext.Consume(Hierarchy.GetNumUpdatedNodes());
+			});
+	}
+
+	/**
+	 * @brief 월드 바운드 계산: 8개 꼭짓점 변환(이전 GetWorldAABB) vs 중심/반지름 변환을 연속 배열에 일괄 적용
+	 */
+	void RunWorldBoundsBenchmarks(FBenchmarkContext& InContext, uint32 InCount)
+	{
+		const FString Suffix = "/" + std::to_string(InCount);
+		FBenchmarkRandom Random(InContext.GetOptions().Seed + InCount);
+
+		TArray<FBox> LocalBoxes;
+		MakeRandomBoxes(Random, InCount, LocalBoxes);
+
+		TArray<FMatrix> Matrices;
+		Matrices.reserve(InCount);
+		for (uint32 i = 0; i < InCount; ++i)
+		{
+			Matrices.push_back(FMatrix::GetModelMatrix(Random.GetVector(-500.0f, 500.0f),
+				FVector::GetDegreeToRadian(Random.GetVector(-180.0f, 180.0f)), Random.GetVector(0.5f, 1.5f)));
+		}
+
+		TArray<FBox> WorldBoxes(InCount);
+		InContext.Run("Bounds.EightCorners" + Suffix, InCount, [&]
+		{
+			for (uint32 i = 0; i < InCount; ++i)
+			{
+				const FVector Min = LocalBoxes[i].GetMin();
+				const FVector Max = LocalBoxes[i].GetMax();
+				FBox WorldBox = FBox::Empty();
+				for (uint32 Corner = 0; Corner < 8; ++Corner)
+				{
+					const FVector4 Local((Corner & 1) ? Max.X : Min.X, (Corner & 2) ? Max.Y : Min.Y, (Corner & 4) ? Max.Z : Min.Z, 1.0f);
+					const FVector4 World = Local * Matrices[i];
+					WorldBox.ExpandPoint(FVector(World.X, World.Y, World.Z));
+				}
+				WorldBoxes[i] = WorldBox;
+			}
+			InContext.Consume(static_cast<uint64>(std::fabs(WorldBoxes[InCount - 1].Max[0])));
+		});
+
+		InContext.Run("Bounds.TransformBoxes" + Suffix, InCount, [&]
+		{
+			FBox::TransformBoxes(LocalBoxes.data(), Matrices.data(), WorldBoxes.data(), InCount);
+			InContext.Consume(static_cast<uint64>(std::fabs(WorldBoxes[InCount - 1].Max[0])));
+		});
+	}
+
+	void RunTriangleBVHBenchmarks(FBenchmarkContext& InContext)
+	{
+		FBenchmarkRandom Random(InContext.GetOptions().Seed);
+		UStaticMesh* StaticMesh = new UStaticMesh();
+
+		for (const FString& MeshName : GetBenchmarkMeshNames())
+		{
+			FStaticMesh Mesh;
+			if (!LoadMeshPositions(InContext.GetDataPath(MeshName + ".objbin"), Mesh))
+			{
+				UE_LOG_WARNING("Benchmark: 메시를 찾을 수 없어 건너뜁니다: %s", MeshName.c_str());
+				continue;
+			}
+
+			const uint32 NumTriangles = static_cast<uint32>(Mesh.Indices.size() / 3);
+			InContext.Run("TriangleBVH.Build/" + MeshName, NumTriangles, [&]
+			{
+				UStaticMesh::RebuildTriangleBVH(Mesh);
+				InContext.Consume(Mesh.TriangleBVHNodes.size());
+			});
+			StaticMesh->SetStaticMeshAsset(&Mesh);
+
+			FBox MeshBounds = FBox::Empty();
+			for (const FMeshPosition& Position : Mesh.Positions)
+			{
+				MeshBounds.ExpandPoint(Position.ToVector());
+			}
+
+			TArray<FRay> Rays;
+			MakeRandomRays(Random, MeshBounds, NUM_RAYS, Rays);
+			InContext.Run("TriangleBVH.Raycast/" + MeshName, NUM_RAYS, [&]
+			{
+				uint64 NumHits = 0;
+				for (const FRay& Ray : Rays)
+				{
+					float Distance = FLT_MAX;
+					NumHits += StaticMesh->RaycastTriangleBVH(Ray, Distance) ? 1 : 0;
+				}
+				InContext.Consume(NumHits);
+			});
+
+			StaticMesh->SetStaticMeshAsset(nullptr);
+		}
+
+		delete StaticMesh;
+	}
+}
+
+/**
+ * @brief 공간 질의 스위트: FPrimitiveBVH 빌드/리핏/레이캐스트/프러스텀 컬링과 트랜스폼 계층/월드 바운드 갱신 (합성 1k ~ MaxPrimitives),
+ * 실제 메시의 삼각형 BVH 빌드/레이캐스트
+ */
+void RunSpatialBenchmarks(FBenchmarkContext& InContext)
+{
+	for (uint32 Count : InContext.GetPrimitiveCounts())
+	{
+		RunPrimitiveBVHBenchmarks(InContext, Count);
+		RunTransformHierarchyBenchmarks(InContext, Count);
+		RunWorldBoundsBenchmarks(InContext, Count);
+	}
+
+	RunTriangleBVHBenchmarks(InContext);
+}
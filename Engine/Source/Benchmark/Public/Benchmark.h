@@ -0,0 +1,177 @@
+#pragma once
+#include "Core/Public/PlatformTime.h"
+
+#include <random>
+
+/**
+ * @brief 벤치마크 실행 옵션
+ */
+struct FBenchmarkOptions
+{
+	// 이름(Suite/Name)에 이 문자열이 들어간 항목만 실행한다 (비어 있으면 전체)
+	FString Filter;
+	// 결과를 기록할 JSON 경로와, 비교 기준이 되는 이전 결과 JSON 경로
+	FString JsonPath;
+	FString BaselinePath;
+	// 결과에 함께 기록할 식별자 (커밋 해시 등)
+	FString Label;
+	FString DataDirectory = "Data";
+
+	// 합성 데이터셋의 최대 프리미티브 수 (1k, 10k, ... 순으로 이 값까지 키운다)
+	uint32 MaxPrimitives = 1000000;
+	// 항목마다 최소 반복 횟수와 최소 측정 시간을 모두 채울 때까지 반복한다
+	uint32 MinIterations = 5;
+	uint32 MaxIterations = 1000;
+	double MinTimeMs = 200.0;
+	// 합성 데이터셋 시드 (같은 시드면 커밋 간 같은 입력)
+	uint32 Seed = 20251001;
+};
+
+/**
+ * @brief 항목 하나의 측정 결과 (반복마다 잰 시간의 통계)
+ */
+struct FBenchmarkResult
+{
+	FString Suite;
+	FString Name;
+	uint64 NumItems = 0;
+	uint32 NumIterations = 0;
+	double MinMs = 0.0;
+	double MedianMs = 0.0;
+	double MeanMs = 0.0;
+	double MaxMs = 0.0;
+	// 반복 한 번에 일어난 평균 힙 할당 횟수 (operator new 호출 수)
+	double AllocationsPerIteration = 0.0;
+
+	FString GetKey() const { return Suite + "/" + Name; }
+	double GetItemsPerSecond() const { return MedianMs > 0.0 ? static_cast<double>(NumItems) * 1000.0 / MedianMs : 0.0; }
+};
+
+/**
+ * @brief 합성 데이터셋용 난수 (표준 분포 클래스는 구현마다 결과가 달라 직접 변환한다)
+ */
+class FBenchmarkRandom
+{
+public:
+	explicit FBenchmarkRandom(uint32 InSeed) : Engine(InSeed) {}
+
+	float GetFraction() { return static_cast<float>(Engine() >> 8) * (1.0f / 16777216.0f); }
+	float GetRange(float InMin, float InMax) { return InMin + (InMax - InMin) * GetFraction(); }
+	uint32 GetIndex(uint32 InCount) { return InCount > 0 ? static_cast<uint32>(Engine() % InCount) : 0; }
+	FVector GetVector(float InMin, float InMax) { return FVector(GetRange(InMin, InMax), GetRange(InMin, InMax), GetRange(InMin, InMax)); }
+
+private:
+	std::mt19937 Engine;
+};
+
+/**
+ * @brief 스위트 하나를 실행하는 동안 항목 측정과 결과 수집을 맡는다
+ *
+ * Run(Name, NumItems, Body)는 한 번 워밍업한 뒤 Body를 반복 실행해 반복당 시간을 잰다
+ * Setup이 있는 버전은 반복마다 Setup을 먼저 부르고 그 시간은 측정에서 뺀다
+ */
+class FBenchmarkContext
+{
+public:
+	FBenchmarkContext(const FBenchmarkOptions& InOptions, const FString& InSuite, TArray<FBenchmarkResult>& OutResults)
+		: Options(InOptions), Suite(InSuite), Results(OutResults)
+	{
+	}
+
+	const FBenchmarkOptions& GetOptions() const { return Options; }
+	bool ShouldRun(const FString& InName) const;
+	FString GetDataPath(const FString& InRelativePath) const { return Options.DataDirectory + "/" + InRelativePath; }
+
+	/** 합성 데이터셋 크기 목록 (1k부터 10배씩, MaxPrimitives까지) */
+	TArray<uint32> GetPrimitiveCounts() const;
+
+	/** 결과를 버리지 않도록 값을 흡수한다 (최적화로 측정 대상이 사라지는 것을 막는다) */
+	void Consume(uint64 InValue) { Sink = Sink + InValue; }
+
+	template<typename BodyType>
+	void Run(const FString& InName, uint64 InNumItems, BodyType&& InBody)
+	{
+		RunWithSetup(InName, InNumItems, [] {}, std::forward<BodyType>(InBody));
+	}
+
+	template<typename SetupType, typename BodyType>
+	void RunWithSetup(const FString& InName, uint64 InNumItems, SetupType&& InSetup, BodyType&& InBody)
+	{
+		if (!ShouldRun(InName))
+		{
+			return;
+		}
+
+		InSetup();
+		InBody();
+
+		TArray<double> Samples;
+		double TotalMs = 0.0;
+		uint64 TotalAllocations = 0;
+		while (Samples.size() < Options.MaxIterations &&
+			(Samples.size() < Options.MinIterations || TotalMs < Options.MinTimeMs))
+		{
+			InSetup();
+			const uint64 StartAllocations = TotalAllocationCalls.load(std::memory_order_relaxed);
+			const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+			InBody();
+			const double Ms = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+			TotalAllocations += TotalAllocationCalls.load(std::memory_order_relaxed) - StartAllocations;
+
+			Samples.push_back(Ms);
+			TotalMs += Ms;
+		}
+
+		AddResult(InName, InNumItems, Samples, TotalAllocations);
+	}
+
+private:
+	void AddResult(const FString& InName, uint64 InNumItems, TArray<double>& InSamples, uint64 InTotalAllocations);
+
+	const FBenchmarkOptions& Options;
+	FString Suite;
+	TArray<FBenchmarkResult>& Results;
+	volatile uint64 Sink = 0;
+};
+
+/** Data/ 아래의 실제 메시 데이터셋 (확장자 없이 두고 .obj/.objbin을 붙여 쓴다) */
+inline const TArray<FString>& GetBenchmarkMeshNames()
+{
+	static const TArray<FString> MeshNames = {
+		"Cube/Cube", "JungleApples/apple_mid", "grenade/grenade", "hamburger/hamburger", "fruits/fruits"
+	};
+	return MeshNames;
+}
+
+using FBenchmarkSuiteFunction = void(*)(FBenchmarkContext&);
+
+/**
+ * @brief 등록된 스위트를 차례로 실행하고 결과를 표/JSON으로 내보낸다
+ * 기준 JSON이 주어지면 항목별 중앙값을 비교해 회귀를 표시한다
+ */
+class FBenchmarkRunner
+{
+public:
+	void AddSuite(const FString& InName, FBenchmarkSuiteFunction InFunction);
+
+	/** @return 기준 대비 회귀가 있으면 1, 아니면 0 */
+	int32 Run(const FBenchmarkOptions& InOptions);
+
+	// 기준보다 이 비율 이상 느려지면 회귀로 본다
+	static constexpr double REGRESSION_THRESHOLD = 1.10;
+
+private:
+	void PrintResults() const;
+	bool WriteJson(const FString& InPath) const;
+	bool CompareWithBaseline(const FString& InPath) const;
+
+	TArray<TPair<FString, FBenchmarkSuiteFunction>> Suites;
+	FBenchmarkOptions Options;
+	TArray<FBenchmarkResult> Results;
+};
+
+// 스위트 진입점 (Benchmark/Private/*Benchmarks.cpp)
+void RunSpatialBenchmarks(FBenchmarkContext& InContext);
+void RunAssetBenchmarks(FBenchmarkContext& InContext);
+void RunCoreBenchmarks(FBenchmarkContext& InContext);
+void RunRenderBenchmarks(FBenchmarkContext& InContext);
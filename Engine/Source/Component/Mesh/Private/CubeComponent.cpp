@@ -13,7 +13,7 @@ UCubeComponent::UCubeComponent()
 	SetName("CubeComponent");
 	Type = EPrimitiveType::Cube;
 
-	Vertices = ResourceManager.GetVertexData(Type);
+	Positions = ResourceManager.GetPositionData(Type);
 	VertexBuffer = ResourceManager.GetVertexbuffer(Type);
 	NumVertices = ResourceManager.GetNumVertices(Type);
 
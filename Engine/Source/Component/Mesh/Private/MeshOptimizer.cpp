@@ -0,0 +1,470 @@
+#include "pch.h"
+#include "Component/Mesh/Public/MeshOptimizer.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+
+namespace
+{
+	constexpr uint32 INVALID_VERTEX = UINT32_MAX;
+
+	/**
+	 * @brief 타임스탬프로 흉내 내는 FIFO 캐시 (적중해도 순서가 바뀌지 않는다)
+	 * 마지막 CacheSize번의 삽입 안에 들어온 정점만 캐시에 있다
+	 */
+	struct FFifoCache
+	{
+		TArray<uint32> Timestamps;
+		uint32 CacheSize;
+		uint32 Time;
+
+		FFifoCache(size_t InVertexCount, uint32 InCacheSize)
+			: Timestamps(InVertexCount, 0), CacheSize(InCacheSize), Time(InCacheSize + 1)
+		{
+		}
+
+		/** @return 캐시에 없어 새로 변환했으면 true */
+		bool Access(uint32 InVertex)
+		{
+			if (Time - Timestamps[InVertex] > CacheSize)
+			{
+				Timestamps[InVertex] = Time++;
+				return true;
+			}
+			return false;
+		}
+
+		void Flush() { Time += CacheSize + 1; }
+	};
+
+	/** @brief 정점 -> 그 정점을 쓰는 삼각형 목록 (CSR) */
+	struct FVertexAdjacency
+	{
+		TArray<uint32> Offsets;
+		TArray<uint32> Triangles;
+
+		void Build(const uint32* InIndices, size_t InIndexCount, size_t InVertexCount, TArray<uint32>& OutLiveCounts)
+		{
+			OutLiveCounts.assign(InVertexCount, 0);
+			for (size_t i = 0; i < InIndexCount; ++i)
+			{
+				++OutLiveCounts[InIndices[i]];
+			}
+
+			Offsets.assign(InVertexCount + 1, 0);
+			for (size_t v = 0; v < InVertexCount; ++v)
+			{
+				Offsets[v + 1] = Offsets[v] + OutLiveCounts[v];
+			}
+
+			TArray<uint32> Cursors(Offsets.begin(), Offsets.end() - 1);
+			Triangles.resize(InIndexCount);
+			for (size_t i = 0; i < InIndexCount; ++i)
+			{
+				Triangles[Cursors[InIndices[i]]++] = static_cast<uint32>(i / 3);
+			}
+		}
+	};
+
+	/**
+	 * @brief 주변 후보로 이어 갈 수 없을 때 다음 부채꼴 중심을 고른다
+	 * 최근에 내보낸 정점(dead-end 스택)을 먼저 보고, 없으면 입력 순서로 남은 정점을 찾는다
+	 */
+	uint32 SkipDeadEnd(TArray<uint32>& InOutDeadEnd, size_t& InOutCursor, const TArray<uint32>& InLiveCounts)
+	{
+		while (!InOutDeadEnd.empty())
+		{
+			const uint32 Vertex = InOutDeadEnd.back();
+			InOutDeadEnd.pop_back();
+			if (InLiveCounts[Vertex] > 0)
+			{
+				return Vertex;
+			}
+		}
+
+		for (; InOutCursor < InLiveCounts.size(); ++InOutCursor)
+		{
+			if (InLiveCounts[InOutCursor] > 0)
+			{
+				return static_cast<uint32>(InOutCursor);
+			}
+		}
+		return INVALID_VERTEX;
+	}
+
+	FVector GetPosition(const FMeshPosition* InPositions, uint32 InVertex)
+	{
+		return InPositions[InVertex].ToVector();
+	}
+
+	/** @brief 섹션이 없는 메시(재질 없는 OBJ)는 인덱스 전체를 섹션 하나로 본다 */
+	TArray<FMeshSection> GetIndexRanges(const FStaticMesh& InMesh)
+	{
+		if (!InMesh.Sections.empty())
+		{
+			return InMesh.Sections;
+		}
+		return { FMeshSection{ 0, static_cast<uint32>(InMesh.Indices.size()), 0 } };
+	}
+}
+
+void FMeshOptimizer::OptimizeStaticMesh(FStaticMesh& InOutMesh)
+{
+	const size_t VertexCount = InOutMesh.Positions.size();
+	if (VertexCount == 0 || InOutMesh.Indices.empty() || InOutMesh.Attributes.size() != VertexCount)
+	{
+		return;
+	}
+
+	// 섹션이 쓰는 정점만 지역 번호로 모아 작업 배열을 섹션 크기로 유지한다
+	TArray<uint32> GlobalToLocal(VertexCount, INVALID_VERTEX);
+	TArray<uint32> LocalToGlobal;
+	TArray<uint32> LocalIndices;
+	TArray<FMeshPosition> LocalPositions;
+	TArray<uint32> Clusters;
+
+	for (const FMeshSection& Section : GetIndexRanges(InOutMesh))
+	{
+		if (Section.IndexCount < 6 || Section.IndexCount % 3 != 0 ||
+			static_cast<size_t>(Section.StartIndex) + Section.IndexCount > InOutMesh.Indices.size())
+		{
+			continue;
+		}
+
+		uint32* SectionIndices = InOutMesh.Indices.data() + Section.StartIndex;
+		LocalToGlobal.clear();
+		LocalIndices.resize(Section.IndexCount);
+		for (uint32 i = 0; i < Section.IndexCount; ++i)
+		{
+			uint32& Local = GlobalToLocal[SectionIndices[i]];
+			if (Local == INVALID_VERTEX)
+			{
+				Local = static_cast<uint32>(LocalToGlobal.size());
+				LocalToGlobal.push_back(SectionIndices[i]);
+			}
+			LocalIndices[i] = Local;
+		}
+
+		LocalPositions.resize(LocalToGlobal.size());
+		for (size_t Local = 0; Local < LocalToGlobal.size(); ++Local)
+		{
+			LocalPositions[Local] = InOutMesh.Positions[LocalToGlobal[Local]];
+		}
+
+		OptimizeVertexCache(LocalIndices.data(), LocalIndices.size(), LocalToGlobal.size(), VERTEX_CACHE_SIZE, &Clusters);
+		OptimizeOverdraw(LocalIndices.data(), LocalIndices.size(), LocalPositions.data(), LocalPositions.size(), Clusters);
+
+		for (uint32 i = 0; i < Section.IndexCount; ++i)
+		{
+			SectionIndices[i] = LocalToGlobal[LocalIndices[i]];
+		}
+		for (const uint32 Global : LocalToGlobal)
+		{
+			GlobalToLocal[Global] = INVALID_VERTEX;
+		}
+	}
+
+	// 섹션 순서대로 처음 쓰이는 정점부터 배치한다
+	const TArray<uint32> NewToOld = OptimizeVertexFetch(InOutMesh.Indices.data(), InOutMesh.Indices.size(), VertexCount);
+
+	TArray<FMeshPosition> Positions(NewToOld.size());
+	TArray<FMeshAttribute> Attributes(NewToOld.size());
+	for (size_t New = 0; New < NewToOld.size(); ++New)
+	{
+		Positions[New] = InOutMesh.Positions[NewToOld[New]];
+		Attributes[New] = InOutMesh.Attributes[NewToOld[New]];
+	}
+	InOutMesh.Positions = std::move(Positions);
+	InOutMesh.Attributes = std::move(Attributes);
+}
+
+/**
+ * @brief Tipsify: 부채꼴 중심 정점의 남은 삼각형을 모두 내보내고, 캐시에 아직 남아 있을 이웃 중 가장 오래된 정점으로 옮겨 간다
+ * 삼각형 수에 선형이고, 캐시 크기만 알면 된다
+ */
+void FMeshOptimizer::OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount,
+	uint32 InCacheSize, TArray<uint32>* OutClusters)
+{
+	if (OutClusters)
+	{
+		OutClusters->clear();
+	}
+
+	const size_t NumTriangles = InIndexCount / 3;
+	if (NumTriangles == 0 || InVertexCount == 0)
+	{
+		return;
+	}
+
+	TArray<uint32> LiveCounts;
+	FVertexAdjacency Adjacency;
+	Adjacency.Build(InOutIndices, NumTriangles * 3, InVertexCount, LiveCounts);
+
+	TArray<uint32> CacheTimestamps(InVertexCount, 0);
+	uint32 Time = InCacheSize + 1;
+
+	TArray<uint8> EmittedTriangles(NumTriangles, 0);
+	TArray<uint32> DeadEnd;
+	DeadEnd.reserve(NumTriangles * 3);
+	TArray<uint32> Candidates;
+	TArray<uint32> Output;
+	Output.reserve(NumTriangles * 3);
+
+	size_t Cursor = 0;
+	uint32 FanVertex = SkipDeadEnd(DeadEnd, Cursor, LiveCounts);
+	if (OutClusters)
+	{
+		OutClusters->push_back(0);
+	}
+
+	while (FanVertex != INVALID_VERTEX)
+	{
+		Candidates.clear();
+		for (uint32 i = Adjacency.Offsets[FanVertex]; i < Adjacency.Offsets[FanVertex + 1]; ++i)
+		{
+			const uint32 Triangle = Adjacency.Triangles[i];
+			if (EmittedTriangles[Triangle])
+			{
+				continue;
+			}
+
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				const uint32 Vertex = InOutIndices[Triangle * 3 + k];
+				Output.push_back(Vertex);
+				DeadEnd.push_back(Vertex);
+				Candidates.push_back(Vertex);
+				--LiveCounts[Vertex];
+				if (Time - CacheTimestamps[Vertex] > InCacheSize)
+				{
+					CacheTimestamps[Vertex] = Time++;
+				}
+			}
+			EmittedTriangles[Triangle] = 1;
+		}
+
+		// 남은 삼각형을 다 내보내도 캐시에 남아 있을 후보 중 가장 먼저 들어온 정점
+		uint32 NextVertex = INVALID_VERTEX;
+		int64 BestPriority = -1;
+		for (const uint32 Vertex : Candidates)
+		{
+			if (LiveCounts[Vertex] == 0)
+			{
+				continue;
+			}
+
+			int64 Priority = 0;
+			if (Time - CacheTimestamps[Vertex] + 2 * LiveCounts[Vertex] <= InCacheSize)
+			{
+				Priority = Time - CacheTimestamps[Vertex];
+			}
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				NextVertex = Vertex;
+			}
+		}
+
+		if (NextVertex == INVALID_VERTEX)
+		{
+			NextVertex = SkipDeadEnd(DeadEnd, Cursor, LiveCounts);
+
+			const uint32 ClusterStart = static_cast<uint32>(Output.size() / 3);
+			if (OutClusters && NextVertex != INVALID_VERTEX && ClusterStart > OutClusters->back())
+			{
+				OutClusters->push_back(ClusterStart);
+			}
+		}
+		FanVertex = NextVertex;
+	}
+
+	assert("Tipsify must emit every triangle" && Output.size() == NumTriangles * 3);
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+/**
+ * @brief 캐시 순서의 클러스터를 메시 중심에서 바깥을 향하는 정도로 정렬한다 (선형 시간, 시점 무관)
+ * 바깥을 향한 면이 먼저 그려지면 어느 방향에서 봐도 가려질 면이 깊이 테스트에서 먼저 떨어지는 경우가 많다
+ */
+void FMeshOptimizer::OptimizeOverdraw(uint32* InOutIndices, size_t InIndexCount, const FMeshPosition* InPositions, size_t InVertexCount,
+	const TArray<uint32>& InClusters, uint32 InCacheSize, float InThreshold)
+{
+	const size_t NumTriangles = InIndexCount / 3;
+	if (NumTriangles < 2 || InClusters.empty() || InVertexCount == 0)
+	{
+		return;
+	}
+
+	/** #1. 큰 클러스터는 ACMR이 기준 * InThreshold 이하가 되는 지점마다 더 나눈다 (잘린 곳에서 캐시를 비운다고 본다) */
+	TArray<uint32> Clusters;
+	FFifoCache Cache(InVertexCount, InCacheSize);
+	for (size_t ClusterIndex = 0; ClusterIndex < InClusters.size(); ++ClusterIndex)
+	{
+		const uint32 Begin = InClusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < InClusters.size() ? InClusters[ClusterIndex + 1] : static_cast<uint32>(NumTriangles);
+
+		Cache.Flush();
+		uint32 ClusterMisses = 0;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				ClusterMisses += Cache.Access(InOutIndices[Triangle * 3 + k]) ? 1 : 0;
+			}
+		}
+		const float TargetACMR = static_cast<float>(ClusterMisses) / (End - Begin) * InThreshold;
+
+		Cache.Flush();
+		Clusters.push_back(Begin);
+		uint32 Misses = 0;
+		uint32 Count = 0;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			for (uint32 k = 0; k < 3; ++k)
+			{
+				Misses += Cache.Access(InOutIndices[Triangle * 3 + k]) ? 1 : 0;
+			}
+			++Count;
+
+			if (Triangle + 1 < End && static_cast<float>(Misses) <= TargetACMR * Count)
+			{
+				Clusters.push_back(Triangle + 1);
+				Cache.Flush();
+				Misses = 0;
+				Count = 0;
+			}
+		}
+	}
+
+	if (Clusters.size() < 2)
+	{
+		return;
+	}
+
+	/** #2. 메시 중심과 감김 방향, 부호 부피가 음수면 면 법선이 안쪽을 향하는 감김이다 */
+	FVector MeshCentroid = FVector::ZeroVector();
+	float MeshArea = 0.0f;
+	for (size_t Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		const FVector A = GetPosition(InPositions, InOutIndices[Triangle * 3 + 0]);
+		const FVector B = GetPosition(InPositions, InOutIndices[Triangle * 3 + 1]);
+		const FVector C = GetPosition(InPositions, InOutIndices[Triangle * 3 + 2]);
+		const float Area = (B - A).Cross(C - A).Length();
+		MeshCentroid += (A + B + C) * (Area / 3.0f);
+		MeshArea += Area;
+	}
+	if (MeshArea <= 0.0f)
+	{
+		return;
+	}
+	MeshCentroid /= MeshArea;
+
+	double SignedVolume = 0.0;
+	for (size_t Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		const FVector A = GetPosition(InPositions, InOutIndices[Triangle * 3 + 0]) - MeshCentroid;
+		const FVector B = GetPosition(InPositions, InOutIndices[Triangle * 3 + 1]) - MeshCentroid;
+		const FVector C = GetPosition(InPositions, InOutIndices[Triangle * 3 + 2]) - MeshCentroid;
+		SignedVolume += A.Dot(B.Cross(C));
+	}
+	const float OutwardSign = SignedVolume < 0.0 ? -1.0f : 1.0f;
+
+	/** #3. 클러스터마다 (면적 가중 중심 - 메시 중심) . 평균 법선, 큰 것부터 그린다 */
+	const size_t NumClusters = Clusters.size();
+	TArray<float> SortKeys(NumClusters, 0.0f);
+	for (size_t ClusterIndex = 0; ClusterIndex < NumClusters; ++ClusterIndex)
+	{
+		const uint32 Begin = Clusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < NumClusters ? Clusters[ClusterIndex + 1] : static_cast<uint32>(NumTriangles);
+
+		FVector Centroid = FVector::ZeroVector();
+		FVector Normal = FVector::ZeroVector();
+		float Area = 0.0f;
+		for (uint32 Triangle = Begin; Triangle < End; ++Triangle)
+		{
+			const FVector A = GetPosition(InPositions, InOutIndices[Triangle * 3 + 0]);
+			const FVector B = GetPosition(InPositions, InOutIndices[Triangle * 3 + 1]);
+			const FVector C = GetPosition(InPositions, InOutIndices[Triangle * 3 + 2]);
+			const FVector AreaNormal = (B - A).Cross(C - A);
+			const float TriangleArea = AreaNormal.Length();
+			Centroid += (A + B + C) * (TriangleArea / 3.0f);
+			Normal += AreaNormal;
+			Area += TriangleArea;
+		}
+
+		const float NormalLength = Normal.Length();
+		if (Area > 0.0f && NormalLength > 0.0f)
+		{
+			SortKeys[ClusterIndex] = (Centroid / Area - MeshCentroid).Dot(Normal / NormalLength) * OutwardSign;
+		}
+	}
+
+	TArray<uint32> Order(NumClusters);
+	for (uint32 i = 0; i < NumClusters; ++i)
+	{
+		Order[i] = i;
+	}
+	std::stable_sort(Order.begin(), Order.end(), [&SortKeys](uint32 InA, uint32 InB)
+	{
+		return SortKeys[InA] > SortKeys[InB];
+	});
+
+	TArray<uint32> Output;
+	Output.reserve(NumTriangles * 3);
+	for (const uint32 ClusterIndex : Order)
+	{
+		const uint32 Begin = Clusters[ClusterIndex];
+		const uint32 End = ClusterIndex + 1 < NumClusters ? Clusters[ClusterIndex + 1] : static_cast<uint32>(NumTriangles);
+		Output.insert(Output.end(), InOutIndices + Begin * 3, InOutIndices + End * 3);
+	}
+	std::copy(Output.begin(), Output.end(), InOutIndices);
+}
+
+TArray<uint32> FMeshOptimizer::OptimizeVertexFetch(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount)
+{
+	TArray<uint32> OldToNew(InVertexCount, INVALID_VERTEX);
+	TArray<uint32> NewToOld;
+	NewToOld.reserve(InVertexCount);
+
+	for (size_t i = 0; i < InIndexCount; ++i)
+	{
+		uint32& NewIndex = OldToNew[InOutIndices[i]];
+		if (NewIndex == INVALID_VERTEX)
+		{
+			NewIndex = static_cast<uint32>(NewToOld.size());
+			NewToOld.push_back(InOutIndices[i]);
+		}
+		InOutIndices[i] = NewIndex;
+	}
+	return NewToOld;
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeVertexCache(const uint32* InIndices, size_t InIndexCount, size_t InVertexCount, uint32 InCacheSize)
+{
+	FVertexCacheStats Stats;
+	Stats.NumTriangles = static_cast<uint32>(InIndexCount / 3);
+
+	FFifoCache Cache(InVertexCount, InCacheSize);
+	TArray<uint8> bReferenced(InVertexCount, 0);
+	for (size_t i = 0; i < Stats.NumTriangles * 3; ++i)
+	{
+		const uint32 Vertex = InIndices[i];
+		Stats.NumTransformed += Cache.Access(Vertex) ? 1 : 0;
+		Stats.NumVertices += bReferenced[Vertex] ? 0 : 1;
+		bReferenced[Vertex] = 1;
+	}
+	return Stats;
+}
+
+FVertexCacheStats FMeshOptimizer::AnalyzeStaticMesh(const FStaticMesh& InMesh, uint32 InCacheSize)
+{
+	FVertexCacheStats Stats;
+	for (const FMeshSection& Section : GetIndexRanges(InMesh))
+	{
+		if (static_cast<size_t>(Section.StartIndex) + Section.IndexCount > InMesh.Indices.size())
+		{
+			continue;
+		}
+		Stats += AnalyzeVertexCache(InMesh.Indices.data() + Section.StartIndex, Section.IndexCount, InMesh.Positions.size(), InCacheSize);
+	}
+	return Stats;
+}
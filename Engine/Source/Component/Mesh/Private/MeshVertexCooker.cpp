@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "Component/Mesh/Public/MeshVertexCooker.h"
+
+namespace
+{
+	constexpr float SNORM16_SCALE = 32767.0f;
+
+	float SignNotZero(float InValue)
+	{
+		return InValue >= 0.0f ? 1.0f : -1.0f;
+	}
+
+	int16 ToSnorm16(float InValue)
+	{
+		const float Clamped = std::clamp(InValue, -1.0f, 1.0f);
+		return static_cast<int16>(std::lround(Clamped * SNORM16_SCALE));
+	}
+}
+
+FMeshAttribute FMeshVertexCooker::MakeAttribute(const FVector& InNormal, const FVector2& InTexCoord)
+{
+	FMeshAttribute Attribute;
+	EncodeOctNormal(InNormal, Attribute.Normal);
+	Attribute.TexCoord[0] = FloatToHalf(InTexCoord.X);
+	Attribute.TexCoord[1] = FloatToHalf(InTexCoord.Y);
+	return Attribute;
+}
+
+void FMeshVertexCooker::CookVertices(const TArray<FNormalVertex>& InVertices, TArray<FMeshPosition>& OutPositions, TArray<FMeshAttribute>& OutAttributes)
+{
+	CookPositions(InVertices, OutPositions);
+
+	OutAttributes.clear();
+	OutAttributes.reserve(InVertices.size());
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		OutAttributes.push_back(MakeAttribute(Vertex.Normal, Vertex.TexCoord));
+	}
+}
+
+void FMeshVertexCooker::CookPositions(const TArray<FNormalVertex>& InVertices, TArray<FMeshPosition>& OutPositions)
+{
+	OutPositions.clear();
+	OutPositions.reserve(InVertices.size());
+	for (const FNormalVertex& Vertex : InVertices)
+	{
+		OutPositions.emplace_back(Vertex.Position);
+	}
+}
+
+FMeshVertexSizeReport FMeshVertexCooker::MakeSizeReport(uint32 InNumVertices)
+{
+	FMeshVertexSizeReport Report;
+	Report.NumVertices = InNumVertices;
+	Report.SourceBytes = static_cast<uint64>(InNumVertices) * sizeof(FNormalVertex);
+	Report.PositionBytes = static_cast<uint64>(InNumVertices) * sizeof(FMeshPosition);
+	Report.AttributeBytes = static_cast<uint64>(InNumVertices) * sizeof(FMeshAttribute);
+	return Report;
+}
+
+/**
+ * @brief 단위 노멀을 팔면체에 투영한 뒤, 아래쪽 반구(Z < 0)는 바깥 삼각형으로 접어 2D 정사각형에 담는다
+ * 디코딩은 TextureShader.hlsl의 DecodeOctNormal과 같은 규칙을 따른다
+ */
+void FMeshVertexCooker::EncodeOctNormal(const FVector& InNormal, int16 OutEncoded[2])
+{
+	const float L1Norm = std::abs(InNormal.X) + std::abs(InNormal.Y) + std::abs(InNormal.Z);
+	if (L1Norm <= 1e-8f)
+	{
+		OutEncoded[0] = 0;
+		OutEncoded[1] = 0;
+		return;
+	}
+
+	float X = InNormal.X / L1Norm;
+	float Y = InNormal.Y / L1Norm;
+	if (InNormal.Z < 0.0f)
+	{
+		const float FoldedX = (1.0f - std::abs(Y)) * SignNotZero(X);
+		const float FoldedY = (1.0f - std::abs(X)) * SignNotZero(Y);
+		X = FoldedX;
+		Y = FoldedY;
+	}
+
+	OutEncoded[0] = ToSnorm16(X);
+	OutEncoded[1] = ToSnorm16(Y);
+}
+
+FVector FMeshVertexCooker::DecodeOctNormal(const int16 InEncoded[2])
+{
+	const float EncodedX = std::max(static_cast<float>(InEncoded[0]) / SNORM16_SCALE, -1.0f);
+	const float EncodedY = std::max(static_cast<float>(InEncoded[1]) / SNORM16_SCALE, -1.0f);
+
+	FVector Normal(EncodedX, EncodedY, 1.0f - std::abs(EncodedX) - std::abs(EncodedY));
+	const float Fold = std::max(-Normal.Z, 0.0f);
+	Normal.X += Normal.X >= 0.0f ? -Fold : Fold;
+	Normal.Y += Normal.Y >= 0.0f ? -Fold : Fold;
+
+	const float Length = std::sqrt(Normal.X * Normal.X + Normal.Y * Normal.Y + Normal.Z * Normal.Z);
+	return FVector(Normal.X / Length, Normal.Y / Length, Normal.Z / Length);
+}
+
+/**
+ * @brief IEEE 754 binary32 -> binary16 (Round to nearest even)
+ * 범위를 넘는 값은 Inf, 너무 작은 값은 Subnormal 또는 0이 된다
+ */
+uint16 FMeshVertexCooker::FloatToHalf(float InValue)
+{
+	uint32 Bits;
+	std::memcpy(&Bits, &InValue, sizeof(Bits));
+
+	const uint32 Sign = (Bits >> 16) & 0x8000u;
+	const uint32 FloatExponent = (Bits >> 23) & 0xFFu;
+	uint32 Mantissa = Bits & 0x7FFFFFu;
+
+	// Inf / NaN
+	if (FloatExponent == 0xFFu)
+	{
+		return static_cast<uint16>(Sign | 0x7C00u | (Mantissa ? 0x200u : 0u));
+	}
+
+	const int32 Exponent = static_cast<int32>(FloatExponent) - 127 + 15;
+	if (Exponent >= 31)
+	{
+		return static_cast<uint16>(Sign | 0x7C00u);
+	}
+
+	// Subnormal: 숨은 1 비트를 붙여 직접 시프트한다
+	if (Exponent <= 0)
+	{
+		if (Exponent < -10)
+		{
+			return static_cast<uint16>(Sign);
+		}
+
+		Mantissa |= 0x800000u;
+		const uint32 Shift = static_cast<uint32>(14 - Exponent);
+		uint32 Half = Mantissa >> Shift;
+		const uint32 Remainder = Mantissa & ((1u << Shift) - 1u);
+		const uint32 HalfWay = 1u << (Shift - 1u);
+		if (Remainder > HalfWay || (Remainder == HalfWay && (Half & 1u)))
+		{
+			++Half;
+		}
+		return static_cast<uint16>(Sign | Half);
+	}
+
+	// 반올림 올림이 지수로 넘어가도 올바른 다음 값(또는 Inf)이 된다
+	uint32 Half = (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+	const uint32 Remainder = Mantissa & 0x1FFFu;
+	if (Remainder > 0x1000u || (Remainder == 0x1000u && (Half & 1u)))
+	{
+		++Half;
+	}
+	return static_cast<uint16>(Sign | Half);
+}
+
+float FMeshVertexCooker::HalfToFloat(uint16 InHalf)
+{
+	const uint32 Sign = (static_cast<uint32>(InHalf) & 0x8000u) << 16;
+	const uint32 Exponent = (InHalf >> 10) & 0x1Fu;
+	const uint32 Mantissa = InHalf & 0x3FFu;
+
+	if (Exponent == 0)
+	{
+		const float Value = static_cast<float>(Mantissa) * (1.0f / 16777216.0f);
+		return Sign ? -Value : Value;
+	}
+
+	uint32 Bits;
+	if (Exponent == 0x1Fu)
+	{
+		Bits = Sign | 0x7F800000u | (Mantissa << 13);
+	}
+	else
+	{
+		Bits = Sign | ((Exponent + 112u) << 23) | (Mantissa << 13);
+	}
+
+	float Value;
+	std::memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
@@ -12,7 +12,7 @@ USphereComponent::USphereComponent()
 	UAssetManager& ResourceManager = UAssetManager::GetInstance();
 	SetName("SphereComponent");
 	Type = EPrimitiveType::Sphere;
-	Vertices = ResourceManager.GetVertexData(Type);
+	Positions = ResourceManager.GetPositionData(Type);
 	VertexBuffer = ResourceManager.GetVertexbuffer(Type);
 	NumVertices = ResourceManager.GetNumVertices(Type);
 	RenderState.CullMode = ECullMode::Back;
@@ -11,7 +11,7 @@ USquareComponent::USquareComponent()
 	UAssetManager& ResourceManager = UAssetManager::GetInstance();
 	SetName("SquareComponent");
 	Type = EPrimitiveType::Square;
-	Vertices = ResourceManager.GetVertexData(Type);
+	Positions = ResourceManager.GetPositionData(Type);
 	VertexBuffer = ResourceManager.GetVertexbuffer(Type);
 	NumVertices = ResourceManager.GetNumVertices(Type);
 	RenderState.CullMode = ECullMode::None;
@@ -31,14 +31,7 @@ void UStaticMesh::SetStaticMeshAsset(FStaticMesh* InStaticMeshAsset)
 {
 	StaticMeshAsset = InStaticMeshAsset;
 
-	if (StaticMeshAsset)
-	{
-		StaticMeshAsset->bTriangleBVHDirty = true;
-		StaticMeshAsset->TriangleBVHNodes.clear();
-		StaticMeshAsset->TriangleBVHPrimitives.clear();
-		StaticMeshAsset->TriangleBVHRoot = -1;
-	}
-
+	// 애셋 로더가 작업 스레드에서 이미 만든 BVH는 그대로 쓴다
 	EnsureTriangleBVH();
 }
 
@@ -55,24 +48,24 @@ const FName& UStaticMesh::GetAssetPathFileName() const
 	return EmptyString;
 }
 
-const TArray<FNormalVertex>& UStaticMesh::GetVertices() const
+const TArray<FMeshPosition>& UStaticMesh::GetPositions() const
 {
 	if (StaticMeshAsset)
 	{
-		return StaticMeshAsset->Vertices;
+		return StaticMeshAsset->Positions;
 	}
-	static const TArray<FNormalVertex> EmptyVertices;
-	return EmptyVertices;
+	static const TArray<FMeshPosition> EmptyPositions;
+	return EmptyPositions;
 }
 
-TArray<FNormalVertex>& UStaticMesh::GetVertices()
+const TArray<FMeshAttribute>& UStaticMesh::GetAttributes() const
 {
 	if (StaticMeshAsset)
 	{
-		return StaticMeshAsset->Vertices;
+		return StaticMeshAsset->Attributes;
 	}
-	static TArray<FNormalVertex> EmptyVertices;
-	return EmptyVertices;
+	static const TArray<FMeshAttribute> EmptyAttributes;
+	return EmptyAttributes;
 }
 
 const TArray<uint32>& UStaticMesh::GetIndices() const
@@ -118,53 +111,39 @@ const TArray<FMeshSection>& UStaticMesh::GetSections() const
 	return EmptySections;
 }
 
-inline float SurfaceArea(const FAABB& b)
-{
-    const FVector d = b.Max - b.Min;
-    // Guard: negative/degenerate boxes
-    if (d.X <= 0.f || d.Y <= 0.f || d.Z <= 0.f) return 0.f;
-    return 2.0f * (d.X*d.Y + d.Y*d.Z + d.Z*d.X);
-}
-
-inline void ExpandToFit(FAABB& dst, const FAABB& src)
-{
-    dst.Min.X = std::min(dst.Min.X, src.Min.X);
-    dst.Min.Y = std::min(dst.Min.Y, src.Min.Y);
-    dst.Min.Z = std::min(dst.Min.Z, src.Min.Z);
-    dst.Max.X = std::max(dst.Max.X, src.Max.X);
-    dst.Max.Y = std::max(dst.Max.Y, src.Max.Y);
-    dst.Max.Z = std::max(dst.Max.Z, src.Max.Z);
-}
-
-inline void ExpandToFitPoint(FAABB& dst, const FVector& p)
-{
-    dst.Min.X = std::min(dst.Min.X, p.X);
-    dst.Min.Y = std::min(dst.Min.Y, p.Y);
-    dst.Min.Z = std::min(dst.Min.Z, p.Z);
-    dst.Max.X = std::max(dst.Max.X, p.X);
-    dst.Max.Y = std::max(dst.Max.Y, p.Y);
-    dst.Max.Z = std::max(dst.Max.Z, p.Z);
-}
-
 // Safe division
 inline float SafeRcp(float x) { return (fabsf(x) > 1e-20f) ? (1.0f / x) : 0.0f; }
 
 template<int NBINS>
 struct FBin
 {
-    FAABB b;   // bounds of all prims in this bin
-    int   n;   // count
+    FBox b;    // bounds of all prims in this bin
+    int  n;    // count
     FBin()
-    : b(FAABB(FVector(FLT_MAX,FLT_MAX,FLT_MAX), FVector(-FLT_MAX,-FLT_MAX,-FLT_MAX)))
+    : b(FBox::Empty())
     , n(0) {}
 };
 
 void UStaticMesh::EnsureTriangleBVH() const
 {
-	if (!StaticMeshAsset)
+	if (StaticMeshAsset)
 	{
-		return;
+		BuildTriangleBVH(*StaticMeshAsset);
 	}
+}
+
+void UStaticMesh::RebuildTriangleBVH(FStaticMesh& InStaticMeshAsset)
+{
+	InStaticMeshAsset.bTriangleBVHDirty = true;
+	InStaticMeshAsset.TriangleBVHRoot = -1;
+	InStaticMeshAsset.TriangleBVHNodes.clear();
+	InStaticMeshAsset.TriangleBVHPrimitives.clear();
+	BuildTriangleBVH(InStaticMeshAsset);
+}
+
+void UStaticMesh::BuildTriangleBVH(FStaticMesh& InStaticMeshAsset)
+{
+	FStaticMesh* StaticMeshAsset = &InStaticMeshAsset;
 
 	if (!StaticMeshAsset->bTriangleBVHDirty &&
 		StaticMeshAsset->TriangleBVHRoot >= 0 &&
@@ -177,11 +156,12 @@ void UStaticMesh::EnsureTriangleBVH() const
 	StaticMeshAsset->TriangleBVHPrimitives.clear();
 	StaticMeshAsset->TriangleBVHRoot = -1;
 
-	const TArray<FNormalVertex>& Vertices = StaticMeshAsset->Vertices;
+	// 위치 스트림만 읽는다
+	const TArray<FMeshPosition>& Positions = StaticMeshAsset->Positions;
 	const TArray<uint32>& Indices = StaticMeshAsset->Indices;
 
 	const bool bHasIndices = !Indices.empty();
-	const size_t TriangleCount = bHasIndices ? (Indices.size() / 3) : (Vertices.size() / 3);
+	const size_t TriangleCount = bHasIndices ? (Indices.size() / 3) : (Positions.size() / 3);
 	if (TriangleCount == 0)
 	{
 		StaticMeshAsset->bTriangleBVHDirty = false;
@@ -192,19 +172,15 @@ void UStaticMesh::EnsureTriangleBVH() const
 
 	auto AddPrimitive = [&](uint32 i0, uint32 i1, uint32 i2)
 	{
-		const FVector& P0 = Vertices[i0].Position;
-		const FVector& P1 = Vertices[i1].Position;
-		const FVector& P2 = Vertices[i2].Position;
-
-		FVector minP( std::min({P0.X, P1.X, P2.X}),
-					  std::min({P0.Y, P1.Y, P2.Y}),
-					  std::min({P0.Z, P1.Z, P2.Z}) );
-		FVector maxP( std::max({P0.X, P1.X, P2.X}),
-					  std::max({P0.Y, P1.Y, P2.Y}),
-					  std::max({P0.Z, P1.Z, P2.Z}) );
+		const FVector P0 = Positions[i0].ToVector();
+		const FVector P1 = Positions[i1].ToVector();
+		const FVector P2 = Positions[i2].ToVector();
 
 		FTriangleBVHPrimitive prim;
-		prim.Bounds = FAABB(minP, maxP);
+		prim.Bounds = FBox::Empty();
+		prim.Bounds.ExpandPoint(P0);
+		prim.Bounds.ExpandPoint(P1);
+		prim.Bounds.ExpandPoint(P2);
 		prim.Center = (P0 + P1 + P2) / 3.0f;
 
 		prim.Indices[0] = i0;
@@ -227,7 +203,7 @@ void UStaticMesh::EnsureTriangleBVH() const
 	}
 	else
 	{
-		for (size_t i = 0; i + 2 < Vertices.size(); i += 3)
+		for (size_t i = 0; i + 2 < Positions.size(); i += 3)
 		{
 			AddPrimitive(static_cast<uint32>(i + 0), static_cast<uint32>(i + 1), static_cast<uint32>(i + 2));
 		}
@@ -248,18 +224,18 @@ void UStaticMesh::EnsureTriangleBVH() const
 	BuildBVH = [&](int32 Start, int32 Count) -> int32
 	{
 	    // 1) Compute node bounds and centroid bounds
-	    FAABB nodeBounds(FVector(FLT_MAX,FLT_MAX,FLT_MAX), FVector(-FLT_MAX,-FLT_MAX,-FLT_MAX));
-	    FAABB centroidBounds(FVector(FLT_MAX,FLT_MAX,FLT_MAX), FVector(-FLT_MAX,-FLT_MAX,-FLT_MAX));
+	    FBox nodeBounds = FBox::Empty();
+	    FBox centroidBounds = FBox::Empty();
 
 	    for (int32 i = 0; i < Count; ++i)
 	    {
 	        const FTriangleBVHPrimitive& p = StaticMeshAsset->TriangleBVHPrimitives[Start + i];
-	        ExpandToFit(nodeBounds, p.Bounds);
-	        ExpandToFitPoint(centroidBounds, p.Center);
+	        nodeBounds.Expand(p.Bounds);
+	        centroidBounds.ExpandPoint(p.Center);
 	    }
 
 	    // Leaf test (small or degenerate)
-	    const FVector cbSize = centroidBounds.Max - centroidBounds.Min;
+	    const FVector cbSize = centroidBounds.GetMax() - centroidBounds.GetMin();
 	    const bool degenerateAxis = (cbSize.X <= 1e-8f) && (cbSize.Y <= 1e-8f) && (cbSize.Z <= 1e-8f);
 	    const float leafCost = Ci * float(Count);
 	    if (Count <= MaxLeafSize || degenerateAxis)
@@ -283,7 +259,7 @@ void UStaticMesh::EnsureTriangleBVH() const
 
 	    // 3) Bin the primitives along 'axis'
 	    FBin<NBINS> bins[NBINS];
-	    const float cmin = (axis==0? centroidBounds.Min.X : (axis==1? centroidBounds.Min.Y : centroidBounds.Min.Z));
+	    const float cmin = centroidBounds.Min[axis];
 	    const float extent = (axis==0? cbSize.X : (axis==1? cbSize.Y : cbSize.Z));
 	    const float invExtent = SafeRcp(extent); // if zero, we would have leaf-ed above
 
@@ -300,21 +276,21 @@ void UStaticMesh::EnsureTriangleBVH() const
 	    {
 	        const FTriangleBVHPrimitive& p = StaticMeshAsset->TriangleBVHPrimitives[Start + i];
 	        const int bi = binIndexOf(p.Center);
-	        ExpandToFit(bins[bi].b, p.Bounds);
+	        bins[bi].b.Expand(p.Bounds);
 	        bins[bi].n++;
 	    }
 
 	    // 4) Prefix scan (left) and suffix scan (right) of bins to evaluate SAH cost per split
-	    FAABB leftB[NBINS], rightB[NBINS];
+	    FBox leftB[NBINS], rightB[NBINS];
 	    int   leftN[NBINS], rightN[NBINS];
 
 	    // Left-to-right
 	    {
-	        FAABB accB(FVector(FLT_MAX,FLT_MAX,FLT_MAX), FVector(-FLT_MAX,-FLT_MAX,-FLT_MAX));
+	        FBox accB = FBox::Empty();
 	        int accN = 0;
 	        for (int i = 0; i < NBINS; ++i)
 	        {
-	            if (bins[i].n > 0) ExpandToFit(accB, bins[i].b);
+	            if (bins[i].n > 0) accB.Expand(bins[i].b);
 	            accN += bins[i].n;
 	            leftB[i] = accB;
 	            leftN[i] = accN;
@@ -323,18 +299,18 @@ void UStaticMesh::EnsureTriangleBVH() const
 
 	    // Right-to-left
 	    {
-	        FAABB accB(FVector(FLT_MAX,FLT_MAX,FLT_MAX), FVector(-FLT_MAX,-FLT_MAX,-FLT_MAX));
+	        FBox accB = FBox::Empty();
 	        int accN = 0;
 	        for (int i = NBINS-1; i >= 0; --i)
 	        {
-	            if (bins[i].n > 0) ExpandToFit(accB, bins[i].b);
+	            if (bins[i].n > 0) accB.Expand(bins[i].b);
 	            accN += bins[i].n;
 	            rightB[i] = accB;
 	            rightN[i] = accN;
 	        }
 	    }
 
-	    const float invParentSA = SafeRcp(std::max(SurfaceArea(nodeBounds), 1e-20f));
+	    const float invParentSA = SafeRcp(std::max(nodeBounds.GetSurfaceArea(), 1e-20f));
 
 	    // Try splits between bins: split after bin s (left uses [0..s], right uses [s+1..NBINS-1])
 	    float bestCost = FLT_MAX;
@@ -348,8 +324,8 @@ void UStaticMesh::EnsureTriangleBVH() const
 
 	        const float sah =
 	            Ct +
-	            (SurfaceArea(leftB[s])  * invParentSA) * (Ci * float(nL)) +
-	            (SurfaceArea(rightB[s+1]) * invParentSA) * (Ci * float(nR));
+	            (leftB[s].GetSurfaceArea()  * invParentSA) * (Ci * float(nL)) +
+	            (rightB[s+1].GetSurfaceArea() * invParentSA) * (Ci * float(nR));
 
 	        if (sah < bestCost)
 	        {
@@ -444,13 +420,16 @@ bool UStaticMesh::RaycastTriangleBVH(const FRay& ModelRay, float& InOutDistance)
     bool  hit = false;
     float closest = InOutDistance;
 
+    // Inverse direction and sign masks are computed once per query
+    const FRayQuery Query(ModelRay);
+
     while (sp > 0)
     {
         const int32 ni = Stack[--sp];
         const FTriangleBVHNode& node = Nodes[ni];
 
         float tEntry;
-        if (!node.Bounds.RaycastHit(ModelRay, &tEntry) || tEntry > closest)
+        if (!node.Bounds.IntersectRay(Query, closest, tEntry))
             continue;
 
         if (node.bIsLeaf)
@@ -462,7 +441,7 @@ bool UStaticMesh::RaycastTriangleBVH(const FRay& ModelRay, float& InOutDistance)
 
                 // Optional: fast AABB pre-test against triangle bounds to skip obviously far triangles
                 float tTriBoxEntry;
-                if (!p.Bounds.RaycastHit(ModelRay, &tTriBoxEntry) || tTriBoxEntry > closest)
+                if (!p.Bounds.IntersectRay(Query, closest, tTriBoxEntry))
                     continue;
 
                 float t;
@@ -478,8 +457,8 @@ bool UStaticMesh::RaycastTriangleBVH(const FRay& ModelRay, float& InOutDistance)
         {
             // Compute near/far by AABB entry distance
             float tL = FLT_MAX, tR = FLT_MAX;
-            const bool hasL = (node.LeftChild  != -1) && Nodes[node.LeftChild ].Bounds.RaycastHit(ModelRay, &tL) && tL <= closest;
-            const bool hasR = (node.RightChild != -1) && Nodes[node.RightChild].Bounds.RaycastHit(ModelRay, &tR) && tR <= closest;
+            const bool hasL = (node.LeftChild  != -1) && Nodes[node.LeftChild ].Bounds.IntersectRay(Query, closest, tL);
+            const bool hasR = (node.RightChild != -1) && Nodes[node.RightChild].Bounds.IntersectRay(Query, closest, tR);
 
             if (hasL && hasR)
             {
@@ -98,26 +98,27 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 	}
 }
 
-UObject* UStaticMeshComponent::Duplicate(FObjectDuplicationParameters Parameters)
+void UStaticMeshComponent::CopyPropertiesFrom(const UObject* InSource)
 {
-	auto DupObject = static_cast<UStaticMeshComponent*>(Super::Duplicate(Parameters));
+	Super::CopyPropertiesFrom(InSource);
+
+	const UStaticMeshComponent* Source = static_cast<const UStaticMeshComponent*>(InSource);
 
 	/** @note 프로퍼티 얕은 복사(Shallow Copy) */
-	DupObject->StaticMesh = StaticMesh;
-	DupObject->OverrideMaterials = OverrideMaterials;
+	StaticMesh = Source->StaticMesh;
+	OverrideMaterials = Source->OverrideMaterials;
+	AttributeBuffer = Source->AttributeBuffer;
 
 	/** @note 프로퍼티 깊은 복사(Deep Copy) */
-	DupObject->CurrentLODLevel = CurrentLODLevel;
-	DupObject->bLODEnabled = bLODEnabled;
-	DupObject->LODDistanceSquared1 = LODDistanceSquared1;
-	DupObject->LODDistanceSquared2 = LODDistanceSquared2;
-	DupObject->MinLODLevel = MinLODLevel;
-	DupObject->ForcedLODLevel = ForcedLODLevel;
-	DupObject->OriginalMeshPath = OriginalMeshPath;
-	DupObject->bIsScrollEnabled = bIsScrollEnabled;
-	DupObject->ElapsedTime = ElapsedTime;
-
-	return DupObject;
+	CurrentLODLevel = Source->CurrentLODLevel;
+	bLODEnabled = Source->bLODEnabled;
+	LODDistanceSquared1 = Source->LODDistanceSquared1;
+	LODDistanceSquared2 = Source->LODDistanceSquared2;
+	MinLODLevel = Source->MinLODLevel;
+	ForcedLODLevel = Source->ForcedLODLevel;
+	OriginalMeshPath = Source->OriginalMeshPath;
+	bIsScrollEnabled = Source->bIsScrollEnabled;
+	ElapsedTime = Source->ElapsedTime;
 }
 
 TObjectPtr<UClass> UStaticMeshComponent::GetSpecificWidgetClass() const
@@ -142,9 +143,10 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 			OriginalMeshPath = InObjPath;
 		}
 
-		Vertices = &(StaticMesh.Get()->GetVertices());
+		Positions = &(StaticMesh.Get()->GetPositions());
 		VertexBuffer = AssetManager.GetVertexBuffer(InObjPath);
-		NumVertices = Vertices->size();
+		AttributeBuffer = AssetManager.GetAttributeBuffer(InObjPath);
+		NumVertices = Positions->size();
 
 		Indices = &(StaticMesh.Get()->GetIndices());
 		IndexBuffer = AssetManager.GetIndexBuffer(InObjPath);
@@ -153,6 +155,7 @@ void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
 		RenderState.CullMode = ECullMode::Back;
 		RenderState.FillMode = EFillMode::Solid;
 		BoundingBox = &AssetManager.GetStaticMeshAABB(InObjPath);
+		MarkBoundsAsDirty();
 	}
 }
 
@@ -11,7 +11,7 @@ UTriangleComponent::UTriangleComponent()
 	UAssetManager& ResourceManager = UAssetManager::GetInstance();
 	SetName("TriangleComponent");
 	Type = EPrimitiveType::Triangle;
-	Vertices = ResourceManager.GetVertexData(Type);
+	Positions = ResourceManager.GetPositionData(Type);
 	VertexBuffer = ResourceManager.GetVertexbuffer(Type);
 	NumVertices = ResourceManager.GetNumVertices(Type);
 	RenderState.CullMode = ECullMode::None;
@@ -0,0 +1,74 @@
+#pragma once
+#include "Global/CoreTypes.h"
+
+struct FStaticMesh;
+
+/**
+ * @brief FIFO 정점 캐시 시뮬레이션 결과
+ * ACMR = 변환한 정점 / 삼각형 (0.5 ~ 3), ATVR = 변환한 정점 / 참조된 고유 정점 (1이 최적)
+ */
+struct FVertexCacheStats
+{
+	uint32 NumTriangles = 0;
+	uint32 NumVertices = 0;
+	uint32 NumTransformed = 0;
+
+	float GetACMR() const { return NumTriangles > 0 ? static_cast<float>(NumTransformed) / NumTriangles : 0.0f; }
+	float GetATVR() const { return NumVertices > 0 ? static_cast<float>(NumTransformed) / NumVertices : 0.0f; }
+
+	FVertexCacheStats& operator+=(const FVertexCacheStats& InOther)
+	{
+		NumTriangles += InOther.NumTriangles;
+		NumVertices += InOther.NumVertices;
+		NumTransformed += InOther.NumTransformed;
+		return *this;
+	}
+};
+
+/**
+ * @brief 임포트한 메시의 인덱스/정점 순서 최적화 (Sander et al. 2007, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw")
+ * 1. 정점 캐시: Tipsify로 변환 후 캐시 재사용이 높은 삼각형 순서를 만든다
+ * 2. 오버드로: 캐시 순서를 클러스터로 끊고, 바깥을 향한 클러스터가 먼저 그려지도록 클러스터 순서만 바꾼다
+ * 3. 정점 fetch: 최종 인덱스에서 처음 쓰이는 순서대로 정점 스트림을 다시 배치한다
+ * 섹션 범위(StartIndex, IndexCount)와 재질은 바뀌지 않는다
+ */
+class FMeshOptimizer
+{
+public:
+	/** @brief 섹션마다 정점 캐시 + 오버드로 순서를 정한 뒤 메시 전체의 정점 순서를 맞춘다 */
+	static void OptimizeStaticMesh(FStaticMesh& InOutMesh);
+
+	/**
+	 * @brief Tipsify 삼각형 재배열
+	 * @param OutClusters 캐시가 끊겨 다음 정점을 멀리서 고른 지점 (삼각형 번호, 첫 값은 항상 0), 오버드로 단계가 쓴다
+	 */
+	static void OptimizeVertexCache(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount,
+		uint32 InCacheSize = VERTEX_CACHE_SIZE, TArray<uint32>* OutClusters = nullptr);
+
+	/**
+	 * @brief 캐시 순서를 유지하는 선에서 클러스터 단위로 바깥쪽 면부터 그리도록 정렬한다
+	 * @param InClusters OptimizeVertexCache가 돌려준 경계
+	 * @param InThreshold 클러스터를 더 잘게 나눌 때 허용하는 ACMR 증가율
+	 */
+	static void OptimizeOverdraw(uint32* InOutIndices, size_t InIndexCount, const FMeshPosition* InPositions, size_t InVertexCount,
+		const TArray<uint32>& InClusters, uint32 InCacheSize = VERTEX_CACHE_SIZE, float InThreshold = OVERDRAW_THRESHOLD);
+
+	/**
+	 * @brief 인덱스에서 처음 쓰이는 순서로 정점 번호를 다시 매긴다
+	 * @return 새 번호 -> 옛 번호 표, 쓰이지 않는 정점은 빠진다
+	 */
+	static TArray<uint32> OptimizeVertexFetch(uint32* InOutIndices, size_t InIndexCount, size_t InVertexCount);
+
+	static FVertexCacheStats AnalyzeVertexCache(const uint32* InIndices, size_t InIndexCount, size_t InVertexCount,
+		uint32 InCacheSize = VERTEX_CACHE_SIZE);
+
+	/** @brief 섹션마다 캐시를 비우고 잰 합 (섹션 사이에는 다른 드로우가 끼어든다) */
+	static FVertexCacheStats AnalyzeStaticMesh(const FStaticMesh& InMesh, uint32 InCacheSize = VERTEX_CACHE_SIZE);
+
+	// 최적화 대상이자 측정 기준인 FIFO 캐시 크기
+	static constexpr uint32 VERTEX_CACHE_SIZE = 16;
+	static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+	/** 최적화 결과(삼각형/정점 순서)가 바뀌면 올린다 (쿠킹된 메시 캐시가 통째로 무효화된다) */
+	static constexpr uint32 OPTIMIZER_VERSION = 1;
+};
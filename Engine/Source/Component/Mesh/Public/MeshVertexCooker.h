@@ -0,0 +1,37 @@
+#pragma once
+#include "Global/CoreTypes.h"
+
+/**
+ * @brief 메쉬 정점 메모리 사용량 비교 (FNormalVertex 기준 vs 쿠킹된 위치/속성 스트림)
+ */
+struct FMeshVertexSizeReport
+{
+	uint32 NumVertices = 0;
+	uint64 SourceBytes = 0;
+	uint64 PositionBytes = 0;
+	uint64 AttributeBytes = 0;
+
+	uint64 GetCookedBytes() const { return PositionBytes + AttributeBytes; }
+};
+
+/**
+ * @brief 정점 데이터를 위치 스트림(FMeshPosition)과 속성 스트림(FMeshAttribute)으로 쿠킹한다
+ * 노멀은 Octahedral 인코딩 후 snorm16으로, UV는 half float로 양자화한다
+ */
+class FMeshVertexCooker
+{
+public:
+	static FMeshAttribute MakeAttribute(const FVector& InNormal, const FVector2& InTexCoord);
+
+	static void CookVertices(const TArray<FNormalVertex>& InVertices, TArray<FMeshPosition>& OutPositions, TArray<FMeshAttribute>& OutAttributes);
+	static void CookPositions(const TArray<FNormalVertex>& InVertices, TArray<FMeshPosition>& OutPositions);
+
+	static FMeshVertexSizeReport MakeSizeReport(uint32 InNumVertices);
+
+	/** 길이가 0인 노멀은 (0, 0, 1)로 인코딩된다 */
+	static void EncodeOctNormal(const FVector& InNormal, int16 OutEncoded[2]);
+	static FVector DecodeOctNormal(const int16 InEncoded[2]);
+
+	static uint16 FloatToHalf(float InValue);
+	static float HalfToFloat(uint16 InHalf);
+};
@@ -3,7 +3,7 @@
 #include "Core/Public/Object.h"       // UObject 기반 클래스 및 매크로
 #include "Core/Public/ObjectPtr.h" // TObjectPtr 사용
 #include "Global/CoreTypes.h"        // TArray 등
-#include "Physics/Public/AABB.h"
+#include "Physics/Public/Box.h"
 
 // 전방 선언: FStaticMesh의 전체 정의를 포함할 필요 없이 포인터만 사용
 struct FMeshSection
@@ -11,11 +11,14 @@ struct FMeshSection
 	uint32 StartIndex;
 	uint32 IndexCount;
 	uint32 MaterialSlot;
+
+	// MTL에서 재질을 찾지 못한 섹션
+	static constexpr uint32 INVALID_MATERIAL_SLOT = UINT32_MAX;
 };
 
 struct FTriangleBVHPrimitive
 {
-	FAABB Bounds;
+	FBox Bounds;
 	FVector Center;
 	uint32 Indices[3];
 
@@ -27,7 +30,7 @@ struct FTriangleBVHPrimitive
 
 struct FTriangleBVHNode
 {
-	FAABB Bounds;
+	FBox Bounds;
 	int32 LeftChild = -1;
 	int32 RightChild = -1;
 	int32 Start = 0;
@@ -84,7 +87,9 @@ struct FStaticMesh
 {
 	FName PathFileName;
 
-	TArray<FNormalVertex> Vertices;
+	// 쿠킹된 정점 스트림: 위치(float3)와 속성(Octahedral 노멀 + Half UV)을 분리해 보관한다
+	TArray<FMeshPosition> Positions;
+	TArray<FMeshAttribute> Attributes;
 	TArray<uint32> Indices;
 
 	// --- 2. 재질 정보 (Materials) ---
@@ -134,12 +139,17 @@ public:
 	const FName& GetAssetPathFileName() const;
 
 	// Geometry Data
-	const TArray<FNormalVertex>& GetVertices() const;
-	TArray<FNormalVertex>& GetVertices();
+	const TArray<FMeshPosition>& GetPositions() const;
+	const TArray<FMeshAttribute>& GetAttributes() const;
 	const TArray<uint32>& GetIndices() const;
 
 	bool RaycastTriangleBVH(const FRay& ModelRay, float& InOutDistance) const;
 
+	/** @brief 애셋의 삼각형 BVH를 만든다 (이미 있으면 그대로), UObject를 건드리지 않으므로 작업 스레드에서 불러도 된다 */
+	static void BuildTriangleBVH(FStaticMesh& InStaticMeshAsset);
+	/** @brief 있던 BVH를 버리고 다시 만든다 (정점/인덱스를 바꾼 뒤나 빌드 시간을 잴 때) */
+	static void RebuildTriangleBVH(FStaticMesh& InStaticMeshAsset);
+
 	// LOD System
 	void AddLODMesh(FStaticMesh* LODMesh);
 	FStaticMesh* GetLODMesh(int32 LODLevel) const;
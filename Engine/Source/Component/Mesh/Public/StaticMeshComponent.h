@@ -18,12 +18,15 @@ public:
 	~UStaticMeshComponent();
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
-	UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 public:
 	UStaticMesh* GetStaticMesh() { return StaticMesh; }
 	void SetStaticMesh(const FName& InObjPath);
 
+	/** @brief 속성 스트림 (Octahedral 노멀 + Half UV), 위치 스트림은 GetVertexBuffer()로 얻는다 */
+	ID3D11Buffer* GetAttributeBuffer() const { return AttributeBuffer; }
+
 	TObjectPtr<UClass> GetSpecificWidgetClass() const override;
 
 	UMaterial* GetMaterial(int32 Index) const;
@@ -64,6 +67,7 @@ public:
 
 private:
 	TObjectPtr<UStaticMesh> StaticMesh;
+	ID3D11Buffer* AttributeBuffer = nullptr;
 
 	// MaterialList
 	TArray<UMaterial*> OverrideMaterials;
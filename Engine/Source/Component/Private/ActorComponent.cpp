@@ -22,8 +22,6 @@ UObject* UActorComponent::Duplicate(FObjectDuplicationParameters Parameters)
 {
 	auto DupObject = static_cast<UActorComponent*>(Super::Duplicate(Parameters));
 
-	DupObject->ComponentType = ComponentType;
-
 	if (Owner != nullptr)
 	{
 		if (auto It = Parameters.DuplicationSeed.find(Owner); It != Parameters.DuplicationSeed.end())
@@ -45,6 +43,13 @@ UObject* UActorComponent::Duplicate(FObjectDuplicationParameters Parameters)
 	return DupObject;
 }
 
+void UActorComponent::CopyPropertiesFrom(const UObject* InSource)
+{
+	Super::CopyPropertiesFrom(InSource);
+
+	ComponentType = static_cast<const UActorComponent*>(InSource)->ComponentType;
+}
+
 void UActorComponent::BeginPlay()
 {
 
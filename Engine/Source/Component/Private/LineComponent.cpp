@@ -9,7 +9,7 @@ ULineComponent::ULineComponent()
 {
 	UAssetManager& ResourceManager = UAssetManager::GetInstance();
 	Type = EPrimitiveType::Line;
-	Vertices = ResourceManager.GetVertexData(Type);
+	Positions = ResourceManager.GetPositionData(Type);
 	VertexBuffer = ResourceManager.GetVertexbuffer(Type);
 	NumVertices = ResourceManager.GetNumVertices(Type);
 	Topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
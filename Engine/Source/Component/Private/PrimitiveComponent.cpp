@@ -2,6 +2,7 @@
 #include "Component/Public/PrimitiveComponent.h"
 
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Transform/Public/TransformManager.h"
 #include "Physics/Public/AABB.h"
 
 IMPLEMENT_CLASS(UPrimitiveComponent, USceneComponent)
@@ -11,27 +12,27 @@ UPrimitiveComponent::UPrimitiveComponent()
 	ComponentType = EComponentType::Primitive;
 }
 
-UObject* UPrimitiveComponent::Duplicate(FObjectDuplicationParameters Parameters)
+void UPrimitiveComponent::CopyPropertiesFrom(const UObject* InSource)
 {
-	auto DupObject = static_cast<UPrimitiveComponent*>(Super::Duplicate(Parameters));
+	Super::CopyPropertiesFrom(InSource);
+
+	const UPrimitiveComponent* Source = static_cast<const UPrimitiveComponent*>(InSource);
 
 	// @note 프로퍼티 얕은 복사(Shallow copy)
-	DupObject->Vertices		= Vertices;
-	DupObject->Indices		= Indices;
-	DupObject->VertexBuffer = VertexBuffer;
-	DupObject->IndexBuffer	= IndexBuffer;
-	DupObject->BoundingBox	= BoundingBox;
+	Positions		= Source->Positions;
+	Indices			= Source->Indices;
+	VertexBuffer	= Source->VertexBuffer;
+	IndexBuffer		= Source->IndexBuffer;
+	BoundingBox		= Source->BoundingBox;
 
 	// @note 프로퍼티 깊은 복사(Deep copy)
-	DupObject->NumVertices	= NumVertices;
-	DupObject->NumIndices	= NumIndices;
-	DupObject->Color		= Color;
-	DupObject->Topology		= Topology;
-	DupObject->RenderState	= RenderState;
-	DupObject->Type			= Type;
-	DupObject->bVisible		= bVisible;
-
-	return DupObject;
+	NumVertices		= Source->NumVertices;
+	NumIndices		= Source->NumIndices;
+	Color			= Source->Color;
+	Topology		= Source->Topology;
+	RenderState		= Source->RenderState;
+	Type			= Source->Type;
+	bVisible		= Source->bVisible;
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& Location)
@@ -83,16 +84,23 @@ const FVector& USceneComponent::GetRelativeScale3D() const
 
 const FMatrix& USceneComponent::GetWorldTransformMatrix() const
 {
+	// 등록된 컴포넌트는 프레임 중간에 바뀐 경우에만 자신을 덮는 dirty 서브트리를 먼저 계산한다 (결과는 캐시에 써진다)
+	if (TransformHandle != FTransformHierarchy::INVALID_HANDLE)
+	{
+		UTransformManager::GetInstance().GetHierarchy().UpdateNode(TransformHandle);
+		return WorldTransformMatrix;
+	}
+
 	if (bIsTransformDirty)
 	{
 		WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, FVector::GetDegreeToRadian(RelativeRotation), RelativeScale3D);
-
-		for (USceneComponent* Ancestor = ParentAttachment; Ancestor; Ancestor = Ancestor->ParentAttachment)
+		if (ParentAttachment)
 		{
-			WorldTransformMatrix *= FMatrix::GetModelMatrix(Ancestor->RelativeLocation, FVector::GetDegreeToRadian(Ancestor->RelativeRotation), Ancestor->RelativeScale3D);
+			WorldTransformMatrix *= ParentAttachment->GetWorldTransformMatrix();
 		}
 
 		bIsTransformDirty = false;
+		bIsTransformDirtyInverse = true;
 	}
 
 	return WorldTransformMatrix;
@@ -100,19 +108,21 @@ const FMatrix& USceneComponent::GetWorldTransformMatrix() const
 
 const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 {
-	if (bIsTransformDirtyInverse || bIsTransformDirty)
+	// 월드 행렬을 다시 계산하면 역행렬도 dirty가 된다
+	const FMatrix& WorldMatrix = GetWorldTransformMatrix();
+	if (bIsTransformDirtyInverse)
 	{
-		const FMatrix& WorldMatrix = GetWorldTransformMatrix();
-		WorldTransformMatrixInverse = WorldMatrix.Inverse();
+		// 월드 행렬은 이미 캐시되어 있으므로 TRS에서 삼각함수를 다시 구하는 것보다 아핀 역행렬이 싸다
+		WorldTransformMatrixInverse = WorldMatrix.InverseAffine();
 		bIsTransformDirtyInverse = false;
 	}
 
 	return WorldTransformMatrixInverse;
 }
 
-const TArray<FNormalVertex>* UPrimitiveComponent::GetVerticesData() const
+const TArray<FMeshPosition>* UPrimitiveComponent::GetPositionsData() const
 {
-	return Vertices;
+	return Positions;
 }
 
 const TArray<uint32>* UPrimitiveComponent::GetIndicesData() const
@@ -156,30 +166,38 @@ void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
 
 	if (BoundingBox->GetType() == EBoundingVolumeType::AABB)
 	{
-		const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingBox);
-		FVector LocalCorners[8] =
-		{
-			FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Min.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Min.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Max.Z),
-			FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Max.Z)
-		};
-		const FMatrix& WorldTransform = GetWorldTransformMatrix();
-		FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-		FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-		for (int i = 0; i < 8; i++)
-		{
-			FVector4 WorldCorner = FVector4(LocalCorners[i].X, LocalCorners[i].Y, LocalCorners[i].Z, 1.0f) * WorldTransform;
-			WorldMin.X = std::min(WorldMin.X, WorldCorner.X);
-			WorldMin.Y = std::min(WorldMin.Y, WorldCorner.Y);
-			WorldMin.Z = std::min(WorldMin.Z, WorldCorner.Z);
-			WorldMax.X = std::max(WorldMax.X, WorldCorner.X);
-			WorldMax.Y = std::max(WorldMax.Y, WorldCorner.Y);
-			WorldMax.Z = std::max(WorldMax.Z, WorldCorner.Z);
-		}
-		OutMin = WorldMin;
-		OutMax = WorldMax;
+		const FBox WorldBounds = GetWorldBounds();
+		OutMin = WorldBounds.GetMin();
+		OutMax = WorldBounds.GetMax();
+	}
+}
+
+FBox UPrimitiveComponent::GetLocalBounds() const
+{
+	if (BoundingBox && BoundingBox->GetType() == EBoundingVolumeType::AABB)
+	{
+		return FBox::FromAABB(*static_cast<const FAABB*>(BoundingBox));
+	}
+	return FBox();
+}
+
+FBox UPrimitiveComponent::GetWorldBounds() const
+{
+	const uint32 Handle = GetTransformHandle();
+	if (Handle != FTransformHierarchy::INVALID_HANDLE)
+	{
+		return UTransformManager::GetInstance().GetHierarchy().GetWorldBounds(Handle);
+	}
+
+	return GetLocalBounds().TransformBy(GetWorldTransformMatrix());
+}
+
+void UPrimitiveComponent::MarkBoundsAsDirty()
+{
+	const uint32 Handle = GetTransformHandle();
+	if (Handle != FTransformHierarchy::INVALID_HANDLE)
+	{
+		UTransformManager::GetInstance().GetHierarchy().SetLocalBounds(Handle, GetLocalBounds());
 	}
 }
 
@@ -2,6 +2,7 @@
 #include "Component/Public/SceneComponent.h"
 
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Transform/Public/TransformManager.h"
 #include "Utility/Public/JsonSerializer.h"
 
 #include <json.hpp>
@@ -13,6 +14,11 @@ USceneComponent::USceneComponent()
 	ComponentType = EComponentType::Scene;
 }
 
+USceneComponent::~USceneComponent()
+{
+	UTransformManager::GetInstance().UnregisterComponent(this);
+}
+
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	Super::Serialize(bInIsLoading, InOutHandle);
@@ -23,6 +29,7 @@ void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		FJsonSerializer::ReadVector(InOutHandle, "Location", RelativeLocation, FVector::ZeroVector());
 		FJsonSerializer::ReadVector(InOutHandle, "Rotation", RelativeRotation, FVector::ZeroVector());
 		FJsonSerializer::ReadVector(InOutHandle, "Scale", RelativeScale3D, FVector::OneVector());
+		MarkAsDirty();
 	}
 	// 저장
 	else
@@ -37,19 +44,6 @@ UObject* USceneComponent::Duplicate(FObjectDuplicationParameters Parameters)
 {
 	auto DupObject = static_cast<USceneComponent*>(Super::Duplicate(Parameters));
 
-	DupObject->bIsTransformDirty = bIsTransformDirty;
-	DupObject->bIsTransformDirtyInverse = bIsTransformDirtyInverse;
-
-	DupObject->WorldTransformMatrix = WorldTransformMatrix;
-	DupObject->WorldTransformMatrixInverse = WorldTransformMatrixInverse;
-
-	DupObject->RelativeLocation = RelativeLocation;
-	DupObject->RelativeRotation = RelativeRotation;
-	DupObject->RelativeScale3D = RelativeScale3D;
-
-	// @note: 에디터 변수 비활성화
-	//DupObject->bIsUniformScale = bIsUniformScale;
-
 	if (ParentAttachment != nullptr)
 	{
 		if (auto It = Parameters.DuplicationSeed.find(ParentAttachment); It != Parameters.DuplicationSeed.end())
@@ -85,6 +79,26 @@ UObject* USceneComponent::Duplicate(FObjectDuplicationParameters Parameters)
 	return DupObject;
 }
 
+void USceneComponent::CopyPropertiesFrom(const UObject* InSource)
+{
+	Super::CopyPropertiesFrom(InSource);
+
+	const USceneComponent* Source = static_cast<const USceneComponent*>(InSource);
+
+	bIsTransformDirty = Source->bIsTransformDirty;
+	bIsTransformDirtyInverse = Source->bIsTransformDirtyInverse;
+
+	WorldTransformMatrix = Source->WorldTransformMatrix;
+	WorldTransformMatrixInverse = Source->WorldTransformMatrixInverse;
+
+	RelativeLocation = Source->RelativeLocation;
+	RelativeRotation = Source->RelativeRotation;
+	RelativeScale3D = Source->RelativeScale3D;
+
+	// @note: 에디터 변수 비활성화
+	//bIsUniformScale = Source->bIsUniformScale;
+}
+
 void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 {
 	if (NewParent == this)
@@ -98,9 +112,9 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 	}
 
 	//부모의 조상중에 내 자식이 있으면 순환참조 -> 스택오버플로우 일어남.
-	for (USceneComponent* Ancester = NewParent; Ancester; Ancester = NewParent->ParentAttachment)
+	for (USceneComponent* Ancester = NewParent; Ancester; Ancester = Ancester->ParentAttachment)
 	{
-		if (NewParent == this) //조상중에 내 자식이 있다면 조상중에 내가 있을 것임.
+		if (Ancester == this) //조상중에 내 자식이 있다면 조상중에 내가 있을 것임.
 			return;
 	}
 
@@ -113,6 +127,7 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 
 	ParentAttachment = NewParent;
 
+	UTransformManager::GetInstance().UpdateParent(this);
 	MarkAsDirty();
 
 }
@@ -129,7 +144,7 @@ void USceneComponent::AddChild(USceneComponent* ChildAdded)
 
 void USceneComponent::RemoveChild(USceneComponent* ChildDeleted)
 {
-	Children.erase(std::remove(Children.begin(), Children.end(), this), Children.end());
+	Children.erase(std::remove(Children.begin(), Children.end(), ChildDeleted), Children.end());
 }
 
 void USceneComponent::MarkAsDirty()
@@ -137,6 +152,13 @@ void USceneComponent::MarkAsDirty()
 	bIsTransformDirty = true;
 	bIsTransformDirtyInverse = true;
 
+	// 등록된 컴포넌트는 자식까지 계층이 한 번에 갱신하므로 로컬 트랜스폼만 넘긴다
+	if (TransformHandle != FTransformHierarchy::INVALID_HANDLE)
+	{
+		UTransformManager::GetInstance().GetHierarchy().SetLocalTransform(TransformHandle, RelativeLocation, RelativeRotation, RelativeScale3D);
+		return;
+	}
+
 	for (USceneComponent* Child : Children)
 	{
 		Child->MarkAsDirty();
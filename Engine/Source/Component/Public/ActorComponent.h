@@ -19,6 +19,7 @@ public:
 	}*/
 
 	virtual UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 	virtual void BeginPlay();
 	virtual void TickComponent(float DeltaSeconds);
@@ -1,6 +1,7 @@
 #pragma once
 #include "Component/Public/SceneComponent.h"
 #include "Physics/Public/BoundingVolume.h"
+#include "Physics/Public/Box.h"
 
 UCLASS()
 class UPrimitiveComponent : public USceneComponent
@@ -11,9 +12,10 @@ class UPrimitiveComponent : public USceneComponent
 public:
 	UPrimitiveComponent();
 
-	virtual UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
-	const TArray<FNormalVertex>* GetVerticesData() const;
+	/** @brief 위치 스트림 (피킹, 오클루전 등 위치만 필요한 경로용) */
+	const TArray<FMeshPosition>* GetPositionsData() const;
 	const TArray<uint32>* GetIndicesData() const;
 	ID3D11Buffer* GetVertexBuffer() const;
 	ID3D11Buffer* GetIndexBuffer() const;
@@ -35,10 +37,22 @@ public:
 	const IBoundingVolume* GetBoundingBox() const { return BoundingBox; }
 	void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
 
+	/** @brief BoundingBox(AABB)의 로컬 바운드, 없으면 원점 크기 0 박스 */
+	FBox GetLocalBounds() const;
+	/** @brief 등록된 컴포넌트는 계층이 dirty 트랜스폼에 대해서만 갱신해 둔 월드 바운드를 읽는다 */
+	FBox GetWorldBounds() const;
+	/** @brief BoundingBox를 바꾼 뒤 호출해 계층의 로컬 바운드를 갱신한다 */
+	void MarkBoundsAsDirty();
+
 	EPrimitiveType GetPrimitiveType() const { return Type; }
 
+	/** @brief 레벨 등록 시 할당되는 씬 슬롯 (가시성 배열의 인덱스, 미등록이면 INVALID_SCENE_SLOT) */
+	static constexpr uint32 INVALID_SCENE_SLOT = UINT32_MAX;
+	uint32 GetSceneSlot() const { return SceneSlot; }
+	void SetSceneSlot(uint32 InSceneSlot) { SceneSlot = InSceneSlot; }
+
 protected:
-	const TArray<FNormalVertex>* Vertices = nullptr;
+	const TArray<FMeshPosition>* Positions = nullptr;
 	const TArray<uint32>* Indices = nullptr;
 
 	ID3D11Buffer* VertexBuffer = nullptr;
@@ -56,4 +70,7 @@ protected:
 	bool bVisible = true;
 
 	const IBoundingVolume* BoundingBox = nullptr;
+
+	// 복제본은 자신의 레벨에 등록될 때 새 슬롯을 받으므로 CopyPropertiesFrom에서 복사하지 않는다
+	uint32 SceneSlot = INVALID_SCENE_SLOT;
 };
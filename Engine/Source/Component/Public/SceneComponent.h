@@ -1,5 +1,6 @@
 #pragma once
 #include "Component/Public/ActorComponent.h"
+#include "Manager/Transform/Public/TransformHierarchy.h"
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -12,9 +13,11 @@ class USceneComponent : public UActorComponent
 
 public:
 	USceneComponent();
+	~USceneComponent() override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 	UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 	void SetParentAttachment(USceneComponent* SceneComponent);
 	void AddChild(USceneComponent* ChildAdded);
@@ -36,7 +39,16 @@ public:
 	const FMatrix& GetWorldTransformMatrix() const;
 	const FMatrix& GetWorldTransformMatrixInverse() const;
 
+	/** UTransformManager에 등록되지 않았으면 FTransformHierarchy::INVALID_HANDLE */
+	uint32 GetTransformHandle() const { return TransformHandle; }
+
 private:
+	friend class UTransformManager;
+	friend class FWorldCloner;
+
+	// UTransformManager에 등록되면 월드 행렬은 계층이 프레임마다 갱신해 아래 캐시에 써 준다
+	uint32 TransformHandle = FTransformHierarchy::INVALID_HANDLE;
+
 	mutable bool bIsTransformDirty = true;
 	mutable bool bIsTransformDirtyInverse = true;
 	mutable FMatrix WorldTransformMatrix;
@@ -1,11 +1,13 @@
 #include "pch.h"
 #include "Core/Public/ClientApp.h"
 
+#include "Core/Public/ScopeCycleCounter.h"
 #include "Editor/Public/EditorEngine.h"
 #include "Core/Public/AppWindow.h"
 #include "Manager/Input/Public/InputManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Manager/Time/Public/TimeManager.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
 
 #include "Manager/UI/Public/UIManager.h"
 #include "Manager/Config/Public/ConfigManager.h"
@@ -18,6 +20,10 @@
 #include "Utility/Public/FileDialog.h"
 #endif
 
+DECLARE_CYCLE_STAT("Engine Tick", STAT_EngineTick, Frame)
+DECLARE_CYCLE_STAT("UI Tick", STAT_UITick, Frame)
+DECLARE_CYCLE_STAT("Renderer Tick", STAT_RenderTick, Frame)
+
 FClientApp::FClientApp() = default;
 
 FClientApp::~FClientApp() = default;
@@ -80,6 +86,12 @@ int FClientApp::InitializeSystem() const
 	// 현재 시간을 랜덤 시드로 설정
 	srand(static_cast<unsigned int>(time(NULL)));
 
+	// 프로파일러 트레이스에 표시될 메인 스레드 이름
+	FThreadStats::SetThreadName("Main");
+
+	// UE_LOG를 표준 출력/콘솔과 함께 파일로도 남긴다
+	FLogger::OpenLogFile("Log/GTL.log");
+
 	// Initialize By Get Instance
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance().Initialize(Window);
@@ -128,12 +140,24 @@ void FClientApp::TickSystem(float DeltaSeconds) const
 			GEngine->EndPIE();
 		}
 
+		SCOPE_CYCLE_COUNTER(STAT_EngineTick);
 		GEngine->Tick(DeltaSeconds);
 	}
 
 	InputManager.Tick(DeltaSeconds);
-	UIManager.Tick(DeltaSeconds);
-	Renderer.Tick(DeltaSeconds);
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_UITick);
+		UIManager.Tick(DeltaSeconds);
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_RenderTick);
+		Renderer.Tick(DeltaSeconds);
+	}
+
+	// 모든 스레드의 이번 프레임 스코프를 모아 계층 집계/히스토리에 반영한다
+	UProfilerManager::GetInstance().EndFrame();
 }
 
 /**
@@ -206,5 +230,8 @@ void FClientApp::ShutdownSystem() const
 	// 추후 GC가 처리할 것
 	UClass::Shutdown();
 
+	// 남은 로그를 모두 내보내고 로거 스레드를 멈춘다
+	FLogger::Shutdown();
+
 	delete Window;
 }
@@ -0,0 +1,369 @@
+#include "pch.h"
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/ThreadStats.h"
+
+namespace
+{
+	constexpr int32 QUEUE_INDEX_UNKNOWN = -2;
+	constexpr int32 QUEUE_INDEX_EXTERNAL = -1;
+
+	// 잠들기 전에 양보하며 다시 찾아보는 횟수 (프레임 안에서 연달아 들어오는 잡을 놓치지 않도록)
+	constexpr uint32 IDLE_SPIN_COUNT = 64;
+
+	thread_local int32 ThreadQueueIndex = QUEUE_INDEX_UNKNOWN;
+	thread_local uint32 ThreadStealSeed = 0;
+	thread_local FJob* ThreadJobPool = nullptr;
+	thread_local uint32 ThreadJobIndex = 0;
+}
+
+bool FJobDeque::Push(FJob* InJob)
+{
+	const int64 CurrentBottom = Bottom.load(std::memory_order_relaxed);
+	const int64 CurrentTop = Top.load(std::memory_order_acquire);
+	if (CurrentBottom - CurrentTop >= CAPACITY)
+	{
+		return false;
+	}
+
+	Jobs[CurrentBottom & (CAPACITY - 1)].store(InJob, std::memory_order_relaxed);
+	Bottom.store(CurrentBottom + 1, std::memory_order_release);
+	return true;
+}
+
+FJob* FJobDeque::Pop()
+{
+	const int64 NewBottom = Bottom.load(std::memory_order_relaxed) - 1;
+	Bottom.store(NewBottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64 CurrentTop = Top.load(std::memory_order_relaxed);
+
+	if (CurrentTop > NewBottom)
+	{
+		Bottom.store(NewBottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	FJob* Job = Jobs[NewBottom & (CAPACITY - 1)].load(std::memory_order_relaxed);
+	if (CurrentTop == NewBottom)
+	{
+		// 마지막 하나는 훔치려는 워커와 Top을 두고 경쟁한다
+		if (!Top.compare_exchange_strong(CurrentTop, CurrentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			Job = nullptr;
+		}
+		Bottom.store(NewBottom + 1, std::memory_order_relaxed);
+	}
+	return Job;
+}
+
+FJob* FJobDeque::Steal()
+{
+	int64 CurrentTop = Top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const int64 CurrentBottom = Bottom.load(std::memory_order_acquire);
+	if (CurrentTop >= CurrentBottom)
+	{
+		return nullptr;
+	}
+
+	FJob* Job = Jobs[CurrentTop & (CAPACITY - 1)].load(std::memory_order_relaxed);
+	if (!Top.compare_exchange_strong(CurrentTop, CurrentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+	{
+		return nullptr;
+	}
+	return Job;
+}
+
+FJobSystem::FJobSystem()
+{
+	MainThreadId = std::this_thread::get_id();
+
+	// 호출 스레드가 0번 큐를 쓰므로 워커는 코어 수 - 1개
+	const uint32 NumCores = std::max(1u, std::thread::hardware_concurrency());
+	NumQueues = NumCores;
+	// Top/Bottom이 서로 다른 캐시 라인에 있어야 하므로 정렬 new가 64바이트 정렬을 지켜야 한다
+	static_assert(alignof(FJobDeque) == 64, "FJobDeque must be cache line aligned");
+	Queues = new FJobDeque[NumQueues];
+	assert("Job deque array must be cache line aligned" && reinterpret_cast<uintptr_t>(Queues) % alignof(FJobDeque) == 0);
+
+	Workers.reserve(NumQueues - 1);
+	for (uint32 Index = 1; Index < NumQueues; ++Index)
+	{
+		Workers.emplace_back(&FJobSystem::WorkerMain, this, static_cast<int32>(Index));
+	}
+}
+
+/**
+ * @brief 처음 호출한 스레드를 메인 스레드로 보고 워커를 띄운다
+ * 종료 중에도 잡 핸들이 유효하도록 인스턴스는 해제하지 않고 atexit에서 워커만 정리한다
+ */
+FJobSystem& FJobSystem::Get()
+{
+	static FJobSystem* System = []
+	{
+		FJobSystem* NewSystem = new FJobSystem();
+		std::atexit(&FJobSystem::Shutdown);
+		return NewSystem;
+	}();
+	return *System;
+}
+
+uint32 FJobSystem::GetNumThreads()
+{
+	return Get().NumQueues;
+}
+
+/**
+ * @brief 호출 스레드의 잡 링에서 다음 슬롯을 꺼내 초기화한다
+ */
+FJob* FJobSystem::AllocateJob(FJob* InParent)
+{
+	if (!ThreadJobPool)
+	{
+		FJobSystem& System = Get();
+		std::lock_guard<std::mutex> Lock(System.JobPoolMutex);
+		static_assert(alignof(FJob) == 64, "FJob must be cache line aligned");
+		System.JobPools.emplace_back(new FJob[MAX_JOBS_PER_THREAD]);
+		ThreadJobPool = System.JobPools.back().get();
+		assert("Job pool must be cache line aligned" && reinterpret_cast<uintptr_t>(ThreadJobPool) % alignof(FJob) == 0);
+	}
+
+	FJob* Job = &ThreadJobPool[ThreadJobIndex++ & (MAX_JOBS_PER_THREAD - 1)];
+	Job->Function = nullptr;
+	Job->Parent = InParent;
+	Job->UnfinishedJobs.store(1, std::memory_order_relaxed);
+	Job->PendingDependencies.store(1, std::memory_order_relaxed);
+	Job->NumContinuations.store(0, std::memory_order_relaxed);
+
+	if (InParent)
+	{
+		InParent->UnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+	return Job;
+}
+
+void FJobSystem::AddDependency(FJobHandle InJob, FJobHandle InPrerequisite)
+{
+	if (!InJob.IsValid() || !InPrerequisite.IsValid())
+	{
+		return;
+	}
+
+	const int32 Slot = InPrerequisite.Job->NumContinuations.fetch_add(1, std::memory_order_relaxed);
+	assert("Too many continuations on a job" && Slot < static_cast<int32>(FJob::MAX_CONTINUATIONS));
+
+	InJob.Job->PendingDependencies.fetch_add(1, std::memory_order_relaxed);
+	InPrerequisite.Job->Continuations[Slot] = InJob.Job;
+}
+
+void FJobSystem::Run(FJobHandle InJob)
+{
+	if (!InJob.IsValid())
+	{
+		return;
+	}
+
+	if (InJob.Job->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Get().Submit(InJob.Job);
+	}
+}
+
+void FJobSystem::Wait(FJobHandle InJob)
+{
+	FJobSystem& System = Get();
+	const int32 QueueIndex = System.GetQueueIndex();
+
+	while (!IsComplete(InJob))
+	{
+		if (FJob* Job = System.FindJob(QueueIndex))
+		{
+			System.Execute(Job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::Shutdown()
+{
+	FJobSystem& System = Get();
+	if (System.bShutdown.exchange(true))
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(System.WakeMutex);
+		System.WakeCondition.notify_all();
+	}
+
+	for (std::thread& Worker : System.Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+
+	// 큐에 남은 잡은 호출 스레드에서 마저 실행한다, 이후 Run은 바로 실행된다
+	while (FJob* Job = System.FindJob(QUEUE_INDEX_EXTERNAL))
+	{
+		System.Execute(Job);
+	}
+}
+
+void FJobSystem::Submit(FJob* InJob)
+{
+	if (NumQueues <= 1 || bShutdown.load(std::memory_order_acquire))
+	{
+		Execute(InJob);
+		return;
+	}
+
+	const int32 QueueIndex = GetQueueIndex();
+	if (QueueIndex >= 0)
+	{
+		// 덱이 가득 차면 더 쪼개지 않고 그 자리에서 실행한다
+		if (!Queues[QueueIndex].Push(InJob))
+		{
+			Execute(InJob);
+			return;
+		}
+	}
+	else
+	{
+		std::lock_guard<std::mutex> Lock(SharedQueueMutex);
+		SharedQueue.push_back(InJob);
+		NumSharedJobs.fetch_add(1, std::memory_order_release);
+	}
+
+	// 워커는 NumSleepingWorkers를 올린 뒤 NumQueuedJobs를 확인하고 잠드므로 둘 중 하나는 반드시 상대를 본다
+	NumQueuedJobs.fetch_add(1, std::memory_order_seq_cst);
+	if (NumSleepingWorkers.load(std::memory_order_seq_cst) > 0)
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+		WakeCondition.notify_one();
+	}
+}
+
+/**
+ * @brief 자기 덱 -> 공유 큐 -> 다른 스레드의 덱 순서로 잡을 찾는다
+ */
+FJob* FJobSystem::FindJob(int32 InQueueIndex)
+{
+	FJob* Job = nullptr;
+
+	if (InQueueIndex >= 0)
+	{
+		Job = Queues[InQueueIndex].Pop();
+	}
+
+	if (!Job && NumSharedJobs.load(std::memory_order_acquire) > 0)
+	{
+		std::lock_guard<std::mutex> Lock(SharedQueueMutex);
+		if (!SharedQueue.empty())
+		{
+			Job = SharedQueue.back();
+			SharedQueue.pop_back();
+			NumSharedJobs.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	if (!Job)
+	{
+		// 매번 같은 희생자에게 몰리지 않도록 시작 위치를 돌린다
+		const uint32 Start = ThreadStealSeed++;
+		for (uint32 Offset = 0; Offset < NumQueues && !Job; ++Offset)
+		{
+			const uint32 Victim = (Start + Offset) % NumQueues;
+			if (static_cast<int32>(Victim) != InQueueIndex)
+			{
+				Job = Queues[Victim].Steal();
+			}
+		}
+	}
+
+	if (Job)
+	{
+		NumQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+	}
+	return Job;
+}
+
+void FJobSystem::Execute(FJob* InJob)
+{
+	InJob->Function(InJob->Data);
+	Finish(InJob);
+}
+
+/**
+ * @brief 잡과 자식이 모두 끝나면 후속 잡을 풀어 주고 부모에게 완료를 알린다
+ */
+void FJobSystem::Finish(FJob* InJob)
+{
+	if (InJob->UnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	FJob* Parent = InJob->Parent;
+	const int32 NumContinuations = InJob->NumContinuations.load(std::memory_order_acquire);
+	for (int32 Index = 0; Index < NumContinuations; ++Index)
+	{
+		FJob* Continuation = InJob->Continuations[Index];
+		if (Continuation->PendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Submit(Continuation);
+		}
+	}
+
+	if (Parent)
+	{
+		Finish(Parent);
+	}
+}
+
+void FJobSystem::WorkerMain(int32 InQueueIndex)
+{
+	ThreadQueueIndex = InQueueIndex;
+	ThreadStealSeed = static_cast<uint32>(InQueueIndex);
+	FThreadStats::SetThreadName("Worker " + std::to_string(InQueueIndex));
+
+	uint32 IdleCount = 0;
+	while (!bShutdown.load(std::memory_order_acquire))
+	{
+		if (FJob* Job = FindJob(InQueueIndex))
+		{
+			Execute(Job);
+			IdleCount = 0;
+			continue;
+		}
+
+		if (++IdleCount < IDLE_SPIN_COUNT)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> Lock(WakeMutex);
+		NumSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+		WakeCondition.wait(Lock, [this]
+		{
+			return NumQueuedJobs.load(std::memory_order_seq_cst) > 0 || bShutdown.load(std::memory_order_acquire);
+		});
+		NumSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+		IdleCount = 0;
+	}
+}
+
+int32 FJobSystem::GetQueueIndex() const
+{
+	if (ThreadQueueIndex == QUEUE_INDEX_UNKNOWN)
+	{
+		ThreadQueueIndex = std::this_thread::get_id() == MainThreadId ? 0 : QUEUE_INDEX_EXTERNAL;
+	}
+	return ThreadQueueIndex;
+}
@@ -0,0 +1,320 @@
+#include "pch.h"
+#include "Core/Public/Logger.h"
+
+namespace
+{
+	const char* GetLogTypeName(ELogType InType)
+	{
+		switch (InType)
+		{
+		case ELogType::Info:			return "Info";
+		case ELogType::Warning:			return "Warning";
+		case ELogType::Error:			return "Error";
+		case ELogType::Success:			return "Success";
+		case ELogType::System:			return "System";
+		case ELogType::Debug:			return "Debug";
+		case ELogType::UELog:			return "UELog";
+		case ELogType::Terminal:		return "Terminal";
+		case ELogType::TerminalError:	return "TerminalError";
+		case ELogType::Command:			return "Command";
+		default:						return "Log";
+		}
+	}
+}
+
+void FStdoutLogSink::Write(ELogType InType, const char* InPrefix, const char* InMessage)
+{
+	fputs(InPrefix, stdout);
+	fputs(InMessage, stdout);
+	fputc('\n', stdout);
+}
+
+void FStdoutLogSink::Flush()
+{
+	fflush(stdout);
+}
+
+bool FFileLogSink::Open(const FString& InPath)
+{
+	if (File.is_open())
+	{
+		File.close();
+	}
+
+	const path FilePath(InPath);
+	if (FilePath.has_parent_path())
+	{
+		std::error_code ErrorCode;
+		create_directories(FilePath.parent_path(), ErrorCode);
+	}
+
+	File.open(FilePath, std::ios::out | std::ios::trunc);
+	return File.is_open();
+}
+
+void FFileLogSink::Write(ELogType InType, const char* InPrefix, const char* InMessage)
+{
+	if (!File.is_open())
+	{
+		return;
+	}
+
+	// 파일에는 UE_LOG도 타입을 알 수 있도록 항상 타입 이름을 남긴다
+	File << '[' << GetLogTypeName(InType) << "] " << InMessage << '\n';
+}
+
+void FFileLogSink::Flush()
+{
+	if (File.is_open())
+	{
+		File.flush();
+	}
+}
+
+FLogger::FLogger()
+{
+	// 슬롯마다 Sequence가 자기 캐시 라인을 쓰도록 정렬 new가 64바이트 정렬을 지켜야 한다
+	static_assert(alignof(FSlot) == 64, "FSlot must be cache line aligned");
+	Slots = new FSlot[QUEUE_CAPACITY];
+	assert("Log slots must be cache line aligned" && reinterpret_cast<uintptr_t>(Slots) % alignof(FSlot) == 0);
+	for (uint32 Index = 0; Index < QUEUE_CAPACITY; ++Index)
+	{
+		Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+	}
+
+	FormatBuffer.resize(1024);
+	Sinks.push_back(&StdoutSink);
+
+	bRunning.store(true, std::memory_order_release);
+	Thread = std::thread(&FLogger::ThreadMain, this);
+}
+
+/**
+ * @brief 정적 소멸 순서와 상관없이 종료 직전 로그까지 받을 수 있도록 인스턴스는 해제하지 않는다
+ * 프로세스 종료 시 atexit에서 Shutdown으로 스레드를 정리한다
+ */
+FLogger& FLogger::Get()
+{
+	static FLogger* Logger = []
+	{
+		FLogger* NewLogger = new FLogger();
+		std::atexit(&FLogger::Shutdown);
+		return NewLogger;
+	}();
+	return *Logger;
+}
+
+/**
+ * @brief 빈 슬롯을 CAS로 잡는다 (슬롯 시퀀스 == 위치면 비어 있음)
+ * 큐가 가득 차면 로거 스레드를 깨우고 슬롯이 빌 때까지 양보한다
+ */
+uint64 FLogger::AcquireSlot()
+{
+	uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		const uint64 Sequence = Slots[Position & (QUEUE_CAPACITY - 1)].Sequence.load(std::memory_order_acquire);
+		const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+		if (Difference == 0)
+		{
+			if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				return Position;
+			}
+		}
+		else if (Difference < 0)
+		{
+			Wake();
+			std::this_thread::yield();
+			Position = EnqueuePosition.load(std::memory_order_relaxed);
+		}
+		else
+		{
+			Position = EnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void FLogger::PublishSlot(uint64 InPosition)
+{
+	Slots[InPosition & (QUEUE_CAPACITY - 1)].Sequence.store(InPosition + 1, std::memory_order_release);
+	Wake();
+}
+
+void FLogger::Wake()
+{
+	if (bWaiting.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex> Lock(WakeMutex);
+		WakeCondition.notify_one();
+	}
+}
+
+void FLogger::ThreadMain()
+{
+	while (true)
+	{
+		if (DrainQueue() > 0)
+		{
+			continue;
+		}
+
+		if (!bRunning.load(std::memory_order_acquire))
+		{
+			break;
+		}
+
+		// 깨우기 신호를 놓쳐도 짧은 타임아웃 뒤 다시 확인한다
+		std::unique_lock<std::mutex> Lock(WakeMutex);
+		bWaiting.store(true);
+		const uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+		if (Slots[Position & (QUEUE_CAPACITY - 1)].Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			WakeCondition.wait_for(Lock, std::chrono::milliseconds(10));
+		}
+		bWaiting.store(false);
+	}
+}
+
+uint32 FLogger::DrainQueue()
+{
+	std::lock_guard<std::mutex> Lock(SinkMutex);
+
+	uint32 NumDrained = 0;
+	uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		FSlot& Slot = Slots[Position & (QUEUE_CAPACITY - 1)];
+		if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+		{
+			break;
+		}
+
+		Dispatch(Slot.Record);
+
+		// 다음 바퀴의 생산자가 쓸 수 있도록 시퀀스를 한 바퀴 뒤로 넘긴다
+		Slot.Sequence.store(Position + QUEUE_CAPACITY, std::memory_order_release);
+		++Position;
+		++NumDrained;
+		DequeuePosition.store(Position, std::memory_order_release);
+	}
+
+	if (NumDrained > 0)
+	{
+		for (ILogSink* Sink : Sinks)
+		{
+			Sink->Flush();
+		}
+	}
+
+	return NumDrained;
+}
+
+void FLogger::Dispatch(FLogRecord& InRecord)
+{
+	const char* Message = reinterpret_cast<const char*>(InRecord.Payload);
+	if (InRecord.Kind == FLogRecord::EKind::Deferred)
+	{
+		int Length = InRecord.Formatter(InRecord, FormatBuffer.data(), FormatBuffer.size());
+		if (Length >= static_cast<int>(FormatBuffer.size()))
+		{
+			FormatBuffer.resize(Length + 1);
+			Length = InRecord.Formatter(InRecord, FormatBuffer.data(), FormatBuffer.size());
+		}
+		Message = Length >= 0 ? FormatBuffer.data() : InRecord.Format;
+	}
+	else if (InRecord.Kind == FLogRecord::EKind::Heap)
+	{
+		Message = InRecord.HeapMessage;
+	}
+
+	for (ILogSink* Sink : Sinks)
+	{
+		Sink->Write(InRecord.Type, InRecord.Prefix, Message);
+	}
+
+	if (InRecord.HeapMessage)
+	{
+		delete[] InRecord.HeapMessage;
+		InRecord.HeapMessage = nullptr;
+	}
+}
+
+void FLogger::DispatchSynchronous(FLogRecord& InRecord)
+{
+	std::lock_guard<std::mutex> Lock(SinkMutex);
+	Dispatch(InRecord);
+	for (ILogSink* Sink : Sinks)
+	{
+		Sink->Flush();
+	}
+}
+
+void FLogger::AddSink(ILogSink* InSink)
+{
+	FLogger& Logger = Get();
+	std::lock_guard<std::mutex> Lock(Logger.SinkMutex);
+	if (std::find(Logger.Sinks.begin(), Logger.Sinks.end(), InSink) == Logger.Sinks.end())
+	{
+		Logger.Sinks.push_back(InSink);
+	}
+}
+
+/**
+ * @brief 싱크를 뺀다, 로거 스레드가 보내는 중이면 그 묶음이 끝날 때까지 기다리므로 반환 후 싱크를 해제해도 안전하다
+ */
+void FLogger::RemoveSink(ILogSink* InSink)
+{
+	FLogger& Logger = Get();
+	std::lock_guard<std::mutex> Lock(Logger.SinkMutex);
+	Logger.Sinks.erase(std::remove(Logger.Sinks.begin(), Logger.Sinks.end(), InSink), Logger.Sinks.end());
+}
+
+bool FLogger::OpenLogFile(const FString& InPath)
+{
+	FLogger& Logger = Get();
+	{
+		std::lock_guard<std::mutex> Lock(Logger.SinkMutex);
+		if (!Logger.FileSink.Open(InPath))
+		{
+			return false;
+		}
+	}
+
+	AddSink(&Logger.FileSink);
+	return true;
+}
+
+void FLogger::Flush()
+{
+	FLogger& Logger = Get();
+	if (!Logger.bRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	const uint64 Target = Logger.EnqueuePosition.load(std::memory_order_acquire);
+	while (Logger.DequeuePosition.load(std::memory_order_acquire) < Target)
+	{
+		Logger.Wake();
+		std::this_thread::yield();
+	}
+}
+
+void FLogger::Shutdown()
+{
+	FLogger& Logger = Get();
+	if (!Logger.bRunning.exchange(false))
+	{
+		return;
+	}
+
+	Logger.Wake();
+	if (Logger.Thread.joinable())
+	{
+		Logger.Thread.join();
+	}
+
+	// 종료 직전에 들어온 로그까지 비운다
+	Logger.DrainQueue();
+}
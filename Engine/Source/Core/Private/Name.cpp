@@ -2,23 +2,77 @@
 #include "Core/Public/Name.h"
 #include <algorithm> // for std::transform
 #include <cctype>    // for std::tolower
+#include <shared_mutex>
 
 // '최초 사용 시 생성(Construct on First Use)' 기법을 적용하기 위한 헬퍼 함수들입니다.
 // 익명 네임스페이스를 사용하여 이 파일 외부에서는 접근할 수 없도록 합니다.
 namespace
 {
+	/**
+	 * @brief 표시 이름 저장소
+	 * ToString이 돌려준 참조가 다른 스레드의 새 이름 추가로 무효화되지 않도록 고정 크기 블록에 나눠 담는다
+	 * 블록 포인터 배열은 움직이지 않으므로 읽기는 잠그지 않는다 (애셋 로딩 작업 스레드에서도 FName을 만든다)
+	 */
+	class FDisplayNameBlocks
+	{
+	public:
+		static constexpr uint32 BLOCK_SIZE = 4096;
+		static constexpr uint32 MAX_BLOCKS = 4096;
+		static constexpr uint32 MAX_NAMES = BLOCK_SIZE * MAX_BLOCKS;
+
+		FString& operator[](uint32 InIndex)
+		{
+			assert(InIndex < MAX_NAMES && Blocks[InIndex / BLOCK_SIZE]);
+			return Blocks[InIndex / BLOCK_SIZE][InIndex % BLOCK_SIZE];
+		}
+
+		// NameMutex를 쥔 상태에서만 부른다
+		// 블록 배열은 늘릴 수 없으므로 상한을 넘으면 이후 이름이 모두 깨진다, 조용히 넘어가지 않고 바로 종료한다
+		void Add(uint32 InIndex, const FString& InString)
+		{
+			if (InIndex >= MAX_NAMES)
+			{
+				fprintf(stderr, "FName table is full (%u names), cannot add '%s'\n", MAX_NAMES, InString.c_str());
+				assert(!u8"FName 표시 이름 저장소 상한 초과");
+				std::abort();
+			}
+
+			std::unique_ptr<FString[]>& Block = Blocks[InIndex / BLOCK_SIZE];
+			if (!Block)
+			{
+				Block = std::make_unique<FString[]>(BLOCK_SIZE);
+			}
+			Block[InIndex % BLOCK_SIZE] = InString;
+		}
+
+	private:
+		TStaticArray<std::unique_ptr<FString[]>, MAX_BLOCKS> Blocks;
+	};
+
+	// NameMap과 DisplayNames 추가를 보호한다
+	std::shared_mutex& GetNameMutex()
+	{
+		static std::shared_mutex NameMutex;
+		return NameMutex;
+	}
+
 	// DisplayNames 배열에 대한 접근자
-	TArray<FString>& GetDisplayNames()
+	FDisplayNameBlocks& GetDisplayNames()
 	{
 		// 이 함수가 최초로 호출될 때 단 한 번만 안전하게 초기화됩니다.
-		static TArray<FString> DisplayNames = { "None" };
+		static FDisplayNameBlocks DisplayNames = []
+		{
+			FDisplayNameBlocks Names;
+			Names.Add(0, "None");
+			return Names;
+		}();
 		return DisplayNames;
 	}
 
 	// NameMap에 대한 접근자
-	TMap<FString, uint32>& GetNameMap()
+	TFlatMap<FString, uint32>& GetNameMap()
 	{
-		static TMap<FString, uint32> NameMap = { {"none", 0} };
+		static TFlatMap<FString, uint32> NameMap = { {"none", 0} };
 		return NameMap;
 	}
 
@@ -52,15 +106,26 @@ FName::FName(const FString& InString)
 
 	// 헬퍼 함수를 통해 안전하게 NameMap에 접근합니다.
 	auto& NameMapRef = GetNameMap();
-	auto FindResult = NameMapRef.find(LowerString);
+	{
+		std::shared_lock<std::shared_mutex> ReadLock(GetNameMutex());
+		auto FindResult = NameMapRef.find(LowerString);
+		if (FindResult != NameMapRef.end())
+		{
+			ComparisonIndex = FindResult->second;
+			DisplayIndex = ComparisonIndex;
+			return;
+		}
+	}
 
-	// 동일 이름이 존재하지 않는 경우
+	// 동일 이름이 존재하지 않는 경우 (잠금을 바꾸는 사이 다른 스레드가 넣었을 수 있으므로 다시 찾는다)
+	std::unique_lock<std::shared_mutex> WriteLock(GetNameMutex());
+	auto FindResult = NameMapRef.find(LowerString);
 	if (FindResult == NameMapRef.end())
 	{
 		// 헬퍼 함수를 통해 안전하게 정적 데이터들을 수정합니다.
 		auto& NextIndexRef = GetNextIndex();
 		NameMapRef.insert({ LowerString, NextIndexRef });
-		GetDisplayNames().push_back(InString);
+		GetDisplayNames().Add(NextIndexRef, InString);
 
 		// 인덱스 제공
 		ComparisonIndex = NextIndexRef++;
@@ -55,12 +55,15 @@ UObject* UObject::Duplicate(FObjectDuplicationParameters Parameters)
 	/** @note 이미 오브젝트가 존재할 경우 복제하지 않음 */
 	if (auto It = Parameters.DuplicationSeed.find(Parameters.SourceObject); It != Parameters.DuplicationSeed.end())
 	{
+		/** @note 시드로 미리 넣어 둔 오브젝트는 값만 채워넣는다 */
+		It->second->CopyPropertiesFrom(Parameters.SourceObject);
 		return It->second;
 	}
 
 	UObject* DupObject = Parameters.DestClass->CreateDefaultObject();
 
 	DupObject->SetOuter(Parameters.DestOuter);
+	DupObject->CopyPropertiesFrom(Parameters.SourceObject);
 
 	/** @note 새로운 오브젝트가 생성되었을 경우 맵을 업데이트 해준다. */
 	Parameters.DuplicationSeed.emplace(Parameters.SourceObject, DupObject);
@@ -1,5 +1,41 @@
 ﻿#include "pch.h"
 #include "Core/Public/PlatformTime.h"
 
+#include <mutex>
+
 double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
-bool   FWindowsPlatformTime::bInitialized = false;
+std::atomic<bool> FWindowsPlatformTime::bInitialized = false;
+
+namespace
+{
+	// TSC 보정 구간, 기준 시계 해상도(1us 이하)에 비해 충분히 길어 오차가 0.1% 아래로 내려간다
+	constexpr double TSC_CALIBRATION_SECONDS = 0.005;
+}
+
+void FWindowsPlatformTime::InitTiming()
+{
+	static std::once_flag InitFlag;
+	std::call_once(InitFlag, []
+	{
+		const double ReferenceSecondsPerCycle = 1.0 / static_cast<double>(std::max<uint64>(GetFrequency(), 1));
+
+#if GTL_PLATFORM_TIME_USE_TSC
+		// 기준 시계를 읽는 사이에 TSC를 끼워 읽어 두 시계의 같은 구간을 잰다
+		const uint64 ReferenceStart = ReferenceCycles64();
+		const uint64 TscStart = Cycles64();
+		const uint64 ReferenceWait = static_cast<uint64>(TSC_CALIBRATION_SECONDS / ReferenceSecondsPerCycle);
+		uint64 ReferenceEnd = ReferenceStart;
+		while (ReferenceEnd - ReferenceStart < ReferenceWait)
+		{
+			ReferenceEnd = ReferenceCycles64();
+		}
+		const uint64 TscEnd = Cycles64();
+
+		const double ElapsedSeconds = static_cast<double>(ReferenceEnd - ReferenceStart) * ReferenceSecondsPerCycle;
+		GSecondsPerCycle = TscEnd > TscStart ? ElapsedSeconds / static_cast<double>(TscEnd - TscStart) : ReferenceSecondsPerCycle;
+#else
+		GSecondsPerCycle = ReferenceSecondsPerCycle;
+#endif
+		bInitialized.store(true, std::memory_order_release);
+	});
+}
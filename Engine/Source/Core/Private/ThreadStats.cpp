@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "Core/Public/ThreadStats.h"
+
+FStatDescriptor FStatRegistry::Descriptors[FStatRegistry::MAX_STATS];
+std::atomic<uint32> FStatRegistry::NumStats{ 0 };
+std::mutex FStatRegistry::RegisterMutex;
+
+std::atomic<bool> FThreadStats::bEnabled{ true };
+std::mutex FThreadStats::BufferMutex;
+TArray<std::unique_ptr<FThreadStatBuffer>> FThreadStats::Buffers;
+
+TStatId FStatRegistry::Register(const char* InName, const char* InGroup)
+{
+	std::lock_guard<std::mutex> Lock(RegisterMutex);
+
+	const uint32 Count = NumStats.load(std::memory_order_relaxed);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		if (strcmp(Descriptors[Index].Name, InName) == 0)
+		{
+			return TStatId{ Index };
+		}
+	}
+
+	if (Count >= MAX_STATS)
+	{
+		UE_LOG_WARNING("Stats: 스탯 개수가 최대치(%u)를 넘어 기록하지 않습니다: %s", MAX_STATS, InName);
+		return TStatId{};
+	}
+
+	Descriptors[Count].Name = InName;
+	Descriptors[Count].Group = InGroup;
+	NumStats.store(Count + 1, std::memory_order_release);
+
+	return TStatId{ Count };
+}
+
+FThreadStatBuffer::FThreadStatBuffer(uint32 InThreadIndex)
+	: Events(std::make_unique<FStatEvent[]>(CAPACITY))
+	, ThreadIndex(InThreadIndex)
+	, Name("Thread " + std::to_string(InThreadIndex))
+{
+}
+
+uint32 FThreadStatBuffer::Drain(TArray<FStatEvent>& OutEvents)
+{
+	const uint64 Read = ReadIndex.load(std::memory_order_relaxed);
+	const uint64 Write = WriteIndex.load(std::memory_order_acquire);
+
+	for (uint64 Index = Read; Index < Write; ++Index)
+	{
+		OutEvents.push_back(Events[Index & (CAPACITY - 1)]);
+	}
+
+	ReadIndex.store(Write, std::memory_order_release);
+	return static_cast<uint32>(Write - Read);
+}
+
+void FThreadStats::SetThreadName(const FString& InName)
+{
+	FThreadStatBuffer& Buffer = GetThreadBuffer();
+
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+	Buffer.Name = InName;
+}
+
+FString FThreadStats::GetThreadName(const FThreadStatBuffer& InBuffer)
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+	return InBuffer.Name;
+}
+
+void FThreadStats::GetThreadBuffers(TArray<FThreadStatBuffer*>& OutBuffers)
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+
+	OutBuffers.clear();
+	for (const auto& Buffer : Buffers)
+	{
+		OutBuffers.push_back(Buffer.get());
+	}
+}
+
+FThreadStatBuffer* FThreadStats::CreateThreadBuffer()
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+
+	Buffers.push_back(std::make_unique<FThreadStatBuffer>(static_cast<uint32>(Buffers.size())));
+	return Buffers.back().get();
+}
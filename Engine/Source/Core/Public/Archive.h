@@ -5,6 +5,19 @@
 #include "Global/CoreTypes.h"
 #include "Global/Vector.h"
 
+/**
+ * @brief 원소별 직렬화 결과가 메모리 그대로와 같아 배열을 한 번에 읽고 쓸 수 있는 타입
+ * FVector 류는 float 성분만 순서대로 쓰므로 패딩이 없을 때만 포함한다
+ */
+template<typename T>
+struct TIsBulkSerializable : std::bool_constant<std::is_arithmetic_v<T>> {};
+
+template<>
+struct TIsBulkSerializable<FVector> : std::bool_constant<sizeof(FVector) == sizeof(float) * 3> {};
+
+template<>
+struct TIsBulkSerializable<FVector2> : std::bool_constant<sizeof(FVector2) == sizeof(float) * 2> {};
+
 struct FArchive
 {
 	virtual ~FArchive() = default;
@@ -43,9 +56,20 @@ struct FArchive
 			Value.resize(Length);
 		}
 
-		for (T& Element : Value)
+		// 원소마다 Serialize를 부르면 큰 메시의 인덱스/정점 배열에서 호출 수만 수백만 번이 된다
+		if constexpr (TIsBulkSerializable<T>::value)
+		{
+			if (Length > 0)
+			{
+				Serialize(Value.data(), Length * sizeof(T));
+			}
+		}
+		else
 		{
-			*this << Element;
+			for (T& Element : Value)
+			{
+				*this << Element;
+			}
 		}
 
 		return *this;
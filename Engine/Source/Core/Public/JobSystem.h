@@ -0,0 +1,211 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief 잡 하나 (함수 객체를 슬롯 안에 직접 담는다)
+ * 스레드별 링에서 재사용되므로 생성/실행에 힙 할당이 없다
+ */
+struct alignas(64) FJob
+{
+	static constexpr uint32 DATA_SIZE = 64;
+	static constexpr uint32 MAX_CONTINUATIONS = 8;
+
+	void (*Function)(void* InData) = nullptr;
+	FJob* Parent = nullptr;
+
+	// 자기 자신 + 아직 끝나지 않은 자식 수, 0이 되면 완료
+	std::atomic<int32> UnfinishedJobs{ 0 };
+	// Run 호출 1 + 끝나지 않은 선행 잡 수, 0이 되면 큐에 들어간다
+	std::atomic<int32> PendingDependencies{ 0 };
+	std::atomic<int32> NumContinuations{ 0 };
+	FJob* Continuations[MAX_CONTINUATIONS] = {};
+
+	alignas(16) uint8 Data[DATA_SIZE];
+};
+
+/**
+ * @brief 잡 핸들 (FJob 포인터, 복사해도 할당이 없다)
+ * 잡 슬롯은 스레드마다 MAX_JOBS_PER_THREAD개를 돌려 쓰므로 그 이상 앞선 핸들을 들고 있으면 안 된다
+ */
+struct FJobHandle
+{
+	FJob* Job = nullptr;
+
+	bool IsValid() const { return Job != nullptr; }
+};
+
+/**
+ * @brief 소유 스레드는 Bottom에서 넣고 빼고, 다른 워커는 Top에서 훔쳐 가는 고정 크기 Chase-Lev 덱
+ */
+class FJobDeque
+{
+public:
+	static constexpr int64 CAPACITY = 1 << 12;
+
+	/** 소유 스레드 전용, 가득 차면 false */
+	bool Push(FJob* InJob);
+	/** 소유 스레드 전용, 가장 최근에 넣은 잡 */
+	FJob* Pop();
+	/** 아무 스레드, 가장 오래된 잡 */
+	FJob* Steal();
+
+private:
+	alignas(64) std::atomic<int64> Top{ 0 };
+	alignas(64) std::atomic<int64> Bottom{ 0 };
+	std::atomic<FJob*> Jobs[CAPACITY] = {};
+};
+
+/**
+ * @brief 워크 스틸링 잡 시스템
+ *
+ * 워커마다 덱을 하나씩 가지고, 자기 덱이 비면 다른 워커의 덱에서 잡을 훔친다
+ * 처음 사용하는 스레드(메인 스레드)도 0번 덱을 가지며 Wait 중에는 잡을 대신 실행한다
+ * 그 밖의 외부 스레드가 넣은 잡은 공유 큐를 거친다
+ *
+ * 사용 예시:
+ *   FJobHandle A = FJobSystem::CreateJob([&] { ... });
+ *   FJobHandle B = FJobSystem::CreateJob([&] { ... });
+ *   FJobSystem::AddDependency(B, A);	// A가 끝난 뒤 B 실행 (A를 Run하기 전에 연결)
+ *   FJobSystem::Run(A);
+ *   FJobSystem::Run(B);
+ *   FJobSystem::Wait(B);
+ *
+ *   FJobSystem::ParallelFor(Count, [&](uint32 Begin, uint32 End) { ... }, 64);
+ */
+class FJobSystem
+{
+public:
+	static constexpr uint32 MAX_JOBS_PER_THREAD = 1 << 12;
+
+	template<typename FunctionType>
+	static FJobHandle CreateJob(FunctionType&& InFunction, FJobHandle InParent = {})
+	{
+		using FStored = std::decay_t<FunctionType>;
+		static_assert(sizeof(FStored) <= FJob::DATA_SIZE, "Job capture is too large, capture by reference instead");
+		static_assert(alignof(FStored) <= 16, "Job capture alignment is too large");
+
+		FJob* Job = AllocateJob(InParent.Job);
+		new (Job->Data) FStored(std::forward<FunctionType>(InFunction));
+		Job->Function = [](void* InData)
+		{
+			FStored& Stored = *std::launder(reinterpret_cast<FStored*>(InData));
+			Stored();
+			Stored.~FStored();
+		};
+		return FJobHandle{ Job };
+	}
+
+	/** InJob은 InPrerequisite가 끝난 뒤 실행된다, InPrerequisite를 Run하기 전에 호출해야 한다 */
+	static void AddDependency(FJobHandle InJob, FJobHandle InPrerequisite);
+
+	static void Run(FJobHandle InJob);
+
+	/** 잡(과 자식)이 끝날 때까지 다른 잡을 실행하며 기다린다 */
+	static void Wait(FJobHandle InJob);
+
+	static bool IsComplete(FJobHandle InJob)
+	{
+		return !InJob.IsValid() || InJob.Job->UnfinishedJobs.load(std::memory_order_acquire) == 0;
+	}
+
+	/**
+	 * @brief [0, InCount)를 범위 단위로 나눠 병렬 실행하고 끝날 때까지 기다린다
+	 * 범위를 반으로 나눠 뒤쪽 절반을 훔쳐 갈 수 있게 내놓고 앞쪽을 계속 나누는 방식이라 일이 몰린 구간도 고르게 퍼진다
+	 * 분할 단위는 항목 수와 스레드 수로 정하되 InMinBatchSize보다 작아지지 않는다
+	 * @param InBody void(uint32 Begin, uint32 End)
+	 */
+	template<typename BodyType>
+	static void ParallelFor(uint32 InCount, BodyType&& InBody, uint32 InMinBatchSize = 1)
+	{
+		if (InCount == 0)
+		{
+			return;
+		}
+
+		// 스레드당 8조각 정도가 나오도록 하되 너무 잘게 쪼개지 않는다
+		const uint32 NumThreads = GetNumThreads();
+		const uint32 BatchSize = std::max(std::max(InMinBatchSize, 1u), InCount / (NumThreads * 8));
+		if (NumThreads <= 1 || InCount <= BatchSize)
+		{
+			InBody(0u, InCount);
+			return;
+		}
+
+		using FBody = std::remove_reference_t<BodyType>;
+		const FParallelForContext<FBody> Context{ &InBody, BatchSize };
+
+		FJobHandle Root = CreateJob([] {});
+		ProcessRange(Root, &Context, 0, InCount);
+		Run(Root);
+		Wait(Root);
+	}
+
+	/** 호출 스레드를 포함한 실행 스레드 수 */
+	static uint32 GetNumThreads();
+
+	/** 워커 스레드를 멈춘다 (프로세스 종료 시 자동 호출) */
+	static void Shutdown();
+
+private:
+	template<typename BodyType>
+	struct FParallelForContext
+	{
+		BodyType* Body;
+		uint32 BatchSize;
+	};
+
+	template<typename BodyType>
+	static void ProcessRange(FJobHandle InRoot, const FParallelForContext<BodyType>* InContext, uint32 InBegin, uint32 InEnd)
+	{
+		while (InEnd - InBegin > InContext->BatchSize)
+		{
+			const uint32 Middle = InBegin + (InEnd - InBegin) / 2;
+			FJobHandle Child = CreateJob([InRoot, InContext, Middle, InEnd]
+			{
+				ProcessRange(InRoot, InContext, Middle, InEnd);
+			}, InRoot);
+			Run(Child);
+			InEnd = Middle;
+		}
+
+		(*InContext->Body)(InBegin, InEnd);
+	}
+
+	FJobSystem();
+
+	static FJobSystem& Get();
+	static FJob* AllocateJob(FJob* InParent);
+
+	void Submit(FJob* InJob);
+	FJob* FindJob(int32 InQueueIndex);
+	void Execute(FJob* InJob);
+	void Finish(FJob* InJob);
+	void WorkerMain(int32 InQueueIndex);
+
+	int32 GetQueueIndex() const;
+
+	uint32 NumQueues = 0;
+	FJobDeque* Queues = nullptr;
+	TArray<std::thread> Workers;
+	std::thread::id MainThreadId;
+
+	// 워커가 아닌 외부 스레드가 넣은 잡
+	std::mutex SharedQueueMutex;
+	TArray<FJob*> SharedQueue;
+	std::atomic<uint32> NumSharedJobs{ 0 };
+
+	std::atomic<int32> NumQueuedJobs{ 0 };
+	std::atomic<int32> NumSleepingWorkers{ 0 };
+	std::atomic<bool> bShutdown{ false };
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+
+	// 스레드별 잡 슬롯 링 (스레드가 끝나도 남아 있던 핸들이 댕글링되지 않도록 여기서 소유한다)
+	std::mutex JobPoolMutex;
+	TArray<std::unique_ptr<FJob[]>> JobPools;
+};
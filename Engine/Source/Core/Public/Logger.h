@@ -0,0 +1,281 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @brief 로거 출력 대상 (표준 출력 / 파일 / 콘솔 위젯)
+ * Write는 로거 스레드에서만 호출되므로 싱크 내부에서는 UE_LOG를 쓰지 않는다
+ */
+class ILogSink
+{
+public:
+	virtual ~ILogSink() = default;
+
+	/**
+	 * @param InPrefix 표준 출력용 접두사 ("[INFO] " 등, UE_LOG는 빈 문자열)
+	 */
+	virtual void Write(ELogType InType, const char* InPrefix, const char* InMessage) = 0;
+	virtual void Flush() {}
+};
+
+class FStdoutLogSink : public ILogSink
+{
+public:
+	void Write(ELogType InType, const char* InPrefix, const char* InMessage) override;
+	void Flush() override;
+};
+
+class FFileLogSink : public ILogSink
+{
+public:
+	bool Open(const FString& InPath);
+	void Write(ELogType InType, const char* InPrefix, const char* InMessage) override;
+	void Flush() override;
+
+private:
+	std::ofstream File;
+};
+
+/**
+ * @brief 큐 슬롯 하나에 담기는 로그 (서식 문자열 포인터 + 인자 바이트)
+ * 숫자/포인터 인자는 값 그대로, 문자열 인자는 Payload 뒤쪽에 복사해 두고 로거 스레드에서 서식화한다
+ */
+struct FLogRecord
+{
+	static constexpr uint32 PAYLOAD_SIZE = 224;
+
+	enum class EKind : uint8
+	{
+		Deferred,	// Formatter로 Payload의 인자를 풀어 서식화
+		Inline,		// 호출 스레드에서 서식화한 문자열이 Payload에 있다
+		Heap		// 호출 스레드에서 서식화한 긴 문자열 (HeapMessage, 로거 스레드가 해제)
+	};
+
+	using FFormatter = int(*)(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize);
+
+	const char* Format = nullptr;
+	const char* Prefix = "";
+	FFormatter Formatter = nullptr;
+	char* HeapMessage = nullptr;
+	ELogType Type = ELogType::Info;
+	EKind Kind = EKind::Inline;
+	alignas(16) uint8 Payload[PAYLOAD_SIZE];
+};
+
+namespace LogDetail
+{
+	template<typename T>
+	constexpr bool IsString = std::is_same_v<T, const char*> || std::is_same_v<T, char*>;
+
+	// 값으로 저장해도 로거 스레드에서 같은 결과가 나오는 인자만 미룬다 (wchar_t 문자열은 댕글링 위험이 있어 즉시 서식화)
+	template<typename T>
+	constexpr bool IsDeferrable = IsString<T> || std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+		(std::is_pointer_v<T> && !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, wchar_t>);
+
+	template<typename T>
+	using TStored = std::conditional_t<IsString<T>, uint32, T>;
+
+	template<typename... ArgTypes>
+	using TStoredTuple = std::tuple<TStored<ArgTypes>...>;
+
+	template<typename T>
+	TStored<T> EncodeArgument(T InArgument, uint8* InPayload, uint32& InOutOffset, bool& bOutFits)
+	{
+		if constexpr (IsString<T>)
+		{
+			const char* String = InArgument ? InArgument : "(null)";
+			const uint32 Length = static_cast<uint32>(strlen(String)) + 1;
+			if (!bOutFits || InOutOffset + Length > FLogRecord::PAYLOAD_SIZE)
+			{
+				bOutFits = false;
+				return 0;
+			}
+
+			const uint32 Offset = InOutOffset;
+			memcpy(InPayload + Offset, String, Length);
+			InOutOffset += Length;
+			return Offset;
+		}
+		else
+		{
+			return InArgument;
+		}
+	}
+
+	template<typename T>
+	auto DecodeArgument(const TStored<T>& InStored, const uint8* InPayload)
+	{
+		if constexpr (IsString<T>)
+		{
+			return reinterpret_cast<const char*>(InPayload + InStored);
+		}
+		else
+		{
+			return InStored;
+		}
+	}
+
+	template<typename... ArgTypes, size_t... Indices>
+	int FormatDeferred(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize, std::index_sequence<Indices...>)
+	{
+		const auto& Stored = *std::launder(reinterpret_cast<const TStoredTuple<ArgTypes...>*>(InRecord.Payload));
+		return snprintf(OutBuffer, InBufferSize, InRecord.Format, DecodeArgument<ArgTypes>(std::get<Indices>(Stored), InRecord.Payload)...);
+	}
+
+	template<typename... ArgTypes>
+	int FormatDeferred(const FLogRecord& InRecord, char* OutBuffer, size_t InBufferSize)
+	{
+		return FormatDeferred<ArgTypes...>(InRecord, OutBuffer, InBufferSize, std::index_sequence_for<ArgTypes...>{});
+	}
+}
+
+/**
+ * @brief UE_LOG 계열 매크로가 사용하는 비동기 로거
+ *
+ * 호출 스레드는 고정 크기 링 버퍼(다중 생산자 / 단일 소비자, 슬롯별 시퀀스 번호)의 슬롯 하나를 CAS로 잡아
+ * 서식 문자열 포인터와 인자만 복사하고 돌아간다. 서식화와 출력은 백그라운드 로거 스레드가 맡아
+ * 등록된 싱크(표준 출력 / 파일 / 콘솔)로 보낸다
+ * 큐가 가득 차면 로그를 버리지 않고 빈 슬롯이 생길 때까지 양보하며 기다린다
+ */
+class FLogger
+{
+public:
+	static constexpr uint32 QUEUE_CAPACITY = 1 << 13;
+
+	template<typename... ArgTypes>
+	static void Log(ELogType InType, const char* InPrefix, const char* InFormat, ArgTypes&&... InArguments)
+	{
+		FLogger& Logger = Get();
+		if (!Logger.bRunning.load(std::memory_order_acquire))
+		{
+			Logger.WriteSynchronous(InType, InPrefix, InFormat, std::forward<ArgTypes>(InArguments)...);
+			return;
+		}
+
+		const uint64 Position = Logger.AcquireSlot();
+		FLogRecord& Record = Logger.Slots[Position & (QUEUE_CAPACITY - 1)].Record;
+		Record.Format = InFormat;
+		Record.Prefix = InPrefix;
+		Record.Type = InType;
+		Record.HeapMessage = nullptr;
+
+		bool bDeferred = false;
+		if constexpr ((LogDetail::IsDeferrable<std::decay_t<ArgTypes>> && ...))
+		{
+			bDeferred = EncodeDeferred<std::decay_t<ArgTypes>...>(Record, InArguments...);
+		}
+
+		if (!bDeferred)
+		{
+			FormatImmediate(Record, InFormat, std::forward<ArgTypes>(InArguments)...);
+		}
+
+		Logger.PublishSlot(Position);
+	}
+
+	static void AddSink(ILogSink* InSink);
+	static void RemoveSink(ILogSink* InSink);
+
+	/** 로그 파일을 열어 파일 싱크를 등록한다 (디렉터리가 없으면 만든다) */
+	static bool OpenLogFile(const FString& InPath);
+
+	/** 지금까지 넣은 로그가 모든 싱크로 나갈 때까지 기다린다 */
+	static void Flush();
+
+	/** 로거 스레드를 멈추고 남은 로그를 모두 출력한다, 이후 로그는 호출 스레드에서 바로 출력된다 */
+	static void Shutdown();
+
+private:
+	struct alignas(64) FSlot
+	{
+		std::atomic<uint64> Sequence{ 0 };
+		FLogRecord Record;
+	};
+
+	FLogger();
+
+	static FLogger& Get();
+
+	template<typename... ArgTypes, typename... ForwardTypes>
+	static bool EncodeDeferred(FLogRecord& InRecord, ForwardTypes&... InArguments)
+	{
+		using FTuple = LogDetail::TStoredTuple<ArgTypes...>;
+		static_assert(sizeof(FTuple) <= FLogRecord::PAYLOAD_SIZE, "Too many log arguments");
+
+		// 인자가 없는 로그에서는 문자열 인코딩이 없어 Offset을 쓰지 않는다
+		[[maybe_unused]] uint32 Offset = sizeof(FTuple);
+		bool bFits = true;
+
+		// 중괄호 초기화는 왼쪽부터 평가되므로 문자열이 인자 순서대로 쌓인다
+		new (InRecord.Payload) FTuple{ LogDetail::EncodeArgument<ArgTypes>(InArguments, InRecord.Payload, Offset, bFits)... };
+		if (!bFits)
+		{
+			return false;
+		}
+
+		InRecord.Kind = FLogRecord::EKind::Deferred;
+		InRecord.Formatter = &LogDetail::FormatDeferred<ArgTypes...>;
+		return true;
+	}
+
+	template<typename... ArgTypes>
+	static void FormatImmediate(FLogRecord& InRecord, const char* InFormat, ArgTypes&&... InArguments)
+	{
+		char* Buffer = reinterpret_cast<char*>(InRecord.Payload);
+		const int Length = snprintf(Buffer, FLogRecord::PAYLOAD_SIZE, InFormat, std::forward<ArgTypes>(InArguments)...);
+		if (Length < static_cast<int>(FLogRecord::PAYLOAD_SIZE))
+		{
+			InRecord.Kind = FLogRecord::EKind::Inline;
+			return;
+		}
+
+		InRecord.HeapMessage = new char[Length + 1];
+		snprintf(InRecord.HeapMessage, Length + 1, InFormat, std::forward<ArgTypes>(InArguments)...);
+		InRecord.Kind = FLogRecord::EKind::Heap;
+	}
+
+	template<typename... ArgTypes>
+	void WriteSynchronous(ELogType InType, const char* InPrefix, const char* InFormat, ArgTypes&&... InArguments)
+	{
+		FLogRecord Record;
+		Record.Format = InFormat;
+		Record.Prefix = InPrefix;
+		Record.Type = InType;
+		FormatImmediate(Record, InFormat, std::forward<ArgTypes>(InArguments)...);
+		DispatchSynchronous(Record);
+	}
+
+	uint64 AcquireSlot();
+	void PublishSlot(uint64 InPosition);
+
+	void ThreadMain();
+	uint32 DrainQueue();
+	void Wake();
+	void Dispatch(FLogRecord& InRecord);
+	void DispatchSynchronous(FLogRecord& InRecord);
+
+	FSlot* Slots = nullptr;
+	alignas(64) std::atomic<uint64> EnqueuePosition{ 0 };
+	alignas(64) std::atomic<uint64> DequeuePosition{ 0 };
+
+	std::atomic<bool> bRunning{ false };
+	std::atomic<bool> bWaiting{ false };
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+	std::thread Thread;
+
+	std::mutex SinkMutex;
+	TArray<ILogSink*> Sinks;
+	FStdoutLogSink StdoutSink;
+	FFileLogSink FileSink;
+
+	// 로거 스레드 전용 서식화 버퍼
+	TArray<char> FormatBuffer;
+};
@@ -41,6 +41,12 @@ public:
 	/** @brief UObject 계층을 타고 재귀적으로 UObject에서 상속 받는 클래스를 복제한다. */
 	virtual UObject* Duplicate(FObjectDuplicationParameters Parameters);
 
+	/**
+	 * @brief 다른 오브젝트를 가리키지 않는 프로퍼티 값만 InSource에서 복사한다 (같은 클래스끼리만 호출)
+	 * Duplicate와 FWorldCloner가 함께 쓰며, 오브젝트 참조는 각 호출자가 자신의 방식으로 옮긴다
+	 */
+	virtual void CopyPropertiesFrom(const UObject* InSource) {}
+
 	/** @deprecated 아무런 작업을 수행하지 않는다. 발제 내용과의 호환을 위해 남겨둠. */
 	[[deprecated]] virtual void DuplicateSubObjects(FObjectDuplicationParameters Parameters);
 
@@ -63,6 +69,8 @@ public:
 	uint64 GetAllocatedBytes() const { return AllocatedBytes; }
 	uint32 GetAllocatedCount() const { return AllocatedCounts; }
 	uint32 GetUUID() const { return UUID; }
+	/** GUObjectArray에서의 인덱스, 오브젝트마다 고유하고 재사용되지 않는다 */
+	uint32 GetInternalIndex() const { return InternalIndex; }
 
 	void SetName(const FName& InName) { Name = InName; }
 	void SetOuter(UObject* InObject);
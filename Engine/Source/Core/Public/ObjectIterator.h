@@ -160,7 +160,7 @@ private:
 	}
 
 	/** 정적 멤버 변수 */
-	static TMap<uint32, TArray<UObject*>> ObjectCache;
+	static TFlatMap<uint32, TArray<UObject*>> ObjectCache;
 	static bool bCacheValid;
 	static int32 LastProcessedIndex; // 마지막으로 처리된 ObjectArray 인덱스
 };
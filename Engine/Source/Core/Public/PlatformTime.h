@@ -1,39 +1,52 @@
 ﻿#pragma once
 
+#include <atomic>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define GTL_PLATFORM_TIME_USE_TSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define GTL_PLATFORM_TIME_USE_TSC 0
+#endif
+
+/**
+ * @brief 사이클 타임스탬프
+ * x64에서는 Cycles64가 TSC(__rdtsc)를 그대로 읽는다, 스코프 하나에 두 번 읽으므로 QPC/steady_clock 호출 비용을 줄인다
+ * TSC 주파수는 OS가 알려 주지 않으므로 InitTiming에서 한 번 기준 시계와 비교해 재고, 변환은 ToMilliseconds(집계 시점)에서만 한다
+ * (invariant TSC를 가정한다, 그 밖의 아키텍처는 기준 시계를 그대로 쓴다)
+ */
 class FWindowsPlatformTime
 {
 public:
 	static double GSecondsPerCycle; // 0
-	static bool bInitialized; // false
-
-	static void InitTiming()
-	{
-		if (!bInitialized)
-		{
-			bInitialized = true;
+	static std::atomic<bool> bInitialized; // false
 
-			double Frequency = (double)GetFrequency();
-			if (Frequency <= 0.0)
-			{
-				Frequency = 1.0;
-			}
+	/** 여러 스레드에서 동시에 불러도 보정은 한 번만 한다 */
+	static void InitTiming();
 
-			GSecondsPerCycle = 1.0 / Frequency;
-		}
-	}
 	static float GetSecondsPerCycle()
 	{
-		if (!bInitialized)
+		if (!bInitialized.load(std::memory_order_acquire))
 		{
 			InitTiming();
 		}
 		return (float)GSecondsPerCycle;
 	}
+	/** 기준 시계(QPC, 헤드리스는 steady_clock 나노초)의 주파수 */
 	static uint64 GetFrequency()
 	{
+#ifdef GTL_HEADLESS
+		// 헤드리스 빌드는 steady_clock 나노초를 사이클로 사용한다
+		return 1000000000ull;
+#else
 		LARGE_INTEGER Frequency;
 		QueryPerformanceFrequency(&Frequency);
 		return Frequency.QuadPart;
+#endif
 	}
 	static double ToMilliseconds(uint64 CycleDiff)
 	{
@@ -44,10 +57,25 @@ public:
 		return Ms;
 	}
 
-	static uint64 Cycles64()
+	static FORCEINLINE uint64 Cycles64()
+	{
+#if GTL_PLATFORM_TIME_USE_TSC
+		return __rdtsc();
+#else
+		return ReferenceCycles64();
+#endif
+	}
+
+	/** 기준 시계 값 (TSC 보정용) */
+	static uint64 ReferenceCycles64()
 	{
+#ifdef GTL_HEADLESS
+		return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
 		LARGE_INTEGER CycleCount;
 		QueryPerformanceCounter(&CycleCount);
 		return (uint64)CycleCount.QuadPart;
+#endif
 	}
 };
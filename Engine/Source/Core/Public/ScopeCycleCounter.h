@@ -1,12 +1,14 @@
 ﻿#pragma once
 #include "Core/Public/PlatformTime.h"
-
-struct TStatId
-{
-};
+#include "Core/Public/ThreadStats.h"
 
 typedef FWindowsPlatformTime FPlatformTime;
 
+/**
+ * @brief 스코프 시간 측정기
+ * 유효한 TStatId로 만들면 끝날 때 현재 스레드의 이벤트 버퍼에 기록되어 UProfilerManager가 프레임별로 집계한다
+ * TStatId 없이 만들면 기존처럼 Finish()가 걸린 시간(ms)만 돌려준다
+ */
 class FScopeCycleCounter
 {
 public:
@@ -17,27 +19,68 @@ public:
 	}
 
 	FScopeCycleCounter(TStatId StatId)
-		: StartCycles(FPlatformTime::Cycles64())
-		, UsedStatId(StatId)
+		: UsedStatId(StatId)
 	{
+		if (StatId.IsValid() && FThreadStats::IsEnabled())
+		{
+			ThreadBuffer = &FThreadStats::GetThreadBuffer();
+			Depth = ThreadBuffer->Depth++;
+		}
+		StartCycles = FPlatformTime::Cycles64();
 	}
 
 	~FScopeCycleCounter()
 	{
-		Finish();
+		// 이벤트에는 사이클만 남기고 ms 변환은 집계할 때 한다
+		Record(FPlatformTime::Cycles64());
 	}
 
+	/** 두 번 이상 불러도 이벤트는 한 번만 기록된다 */
 	double Finish()
 	{
 		const uint64 EndCycles = FPlatformTime::Cycles64();
-		const uint64 CycleDiff = EndCycles - StartCycles;
-
-		// FThreadStats::AddMessage(UsedStatId, EStatOperation::Add, CycleDiff);
-
-		return FPlatformTime::ToMilliseconds(CycleDiff); // ms 변환 후 리턴
+		Record(EndCycles);
+		return FPlatformTime::ToMilliseconds(EndCycles - StartCycles); // ms 변환 후 리턴
 	}
 
 private:
+	FORCEINLINE void Record(uint64 InEndCycles)
+	{
+		if (ThreadBuffer)
+		{
+			--ThreadBuffer->Depth;
+			ThreadBuffer->Push(FStatEvent{ StartCycles, InEndCycles, UsedStatId.Index, Depth });
+			ThreadBuffer = nullptr;
+		}
+	}
+
 	uint64 StartCycles;
 	TStatId UsedStatId;
+	FThreadStatBuffer* ThreadBuffer = nullptr;
+	uint32 Depth = 0;
 };
+
+/**
+ * 스탯 선언/사용 매크로
+ * - DECLARE_CYCLE_STAT(Name, StatName, Group): 파일 범위에서 이름 있는 스탯 선언
+ * - SCOPE_CYCLE_COUNTER(StatName): 선언한 스탯으로 현재 스코프를 잰다
+ * - QUICK_SCOPE_CYCLE_COUNTER(StatName): 선언 없이 현재 스코프를 잰다 (첫 호출 때 등록)
+ */
+#define GET_STATID(StatName) (StatPtr_##StatName())
+
+#define DECLARE_CYCLE_STAT(CounterName, StatName, GroupName) \
+	static TStatId StatPtr_##StatName() \
+	{ \
+		static const TStatId StatId = FStatRegistry::Register(CounterName, #GroupName); \
+		return StatId; \
+	}
+
+#define STAT_CONCAT_INNER(A, B) A##B
+#define STAT_CONCAT(A, B) STAT_CONCAT_INNER(A, B)
+
+#define SCOPE_CYCLE_COUNTER(StatName) \
+	FScopeCycleCounter STAT_CONCAT(CycleCounter_, __LINE__)(GET_STATID(StatName))
+
+#define QUICK_SCOPE_CYCLE_COUNTER(StatName) \
+	static const TStatId STAT_CONCAT(QuickStatId_, __LINE__) = FStatRegistry::Register(#StatName, "Quick"); \
+	FScopeCycleCounter STAT_CONCAT(CycleCounter_, __LINE__)(STAT_CONCAT(QuickStatId_, __LINE__))
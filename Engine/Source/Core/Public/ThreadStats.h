@@ -0,0 +1,145 @@
+#pragma once
+#include "Core/Public/PlatformTime.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief 스탯 ID: FStatRegistry에 등록된 이름의 인덱스
+ * 기본값(INVALID_INDEX)은 기록하지 않는 카운터를 뜻한다
+ */
+struct TStatId
+{
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	uint32 Index = INVALID_INDEX;
+
+	bool IsValid() const { return Index != INVALID_INDEX; }
+};
+
+struct FStatDescriptor
+{
+	const char* Name = "";
+	const char* Group = "";
+};
+
+/**
+ * @brief 스탯 이름 테이블
+ * 등록은 뮤텍스로 보호하고, 조회는 고정 크기 배열을 잠금 없이 읽는다 (등록된 항목은 바뀌지 않는다)
+ */
+class FStatRegistry
+{
+public:
+	static constexpr uint32 MAX_STATS = 1024;
+
+	/** 같은 이름은 같은 ID를 돌려준다. Name/Group은 프로그램 수명 동안 유효한 문자열이어야 한다 */
+	static TStatId Register(const char* InName, const char* InGroup = "Default");
+
+	static uint32 GetNumStats() { return NumStats.load(std::memory_order_acquire); }
+	static const FStatDescriptor& GetDescriptor(uint32 InIndex) { return Descriptors[InIndex]; }
+
+private:
+	static FStatDescriptor Descriptors[MAX_STATS];
+	static std::atomic<uint32> NumStats;
+	static std::mutex RegisterMutex;
+};
+
+/**
+ * @brief 스코프 하나가 끝날 때 기록되는 이벤트 (24바이트)
+ * Depth는 같은 스레드 안에서의 중첩 깊이로, 프레임 집계 때 부모를 찾는 데 쓴다
+ */
+struct FStatEvent
+{
+	uint64 StartCycles;
+	uint64 EndCycles;
+	uint32 StatIndex;
+	uint32 Depth;
+};
+
+/**
+ * @brief 스레드 하나의 이벤트 링 버퍼 (단일 생산자 / 단일 소비자, 잠금 없음)
+ * 생산자는 소유 스레드, 소비자는 프레임을 닫는 UProfilerManager
+ * 소비자가 따라오지 못해 가득 차면 새 이벤트를 버리고 개수만 센다
+ */
+class FThreadStatBuffer
+{
+public:
+	static constexpr uint32 CAPACITY = 1u << 14;
+
+	explicit FThreadStatBuffer(uint32 InThreadIndex);
+
+	FORCEINLINE void Push(const FStatEvent& InEvent)
+	{
+		const uint64 Write = WriteIndex.load(std::memory_order_relaxed);
+		if (Write - CachedReadIndex >= CAPACITY)
+		{
+			// 캐시한 읽기 위치로 가득 차 보일 때만 공유 변수를 다시 읽는다
+			CachedReadIndex = ReadIndex.load(std::memory_order_acquire);
+			if (Write - CachedReadIndex >= CAPACITY)
+			{
+				NumDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		Events[Write & (CAPACITY - 1)] = InEvent;
+		WriteIndex.store(Write + 1, std::memory_order_release);
+	}
+
+	/** 소비자 전용: 쌓인 이벤트를 모두 꺼내 OutEvents 뒤에 붙인다 */
+	uint32 Drain(TArray<FStatEvent>& OutEvents);
+
+	uint32 GetThreadIndex() const { return ThreadIndex; }
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	// 소유 스레드만 읽고 쓴다
+	uint32 Depth = 0;
+
+private:
+	friend class FThreadStats;
+
+	std::unique_ptr<FStatEvent[]> Events;
+	uint32 ThreadIndex;
+	FString Name;
+	uint64 CachedReadIndex = 0;
+
+	alignas(64) std::atomic<uint64> WriteIndex{ 0 };
+	alignas(64) std::atomic<uint64> ReadIndex{ 0 };
+	std::atomic<uint64> NumDropped{ 0 };
+};
+
+/**
+ * @brief 스레드별 이벤트 버퍼 관리
+ * 각 스레드는 처음 스코프를 기록할 때 버퍼를 만들어 전역 목록에 등록한다 (스레드가 끝나도 버퍼는 남는다)
+ */
+class FThreadStats
+{
+public:
+	static FORCEINLINE FThreadStatBuffer& GetThreadBuffer()
+	{
+		static thread_local FThreadStatBuffer* ThreadBuffer = nullptr;
+		if (!ThreadBuffer)
+		{
+			ThreadBuffer = CreateThreadBuffer();
+		}
+		return *ThreadBuffer;
+	}
+
+	/** 현재 스레드의 표시 이름 (Chrome trace의 thread_name) */
+	static void SetThreadName(const FString& InName);
+	static FString GetThreadName(const FThreadStatBuffer& InBuffer);
+
+	static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+	static void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+
+	/** 지금까지 등록된 모든 스레드 버퍼 */
+	static void GetThreadBuffers(TArray<FThreadStatBuffer*>& OutBuffers);
+
+private:
+	static FThreadStatBuffer* CreateThreadBuffer();
+
+	static std::atomic<bool> bEnabled;
+	static std::mutex BufferMutex;
+	static TArray<std::unique_ptr<FThreadStatBuffer>> Buffers;
+};
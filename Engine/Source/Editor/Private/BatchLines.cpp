@@ -4,38 +4,40 @@
 #include "Editor/Public/EditorPrimitive.h"
 #include "Manager/Asset/Public/AssetManager.h"
 
-UBatchLines::UBatchLines()
-	: Grid()
-	, BoundingBoxLines()
+namespace
 {
-	Vertices.reserve(Grid.GetNumVertices() + BoundingBoxLines.GetNumVertices());
-	Vertices.resize(Grid.GetNumVertices() + BoundingBoxLines.GetNumVertices());
+	const FVector4 GridColor(0.5f, 0.5f, 0.5f, 1.0f);
+	const FVector4 BoundingBoxColor(0.5f, 0.5f, 0.5f, 1.0f);
+}
 
-	Grid.MergeVerticesAt(Vertices, 0);
-	BoundingBoxLines.MergeVerticesAt(Vertices, Grid.GetNumVertices());
+UBatchLines::UBatchLines()
+	: TransientRing(MIN_TRANSIENT_CAPACITY)
+	, Grid()
+{
+	UAssetManager& AssetManager = UAssetManager::GetInstance();
 
-	SetIndices();
+	PersistentPrimitive.Topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+	PersistentPrimitive.NumVertices = 0;
+	PersistentPrimitive.NumIndices = 0;
+	PersistentPrimitive.VertexShader = AssetManager.GetVertexShader(EShaderType::BatchLine);
+	PersistentPrimitive.InputLayout = AssetManager.GetIputLayout(EShaderType::BatchLine);
+	PersistentPrimitive.PixelShader = AssetManager.GetPixelShader(EShaderType::BatchLine);
 
-	URenderer& Renderer = URenderer::GetInstance();
+	TransientPrimitive = PersistentPrimitive;
+	CreateTransientVertexBuffer(TransientRing.GetCapacity());
 
-	Primitive.NumVertices = static_cast<uint32>(Vertices.size());
-	Primitive.NumIndices = static_cast<uint32>(Indices.size());
-	Primitive.IndexBuffer = Renderer.CreateIndexBuffer(Indices.data(), Primitive.NumIndices * sizeof(uint32));
-	Primitive.Topology = D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
-	Primitive.Vertexbuffer = Renderer.CreateVertexBuffer(
-		Vertices.data(), Primitive.NumVertices * sizeof(FVector), true);
-	Primitive.VertexShader = UAssetManager::GetInstance().GetVertexShader(EShaderType::BatchLine);
-	Primitive.InputLayout = UAssetManager::GetInstance().GetIputLayout(EShaderType::BatchLine);
-	Primitive.PixelShader = UAssetManager::GetInstance().GetPixelShader(EShaderType::BatchLine);
+	SetGridLayer();
 }
 
 UBatchLines::~UBatchLines()
 {
-	URenderer::ReleaseVertexBuffer(Primitive.Vertexbuffer);
-	Primitive.InputLayout->Release();
-	Primitive.VertexShader->Release();
-	Primitive.IndexBuffer->Release();
-	Primitive.PixelShader->Release();
+	FDebugDraw::ClearPersistentLayer(EDebugDrawLayer::Grid);
+
+	URenderer::ReleaseVertexBuffer(PersistentPrimitive.Vertexbuffer);
+	URenderer::ReleaseVertexBuffer(TransientPrimitive.Vertexbuffer);
+	PersistentPrimitive.InputLayout->Release();
+	PersistentPrimitive.VertexShader->Release();
+	PersistentPrimitive.PixelShader->Release();
 }
 
 void UBatchLines::UpdateUGridVertices(const float newCellSize)
@@ -45,81 +47,120 @@ void UBatchLines::UpdateUGridVertices(const float newCellSize)
 		return;
 	}
 	Grid.UpdateVerticesBy(newCellSize);
-	Grid.MergeVerticesAt(Vertices, 0);
-	bChangedVertices = true;
+	SetGridLayer();
 }
 
-void UBatchLines::UpdateBoundingBoxVertices(const FAABB& newBoundingBoxInfo)
+void UBatchLines::DrawBoundingBox(const FAABB& InBoundingBox)
 {
-	FAABB curBoudingBoxInfo = BoundingBoxLines.GetRenderedBoxInfo();
-	if (newBoundingBoxInfo.Min == curBoudingBoxInfo.Min && newBoundingBoxInfo.Max == curBoudingBoxInfo.Max)
-	{
-		return;
-	}
-
-	BoundingBoxLines.UpdateVertices(newBoundingBoxInfo);
-	BoundingBoxLines.MergeVerticesAt(Vertices, Grid.GetNumVertices());
-	bChangedVertices = true;
+	FDebugDraw::DrawBox(InBoundingBox, BoundingBoxColor);
 }
 
-void UBatchLines::UpdateBatchLineVertices(const float newCellSize, const FAABB& newBoundingBoxInfo)
+void UBatchLines::SetGridLayer()
 {
-	UpdateUGridVertices(newCellSize);
-	UpdateBoundingBoxVertices(newBoundingBoxInfo);
-}
+	const TArray<FVector>& GridVertices = Grid.GetVertices();
 
-void UBatchLines::UpdateVertexBuffer()
-{
-	if (bChangedVertices)
+	TArray<FDebugLineVertex> LayerVertices;
+	LayerVertices.reserve(GridVertices.size());
+	for (const FVector& Position : GridVertices)
 	{
-		URenderer::GetInstance().UpdateVertexBuffer(Primitive.Vertexbuffer, Vertices);
+		LayerVertices.push_back({ Position, GridColor });
 	}
 
-	bChangedVertices = false;
+	FDebugDraw::SetPersistentLayer(EDebugDrawLayer::Grid, std::move(LayerVertices));
 }
 
 void UBatchLines::Render(UPipeline& InPipeline)
 {
+	UploadPersistentVertices();
+	UploadTransientVertices();
+
 	URenderer& Renderer = URenderer::GetInstance();
+	Renderer.RenderEditorPrimitiveRange(InPipeline, PersistentPrimitive, PersistentPrimitive.RenderState, sizeof(FDebugLineVertex), 0);
+	Renderer.RenderEditorPrimitiveRange(InPipeline, TransientPrimitive, TransientPrimitive.RenderState, sizeof(FDebugLineVertex), TransientFirstVertex);
+}
+
+/**
+ * @brief 레이어가 바뀐 경우에만 정적 정점 버퍼를 다시 만든다 (그리드 셀 크기 변경 등 드문 경우)
+ */
+void UBatchLines::UploadPersistentVertices()
+{
+	const uint64 Version = FDebugDraw::GetPersistentVersion();
+	if (Version == UploadedPersistentVersion)
+	{
+		return;
+	}
+	UploadedPersistentVersion = Version;
 
-	// to do: 아래 함수를 batch에 맞게 수정해야 함.
-	Renderer.RenderEditorPrimitiveIndexed(InPipeline, Primitive, Primitive.RenderState, false, sizeof(FVector), sizeof(uint32));
+	URenderer::ReleaseVertexBuffer(PersistentPrimitive.Vertexbuffer);
+	PersistentPrimitive.Vertexbuffer = nullptr;
+
+	const TArray<FDebugLineVertex>& Vertices = FDebugDraw::GetPersistentVertices();
+	PersistentPrimitive.NumVertices = static_cast<uint32>(Vertices.size());
+	if (!Vertices.empty())
+	{
+		PersistentPrimitive.Vertexbuffer = URenderer::GetInstance().CreateVertexBuffer(
+			Vertices.data(), PersistentPrimitive.NumVertices * sizeof(FDebugLineVertex));
+	}
 }
 
-void UBatchLines::SetIndices()
+/**
+ * @brief 이번 프레임 선을 링 버퍼에 이어 쓴다, 뷰포트가 여럿이어도 프레임마다 한 번만 올린다
+ * 남은 공간이 있으면 NO_OVERWRITE로 GPU가 읽는 앞 구간을 건드리지 않고, 끝에 닿으면 DISCARD로 처음부터 쓴다
+ */
+void UBatchLines::UploadTransientVertices()
 {
-	Indices.clear();
-	const uint32 numGridVertices = Grid.GetNumVertices();
-	Indices.reserve(numGridVertices + 24);
+	const uint64 FrameNumber = FDebugDraw::GetFrameNumber();
+	if (FrameNumber == UploadedFrameNumber)
+	{
+		return;
+	}
+	UploadedFrameNumber = FrameNumber;
 
-	for (uint32 index = 0; index < numGridVertices; ++index)
+	const FDebugLineStream& Vertices = FDebugDraw::GetTransientVertices();
+	TransientPrimitive.NumVertices = Vertices.Num();
+	if (Vertices.Num() == 0)
 	{
-		Indices.push_back(index);
+		return;
 	}
 
-	uint32 boundingBoxLineIdx[] = {
-		// 앞면
-		0, 1,
-		1, 2,
-		2, 3,
-		3, 0,
-
-		// 뒷면
-		4, 5,
-		5, 6,
-		6, 7,
-		7, 4,
-
-		// 옆면 연결
-		0, 4,
-		1, 5,
-		2, 6,
-		3, 7
-	};
-
-	for (uint32 i = 0; i < std::size(boundingBoxLineIdx); ++i)
+	const FRingBufferAllocator::FAllocation Allocation = TransientRing.Allocate(TransientPrimitive.NumVertices);
+	if (Allocation.bResized && !CreateTransientVertexBuffer(TransientRing.GetCapacity()))
 	{
-		Indices.push_back(numGridVertices + boundingBoxLineIdx[i]);
+		TransientPrimitive.NumVertices = 0;
+		return;
 	}
+
+	ID3D11DeviceContext* DeviceContext = URenderer::GetInstance().GetDeviceContext();
+	const D3D11_MAP MapType = Allocation.bDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+	D3D11_MAPPED_SUBRESOURCE MappedResource;
+	if (FAILED(DeviceContext->Map(TransientPrimitive.Vertexbuffer, 0, MapType, 0, &MappedResource)))
+	{
+		UE_LOG_ERROR("BatchLines: 정점 버퍼 Map 실패");
+		TransientPrimitive.NumVertices = 0;
+		return;
+	}
+	memcpy(static_cast<FDebugLineVertex*>(MappedResource.pData) + Allocation.FirstElement,
+		Vertices.GetData(), sizeof(FDebugLineVertex) * Vertices.Num());
+	DeviceContext->Unmap(TransientPrimitive.Vertexbuffer, 0);
+
+	TransientFirstVertex = Allocation.FirstElement;
 }
 
+bool UBatchLines::CreateTransientVertexBuffer(uint32 InCapacity)
+{
+	URenderer::ReleaseVertexBuffer(TransientPrimitive.Vertexbuffer);
+	TransientPrimitive.Vertexbuffer = nullptr;
+
+	D3D11_BUFFER_DESC VertexBufferDescription = {};
+	VertexBufferDescription.ByteWidth = InCapacity * sizeof(FDebugLineVertex);
+	VertexBufferDescription.Usage = D3D11_USAGE_DYNAMIC;
+	VertexBufferDescription.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	VertexBufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	if (FAILED(URenderer::GetInstance().GetDevice()->CreateBuffer(&VertexBufferDescription, nullptr, &TransientPrimitive.Vertexbuffer)))
+	{
+		UE_LOG_ERROR("BatchLines: 동적 정점 버퍼 생성 실패 (%u 정점)", InCapacity);
+		return false;
+	}
+	return true;
+}
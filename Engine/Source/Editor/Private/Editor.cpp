@@ -21,6 +21,8 @@
 #include "Render/UI/Widget/Public/ViewportMenuBarWidget.h"
 #include "Manager/BVH/public/BVHManager.h"
 
+DECLARE_CYCLE_STAT("Picking", STAT_Picking, Editor)
+
 UEditor::UEditor()
 {
 	const TArray<float>& SplitterRatio = UConfigManager::GetInstance().GetSplitterRatio();
@@ -75,7 +77,10 @@ void UEditor::Tick(float DeltaSeconds)
 		}
 	}
 
-	if (AActor* SelectedActor = GEngine->GetCurrentLevel()->GetSelectedActor())
+	// 선택된 액터의 프리미티브마다 바운딩 박스를 이번 프레임 디버그 선으로 넣는다
+	const uint64 ShowFlags = GEngine->GetCurrentLevel()->GetShowFlags();
+	AActor* SelectedActor = GEngine->GetCurrentLevel()->GetSelectedActor();
+	if (SelectedActor && (ShowFlags & EEngineShowFlags::SF_Primitives) && (ShowFlags & EEngineShowFlags::SF_Bounds))
 	{
 		for (const auto& Component : SelectedActor->GetOwnedComponents())
 		{
@@ -83,26 +88,10 @@ void UEditor::Tick(float DeltaSeconds)
 			{
 				FVector WorldMin, WorldMax;
 				PrimitiveComponent->GetWorldAABB(WorldMin, WorldMax);
-
-				uint64 ShowFlags = GEngine->GetCurrentLevel()->GetShowFlags();
-
-				if ((ShowFlags & EEngineShowFlags::SF_Primitives) && (ShowFlags & EEngineShowFlags::SF_Bounds))
-				{
-					BatchLines.UpdateBoundingBoxVertices(FAABB(WorldMin, WorldMax));
-				}
-				else
-				{
-					BatchLines.UpdateBoundingBoxVertices({ { 0.0f,0.0f,0.0f }, { 0.0f, 0.0f, 0.0f } });
-				}
+				BatchLines.DrawBoundingBox(FAABB(WorldMin, WorldMax));
 			}
 		}
 	}
-	else
-	{
-		BatchLines.DisableRenderBoundingBox();
-	}
-
-	BatchLines.UpdateVertexBuffer();
 
 	ProcessMouseInput(GEngine->GetCurrentLevel());
 
@@ -437,7 +426,7 @@ void UEditor::ProcessMouseInput(ULevel* InLevel)
 				if (GEngine->GetCurrentLevel()->GetShowFlags() & EEngineShowFlags::SF_Primitives)
 				{
 					UStatOverlay::GetInstance().NumPickingAttempts++;
-					FScopeCycleCounter PickCounter;
+					FScopeCycleCounter PickCounter(GET_STATID(STAT_Picking));
 
 					PrimitiveCollided = ObjectPicker.PickPrimitive(WorldRay, Candidates, &ActorDistance);
 					ActorPicked = PrimitiveCollided ? PrimitiveCollided->GetOwner() : nullptr;
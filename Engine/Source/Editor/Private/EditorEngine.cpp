@@ -1,12 +1,43 @@
 #include "pch.h"
 #include "Editor/Public/EditorEngine.h"
 #include "Editor/Public/Editor.h"
+#include "Core/Public/ScopeCycleCounter.h"
 #include "Level/Public/Level.h"
+#include "Manager/BVH/public/BVHManager.h"
 #include "Manager/Config/Public/ConfigManager.h"
 #include "Render/Renderer/Public/Renderer.h"
+#include "World/Public/WorldCloner.h"
+
+DECLARE_CYCLE_STAT("Start PIE", STAT_StartPIE, Editor)
+DECLARE_CYCLE_STAT("End PIE", STAT_EndPIE, Editor)
 
 IMPLEMENT_CLASS(UEditorEngine, UObject);
 
+namespace
+{
+	struct FPIELatency
+	{
+		double MedianMs = 0.0;
+		double MinMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	FPIELatency SummarizeLatency(TArray<double>& InSamples)
+	{
+		FPIELatency Latency;
+		if (InSamples.empty())
+		{
+			return Latency;
+		}
+
+		std::sort(InSamples.begin(), InSamples.end());
+		Latency.MedianMs = InSamples[InSamples.size() / 2];
+		Latency.MinMs = InSamples.front();
+		Latency.MaxMs = InSamples.back();
+		return Latency;
+	}
+}
+
 UEditorEngine* GEngine = nullptr;
 
 UEditorEngine::UEditorEngine()
@@ -190,6 +221,7 @@ void UEditorEngine::StartPIE()
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_StartPIE);
 	UE_LOG("EditorEngine: Starting Play In Editor (PIE) Mode");
 
 	// PIE World 생성
@@ -199,7 +231,7 @@ void UEditorEngine::StartPIE()
 
 	if (auto World = GetEditorWorld())
 	{
-		PIEContext.WorldPtr = DuplicateObject(World, World->GetOuter());
+		PIEContext.WorldPtr = bUseBulkPIEClone ? DuplicateWorldForPIE(World) : DuplicateObject(World, World->GetOuter());
 		PIEContext.WorldPtr->SetName("PIE World");
 		PIEContext.WorldPtr->SetWorldType(EWorldType::PIE);
 		PIEContext.WorldPtr->GetLevel()->SetName("PIE Level");
@@ -218,11 +250,12 @@ void UEditorEngine::StartPIE()
 	}
 
 	// Editor World의 Level을 강제로 재초기화하여 렌더링 갱신
+	// BVH를 복제본으로 돌려 놓았다면 다시 빌드하지 않는다
 	if (UWorld* PIEWorld = GetPIEWorld())
 	{
 		if (ULevel* GetPIELevel = PIEWorld->GetLevel())
 		{
-			GetPIELevel->InitializeActorsInLevel();
+			GetPIELevel->InitializeActorsInLevel(!bPIEBVHRetargeted);
 			UE_LOG("EditorEngine: PIE Level reinitialized for rendering");
 		}
 	}
@@ -238,6 +271,7 @@ void UEditorEngine::EndPIE()
 		return;
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_EndPIE);
 	UE_LOG("EditorEngine: Stopping Play In Editor (PIE) Mode");
 
 	// bPIEActive를 먼저 false로 설정하여 Tick에서 EditorWorld로 전환
@@ -257,12 +291,26 @@ void UEditorEngine::EndPIE()
 		}
 	}
 
+	// PIE 동안 보관해 둔 에디터 레벨의 BVH가 있으면 되돌리고, 레벨이 바뀌었으면 버리고 다시 빌드한다
+	UBVHManager& BVHManager = UBVHManager::GetInstance();
+	bool bRestoredBVH = false;
+	if (bPIEBVHRetargeted && GetEditorWorld() && GetEditorWorld()->GetLevel() == PIESourceLevel)
+	{
+		bRestoredBVH = BVHManager.RestoreRetargetedPrimitives();
+	}
+	else
+	{
+		BVHManager.DiscardRetargetedPrimitives();
+	}
+	bPIEBVHRetargeted = false;
+	PIESourceLevel = nullptr;
+
 	// Editor World의 Level을 강제로 재초기화하여 렌더링 갱신
 	if (UWorld* EditorWorld = GetEditorWorld())
 	{
 		if (ULevel* EditorLevel = EditorWorld->GetLevel())
 		{
-			EditorLevel->InitializeActorsInLevel();
+			EditorLevel->InitializeActorsInLevel(!bRestoredBVH);
 			UE_LOG("EditorEngine: Editor Level reinitialized for rendering");
 		}
 	}
@@ -281,9 +329,74 @@ void UEditorEngine::EndPIE()
 	UE_LOG("EditorEngine: Switched back to Editor World");
 }
 
+/**
+ * @brief FWorldCloner로 월드를 한 번에 복제하고, 에디터 레벨의 BVH를 복제본으로 돌려 재사용한다
+ */
 UWorld* UEditorEngine::DuplicateWorldForPIE(UWorld* SourceWorld)
 {
-	return nullptr;
+	FWorldCloner Cloner;
+	UWorld* PIEWorld = Cloner.Clone(SourceWorld, SourceWorld->GetOuter());
+
+	PIESourceLevel = SourceWorld->GetLevel();
+	bPIEBVHRetargeted = UBVHManager::GetInstance().RetargetPrimitives(Cloner);
+
+	UE_LOG("EditorEngine: Cloned %u objects for PIE (BVH %s)", Cloner.GetNumClonedObjects(),
+	       bPIEBVHRetargeted ? "reused" : "rebuilt");
+	return PIEWorld;
+}
+
+/**
+ * @brief 현재 에디터 월드로 StartPIE/EndPIE를 반복해 Duplicate 경로와 벌크 복제 경로의 지연 시간을 로그로 남긴다
+ * 액터 수가 다른 레벨을 불러와 돌리면 액터 수에 따른 지연 시간을 비교할 수 있다
+ */
+void UEditorEngine::RunPIEBenchmark(uint32 InNumIterations)
+{
+	if (bPIEActive)
+	{
+		UE_LOG("EditorEngine: Stop PIE before running the PIE benchmark");
+		return;
+	}
+
+	UWorld* EditorWorld = GetEditorWorld();
+	if (!EditorWorld || !EditorWorld->GetLevel())
+	{
+		UE_LOG("EditorEngine: No Editor Level available for the PIE benchmark");
+		return;
+	}
+
+	const uint64 NumActors = EditorWorld->GetLevel()->GetActors().size();
+	const uint32 NumIterations = std::max(1u, InNumIterations);
+	const bool bPrevUseBulkPIEClone = bUseBulkPIEClone;
+
+	for (const bool bUseBulkClone : { false, true })
+	{
+		bUseBulkPIEClone = bUseBulkClone;
+
+		TArray<double> StartSamples;
+		TArray<double> EndSamples;
+		StartSamples.reserve(NumIterations);
+		EndSamples.reserve(NumIterations);
+
+		for (uint32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			StartPIE();
+			const uint64 StartedCycles = FPlatformTime::Cycles64();
+			EndPIE();
+			const uint64 EndedCycles = FPlatformTime::Cycles64();
+
+			StartSamples.push_back(FPlatformTime::ToMilliseconds(StartedCycles - StartCycles));
+			EndSamples.push_back(FPlatformTime::ToMilliseconds(EndedCycles - StartedCycles));
+		}
+
+		const FPIELatency Start = SummarizeLatency(StartSamples);
+		const FPIELatency End = SummarizeLatency(EndSamples);
+		UE_LOG("PIE Benchmark [%s] Actors %llu x %u: StartPIE %.3f ms (min %.3f, max %.3f), EndPIE %.3f ms (min %.3f, max %.3f)",
+		       bUseBulkClone ? "BulkClone" : "Duplicate", NumActors, NumIterations,
+		       Start.MedianMs, Start.MinMs, Start.MaxMs, End.MedianMs, End.MinMs, End.MaxMs);
+	}
+
+	bUseBulkPIEClone = bPrevUseBulkPIEClone;
 }
 
 FWorldContext* UEditorEngine::GetEditorWorldContext()
@@ -1,7 +1,7 @@
 #include "pch.h"
 #include <immintrin.h>
 #include "Editor/Public/FrustumCull.h"
-#include "Physics/Public/AABB.h"
+#include "Physics/Public/Box.h"
 #include "Editor/Public/Camera.h"
 
 
@@ -14,24 +14,26 @@ FFrustumCull::~FFrustumCull()
 {
 }
 
-UObject* FFrustumCull::Duplicate(FObjectDuplicationParameters Parameters)
+void FFrustumCull::CopyPropertiesFrom(const UObject* InSource)
 {
-	auto DupObject = static_cast<FFrustumCull*>(Super::Duplicate(Parameters));
+	Super::CopyPropertiesFrom(InSource);
 
+	const FFrustumCull* Source = static_cast<const FFrustumCull*>(InSource);
 	for (size_t i = 0; i < 6; ++i)
 	{
-		DupObject->Planes[i] = Planes[i];
+		Planes[i] = Source->Planes[i];
 	}
-
-	return DupObject;
 }
 
 void FFrustumCull::Update(UCamera* InCamera)
 {
 	FMatrix ViewMatrix = InCamera->GetFViewProjConstants().View;
 	FMatrix ProjMatrix =  InCamera->GetFViewProjConstants().Projection;
-	FMatrix ViewProjMatrix = ViewMatrix * ProjMatrix;
+	Update(ViewMatrix * ProjMatrix);
+}
 
+void FFrustumCull::Update(const FMatrix& ViewProjMatrix)
+{
 	// left
 	Planes[0].NormalVector.X = ViewProjMatrix.Data[0][3] + ViewProjMatrix.Data[0][0];
 	Planes[0].NormalVector.Y = ViewProjMatrix.Data[1][3] + ViewProjMatrix.Data[1][0];
@@ -74,7 +76,7 @@ void FFrustumCull::Update(UCamera* InCamera)
 	}
 }
 
-EFrustumTestResult FFrustumCull::IsInFrustum(const FAABB& TargetAABB)
+EFrustumTestResult FFrustumCull::IsInFrustum(const FBox& TargetAABB)
 {
 	// Near/Far 평면을 먼저 검사 (더 높은 확률로 culling 가능)
 	static const int PlaneOrder[6] = { 4, 5, 0, 1, 2, 3 }; // Near, Far, Left, Right, Bottom, Top
@@ -87,9 +89,9 @@ EFrustumTestResult FFrustumCull::IsInFrustum(const FAABB& TargetAABB)
 		// 평면의 법선 방향으로 가장 멀리 있는 꼭짓점
 		// 이 꼭짓점이 양수면 frustum 내부에 있거나, 겹침 상태
 		FVector PositiveVertex{};
-		PositiveVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Max.X : TargetAABB.Min.X;
-		PositiveVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Max.Y : TargetAABB.Min.Y;
-		PositiveVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Max.Z : TargetAABB.Min.Z;
+		PositiveVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Max[0] : TargetAABB.Min[0];
+		PositiveVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Max[1] : TargetAABB.Min[1];
+		PositiveVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Max[2] : TargetAABB.Min[2];
 
 		float Distance = (Plane.NormalVector.X * PositiveVertex.X)
 						+ (Plane.NormalVector.Y * PositiveVertex.Y)
@@ -105,20 +107,20 @@ EFrustumTestResult FFrustumCull::IsInFrustum(const FAABB& TargetAABB)
 	return EFrustumTestResult::Inside;
 }
 
-const EFrustumTestResult FFrustumCull::TestAABBWithPlane(const FAABB& TargetAABB, const EPlaneIndex Index)
+const EFrustumTestResult FFrustumCull::TestAABBWithPlane(const FBox& TargetAABB, const EPlaneIndex Index)
 {
 	EFrustumTestResult Result = this->CheckPlane(TargetAABB, Index);
 	return Result;
 }
 
-EFrustumTestResult FFrustumCull::CheckPlane(const FAABB& TargetAABB, const EPlaneIndex Index)
+EFrustumTestResult FFrustumCull::CheckPlane(const FBox& TargetAABB, const EPlaneIndex Index)
 {
 	const FPlane& Plane = Planes[static_cast<uint8>(Index)];
 
 	FVector PositiveVertex{};
-	PositiveVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Max.X : TargetAABB.Min.X;
-	PositiveVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Max.Y : TargetAABB.Min.Y;
-	PositiveVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Max.Z : TargetAABB.Min.Z;
+	PositiveVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Max[0] : TargetAABB.Min[0];
+	PositiveVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Max[1] : TargetAABB.Min[1];
+	PositiveVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Max[2] : TargetAABB.Min[2];
 
 	float PositiveDistance = (Plane.NormalVector.X * PositiveVertex.X)
 							+ (Plane.NormalVector.Y * PositiveVertex.Y)
@@ -132,9 +134,9 @@ EFrustumTestResult FFrustumCull::CheckPlane(const FAABB& TargetAABB, const EPlan
 	}
 
 	FVector NegativeVertex{};
-	NegativeVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Min.X : TargetAABB.Max.X;
-	NegativeVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Min.Y : TargetAABB.Max.Y;
-	NegativeVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Min.Z : TargetAABB.Max.Z;
+	NegativeVertex.X = (Plane.NormalVector.X >= 0.0f) ? TargetAABB.Min[0] : TargetAABB.Max[0];
+	NegativeVertex.Y = (Plane.NormalVector.Y >= 0.0f) ? TargetAABB.Min[1] : TargetAABB.Max[1];
+	NegativeVertex.Z = (Plane.NormalVector.Z >= 0.0f) ? TargetAABB.Min[2] : TargetAABB.Max[2];
 
 	float NegativeDistance = (Plane.NormalVector.X * NegativeVertex.X)
 							+ (Plane.NormalVector.Y * NegativeVertex.Y)
@@ -2,10 +2,6 @@
 
 #include "Core/Public/ScopeCycleCounter.h"
 
-#ifdef MULTI_THREADING
-#include "cpp-thread-pool/thread_pool.h"
-#endif
-
 #include "Component/Public/PrimitiveComponent.h"
 #include "Core/Public/AppWindow.h"
 #include "Editor/Public/Camera.h"
@@ -191,10 +187,10 @@ bool UObjectPicker::DoesRayIntersectPrimitive_MollerTrumbore(const FRay& InWorld
 		return false;
 	}
 
-	const TArray<FNormalVertex>* Vertices = InPrimitive->GetVerticesData();
+	const TArray<FMeshPosition>* Positions = InPrimitive->GetPositionsData();
 	const TArray<uint32>* Indices = InPrimitive->GetIndicesData();
 
-	if (!Vertices || Vertices->empty())
+	if (!Positions || Positions->empty())
 	{
 		return false;
 	}
@@ -219,7 +215,7 @@ bool UObjectPicker::DoesRayIntersectPrimitive_MollerTrumbore(const FRay& InWorld
 	if (bNeedsFallback)
 	{
 		const bool bHasIndices = Indices && !Indices->empty();
-		const size_t TriangleCount = bHasIndices ? (Indices->size() / 3) : (Vertices->size() / 3);
+		const size_t TriangleCount = bHasIndices ? (Indices->size() / 3) : (Positions->size() / 3);
 
 		for (size_t TriIndex = 0; TriIndex < TriangleCount; ++TriIndex)
 		{
@@ -233,16 +229,16 @@ bool UObjectPicker::DoesRayIntersectPrimitive_MollerTrumbore(const FRay& InWorld
 				const uint32 I0 = (*Indices)[Base + 0];
 				const uint32 I1 = (*Indices)[Base + 1];
 				const uint32 I2 = (*Indices)[Base + 2];
-				V0 = (*Vertices)[I0].Position;
-				V1 = (*Vertices)[I1].Position;
-				V2 = (*Vertices)[I2].Position;
+				V0 = (*Positions)[I0].ToVector();
+				V1 = (*Positions)[I1].ToVector();
+				V2 = (*Positions)[I2].ToVector();
 			}
 			else
 			{
 				const size_t Base = TriIndex * 3;
-				V0 = (*Vertices)[Base + 0].Position;
-				V1 = (*Vertices)[Base + 1].Position;
-				V2 = (*Vertices)[Base + 2].Position;
+				V0 = (*Positions)[Base + 0].ToVector();
+				V1 = (*Positions)[Base + 1].ToVector();
+				V2 = (*Positions)[Base + 2].ToVector();
 			}
 
 			float Distance = 0.0f;
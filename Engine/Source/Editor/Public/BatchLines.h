@@ -3,56 +3,53 @@
 #include "Global/CoreTypes.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Editor/Public/Grid.h"
-#include "Editor/Public/BoundingBoxLines.h"
+#include "Render/Renderer/Public/DebugDraw.h"
 #include "Render/Renderer/Public/Pipeline.h"
 
-struct FVertex;
-
+/**
+ * @brief FDebugDraw 정점 스트림을 GPU로 올려 그리는 에디터 선 렌더러
+ * 그리드는 Persistent 레이어로 넣어 셀 크기가 바뀔 때만 다시 올리고,
+ * 바운딩 박스 등 프레임 선은 동적 링 버퍼에 프레임마다 한 번 이어 쓴 뒤 뷰포트마다 같은 구간을 그린다
+ */
 class UBatchLines : UObject
 {
 public:
 	UBatchLines();
 	~UBatchLines();
 
-	// 종류별 Vertices 업데이트
+	// 그리드 셀 크기 변경, 바뀌었으면 Grid 레이어를 다시 만든다
 	void UpdateUGridVertices(const float newCellSize);
-	void UpdateBoundingBoxVertices(const FAABB& newBoundingBoxInfo);
-
-	// 전체 업데이트
-	void UpdateBatchLineVertices(const float newCellSize, const FAABB& newBoundingBoxInfo);
 
-	// GPU VertexBuffer에 복사
-	void UpdateVertexBuffer();
+	// 이번 프레임에만 그릴 바운딩 박스
+	void DrawBoundingBox(const FAABB& InBoundingBox);
 
 	float GetCellSize() const
 	{
 		return Grid.GetCellSize();
 	}
 
-	/*void SetCellSize(const float newCellSize)
-	{
-		Grid.SetCellSize(newCellSize);
-	}*/
-
-	void DisableRenderBoundingBox()
-	{
-		UpdateBoundingBoxVertices({ {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f} });
-	}
-
 	void Render(UPipeline& InPipeline);
 
 private:
-	void SetIndices();
+	void SetGridLayer();
 
-	bool bChangedVertices = false;
+	// FDebugDraw 결과를 GPU 버퍼에 반영 (레이어는 버전이, 프레임 선은 프레임 번호가 바뀔 때만)
+	void UploadPersistentVertices();
+	void UploadTransientVertices();
 
-	TArray<FVector> Vertices; // 그리드 라인 정보 + (offset 후)디폴트 바운딩 박스 라인 정보(minx, miny가 0,0에 정의된 크기가 1인 cube)
-	TArray<uint32> Indices; // 월드 그리드는 그냥 정점 순서, 바운딩 박스는 실제 인덱싱
+	bool CreateTransientVertexBuffer(uint32 InCapacity);
 
-	FEditorPrimitive Primitive;
+	// 동적 링 버퍼의 처음 용량 (박스 약 170개)
+	static constexpr uint32 MIN_TRANSIENT_CAPACITY = 4096;
 
-	UGrid Grid;
-	UBoundingBoxLines BoundingBoxLines;
+	FEditorPrimitive PersistentPrimitive;
+	FEditorPrimitive TransientPrimitive;
+
+	uint64 UploadedPersistentVersion = 0;
+	uint64 UploadedFrameNumber = 0;
 
-	bool bRenderBox;
+	FRingBufferAllocator TransientRing;
+	uint32 TransientFirstVertex = 0;
+
+	UGrid Grid;
 };
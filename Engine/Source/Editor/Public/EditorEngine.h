@@ -35,6 +35,8 @@ public:
 	void StartPIE();
 	void EndPIE();
 	bool IsPIEActive() const { return bPIEActive; }
+	/** @brief StartPIE/EndPIE 지연 시간을 Duplicate 경로와 벌크 복제 경로로 각각 재서 로그로 남긴다 */
+	void RunPIEBenchmark(uint32 InNumIterations);
 
 	// Editor 접근
 	UEditor* GetEditor() const { return Editor; }
@@ -48,6 +50,11 @@ private:
 	TArray<FWorldContext> WorldContexts;
 	UEditor* Editor = nullptr;
 	bool bPIEActive = false;
+
+	// false면 기존 UObject::Duplicate 체인으로 PIE 월드를 복제한다 (벤치마크 비교용)
+	bool bUseBulkPIEClone = true;
+	bool bPIEBVHRetargeted = false;
+	ULevel* PIESourceLevel = nullptr;
 };
 
 // 글로벌 엔진 인스턴스
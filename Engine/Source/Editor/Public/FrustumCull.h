@@ -1,7 +1,7 @@
 #pragma once
 
 class UCamera;
-struct  FAABB;
+struct FBox;
 
 // 평면의 비트 표현
 enum class EFrustumPlane : uint32
@@ -76,16 +76,18 @@ public:
 	FFrustumCull();
 	~FFrustumCull();
 
-	UObject* Duplicate(FObjectDuplicationParameters Parameters);
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 	void Update(UCamera* InCamera);
-	EFrustumTestResult IsInFrustum(const FAABB& TargetAABB);
-	const EFrustumTestResult TestAABBWithPlane(const FAABB& TargetAABB, const EPlaneIndex Index);
+	// 카메라 없이 View * Projection 행렬에서 바로 평면을 뽑는다 (헤드리스 러너 등)
+	void Update(const FMatrix& ViewProjMatrix);
+	EFrustumTestResult IsInFrustum(const FBox& TargetAABB);
+	const EFrustumTestResult TestAABBWithPlane(const FBox& TargetAABB, const EPlaneIndex Index);
 
 	FPlane& GetPlane(EPlaneIndex Index) { return Planes[static_cast<uint8>(Index)]; }
 
 private:
-	EFrustumTestResult CheckPlane(const FAABB& TargetAABB,  EPlaneIndex Index);
+	EFrustumTestResult CheckPlane(const FBox& TargetAABB,  EPlaneIndex Index);
 
 private:
 	// 순서대로 left, right, bottom, top, near, far
@@ -20,6 +20,11 @@ public:
 		return NumVertices;
 	}
 
+	const TArray<FVector>& GetVertices() const
+	{
+		return Vertices;
+	}
+
 	float GetCellSize() const
 	{
 		return CellSize;
@@ -34,7 +34,16 @@ struct FMaterialConstants
 	float Ni;
 	float D;
 	uint32 MaterialFlags;
-	float Time; // Time in seconds
+};
+
+/**
+ * @brief 재질과 무관하게 드로우마다 바뀌는 값 (TextureShader b3)
+ * 재질 상수 블록은 재질이 바뀔 때만 갱신하고, 스크롤 시간처럼 컴포넌트별로 다른 값만 여기로 올린다
+ */
+struct FMaterialDrawConstants
+{
+	float Time = 0.0f; // Time in seconds
+	float Padding[3] = {};
 };
 
 struct FVertex
@@ -51,6 +60,36 @@ struct FNormalVertex
 	FVector2 TexCoord;
 };
 
+/**
+ * @brief 쿠킹된 메쉬의 위치 스트림 (float3, 12 bytes)
+ * 피킹, BVH 빌드, 오클루전처럼 위치만 필요한 경로는 이 스트림만 읽는다
+ */
+struct FMeshPosition
+{
+	float X = 0.0f;
+	float Y = 0.0f;
+	float Z = 0.0f;
+
+	FMeshPosition() = default;
+	FMeshPosition(const FVector& InPosition) : X(InPosition.X), Y(InPosition.Y), Z(InPosition.Z) {}
+
+	FVector ToVector() const { return FVector(X, Y, Z); }
+};
+
+/**
+ * @brief 쿠킹된 메쉬의 속성 스트림 (8 bytes)
+ * - Normal: Octahedral 인코딩 (R16G16_SNORM)
+ * - TexCoord: Half float (R16G16_FLOAT)
+ */
+struct FMeshAttribute
+{
+	int16 Normal[2] = {};
+	uint16 TexCoord[2] = {};
+};
+
+static_assert(sizeof(FMeshPosition) == 12, "FMeshPosition must be tightly packed");
+static_assert(sizeof(FMeshAttribute) == 8, "FMeshAttribute must be tightly packed");
+
 struct FRay
 {
 	FVector4 Origin;
@@ -153,6 +153,7 @@ namespace EnumReflection
 		return {};
 #endif
 
+#if defined(_MSC_VER)
 		// MSVC: "constexpr_string_view __cdecl EnumReflection::GetEnumNameRaw<enum EKeyInput,EKeyInput::W>(void)"
 		// 마지막 콤마 뒤부터 > 앞까지가 enum 값
 		auto LastComma = FunctionName.find_last_of(',');
@@ -164,6 +165,21 @@ namespace EnumReflection
 		auto Start = LastComma + 1;
 		auto End = FunctionName.find('>', Start);
 		if (End == string_view::npos) return {};
+#else
+		// GCC: "... GetEnumNameRaw() [with EnumType = EKeyInput; EnumType Value = EKeyInput::W]"
+		// Clang: "... GetEnumNameRaw() [EnumType = EKeyInput, Value = EKeyInput::W]"
+		constexpr string_view ValueTag = "Value = ";
+		const string_view Signature(FunctionName.data(), FunctionName.size());
+		auto TagPosition = Signature.find(ValueTag);
+		if (TagPosition == string_view::npos)
+		{
+			return {};
+		}
+
+		auto Start = TagPosition + ValueTag.size();
+		auto End = Signature.find_first_of(";]", Start);
+		if (End == string_view::npos) return {};
+#endif
 
 		auto RawName = FunctionName.substr(Start, End - Start).trim();
 
@@ -177,6 +193,15 @@ namespace EnumReflection
 		return RawName;
 	}
 
+	/**
+	 * enum 값마다 하나씩 생기는 null-terminated 네임 저장소
+	 * constexpr 함수 안의 static 변수는 C++17 GCC/Clang에서 허용되지 않아 변수 템플릿으로 둔다
+	 */
+	template <typename EnumType, EnumType Value>
+	inline constexpr EnumNameHolder<EnumType, Value, GetEnumNameRaw<EnumType, Value>().size()> EnumNameStorage{
+		GetEnumNameRaw<EnumType, Value>()
+	};
+
 	/**
 	 * null-terminated enum 네임 반환
 	 */
@@ -187,9 +212,7 @@ namespace EnumReflection
 		if (RawName.empty()) return "";
 
 		// 정확한 크기 계산
-		constexpr size_t NameSize = RawName.size();
-		static constexpr EnumNameHolder<EnumType, Value, NameSize> holder{RawName};
-		return holder.data;
+		return EnumNameStorage<EnumType, Value>.data;
 	}
 
 	/**
@@ -259,11 +282,11 @@ namespace EnumReflection
 
 		static constexpr size_t GetCount() noexcept
 		{
+			// MakeEnumSequence가 유효한 값만 앞에서부터 채우므로 이름이 있는 칸 수가 곧 개수
 			size_t Count = 0;
 			for (size_t i = 0; i < Range; ++i)
 			{
-				constexpr auto Value = static_cast<EnumType>(i + EnumRange<EnumType>::Min);
-				if constexpr (IsValidEnum<EnumType, Value>())
+				if (Names[i] != nullptr)
 				{
 					++Count;
 				}
@@ -0,0 +1,571 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief 오픈 어드레싱 해시 맵 (SwissTable 방식)
+ *
+ * std::unordered_map과 같은 인터페이스를 제공하지만 원소를 노드가 아닌 연속된 슬롯 배열에 저장한다
+ * - 슬롯마다 1바이트 제어 값(Empty / Deleted / 해시 하위 7비트)을 따로 두고,
+ *   16개 묶음(Group)을 SSE2로 한 번에 비교해서 후보 슬롯만 키 비교를 한다
+ * - Group 단위 이차 탐사, 최대 부하율 7/8
+ * - 삭제된 슬롯은 같은 Group에 빈 슬롯이 있으면 Empty로 되돌리고 아니면 Deleted(Tombstone)로 남긴다
+ *
+ * @note unordered_map과 달리 재해시(삽입 중 용량 증가, reserve)가 일어나면 원소가 이동한다
+ * 원소의 참조/포인터를 삽입 이후까지 들고 있어야 하는 곳에는 쓰지 않는다 (삭제는 다른 원소를 옮기지 않는다)
+ */
+template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>, typename Eq = std::equal_to<KeyType>,
+	typename Alloc = std::allocator<std::pair<const KeyType, ValueType>>>
+class TFlatMap
+{
+public:
+	using key_type = KeyType;
+	using mapped_type = ValueType;
+	using value_type = std::pair<const KeyType, ValueType>;
+	using size_type = std::size_t;
+	using hasher = Hash;
+	using key_equal = Eq;
+	using allocator_type = Alloc;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+
+private:
+	static constexpr size_type GROUP_WIDTH = 16;
+	static constexpr int8_t CTRL_EMPTY = -128;		// 0b10000000
+	static constexpr int8_t CTRL_DELETED = -2;		// 0b11111110
+
+	using FSlotAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<value_type>;
+	using FSlotTraits = std::allocator_traits<FSlotAllocator>;
+
+	template<bool bConst>
+	class TIterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename TFlatMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<bConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<bConst, const value_type&, value_type&>;
+
+		TIterator() = default;
+		TIterator(const int8_t* InCtrl, pointer InSlot, const int8_t* InEnd)
+			: Ctrl(InCtrl), Slot(InSlot), End(InEnd)
+		{
+			SkipEmpty();
+		}
+
+		// iterator -> const_iterator 변환
+		template<bool bOtherConst, typename = std::enable_if_t<bConst && !bOtherConst>>
+		TIterator(const TIterator<bOtherConst>& InOther)
+			: Ctrl(InOther.Ctrl), Slot(InOther.Slot), End(InOther.End)
+		{
+		}
+
+		reference operator*() const { return *Slot; }
+		pointer operator->() const { return Slot; }
+
+		TIterator& operator++()
+		{
+			++Ctrl;
+			++Slot;
+			SkipEmpty();
+			return *this;
+		}
+
+		TIterator operator++(int)
+		{
+			TIterator Temp = *this;
+			++(*this);
+			return Temp;
+		}
+
+		friend bool operator==(const TIterator& InA, const TIterator& InB) { return InA.Ctrl == InB.Ctrl; }
+		friend bool operator!=(const TIterator& InA, const TIterator& InB) { return InA.Ctrl != InB.Ctrl; }
+
+	private:
+		friend class TFlatMap;
+		template<bool> friend class TIterator;
+
+		void SkipEmpty()
+		{
+			while (Ctrl != End && *Ctrl < 0)
+			{
+				++Ctrl;
+				++Slot;
+			}
+		}
+
+		const int8_t* Ctrl = nullptr;
+		pointer Slot = nullptr;
+		const int8_t* End = nullptr;
+	};
+
+public:
+	using iterator = TIterator<false>;
+	using const_iterator = TIterator<true>;
+
+	TFlatMap() = default;
+
+	explicit TFlatMap(size_type InBucketCount)
+	{
+		reserve(InBucketCount);
+	}
+
+	TFlatMap(std::initializer_list<value_type> InList)
+	{
+		reserve(InList.size());
+		for (const value_type& Value : InList)
+		{
+			insert(Value);
+		}
+	}
+
+	TFlatMap(const TFlatMap& InOther)
+		: HashFunction(InOther.HashFunction), KeyEqual(InOther.KeyEqual), SlotAllocator(InOther.SlotAllocator)
+	{
+		reserve(InOther.Size);
+		for (const value_type& Value : InOther)
+		{
+			insert(Value);
+		}
+	}
+
+	TFlatMap(TFlatMap&& InOther) noexcept
+		: HashFunction(std::move(InOther.HashFunction)), KeyEqual(std::move(InOther.KeyEqual)), SlotAllocator(std::move(InOther.SlotAllocator))
+	{
+		StealFrom(InOther);
+	}
+
+	TFlatMap& operator=(const TFlatMap& InOther)
+	{
+		if (this != &InOther)
+		{
+			TFlatMap Copy(InOther);
+			swap(Copy);
+		}
+		return *this;
+	}
+
+	TFlatMap& operator=(TFlatMap&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Release();
+			HashFunction = std::move(InOther.HashFunction);
+			KeyEqual = std::move(InOther.KeyEqual);
+			SlotAllocator = std::move(InOther.SlotAllocator);
+			StealFrom(InOther);
+		}
+		return *this;
+	}
+
+	~TFlatMap()
+	{
+		Release();
+	}
+
+	iterator begin() { return iterator(Ctrl, Slots, Ctrl + Capacity); }
+	iterator end() { return iterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity); }
+	const_iterator begin() const { return const_iterator(Ctrl, Slots, Ctrl + Capacity); }
+	const_iterator end() const { return const_iterator(Ctrl + Capacity, Slots + Capacity, Ctrl + Capacity); }
+	const_iterator cbegin() const { return begin(); }
+	const_iterator cend() const { return end(); }
+
+	size_type size() const { return Size; }
+	bool empty() const { return Size == 0; }
+	size_type bucket_count() const { return Capacity; }
+	float load_factor() const { return Capacity ? static_cast<float>(Size) / static_cast<float>(Capacity) : 0.0f; }
+
+	/** 원소만 제거하고 슬롯 배열은 재사용한다 */
+	void clear()
+	{
+		DestroySlots();
+		if (Ctrl)
+		{
+			std::memset(Ctrl, static_cast<uint8_t>(CTRL_EMPTY), Capacity);
+		}
+		Size = 0;
+		NumDeleted = 0;
+	}
+
+	/** InCount개를 재해시 없이 담을 수 있도록 용량을 늘린다 */
+	void reserve(size_type InCount)
+	{
+		const size_type Required = CapacityFor(InCount);
+		if (Required > Capacity)
+		{
+			Rehash(Required);
+		}
+	}
+
+	iterator find(const KeyType& InKey)
+	{
+		const size_type Index = FindIndex(InKey);
+		return Index == NOT_FOUND ? end() : MakeIterator(Index);
+	}
+
+	const_iterator find(const KeyType& InKey) const
+	{
+		const size_type Index = FindIndex(InKey);
+		return Index == NOT_FOUND ? end() : const_iterator(Ctrl + Index, Slots + Index, Ctrl + Capacity);
+	}
+
+	size_type count(const KeyType& InKey) const { return FindIndex(InKey) == NOT_FOUND ? 0 : 1; }
+	bool contains(const KeyType& InKey) const { return FindIndex(InKey) != NOT_FOUND; }
+
+	ValueType& at(const KeyType& InKey)
+	{
+		const size_type Index = FindIndex(InKey);
+		if (Index == NOT_FOUND)
+		{
+			throw std::out_of_range("TFlatMap::at");
+		}
+		return Slots[Index].second;
+	}
+
+	const ValueType& at(const KeyType& InKey) const
+	{
+		const size_type Index = FindIndex(InKey);
+		if (Index == NOT_FOUND)
+		{
+			throw std::out_of_range("TFlatMap::at");
+		}
+		return Slots[Index].second;
+	}
+
+	ValueType& operator[](const KeyType& InKey) { return try_emplace(InKey).first->second; }
+	ValueType& operator[](KeyType&& InKey) { return try_emplace(std::move(InKey)).first->second; }
+
+	std::pair<iterator, bool> insert(const value_type& InValue) { return try_emplace(InValue.first, InValue.second); }
+	std::pair<iterator, bool> insert(value_type&& InValue) { return try_emplace(InValue.first, std::move(InValue.second)); }
+
+	template<typename PairType, typename = std::enable_if_t<std::is_constructible_v<value_type, PairType&&>>>
+	std::pair<iterator, bool> insert(PairType&& InValue)
+	{
+		return emplace(std::forward<PairType>(InValue));
+	}
+
+	/** unordered_map::emplace와 같이 원소를 먼저 만든 뒤 키가 이미 있으면 버린다 */
+	template<typename... ArgTypes>
+	std::pair<iterator, bool> emplace(ArgTypes&&... InArgs)
+	{
+		value_type Value(std::forward<ArgTypes>(InArgs)...);
+		return try_emplace(Value.first, std::move(Value.second));
+	}
+
+	template<typename KeyArg, typename... ArgTypes>
+	std::pair<iterator, bool> try_emplace(KeyArg&& InKey, ArgTypes&&... InArgs)
+	{
+		const size_t HashValue = HashOf(InKey);
+		size_type Index = FindIndex(InKey, HashValue);
+		if (Index != NOT_FOUND)
+		{
+			return { MakeIterator(Index), false };
+		}
+
+		if (Size + NumDeleted + 1 > MaxLoad(Capacity))
+		{
+			GrowForInsert();
+		}
+
+		Index = FindInsertIndex(HashValue);
+		if (Ctrl[Index] == CTRL_DELETED)
+		{
+			--NumDeleted;
+		}
+		FSlotTraits::construct(SlotAllocator, Slots + Index, std::piecewise_construct,
+			std::forward_as_tuple(std::forward<KeyArg>(InKey)), std::forward_as_tuple(std::forward<ArgTypes>(InArgs)...));
+		Ctrl[Index] = H2(HashValue);
+		++Size;
+		return { MakeIterator(Index), true };
+	}
+
+	template<typename MappedArg>
+	std::pair<iterator, bool> insert_or_assign(const KeyType& InKey, MappedArg&& InValue)
+	{
+		auto Result = try_emplace(InKey, std::forward<MappedArg>(InValue));
+		if (!Result.second)
+		{
+			Result.first->second = std::forward<MappedArg>(InValue);
+		}
+		return Result;
+	}
+
+	size_type erase(const KeyType& InKey)
+	{
+		const size_type Index = FindIndex(InKey);
+		if (Index == NOT_FOUND)
+		{
+			return 0;
+		}
+		EraseAt(Index);
+		return 1;
+	}
+
+	/** 삭제는 다른 원소를 옮기지 않으므로 다음 원소의 반복자를 그대로 돌려줄 수 있다 */
+	iterator erase(const_iterator InPosition)
+	{
+		const size_type Index = static_cast<size_type>(InPosition.Ctrl - Ctrl);
+		EraseAt(Index);
+		return MakeIterator(Index + 1);
+	}
+
+	iterator erase(iterator InPosition) { return erase(const_iterator(InPosition)); }
+
+	void swap(TFlatMap& InOther) noexcept
+	{
+		std::swap(Ctrl, InOther.Ctrl);
+		std::swap(Slots, InOther.Slots);
+		std::swap(Capacity, InOther.Capacity);
+		std::swap(Size, InOther.Size);
+		std::swap(NumDeleted, InOther.NumDeleted);
+		std::swap(HashFunction, InOther.HashFunction);
+		std::swap(KeyEqual, InOther.KeyEqual);
+		std::swap(SlotAllocator, InOther.SlotAllocator);
+	}
+
+private:
+	static constexpr size_type NOT_FOUND = static_cast<size_type>(-1);
+
+	static size_type MaxLoad(size_type InCapacity) { return InCapacity - InCapacity / 8; }
+
+	static size_type CapacityFor(size_type InCount)
+	{
+		if (InCount == 0)
+		{
+			return 0;
+		}
+		size_type NewCapacity = GROUP_WIDTH;
+		while (MaxLoad(NewCapacity) < InCount)
+		{
+			NewCapacity *= 2;
+		}
+		return NewCapacity;
+	}
+
+	/**
+	 * @brief std::hash 결과를 섞어 상위/하위 비트를 고르게 만든다
+	 * 포인터나 정수의 std::hash는 항등 함수라서 그대로 쓰면 정렬된 주소가 같은 Group에 몰린다
+	 */
+	size_t HashOf(const KeyType& InKey) const
+	{
+		uint64_t Value = static_cast<uint64_t>(HashFunction(InKey));
+		Value ^= Value >> 33;
+		Value *= 0xff51afd7ed558ccdull;
+		Value ^= Value >> 33;
+		Value *= 0xc4ceb9fe1a85ec53ull;
+		Value ^= Value >> 33;
+		return static_cast<size_t>(Value);
+	}
+
+	static int8_t H2(size_t InHash) { return static_cast<int8_t>(InHash & 0x7F); }
+	static size_t H1(size_t InHash) { return InHash >> 7; }
+
+	iterator MakeIterator(size_type InIndex) { return iterator(Ctrl + InIndex, Slots + InIndex, Ctrl + Capacity); }
+
+	size_type FindIndex(const KeyType& InKey) const
+	{
+		return Size == 0 ? NOT_FOUND : FindIndex(InKey, HashOf(InKey));
+	}
+
+	size_type FindIndex(const KeyType& InKey, size_t InHash) const
+	{
+		if (Capacity == 0)
+		{
+			return NOT_FOUND;
+		}
+
+		const size_type GroupMask = Capacity / GROUP_WIDTH - 1;
+		const __m128i Tag = _mm_set1_epi8(H2(InHash));
+		const __m128i Empty = _mm_set1_epi8(CTRL_EMPTY);
+
+		size_type Group = H1(InHash) & GroupMask;
+		for (size_type Probe = 1; Probe <= GroupMask + 1; ++Probe)
+		{
+			const __m128i Control = _mm_load_si128(reinterpret_cast<const __m128i*>(Ctrl + Group * GROUP_WIDTH));
+
+			uint32_t Match = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Control, Tag)));
+			while (Match)
+			{
+				const size_type Index = Group * GROUP_WIDTH + CountTrailingZeros(Match);
+				if (KeyEqual(Slots[Index].first, InKey))
+				{
+					return Index;
+				}
+				Match &= Match - 1;
+			}
+
+			// 빈 슬롯이 있는 Group에서 탐사가 끝난다
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(Control, Empty)))
+			{
+				return NOT_FOUND;
+			}
+			Group = (Group + Probe) & GroupMask;
+		}
+		return NOT_FOUND;
+	}
+
+	/** 탐사 순서상 첫 번째 Empty 또는 Deleted 슬롯 (최상위 비트가 켜진 제어 값) */
+	size_type FindInsertIndex(size_t InHash) const
+	{
+		const size_type GroupMask = Capacity / GROUP_WIDTH - 1;
+		size_type Group = H1(InHash) & GroupMask;
+		for (size_type Probe = 1;; ++Probe)
+		{
+			const __m128i Control = _mm_load_si128(reinterpret_cast<const __m128i*>(Ctrl + Group * GROUP_WIDTH));
+			const uint32_t Available = static_cast<uint32_t>(_mm_movemask_epi8(Control));
+			if (Available)
+			{
+				return Group * GROUP_WIDTH + CountTrailingZeros(Available);
+			}
+			Group = (Group + Probe) & GroupMask;
+		}
+	}
+
+	void EraseAt(size_type InIndex)
+	{
+		FSlotTraits::destroy(SlotAllocator, Slots + InIndex);
+		--Size;
+
+		// Group에 빈 슬롯이 이미 있으면 이 Group을 지나쳐 간 탐사는 없으므로 Empty로 되돌려도 된다
+		const size_type GroupStart = InIndex & ~(GROUP_WIDTH - 1);
+		const __m128i Control = _mm_load_si128(reinterpret_cast<const __m128i*>(Ctrl + GroupStart));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(Control, _mm_set1_epi8(CTRL_EMPTY))))
+		{
+			Ctrl[InIndex] = CTRL_EMPTY;
+		}
+		else
+		{
+			Ctrl[InIndex] = CTRL_DELETED;
+			++NumDeleted;
+		}
+	}
+
+	/** Tombstone이 많으면 같은 크기로 정리하고, 아니면 두 배로 늘린다 */
+	void GrowForInsert()
+	{
+		if (Capacity > 0 && Size + 1 <= MaxLoad(Capacity) / 2)
+		{
+			Rehash(Capacity);
+		}
+		else
+		{
+			Rehash(Capacity ? Capacity * 2 : GROUP_WIDTH);
+		}
+	}
+
+	void Rehash(size_type InNewCapacity)
+	{
+		int8_t* OldCtrl = Ctrl;
+		value_type* OldSlots = Slots;
+		const size_type OldCapacity = Capacity;
+
+		Allocate(InNewCapacity);
+
+		for (size_type Index = 0; Index < OldCapacity; ++Index)
+		{
+			if (OldCtrl[Index] >= 0)
+			{
+				value_type& Old = OldSlots[Index];
+				const size_t HashValue = HashOf(Old.first);
+				const size_type NewIndex = FindInsertIndex(HashValue);
+				FSlotTraits::construct(SlotAllocator, Slots + NewIndex, std::move(Old));
+				Ctrl[NewIndex] = H2(HashValue);
+				FSlotTraits::destroy(SlotAllocator, OldSlots + Index);
+			}
+		}
+		NumDeleted = 0;
+
+		if (OldCtrl)
+		{
+			FSlotTraits::deallocate(SlotAllocator, OldSlots, OldCapacity);
+			::operator delete[](OldCtrl, std::align_val_t(GROUP_WIDTH));
+		}
+	}
+
+	void Allocate(size_type InCapacity)
+	{
+		Ctrl = static_cast<int8_t*>(::operator new[](InCapacity, std::align_val_t(GROUP_WIDTH)));
+		std::memset(Ctrl, static_cast<uint8_t>(CTRL_EMPTY), InCapacity);
+		Slots = FSlotTraits::allocate(SlotAllocator, InCapacity);
+		Capacity = InCapacity;
+	}
+
+	void DestroySlots()
+	{
+		if (Size == 0)
+		{
+			return;
+		}
+		for (size_type Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				FSlotTraits::destroy(SlotAllocator, Slots + Index);
+			}
+		}
+	}
+
+	void Release()
+	{
+		DestroySlots();
+		if (Ctrl)
+		{
+			FSlotTraits::deallocate(SlotAllocator, Slots, Capacity);
+			::operator delete[](Ctrl, std::align_val_t(GROUP_WIDTH));
+		}
+		Ctrl = nullptr;
+		Slots = nullptr;
+		Capacity = 0;
+		Size = 0;
+		NumDeleted = 0;
+	}
+
+	void StealFrom(TFlatMap& InOther)
+	{
+		Ctrl = InOther.Ctrl;
+		Slots = InOther.Slots;
+		Capacity = InOther.Capacity;
+		Size = InOther.Size;
+		NumDeleted = InOther.NumDeleted;
+
+		InOther.Ctrl = nullptr;
+		InOther.Slots = nullptr;
+		InOther.Capacity = 0;
+		InOther.Size = 0;
+		InOther.NumDeleted = 0;
+	}
+
+	static size_type CountTrailingZeros(uint32_t InMask)
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		_BitScanForward(&Index, InMask);
+		return Index;
+#else
+		return static_cast<size_type>(__builtin_ctz(InMask));
+#endif
+	}
+
+	int8_t* Ctrl = nullptr;
+	value_type* Slots = nullptr;
+	size_type Capacity = 0;
+	size_type Size = 0;
+	size_type NumDeleted = 0;
+
+	Hash HashFunction;
+	Eq KeyEqual;
+	FSlotAllocator SlotAllocator;
+};
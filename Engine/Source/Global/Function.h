@@ -17,6 +17,16 @@ static void SafeDelete(T& InDynamicObject)
  */
 static FString WideStringToString(const wstring& InString)
 {
+#ifdef GTL_HEADLESS
+	// 헤드리스 빌드는 경로/이름에 ASCII만 쓰므로 코드 포인트를 그대로 옮긴다
+	FString OutString;
+	OutString.reserve(InString.size());
+	for (wchar_t Character : InString)
+	{
+		OutString.push_back(static_cast<char>(Character));
+	}
+	return OutString;
+#else
 	int32 ByteNumber = WideCharToMultiByte(CP_UTF8, 0,
 	                                     InString.c_str(), -1, nullptr, 0, nullptr, nullptr);
 
@@ -26,6 +36,7 @@ static FString WideStringToString(const wstring& InString)
 	                    InString.c_str(), -1, OutString.data(), ByteNumber, nullptr, nullptr);
 
 	return OutString;
+#endif
 }
 
 /**
@@ -35,6 +46,9 @@ static FString WideStringToString(const wstring& InString)
  */
 static wstring StringToWideString(const FString& InString)
 {
+#ifdef GTL_HEADLESS
+	return wstring(InString.begin(), InString.end());
+#else
 	// 필요한 와이드 문자의 개수를 계산
 	int32 WideCharNumber = MultiByteToWideChar(CP_UTF8, 0,
 										  InString.c_str(), -1, nullptr, 0);
@@ -50,6 +64,7 @@ static wstring StringToWideString(const FString& InString)
 	OutString.resize(WideCharNumber - 1);
 
 	return OutString;
+#endif
 }
 
 /**
@@ -65,6 +80,10 @@ static string ConvertCP949ToUTF8(const char* InANSIString)
 		return "";
 	}
 
+#ifdef GTL_HEADLESS
+	return InANSIString;
+#else
+
 	// CP949 -> UTF-8 변환
 	int WideCharacterSize = MultiByteToWideChar(CP_ACP, 0, InANSIString, -1, nullptr, 0);
 	if (WideCharacterSize == 0)
@@ -91,4 +110,5 @@ static string ConvertCP949ToUTF8(const char* InANSIString)
 	}
 
 	return UTF8String;
+#endif
 }
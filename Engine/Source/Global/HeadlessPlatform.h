@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @brief GTL_HEADLESS 빌드에서 windows.h / d3d11.h 대신 포함하는 최소 플랫폼 선언
+ *
+ * 코어 헤더가 포인터/핸들로만 언급하는 D3D11 타입을 전방 선언하고,
+ * 값으로 쓰이는 몇몇 열거형만 D3D11과 같은 값으로 정의한다
+ * 실제 GPU 호출은 헤드리스 타깃에 포함되지 않으며, 렌더링은 FNullRenderBackend가 대신한다
+ */
+
+#include <cstdint>
+#include <immintrin.h>
+
+struct ID3D11Device;
+struct ID3D11DeviceContext;
+struct ID3D11Buffer;
+struct ID3D11Texture2D;
+struct ID3D11ShaderResourceView;
+struct ID3D11UnorderedAccessView;
+struct ID3D11RenderTargetView;
+struct ID3D11DepthStencilView;
+struct ID3D11SamplerState;
+struct ID3D11RasterizerState;
+struct ID3D11DepthStencilState;
+struct ID3D11BlendState;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11ComputeShader;
+struct ID3D11InputLayout;
+struct ID3D11CommandList;
+struct ID3D11Query;
+
+struct HWND__;
+struct HINSTANCE__;
+using HWND = HWND__*;
+using HINSTANCE = HINSTANCE__*;
+using HRESULT = long;
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
+
+enum D3D11_FILL_MODE
+{
+	D3D11_FILL_WIREFRAME = 2,
+	D3D11_FILL_SOLID = 3,
+};
+
+enum D3D11_CULL_MODE
+{
+	D3D11_CULL_NONE = 1,
+	D3D11_CULL_FRONT = 2,
+	D3D11_CULL_BACK = 3,
+};
+
+struct D3D11_VIEWPORT
+{
+	float TopLeftX;
+	float TopLeftY;
+	float Width;
+	float Height;
+	float MinDepth;
+	float MaxDepth;
+};
+
+#ifndef UNREFERENCED_PARAMETER
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+#endif
+
+#ifndef FORCEINLINE
+#define FORCEINLINE inline __attribute__((always_inline))
+#endif
@@ -3,87 +3,38 @@
 #define DT UTimeManager::GetInstance().GetDeltaSeconds()
 
 // UE_LOG Macro 시스템
+// 서식 문자열과 인자만 FLogger 큐에 넣고, 서식화와 표준 출력/파일/콘솔 출력은 로거 스레드가 맡는다 (Core/Public/Logger.h)
 // 기본 UE_LOG (Info 타입)
 #define UE_LOG(fmt, ...) \
-    do { \
-        printf(fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog("" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Info, "", "" fmt, ##__VA_ARGS__)
 
 // 로그 타입별 매크로들
 #define UE_LOG_INFO(fmt, ...) \
-    do { \
-        printf("[INFO] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Info, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Info, "[INFO] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_WARNING(fmt, ...) \
-    do { \
-        printf("[WARNING] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Warning, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Warning, "[WARNING] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_ERROR(fmt, ...) \
-    do { \
-        printf("[ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Error, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Error, "[ERROR] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_SUCCESS(fmt, ...) \
-    do { \
-        printf("[SUCCESS] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Success, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Success, "[SUCCESS] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_SYSTEM(fmt, ...) \
-    do { \
-        printf("[SYSTEM] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::System, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::System, "[SYSTEM] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_DEBUG(fmt, ...) \
-    do { \
-        printf("[DEBUG] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Debug, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Debug, "[DEBUG] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_COMMAND(fmt, ...) \
-    do { \
-        printf("[CMD] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Command, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Command, "[CMD] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_TERMINAL(fmt, ...) \
-    do { \
-        printf("[TERMINAL] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::Terminal, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::Terminal, "[TERMINAL] ", "" fmt, ##__VA_ARGS__)
 
 #define UE_LOG_TERMINAL_ERROR(fmt, ...) \
-    do { \
-        printf("[TERMINAL_ERROR] " fmt "\n", ##__VA_ARGS__); \
-        try { \
-            UConsoleWindow::GetInstance().AddLog(ELogType::TerminalError, "" fmt, ##__VA_ARGS__); \
-        } catch(...) {} \
-    } while(0)
+    FLogger::Log(ELogType::TerminalError, "[TERMINAL_ERROR] ", "" fmt, ##__VA_ARGS__)
 
 /**
  * @brief UENUM 매크로 시스템
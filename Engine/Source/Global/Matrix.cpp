@@ -77,10 +77,16 @@ FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix)
 {
 	FMatrix Result;
 
+	// 오른쪽 행렬의 행은 한 번만 읽는다 (alignas(16)이므로 정렬 로드)
+	const __m128 b0 = _mm_load_ps(InOtherMatrix.Data[0]);
+	const __m128 b1 = _mm_load_ps(InOtherMatrix.Data[1]);
+	const __m128 b2 = _mm_load_ps(InOtherMatrix.Data[2]);
+	const __m128 b3 = _mm_load_ps(InOtherMatrix.Data[3]);
+
 	for (int i = 0; i < 4; ++i)
 	{
 		// Load the row from the left matrix (this)
-		__m128 a = _mm_loadu_ps(Data[i]); // row i
+		__m128 a = _mm_load_ps(Data[i]); // row i
 
 		// Broadcast each element of row 'i'
 		__m128 a0 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0,0,0,0));
@@ -89,16 +95,16 @@ FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix)
 		__m128 a3 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3));
 
 		// Multiply each broadcast with the corresponding row of the right matrix
-		__m128 r0 = _mm_mul_ps(a0, _mm_loadu_ps(InOtherMatrix.Data[0]));
-		__m128 r1 = _mm_mul_ps(a1, _mm_loadu_ps(InOtherMatrix.Data[1]));
-		__m128 r2 = _mm_mul_ps(a2, _mm_loadu_ps(InOtherMatrix.Data[2]));
-		__m128 r3 = _mm_mul_ps(a3, _mm_loadu_ps(InOtherMatrix.Data[3]));
+		__m128 r0 = _mm_mul_ps(a0, b0);
+		__m128 r1 = _mm_mul_ps(a1, b1);
+		__m128 r2 = _mm_mul_ps(a2, b2);
+		__m128 r3 = _mm_mul_ps(a3, b3);
 
 		// Sum them together
 		__m128 res = _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3));
 
 		// Store into Result row
-		_mm_storeu_ps(Result.Data[i], res);
+		_mm_store_ps(Result.Data[i], res);
 	}
 	return Result;
 }
@@ -232,8 +238,8 @@ FMatrix FMatrix::RotationMatrixInverse(const FVector& InOtherVector)
 FMatrix FMatrix::RotationX(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[1][1] = C;
 	Result.Data[1][2] = S;
@@ -249,8 +255,8 @@ FMatrix FMatrix::RotationX(float Radian)
 FMatrix FMatrix::RotationY(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][2] = -S;
@@ -266,8 +272,8 @@ FMatrix FMatrix::RotationY(float Radian)
 FMatrix FMatrix::RotationZ(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][1] = S;
@@ -330,15 +336,51 @@ FMatrix FMatrix::GetModelMatrix(const FVector& Location, const FVector& Rotation
 	return Result;
 }
 
+/**
+ * @brief GetModelMatrix의 역행렬을 TRS에서 바로 만든다
+ * 회전 부분의 행은 서로 직교하고 길이가 스케일이므로 3x3을 전치한 뒤 스케일의 역수로 나누고, 이동은 그 행렬로 변환해 뒤집는다
+ */
 FMatrix FMatrix::GetModelMatrixInverse(const FVector& Location, const FVector& Rotation, const FVector& Scale)
 {
-	FMatrix T = TranslationMatrixInverse(Location);
-	FMatrix R = RotationMatrixInverse(Rotation);
-	FMatrix S = ScaleMatrixInverse(Scale);
-	FMatrix modelMatrixInverse = T * R * S;
+	const float sp = sinf(Rotation.X);
+	const float cp = cosf(Rotation.X);
+	const float sy = sinf(Rotation.Y);
+	const float cy = cosf(Rotation.Y);
+	const float sr = sinf(Rotation.Z);
+	const float cr = cosf(Rotation.Z);
+
+	// GetModelMatrix의 각 행을 스케일로 나눈 단위 벡터와 그 행의 스케일 역수
+	const float InvScale0 = 1.0f / Scale.Y;
+	const float InvScale1 = 1.0f / Scale.Z;
+	const float InvScale2 = 1.0f / Scale.X;
+
+	const FVector Axis0(sp * sy * cr - cp * sr, sp * sy * sr + cp * cr, sp * cy);
+	const FVector Axis1(cp * sy * cr + sp * sr, cp * sy * sr - sp * cr, cp * cy);
+	const FVector Axis2(cy * cr, cy * sr, -sy);
+
+	FMatrix Result;
+	Result.Data[0][0] = Axis0.X * InvScale0;
+	Result.Data[0][1] = Axis1.X * InvScale1;
+	Result.Data[0][2] = Axis2.X * InvScale2;
+	Result.Data[0][3] = 0.0f;
+
+	Result.Data[1][0] = Axis0.Y * InvScale0;
+	Result.Data[1][1] = Axis1.Y * InvScale1;
+	Result.Data[1][2] = Axis2.Y * InvScale2;
+	Result.Data[1][3] = 0.0f;
+
+	Result.Data[2][0] = Axis0.Z * InvScale0;
+	Result.Data[2][1] = Axis1.Z * InvScale1;
+	Result.Data[2][2] = Axis2.Z * InvScale2;
+	Result.Data[2][3] = 0.0f;
+
+	// -Location * R^-1, 각 열은 축 벡터와 위치의 내적
+	Result.Data[3][0] = -(Location.X * Axis0.X + Location.Y * Axis0.Y + Location.Z * Axis0.Z) * InvScale0;
+	Result.Data[3][1] = -(Location.X * Axis1.X + Location.Y * Axis1.Y + Location.Z * Axis1.Z) * InvScale1;
+	Result.Data[3][2] = -(Location.X * Axis2.X + Location.Y * Axis2.Y + Location.Z * Axis2.Z) * InvScale2;
+	Result.Data[3][3] = 1.0f;
 
-	// UE 좌표계로 변환된 물체의 정점을 원래의 Dx 11 왼손좌표계 정점으로 변환
-	return modelMatrixInverse * FMatrix::DxToUE;
+	return Result;
 }
 
 FVector4 FMatrix::VectorMultiply(const FVector4& v, const FMatrix& m)
@@ -346,7 +388,7 @@ FVector4 FMatrix::VectorMultiply(const FVector4& v, const FMatrix& m)
 	FVector4 out;
 
 	// Load the vector [X,Y,Z,W]
-	__m128 vec = _mm_loadu_ps(&v.X);
+	__m128 vec = _mm_load_ps(&v.X);
 
 	// Broadcast each component
 	__m128 vx = _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0,0,0,0)); // X
@@ -355,16 +397,16 @@ FVector4 FMatrix::VectorMultiply(const FVector4& v, const FMatrix& m)
 	__m128 vw = _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3,3,3,3)); // W
 
 	// Multiply with each row of the matrix
-	__m128 r0 = _mm_mul_ps(vx, _mm_loadu_ps(m.Data[0])); // X * row0
-	__m128 r1 = _mm_mul_ps(vy, _mm_loadu_ps(m.Data[1])); // Y * row1
-	__m128 r2 = _mm_mul_ps(vz, _mm_loadu_ps(m.Data[2])); // Z * row2
-	__m128 r3 = _mm_mul_ps(vw, _mm_loadu_ps(m.Data[3])); // W * row3
+	__m128 r0 = _mm_mul_ps(vx, _mm_load_ps(m.Data[0])); // X * row0
+	__m128 r1 = _mm_mul_ps(vy, _mm_load_ps(m.Data[1])); // Y * row1
+	__m128 r2 = _mm_mul_ps(vz, _mm_load_ps(m.Data[2])); // Z * row2
+	__m128 r3 = _mm_mul_ps(vw, _mm_load_ps(m.Data[3])); // W * row3
 
 	// Sum them together
 	__m128 res = _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3));
 
 	// Store result
-	_mm_storeu_ps(&out.X, res);
+	_mm_store_ps(&out.X, res);
 
 	return out;
 }
@@ -373,8 +415,8 @@ FVector FMatrix::VectorMultiply(const FVector& v, const FMatrix& m)
 {
 	FVector out;
 
-	// Load vector [X, Y, Z, 0]
-	__m128 vec = _mm_set_ps(0.0f, v.Z, v.Y, v.X);
+	// FVector도 alignas(16)이라 4번째 칸(패딩)까지 한 번에 읽고, W는 쓰지 않는다
+	__m128 vec = _mm_load_ps(&v.X);
 
 	// Broadcast each component
 	__m128 vx = _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0,0,0,0)); // X
@@ -382,15 +424,15 @@ FVector FMatrix::VectorMultiply(const FVector& v, const FMatrix& m)
 	__m128 vz = _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2,2,2,2)); // Z
 
 	// Multiply with the first 3 rows of the matrix
-	__m128 r0 = _mm_mul_ps(vx, _mm_loadu_ps(m.Data[0])); // X * row0
-	__m128 r1 = _mm_mul_ps(vy, _mm_loadu_ps(m.Data[1])); // Y * row1
-	__m128 r2 = _mm_mul_ps(vz, _mm_loadu_ps(m.Data[2])); // Z * row2
+	__m128 r0 = _mm_mul_ps(vx, _mm_load_ps(m.Data[0])); // X * row0
+	__m128 r1 = _mm_mul_ps(vy, _mm_load_ps(m.Data[1])); // Y * row1
+	__m128 r2 = _mm_mul_ps(vz, _mm_load_ps(m.Data[2])); // Z * row2
 
 	// Sum them
 	__m128 res = _mm_add_ps(_mm_add_ps(r0, r1), r2);
 
 	// Store result (only XYZ matter)
-	_mm_storeu_ps(&out.X, res);
+	_mm_store_ps(&out.X, res);
 
 	return out;
 }
@@ -399,17 +441,17 @@ FMatrix FMatrix::Transpose() const
 {
 	FMatrix out;
 
-	__m128 row0 = _mm_loadu_ps(Data[0]);
-	__m128 row1 = _mm_loadu_ps(Data[1]);
-	__m128 row2 = _mm_loadu_ps(Data[2]);
-	__m128 row3 = _mm_loadu_ps(Data[3]);
+	__m128 row0 = _mm_load_ps(Data[0]);
+	__m128 row1 = _mm_load_ps(Data[1]);
+	__m128 row2 = _mm_load_ps(Data[2]);
+	__m128 row3 = _mm_load_ps(Data[3]);
 
 	_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
 
-	_mm_storeu_ps(out.Data[0], row0);
-	_mm_storeu_ps(out.Data[1], row1);
-	_mm_storeu_ps(out.Data[2], row2);
-	_mm_storeu_ps(out.Data[3], row3);
+	_mm_store_ps(out.Data[0], row0);
+	_mm_store_ps(out.Data[1], row1);
+	_mm_store_ps(out.Data[2], row2);
+	_mm_store_ps(out.Data[3], row3);
 
 	return out;
 }
@@ -422,28 +464,140 @@ float FMatrix::Determinant() const
 		- Data[0][3] * (Data[1][0] * (Data[2][1] * Data[3][2] - Data[2][2] * Data[3][1]) - Data[1][1] * (Data[2][0] * Data[3][2] - Data[2][2] * Data[3][0]) + Data[1][2] * (Data[2][0] * Data[3][1] - Data[2][1] * Data[3][0]));
 }
 
+namespace
+{
+	// 2x2 행렬을 (m00, m01, m10, m11) 순서로 담은 레지스터끼리의 곱
+	inline __m128 Mat2Mul(__m128 A, __m128 B)
+	{
+		return _mm_add_ps(
+			_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// adj(A) * B
+	inline __m128 Mat2AdjMul(__m128 A, __m128 B)
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	// A * adj(B)
+	inline __m128 Mat2MulAdj(__m128 A, __m128 B)
+	{
+		return _mm_sub_ps(
+			_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+			_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// (A.yzx * B.zxy - A.zxy * B.yzx), W는 0이 된다
+	inline __m128 Cross3(__m128 A, __m128 B)
+	{
+		const __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 Result = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+		return _mm_shuffle_ps(Result, Result, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+}
+
+/**
+ * @brief 일반 4x4 역행렬 (2x2 블록 분해, SSE)
+ * 행렬식이 0에 가까우면 기존과 같이 항등행렬을 돌려준다
+ */
 FMatrix FMatrix::Inverse() const
 {
-	FMatrix Inv = {};
-	float Det = Determinant();
-	if (fabs(Det) < std::numeric_limits<float>::epsilon()) { return FMatrix::Identity(); }
-	float InvDet = 1.0f / Det;
-	Inv.Data[0][0] = (Data[1][1] * (Data[2][2] * Data[3][3] - Data[2][3] * Data[3][2]) - Data[1][2] * (Data[2][1] * Data[3][3] - Data[2][3] * Data[3][1]) + Data[1][3] * (Data[2][1] * Data[3][2] - Data[2][2] * Data[3][1])) * InvDet;
-	Inv.Data[0][1] = -(Data[0][1] * (Data[2][2] * Data[3][3] - Data[2][3] * Data[3][2]) - Data[0][2] * (Data[2][1] * Data[3][3] - Data[2][3] * Data[3][1]) + Data[0][3] * (Data[2][1] * Data[3][2] - Data[2][2] * Data[3][1])) * InvDet;
-	Inv.Data[0][2] = (Data[0][1] * (Data[1][2] * Data[3][3] - Data[1][3] * Data[3][2]) - Data[0][2] * (Data[1][1] * Data[3][3] - Data[1][3] * Data[3][1]) + Data[0][3] * (Data[1][1] * Data[3][2] - Data[1][2] * Data[3][1])) * InvDet;
-	Inv.Data[0][3] = -(Data[0][1] * (Data[1][2] * Data[2][3] - Data[1][3] * Data[2][2]) - Data[0][2] * (Data[1][1] * Data[2][3] - Data[1][3] * Data[2][1]) + Data[0][3] * (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1])) * InvDet;
-	Inv.Data[1][0] = -(Data[1][0] * (Data[2][2] * Data[3][3] - Data[2][3] * Data[3][2]) - Data[1][2] * (Data[2][0] * Data[3][3] - Data[2][3] * Data[3][0]) + Data[1][3] * (Data[2][0] * Data[3][2] - Data[2][2] * Data[3][0])) * InvDet;
-	Inv.Data[1][1] = (Data[0][0] * (Data[2][2] * Data[3][3] - Data[2][3] * Data[3][2]) - Data[0][2] * (Data[2][0] * Data[3][3] - Data[2][3] * Data[3][0]) + Data[0][3] * (Data[2][0] * Data[3][2] - Data[2][2] * Data[3][0])) * InvDet;
-	Inv.Data[1][2] = -(Data[0][0] * (Data[1][2] * Data[3][3] - Data[1][3] * Data[3][2]) - Data[0][2] * (Data[1][0] * Data[3][3] - Data[1][3] * Data[3][0]) + Data[0][3] * (Data[1][0] * Data[3][2] - Data[1][2] * Data[3][0])) * InvDet;
-	Inv.Data[1][3] = (Data[0][0] * (Data[1][2] * Data[2][3] - Data[1][3] * Data[2][2]) - Data[0][2] * (Data[1][0] * Data[2][3] - Data[1][3] * Data[2][0]) + Data[0][3] * (Data[1][0] * Data[2][2] - Data[1][2] * Data[2][0])) * InvDet;
-	Inv.Data[2][0] = (Data[1][0] * (Data[2][1] * Data[3][3] - Data[2][3] * Data[3][1]) - Data[1][1] * (Data[2][0] * Data[3][3] - Data[2][3] * Data[3][0]) + Data[1][3] * (Data[2][0] * Data[3][1] - Data[2][1] * Data[3][0])) * InvDet;
-	Inv.Data[2][1] = -(Data[0][0] * (Data[2][1] * Data[3][3] - Data[2][3] * Data[3][1]) - Data[0][1] * (Data[2][0] * Data[3][3] - Data[2][3] * Data[3][0]) + Data[0][3] * (Data[2][0] * Data[3][1] - Data[2][1] * Data[3][0])) * InvDet;
-	Inv.Data[2][2] = (Data[0][0] * (Data[1][1] * Data[3][3] - Data[1][3] * Data[3][1]) - Data[0][1] * (Data[1][0] * Data[3][3] - Data[1][3] * Data[3][0]) + Data[0][3] * (Data[1][0] * Data[3][1] - Data[1][1] * Data[3][0])) * InvDet;
-	Inv.Data[2][3] = -(Data[0][0] * (Data[1][1] * Data[2][3] - Data[1][3] * Data[2][1]) - Data[0][1] * (Data[1][0] * Data[2][3] - Data[1][3] * Data[2][0]) + Data[0][3] * (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0])) * InvDet;
-	Inv.Data[3][0] = -(Data[1][0] * (Data[2][1] * Data[3][2] - Data[2][2] * Data[3][1]) - Data[1][1] * (Data[2][0] * Data[3][2] - Data[2][2] * Data[3][0]) + Data[1][2] * (Data[2][0] * Data[3][1] - Data[2][1] * Data[3][0])) * InvDet;
-	Inv.Data[3][1] = (Data[0][0] * (Data[2][1] * Data[3][2] - Data[2][2] * Data[3][1]) - Data[0][1] * (Data[2][0] * Data[3][2] - Data[2][2] * Data[3][0]) + Data[0][2] * (Data[2][0] * Data[3][1] - Data[2][1] * Data[3][0])) * InvDet;
-	Inv.Data[3][2] = -(Data[0][0] * (Data[1][1] * Data[3][2] - Data[1][2] * Data[3][1]) - Data[0][1] * (Data[1][0] * Data[3][2] - Data[1][2] * Data[3][0]) + Data[0][2] * (Data[1][0] * Data[3][1] - Data[1][1] * Data[3][0])) * InvDet;
-	Inv.Data[3][3] = (Data[0][0] * (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1]) - Data[0][1] * (Data[1][0] * Data[2][2] - Data[1][2] * Data[2][0]) + Data[0][2] * (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0])) * InvDet;
+	const __m128 Row0 = _mm_load_ps(Data[0]);
+	const __m128 Row1 = _mm_load_ps(Data[1]);
+	const __m128 Row2 = _mm_load_ps(Data[2]);
+	const __m128 Row3 = _mm_load_ps(Data[3]);
+
+	// | A B |
+	// | C D | 로 나눈 2x2 블록
+	const __m128 A = _mm_movelh_ps(Row0, Row1);
+	const __m128 B = _mm_movehl_ps(Row1, Row0);
+	const __m128 C = _mm_movelh_ps(Row2, Row3);
+	const __m128 D = _mm_movehl_ps(Row3, Row2);
+
+	// (|A|, |B|, |C|, |D|)
+	const __m128 DetSub = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(Row0, Row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(Row1, Row3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(Row0, Row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(Row1, Row3, _MM_SHUFFLE(2, 0, 2, 0))));
+	const __m128 DetA = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+	const __m128 DetB = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128 DetC = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+	const __m128 DetD = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+	const __m128 DAdjC = Mat2AdjMul(D, C);
+	const __m128 AAdjB = Mat2AdjMul(A, B);
+
+	// 역행렬 = 1/|M| * | X Y |, 아래는 각 블록의 수반 행렬
+	//                  | Z W |
+	__m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, DAdjC));
+	__m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, AAdjB));
+	__m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, AAdjB));
+	__m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, DAdjC));
+
+	// |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+	__m128 Trace = _mm_mul_ps(AAdjB, _mm_shuffle_ps(DAdjC, DAdjC, _MM_SHUFFLE(3, 1, 2, 0)));
+	Trace = _mm_hadd_ps(Trace, Trace);
+	Trace = _mm_hadd_ps(Trace, Trace);
+	const __m128 DetM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC)), Trace);
+
+	if (fabs(_mm_cvtss_f32(DetM)) < std::numeric_limits<float>::epsilon()) { return FMatrix::Identity(); }
+
+	const __m128 InvDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), DetM);
+	X = _mm_mul_ps(X, InvDetM);
+	Y = _mm_mul_ps(Y, InvDetM);
+	Z = _mm_mul_ps(Z, InvDetM);
+	W = _mm_mul_ps(W, InvDetM);
+
+	// 수반 행렬 셔플과 블록 배치를 한 번에 한다
+	FMatrix Inv;
+	_mm_store_ps(Inv.Data[0], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(Inv.Data[1], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_store_ps(Inv.Data[2], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_store_ps(Inv.Data[3], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
 	return Inv;
 }
 
+/**
+ * @brief 마지막 열이 (0, 0, 0, 1)인 아핀 행렬의 역행렬 (SSE)
+ * 3x3은 행 벡터의 외적으로 구하고 이동은 -T * 3x3^-1, 부모의 비균등 스케일로 생긴 기울임(shear)도 정확하다
+ */
+FMatrix FMatrix::InverseAffine() const
+{
+	const __m128 Row0 = _mm_load_ps(Data[0]);
+	const __m128 Row1 = _mm_load_ps(Data[1]);
+	const __m128 Row2 = _mm_load_ps(Data[2]);
+	const __m128 Row3 = _mm_load_ps(Data[3]);
+
+	// 3x3^-1의 열 = (Row1 x Row2, Row2 x Row0, Row0 x Row1) / |3x3|
+	__m128 Col0 = Cross3(Row1, Row2);
+	__m128 Col1 = Cross3(Row2, Row0);
+	__m128 Col2 = Cross3(Row0, Row1);
+
+	const __m128 Det = _mm_dp_ps(Row0, Col0, 0x7F);
+	if (fabs(_mm_cvtss_f32(Det)) < std::numeric_limits<float>::epsilon()) { return FMatrix::Identity(); }
+
+	const __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+	Col0 = _mm_mul_ps(Col0, InvDet);
+	Col1 = _mm_mul_ps(Col1, InvDet);
+	Col2 = _mm_mul_ps(Col2, InvDet);
+
+	// 열 -> 행 (W는 외적에서 0)
+	__m128 Col3 = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(Col0, Col1, Col2, Col3);
+
+	// -T * 3x3^-1
+	const __m128 Translation = _mm_sub_ps(_mm_setzero_ps(), _mm_add_ps(_mm_add_ps(
+		_mm_mul_ps(_mm_shuffle_ps(Row3, Row3, _MM_SHUFFLE(0, 0, 0, 0)), Col0),
+		_mm_mul_ps(_mm_shuffle_ps(Row3, Row3, _MM_SHUFFLE(1, 1, 1, 1)), Col1)),
+		_mm_mul_ps(_mm_shuffle_ps(Row3, Row3, _MM_SHUFFLE(2, 2, 2, 2)), Col2)));
+
+	FMatrix Inv;
+	_mm_store_ps(Inv.Data[0], Col0);
+	_mm_store_ps(Inv.Data[1], Col1);
+	_mm_store_ps(Inv.Data[2], Col2);
+	_mm_store_ps(Inv.Data[3], _mm_blend_ps(Translation, _mm_set1_ps(1.0f), 0x8));
+	return Inv;
+}
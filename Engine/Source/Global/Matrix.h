@@ -84,6 +84,9 @@ struct alignas(16) FMatrix
 
 	static FMatrix GetModelMatrix(const FVector& Location, const FVector& Rotation, const FVector& Scale);
 
+	/**
+	* @brief GetModelMatrix의 역행렬을 TRS에서 바로 계산 (전치 + 스케일 역수, 일반 역행렬보다 훨씬 싸다)
+	*/
 	static FMatrix GetModelMatrixInverse(const FVector& Location, const FVector& Rotation, const FVector& Scale);
 
 	static FVector4 VectorMultiply(const FVector4&, const FMatrix&);
@@ -95,4 +98,9 @@ struct alignas(16) FMatrix
 	float Determinant() const;
 
 	FMatrix Inverse() const;
+
+	/**
+	* @brief 아핀 행렬(마지막 열이 0, 0, 0, 1) 전용 역행렬, 월드/모델 행렬은 Inverse 대신 이것을 쓴다
+	*/
+	FMatrix InverseAffine() const;
 };
@@ -5,9 +5,9 @@
 
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+std::atomic<uint32> TotalAllocationBytes{ 0 };
+std::atomic<uint32> TotalAllocationCount{ 0 };
+std::atomic<uint64> TotalAllocationCalls{ 0 };
 
 /**
  * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
@@ -16,8 +16,9 @@ uint32 TotalAllocationCount = 0;
  */
 void* operator new(size_t InSize)
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationCalls.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), std::memory_order_relaxed);
 
 	// Debug Print
 	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
@@ -48,27 +49,28 @@ void operator delete(void* InMemory) noexcept
 	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
 	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
 
-	if (TotalAllocationCount > 0)
-	{
-		--TotalAllocationCount;
-	}
-	else
+	// 먼저 빼고 이전 값으로 검사한다, 잘못된 해제라면 되돌려 카운터가 음수로 감기지 않게 한다
+	if (TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed) == 0)
 	{
+		TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
 		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
 	}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
-	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
-	}
-	else
+	if (TotalAllocationBytes.fetch_sub(static_cast<uint32>(MemoryAllocSize), std::memory_order_relaxed) < MemoryAllocSize)
 	{
+		TotalAllocationBytes.fetch_add(static_cast<uint32>(MemoryAllocSize), std::memory_order_relaxed);
 		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
 	}
 
 	if (MemoryHeader->bIsAligned)
 	{
-		_aligned_free(MemoryHeader);
+		// 정렬 할당은 헤더 앞에 실제 할당 시작 주소를 기록해 둔다
+		void* AllocationBase = *(reinterpret_cast<void**>(MemoryHeader) - 1);
+#ifdef _MSC_VER
+		_aligned_free(AllocationBase);
+#else
+		free(AllocationBase);
+#endif
 	}
 	else
 	{
@@ -99,34 +101,56 @@ void operator delete[](void* InMemory) noexcept
 // C++17에서 추가로 제공된 Align된 메모리에 대한 오버로딩 함수
 // SIMD 타입이 추후 필요한 것으로 보고 미리 구현해 둠
 
+/**
+ * @brief 정렬 요구가 있는 타입(alignas)을 위한 할당
+ * 레이아웃: [패딩][시작 주소][AllocHeader][객체], 헤더 + 시작 주소 자리를 정렬값의 배수로 잡아 객체 주소가 정렬되게 한다
+ * operator delete는 헤더 바로 앞의 시작 주소로 해제한다
+ */
 void* operator new(size_t InSize, align_val_t InAlignment)
 {
-	size_t Alignment = static_cast<size_t>(InAlignment);
+	const size_t Alignment = std::max(static_cast<size_t>(InAlignment), alignof(void*));
 
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationCalls.fetch_add(1, std::memory_order_relaxed);
+	TotalAllocationBytes.fetch_add(static_cast<uint32>(InSize), std::memory_order_relaxed);
 
-	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
-	size_t TotalSize = sizeof(AllocHeader) + InSize;
+	const size_t HeaderSize = (sizeof(void*) + sizeof(AllocHeader) + Alignment - 1) & ~(Alignment - 1);
 
-	// aligned_alloc 사용
-	// 크기는 정렬값의 배수로 처리해야 함
-	size_t AlignedTotalSize = (TotalSize + Alignment - 1) & ~(Alignment - 1);
+	// aligned_alloc 크기는 정렬값의 배수로 처리해야 함
+	const size_t AlignedTotalSize = (HeaderSize + InSize + Alignment - 1) & ~(Alignment - 1);
 
 #ifdef _MSC_VER
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
+	uint8* AllocationBase = static_cast<uint8*>(_aligned_malloc(AlignedTotalSize, Alignment));
 #else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
+	uint8* AllocationBase = static_cast<uint8*>(std::aligned_alloc(Alignment, AlignedTotalSize));
 #endif
+	if (!AllocationBase)
+	{
+		throw std::bad_alloc();
+	}
+
+	uint8* Memory = AllocationBase + HeaderSize;
+	AllocHeader* MemoryHeader = reinterpret_cast<AllocHeader*>(Memory) - 1;
+	*(reinterpret_cast<void**>(MemoryHeader) - 1) = AllocationBase;
 
 	// 실제 할당된 크기를 저장
 	MemoryHeader->size = InSize;
 	MemoryHeader->bIsAligned = true;
 
-	return MemoryHeader + 1;
+	return Memory;
 }
 
 void operator delete(void* InMemory, align_val_t InAlignment) noexcept
 {
 	::operator delete(InMemory);
 }
+
+void* operator new[](size_t InSize, align_val_t InAlignment)
+{
+	return ::operator new(InSize, InAlignment);
+}
+
+void operator delete[](void* InMemory, align_val_t InAlignment) noexcept
+{
+	::operator delete(InMemory);
+}
@@ -1,7 +1,12 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+#include <atomic>
+
+// 작업 스레드, 로거, 렌더 스레드, 애셋 로더가 동시에 할당하므로 카운터는 모두 atomic (순서 보장은 필요 없다)
+extern std::atomic<uint32> TotalAllocationBytes;
+extern std::atomic<uint32> TotalAllocationCount;
+// 해제해도 줄지 않는 누적 할당 횟수 (구간 사이의 차이로 할당 횟수를 잰다)
+extern std::atomic<uint64> TotalAllocationCalls;
 
 struct AllocHeader
 {
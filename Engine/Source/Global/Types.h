@@ -11,6 +11,14 @@
 #include <vector>
 #include <functional>
 
+#include "Global/FlatMap.h"
+
+// 1이면 TMap 전체가 TFlatMap(오픈 어드레싱)을 쓴다
+// TFlatMap은 재해시 때 원소가 이동하므로, 원소 주소를 들고 있는 맵이 없는지 확인한 뒤에 켠다
+#ifndef TMAP_USE_FLAT_MAP
+#define TMAP_USE_FLAT_MAP 0
+#endif
+
 template<typename T, typename Alloc = std::allocator<T>>
 using TArray = std::vector<T, Alloc>;
 template<typename T, typename Alloc = std::allocator<T>>
@@ -19,8 +27,13 @@ template<typename T, typename Alloc = std::allocator<T>>
 using TDoubleLinkedList = std::list<T, Alloc>;
 template<typename T, typename Hash = std::hash<T>, typename Eq = std::equal_to<T>, typename Alloc = std::allocator<T>>
 using TSet = std::unordered_set<T, Hash, Eq, Alloc>;
+#if TMAP_USE_FLAT_MAP
+template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>, typename Eq = std::equal_to<KeyType>, typename Alloc = std::allocator<std::pair<const KeyType, ValueType>>>
+using TMap = TFlatMap<KeyType, ValueType, Hash, Eq, Alloc>;
+#else
 template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>, typename Eq = std::equal_to<KeyType>, typename Alloc = std::allocator<std::pair<const KeyType, ValueType>>>
 using TMap = std::unordered_map<KeyType, ValueType, Hash, Eq, Alloc>;
+#endif
 template<typename T1, typename T2>
 using TPair = std::pair<T1, T2>;
 template<typename T, size_t N>
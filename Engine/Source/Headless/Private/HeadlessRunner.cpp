@@ -0,0 +1,740 @@
+#include "pch.h"
+#include "Headless/Public/HeadlessRunner.h"
+
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Component/Mesh/Public/VertexDatas.h"
+#include "Core/Public/ScopeCycleCounter.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
+#include "Utility/Public/JsonSerializer.h"
+
+#include <json.hpp>
+
+using JSON = json::JSON;
+
+namespace
+{
+	/**
+	 * @brief .scene의 Type 문자열을 헤드리스 프리미티브 타입으로 변환 (FActorTypeMapper와 같은 규칙)
+	 * StaticMeshComp는 OBJ를 읽지 않고 기본 메쉬(Cube)와 같은 바운드로 취급한다
+	 */
+	EPrimitiveType TypeStringToPrimitiveType(const FString& InTypeString)
+	{
+		if (InTypeString == "Cube" || InTypeString == "StaticMeshComp")
+		{
+			return EPrimitiveType::Cube;
+		}
+		if (InTypeString == "Sphere")
+		{
+			return EPrimitiveType::Sphere;
+		}
+		if (InTypeString == "Triangle")
+		{
+			return EPrimitiveType::Triangle;
+		}
+		if (InTypeString == "Square")
+		{
+			return EPrimitiveType::Square;
+		}
+		return EPrimitiveType::None;
+	}
+
+	const TArray<FNormalVertex>* GetPrimitiveVertices(EPrimitiveType InType)
+	{
+		switch (InType)
+		{
+		case EPrimitiveType::Cube:
+			return &VerticesCube;
+		case EPrimitiveType::Sphere:
+			return &VerticesSphere;
+		case EPrimitiveType::Triangle:
+			return &VerticesTriangle;
+		case EPrimitiveType::Square:
+			return &VerticesSquare;
+		default:
+			return nullptr;
+		}
+	}
+
+	const TArray<uint32>* GetPrimitiveIndices(EPrimitiveType InType)
+	{
+		return InType == EPrimitiveType::Cube ? &IndicesCube : nullptr;
+	}
+
+	FBox ComputeLocalBounds(EPrimitiveType InType)
+	{
+		FBox Bounds = FBox::Empty();
+		if (const TArray<FNormalVertex>* Vertices = GetPrimitiveVertices(InType))
+		{
+			for (const FNormalVertex& Vertex : *Vertices)
+			{
+				Bounds.ExpandPoint(Vertex.Position);
+			}
+		}
+		return Bounds;
+	}
+
+	// Null 백엔드에 넘길 가짜 파이프라인 핸들 (주소만 식별자로 쓴다)
+	uint8 GHeadlessPipelineTokens[4] = {};
+
+	constexpr uint32 MAX_HEADLESS_OCCLUDERS = 16;
+	constexpr float MIN_HEADLESS_OCCLUDER_SCREEN_AREA = 0.01f;
+
+	// 구 메쉬의 면은 반지름 1 구 안쪽에 있으므로 PVS 베이크에서는 이 비율만큼 줄인 구로 가림을 판정한다
+	constexpr float PVS_SPHERE_INSET = 0.98f;
+}
+
+void FHeadlessStageTimer::AddSample(double InMs)
+{
+	TotalMs += InMs;
+	MinMs = std::min(MinMs, InMs);
+	MaxMs = std::max(MaxMs, InMs);
+	++NumSamples;
+}
+
+bool FHeadlessRunner::LoadScene(const FHeadlessRunnerOptions& InOptions)
+{
+	Options = InOptions;
+	Primitives.clear();
+
+	JSON SceneJson;
+	if (!FJsonSerializer::LoadJsonFromFile(SceneJson, Options.ScenePath))
+	{
+		UE_LOG_ERROR("Headless: 씬 파일을 열 수 없습니다: %s", Options.ScenePath.c_str());
+		return false;
+	}
+
+	float FovY = 60.0f;
+	float NearClip = 0.1f;
+	JSON CameraJson;
+	if (FJsonSerializer::ReadObject(SceneJson, "PerspectiveCamera", CameraJson, nullptr, false))
+	{
+		FJsonSerializer::ReadArrayFloat(CameraJson, "FOV", FovY, 60.0f, false);
+		FJsonSerializer::ReadArrayFloat(CameraJson, "NearClip", NearClip, 0.1f, false);
+		FJsonSerializer::ReadArrayFloat(CameraJson, "FarClip", FarClip, 1000.0f, false);
+	}
+
+	TMap<EPrimitiveType, FBox> LocalBoundsCache;
+
+	JSON PrimitivesJson;
+	if (FJsonSerializer::ReadObject(SceneJson, "Primitives", PrimitivesJson))
+	{
+		for (auto& Pair : PrimitivesJson.ObjectRange())
+		{
+			JSON& PrimitiveDataJson = Pair.second;
+
+			FString TypeString;
+			FJsonSerializer::ReadString(PrimitiveDataJson, "Type", TypeString);
+			const EPrimitiveType Type = TypeStringToPrimitiveType(TypeString);
+			if (Type == EPrimitiveType::None)
+			{
+				UE_LOG_WARNING("Headless: 지원하지 않는 프리미티브 타입입니다: %s", TypeString.c_str());
+				continue;
+			}
+
+			FVector Location;
+			FVector Rotation;
+			FVector Scale;
+			FJsonSerializer::ReadVector(PrimitiveDataJson, "Location", Location, FVector::ZeroVector());
+			FJsonSerializer::ReadVector(PrimitiveDataJson, "Rotation", Rotation, FVector::ZeroVector());
+			FJsonSerializer::ReadVector(PrimitiveDataJson, "Scale", Scale, FVector::OneVector());
+
+			auto Iter = LocalBoundsCache.find(Type);
+			if (Iter == LocalBoundsCache.end())
+			{
+				Iter = LocalBoundsCache.emplace(Type, ComputeLocalBounds(Type)).first;
+			}
+
+			FHeadlessPrimitive Primitive;
+			Primitive.Type = Type;
+			// UPrimitiveComponent::GetWorldTransformMatrix와 같은 규칙 (회전은 Degree로 저장된다)
+			Primitive.World = FMatrix::GetModelMatrix(Location, FVector::GetDegreeToRadian(Rotation), Scale);
+			Primitive.LocalBounds = Iter->second;
+			Primitive.WorldBounds = Primitive.LocalBounds.TransformBy(Primitive.World);
+			Primitives.push_back(Primitive);
+		}
+	}
+
+	if (Primitives.empty())
+	{
+		UE_LOG_ERROR("Headless: 씬에 불러올 프리미티브가 없습니다: %s", Options.ScenePath.c_str());
+		return false;
+	}
+
+	BuildReplicas();
+
+	SceneBounds = FBox::Empty();
+	for (const FHeadlessPrimitive& Primitive : Primitives)
+	{
+		SceneBounds.Expand(Primitive.WorldBounds);
+	}
+
+	// 씬이 FarClip보다 크면 궤도 카메라에서 잘리지 않도록 늘린다
+	const FVector Extent = SceneBounds.GetMax() - SceneBounds.GetMin();
+	FarClip = std::max(FarClip, Extent.Length() * 2.0f);
+
+	const float Aspect = static_cast<float>(Options.ViewportWidth) / static_cast<float>(std::max(Options.ViewportHeight, 1u));
+	const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(FovY) * 0.5f);
+
+	// UCamera::UpdateMatrixByPers와 같은 원근 투영
+	ProjectionMatrix = FMatrix::Identity();
+	ProjectionMatrix.Data[0][0] = F / Aspect;
+	ProjectionMatrix.Data[1][1] = F;
+	ProjectionMatrix.Data[2][2] = FarClip / (FarClip - NearClip);
+	ProjectionMatrix.Data[2][3] = 1.0f;
+	ProjectionMatrix.Data[3][2] = (-NearClip * FarClip) / (FarClip - NearClip);
+	ProjectionMatrix.Data[3][3] = 0.0f;
+
+	OcclusionBuffer.Resize(FSoftwareOcclusionBuffer::DEFAULT_WIDTH, FSoftwareOcclusionBuffer::DEFAULT_HEIGHT);
+	NullBackend.SetRecordCalls(false);
+
+	StageTimers[Stage_Tick].Name = "Tick (world bounds)";
+	StageTimers[Stage_FrustumCull].Name = "Frustum cull";
+	StageTimers[Stage_Occlusion].Name = "Software occlusion";
+	StageTimers[Stage_DrawList].Name = "Draw snapshot";
+	StageTimers[Stage_Submit].Name = "Sort + submit";
+	StageTimers[Stage_Pick].Name = "Pick";
+	for (FHeadlessStageTimer& Timer : StageTimers)
+	{
+		Timer.StatId = FStatRegistry::Register(Timer.Name, "Headless");
+	}
+
+	SetupPVS(SceneJson);
+
+	UE_LOG_SUCCESS("Headless: %s 로드 완료 (프리미티브 %u개)", Options.ScenePath.c_str(), GetNumPrimitives());
+	return true;
+}
+
+/**
+ * @brief 씬에 저장된 PVS가 지금 프리미티브 배치와 맞으면 그대로 쓰고, 아니면 --pvs일 때 베이크한다
+ */
+void FHeadlessRunner::SetupPVS(JSON& InOutSceneJson)
+{
+	PVS.Clear();
+	PVSLookup = FPVSLookup();
+
+	TArray<FBox> Bounds;
+	Bounds.reserve(Primitives.size());
+	for (const FHeadlessPrimitive& Primitive : Primitives)
+	{
+		Bounds.push_back(Primitive.WorldBounds);
+	}
+
+	JSON PVSJson;
+	if (FJsonSerializer::ReadObject(InOutSceneJson, "PVS", PVSJson, nullptr, false))
+	{
+		PVS.Serialize(true, PVSJson);
+		if (!PVS.IsEmpty() && !PVS.Bind(Bounds))
+		{
+			UE_LOG_WARNING("Headless: 저장된 PVS가 씬과 맞지 않아 무시합니다");
+			PVS.Clear();
+		}
+	}
+
+	if (PVS.IsEmpty() && Options.bBakePVS)
+	{
+		FPVSBakeSettings Settings;
+		Settings.MaxCellsPerAxis = Options.PVSCellsPerAxis;
+		const FPVSBakeStats Stats = PVS.Bake(Bounds, [this](uint32 InIndex, const FRay& InRay, float& InOutClosestHit)
+		{
+			return RaycastPrimitive(InIndex, InRay, InOutClosestHit);
+		}, Settings);
+
+		FLogger::Flush();
+		printf("PVS bake   : %u cells, %u primitives, %llu rays, %.2f ms\n", Stats.NumCells, Stats.NumPrimitives,
+			static_cast<unsigned long long>(Stats.NumRays), Stats.BakeMs);
+		printf("PVS data   : %u unique sets, %llu -> %llu bytes, avg visible %.1f%%\n", Stats.NumUniqueSets,
+			static_cast<unsigned long long>(Stats.RawBytes), static_cast<unsigned long long>(Stats.CompressedBytes), Stats.AverageVisibleRatio * 100.0f);
+	}
+
+	if (!Options.PVSOutputPath.empty() && !PVS.IsEmpty())
+	{
+		JSON PVSOutJson = json::Object();
+		PVS.Serialize(false, PVSOutJson);
+		InOutSceneJson["PVS"] = PVSOutJson;
+		if (!FJsonSerializer::SaveJsonToFile(InOutSceneJson, Options.PVSOutputPath))
+		{
+			UE_LOG_ERROR("Headless: PVS를 포함한 씬을 저장할 수 없습니다: %s", Options.PVSOutputPath.c_str());
+		}
+	}
+}
+
+/**
+ * @brief PVS 베이크용 정밀 검사, 월드 레이를 모델 공간으로 옮겨 메쉬 삼각형과 교차한다
+ * 방향을 정규화하지 않으므로 모델 공간 t가 그대로 월드 거리다
+ */
+bool FHeadlessRunner::RaycastPrimitive(uint32 InIndex, const FRay& InRay, float& InOutClosestHit) const
+{
+	const FHeadlessPrimitive& Primitive = Primitives[InIndex];
+	const TArray<FNormalVertex>* Vertices = GetPrimitiveVertices(Primitive.Type);
+	if (!Vertices)
+	{
+		return false;
+	}
+
+	const FMatrix WorldInverse = Primitive.World.InverseAffine();
+	FRay ModelRay = {};
+	ModelRay.Origin = InRay.Origin * WorldInverse;
+	ModelRay.Direction = InRay.Direction * WorldInverse;
+
+	// 구는 삼각형이 많으므로 메쉬 안쪽에 들어가는 조금 작은 구로 검사한다 (덜 가리므로 보수적)
+	if (Primitive.Type == EPrimitiveType::Sphere)
+	{
+		const FVector Origin(ModelRay.Origin.X, ModelRay.Origin.Y, ModelRay.Origin.Z);
+		const FVector Direction(ModelRay.Direction.X, ModelRay.Direction.Y, ModelRay.Direction.Z);
+		const FVector ToOrigin = Origin - Primitive.LocalBounds.GetCenter();
+		const float Radius = (Primitive.LocalBounds.Max[0] - Primitive.LocalBounds.Min[0]) * 0.5f * PVS_SPHERE_INSET;
+
+		const float A = Direction.Dot(Direction);
+		const float B = ToOrigin.Dot(Direction);
+		const float C = ToOrigin.Dot(ToOrigin) - Radius * Radius;
+		const float Discriminant = B * B - A * C;
+		if (A <= 0.0f || Discriminant < 0.0f)
+		{
+			return false;
+		}
+
+		const float SqrtDiscriminant = std::sqrt(Discriminant);
+		float Distance = (-B - SqrtDiscriminant) / A;
+		if (Distance <= 0.0f)
+		{
+			Distance = (-B + SqrtDiscriminant) / A;
+		}
+		if (Distance <= 0.0f || Distance >= InOutClosestHit)
+		{
+			return false;
+		}
+		InOutClosestHit = Distance;
+		return true;
+	}
+
+	const TArray<uint32>* Indices = GetPrimitiveIndices(Primitive.Type);
+	const uint32 NumCorners = Indices ? static_cast<uint32>(Indices->size()) : static_cast<uint32>(Vertices->size());
+
+	bool bHit = false;
+	for (uint32 Corner = 0; Corner + 2 < NumCorners; Corner += 3)
+	{
+		const FVector& V0 = (*Vertices)[Indices ? (*Indices)[Corner] : Corner].Position;
+		const FVector& V1 = (*Vertices)[Indices ? (*Indices)[Corner + 1] : Corner + 1].Position;
+		const FVector& V2 = (*Vertices)[Indices ? (*Indices)[Corner + 2] : Corner + 2].Position;
+
+		float Distance;
+		if (RayHitTriangle_MT(ModelRay, V0, V1 - V0, V2 - V0, InOutClosestHit, Distance))
+		{
+			InOutClosestHit = Distance;
+			bHit = true;
+		}
+	}
+	return bHit;
+}
+
+/**
+ * @brief 원본 씬을 XY 평면 격자로 복제한다 (간격은 원본 씬 바운드 크기)
+ */
+void FHeadlessRunner::BuildReplicas()
+{
+	if (Options.NumReplicas <= 1)
+	{
+		return;
+	}
+
+	FBox SourceBounds = FBox::Empty();
+	for (const FHeadlessPrimitive& Primitive : Primitives)
+	{
+		SourceBounds.Expand(Primitive.WorldBounds);
+	}
+	const FVector Extent = SourceBounds.GetMax() - SourceBounds.GetMin();
+	const float Spacing = std::max(std::max(Extent.X, Extent.Y), 1.0f) * 1.25f;
+
+	const TArray<FHeadlessPrimitive> Source = Primitives;
+	Primitives.clear();
+	Primitives.reserve(Source.size() * Options.NumReplicas * Options.NumReplicas);
+
+	for (uint32 GridY = 0; GridY < Options.NumReplicas; ++GridY)
+	{
+		for (uint32 GridX = 0; GridX < Options.NumReplicas; ++GridX)
+		{
+			const FVector Offset(GridX * Spacing, GridY * Spacing, 0.0f);
+			for (FHeadlessPrimitive Primitive : Source)
+			{
+				Primitive.World.Data[3][0] += Offset.X;
+				Primitive.World.Data[3][1] += Offset.Y;
+				Primitive.WorldBounds = Primitive.LocalBounds.TransformBy(Primitive.World);
+				Primitives.push_back(Primitive);
+			}
+		}
+	}
+}
+
+/**
+ * @brief 스크립트 카메라
+ * 프레임의 앞 절반은 씬 바깥에서 중심을 바라보며 한 바퀴 돌고 (대부분 보임),
+ * 뒤 절반은 씬 안쪽 낮은 높이에서 진행 방향을 바라보며 돈다 (컬링/오클루전이 많이 일어남)
+ */
+void FHeadlessRunner::UpdateCamera(uint32 InFrameIndex)
+{
+	const FVector Center = SceneBounds.GetCenter();
+	const FVector Extent = SceneBounds.GetMax() - SceneBounds.GetMin();
+	const float Radius = std::max(Extent.Length() * 0.5f, 1.0f);
+
+	const float T = static_cast<float>(InFrameIndex) / static_cast<float>(std::max(Options.NumFrames, 1u));
+	const float Angle = T * 4.0f * PI;
+
+	FVector Forward;
+	if (InFrameIndex * 2 < Options.NumFrames)
+	{
+		CameraLocation = Center + FVector(std::cos(Angle) * Radius * 1.5f, std::sin(Angle) * Radius * 1.5f, Radius * 0.35f);
+		Forward = Center - CameraLocation;
+	}
+	else
+	{
+		CameraLocation = Center + FVector(std::cos(Angle) * Radius * 0.5f, std::sin(Angle) * Radius * 0.5f, 0.0f);
+		Forward = FVector(-std::sin(Angle), std::cos(Angle), -0.05f);
+	}
+	Forward.Normalize();
+	FVector Right = Forward.Cross(FVector::UpVector());
+	Right.Normalize();
+	const FVector Up = Right.Cross(Forward);
+
+	// UCamera::UpdateMatrixByPers와 같은 View 행렬
+	FMatrix Translation = FMatrix::TranslationMatrixInverse(CameraLocation);
+	ViewMatrix = Translation * FMatrix(Right, Up, Forward).Transpose();
+	ViewProjMatrix = ViewMatrix * ProjectionMatrix;
+	InverseViewProjMatrix = ViewProjMatrix.Inverse();
+}
+
+void FHeadlessRunner::Run()
+{
+	for (FHeadlessStageTimer& Timer : StageTimers)
+	{
+		Timer = FHeadlessStageTimer{Timer.Name, Timer.StatId};
+	}
+	TotalDrawStats = FDrawStats();
+	TotalVisible = 0;
+	TotalUnoccluded = 0;
+	TotalPVSRejected = 0;
+	TotalPVSFallbackFrames = 0;
+	TotalPickHits = 0;
+	TotalPicks = 0;
+
+	UProfilerManager& Profiler = UProfilerManager::GetInstance();
+	FThreadStats::SetThreadName("Main");
+
+	RenderThread.Start([this](FRenderFrame& InFrame) { SubmitFrame(InFrame); }, Options.bRenderThread);
+
+	FScopeCycleCounter TotalCounter;
+	for (uint32 Frame = 0; Frame < Options.NumFrames; ++Frame)
+	{
+		UpdateCamera(Frame);
+
+		{
+			FScopeCycleCounter Counter(StageTimers[Stage_Tick].StatId);
+			TickFrame();
+			StageTimers[Stage_Tick].AddSample(Counter.Finish());
+		}
+		{
+			FScopeCycleCounter Counter(StageTimers[Stage_FrustumCull].StatId);
+			CullFrame();
+			StageTimers[Stage_FrustumCull].AddSample(Counter.Finish());
+		}
+		{
+			FScopeCycleCounter Counter(StageTimers[Stage_Occlusion].StatId);
+			OcclusionFrame();
+			StageTimers[Stage_Occlusion].AddSample(Counter.Finish());
+		}
+		{
+			FScopeCycleCounter Counter(StageTimers[Stage_DrawList].StatId);
+			DrawFrame(Frame);
+			StageTimers[Stage_DrawList].AddSample(Counter.Finish());
+		}
+		{
+			FScopeCycleCounter Counter(StageTimers[Stage_Pick].StatId);
+			PickFrame();
+			StageTimers[Stage_Pick].AddSample(Counter.Finish());
+		}
+
+		Profiler.EndFrame();
+	}
+
+	// 마지막 프레임까지 제출해야 전체 시간과 드로우 통계가 맞는다
+	RenderThread.Stop();
+	PrintResults(TotalCounter.Finish());
+
+	if (!Options.TracePath.empty())
+	{
+		Profiler.ExportRecentFrames(Options.TracePath, Options.NumFrames);
+	}
+}
+
+/**
+ * @brief 모든 프리미티브의 월드 바운드를 다시 계산한다 (트랜스폼이 매 프레임 바뀌는 최악의 경우)
+ */
+void FHeadlessRunner::TickFrame()
+{
+	for (FHeadlessPrimitive& Primitive : Primitives)
+	{
+		Primitive.WorldBounds = Primitive.LocalBounds.TransformBy(Primitive.World);
+	}
+}
+
+void FHeadlessRunner::CullFrame()
+{
+	Frustum.Update(ViewProjMatrix);
+
+	// 카메라 셀 PVS에 없는 프리미티브는 프러스텀 검사 전에 버린다, 영역 밖이면 프러스텀 컬링만 한다
+	const TArray<uint64>* PVSBits = PVS.FindVisibleBits(CameraLocation, PVSLookup);
+	if (!PVS.IsEmpty() && !PVSBits)
+	{
+		++TotalPVSFallbackFrames;
+	}
+
+	VisibleIndices.clear();
+	for (uint32 Index = 0; Index < static_cast<uint32>(Primitives.size()); ++Index)
+	{
+		if (PVSBits && !FPotentiallyVisibleSet::IsVisible(*PVSBits, Index))
+		{
+			++TotalPVSRejected;
+			continue;
+		}
+		if (Frustum.IsInFrustum(Primitives[Index].WorldBounds) == EFrustumTestResult::Inside)
+		{
+			VisibleIndices.push_back(Index);
+		}
+	}
+	TotalVisible += VisibleIndices.size();
+}
+
+/**
+ * @brief UOcclusionRenderer의 소프트웨어 경로와 같은 순서로 오클루더를 고르고 가시성을 검사한다
+ */
+void FHeadlessRunner::OcclusionFrame()
+{
+	NdcBounds.resize(VisibleIndices.size());
+	TArray<TPair<float, uint32>> Candidates;
+
+	for (size_t Visible = 0; Visible < VisibleIndices.size(); ++Visible)
+	{
+		const FBox& Bounds = Primitives[VisibleIndices[Visible]].WorldBounds;
+
+		FVector4 NdcMin(FLT_MAX, FLT_MAX, FLT_MAX, 1.0f);
+		FVector4 NdcMax(-FLT_MAX, -FLT_MAX, -FLT_MAX, 1.0f);
+		bool bCrossesNearPlane = false;
+		for (int Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector4 Point((Corner & 1) ? Bounds.Max[0] : Bounds.Min[0], (Corner & 2) ? Bounds.Max[1] : Bounds.Min[1],
+				(Corner & 4) ? Bounds.Max[2] : Bounds.Min[2], 1.0f);
+			const FVector4 Clip = FMatrix::VectorMultiply(Point, ViewProjMatrix);
+			if (Clip.W <= 0.0f)
+			{
+				bCrossesNearPlane = true;
+				break;
+			}
+
+			const float InvW = 1.0f / Clip.W;
+			const float X = std::clamp(Clip.X * InvW, -1.0f, 1.0f);
+			const float Y = std::clamp(Clip.Y * InvW, -1.0f, 1.0f);
+			const float Z = std::clamp(Clip.Z * InvW, 0.0f, 1.0f);
+			NdcMin = FVector4(std::min(NdcMin.X, X), std::min(NdcMin.Y, Y), std::min(NdcMin.Z, Z), 1.0f);
+			NdcMax = FVector4(std::max(NdcMax.X, X), std::max(NdcMax.Y, Y), std::max(NdcMax.Z, Z), 1.0f);
+		}
+
+		if (bCrossesNearPlane)
+		{
+			NdcMin = FVector4(-1.0f, -1.0f, 0.0f, 1.0f);
+			NdcMax = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+		}
+		else
+		{
+			const float ScreenArea = (NdcMax.X - NdcMin.X) * (NdcMax.Y - NdcMin.Y) * 0.25f;
+			if (ScreenArea >= MIN_HEADLESS_OCCLUDER_SCREEN_AREA)
+			{
+				Candidates.emplace_back(ScreenArea, static_cast<uint32>(Visible));
+			}
+		}
+		NdcBounds[Visible] = {NdcMin, NdcMax};
+	}
+
+	const size_t NumCandidates = std::min<size_t>(Candidates.size(), MAX_HEADLESS_OCCLUDERS);
+	std::partial_sort(Candidates.begin(), Candidates.begin() + NumCandidates, Candidates.end(),
+		[](const TPair<float, uint32>& A, const TPair<float, uint32>& B) { return A.first > B.first; });
+
+	OcclusionBuffer.Clear();
+	for (size_t Candidate = 0; Candidate < NumCandidates; ++Candidate)
+	{
+		const FHeadlessPrimitive& Primitive = Primitives[VisibleIndices[Candidates[Candidate].second]];
+		const TArray<FNormalVertex>* Vertices = GetPrimitiveVertices(Primitive.Type);
+		const TArray<uint32>* Indices = GetPrimitiveIndices(Primitive.Type);
+
+		FMatrix WorldViewProj = Primitive.World;
+		WorldViewProj *= ViewProjMatrix;
+
+		OccluderClipVertices.resize(Vertices->size());
+		for (size_t Vertex = 0; Vertex < Vertices->size(); ++Vertex)
+		{
+			const FVector& Position = (*Vertices)[Vertex].Position;
+			OccluderClipVertices[Vertex] = FMatrix::VectorMultiply(FVector4(Position.X, Position.Y, Position.Z, 1.0f), WorldViewProj);
+		}
+
+		OcclusionBuffer.AddTriangles(OccluderClipVertices.data(), static_cast<uint32>(OccluderClipVertices.size()),
+			Indices ? Indices->data() : nullptr, Indices ? static_cast<uint32>(Indices->size()) : 0);
+	}
+	OcclusionBuffer.Rasterize();
+
+	UnoccludedIndices.clear();
+	for (size_t Visible = 0; Visible < VisibleIndices.size(); ++Visible)
+	{
+		if (OcclusionBuffer.IsVisible(NdcBounds[Visible].first, NdcBounds[Visible].second))
+		{
+			UnoccludedIndices.push_back(VisibleIndices[Visible]);
+		}
+	}
+	TotalUnoccluded += UnoccludedIndices.size();
+}
+
+/**
+ * @brief URenderer의 프리미티브 기록 경로와 같은 방식으로 프레임 스냅샷에 커맨드를 쌓아 렌더 스레드로 넘긴다
+ */
+void FHeadlessRunner::DrawFrame(uint32 InFrameIndex)
+{
+	FDrawPipelineState PipelineState;
+	PipelineState.InputLayout = &GHeadlessPipelineTokens[0];
+	PipelineState.VertexShader = &GHeadlessPipelineTokens[1];
+	PipelineState.PixelShader = &GHeadlessPipelineTokens[2];
+	PipelineState.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	PipelineState.InstancedVertexShader = &GHeadlessPipelineTokens[3];
+
+	FRenderFrame& RenderFrame = RenderThread.BeginFrame(InFrameIndex, 0.0f);
+	FRenderViewSnapshot& View = RenderFrame.AddView();
+	View.Viewport = FRect{ 0.0f, 0.0f, static_cast<float>(Options.ViewportWidth), static_cast<float>(Options.ViewportHeight) };
+	View.ViewProj.View = ViewMatrix;
+	View.ViewProj.Projection = ProjectionMatrix;
+	View.CameraLocation = CameraLocation;
+	View.FarClip = FarClip;
+
+	FDrawCommandList& DrawCommandList = View.DrawCommands;
+	const uint32 PipelineIndex = DrawCommandList.FindOrAddPipeline(PipelineState);
+
+	for (uint32 Index : UnoccludedIndices)
+	{
+		const FHeadlessPrimitive& Primitive = Primitives[Index];
+		const TArray<FNormalVertex>* Vertices = GetPrimitiveVertices(Primitive.Type);
+		const TArray<uint32>* Indices = GetPrimitiveIndices(Primitive.Type);
+
+		FDrawCommand Command;
+		Command.PipelineIndex = PipelineIndex;
+		Command.TransformIndex = DrawCommandList.AddTransform(Primitive.World);
+		Command.VertexBuffer = const_cast<TArray<FNormalVertex>*>(Vertices);
+		Command.VertexStride = sizeof(FNormalVertex);
+		Command.MeshIndex = DrawCommandList.FindOrAddMesh(Command.VertexBuffer);
+		Command.bUseColor = true;
+		if (Indices)
+		{
+			Command.IndexBuffer = const_cast<TArray<uint32>*>(Indices);
+			Command.IndexCount = static_cast<uint32>(Indices->size());
+		}
+		else
+		{
+			Command.VertexCount = static_cast<uint32>(Vertices->size());
+		}
+
+		const FVector Center = Primitive.WorldBounds.GetCenter();
+		const FVector4 ViewPosition = FMatrix::VectorMultiply(FVector4(Center.X, Center.Y, Center.Z, 1.0f), ViewMatrix);
+		DrawCommandList.AddCommand(Command, EDrawPass::Opaque, ViewPosition.Z, FarClip);
+	}
+
+	RenderThread.EndFrame();
+}
+
+/**
+ * @brief 렌더 스레드(또는 동기 모드의 게임 스레드)에서 스냅샷을 정렬/배칭해 Null 백엔드로 재생한다
+ */
+void FHeadlessRunner::SubmitFrame(FRenderFrame& InFrame)
+{
+	FScopeCycleCounter Counter(StageTimers[Stage_Submit].StatId);
+
+	for (uint32 ViewIndex = 0; ViewIndex < InFrame.GetNumViews(); ++ViewIndex)
+	{
+		FRenderViewSnapshot& View = InFrame.GetView(ViewIndex);
+		View.DrawCommands.Sort();
+		View.DrawCommands.BuildBatches(Options.bEnableInstancing);
+
+		NullBackend.Reset();
+		View.DrawCommands.Submit(NullBackend, View.Stats);
+		TotalDrawStats += View.Stats;
+	}
+
+	StageTimers[Stage_Submit].AddSample(Counter.Finish());
+}
+
+/**
+ * @brief 화면을 격자로 나눈 지점마다 레이를 쏴 가장 가까운 프리미티브 바운드를 찾는다
+ */
+void FHeadlessRunner::PickFrame()
+{
+	const uint32 GridSize = std::max(1u, static_cast<uint32>(std::sqrt(static_cast<float>(Options.NumPicksPerFrame))));
+	for (uint32 GridY = 0; GridY < GridSize; ++GridY)
+	{
+		for (uint32 GridX = 0; GridX < GridSize; ++GridX)
+		{
+			const float NdcX = (static_cast<float>(GridX) + 0.5f) / GridSize * 2.0f - 1.0f;
+			const float NdcY = (static_cast<float>(GridY) + 0.5f) / GridSize * 2.0f - 1.0f;
+
+			FVector4 WorldFar = FMatrix::VectorMultiply(FVector4(NdcX, NdcY, 1.0f, 1.0f), InverseViewProjMatrix);
+			WorldFar *= 1.0f / WorldFar.W;
+
+			FRay Ray = {};
+			Ray.Origin = FVector4(CameraLocation.X, CameraLocation.Y, CameraLocation.Z, 1.0f);
+			Ray.Direction = WorldFar - Ray.Origin;
+			Ray.Direction.W = 0.0f;
+			Ray.Direction.Normalize();
+
+			const FRayQuery Query(Ray);
+			float ClosestDistance = FLT_MAX;
+			bool bHit = false;
+			for (uint32 Index : VisibleIndices)
+			{
+				float EnterDistance;
+				if (Primitives[Index].WorldBounds.IntersectRay(Query, ClosestDistance, EnterDistance))
+				{
+					ClosestDistance = EnterDistance;
+					bHit = true;
+				}
+			}
+
+			++TotalPicks;
+			TotalPickHits += bHit ? 1 : 0;
+		}
+	}
+}
+
+void FHeadlessRunner::PrintResults(double InTotalMs) const
+{
+	const double NumFrames = static_cast<double>(std::max(Options.NumFrames, 1u));
+
+	// 로거 스레드 출력과 결과 표가 섞이지 않도록 먼저 비운다
+	FLogger::Flush();
+	printf("\n");
+	printf("Scene      : %s\n", Options.ScenePath.c_str());
+	printf("Primitives : %u (replicas %ux%u)\n", GetNumPrimitives(), Options.NumReplicas, Options.NumReplicas);
+	printf("Frames     : %u, total %.2f ms (%.3f ms/frame)\n", Options.NumFrames, InTotalMs, InTotalMs / NumFrames);
+	printf("\n%-22s %10s %10s %10s\n", "Stage", "avg ms", "min ms", "max ms");
+	for (const FHeadlessStageTimer& Timer : StageTimers)
+	{
+		printf("%-22s %10.4f %10.4f %10.4f\n", Timer.Name, Timer.GetAverageMs(), Timer.NumSamples ? Timer.MinMs : 0.0, Timer.MaxMs);
+	}
+
+	printf("\nPer frame  : visible %.1f, unoccluded %.1f, draw calls %.1f, instanced draws %.1f, state changes %.1f\n",
+		TotalVisible / NumFrames, TotalUnoccluded / NumFrames, TotalDrawStats.NumDrawCalls / NumFrames,
+		TotalDrawStats.NumInstancedDraws / NumFrames, TotalDrawStats.GetTotalStateChanges() / NumFrames);
+	if (!PVS.IsEmpty())
+	{
+		const double NumTested = static_cast<double>(GetNumPrimitives()) * NumFrames;
+		printf("PVS        : %u cells, rejected %.1f/frame (%.1f%% of primitives) before frustum, %llu cell changes, %llu frames outside region\n",
+			PVS.GetNumCells(), TotalPVSRejected / NumFrames, TotalPVSRejected * 100.0 / NumTested,
+			static_cast<unsigned long long>(PVSLookup.NumCellChanges), static_cast<unsigned long long>(TotalPVSFallbackFrames));
+	}
+	printf("Picks      : %llu rays, %llu hits\n", static_cast<unsigned long long>(TotalPicks), static_cast<unsigned long long>(TotalPickHits));
+	if (Options.bRenderThread)
+	{
+		printf("Render thr : on, game thread waited %.4f ms/frame for a free frame slot\n", RenderThread.GetGameThreadWaitMs() / NumFrames);
+	}
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "Editor/Public/FrustumCull.h"
+#include "Core/Public/ThreadStats.h"
+#include "Manager/BVH/public/PotentiallyVisibleSet.h"
+#include "Physics/Public/Box.h"
+#include "Render/Renderer/Public/DrawCommandList.h"
+#include "Render/Renderer/Public/NullRenderBackend.h"
+#include "Render/Renderer/Public/RenderThread.h"
+#include "Render/Renderer/Public/SoftwareOcclusionBuffer.h"
+
+/**
+ * @brief 헤드리스 러너 실행 옵션
+ */
+struct FHeadlessRunnerOptions
+{
+	FString ScenePath;
+	uint32 NumFrames = 240;
+	// 씬을 축마다 NumReplicas개씩 격자로 복제해 부하를 키운다 (1이면 원본 그대로)
+	uint32 NumReplicas = 1;
+	uint32 NumPicksPerFrame = 64;
+	uint32 ViewportWidth = 1280;
+	uint32 ViewportHeight = 720;
+	bool bEnableInstancing = true;
+	// 드로우 스냅샷 정렬/제출을 렌더 스레드로 넘기고 게임 스레드는 다음 프레임으로 넘어간다
+	bool bRenderThread = false;
+	// 비어 있지 않으면 실행 후 최근 프레임을 Chrome 트레이스 JSON으로 저장한다
+	FString TracePath;
+	// 씬에 맞는 PVS가 저장되어 있지 않으면 베이크해서 프러스텀 컬링 전에 카메라 셀 PVS로 거른다
+	bool bBakePVS = false;
+	uint32 PVSCellsPerAxis = 8;
+	// 비어 있지 않으면 PVS를 포함한 씬을 이 경로로 저장한다
+	FString PVSOutputPath;
+};
+
+/**
+ * @brief .scene 프리미티브 하나를 헤드리스에서 다루기 위한 최소 데이터
+ * 컴포넌트 대신 월드 행렬과 로컬 바운드만 보관한다
+ */
+struct FHeadlessPrimitive
+{
+	EPrimitiveType Type = EPrimitiveType::Cube;
+	FMatrix World;
+	FBox LocalBounds;
+	FBox WorldBounds;
+};
+
+/**
+ * @brief 구간별 프레임 시간 누적기
+ */
+struct FHeadlessStageTimer
+{
+	const char* Name = "";
+	TStatId StatId;
+	double TotalMs = 0.0;
+	double MinMs = DBL_MAX;
+	double MaxMs = 0.0;
+	uint32 NumSamples = 0;
+
+	void AddSample(double InMs);
+	double GetAverageMs() const { return NumSamples > 0 ? TotalMs / NumSamples : 0.0; }
+};
+
+/**
+ * @brief 윈도우/D3D 없이 .scene을 불러와 N 프레임 동안 컬링/오클루전/드로우 기록/피킹을 돌리고 시간을 출력하는 러너
+ *
+ * 에디터 레벨 대신 프리미티브 프록시를 사용하며, 카메라는 씬 바운드를 도는 궤도로 스크립트된다
+ * 렌더링은 FNullRenderBackend로 재생하므로 정렬/배칭/상태 변경 수까지 측정된다
+ * 드로우 기록은 FRenderFrame 스냅샷으로 넘기고, bRenderThread면 정렬/제출이 렌더 스레드에서 다음 프레임과 겹쳐 돈다
+ */
+class FHeadlessRunner
+{
+public:
+	bool LoadScene(const FHeadlessRunnerOptions& InOptions);
+	void Run();
+
+	uint32 GetNumPrimitives() const { return static_cast<uint32>(Primitives.size()); }
+
+private:
+	enum EStage : uint8
+	{
+		Stage_Tick,
+		Stage_FrustumCull,
+		Stage_Occlusion,
+		Stage_DrawList,
+		Stage_Submit,
+		Stage_Pick,
+		Stage_Count
+	};
+
+	void BuildReplicas();
+	void UpdateCamera(uint32 InFrameIndex);
+	void TickFrame();
+	void CullFrame();
+	void OcclusionFrame();
+	void DrawFrame(uint32 InFrameIndex);
+	void SubmitFrame(FRenderFrame& InFrame);
+	void PickFrame();
+	void PrintResults(double InTotalMs) const;
+
+	void SetupPVS(json::JSON& InOutSceneJson);
+	bool RaycastPrimitive(uint32 InIndex, const FRay& InRay, float& InOutClosestHit) const;
+
+	FHeadlessRunnerOptions Options;
+	TArray<FHeadlessPrimitive> Primitives;
+	FBox SceneBounds = FBox::Empty();
+
+	// 스크립트 카메라
+	FVector CameraLocation;
+	FMatrix ViewMatrix;
+	FMatrix ProjectionMatrix;
+	FMatrix ViewProjMatrix;
+	FMatrix InverseViewProjMatrix;
+	float FarClip = 1000.0f;
+
+	FFrustumCull Frustum;
+	FSoftwareOcclusionBuffer OcclusionBuffer;
+	FNullRenderBackend NullBackend;
+	FRenderThread RenderThread;
+
+	// 저장된 것을 읽었거나 베이크한 PVS, 비어 있으면 프러스텀 컬링만 한다
+	FPotentiallyVisibleSet PVS;
+	FPVSLookup PVSLookup;
+
+	// 프레임 작업용 버퍼 (프레임마다 재사용)
+	TArray<uint32> VisibleIndices;
+	TArray<uint32> UnoccludedIndices;
+	TArray<TPair<FVector4, FVector4>> NdcBounds;
+	TArray<FVector4> OccluderClipVertices;
+
+	// Stage_Submit 타이머와 TotalDrawStats는 렌더 함수에서만 쓰고 RenderThread.Stop 이후에 읽는다
+	FHeadlessStageTimer StageTimers[Stage_Count];
+	FDrawStats TotalDrawStats;
+	uint64 TotalVisible = 0;
+	uint64 TotalUnoccluded = 0;
+	uint64 TotalPVSRejected = 0;
+	uint64 TotalPVSFallbackFrames = 0;
+	uint64 TotalPickHits = 0;
+	uint64 TotalPicks = 0;
+};
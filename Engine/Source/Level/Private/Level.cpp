@@ -11,7 +11,9 @@
 #include "Editor/Public/Viewport.h"
 #include "Factory/Public/NewObject.h"
 #include "Manager/Config/Public/ConfigManager.h"
+#include "Manager/Transform/Public/TransformManager.h"
 #include "Manager/UI/Public/UIManager.h"
+#include "Render/Renderer/Public/OcclusionRenderer.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/ActorTypeMapper.h"
 #include "Utility/Public/JsonSerializer.h"
@@ -74,6 +76,14 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				}
 			}
 		}
+
+		// 프리미티브 배치가 바뀌었는지는 BVH를 만든 뒤 처음 컬링할 때 Bind로 확인한다
+		JSON PVSJson;
+		if (FJsonSerializer::ReadObject(InOutHandle, "PVS", PVSJson, nullptr, false))
+		{
+			PVS.Serialize(bInIsLoading, PVSJson);
+			PVSBoundBVHVersion = UINT64_MAX;
+		}
 	}
 
 	// 저장
@@ -99,6 +109,13 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			PrimitivesJson[std::to_string(Actor->GetUUID())] = PrimitiveJson;
 		}
 		InOutHandle["Primitives"] = PrimitivesJson;
+
+		if (!PVS.IsEmpty())
+		{
+			JSON PVSJson = json::Object();
+			PVS.Serialize(bInIsLoading, PVSJson);
+			InOutHandle["PVS"] = PVSJson;
+		}
 	}
 }
 
@@ -106,9 +123,6 @@ UObject* ULevel::Duplicate(FObjectDuplicationParameters Parameters)
 {
 	auto DupObject = static_cast<ULevel*>(Super::Duplicate(Parameters));
 
-	DupObject->Frustum = Frustum;
-	DupObject->ShowFlags = ShowFlags;
-	DupObject->LODUpdateFrameCounter = LODUpdateFrameCounter;
 	//DupObject->SelectedActor = SelectedActor;
 
 	// @todo ActorsToDelete는 복제할 필요가 존재하는지 확인
@@ -171,6 +185,16 @@ UObject* ULevel::Duplicate(FObjectDuplicationParameters Parameters)
 	return DupObject;
 }
 
+void ULevel::CopyPropertiesFrom(const UObject* InSource)
+{
+	Super::CopyPropertiesFrom(InSource);
+
+	const ULevel* Source = static_cast<const ULevel*>(InSource);
+	ShowFlags = Source->ShowFlags;
+	LODUpdateFrameCounter = Source->LODUpdateFrameCounter;
+	PVS = Source->PVS;
+}
+
 void ULevel::Init()
 {
 	// TEST CODE
@@ -227,8 +251,11 @@ void ULevel::Cleanup()
 	ProcessPendingDeletions();
 
 	// 2. Actors 배열에 남아있는 모든 액터의 메모리를 해제합니다.
+	// 목록 전체를 버리므로 먼저 비워서 액터마다 목록을 선형으로 지우지 않게 합니다.
+	LevelPrimitiveComponents.clear();
 	for (const auto& Actor : Actors)
 	{
+		RemoveLevelPrimitiveComponentsInActor(Actor);
 		delete Actor;
 	}
 	Actors.clear();
@@ -241,9 +268,10 @@ void ULevel::Cleanup()
 	SelectedActor = nullptr;
 }
 
-void ULevel::InitializeActorsInLevel()
+void ULevel::InitializeActorsInLevel(bool bInRebuildBVH)
 {
 	LevelPrimitiveComponents.clear();
+	LevelPrimitiveComponents.reserve(Actors.size());
 	for (auto& Actor : Actors)
 	{
 		if (Actor)
@@ -252,6 +280,11 @@ void ULevel::InitializeActorsInLevel()
 		}
 	}
 
+	if (!bInRebuildBVH)
+	{
+		return;
+	}
+
 	TArray<FBVHPrimitive> BVHPrimitives;
 	UBVHManager::GetInstance().ConvertComponentsToBVHPrimitives(LevelPrimitiveComponents, BVHPrimitives);
 	UBVHManager::GetInstance().Build(BVHPrimitives);
@@ -324,8 +357,8 @@ TArray<TObjectPtr<UPrimitiveComponent>> ULevel::GetVisiblePrimitiveComponents(UC
 	}
 
 	Frustum->Update(InCamera);
-	// UBV Tree를 순회하며 컬링
-	UBVHManager::GetInstance().FrustumCull(*Frustum, VisibleComponents);
+	// UBV Tree를 순회하며 컬링, PVS가 있으면 카메라 셀에서 보일 수 없는 프리미티브도 뺀다
+	UBVHManager::GetInstance().FrustumCull(*Frustum, VisibleComponents, FindPVSVisibleMask(InCamera->GetLocation()));
 
 	// 선형탐색으로 컬링
 	// for (auto& PrimitiveComponent : LevelPrimitiveComponents)
@@ -350,10 +383,58 @@ TArray<TObjectPtr<UPrimitiveComponent>> ULevel::GetVisiblePrimitiveComponents(UC
 	return VisibleComponents;
 }
 
+FPVSBakeStats ULevel::BakePVS(const FPVSBakeSettings& InSettings)
+{
+	UBVHManager& BVHManager = UBVHManager::GetInstance();
+	// 베이크는 BVH 바운드 기준이므로 최신 트랜스폼을 먼저 반영한다
+	BVHManager.Refit();
+
+	const FPVSBakeStats Stats = PVS.Bake(BVHManager.GetBoxes(), [&BVHManager](uint32 InIndex, const FRay& InRay, float& InOutClosestHit)
+	{
+		return BVHManager.RaycastPrimitiveForVisibility(InIndex, InRay, InOutClosestHit);
+	}, InSettings);
+
+	PVSLookup = FPVSLookup();
+	PVSBoundBVHVersion = BVHManager.GetVersion();
+	return Stats;
+}
+
+void ULevel::ClearPVS()
+{
+	PVS.Clear();
+	PVSLookup = FPVSLookup();
+	PVSBoundBVHVersion = UINT64_MAX;
+}
+
+const TArray<uint64>* ULevel::FindPVSVisibleMask(const FVector& InCameraLocation)
+{
+	if (PVS.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	UBVHManager& BVHManager = UBVHManager::GetInstance();
+	if (PVSBoundBVHVersion != BVHManager.GetVersion())
+	{
+		// 기즈모로 옮기는 동안에는 Refit마다 여기로 오므로 맞던 PVS가 어긋날 때만 알린다
+		const bool bShouldWarn = PVS.IsBound() || PVSBoundBVHVersion == UINT64_MAX;
+		PVSBoundBVHVersion = BVHManager.GetVersion();
+		PVSLookup = FPVSLookup();
+		if (!PVS.Bind(BVHManager.GetBoxes()) && bShouldWarn)
+		{
+			UE_LOG_WARNING("Level: 프리미티브 배치가 PVS 베이크 때와 달라 PVS 없이 컬링합니다 (pvs bake로 다시 구우세요)");
+		}
+	}
+
+	return PVS.FindVisibleBits(InCameraLocation, PVSLookup);
+}
+
 void ULevel::AddLevelPrimitiveComponentsInActor(AActor* Actor)
 {
 	if (!Actor) return;
 
+	UTransformManager::GetInstance().RegisterActor(Actor);
+
 	for (auto& Component : Actor->GetOwnedComponents())
 	{
 		if (!(Component->GetComponentType() >= EComponentType::Primitive)) continue;
@@ -365,6 +446,9 @@ void ULevel::AddLevelPrimitiveComponentsInActor(AActor* Actor)
 			continue;
 		}
 
+		// 보이지 않아 목록에서 빠지더라도 슬롯은 액터가 파괴될 때까지 유지한다
+		UOcclusionRenderer::GetInstance().RegisterPrimitive(PrimitiveComponent);
+
 		/* 3가지 경우 존재.
 		1: primitive show flag가 꺼져 있으면, 도형, 빌보드 모두 렌더링 안함.
 		2: primitive show flag가 켜져 있고, billboard show flag가 켜져 있으면, 도형, 빌보드 모두 렌더링
@@ -396,6 +480,8 @@ void ULevel::AddLevelPrimitiveComponent(TObjectPtr<UPrimitiveComponent> InPrimit
 		return;
 	}
 
+	UTransformManager::GetInstance().RegisterComponent(InPrimitiveComponent);
+	UOcclusionRenderer::GetInstance().RegisterPrimitive(InPrimitiveComponent);
 	LevelPrimitiveComponents.push_back(InPrimitiveComponent);
 
 	TArray<FBVHPrimitive> BVHPrimitives;
@@ -452,6 +538,27 @@ void ULevel::SetSelectedActor(AActor* InActor)
 }
 
 // Level에서 Actor 제거하는 함수
+void ULevel::RemoveLevelPrimitiveComponentsInActor(AActor* Actor)
+{
+	if (!Actor) return;
+
+	UTransformManager::GetInstance().UnregisterActor(Actor);
+
+	for (auto& Component : Actor->GetOwnedComponents())
+	{
+		TObjectPtr<UPrimitiveComponent> PrimitiveComponent = Cast<UPrimitiveComponent>(Component);
+		if (!PrimitiveComponent)
+		{
+			continue;
+		}
+
+		UOcclusionRenderer::GetInstance().UnregisterPrimitive(PrimitiveComponent);
+		LevelPrimitiveComponents.erase(
+			std::remove(LevelPrimitiveComponents.begin(), LevelPrimitiveComponents.end(), PrimitiveComponent),
+			LevelPrimitiveComponents.end());
+	}
+}
+
 bool ULevel::DestroyActor(AActor* InActor)
 {
 	if (!InActor)
@@ -475,6 +582,9 @@ bool ULevel::DestroyActor(AActor* InActor)
 		SelectedActor = nullptr;
 	}
 
+	// 씬 슬롯을 반납하고 해제될 컴포넌트가 렌더 목록에 남지 않도록 한다
+	RemoveLevelPrimitiveComponentsInActor(InActor);
+
 	// Remove
 	delete InActor;
 
@@ -4,6 +4,7 @@
 #include "Factory/Public/NewObject.h"
 
 #include "Editor/Public/Camera.h"
+#include "Manager/BVH/public/PotentiallyVisibleSet.h"
 
 class UWorld;
 
@@ -64,6 +65,7 @@ public:
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 	UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 	const TArray<TObjectPtr<AActor>>& GetActors() const { return Actors; }
 
@@ -74,9 +76,18 @@ public:
 
 	TArray<TObjectPtr<UPrimitiveComponent>> GetVisiblePrimitiveComponents(UCamera* InCamera);
 
+	/**
+	 * @brief 지금 BVH의 프리미티브로 PVS를 굽는다 (정적 레벨용)
+	 * 이후 카메라가 베이크 영역 안에 있으면 프러스텀 컬링 결과를 카메라 셀 PVS로 한 번 더 거른다
+	 */
+	FPVSBakeStats BakePVS(const FPVSBakeSettings& InSettings);
+	void ClearPVS();
+	const FPotentiallyVisibleSet& GetPVS() const { return PVS; }
+
 	void AddLevelPrimitiveComponentsInActor(AActor* Actor);
 	void AddLevelPrimitiveComponent(TObjectPtr<UPrimitiveComponent> InPrimitiveComponent);
-	void InitializeActorsInLevel();
+	/** @param bInRebuildBVH false면 BVH는 이미 이 레벨을 가리킨다고 보고 다시 빌드하지 않는다 (UBVHManager::RetargetPrimitives) */
+	void InitializeActorsInLevel(bool bInRebuildBVH = true);
 
 	AActor* SpawnActorToLevel(UClass* InActorClass, const FName& InName = FName::GetNone());
 	void RegisterDuplicatedActor(AActor* NewActor);
@@ -107,11 +118,24 @@ public:
 	void SetOwningWorld(const TObjectPtr<UWorld>& OwningWorld) { this->OwningWorld = OwningWorld; }
 
 private:
+	friend class FWorldCloner;
+
+	/** @brief 액터의 프리미티브를 레벨 목록에서 빼고 씬 슬롯을 반납한다 */
+	void RemoveLevelPrimitiveComponentsInActor(AActor* Actor);
+
+	/** @return 카메라 셀의 PVS (BVH 인덱스 기준), PVS가 없거나 배치가 바뀌었거나 영역 밖이면 nullptr */
+	const TArray<uint64>* FindPVSVisibleMask(const FVector& InCameraLocation);
+
 	TArray<TObjectPtr<AActor>> Actors;
 	TArray<TObjectPtr<UPrimitiveComponent>> LevelPrimitiveComponents; // 액터의 하위 컴포넌트는 액터에서 관리&해제됨
 
 	FFrustumCull* Frustum = nullptr;
 
+	// 베이크했거나 씬 파일에서 읽은 PVS, BVH가 바뀔 때마다 다시 Bind해 배치가 같은지 확인한다
+	FPotentiallyVisibleSet PVS;
+	FPVSLookup PVSLookup;
+	uint64 PVSBoundBVHVersion = UINT64_MAX;
+
 	// 자기를 가지고 있는 World
 	TObjectPtr<UWorld> OwningWorld;
 
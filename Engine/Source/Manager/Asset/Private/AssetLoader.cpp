@@ -0,0 +1,434 @@
+#include "pch.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+
+#include "Component/Mesh/Public/MeshOptimizer.h"
+#include "Component/Mesh/Public/MeshVertexCooker.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/ScopeCycleCounter.h"
+#include "Manager/Asset/Public/CookedMeshCache.h"
+#include "Manager/Asset/Public/ObjManager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+
+namespace
+{
+	/** @brief: Vertex Key for creating index buffer */
+	using VertexKey = std::tuple<size_t, size_t, size_t>;
+
+	struct VertexKeyHash
+	{
+		std::size_t operator() (VertexKey Key) const
+		{
+			auto Hash1 = std::hash<size_t>{}(std::get<0>(Key));
+			auto Hash2 = std::hash<size_t>{}(std::get<1>(Key));
+			auto Hash3 = std::hash<size_t>{}(std::get<2>(Key));
+
+			std::size_t Seed = Hash1;
+			Seed ^= Hash2 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
+			Seed ^= Hash3 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
+
+			return Seed;
+		}
+	};
+}
+
+template<typename BodyType>
+void FAssetLoader::ForEach(uint32 InCount, BodyType&& InBody) const
+{
+	if (bParallel)
+	{
+		// 파일 하나가 한 작업 단위라 잘게 나눠도 분할 비용이 묻힌다
+		FJobSystem::ParallelFor(InCount, InBody, 1);
+	}
+	else
+	{
+		InBody(0u, InCount);
+	}
+}
+
+template<typename BodyType>
+void FAssetLoader::ForEachInOrder(const TArray<uint32>& InOrder, BodyType&& InBody) const
+{
+	const uint32 Count = static_cast<uint32>(InOrder.size());
+	if (!bParallel)
+	{
+		for (uint32 Index : InOrder)
+		{
+			InBody(Index);
+		}
+		return;
+	}
+
+	// 범위를 미리 나누면 큰 파일이 한 범위에 몰릴 수 있으므로 스레드마다 다음 항목을 하나씩 가져간다
+	std::atomic<uint32> Cursor{ 0 };
+	const uint32 NumLanes = std::min(Count, FJobSystem::GetNumThreads());
+	FJobSystem::ParallelFor(NumLanes, [&](uint32 InBegin, uint32 InEnd)
+	{
+		for (uint32 Lane = InBegin; Lane < InEnd; ++Lane)
+		{
+			for (uint32 Next = Cursor.fetch_add(1, std::memory_order_relaxed); Next < Count;
+				Next = Cursor.fetch_add(1, std::memory_order_relaxed))
+			{
+				InBody(InOrder[Next]);
+			}
+		}
+	}, 1);
+}
+
+FAssetLoadStats FAssetLoader::Load(const FAssetLoadSettings& InSettings)
+{
+	FAssetLoadStats Stats;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	bParallel = InSettings.bParallel;
+	Registry.Clear();
+	StaticMeshes.clear();
+	Textures.clear();
+
+	/** #1. 메시 파일 등록 */
+	Registry.ScanStaticMeshes(InSettings.RootDirectory);
+	const uint32 NumMeshEntries = Registry.Num();
+	Stats.NumStaticMeshes = NumMeshEntries;
+
+	const uint64 ScanEndCycles = FPlatformTime::Cycles64();
+	Stats.ScanMs = FPlatformTime::ToMilliseconds(ScanEndCycles - StartCycles);
+
+	/**
+	 * #2. 파싱 + 쿠킹 + 삼각형 BVH, 메시끼리 공유하는 상태가 없어 파일 단위로 나눈다
+	 * 메시 하나의 비용이 파일 크기에 거의 비례하고 몇 개가 전체의 절반을 넘게 차지하므로, 실제로 읽을 파일이 큰 것부터 시작한다
+	 */
+	StaticMeshes.resize(NumMeshEntries);
+	TArray<TArray<FString>> TexturePathsPerMesh(NumMeshEntries);
+
+	TArray<uint64> LoadCosts(NumMeshEntries, 0);
+	TArray<uint32> LoadOrder(NumMeshEntries);
+	for (uint32 Index = 0; Index < NumMeshEntries; ++Index)
+	{
+		std::filesystem::path Path(Registry.GetEntry(Index).Path.ToString());
+		std::error_code ErrorCode;
+		if (InSettings.ObjConfig.bIsBinaryEnabled)
+		{
+			const uintmax_t BinarySize = std::filesystem::file_size(std::filesystem::path(Path).replace_extension(".objbin"), ErrorCode);
+			LoadCosts[Index] = ErrorCode ? 0 : static_cast<uint64>(BinarySize);
+		}
+		if (LoadCosts[Index] == 0)
+		{
+			const uintmax_t ObjSize = std::filesystem::file_size(Path, ErrorCode);
+			LoadCosts[Index] = ErrorCode ? 0 : static_cast<uint64>(ObjSize);
+		}
+		LoadOrder[Index] = Index;
+	}
+	std::stable_sort(LoadOrder.begin(), LoadOrder.end(), [&LoadCosts](uint32 InA, uint32 InB)
+	{
+		return LoadCosts[InA] > LoadCosts[InB];
+	});
+
+	/**
+	 * 최적화 결과는 쿠킹 직후 메시 내용 해시로 캐시에서 찾는다, objbin은 파싱 결과(FObjInfo)만 담으므로 따로 둔다
+	 * 작업 스레드에서는 캐시를 읽기만 하고, 새 결과는 메시마다 해시를 남겨 두었다가 끝난 뒤 차례로 넣는다
+	 */
+	FObjImporter::Configuration CookConfig = InSettings.ObjConfig;
+	const bool bUseMeshCache = CookConfig.bOptimizeMesh && !InSettings.CookedMeshCachePath.empty();
+	FCookedMeshCache MeshCache;
+	if (bUseMeshCache)
+	{
+		MeshCache.Load(InSettings.CookedMeshCachePath);
+		CookConfig.bOptimizeMesh = false;
+	}
+	TArray<uint64> MissedSourceHashes(NumMeshEntries, 0);
+	TArray<uint8> CacheHits(NumMeshEntries, 0);
+
+	ForEachInOrder(LoadOrder, [&](uint32 Index)
+	{
+		FLoadedStaticMesh& Loaded = StaticMeshes[Index];
+		Loaded.EntryIndex = Index;
+
+		const FName& Path = Registry.GetEntry(Index).Path;
+		FObjInfo ObjInfo;
+		if (!FObjImporter::LoadObj(Path.ToString(), &ObjInfo, InSettings.ObjConfig))
+		{
+			UE_LOG_ERROR("AssetLoader: 파일 정보를 읽어오는데 실패했습니다: %s", Path.ToString().c_str());
+			return;
+		}
+
+		Loaded.Asset = CookStaticMesh(Path, ObjInfo, CookConfig);
+		if (Loaded.Asset && bUseMeshCache)
+		{
+			const uint64 SourceHash = FCookedMeshCache::HashSourceMesh(*Loaded.Asset);
+			const FCookedMeshView* Cached = MeshCache.Find(SourceHash);
+			if (Cached && FCookedMeshCache::Apply(*Cached, *Loaded.Asset))
+			{
+				CacheHits[Index] = 1;
+			}
+			else
+			{
+				FMeshOptimizer::OptimizeStaticMesh(*Loaded.Asset);
+				MissedSourceHashes[Index] = SourceHash;
+			}
+		}
+		if (Loaded.Asset)
+		{
+			UStaticMesh::BuildTriangleBVH(*Loaded.Asset);
+			CollectTexturePaths(*Loaded.Asset, TexturePathsPerMesh[Index]);
+		}
+	});
+
+	for (uint32 Index = 0; Index < NumMeshEntries; ++Index)
+	{
+		const FLoadedStaticMesh& Loaded = StaticMeshes[Index];
+		Stats.NumFailedStaticMeshes += Loaded.Asset ? 0 : 1;
+		Stats.NumCachedStaticMeshes += CacheHits[Index];
+		if (Loaded.Asset && !CacheHits[Index] && bUseMeshCache)
+		{
+			MeshCache.Add(MissedSourceHashes[Index], *Loaded.Asset);
+		}
+	}
+
+	if (MeshCache.IsDirty())
+	{
+		MeshCache.Save(InSettings.CookedMeshCachePath);
+	}
+
+	const uint64 MeshEndCycles = FPlatformTime::Cycles64();
+	Stats.MeshMs = FPlatformTime::ToMilliseconds(MeshEndCycles - ScanEndCycles);
+
+	/** #3. 텍스처 등록, 경로 순으로 정렬해 같은 텍스처를 여러 메시가 써도 한 번만 읽는다 */
+	TArray<FString> TexturePaths;
+	for (const TArray<FString>& MeshTexturePaths : TexturePathsPerMesh)
+	{
+		TexturePaths.insert(TexturePaths.end(), MeshTexturePaths.begin(), MeshTexturePaths.end());
+	}
+	std::sort(TexturePaths.begin(), TexturePaths.end());
+	TexturePaths.erase(std::unique(TexturePaths.begin(), TexturePaths.end()), TexturePaths.end());
+
+	Textures.resize(TexturePaths.size());
+	for (size_t i = 0; i < TexturePaths.size(); ++i)
+	{
+		Textures[i].EntryIndex = Registry.AddEntry(TexturePaths[i], EAssetType::Texture);
+	}
+
+	for (uint32 MeshIndex = 0; MeshIndex < NumMeshEntries; ++MeshIndex)
+	{
+		for (const FString& TexturePath : TexturePathsPerMesh[MeshIndex])
+		{
+			Registry.AddDependency(MeshIndex, static_cast<uint32>(Registry.FindByPath(FName(TexturePath))));
+		}
+	}
+
+	/** #4. 텍스처 파일 읽기 + 내용 해시 */
+	TArray<uint64> ContentHashes(Textures.size(), 0);
+	ForEach(static_cast<uint32>(Textures.size()), [&](uint32 InBegin, uint32 InEnd)
+	{
+		for (uint32 Index = InBegin; Index < InEnd; ++Index)
+		{
+			FLoadedTexture& Loaded = Textures[Index];
+			const FString Path = Registry.GetEntry(Loaded.EntryIndex).Path.ToString();
+			if (!FAssetRegistry::ReadFileBytes(Path, Loaded.FileBytes))
+			{
+				UE_LOG_ERROR("AssetLoader: 텍스처 파일을 읽지 못했습니다: %s", Path.c_str());
+				continue;
+			}
+			ContentHashes[Index] = FAssetRegistry::HashBytes(Loaded.FileBytes.data(), Loaded.FileBytes.size());
+		}
+	});
+
+	// 해시 기록은 경로 순으로 해야 같은 내용끼리 항상 같은 대표를 고른다
+	Stats.NumTextures = static_cast<uint32>(Textures.size());
+	for (size_t i = 0; i < Textures.size(); ++i)
+	{
+		FLoadedTexture& Loaded = Textures[i];
+		if (Loaded.FileBytes.empty())
+		{
+			continue;
+		}
+
+		const int32 SourceIndex = Registry.FindByContentHash(EAssetType::Texture, ContentHashes[i]);
+		Registry.SetContentHash(Loaded.EntryIndex, ContentHashes[i], Loaded.FileBytes.size());
+		if (SourceIndex >= 0)
+		{
+			Loaded.SourceEntryIndex = SourceIndex;
+			Loaded.FileBytes = TArray<uint8>();
+		}
+		else
+		{
+			++Stats.NumUniqueTextures;
+			Stats.NumTextureBytes += Loaded.FileBytes.size();
+		}
+	}
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	Stats.TextureMs = FPlatformTime::ToMilliseconds(EndCycles - MeshEndCycles);
+	Stats.TotalMs = FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+	return Stats;
+}
+
+std::unique_ptr<FStaticMesh> FAssetLoader::CookStaticMesh(const FName& InPathFileName, FObjInfo& InObjInfo,
+	const FObjImporter::Configuration& InConfig)
+{
+	if (InObjInfo.ObjectInfoList.size() == 0)
+	{
+		UE_LOG_ERROR("오브젝트 정보를 찾을 수 없습니다");
+		return nullptr;
+	}
+
+	auto StaticMesh = std::make_unique<FStaticMesh>();
+	StaticMesh->PathFileName = InPathFileName;
+
+	/** #1. 오브젝트 정보로부터 버텍스 배열과 인덱스 배열을 구성 */
+	/** @note: Use only first object in '.obj' file to create FStaticMesh. */
+	FObjectInfo& ObjectInfo = InObjInfo.ObjectInfoList[0];
+
+	// 고유 정점 수는 위치 수에 가깝다, 미리 잡아 두면 큰 메시에서 재해시와 배열 재할당이 사라진다
+	const size_t NumCorners = ObjectInfo.VertexIndexList.size();
+	const size_t ExpectedVertices = std::min(NumCorners, InObjInfo.VertexList.size());
+	TFlatMap<VertexKey, size_t, VertexKeyHash> VertexMap(ExpectedVertices);
+	StaticMesh->Indices.reserve(NumCorners);
+	StaticMesh->Positions.reserve(ExpectedVertices);
+	StaticMesh->Attributes.reserve(ExpectedVertices);
+	for (size_t i = 0; i < ObjectInfo.VertexIndexList.size(); ++i)
+	{
+		size_t VertexIndex = ObjectInfo.VertexIndexList[i];
+
+		size_t NormalIndex = FObjManager::INVALID_INDEX;
+		if (!ObjectInfo.NormalIndexList.empty())
+		{
+			NormalIndex = ObjectInfo.NormalIndexList[i];
+		}
+
+		size_t TexCoordIndex = FObjManager::INVALID_INDEX;
+		if (!ObjectInfo.TexCoordIndexList.empty())
+		{
+			TexCoordIndex = ObjectInfo.TexCoordIndexList[i];
+		}
+
+		VertexKey Key{ VertexIndex, NormalIndex, TexCoordIndex };
+		auto [It, bInserted] = VertexMap.try_emplace(Key, StaticMesh->Positions.size());
+		if (bInserted)
+		{
+			FVector Normal;
+			if (NormalIndex != FObjManager::INVALID_INDEX)
+			{
+				assert("Vertex normal index out of range" && NormalIndex < InObjInfo.NormalList.size());
+				Normal = InObjInfo.NormalList[NormalIndex];
+			}
+
+			FVector2 TexCoord;
+			if (TexCoordIndex != FObjManager::INVALID_INDEX)
+			{
+				assert("Texture coordinate index out of range" && TexCoordIndex < InObjInfo.TexCoordList.size());
+				TexCoord = InObjInfo.TexCoordList[TexCoordIndex];
+			}
+
+			// 중간 FNormalVertex 없이 위치/속성 스트림으로 바로 쿠킹한다
+			StaticMesh->Positions.emplace_back(InObjInfo.VertexList[VertexIndex]);
+			StaticMesh->Attributes.push_back(FMeshVertexCooker::MakeAttribute(Normal, TexCoord));
+			StaticMesh->Indices.push_back(It->second);
+		}
+		else
+		{
+			StaticMesh->Indices.push_back(It->second);
+		}
+	}
+
+	/** #2. 오브젝트가 사용하는 머티리얼의 목록을 저장 */
+	TSet<FName> UniqueMaterialNames;
+	for (const auto& MaterialName : ObjectInfo.MaterialNameList)
+	{
+		UniqueMaterialNames.insert(MaterialName);
+	}
+
+	StaticMesh->MaterialInfo.resize(UniqueMaterialNames.size());
+	TMap<FName, int32> MaterialNameToSlot;
+	int32 CurrentMaterialSlot = 0;
+
+	for (const auto& MaterialName : UniqueMaterialNames)
+	{
+		for (size_t j = 0; j < InObjInfo.ObjectMaterialInfoList.size(); ++j)
+		{
+			if (MaterialName == InObjInfo.ObjectMaterialInfoList[j].Name)
+			{
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Name = std::move(InObjInfo.ObjectMaterialInfoList[j].Name);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ka = std::move(InObjInfo.ObjectMaterialInfoList[j].Ka);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Kd = std::move(InObjInfo.ObjectMaterialInfoList[j].Kd);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ks = std::move(InObjInfo.ObjectMaterialInfoList[j].Ks);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ke = std::move(InObjInfo.ObjectMaterialInfoList[j].Ke);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ns = std::move(InObjInfo.ObjectMaterialInfoList[j].Ns);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ni = std::move(InObjInfo.ObjectMaterialInfoList[j].Ni);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].D = std::move(InObjInfo.ObjectMaterialInfoList[j].D);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].Illumination = std::move(InObjInfo.ObjectMaterialInfoList[j].Illumination);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].KaMap = std::move(InObjInfo.ObjectMaterialInfoList[j].KaMap);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].KdMap = std::move(InObjInfo.ObjectMaterialInfoList[j].KdMap);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].KsMap = std::move(InObjInfo.ObjectMaterialInfoList[j].KsMap);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].NsMap = std::move(InObjInfo.ObjectMaterialInfoList[j].NsMap);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].DMap = std::move(InObjInfo.ObjectMaterialInfoList[j].DMap);
+				StaticMesh->MaterialInfo[CurrentMaterialSlot].BumpMap = std::move(InObjInfo.ObjectMaterialInfoList[j].BumpMap);
+
+				MaterialNameToSlot.emplace(MaterialName, CurrentMaterialSlot);
+				CurrentMaterialSlot++;
+				break;
+			}
+		}
+	}
+
+	/** #3. 오브젝트의 서브메쉬 정보를 저장 */
+	StaticMesh->Sections.resize(ObjectInfo.MaterialIndexList.size());
+	for (size_t i = 0; i < ObjectInfo.MaterialIndexList.size(); ++i)
+	{
+		StaticMesh->Sections[i].StartIndex = ObjectInfo.MaterialIndexList[i] * 3;
+		if (i < ObjectInfo.MaterialIndexList.size() - 1)
+		{
+			StaticMesh->Sections[i].IndexCount = (ObjectInfo.MaterialIndexList[i + 1] - ObjectInfo.MaterialIndexList[i]) * 3;
+		}
+		else
+		{
+			StaticMesh->Sections[i].IndexCount = (StaticMesh->Indices.size() / 3 - ObjectInfo.MaterialIndexList[i]) * 3;
+		}
+
+		const FName& MaterialName = ObjectInfo.MaterialNameList[i];
+		auto It = MaterialNameToSlot.find(MaterialName);
+		if (It != MaterialNameToSlot.end())
+		{
+			StaticMesh->Sections[i].MaterialSlot = It->second;
+		}
+		else
+		{
+			StaticMesh->Sections[i].MaterialSlot = FMeshSection::INVALID_MATERIAL_SLOT;
+		}
+	}
+
+	/** #4. 섹션 범위는 그대로 두고 인덱스/정점 순서만 최적화 */
+	if (InConfig.bOptimizeMesh)
+	{
+		FMeshOptimizer::OptimizeStaticMesh(*StaticMesh);
+	}
+
+	return StaticMesh;
+}
+
+void FAssetLoader::CollectTexturePaths(const FStaticMesh& InStaticMesh, TArray<FString>& OutPaths)
+{
+	// FObjManager::CreateMaterialsFromMTL이 읽는 맵과 같은 것만 모은다
+	const std::filesystem::path ObjDirectory = std::filesystem::path(InStaticMesh.PathFileName.ToString()).parent_path();
+
+	for (const FMaterial& MaterialInfo : InStaticMesh.MaterialInfo)
+	{
+		for (const FString* TextureMap : { &MaterialInfo.KdMap, &MaterialInfo.KaMap, &MaterialInfo.KsMap, &MaterialInfo.DMap })
+		{
+			if (TextureMap->empty())
+			{
+				continue;
+			}
+
+			FString TexturePath = (ObjDirectory / *TextureMap).generic_string();
+			std::error_code ErrorCode;
+			if (std::filesystem::exists(TexturePath, ErrorCode)
+				&& std::find(OutPaths.begin(), OutPaths.end(), TexturePath) == OutPaths.end())
+			{
+				OutPaths.push_back(std::move(TexturePath));
+			}
+		}
+	}
+}
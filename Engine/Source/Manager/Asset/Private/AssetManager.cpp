@@ -7,12 +7,32 @@
 #include "Component/Mesh/Public/VertexDatas.h"
 #include "Manager/Asset/Public/LODMaker.h"
 #include "Physics/Public/AABB.h"
+#include "Render/Renderer/Public/DebugDraw.h"
 #include "Texture/Public/TextureRenderProxy.h"
 #include "Texture/Public/Texture.h"
 #include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Component/Mesh/Public/MeshVertexCooker.h"
+#include "Texture/Public/CookedTextureCache.h"
+
+#include <wincodec.h>
 
 IMPLEMENT_SINGLETON_CLASS_BASE(UAssetManager)
 
+namespace
+{
+	// 쿠킹한 텍스처 캐시 파일 경로
+	const FString COOKED_TEXTURE_CACHE_PATH = "Data/Cooked/Textures.gtc";
+	// 메시 최적화 결과 캐시 파일 경로
+	const FString COOKED_MESH_CACHE_PATH = "Data/Cooked/Meshes.gmc";
+
+	bool IsDDSData(const TArray<uint8>& InData)
+	{
+		const uint32 DDS_MAGIC = 0x20534444; // "DDS " in little-endian
+		return InData.size() >= 4 && *reinterpret_cast<const uint32*>(InData.data()) == DDS_MAGIC;
+	}
+}
+
 UAssetManager::UAssetManager() = default;
 
 UAssetManager::~UAssetManager() = default;
@@ -70,15 +90,24 @@ void UAssetManager::Initialize()
 	NumVertices.emplace(EPrimitiveType::Ring, static_cast<uint32>(VerticesRing.size()));
 	NumVertices.emplace(EPrimitiveType::Line, static_cast<uint32>(VerticesLine.size()));
 
-	// Calculate AABB for all primitive types (excluding StaticMesh)
+	// 위치만 필요한 경로(피킹, 오클루전, AABB)를 위해 기본 도형의 위치 스트림을 만들어 둔다
 	for (const auto& Pair : VertexDatas)
+	{
+		if (Pair.second)
+		{
+			FMeshVertexCooker::CookPositions(*Pair.second, PositionDatas[Pair.first]);
+		}
+	}
+
+	// Calculate AABB for all primitive types (excluding StaticMesh)
+	for (const auto& Pair : PositionDatas)
 	{
 		EPrimitiveType Type = Pair.first;
-		const auto* Vertices = Pair.second;
-		if (!Vertices || Vertices->empty())
+		const auto& Positions = Pair.second;
+		if (Positions.empty())
 			continue;
 
-		AABBs[Type] = CalculateAABB(*Vertices);
+		AABBs[Type] = CalculateAABB(Positions);
 	}
 
 	// Calculate AABB for each StaticMesh
@@ -89,11 +118,11 @@ void UAssetManager::Initialize()
 		if (!Mesh || !Mesh->IsValid())
 			continue;
 
-		const auto& Vertices = Mesh->GetVertices();
-		if (Vertices.empty())
+		const auto& Positions = Mesh->GetPositions();
+		if (Positions.empty())
 			continue;
 
-		StaticMeshAABBs[ObjPath] = CalculateAABB(Vertices);
+		StaticMeshAABBs[ObjPath] = CalculateAABB(Positions);
 	}
 
 	// Initialize Shaders
@@ -102,6 +131,7 @@ void UAssetManager::Initialize()
 	TArray<D3D11_INPUT_ELEMENT_DESC> layoutDesc =
 	{
 		{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, offsetof(FDebugLineVertex, Color), D3D11_INPUT_PER_VERTEX_DATA, 0},
 	};
 	URenderer::GetInstance().CreateVertexShaderAndInputLayout(L"Asset/Shader/BatchLineVS.hlsl", layoutDesc,
 		&vertexShader, &inputLayout);
@@ -132,6 +162,10 @@ void UAssetManager::Release()
 	{
 		URenderer::GetInstance().ReleaseVertexBuffer(Pair.second);
 	}
+	for (auto& Pair : StaticMeshAttributeBuffers)
+	{
+		URenderer::GetInstance().ReleaseVertexBuffer(Pair.second);
+	}
 	for (auto& Pair : StaticMeshIndexBuffers)
 	{
 		URenderer::GetInstance().ReleaseIndexBuffer(Pair.second);
@@ -139,6 +173,7 @@ void UAssetManager::Release()
 
 	StaticMeshCache.clear();	// unique ptr 이라서 자동으로 해제됨
 	StaticMeshVertexBuffers.clear();
+	StaticMeshAttributeBuffers.clear();
 	StaticMeshIndexBuffers.clear();
 
 	// TMap.Empty()
@@ -147,170 +182,147 @@ void UAssetManager::Release()
 }
 
 /**
- * @brief Data/ 경로 하위에 모든 .obj 파일을 로드 후 캐싱한다
+ * @brief Data/ 경로 하위에 모든 .obj 파일과 재질 텍스처를 로드 후 캐싱한다
+ * 파싱/쿠킹/BVH/텍스처 파일 읽기는 FAssetLoader가 작업 스레드에서 끝내고, 여기서는 디바이스 리소스만 만든다
+ * 텍스처를 먼저 경로 순으로 만들어 두면 재질 생성이 캐시만 보고, 내용이 같은 텍스처는 SRV 하나를 함께 쓴다
+ * 텍스처는 밉 체인을 포함한 BC7로 쿠킹해 Data/Cooked에 캐싱한다, 원본이 바뀌지 않으면 다음 실행부터 디코딩 없이 올린다
+ * 메시 최적화 결과도 Data/Cooked에 캐싱해 원본이나 최적화기 버전이 바뀔 때만 다시 계산한다
  */
 void UAssetManager::LoadAllObjStaticMesh()
 {
-	URenderer& Renderer = URenderer::GetInstance();
-
-	TArray<FName> ObjList, LODObjList;
-	const FString DataDirectory = "Data/"; // 검색할 기본 디렉토리
-
-	auto IsInLodFolder = [](const std::filesystem::path& P) -> bool
+	FAssetLoadSettings Settings;
+	Settings.RootDirectory = "Data/";
+	Settings.ObjConfig.bFlipWindingOrder = false;
+	Settings.ObjConfig.bIsBinaryEnabled = true;
+	Settings.ObjConfig.bUVToUEBasis = true;
+	Settings.ObjConfig.bPositionToUEBasis = true;
+	Settings.CookedMeshCachePath = COOKED_MESH_CACHE_PATH;
+
+	FAssetLoader Loader;
+	const FAssetLoadStats Stats = Loader.Load(Settings);
+	const FAssetRegistry& Registry = Loader.GetRegistry();
+
+	const uint64 DeviceStartCycles = FPlatformTime::Cycles64();
+
+	/**
+	 * #1. 텍스처 쿠킹, 원본 내용 해시 + 설정 해시로 캐시를 찾고 없을 때만 디코딩(WIC, 소유 스레드)과 쿠킹을 한다
+	 * DDS는 이미 GPU 포맷이므로 그대로 올린다
+	 */
+	FTextureCookSettings CookSettings;
+	const uint64 CookSettingsHash = CookSettings.GetHash();
+
+	FCookedTextureCache CookedCache;
+	CookedCache.Load(COOKED_TEXTURE_CACHE_PATH);
+
+	uint32 NumCookedTextures = 0;
+	const uint64 CookStartCycles = FPlatformTime::Cycles64();
+	for (const FLoadedTexture& Texture : Loader.GetTextures())
 	{
-		for (std::filesystem::path Cur = P; !Cur.empty(); Cur = Cur.parent_path())
+		const FAssetRegistryEntry& Entry = Registry.GetEntry(Texture.EntryIndex);
+		if (Texture.SourceEntryIndex >= 0 || Texture.FileBytes.empty() || IsDDSData(Texture.FileBytes)
+			|| CookedCache.Find(Entry.ContentHash, CookSettingsHash))
 		{
-			std::string Name = Cur.filename().string();
-			std::transform(Name.begin(), Name.end(), Name.begin(),
-				[](unsigned char C){ return static_cast<char>(std::tolower(C)); });
+			continue;
+		}
 
-			if (Name == "lod")
-			{
-				return true;
-			}
+		FTextureImage Image;
+		FCookedTexture Cooked;
+		if (!DecodeImageFromMemory(Texture.FileBytes.data(), Texture.FileBytes.size(), Image)
+			|| !FTextureCooker::Cook(Image, CookSettings, Cooked))
+		{
+			UE_LOG_WARNING("AssetManager: 텍스처 쿠킹 실패, 원본을 그대로 사용합니다: %s", Entry.Path.ToString().c_str());
+			continue;
 		}
-		return false;
-	};
 
-	if (std::filesystem::exists(DataDirectory) && std::filesystem::is_directory(DataDirectory))
+		CookedCache.Add(Entry.ContentHash, CookSettingsHash, std::move(Cooked));
+		++NumCookedTextures;
+	}
+
+	if (CookedCache.IsDirty())
 	{
-		std::filesystem::recursive_directory_iterator It(
-			DataDirectory, std::filesystem::directory_options::skip_permission_denied
-		), End;
+		CookedCache.Save(COOKED_TEXTURE_CACHE_PATH);
+	}
+	const double CookMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CookStartCycles);
 
-		for (; It != End; ++It)
+	/** #2. 텍스처 SRV */
+	for (FLoadedTexture& Texture : Loader.GetTextures())
+	{
+		const FAssetRegistryEntry& TextureEntry = Registry.GetEntry(Texture.EntryIndex);
+		const FName& TexturePath = TextureEntry.Path;
+		if (TextureCache.find(TexturePath) != TextureCache.end())
 		{
-			const auto& Entry = *It;
+			continue;
+		}
 
-			if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+		ID3D11ShaderResourceView* TextureSRV = nullptr;
+		if (Texture.SourceEntryIndex >= 0)
+		{
+			auto SourceIter = TextureCache.find(Registry.GetEntry(Texture.SourceEntryIndex).Path);
+			if (SourceIter != TextureCache.end() && SourceIter->second)
 			{
-				const bool bInLOD = IsInLodFolder(Entry.path().parent_path());
-				FString PathString = Entry.path().generic_string();
-
-				if (bInLOD)
-				{
-					LODObjList.push_back(FName(PathString));
-				}
-				else
-				{
-					ObjList.push_back(FName(PathString));
-				}
+				// 캐시 항목마다 ReleaseAllTextures에서 한 번씩 Release하므로 참조를 하나 늘려 둔다
+				TextureSRV = SourceIter->second;
+				TextureSRV->AddRef();
 			}
 		}
-	}
-
-	// Enable winding order flip for this OBJ file
-	FObjImporter::Configuration Config;
-	Config.bFlipWindingOrder = false;
-	Config.bIsBinaryEnabled = true;
-	Config.bUVToUEBasis = true;
-	Config.bPositionToUEBasis = true;
-
-	TArray<float> ReductionRatios = { 0.5f, 0.25f };
-
-	for (const FName& ObjPath : ObjList)
-	{
-		//for (float ReductionRatio : ReductionRatios)
-		//{
-		//	FMeshSimplifier MeshSimplifier;
-		//	if (MeshSimplifier.LoadFromObj(ObjPath.ToString()))
-		//	{
-		//		MeshSimplifier.Simplify(ReductionRatio);
-		//		if (MeshSimplifier.SaveToObj(ObjPath.ToString(), ReductionRatio))
-		//		{
-		//			// LOD 파일 경로 구성 (SaveToObj와 동일한 로직)
-		//			std::filesystem::path OriginalPath(ObjPath.ToString());
-		//			std::filesystem::path LodDirectory = OriginalPath.parent_path() / "LOD";
-
-		//			// 파일명 구성 (예: A_lod_050.obj, A_lod_025.obj)
-		//			FString OriginalStem = OriginalPath.stem().string();
-		//			int RatioInt = static_cast<int>(ReductionRatio * 100);
-		//			FString RatioStr = (RatioInt < 100) ? "0" + std::to_string(RatioInt) : std::to_string(RatioInt);
-		//			if (RatioInt < 10) RatioStr = "0" + RatioStr;
-
-		//			std::filesystem::path LodObjPath = LodDirectory / (OriginalStem + "_lod_" + RatioStr + ".obj");
-
-		//			// 경로를 정규화하여 / 또는 \ 차이로 인한 중복 방지
-		//			FString NormalizedPath = LodObjPath.generic_string();
-		//			FName LodObjName(NormalizedPath);
-
-		//			// 중복 체크 후 LODObjList에 추가 (정규화된 경로로 비교)
-		//			bool bAlreadyExists = false;
-		//			for (const FName& ExistingPath : LODObjList)
-		//			{
-		//				std::filesystem::path ExistingNormalized(ExistingPath.ToString());
-		//				FString ExistingGeneric = ExistingNormalized.generic_string();
-
-		//				if (NormalizedPath == ExistingGeneric)
-		//				{
-		//					bAlreadyExists = true;
-		//					break;
-		//				}
-		//			}
-
-		//			if (!bAlreadyExists)
-		//			{
-		//				LODObjList.push_back(LodObjName);
-		//			}
-		//		}
-		//	}
-		//}
-
-		if (UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config))
+		else if (!Texture.FileBytes.empty())
 		{
-			StaticMeshCache.emplace(ObjPath, LoadedMesh);
-			StaticMeshVertexBuffers.emplace(ObjPath, CreateVertexBuffer(LoadedMesh->GetVertices()));
-			StaticMeshIndexBuffers.emplace(ObjPath, CreateIndexBuffer(LoadedMesh->GetIndices()));
+			if (const FCookedTextureView* Cooked = CookedCache.Find(TextureEntry.ContentHash, CookSettingsHash))
+			{
+				TextureSRV = CreateTextureFromCooked(*Cooked);
+			}
+			if (!TextureSRV)
+			{
+				TextureSRV = CreateTextureFromMemory(Texture.FileBytes.data(), Texture.FileBytes.size());
+			}
+			Texture.FileBytes = TArray<uint8>();
 		}
-	}
 
-	for (auto& Path : LODObjList)
-	{
-		UE_LOG("Path : %s", Path.ToString().data());
+		if (TextureSRV)
+		{
+			TextureCache[TexturePath] = TextureSRV;
+		}
 	}
 
-	// LOD Mesh 로드 및 원본 메시와 연결
-	for (const FName& LODObjPath : LODObjList)
+	/** #3. 메시 버퍼와 재질, 원본 메시가 LOD보다 먼저 등록되어 있다 */
+	for (FLoadedStaticMesh& Loaded : Loader.GetStaticMeshes())
 	{
-		if (UStaticMesh* LoadedLODMesh = FObjManager::LoadObjStaticMesh(LODObjPath, Config))
+		if (!Loaded.Asset)
 		{
-			StaticMeshCache.emplace(LODObjPath, LoadedLODMesh);
-			StaticMeshVertexBuffers.emplace(LODObjPath, CreateVertexBuffer(LoadedLODMesh->GetVertices()));
-			StaticMeshIndexBuffers.emplace(LODObjPath, CreateIndexBuffer(LoadedLODMesh->GetIndices()));
-
-			// LOD 파일에서 원본 파일 경로 추출하여 연결
-			FString LODPathStr = LODObjPath.ToString();
-			std::filesystem::path LODPath(LODPathStr);
-
-			// LOD 파일명에서 원본 파일명 추출 (예: apple_lod_050.obj -> apple.obj)
-			FString FileName = LODPath.stem().string();
-			size_t LodPos = FileName.find("_lod_");
-			if (LodPos != FString::npos)
-			{
-				FString OriginalStem = FileName.substr(0, LodPos);
+			continue;
+		}
 
-				// 원본 파일 경로 구성 (LOD 폴더의 부모 디렉토리에서 찾기)
-				std::filesystem::path OriginalPath = LODPath.parent_path().parent_path() / (OriginalStem + ".obj");
+		const FAssetRegistryEntry& Entry = Registry.GetEntry(Loaded.EntryIndex);
+		FObjManager::AddStaticMeshAsset(std::move(Loaded.Asset));
 
-				// 경로 정규화: 백슬래시를 슬래시로 변경
-				FString OriginalPathStr = OriginalPath.string();
-				std::replace(OriginalPathStr.begin(), OriginalPathStr.end(), '\\', '/');
+		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(Entry.Path, Settings.ObjConfig);
+		if (!LoadedMesh)
+		{
+			continue;
+		}
 
-				FName OriginalObjPath(OriginalPathStr);
+		StaticMeshCache.emplace(Entry.Path, LoadedMesh);
+		CreateStaticMeshBuffers(Entry.Path, LoadedMesh);
 
-				// 원본 메시가 캐시에 있으면 LOD 연결
-				auto OriginalMeshIter = StaticMeshCache.find(OriginalObjPath);
-				if (OriginalMeshIter != StaticMeshCache.end())
+		// LOD 메시는 원본 메시에 연결
+		if (Entry.bIsLOD && Entry.LODSourceIndex >= 0)
+		{
+			auto OriginalMeshIter = StaticMeshCache.find(Registry.GetEntry(Entry.LODSourceIndex).Path);
+			if (OriginalMeshIter != StaticMeshCache.end())
+			{
+				UStaticMesh* OriginalMesh = OriginalMeshIter->second.get();
+				if (OriginalMesh && LoadedMesh->GetStaticMeshAsset())
 				{
-					UStaticMesh* OriginalMesh = OriginalMeshIter->second.get();
-					if (OriginalMesh && LoadedLODMesh->GetStaticMeshAsset())
-					{
-						OriginalMesh->AddLODMesh(LoadedLODMesh->GetStaticMeshAsset());
-					}
+					OriginalMesh->AddLODMesh(LoadedMesh->GetStaticMeshAsset());
 				}
 			}
 		}
 	}
+
+	const double DeviceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - DeviceStartCycles);
+	UE_LOG_SUCCESS("AssetManager: 메시 %u개 (실패 %u, 최적화 캐시 %u), 텍스처 %u개 (고유 %u, 새로 쿠킹 %u) - 디코딩 %.2fms (메시 %.2fms, 텍스처 %.2fms), 쿠킹 %.2fms, 디바이스 %.2fms",
+		Stats.NumStaticMeshes, Stats.NumFailedStaticMeshes, Stats.NumCachedStaticMeshes, Stats.NumTextures, Stats.NumUniqueTextures, NumCookedTextures,
+		Stats.TotalMs, Stats.MeshMs, Stats.TextureMs, CookMs, DeviceMs - CookMs);
 }
 
 ID3D11Buffer* UAssetManager::GetVertexBuffer(FName InObjPath)
@@ -322,18 +334,44 @@ ID3D11Buffer* UAssetManager::GetVertexBuffer(FName InObjPath)
 	return nullptr;
 }
 
-ID3D11Buffer* UAssetManager::GetIndexBuffer(FName InObjPath)
+ID3D11Buffer* UAssetManager::GetAttributeBuffer(FName InObjPath)
 {
-	if (StaticMeshIndexBuffers.count(InObjPath))
+	if (StaticMeshAttributeBuffers.count(InObjPath))
 	{
-		return StaticMeshIndexBuffers[InObjPath];
+		return StaticMeshAttributeBuffers[InObjPath];
 	}
 	return nullptr;
 }
 
-ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices)
+/**
+ * @brief 쿠킹된 위치/속성 스트림과 인덱스로 GPU 버퍼를 만들고, 기존 정점 포맷 대비 크기를 로그로 남긴다
+ */
+void UAssetManager::CreateStaticMeshBuffers(const FName& InObjPath, const UStaticMesh* InStaticMesh)
 {
-	return URenderer::GetInstance().CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
+	URenderer& Renderer = URenderer::GetInstance();
+
+	const TArray<FMeshPosition>& Positions = InStaticMesh->GetPositions();
+	const TArray<FMeshAttribute>& Attributes = InStaticMesh->GetAttributes();
+
+	StaticMeshVertexBuffers.emplace(InObjPath, Renderer.CreateVertexBuffer(
+		Positions.data(), static_cast<uint32>(Positions.size() * sizeof(FMeshPosition))));
+	StaticMeshAttributeBuffers.emplace(InObjPath, Renderer.CreateVertexBuffer(
+		Attributes.data(), static_cast<uint32>(Attributes.size() * sizeof(FMeshAttribute))));
+	StaticMeshIndexBuffers.emplace(InObjPath, CreateIndexBuffer(InStaticMesh->GetIndices()));
+
+	const FMeshVertexSizeReport Report = FMeshVertexCooker::MakeSizeReport(static_cast<uint32>(Positions.size()));
+	UE_LOG("StaticMesh: %s - %u Vertices, %llu -> %llu Bytes (Position %llu + Attribute %llu)",
+		InObjPath.ToString().c_str(), Report.NumVertices, Report.SourceBytes, Report.GetCookedBytes(),
+		Report.PositionBytes, Report.AttributeBytes);
+}
+
+ID3D11Buffer* UAssetManager::GetIndexBuffer(FName InObjPath)
+{
+	if (StaticMeshIndexBuffers.count(InObjPath))
+	{
+		return StaticMeshIndexBuffers[InObjPath];
+	}
+	return nullptr;
 }
 
 ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
@@ -346,6 +384,12 @@ TArray<FNormalVertex>* UAssetManager::GetVertexData(EPrimitiveType InType)
 	return VertexDatas[InType];
 }
 
+const TArray<FMeshPosition>* UAssetManager::GetPositionData(EPrimitiveType InType)
+{
+	auto Iter = PositionDatas.find(InType);
+	return Iter != PositionDatas.end() ? &Iter->second : nullptr;
+}
+
 ID3D11Buffer* UAssetManager::GetVertexbuffer(EPrimitiveType InType)
 {
 	return VertexBuffers[InType];
@@ -680,18 +724,147 @@ ID3D11ShaderResourceView* UAssetManager::CreateTextureFromMemory(const void* InD
 }
 
 /**
- * @brief Vertex 배열로부터 AABB(Axis-Aligned Bounding Box)를 계산하는 헬퍼 함수
- * @param vertices 정점 데이터 배열
+ * @brief 쿠킹한 블록 압축 텍스처로 불변 Texture2D와 SRV를 만든다 (밉마다 서브리소스 하나)
+ * 원본을 WIC로 올릴 때와 같은 UNORM 포맷을 써서 셰이더가 보는 값이 바뀌지 않게 한다
+ * @return 실패시 nullptr (호출자가 원본 경로로 되돌아간다)
+ */
+ID3D11ShaderResourceView* UAssetManager::CreateTextureFromCooked(const FCookedTextureView& InTexture)
+{
+	ID3D11Device* Device = URenderer::GetInstance().GetDevice();
+	if (!Device || InTexture.NumMips == 0)
+	{
+		return nullptr;
+	}
+
+	DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+	switch (InTexture.Format)
+	{
+	case ETextureFormat::BC1: Format = DXGI_FORMAT_BC1_UNORM; break;
+	case ETextureFormat::BC3: Format = DXGI_FORMAT_BC3_UNORM; break;
+	case ETextureFormat::BC5: Format = DXGI_FORMAT_BC5_UNORM; break;
+	case ETextureFormat::BC7: Format = DXGI_FORMAT_BC7_UNORM; break;
+	default: return nullptr;
+	}
+
+	D3D11_TEXTURE2D_DESC TextureDesc = {};
+	TextureDesc.Width = InTexture.Width;
+	TextureDesc.Height = InTexture.Height;
+	TextureDesc.MipLevels = InTexture.NumMips;
+	TextureDesc.ArraySize = 1;
+	TextureDesc.Format = Format;
+	TextureDesc.SampleDesc.Count = 1;
+	TextureDesc.Usage = D3D11_USAGE_IMMUTABLE;
+	TextureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	TArray<D3D11_SUBRESOURCE_DATA> SubresourceData(InTexture.NumMips);
+	for (uint32 MipIndex = 0; MipIndex < InTexture.NumMips; ++MipIndex)
+	{
+		const FCookedMip& Mip = InTexture.Mips[MipIndex];
+		SubresourceData[MipIndex].pSysMem = InTexture.Data + Mip.Offset;
+		SubresourceData[MipIndex].SysMemPitch = Mip.RowPitch;
+		SubresourceData[MipIndex].SysMemSlicePitch = static_cast<UINT>(Mip.Size);
+	}
+
+	ComPtr<ID3D11Texture2D> Texture;
+	HRESULT ResultHandle = Device->CreateTexture2D(&TextureDesc, SubresourceData.data(), Texture.GetAddressOf());
+	if (FAILED(ResultHandle))
+	{
+		UE_LOG_ERROR("ResourceManager: 쿠킹 텍스처 생성 실패 (HRESULT: 0x%08lX)", ResultHandle);
+		return nullptr;
+	}
+
+	ID3D11ShaderResourceView* TextureSRV = nullptr;
+	ResultHandle = Device->CreateShaderResourceView(Texture.Get(), nullptr, &TextureSRV);
+	if (FAILED(ResultHandle))
+	{
+		UE_LOG_ERROR("ResourceManager: 쿠킹 텍스처 SRV 생성 실패 (HRESULT: 0x%08lX)", ResultHandle);
+		return nullptr;
+	}
+
+	return TextureSRV;
+}
+
+/**
+ * @brief 메모리의 이미지 파일(PNG, JPG, BMP 등)을 WIC로 RGBA8 픽셀로 푼다 (쿠커 입력)
+ * COM이 초기화된 스레드에서 불러야 한다
+ */
+bool UAssetManager::DecodeImageFromMemory(const void* InData, size_t InDataSize, FTextureImage& OutImage)
+{
+	if (!InData || InDataSize == 0 || InDataSize > UINT32_MAX)
+	{
+		return false;
+	}
+
+	ComPtr<IWICImagingFactory> Factory;
+	HRESULT ResultHandle = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(Factory.GetAddressOf()));
+	if (FAILED(ResultHandle))
+	{
+		UE_LOG_ERROR("ResourceManager: WIC 팩토리 생성 실패 (HRESULT: 0x%08lX)", ResultHandle);
+		return false;
+	}
+
+	ComPtr<IWICStream> Stream;
+	ComPtr<IWICBitmapDecoder> Decoder;
+	ComPtr<IWICBitmapFrameDecode> Frame;
+	ComPtr<IWICFormatConverter> Converter;
+	ResultHandle = Factory->CreateStream(Stream.GetAddressOf());
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Stream->InitializeFromMemory(static_cast<BYTE*>(const_cast<void*>(InData)), static_cast<DWORD>(InDataSize));
+	}
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Factory->CreateDecoderFromStream(Stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, Decoder.GetAddressOf());
+	}
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Decoder->GetFrame(0, Frame.GetAddressOf());
+	}
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Factory->CreateFormatConverter(Converter.GetAddressOf());
+	}
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Converter->Initialize(Frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeCustom);
+	}
+
+	UINT Width = 0;
+	UINT Height = 0;
+	if (SUCCEEDED(ResultHandle))
+	{
+		ResultHandle = Converter->GetSize(&Width, &Height);
+	}
+	if (FAILED(ResultHandle) || Width == 0 || Height == 0)
+	{
+		UE_LOG_ERROR("ResourceManager: WIC 이미지 디코딩 실패 (HRESULT: 0x%08lX)", ResultHandle);
+		return false;
+	}
+
+	OutImage.Resize(Width, Height);
+	ResultHandle = Converter->CopyPixels(nullptr, Width * 4, static_cast<UINT>(OutImage.Pixels.size()), OutImage.Pixels.data());
+	if (FAILED(ResultHandle))
+	{
+		UE_LOG_ERROR("ResourceManager: WIC 픽셀 복사 실패 (HRESULT: 0x%08lX)", ResultHandle);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief 위치 스트림으로부터 AABB(Axis-Aligned Bounding Box)를 계산하는 헬퍼 함수
+ * @param Positions 정점 위치 배열
  * @return 계산된 FAABB 객체
  */
-FAABB UAssetManager::CalculateAABB(const TArray<FNormalVertex>& Vertices)
+FAABB UAssetManager::CalculateAABB(const TArray<FMeshPosition>& Positions)
 {
 	__m128 minv = _mm_set1_ps(FLT_MAX);
 	__m128 maxv = _mm_set1_ps(-FLT_MAX);
 
-	for (const auto& Vertex : Vertices)
+	for (const auto& Position : Positions)
 	{
-		__m128 p = _mm_setr_ps(Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z, 0.0f);
+		__m128 p = _mm_setr_ps(Position.X, Position.Y, Position.Z, 0.0f);
 		minv = _mm_min_ps(minv, p);
 		maxv = _mm_max_ps(maxv, p);
 	}
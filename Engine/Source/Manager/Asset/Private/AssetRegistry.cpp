@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "Manager/Asset/Public/AssetRegistry.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	bool IsInLODFolder(const std::filesystem::path& InPath)
+	{
+		for (std::filesystem::path Current = InPath; !Current.empty() && Current != Current.parent_path(); Current = Current.parent_path())
+		{
+			FString Name = Current.filename().string();
+			std::transform(Name.begin(), Name.end(), Name.begin(),
+				[](unsigned char C) { return static_cast<char>(std::tolower(C)); });
+
+			if (Name == "lod")
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** @brief LOD 파일명에서 원본 경로를 만든다 (예: Data/LOD/apple_lod_050.obj -> Data/apple.obj) */
+	FString MakeLODSourcePath(const FString& InLODPath)
+	{
+		const std::filesystem::path LODPath(InLODPath);
+		const FString FileName = LODPath.stem().string();
+		const size_t LODPos = FileName.find("_lod_");
+		if (LODPos == FString::npos)
+		{
+			return FString();
+		}
+
+		const std::filesystem::path SourcePath = LODPath.parent_path().parent_path() / (FileName.substr(0, LODPos) + ".obj");
+		return SourcePath.generic_string();
+	}
+}
+
+void FAssetRegistry::ScanStaticMeshes(const FString& InRootDirectory)
+{
+	std::error_code ErrorCode;
+	if (!std::filesystem::is_directory(InRootDirectory, ErrorCode))
+	{
+		UE_LOG_WARNING("AssetRegistry: 애셋 디렉토리가 없습니다: %s", InRootDirectory.c_str());
+		return;
+	}
+
+	TArray<FString> SourcePaths;
+	TArray<FString> LODPaths;
+
+	std::filesystem::recursive_directory_iterator It(
+		InRootDirectory, std::filesystem::directory_options::skip_permission_denied, ErrorCode), End;
+	for (; It != End; It.increment(ErrorCode))
+	{
+		const auto& Entry = *It;
+		if (!Entry.is_regular_file() || Entry.path().extension() != ".obj")
+		{
+			continue;
+		}
+
+		if (IsInLODFolder(Entry.path().parent_path()))
+		{
+			LODPaths.push_back(Entry.path().generic_string());
+		}
+		else
+		{
+			SourcePaths.push_back(Entry.path().generic_string());
+		}
+	}
+
+	// 디렉토리 순회 순서는 파일 시스템마다 다르므로 경로로 정렬해 로드 순서를 고정한다
+	std::sort(SourcePaths.begin(), SourcePaths.end());
+	std::sort(LODPaths.begin(), LODPaths.end());
+
+	for (const FString& Path : SourcePaths)
+	{
+		AddEntry(Path, EAssetType::StaticMesh);
+	}
+
+	for (const FString& Path : LODPaths)
+	{
+		const uint32 Index = AddEntry(Path, EAssetType::StaticMesh);
+		FAssetRegistryEntry& Entry = Entries[Index];
+		Entry.bIsLOD = true;
+
+		const FString SourcePath = MakeLODSourcePath(Path);
+		if (!SourcePath.empty())
+		{
+			Entry.LODSourceIndex = FindByPath(FName(SourcePath));
+		}
+	}
+}
+
+uint32 FAssetRegistry::AddEntry(const FString& InPath, EAssetType InType)
+{
+	const FName Path(InPath);
+	auto Iter = PathToIndex.find(Path);
+	if (Iter != PathToIndex.end())
+	{
+		return Iter->second;
+	}
+
+	const uint32 Index = static_cast<uint32>(Entries.size());
+	FAssetRegistryEntry& Entry = Entries.emplace_back();
+	Entry.Path = Path;
+	Entry.Type = InType;
+	PathToIndex.emplace(Path, Index);
+	return Index;
+}
+
+void FAssetRegistry::AddDependency(uint32 InIndex, uint32 InDependencyIndex)
+{
+	TArray<uint32>& Dependencies = Entries[InIndex].Dependencies;
+	if (std::find(Dependencies.begin(), Dependencies.end(), InDependencyIndex) == Dependencies.end())
+	{
+		Dependencies.push_back(InDependencyIndex);
+	}
+}
+
+void FAssetRegistry::SetContentHash(uint32 InIndex, uint64 InContentHash, uint64 InFileSize)
+{
+	FAssetRegistryEntry& Entry = Entries[InIndex];
+	Entry.ContentHash = InContentHash;
+	Entry.FileSize = InFileSize;
+	ContentHashToIndex[static_cast<size_t>(Entry.Type)].emplace(InContentHash, InIndex);
+}
+
+int32 FAssetRegistry::FindByPath(const FName& InPath) const
+{
+	auto Iter = PathToIndex.find(InPath);
+	return Iter != PathToIndex.end() ? static_cast<int32>(Iter->second) : -1;
+}
+
+int32 FAssetRegistry::FindByContentHash(EAssetType InType, uint64 InContentHash) const
+{
+	const TMap<uint64, uint32>& HashMap = ContentHashToIndex[static_cast<size_t>(InType)];
+	auto Iter = HashMap.find(InContentHash);
+	return Iter != HashMap.end() ? static_cast<int32>(Iter->second) : -1;
+}
+
+void FAssetRegistry::Clear()
+{
+	Entries.clear();
+	PathToIndex.clear();
+	for (TMap<uint64, uint32>& HashMap : ContentHashToIndex)
+	{
+		HashMap.clear();
+	}
+}
+
+uint64 FAssetRegistry::HashBytes(const void* InData, size_t InSize)
+{
+	constexpr uint64 OffsetBasis = 0xcbf29ce484222325ULL;
+	constexpr uint64 Prime = 0x100000001b3ULL;
+
+	const uint8* Bytes = static_cast<const uint8*>(InData);
+	uint64 Hash = OffsetBasis ^ InSize;
+
+	size_t Offset = 0;
+	for (; Offset + sizeof(uint64) <= InSize; Offset += sizeof(uint64))
+	{
+		uint64 Word;
+		memcpy(&Word, Bytes + Offset, sizeof(uint64));
+		Hash = (Hash ^ Word) * Prime;
+		Hash ^= Hash >> 29;
+	}
+	for (; Offset < InSize; ++Offset)
+	{
+		Hash = (Hash ^ Bytes[Offset]) * Prime;
+	}
+	return Hash;
+}
+
+bool FAssetRegistry::ReadFileBytes(const FString& InPath, TArray<uint8>& OutBytes)
+{
+	std::ifstream File(InPath, std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize FileSize = File.tellg();
+	if (FileSize < 0)
+	{
+		return false;
+	}
+
+	OutBytes.resize(static_cast<size_t>(FileSize));
+	File.seekg(0, std::ios::beg);
+	return FileSize == 0 || static_cast<bool>(File.read(reinterpret_cast<char*>(OutBytes.data()), FileSize));
+}
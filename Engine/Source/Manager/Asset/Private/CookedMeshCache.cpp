@@ -0,0 +1,285 @@
+#include "pch.h"
+#include "Manager/Asset/Public/CookedMeshCache.h"
+
+#include "Component/Mesh/Public/MeshOptimizer.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/AssetRegistry.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	struct FCacheFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 OptimizerVersion;
+		uint32 NumEntries;
+		uint64 DataOffset;
+	};
+
+	struct FCacheFileEntry
+	{
+		uint64 SourceHash;
+		// 데이터 영역 시작 기준
+		uint64 DataOffset;
+		uint32 NumVertices;
+		uint32 NumIndices;
+	};
+
+	static_assert(sizeof(FCacheFileHeader) == 24, "Cache file header layout changed");
+	static_assert(sizeof(FCacheFileEntry) == 24, "Cache file entry layout changed");
+	static_assert(sizeof(FMeshSection) == 12, "Mesh section layout changed");
+
+	constexpr uint64 DATA_ALIGNMENT = 16;
+
+	uint64 AlignUp(uint64 InValue, uint64 InAlignment)
+	{
+		return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	uint64 GetMeshDataSize(uint64 InNumVertices, uint64 InNumIndices)
+	{
+		return InNumVertices * (sizeof(FMeshPosition) + sizeof(FMeshAttribute)) + InNumIndices * sizeof(uint32);
+	}
+
+	/** @brief 엔트리 데이터 시작에서 위치, 속성, 인덱스 순으로 스트림을 가리킨다 */
+	FCookedMeshView MakeView(const uint8* InData, uint32 InNumVertices, uint32 InNumIndices)
+	{
+		FCookedMeshView View;
+		View.NumVertices = InNumVertices;
+		View.NumIndices = InNumIndices;
+		View.Positions = reinterpret_cast<const FMeshPosition*>(InData);
+		InData += static_cast<uint64>(InNumVertices) * sizeof(FMeshPosition);
+		View.Attributes = reinterpret_cast<const FMeshAttribute*>(InData);
+		InData += static_cast<uint64>(InNumVertices) * sizeof(FMeshAttribute);
+		View.Indices = reinterpret_cast<const uint32*>(InData);
+		return View;
+	}
+}
+
+bool FCookedMeshCache::Load(const FString& InPath)
+{
+	Clear();
+
+	std::ifstream File(InPath, std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize FileSize = File.tellg();
+	if (FileSize < static_cast<std::streamsize>(sizeof(FCacheFileHeader)))
+	{
+		return false;
+	}
+
+	// 파일 전체를 한 번에 읽는다
+	LoadedFile.resize(static_cast<size_t>(FileSize));
+	File.seekg(0, std::ios::beg);
+	if (!File.read(reinterpret_cast<char*>(LoadedFile.data()), FileSize))
+	{
+		Clear();
+		return false;
+	}
+
+	FCacheFileHeader Header;
+	memcpy(&Header, LoadedFile.data(), sizeof(Header));
+	if (Header.Magic != FILE_MAGIC || Header.Version != FILE_VERSION || Header.OptimizerVersion != FMeshOptimizer::OPTIMIZER_VERSION)
+	{
+		UE_LOG_WARNING("CookedMeshCache: 버전이 맞지 않아 캐시를 버립니다: %s", InPath.c_str());
+		Clear();
+		return false;
+	}
+
+	const uint64 EntryTableOffset = sizeof(FCacheFileHeader);
+	const uint64 EntryTableEnd = EntryTableOffset + static_cast<uint64>(Header.NumEntries) * sizeof(FCacheFileEntry);
+	if (EntryTableEnd > Header.DataOffset || Header.DataOffset > static_cast<uint64>(FileSize) || Header.DataOffset % DATA_ALIGNMENT != 0)
+	{
+		UE_LOG_ERROR("CookedMeshCache: 손상된 캐시 파일입니다: %s", InPath.c_str());
+		Clear();
+		return false;
+	}
+
+	const uint8* DataSection = LoadedFile.data() + Header.DataOffset;
+	const uint64 DataSectionSize = static_cast<uint64>(FileSize) - Header.DataOffset;
+
+	Entries.reserve(Header.NumEntries);
+	for (uint32 i = 0; i < Header.NumEntries; ++i)
+	{
+		FCacheFileEntry FileEntry;
+		memcpy(&FileEntry, LoadedFile.data() + EntryTableOffset + i * sizeof(FCacheFileEntry), sizeof(FileEntry));
+
+		if (FileEntry.DataOffset % DATA_ALIGNMENT != 0 || FileEntry.DataOffset > DataSectionSize ||
+			GetMeshDataSize(FileEntry.NumVertices, FileEntry.NumIndices) > DataSectionSize - FileEntry.DataOffset)
+		{
+			UE_LOG_ERROR("CookedMeshCache: 손상된 캐시 파일입니다: %s", InPath.c_str());
+			Clear();
+			return false;
+		}
+
+		FEntry Entry;
+		Entry.SourceHash = FileEntry.SourceHash;
+		Entry.View = MakeView(DataSection + FileEntry.DataOffset, FileEntry.NumVertices, FileEntry.NumIndices);
+
+		KeyToEntry[Entry.SourceHash] = static_cast<uint32>(Entries.size());
+		Entries.push_back(Entry);
+	}
+
+	return true;
+}
+
+bool FCookedMeshCache::Save(const FString& InPath)
+{
+	// 엔트리마다 데이터 위치를 먼저 정한다
+	FCacheFileHeader Header = {};
+	Header.Magic = FILE_MAGIC;
+	Header.Version = FILE_VERSION;
+	Header.OptimizerVersion = FMeshOptimizer::OPTIMIZER_VERSION;
+	Header.NumEntries = static_cast<uint32>(Entries.size());
+	Header.DataOffset = AlignUp(sizeof(FCacheFileHeader) + Entries.size() * sizeof(FCacheFileEntry), DATA_ALIGNMENT);
+
+	TArray<FCacheFileEntry> FileEntries(Entries.size());
+	uint64 DataSize = 0;
+	for (size_t i = 0; i < Entries.size(); ++i)
+	{
+		const FCookedMeshView& View = Entries[i].View;
+		FCacheFileEntry& FileEntry = FileEntries[i];
+		FileEntry = {};
+		FileEntry.SourceHash = Entries[i].SourceHash;
+		FileEntry.NumVertices = View.NumVertices;
+		FileEntry.NumIndices = View.NumIndices;
+		FileEntry.DataOffset = DataSize;
+
+		DataSize = AlignUp(DataSize + GetMeshDataSize(View.NumVertices, View.NumIndices), DATA_ALIGNMENT);
+	}
+
+	TArray<uint8> Buffer(Header.DataOffset + DataSize, 0);
+	memcpy(Buffer.data(), &Header, sizeof(Header));
+	if (!FileEntries.empty())
+	{
+		memcpy(Buffer.data() + sizeof(Header), FileEntries.data(), FileEntries.size() * sizeof(FCacheFileEntry));
+	}
+	for (size_t i = 0; i < Entries.size(); ++i)
+	{
+		const FCookedMeshView& View = Entries[i].View;
+		uint8* Data = Buffer.data() + Header.DataOffset + FileEntries[i].DataOffset;
+		memcpy(Data, View.Positions, View.NumVertices * sizeof(FMeshPosition));
+		Data += View.NumVertices * sizeof(FMeshPosition);
+		memcpy(Data, View.Attributes, View.NumVertices * sizeof(FMeshAttribute));
+		Data += View.NumVertices * sizeof(FMeshAttribute);
+		memcpy(Data, View.Indices, View.NumIndices * sizeof(uint32));
+	}
+
+	// 쓰다가 끊겨도 이전 캐시가 남도록 임시 파일에 쓴 뒤 바꾼다
+	std::error_code ErrorCode;
+	const std::filesystem::path Path(InPath);
+	if (Path.has_parent_path())
+	{
+		std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+	}
+
+	const std::filesystem::path TempPath = Path.string() + ".tmp";
+	{
+		std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+		if (!File.is_open() || !File.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size())))
+		{
+			UE_LOG_ERROR("CookedMeshCache: 캐시 파일을 쓰지 못했습니다: %s", InPath.c_str());
+			return false;
+		}
+	}
+
+	std::filesystem::rename(TempPath, Path, ErrorCode);
+	if (ErrorCode)
+	{
+		UE_LOG_ERROR("CookedMeshCache: 캐시 파일을 바꾸지 못했습니다: %s", InPath.c_str());
+		std::filesystem::remove(TempPath, ErrorCode);
+		return false;
+	}
+
+	bIsDirty = false;
+	return true;
+}
+
+const FCookedMeshView* FCookedMeshCache::Find(uint64 InSourceHash) const
+{
+	auto Iter = KeyToEntry.find(InSourceHash);
+	if (Iter == KeyToEntry.end())
+	{
+		return nullptr;
+	}
+	return &Entries[Iter->second].View;
+}
+
+void FCookedMeshCache::Add(uint64 InSourceHash, const FStaticMesh& InOptimizedMesh)
+{
+	auto Mesh = std::make_unique<FAddedMesh>();
+	Mesh->Positions = InOptimizedMesh.Positions;
+	Mesh->Attributes = InOptimizedMesh.Attributes;
+	Mesh->Indices = InOptimizedMesh.Indices;
+
+	FEntry Entry;
+	Entry.SourceHash = InSourceHash;
+	Entry.View.NumVertices = static_cast<uint32>(Mesh->Positions.size());
+	Entry.View.NumIndices = static_cast<uint32>(Mesh->Indices.size());
+	Entry.View.Positions = Mesh->Positions.data();
+	Entry.View.Attributes = Mesh->Attributes.data();
+	Entry.View.Indices = Mesh->Indices.data();
+	AddedMeshes.push_back(std::move(Mesh));
+
+	auto Iter = KeyToEntry.find(InSourceHash);
+	if (Iter != KeyToEntry.end())
+	{
+		Entries[Iter->second] = Entry;
+	}
+	else
+	{
+		KeyToEntry.emplace(InSourceHash, static_cast<uint32>(Entries.size()));
+		Entries.push_back(Entry);
+	}
+	bIsDirty = true;
+}
+
+void FCookedMeshCache::Clear()
+{
+	Entries.clear();
+	KeyToEntry.clear();
+	LoadedFile = TArray<uint8>();
+	AddedMeshes.clear();
+	bIsDirty = false;
+}
+
+uint64 FCookedMeshCache::HashSourceMesh(const FStaticMesh& InMesh)
+{
+	// 스트림마다 해시한 뒤 순서를 구분해 섞는다
+	const uint64 StreamHashes[] =
+	{
+		FAssetRegistry::HashBytes(InMesh.Positions.data(), InMesh.Positions.size() * sizeof(FMeshPosition)),
+		FAssetRegistry::HashBytes(InMesh.Attributes.data(), InMesh.Attributes.size() * sizeof(FMeshAttribute)),
+		FAssetRegistry::HashBytes(InMesh.Indices.data(), InMesh.Indices.size() * sizeof(uint32)),
+		FAssetRegistry::HashBytes(InMesh.Sections.data(), InMesh.Sections.size() * sizeof(FMeshSection)),
+	};
+	return FAssetRegistry::HashBytes(StreamHashes, sizeof(StreamHashes));
+}
+
+bool FCookedMeshCache::Apply(const FCookedMeshView& InView, FStaticMesh& InOutMesh)
+{
+	// 최적화는 인덱스 수를 바꾸지 않고, 쓰이지 않는 정점만 뺀다
+	if (InView.NumIndices != InOutMesh.Indices.size() || InView.NumVertices > InOutMesh.Positions.size())
+	{
+		return false;
+	}
+	for (uint32 i = 0; i < InView.NumIndices; ++i)
+	{
+		if (InView.Indices[i] >= InView.NumVertices)
+		{
+			return false;
+		}
+	}
+
+	InOutMesh.Positions.assign(InView.Positions, InView.Positions + InView.NumVertices);
+	InOutMesh.Attributes.assign(InView.Attributes, InView.Attributes + InView.NumVertices);
+	InOutMesh.Indices.assign(InView.Indices, InView.Indices + InView.NumIndices);
+	return true;
+}
@@ -4,6 +4,7 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/AssetLoader.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
 #include <filesystem>
@@ -11,25 +12,6 @@
 // static 멤버 변수의 실체를 정의(메모리 할당)합니다.
 TMap<FName, std::unique_ptr<FStaticMesh>> FObjManager::ObjFStaticMeshMap;
 
-/** @brief: Vertex Key for creating index buffer */
-using VertexKey = std::tuple<size_t, size_t, size_t>;
-
-struct VertexKeyHash
-{
-	std::size_t operator() (VertexKey Key) const
-	{
-		auto Hash1 = std::hash<size_t>{}(std::get<0>(Key));
-		auto Hash2 = std::hash<size_t>{}(std::get<1>(Key));
-		auto Hash3 = std::hash<size_t>{}(std::get<2>(Key));
-
-		std::size_t Seed = Hash1;
-		Seed ^= Hash2 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
-		Seed ^= Hash3 + 0x9e3779b97f4a7c15ULL + (Seed << 6) + (Seed >> 2);
-
-		return Seed;
-	}
-};
-
 /** @todo: std::filesystem으로 변경 */
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
@@ -47,134 +29,33 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return nullptr;
 	}
 
-	auto StaticMesh = std::make_unique<FStaticMesh>();
-	StaticMesh->PathFileName = PathFileName;
-
-	if (ObjInfo.ObjectInfoList.size() == 0)
+	/** #2. 정점/재질/섹션 쿠킹 */
+	std::unique_ptr<FStaticMesh> StaticMesh = FAssetLoader::CookStaticMesh(PathFileName, ObjInfo, Config);
+	if (!StaticMesh)
 	{
-		UE_LOG_ERROR("오브젝트 정보를 찾을 수 없습니다");
 		return nullptr;
 	}
 
-	/** #2. 오브젝트 정보로부터 버텍스 배열과 인덱스 배열을 구성 */
-	/** @note: Use only first object in '.obj' file to create FStaticMesh. */
-	FObjectInfo& ObjectInfo = ObjInfo.ObjectInfoList[0];
-
-	TMap<VertexKey, size_t, VertexKeyHash> VertexMap;
-	for (size_t i = 0; i < ObjectInfo.VertexIndexList.size(); ++i)
-	{
-		size_t VertexIndex = ObjectInfo.VertexIndexList[i];
-
-		size_t NormalIndex = INVALID_INDEX;
-		if (!ObjectInfo.NormalIndexList.empty())
-		{
-			NormalIndex = ObjectInfo.NormalIndexList[i];
-		}
-
-		size_t TexCoordIndex = INVALID_INDEX;
-		if (!ObjectInfo.TexCoordIndexList.empty())
-		{
-			TexCoordIndex = ObjectInfo.TexCoordIndexList[i];
-		}
-
-		VertexKey Key{ VertexIndex, NormalIndex, TexCoordIndex };
-		auto It = VertexMap.find(Key);
-		if (It == VertexMap.end())
-		{
-			FNormalVertex Vertex = {};
-			Vertex.Position = ObjInfo.VertexList[VertexIndex];
-
-			if (NormalIndex != INVALID_INDEX)
-			{
-				assert("Vertex normal index out of range" && NormalIndex < ObjInfo.NormalList.size());
-				Vertex.Normal = ObjInfo.NormalList[NormalIndex];
-			}
-
-			if (TexCoordIndex != INVALID_INDEX)
-			{
-				assert("Texture coordinate index out of range" && TexCoordIndex < ObjInfo.TexCoordList.size());
-				Vertex.TexCoord = ObjInfo.TexCoordList[TexCoordIndex];
-			}
-
-			size_t Index = StaticMesh->Vertices.size();
-			StaticMesh->Vertices.push_back(Vertex);
-			StaticMesh->Indices.push_back(Index);
-			VertexMap[Key] = Index;
-		}
-		else
-		{
-			StaticMesh->Indices.push_back(It->second);
-		}
-	}
+	return AddStaticMeshAsset(std::move(StaticMesh));
+}
 
-	/** #3. 오브젝트가 사용하는 머티리얼의 목록을 저장 */
-	TSet<FName> UniqueMaterialNames;
-	for (const auto& MaterialName : ObjectInfo.MaterialNameList)
+FStaticMesh* FObjManager::AddStaticMeshAsset(std::unique_ptr<FStaticMesh> InStaticMeshAsset)
+{
+	if (!InStaticMeshAsset)
 	{
-		UniqueMaterialNames.insert(MaterialName);
+		return nullptr;
 	}
 
-	StaticMesh->MaterialInfo.resize(UniqueMaterialNames.size());
-	TMap<FName, int32> MaterialNameToSlot;
-	int32 CurrentMaterialSlot = 0;
-
-	for (const auto& MaterialName : UniqueMaterialNames)
-	{
-		for (size_t j = 0; j < ObjInfo.ObjectMaterialInfoList.size(); ++j)
-		{
-			if (MaterialName == ObjInfo.ObjectMaterialInfoList[j].Name)
-			{
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Name = std::move(ObjInfo.ObjectMaterialInfoList[j].Name);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ka = std::move(ObjInfo.ObjectMaterialInfoList[j].Ka);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Kd = std::move(ObjInfo.ObjectMaterialInfoList[j].Kd);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ks = std::move(ObjInfo.ObjectMaterialInfoList[j].Ks);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ke = std::move(ObjInfo.ObjectMaterialInfoList[j].Ke);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ns = std::move(ObjInfo.ObjectMaterialInfoList[j].Ns);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Ni = std::move(ObjInfo.ObjectMaterialInfoList[j].Ni);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].D = std::move(ObjInfo.ObjectMaterialInfoList[j].D);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].Illumination = std::move(ObjInfo.ObjectMaterialInfoList[j].Illumination);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].KaMap = std::move(ObjInfo.ObjectMaterialInfoList[j].KaMap);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].KdMap = std::move(ObjInfo.ObjectMaterialInfoList[j].KdMap);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].KsMap = std::move(ObjInfo.ObjectMaterialInfoList[j].KsMap);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].NsMap = std::move(ObjInfo.ObjectMaterialInfoList[j].NsMap);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].DMap = std::move(ObjInfo.ObjectMaterialInfoList[j].DMap);
-				StaticMesh->MaterialInfo[CurrentMaterialSlot].BumpMap = std::move(ObjInfo.ObjectMaterialInfoList[j].BumpMap);
-
-				MaterialNameToSlot.emplace(MaterialName, CurrentMaterialSlot);
-				CurrentMaterialSlot++;
-				break;
-			}
-		}
-	}
-	/** #4. 오브젝트의 서브메쉬 정보를 저장 */
-	StaticMesh->Sections.resize(ObjectInfo.MaterialIndexList.size());
-	for (size_t i = 0; i < ObjectInfo.MaterialIndexList.size(); ++i)
+	const FName PathFileName = InStaticMeshAsset->PathFileName;
+	auto Iter = ObjFStaticMeshMap.find(PathFileName);
+	if (Iter != ObjFStaticMeshMap.end())
 	{
-		StaticMesh->Sections[i].StartIndex = ObjectInfo.MaterialIndexList[i] * 3;
-		if (i < ObjectInfo.MaterialIndexList.size() - 1)
-		{
-			StaticMesh->Sections[i].IndexCount = (ObjectInfo.MaterialIndexList[i + 1] - ObjectInfo.MaterialIndexList[i]) * 3;
-		}
-		else
-		{
-			StaticMesh->Sections[i].IndexCount = (StaticMesh->Indices.size() / 3 - ObjectInfo.MaterialIndexList[i]) * 3;
-		}
-
-		const FName& MaterialName = ObjectInfo.MaterialNameList[i];
-		auto It = MaterialNameToSlot.find(MaterialName);
-		if (It != MaterialNameToSlot.end())
-		{
-			StaticMesh->Sections[i].MaterialSlot = It->second;
-		}
-		else
-		{
-			StaticMesh->Sections[i].MaterialSlot = INVALID_INDEX;
-		}
+		return Iter->second.get();
 	}
 
-	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
-
-	return ObjFStaticMeshMap[PathFileName].get();
+	FStaticMesh* StaticMeshAsset = InStaticMeshAsset.get();
+	ObjFStaticMeshMap.emplace(PathFileName, std::move(InStaticMeshAsset));
+	return StaticMeshAsset;
 }
 
 /**
@@ -197,6 +78,7 @@ void FObjManager::CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* S
 	{
 		const FMaterial& MaterialInfo = StaticMeshAsset->MaterialInfo[i];
 		auto* Material = new UMaterial();
+		Material->SetMaterialData(MaterialInfo);
 
 		// Diffuse 텍스처 로드 (map_Kd)
 		if (!MaterialInfo.KdMap.empty())
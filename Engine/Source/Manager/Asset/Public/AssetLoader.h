@@ -0,0 +1,102 @@
+#pragma once
+#include "Manager/Asset/Public/AssetRegistry.h"
+#include "Manager/Asset/Public/ObjImporter.h"
+
+#include <memory>
+
+struct FStaticMesh;
+
+struct FAssetLoadSettings
+{
+	FString RootDirectory = "Data/";
+	FObjImporter::Configuration ObjConfig;
+	// 비어 있지 않으면 ObjConfig.bOptimizeMesh의 결과를 이 파일(FCookedMeshCache)에 캐싱해 다음 로드부터 최적화를 건너뛴다
+	FString CookedMeshCachePath;
+	// false면 같은 단계를 호출 스레드에서 차례로 실행한다 (비교용)
+	bool bParallel = true;
+};
+
+struct FAssetLoadStats
+{
+	uint32 NumStaticMeshes = 0;
+	uint32 NumFailedStaticMeshes = 0;
+	// 최적화 결과를 쿠킹된 메시 캐시에서 가져온 메시 수
+	uint32 NumCachedStaticMeshes = 0;
+	uint32 NumTextures = 0;
+	// 내용 해시가 겹치지 않는 텍스처 수 (디바이스 리소스를 실제로 만드는 수)
+	uint32 NumUniqueTextures = 0;
+	uint64 NumTextureBytes = 0;
+
+	double ScanMs = 0.0;
+	double MeshMs = 0.0;
+	double TextureMs = 0.0;
+	double TotalMs = 0.0;
+};
+
+/**
+ * @brief 작업 스레드에서 디코딩을 마친 메시, 디바이스 리소스만 만들면 된다
+ */
+struct FLoadedStaticMesh
+{
+	uint32 EntryIndex = 0;
+	std::unique_ptr<FStaticMesh> Asset;
+};
+
+/**
+ * @brief 작업 스레드에서 읽은 텍스처 파일
+ */
+struct FLoadedTexture
+{
+	uint32 EntryIndex = 0;
+	// 같은 내용의 텍스처가 경로 순으로 먼저 있으면 그 엔트리 (FileBytes는 비워 둔다), 대표 텍스처면 -1
+	int32 SourceEntryIndex = -1;
+	TArray<uint8> FileBytes;
+};
+
+/**
+ * @brief 시작 시 애셋 로더
+ * 1. 레지스트리에 메시 파일을 경로 순으로 등록하고
+ * 2. OBJ/objbin 파싱(MTL 포함), 정점 쿠킹, 정점 캐시 최적화(캐시에 있으면 그 결과), 삼각형 BVH 빌드를 메시마다 작업 스레드에서 하고
+ * 3. 재질이 쓰는 텍스처 파일을 작업 스레드에서 읽어 내용 해시로 중복을 묶는다
+ * 디바이스 리소스는 만들지 않는다, 소유 스레드가 GetTextures -> GetStaticMeshes 순서로 결과를 넘겨받아 만든다
+ * D3D에 의존하지 않으므로 헤드리스 벤치마크에서도 같은 경로를 돌린다
+ */
+class FAssetLoader
+{
+public:
+	FAssetLoadStats Load(const FAssetLoadSettings& InSettings);
+
+	const FAssetRegistry& GetRegistry() const { return Registry; }
+	TArray<FLoadedStaticMesh>& GetStaticMeshes() { return StaticMeshes; }
+	TArray<FLoadedTexture>& GetTextures() { return Textures; }
+
+	/**
+	 * @brief 파싱한 OBJ를 FStaticMesh로 쿠킹한다 (첫 오브젝트만 사용, 정점 중복 제거 + 재질 슬롯 + 섹션)
+	 * InObjInfo의 재질 정보는 결과로 옮겨지므로 이후 비어 있다
+	 * InConfig.bOptimizeMesh면 인덱스/정점 순서를 GPU 캐시에 맞게 다시 배치한다
+	 * @return 오브젝트가 없으면 nullptr
+	 */
+	static std::unique_ptr<FStaticMesh> CookStaticMesh(const FName& InPathFileName, FObjInfo& InObjInfo,
+		const FObjImporter::Configuration& InConfig = {});
+
+	/** @brief 재질이 참조하는 텍스처 중 실제로 있는 파일 경로 (OBJ 디렉토리 기준, '/' 구분) */
+	static void CollectTexturePaths(const FStaticMesh& InStaticMesh, TArray<FString>& OutPaths);
+
+private:
+	template<typename BodyType>
+	void ForEach(uint32 InCount, BodyType&& InBody) const;
+
+	/**
+	 * @brief InOrder 순서대로 항목 하나씩 실행한다, 병렬이면 스레드마다 공유 커서에서 다음 항목을 가져간다
+	 * 크기가 큰 항목부터 넣으면 마지막에 큰 파일 하나만 남아 한 스레드가 꼬리를 끄는 일이 줄어든다
+	 * @param InBody void(uint32 Index)
+	 */
+	template<typename BodyType>
+	void ForEachInOrder(const TArray<uint32>& InOrder, BodyType&& InBody) const;
+
+	bool bParallel = true;
+
+	FAssetRegistry Registry;
+	TArray<FLoadedStaticMesh> StaticMeshes;
+	TArray<FLoadedTexture> Textures;
+};
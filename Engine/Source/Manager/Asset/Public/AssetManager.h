@@ -4,6 +4,8 @@
 #include "Component/Mesh/Public/StaticMesh.h"
 
 struct FAABB;
+struct FCookedTextureView;
+struct FTextureImage;
 
 /**
  * @brief 전역의 On-Memory Asset을 관리하는 매니저 클래스
@@ -21,6 +23,7 @@ public:
 
 	// Vertex 관련 함수들
 	TArray<FNormalVertex>* GetVertexData(EPrimitiveType InType);
+	const TArray<FMeshPosition>* GetPositionData(EPrimitiveType InType);
 	ID3D11Buffer* GetVertexbuffer(EPrimitiveType InType);
 	uint32 GetNumVertices(EPrimitiveType InType);
 
@@ -43,14 +46,16 @@ public:
 
 	// StaticMesh 관련 함수
 	void LoadAllObjStaticMesh();
-	ID3D11Buffer* CreateVertexBuffer(TArray<FNormalVertex> InVertices);
 	ID3D11Buffer* GetVertexBuffer(FName InObjPath);
+	ID3D11Buffer* GetAttributeBuffer(FName InObjPath);
 	ID3D11Buffer* CreateIndexBuffer(TArray<uint32> InIndices);
 	ID3D11Buffer* GetIndexBuffer(FName InObjPath);
 
 	// Create Texture
 	static ID3D11ShaderResourceView* CreateTextureFromFile(const path& InFilePath);
 	static ID3D11ShaderResourceView* CreateTextureFromMemory(const void* InData, size_t InDataSize);
+	static ID3D11ShaderResourceView* CreateTextureFromCooked(const FCookedTextureView& InTexture);
+	static bool DecodeImageFromMemory(const void* InData, size_t InDataSize, FTextureImage& OutImage);
 
 	// Bounding Box
 	const FAABB& GetAABB(EPrimitiveType InType);
@@ -61,6 +66,7 @@ private:
 	TMap<EPrimitiveType, ID3D11Buffer*> VertexBuffers;
 	TMap<EPrimitiveType, uint32> NumVertices;
 	TMap<EPrimitiveType, TArray<FNormalVertex>*> VertexDatas;
+	TMap<EPrimitiveType, TArray<FMeshPosition>> PositionDatas; // 피킹/오클루전용 위치 스트림
 
 	// 인덱스 리소스
 	TMap<EPrimitiveType, ID3D11Buffer*> IndexBuffers;
@@ -73,20 +79,24 @@ private:
 	TMap<EShaderType, ID3D11PixelShader*> PixelShaders;
 
 	// Texture Resource
-	TMap<FName, ID3D11ShaderResourceView*> TextureCache;
+	TFlatMap<FName, ID3D11ShaderResourceView*> TextureCache;
 
 	// StaticMesh Resource
-	TMap<FName, std::unique_ptr<UStaticMesh>> StaticMeshCache;
-	TMap<FName, ID3D11Buffer*> StaticMeshVertexBuffers;
-	TMap<FName, ID3D11Buffer*> StaticMeshIndexBuffers;
+	TFlatMap<FName, std::unique_ptr<UStaticMesh>> StaticMeshCache;
+	TFlatMap<FName, ID3D11Buffer*> StaticMeshVertexBuffers;		// 위치 스트림 (Slot 0)
+	TFlatMap<FName, ID3D11Buffer*> StaticMeshAttributeBuffers;	// 속성 스트림 (Slot 1)
+	TFlatMap<FName, ID3D11Buffer*> StaticMeshIndexBuffers;
+
+	void CreateStaticMeshBuffers(const FName& InObjPath, const UStaticMesh* InStaticMesh);
 
 	// Release Functions
 	void ReleaseAllTextures();
 
 	// Helper Functions
-	FAABB CalculateAABB(const TArray<FNormalVertex>& Vertices);
+	FAABB CalculateAABB(const TArray<FMeshPosition>& Positions);
 
 	// AABB Resource
 	TMap<EPrimitiveType, FAABB> AABBs;		// 각 타입별 AABB 저장
+	// 컴포넌트가 원소 주소를 BoundingBox로 들고 있으므로 노드 기반 TMap을 유지한다
 	TMap<FName, FAABB> StaticMeshAABBs;	// 스태틱 메시용 AABB 저장
 };
@@ -0,0 +1,73 @@
+#pragma once
+#include "Global/Types.h"
+
+enum class EAssetType : uint8
+{
+	StaticMesh,
+	Texture,
+
+	Count
+};
+
+/**
+ * @brief 레지스트리에 등록된 애셋 파일 하나
+ */
+struct FAssetRegistryEntry
+{
+	FName Path;
+	EAssetType Type = EAssetType::StaticMesh;
+
+	// 파일 내용 해시와 크기, 아직 읽지 않았으면 0
+	uint64 ContentHash = 0;
+	uint64 FileSize = 0;
+
+	// LOD 폴더의 메시면 원본 메시 엔트리 (원본이 없으면 -1)
+	bool bIsLOD = false;
+	int32 LODSourceIndex = -1;
+
+	// 이 애셋이 쓰는 다른 엔트리 (메시 -> 재질 텍스처)
+	TArray<uint32> Dependencies;
+};
+
+/**
+ * @brief 경로와 내용 해시로 찾는 애셋 목록
+ * 경로 순으로 정렬해 등록하므로 스레드 수와 관계없이 로드 순서가 같고,
+ * 경로가 달라도 내용이 같은 파일(LOD 폴더에 복사된 텍스처 등)은 내용 해시로 하나를 골라 함께 쓴다
+ * 등록은 소유 스레드에서만 하고, 작업 스레드는 엔트리를 읽기만 한다
+ */
+class FAssetRegistry
+{
+public:
+	/**
+	 * @brief 디렉토리 아래 .obj를 찾아 등록한다
+	 * 원본 메시를 모두 등록한 뒤 LOD 폴더 메시를 등록하고, 파일명의 "_lod_" 앞부분으로 원본을 찾아 이어 둔다
+	 */
+	void ScanStaticMeshes(const FString& InRootDirectory);
+
+	/** @return 엔트리 인덱스, 같은 경로가 이미 있으면 그 인덱스 */
+	uint32 AddEntry(const FString& InPath, EAssetType InType);
+	void AddDependency(uint32 InIndex, uint32 InDependencyIndex);
+
+	/** 내용을 읽은 뒤 해시를 기록한다, 같은 종류에서 같은 해시가 처음이면 대표 엔트리가 된다 */
+	void SetContentHash(uint32 InIndex, uint64 InContentHash, uint64 InFileSize);
+
+	/** @return 경로가 없으면 -1 */
+	int32 FindByPath(const FName& InPath) const;
+	/** @return 같은 종류에서 이 해시로 처음 기록된 엔트리, 없으면 -1 */
+	int32 FindByContentHash(EAssetType InType, uint64 InContentHash) const;
+
+	uint32 Num() const { return static_cast<uint32>(Entries.size()); }
+	const FAssetRegistryEntry& GetEntry(uint32 InIndex) const { return Entries[InIndex]; }
+	const TArray<FAssetRegistryEntry>& GetEntries() const { return Entries; }
+
+	void Clear();
+
+	/** 64비트 FNV-1a를 8바이트 단위로 돌린 해시 (파일 비교용, 암호학적 해시가 아니다) */
+	static uint64 HashBytes(const void* InData, size_t InSize);
+	static bool ReadFileBytes(const FString& InPath, TArray<uint8>& OutBytes);
+
+private:
+	TArray<FAssetRegistryEntry> Entries;
+	TMap<FName, uint32> PathToIndex;
+	TStaticArray<TMap<uint64, uint32>, static_cast<size_t>(EAssetType::Count)> ContentHashToIndex;
+};
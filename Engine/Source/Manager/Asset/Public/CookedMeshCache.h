@@ -0,0 +1,79 @@
+#pragma once
+#include "Global/CoreTypes.h"
+
+#include <memory>
+
+struct FStaticMesh;
+
+/**
+ * @brief 캐시 안 최적화된 정점/인덱스 스트림 하나 (포인터는 캐시가 가진 메모리를 가리킨다)
+ */
+struct FCookedMeshView
+{
+	uint32 NumVertices = 0;
+	uint32 NumIndices = 0;
+	const FMeshPosition* Positions = nullptr;
+	const FMeshAttribute* Attributes = nullptr;
+	const uint32* Indices = nullptr;
+};
+
+/**
+ * @brief 쿠킹 직후(최적화 전) 메시 내용 해시로 찾는 FMeshOptimizer 결과 캐시 파일
+ *
+ * 파일 레이아웃: 헤더 | 엔트리 표 | 스트림 데이터 (엔트리마다 위치, 속성, 인덱스 순, 16바이트 정렬)
+ * 섹션 범위와 재질은 최적화로 바뀌지 않으므로 정점/인덱스 스트림만 담는다
+ * 버전(파일 포맷 + 최적화기 버전)이 다르면 통째로 버린다
+ */
+class FCookedMeshCache
+{
+public:
+	/** @return 파일이 없거나 버전이 맞지 않으면 false (빈 캐시로 시작한다) */
+	bool Load(const FString& InPath);
+	bool Save(const FString& InPath);
+
+	/** @return 없으면 nullptr, 포인터는 Add나 Load를 다시 부르기 전까지 유효하다 */
+	const FCookedMeshView* Find(uint64 InSourceHash) const;
+
+	/** 최적화를 마친 메시의 스트림을 복사해 넣는다, 같은 키가 있으면 덮어쓴다 */
+	void Add(uint64 InSourceHash, const FStaticMesh& InOptimizedMesh);
+
+	void Clear();
+
+	uint32 Num() const { return static_cast<uint32>(Entries.size()); }
+	bool IsDirty() const { return bIsDirty; }
+
+	/** @brief 최적화 전 메시의 정점/인덱스 스트림과 섹션 해시 */
+	static uint64 HashSourceMesh(const FStaticMesh& InMesh);
+
+	/**
+	 * @brief 캐시의 스트림으로 메시의 정점/인덱스를 바꾼다
+	 * @return 인덱스 수가 맞지 않거나 범위를 벗어난 인덱스가 있으면 false (메시는 그대로 둔다)
+	 */
+	static bool Apply(const FCookedMeshView& InView, FStaticMesh& InOutMesh);
+
+	static constexpr uint32 FILE_MAGIC = 0x434D5447; // "GTMC"
+	static constexpr uint32 FILE_VERSION = 1;
+
+private:
+	struct FEntry
+	{
+		uint64 SourceHash = 0;
+		FCookedMeshView View;
+	};
+
+	struct FAddedMesh
+	{
+		TArray<FMeshPosition> Positions;
+		TArray<FMeshAttribute> Attributes;
+		TArray<uint32> Indices;
+	};
+
+	TArray<FEntry> Entries;
+	TMap<uint64, uint32> KeyToEntry;
+
+	// 파일에서 읽은 원본 버퍼 (View가 가리킨다)
+	TArray<uint8> LoadedFile;
+	// Add로 넣은 스트림, 주소가 바뀌지 않게 unique_ptr로 보관한다
+	TArray<std::unique_ptr<FAddedMesh>> AddedMeshes;
+	bool bIsDirty = false;
+};
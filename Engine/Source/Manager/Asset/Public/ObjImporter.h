@@ -157,7 +157,12 @@ struct FObjImporter
 		bool bFlipWindingOrder = false;
 		bool bPositionToUEBasis = false;
 		bool bUVToUEBasis = false;
+		// 쿠킹할 때 섹션별 정점 캐시/오버드로 순서와 정점 fetch 순서를 최적화한다 (FMeshOptimizer)
+		bool bOptimizeMesh = true;
 		// ...
+
+		// 기본 인자(= {})에서 쓰이므로 생성자를 직접 선언한다 (GCC는 바깥 클래스가 끝나기 전의 NSDMI 사용을 거부)
+		Configuration() {}
 	};
 
 	/**
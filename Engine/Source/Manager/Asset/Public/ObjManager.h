@@ -9,6 +9,8 @@ class FObjManager
 {
 public:
 	static FStaticMesh* LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
+	/** @brief 다른 스레드에서 쿠킹한 애셋을 캐시에 넣는다, 같은 경로가 이미 있으면 기존 애셋을 돌려준다 */
+	static FStaticMesh* AddStaticMeshAsset(std::unique_ptr<FStaticMesh> InStaticMeshAsset);
 	static UStaticMesh* LoadObjStaticMesh(const FName& PathFileName, const FObjImporter::Configuration& Config = {});
 	static void CreateMaterialsFromMTL(UStaticMesh* StaticMesh, FStaticMesh* StaticMeshAsset, const FName& ObjFilePath);
 
@@ -7,6 +7,9 @@
 #include "Editor/Public/ObjectPicker.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/BVH/public/PotentiallyVisibleSet.h"
+#include "Manager/Transform/Public/TransformManager.h"
+#include "World/Public/WorldCloner.h"
 
 IMPLEMENT_SINGLETON_CLASS_BASE(UBVHManager)
 
@@ -22,113 +25,38 @@ void UBVHManager::Initialize()
 
 void UBVHManager::Build(const TArray<FBVHPrimitive>& InPrimitives, int MaxLeafSize)
 {
-	Nodes.clear();
 	Primitives = InPrimitives;
 
-	if (Primitives.empty())
+	Boxes.clear();
+	Boxes.reserve(Primitives.size());
+	for (const FBVHPrimitive& Prim : Primitives)
 	{
-		RootIndex = -1;
-
-		return;
+		Boxes.push_back(Prim.Bounds);
 	}
 
-	RootIndex = BuildRecursive(0, static_cast<int>(Primitives.size()), MaxLeafSize);
-}
-
-int UBVHManager::BuildRecursive(int Start, int Count, int MaxLeafSize)
-{
-	FBVHNode Node;
-
-	// 1. Compute bounds for this node
-	FAABB Bounds = FAABB(
-		FVector(+FLT_MAX, +FLT_MAX, +FLT_MAX),
-		FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX)
-		);
-	for (int i = 0; i < Count; i++)
-	{
-		int Index = Start + i;
-		FAABB primitiveBounds = Primitives[Index].Bounds;
-		Bounds = Bounds.Union(Bounds, primitiveBounds);
-	}
-	Node.Bounds = Bounds;
-
-	// 2. Leaf condition
-	if (Count <= MaxLeafSize)
-	{
-		Node.bIsLeaf = true;
-		Node.Start = Start;
-		Node.Count = Count;
-
-		int NodeIndex = Nodes.size();
-		Nodes.push_back(Node);
-		return NodeIndex;
-	}
-
-	// 3. Choose split axis (largest variance of centers)
-	FVector Mean(0,0,0), Var(0,0,0);
-	for (int i = 0; i < Count; i++)
-		Mean += Primitives[Start + i].Center;
-	Mean /= (float)Count;
-
-	__m128 var = _mm_setzero_ps();
-	__m128 mean = _mm_setr_ps(Mean.X, Mean.Y, Mean.Z, 0.0f);
-
-	for (int i = 0; i < Count; i++) {
-		__m128 c = _mm_setr_ps(Primitives[Start + i].Center.X,
-							   Primitives[Start + i].Center.Y,
-							   Primitives[Start + i].Center.Z, 0.0f);
-		__m128 d = _mm_sub_ps(c, mean);
-		var = _mm_add_ps(var, _mm_mul_ps(d,d));
-	}
-
-	alignas(16) float tmp[4];
-	_mm_store_ps(tmp, var);
-	Var = FVector(tmp[0], tmp[1], tmp[2]);
-
-	int Axis = 0;
-	if (Var.Y > Var.X) Axis = 1;
-	if (Var.Z > Var[Axis]) Axis = 2;
-
-	int Mid = Start + Count / 2;
-	// 4. Sort primitives along chosen axis
-	std::nth_element(
-	Primitives.begin() + Start,
-	Primitives.begin() + Mid,
-	Primitives.begin() + Start + Count,
-	[Axis](const FBVHPrimitive& A, const FBVHPrimitive& B) {
-		return A.Center[Axis] < B.Center[Axis];
-	});
-
-	// 5. Recurse children
-	int LeftIndex = BuildRecursive(Start, Mid - Start, MaxLeafSize);
-	int RightIndex = BuildRecursive(Mid, Count - (Mid - Start), MaxLeafSize);
-
-	Node.LeftChild = LeftIndex;
-	Node.RightChild = RightIndex;
-
-	int NodeIndex = Nodes.size();
-	Nodes.push_back(Node);
-	return NodeIndex;
+	Tree.Build(Boxes, MaxLeafSize);
+	++Version;
 }
 
 void UBVHManager::Refit()
 {
-	if (Nodes.empty() || Primitives.empty())
+	if (Tree.IsEmpty() || Primitives.empty())
 	{
-		RootIndex = -1;
 		return;
 	}
 
-	// Step 1: Update primitive bounds from their components
-	for (FBVHPrimitive& Prim : Primitives)
+	// Step 1: 트랜스폼이 바뀐 구간만 계층에서 월드 바운드를 한 번에 다시 계산한다
+	UTransformManager::GetInstance().Update();
+
+	// Step 2: Update primitive bounds from the cached world bounds
+	for (size_t i = 0; i < Primitives.size(); ++i)
 	{
+		FBVHPrimitive& Prim = Primitives[i];
 		if (!Prim.Primitive || !Prim.Primitive->IsVisible())
 			continue;
 
-		FVector WorldMin, WorldMax;
-		Prim.Primitive->GetWorldAABB(WorldMin, WorldMax);
-		Prim.Bounds = FAABB(WorldMin, WorldMax);
-		Prim.Center = (WorldMin + WorldMax) * 0.5f;
+		Prim.Bounds = Prim.Primitive->GetWorldBounds();
+		Prim.Center = Prim.Bounds.GetCenter();
 		Prim.WorldToModel = Prim.Primitive->GetWorldTransformMatrixInverse();
 		Prim.PrimitiveType = Prim.Primitive->GetPrimitiveType();
 		Prim.StaticMesh = nullptr;
@@ -140,257 +68,128 @@ void UBVHManager::Refit()
 				Prim.StaticMesh = StaticMeshComponent->GetStaticMesh();
 			}
 		}
+
+		Boxes[i] = Prim.Bounds;
 	}
 
-	// Step 2: Recompute node bounds bottom-up
-	RefitRecursive(RootIndex);
+	// Step 3: Recompute node bounds bottom-up
+	Tree.Refit(Boxes);
+	++Version;
 }
 
-
-FAABB UBVHManager::RefitRecursive(int NodeIndex)
+bool UBVHManager::Raycast(const FRay& InRay, UPrimitiveComponent*& HitComponent, float& HitT) const
 {
-	FBVHNode& Node = Nodes[NodeIndex];
+	HitComponent = nullptr;
+	HitT = FLT_MAX;
 
-	if (Node.bIsLeaf)
+	const int HitIndex = Tree.Raycast(InRay, HitT, [&](uint32 InIndex, float& InOutClosestHit)
 	{
-		FAABB Bounds(
-			FVector(+FLT_MAX, +FLT_MAX, +FLT_MAX),
-			FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX)
-		);
+		return RaycastPrimitive(InRay, Primitives[InIndex], InOutClosestHit);
+	});
 
-		for (int i = 0; i < Node.Count; i++)
-		{
-			int primIndex = Node.Start + i;
-			Bounds = Bounds.Union(Bounds, Primitives[primIndex].Bounds);
-		}
+	if (HitIndex == -1)
+	{
+		return false;
+	}
 
-		Node.Bounds = Bounds;
-		return Bounds;
+	HitComponent = Primitives[HitIndex].Primitive;
+	return true;
+}
+
+bool UBVHManager::RaycastPrimitive(const FRay& InRay, const FBVHPrimitive& InPrimitive, float& InOutClosestHit) const
+{
+	if (!InPrimitive.Primitive || !InPrimitive.Primitive->IsVisible())
+	{
+		return false;
+	}
+
+	float CandidateDistance = InOutClosestHit;
+	bool bHitPrimitive = false;
+
+	if (InPrimitive.PrimitiveType == EPrimitiveType::StaticMesh && InPrimitive.StaticMesh)
+	{
+		FRay ModelRay;
+		ModelRay.Origin = InRay.Origin * InPrimitive.WorldToModel;
+		ModelRay.Direction = InRay.Direction * InPrimitive.WorldToModel;
+		ModelRay.Direction.Normalize();
+
+		bHitPrimitive = InPrimitive.StaticMesh->RaycastTriangleBVH(ModelRay, CandidateDistance);
 	}
 	else
 	{
-		FAABB LeftBounds = RefitRecursive(Node.LeftChild);
-		FAABB RightBounds = RefitRecursive(Node.RightChild);
+		bHitPrimitive = ObjectPicker.DoesRayIntersectPrimitive_MollerTrumbore(InRay, InPrimitive.Primitive, &CandidateDistance);
+	}
 
-		Node.Bounds = Node.Bounds.Union(LeftBounds, RightBounds);
-		return Node.Bounds;
+	if (bHitPrimitive && CandidateDistance < InOutClosestHit)
+	{
+		InOutClosestHit = CandidateDistance;
+		return true;
 	}
+
+	return false;
 }
 
-bool UBVHManager::Raycast(const FRay& InRay, UPrimitiveComponent*& HitComponent, float& HitT) const
+bool UBVHManager::RaycastPrimitiveForVisibility(uint32 InIndex, const FRay& InRay, float& InOutClosestHit) const
 {
-    HitComponent = nullptr;
+	const FBVHPrimitive& Prim = Primitives[InIndex];
+	if (!Prim.Primitive || !Prim.Primitive->IsVisible())
+	{
+		return false;
+	}
 
-    if (RootIndex < 0 || Nodes.empty())
-    {
-        return false;
-    }
+	FRay ModelRay;
+	ModelRay.Origin = InRay.Origin * Prim.WorldToModel;
+	ModelRay.Direction = InRay.Direction * Prim.WorldToModel;
 
-    HitT = FLT_MAX;
-    int HitObjectIndex = -1;
+	if (Prim.PrimitiveType == EPrimitiveType::StaticMesh && Prim.StaticMesh)
+	{
+		return Prim.StaticMesh->RaycastTriangleBVH(ModelRay, InOutClosestHit);
+	}
 
-    RaycastIterative(InRay, HitT, HitObjectIndex);
-    if (HitObjectIndex == -1)
-    {
-        return false;
-    }
+	const TArray<FMeshPosition>* Positions = Prim.Primitive->GetPositionsData();
+	const TArray<uint32>* Indices = Prim.Primitive->GetIndicesData();
+	if (!Positions || Positions->empty())
+	{
+		return false;
+	}
 
-    HitComponent = Primitives[HitObjectIndex].Primitive;
-    return true;
-}
+	const bool bHasIndices = Indices && !Indices->empty();
+	const size_t NumCorners = bHasIndices ? Indices->size() : Positions->size();
 
-void UBVHManager::RaycastRecursive(int NodeIndex, const FRay& InRay, float& OutClosestHit, int& OutHitObject) const
-{
-    const FBVHNode& Node = Nodes[NodeIndex];
-
-    float tmin = 0.0f;
-    if (!Node.Bounds.RaycastHit(InRay, &tmin) || tmin > OutClosestHit)
-    {
-        return;
-    }
-
-    if (Node.bIsLeaf)
-    {
-        for (int i = 0; i < Node.Count; ++i)
-        {
-            const FBVHPrimitive& Prim = Primitives[Node.Start + i];
-            if (!Prim.Primitive || !Prim.Primitive->IsVisible())
-            {
-                continue;
-            }
-
-            float boxT = 0.0f;
-            if (!Prim.Bounds.RaycastHit(InRay, &boxT) || boxT > OutClosestHit)
-            {
-                continue;
-            }
-
-            float candidateDistance = OutClosestHit;
-            bool bHitPrimitive = false;
-
-            if (Prim.PrimitiveType == EPrimitiveType::StaticMesh && Prim.StaticMesh)
-            {
-                FRay ModelRay;
-                ModelRay.Origin = InRay.Origin * Prim.WorldToModel;
-                ModelRay.Direction = InRay.Direction * Prim.WorldToModel;
-                ModelRay.Direction.Normalize();
-
-                bHitPrimitive = Prim.StaticMesh->RaycastTriangleBVH(ModelRay, candidateDistance);
-            }
-            else
-            {
-                bHitPrimitive = ObjectPicker.DoesRayIntersectPrimitive_MollerTrumbore(InRay, Prim.Primitive, &candidateDistance);
-            }
-
-            if (bHitPrimitive && candidateDistance < OutClosestHit)
-            {
-                OutClosestHit = candidateDistance;
-                OutHitObject = Node.Start + i;
-                break;
-            }
-        }
-    }
-    else
-    {
-        RaycastRecursive(Node.LeftChild, InRay, OutClosestHit, OutHitObject);
-        RaycastRecursive(Node.RightChild, InRay, OutClosestHit, OutHitObject);
-    }
-}
+	bool bHit = false;
+	for (size_t Corner = 0; Corner + 2 < NumCorners; Corner += 3)
+	{
+		const FVector V0 = (*Positions)[bHasIndices ? (*Indices)[Corner] : Corner].ToVector();
+		const FVector V1 = (*Positions)[bHasIndices ? (*Indices)[Corner + 1] : Corner + 1].ToVector();
+		const FVector V2 = (*Positions)[bHasIndices ? (*Indices)[Corner + 2] : Corner + 2].ToVector();
 
-void UBVHManager::RaycastIterative(const FRay& InRay, float& OutClosestHit, int& OutHitObject) const
-{
-    struct FStackEntry
-    {
-        int NodeIndex;
-        float Distance;
-    };
-
-    FStackEntry stack[64];
-    int stackPtr = 0;
-    const int stackCapacity = static_cast<int>(sizeof(stack) / sizeof(stack[0]));
-
-    auto Push = [&](int node, float distance)
-    {
-        if (stackPtr < stackCapacity)
-        {
-            stack[stackPtr++] = { node, distance };
-        }
-    };
-
-    Push(RootIndex, 0.0f);
-
-    while (stackPtr > 0)
-    {
-        const FStackEntry entry = stack[--stackPtr];
-        const int nodeIndex = entry.NodeIndex;
-
-        if (nodeIndex < 0 || nodeIndex >= static_cast<int>(Nodes.size()))
-        {
-            continue;
-        }
-
-        const FBVHNode& Node = Nodes[nodeIndex];
-
-        float tmin = 0.0f;
-        if (!Node.Bounds.RaycastHit(InRay, &tmin) || tmin > OutClosestHit)
-        {
-            continue;
-        }
-
-        if (Node.bIsLeaf)
-        {
-            for (int i = 0; i < Node.Count; ++i)
-            {
-                const FBVHPrimitive& Prim = Primitives[Node.Start + i];
-                if (!Prim.Primitive || !Prim.Primitive->IsVisible())
-                {
-                    continue;
-                }
-
-                float boxT = 0.0f;
-                if (!Prim.Bounds.RaycastHit(InRay, &boxT) || boxT > OutClosestHit)
-                {
-                    continue;
-                }
-
-                float candidateDistance = OutClosestHit;
-                bool bHitPrimitive = false;
-
-                if (Prim.PrimitiveType == EPrimitiveType::StaticMesh && Prim.StaticMesh)
-                {
-                    FRay ModelRay;
-                    ModelRay.Origin = InRay.Origin * Prim.WorldToModel;
-                    ModelRay.Direction = InRay.Direction * Prim.WorldToModel;
-                    ModelRay.Direction.Normalize();
-
-                    bHitPrimitive = Prim.StaticMesh->RaycastTriangleBVH(ModelRay, candidateDistance);
-                }
-                else
-                {
-                    bHitPrimitive = ObjectPicker.DoesRayIntersectPrimitive_MollerTrumbore(InRay, Prim.Primitive, &candidateDistance);
-                }
-
-                if (bHitPrimitive && candidateDistance < OutClosestHit)
-                {
-                    OutClosestHit = candidateDistance;
-                    OutHitObject = Node.Start + i;
-                    break;
-                }
-            }
-        }
-        else
-        {
-            const int leftChild = Node.LeftChild;
-            const int rightChild = Node.RightChild;
-
-            float leftDistance = 0.0f;
-            const bool hitLeft = (leftChild != -1) && Nodes[leftChild].Bounds.RaycastHit(InRay, &leftDistance) && leftDistance <= OutClosestHit;
-
-            float rightDistance = 0.0f;
-            const bool hitRight = (rightChild != -1) && Nodes[rightChild].Bounds.RaycastHit(InRay, &rightDistance) && rightDistance <= OutClosestHit;
-
-            if (hitLeft && hitRight)
-            {
-                if (leftDistance < rightDistance)
-                {
-                    Push(rightChild, rightDistance);
-                    Push(leftChild, leftDistance);
-                }
-                else
-                {
-                    Push(leftChild, leftDistance);
-                    Push(rightChild, rightDistance);
-                }
-            }
-            else if (hitLeft)
-            {
-                Push(leftChild, leftDistance);
-            }
-            else if (hitRight)
-            {
-                Push(rightChild, rightDistance);
-            }
-        }
-    }
+		float Distance;
+		if (RayHitTriangle_MT(ModelRay, V0, V1 - V0, V2 - V0, InOutClosestHit, Distance))
+		{
+			InOutClosestHit = Distance;
+			bHit = true;
+		}
+	}
+	return bHit;
 }
+
 void UBVHManager::ConvertComponentsToBVHPrimitives(
 	const TArray<TObjectPtr<UPrimitiveComponent>>& InComponents, TArray<FBVHPrimitive>& OutPrimitives)
 {
 	OutPrimitives.clear();
 	OutPrimitives.reserve(InComponents.size());
 
+	UTransformManager::GetInstance().Update();
+
 	for (UPrimitiveComponent* Component : InComponents)
 	{
 		if (!Component || !Component->IsVisible())
 		{
 			continue;
 		}
-		FVector WorldMin, WorldMax;
-		Component->GetWorldAABB(WorldMin, WorldMax);
-
 		FBVHPrimitive Primitive;
-		Primitive.Bounds = FAABB(WorldMin, WorldMax);
-		Primitive.Center = (WorldMin + WorldMax) * 0.5f;
+		Primitive.Bounds = Component->GetWorldBounds();
+		Primitive.Center = Primitive.Bounds.GetCenter();
 		Primitive.Primitive = Component;
 		Primitive.WorldToModel = Component->GetWorldTransformMatrixInverse();
 		Primitive.PrimitiveType = Component->GetPrimitiveType();
@@ -408,163 +207,81 @@ void UBVHManager::ConvertComponentsToBVHPrimitives(
 	}
 }
 
-void UBVHManager::FrustumCull(FFrustumCull& InFrustum, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents)
+void UBVHManager::FrustumCull(FFrustumCull& InFrustum, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents,
+	const TArray<uint64>* InVisibleMask)
 {
 	OutVisibleComponents.clear();
 
-	// 루트가 음수 == BVH 트리가 없다.
-	if (RootIndex < 0)
+	Tree.FrustumCull(InFrustum, VisibleIndices);
+	for (uint32 Index : VisibleIndices)
 	{
-		return;
-	}
-
-	TraverseForCulling(RootIndex, InFrustum, ToBaseType(EFrustumPlane::All), OutVisibleComponents);
-}
-
-void UBVHManager::CollectNodeBounds(TArray<FAABB>& OutBounds) const
-{
-	OutBounds.clear();
-	OutBounds.reserve(Nodes.size());
-
-	for (const FBVHNode& Node : Nodes)
-	{
-		OutBounds.push_back(Node.Bounds);
+		if (InVisibleMask && !FPotentiallyVisibleSet::IsVisible(*InVisibleMask, Index))
+		{
+			continue;
+		}
+		if (Primitives[Index].Primitive->IsVisible())
+		{
+			OutVisibleComponents.push_back(Primitives[Index].Primitive);
+		}
 	}
 }
 
-void UBVHManager::TraverseForCulling(uint32 NodeIndex, FFrustumCull& InFrustum, uint32 InMask,
-	TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents)
+bool UBVHManager::RetargetPrimitives(const FWorldCloner& InCloner)
 {
-	// 목적: 현재 노드를 검사하고, 그 결과에 따라 자식 노드로 재귀 호출할지 결정한다.
-	// 1. 입력: CurrentNode, Frustum, VisibleList, ParentMask
-	//
-	// 2. [노드 검사]
-	//    CurrentNode의 경계 상자(Bounding Box)와 Frustum을 ParentMask를 이용해 검사한다.
-	//    -> 검사 결과는 'CompletelyOutside', 'CompletelyInside', 'Intersect' 중 하나가 된다.
-	//
-	// 3. [결과에 따른 분기 처리]
-	//
-	//     Case A: 완전히 바깥에 있을 경우
-	//    만약 검사 결과가 'CompletelyOutside' 라면:
-	// 	 -> 이 노드와 그 아래의 모든 자식은 보이지 않으므로, 아무것도 하지 않고 함수를 즉시 종료한다.
-	// (가지치기)
-	//
-	//     Case B: 완전히 안쪽에 있을 경우
-	//    만약 검사 결과가 'CompletelyInside' 라면:
-	// 	 -> 이 노드와 그 아래의 모든 자식은 무조건 보이므로, 더 이상 검사할 필요가 없다.
-	// 	 -> '모든 자손 추가' 헬퍼 함수를 호출하여 이 노드 아래의 모든 오브젝트를 VisibleList에 추가한다.
-	// 	 -> 함수를 종료한다.
-	//
-	//     Case C: 일부만 걸쳐 있을 경우 (Intersect)
-	//    만약 검사 결과가 'Intersect' 라면:
-	// 	 -> 더 깊이 들어가서 자세히 검사해야 한다.
-	// 	 -> 만약 CurrentNode가 '리프 노드' 라면:
-	// 		   재귀의 끝에 도달. 이 리프 노드가 담고 있는 오브젝트들을 VisibleList에 추가한다.
-	// 	 -> 만약 CurrentNode가 '중간 노드' 라면:
-	// 		   (선택적 최적화: 평면 마스크 기법을 여기서 적용하여 자식에게 넘겨줄 ChildMask를 계산한다)
-	// 		   왼쪽 자식에 대해 '노드 순회 함수'를 재귀 호출한다.
-	// 		   오른쪽 자식에 대해 '노드 순회 함수'를 재귀 호출한다.
-
-	/*
-	 *	BVH의 바운딩박스는 worldbox
-	 */
-
-	// 현재 노드의 BB 검사
-	FAABB CurrentBound = Nodes[NodeIndex].Bounds;
-
-	TArray<EFrustumPlane> PlaneMasks = { EFrustumPlane::Left, EFrustumPlane::Right,
-										EFrustumPlane::Bottom, EFrustumPlane::Top,
-										EFrustumPlane::Near, EFrustumPlane::Far};
-
-	TArray<EPlaneIndex> PlaneIndices = { EPlaneIndex::Left, EPlaneIndex::Right,
-										 EPlaneIndex::Bottom, EPlaneIndex::Top,
-										 EPlaneIndex::Near, EPlaneIndex::Far};
-
-
-
-	uint32 ChildMask = 0;
-	EFrustumTestResult OverallResult = EFrustumTestResult::CompletelyInside;
-
-	// Near/Far 평면을 먼저 검사 (더 높은 확률로 culling 가능)
-	static const int PlaneOrder[6] = { 4, 5, 0, 1, 2, 3 }; // Near, Far, Left, Right, Bottom, Top
-
-	// Plane Test
-	for (int idx = 0; idx < 6; idx++)
+	TArray<FBVHPrimitive> RetargetedPrimitives = Primitives;
+	for (FBVHPrimitive& Prim : RetargetedPrimitives)
 	{
-		int i = PlaneOrder[idx];
-		EFrustumPlane CurrentPlaneFlag = static_cast<EFrustumPlane>(1 << i);
-		EPlaneIndex CurrentPlaneIndex = static_cast<EPlaneIndex>(i);
-		if (InMask & ToBaseType(CurrentPlaneFlag))
+		UPrimitiveComponent* Clone = InCloner.FindClone(Prim.Primitive.Get());
+		if (!Clone)
 		{
-			EFrustumTestResult Result = InFrustum.TestAABBWithPlane(CurrentBound, CurrentPlaneIndex);
-			// 완전히 바깥인 경우 return
-			// 더 이상 검사할 필요가 없음
-			if (Result == EFrustumTestResult::CompletelyOutside)
-			{
-				return;
-			}
-			else if (Result == EFrustumTestResult::Intersect)
-			{
-				OverallResult = EFrustumTestResult::Intersect;
-				ChildMask |= ToBaseType(PlaneMasks[static_cast<uint32>(CurrentPlaneIndex)]);
-			}
+			// 복제한 월드가 아닌 다른 레벨의 트리라면 재사용할 수 없다
+			return false;
 		}
+		Prim.Primitive = Clone;
 	}
 
-	// 완전히 안쪽인 경우
-	// 모든 자식의 primitive를 outvisiblecomp에 추가 후 순회 종료
-	if (OverallResult == EFrustumTestResult::CompletelyInside)
-	{
-		AddAllPrimitives(NodeIndex, OutVisibleComponents);
-		return;
-	}
+	StashedTree = Tree;
+	StashedPrimitives = std::move(Primitives);
+	StashedBoxes = Boxes;
+	bHasStashedTree = true;
+
+	Primitives = std::move(RetargetedPrimitives);
+	++Version;
+	return true;
+}
 
-	// 완전히 바깥도 아니고 완전히 안쪽도 아니면 교차
-	// 교차하는 AABB가 Leaf라면 leaf node 내부의 개별 primitive에 대해서 culling test 필요
-	if (Nodes[NodeIndex].bIsLeaf)
+bool UBVHManager::RestoreRetargetedPrimitives()
+{
+	if (!bHasStashedTree)
 	{
-		size_t Count = Nodes[NodeIndex].Start + Nodes[NodeIndex].Count;
-		for (size_t i = Nodes[NodeIndex].Start; i < Count; i++)
-		{
-			FAABB TargetAABB = Primitives[i].Bounds;
-			if (InFrustum.IsInFrustum(TargetAABB) != EFrustumTestResult::CompletelyOutside &&
-				Primitives[i].Primitive->IsVisible())
-			{
-				OutVisibleComponents.push_back(Primitives[i].Primitive);
-			}
-		}
-		return;
+		return false;
 	}
 
-	// leaf가 아니고 교차하는 경우 순회 시작
-	TraverseForCulling(Nodes[NodeIndex].LeftChild, InFrustum, ChildMask, OutVisibleComponents);
-	TraverseForCulling(Nodes[NodeIndex].RightChild, InFrustum, ChildMask, OutVisibleComponents);
+	Tree = std::move(StashedTree);
+	Primitives = std::move(StashedPrimitives);
+	Boxes = std::move(StashedBoxes);
+	DiscardRetargetedPrimitives();
+	++Version;
+	return true;
+}
 
+void UBVHManager::DiscardRetargetedPrimitives()
+{
+	StashedTree.Clear();
+	StashedPrimitives.clear();
+	StashedBoxes.clear();
+	bHasStashedTree = false;
 }
 
-void UBVHManager::AddAllPrimitives(uint32 NodeIndex, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents)
+void UBVHManager::CollectNodeBounds(TArray<FBox>& OutBounds) const
 {
-	if (NodeIndex < 0 || NodeIndex >= Nodes.size())
-	{
-		return;
-	}
+	const TArray<FBVHNode>& Nodes = Tree.GetNodes();
+
+	OutBounds.clear();
+	OutBounds.reserve(Nodes.size());
 
-	FBVHNode CurrentNode = Nodes[NodeIndex];
-	if (CurrentNode.bIsLeaf)
+	for (const FBVHNode& Node : Nodes)
 	{
-		size_t Count = CurrentNode.Start + CurrentNode.Count;
-		for (size_t i = CurrentNode.Start; i < Count; i++)
-		{
-			if (Primitives[i].Primitive->IsVisible())
-			{
-				OutVisibleComponents.push_back(Primitives[i].Primitive);
-			}
-		}
-		return;
+		OutBounds.push_back(Node.Bounds);
 	}
-
-	// completely inside가 중간노드인 경우 leaf노드로 재귀
-	AddAllPrimitives(CurrentNode.LeftChild, OutVisibleComponents);
-	AddAllPrimitives(CurrentNode.RightChild, OutVisibleComponents);
 }
-
@@ -0,0 +1,624 @@
+#include "pch.h"
+#include "Manager/BVH/public/PotentiallyVisibleSet.h"
+
+#include "Core/Public/JobSystem.h"
+#include "Core/Public/ScopeCycleCounter.h"
+#include "Manager/BVH/public/PrimitiveBVH.h"
+#include "Utility/Public/JsonSerializer.h"
+
+DECLARE_CYCLE_STAT("PVS Bake", STAT_PVSBake, Visibility)
+
+namespace
+{
+	enum EPVSRunKind : uint64
+	{
+		Run_Zeros = 0,
+		Run_Ones = 1,
+		Run_Literal = 2,
+	};
+
+	constexpr uint64 ALL_ONES = ~0ull;
+
+	// 목표점을 바운드 안쪽으로 당기는 비율 (꼭짓점이 다른 프리미티브 면에 딱 붙는 경우를 피한다)
+	constexpr float TARGET_INSET = 0.9f;
+
+	/** 셀마다 같은 시작점이 나오도록 셀 인덱스와 시드로 초기화하는 LCG */
+	struct FPVSRandom
+	{
+		uint32 State;
+
+		explicit FPVSRandom(uint32 InSeed) : State(InSeed * 747796405u + 2891336453u) {}
+
+		float GetFloat()
+		{
+			State = State * 1664525u + 1013904223u;
+			return static_cast<float>(State >> 8) * (1.0f / 16777216.0f);
+		}
+	};
+
+	constexpr char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	FString EncodeBase64(const TArray<uint8>& InBytes)
+	{
+		FString Result;
+		Result.reserve((InBytes.size() + 2) / 3 * 4);
+		for (size_t i = 0; i < InBytes.size(); i += 3)
+		{
+			const uint32 B0 = InBytes[i];
+			const uint32 B1 = i + 1 < InBytes.size() ? InBytes[i + 1] : 0;
+			const uint32 B2 = i + 2 < InBytes.size() ? InBytes[i + 2] : 0;
+			const uint32 Triple = (B0 << 16) | (B1 << 8) | B2;
+
+			Result.push_back(BASE64_CHARS[(Triple >> 18) & 63]);
+			Result.push_back(BASE64_CHARS[(Triple >> 12) & 63]);
+			Result.push_back(i + 1 < InBytes.size() ? BASE64_CHARS[(Triple >> 6) & 63] : '=');
+			Result.push_back(i + 2 < InBytes.size() ? BASE64_CHARS[Triple & 63] : '=');
+		}
+		return Result;
+	}
+
+	bool DecodeBase64(const FString& InText, TArray<uint8>& OutBytes)
+	{
+		OutBytes.clear();
+		OutBytes.reserve(InText.size() / 4 * 3);
+
+		uint32 Accumulator = 0;
+		int32 NumBits = 0;
+		for (char Character : InText)
+		{
+			if (Character == '=')
+			{
+				break;
+			}
+
+			const char* Found = strchr(BASE64_CHARS, Character);
+			if (!Found || Character == '\0')
+			{
+				return false;
+			}
+
+			Accumulator = (Accumulator << 6) | static_cast<uint32>(Found - BASE64_CHARS);
+			NumBits += 6;
+			if (NumBits >= 8)
+			{
+				NumBits -= 8;
+				OutBytes.push_back(static_cast<uint8>((Accumulator >> NumBits) & 0xFF));
+			}
+		}
+		return true;
+	}
+
+	template<typename T>
+	void AppendBytes(TArray<uint8>& OutBytes, const TArray<T>& InValues)
+	{
+		const uint32 Count = static_cast<uint32>(InValues.size());
+		const uint8* CountBytes = reinterpret_cast<const uint8*>(&Count);
+		OutBytes.insert(OutBytes.end(), CountBytes, CountBytes + sizeof(Count));
+
+		const uint8* Data = reinterpret_cast<const uint8*>(InValues.data());
+		OutBytes.insert(OutBytes.end(), Data, Data + InValues.size() * sizeof(T));
+	}
+
+	template<typename T>
+	bool ReadBytes(const TArray<uint8>& InBytes, size_t& InOutOffset, TArray<T>& OutValues)
+	{
+		uint32 Count = 0;
+		if (InOutOffset + sizeof(Count) > InBytes.size())
+		{
+			return false;
+		}
+		memcpy(&Count, InBytes.data() + InOutOffset, sizeof(Count));
+		InOutOffset += sizeof(Count);
+
+		if (InOutOffset + static_cast<size_t>(Count) * sizeof(T) > InBytes.size())
+		{
+			return false;
+		}
+		OutValues.resize(Count);
+		memcpy(OutValues.data(), InBytes.data() + InOutOffset, Count * sizeof(T));
+		InOutOffset += Count * sizeof(T);
+		return true;
+	}
+}
+
+FPVSBakeStats FPotentiallyVisibleSet::Bake(const TArray<FBox>& InBounds, const FRaycastFunction& InRaycast, const FPVSBakeSettings& InSettings)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PVSBake);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	Clear();
+
+	FPVSBakeStats Stats;
+	NumPrimitives = static_cast<uint32>(InBounds.size());
+	Stats.NumPrimitives = NumPrimitives;
+	if (NumPrimitives == 0)
+	{
+		return Stats;
+	}
+
+	// 비트 위치는 정렬 순서, 정밀 검사에는 입력 인덱스로 되돌려 넘긴다
+	TArray<uint32> Order;
+	ComputeCanonicalOrder(InBounds, Order);
+	SceneHash = HashCanonicalBounds(InBounds, Order);
+
+	TArray<FBox> SortedBounds;
+	SortedBounds.reserve(NumPrimitives);
+	for (uint32 Index : Order)
+	{
+		SortedBounds.push_back(InBounds[Index]);
+	}
+
+	// 1. 씬 바운드를 넓혀 이동 가능 공간으로 보고 정육면체 셀로 나눈다
+	Region = FBox::Empty();
+	for (const FBox& Bounds : SortedBounds)
+	{
+		Region.Expand(Bounds);
+	}
+
+	const FVector SceneExtent = Region.GetMax() - Region.GetMin();
+	const FVector Margin = SceneExtent * InSettings.RegionMargin;
+	Region = FBox::Make(Region.GetMin() - Margin, Region.GetMax() + Margin);
+
+	const FVector RegionExtent = Region.GetMax() - Region.GetMin();
+	const float LongestAxis = std::max(std::max(RegionExtent.X, RegionExtent.Y), std::max(RegionExtent.Z, 1e-3f));
+	CellSize = LongestAxis / static_cast<float>(std::max(InSettings.MaxCellsPerAxis, 1u));
+
+	uint32 NumCells = 1;
+	for (int Axis = 0; Axis < 3; ++Axis)
+	{
+		const float AxisExtent = Region.Max[Axis] - Region.Min[Axis];
+		CellDims[Axis] = std::max(1u, static_cast<uint32>(std::ceil(AxisExtent / CellSize - 1e-3f)));
+		NumCells *= CellDims[Axis];
+	}
+
+	// 2. 베이크 전용 BVH (입력 순서가 곧 PVS 비트 위치)
+	FPrimitiveBVH BVH;
+	BVH.Build(SortedBounds);
+
+	const uint32 NumWords = (NumPrimitives + 63) / 64;
+	TArray<uint64> CellBits(static_cast<size_t>(NumCells) * NumWords, 0);
+	TArray<uint64> CellRays(NumCells, 0);
+	const uint32 NumCellSamples = std::max(InSettings.NumCellSamples, 1u);
+
+	// 3. 셀마다 독립적으로 레이를 쏜다 (정밀 검사 함수는 읽기 전용이어야 한다)
+	FJobSystem::ParallelFor(NumCells, [&](uint32 InBegin, uint32 InEnd)
+	{
+		TArray<FVector> Samples;
+		Samples.reserve(NumCellSamples);
+
+		for (uint32 Cell = InBegin; Cell < InEnd; ++Cell)
+		{
+			uint64* Bits = CellBits.data() + static_cast<size_t>(Cell) * NumWords;
+			auto MarkVisible = [Bits](uint32 InIndex) { Bits[InIndex >> 6] |= 1ull << (InIndex & 63); };
+
+			const uint32 CellX = Cell % CellDims[0];
+			const uint32 CellY = (Cell / CellDims[0]) % CellDims[1];
+			const uint32 CellZ = Cell / (CellDims[0] * CellDims[1]);
+			const FVector CellMin(Region.Min[0] + CellX * CellSize, Region.Min[1] + CellY * CellSize, Region.Min[2] + CellZ * CellSize);
+			const FBox CellBox = FBox::Make(CellMin, CellMin + FVector(CellSize, CellSize, CellSize));
+
+			// 프리미티브 안에 든 시작점은 자기 면에 막혀 모든 레이가 가려지므로 뺀다
+			auto IsInsidePrimitive = [&](const FVector& InPoint)
+			{
+				for (const FBox& Bounds : SortedBounds)
+				{
+					if (InPoint.X > Bounds.Min[0] && InPoint.X < Bounds.Max[0] &&
+						InPoint.Y > Bounds.Min[1] && InPoint.Y < Bounds.Max[1] &&
+						InPoint.Z > Bounds.Min[2] && InPoint.Z < Bounds.Max[2])
+					{
+						return true;
+					}
+				}
+				return false;
+			};
+
+			FPVSRandom Random(Cell ^ (InSettings.Seed * 2654435761u));
+			Samples.clear();
+			for (uint32 Sample = 0; Sample < NumCellSamples; ++Sample)
+			{
+				const FVector Offset = Sample == 0 ? FVector(0.5f, 0.5f, 0.5f) : FVector(Random.GetFloat(), Random.GetFloat(), Random.GetFloat());
+				const FVector Point = CellMin + Offset * CellSize;
+				if (!IsInsidePrimitive(Point))
+				{
+					Samples.push_back(Point);
+				}
+			}
+
+			// 시작점을 하나도 못 얻은 셀(물체 내부)은 모두 보이는 것으로 남긴다
+			if (Samples.empty())
+			{
+				for (uint32 Target = 0; Target < NumPrimitives; ++Target)
+				{
+					MarkVisible(Target);
+				}
+				continue;
+			}
+
+			uint64 NumRays = 0;
+			for (uint32 Target = 0; Target < NumPrimitives; ++Target)
+			{
+				const FBox& TargetBounds = SortedBounds[Target];
+				if (TargetBounds.Overlaps(CellBox))
+				{
+					MarkVisible(Target);
+					continue;
+				}
+
+				// 목표점: 바운드 중심 + 안쪽으로 당긴 꼭짓점 8개
+				const FVector Center = TargetBounds.GetCenter();
+				const FVector HalfExtent = (TargetBounds.GetMax() - TargetBounds.GetMin()) * (0.5f * TARGET_INSET);
+
+				bool bVisible = false;
+				for (uint32 Point = 0; Point < 9 && !bVisible; ++Point)
+				{
+					const FVector TargetPoint = Point == 0 ? Center : Center + FVector(
+						(Point & 1) ? HalfExtent.X : -HalfExtent.X,
+						(Point & 2) ? HalfExtent.Y : -HalfExtent.Y,
+						((Point - 1) & 4) ? HalfExtent.Z : -HalfExtent.Z);
+
+					for (const FVector& Start : Samples)
+					{
+						FVector Direction = TargetPoint - Start;
+						const float Distance = Direction.Length();
+						if (Distance <= 1e-4f)
+						{
+							bVisible = true;
+							break;
+						}
+						Direction = Direction * (1.0f / Distance);
+
+						FRay Ray = {};
+						Ray.Origin = FVector4(Start.X, Start.Y, Start.Z, 1.0f);
+						Ray.Direction = FVector4(Direction.X, Direction.Y, Direction.Z, 0.0f);
+
+						// 목표점까지 가장 먼저 맞는 프리미티브가 목표 자신이거나 아무것도 없으면 보인다
+						float ClosestHit = Distance;
+						const int HitIndex = BVH.Raycast(Ray, ClosestHit, [&](uint32 InIndex, float& InOutClosestHit)
+						{
+							return InRaycast(Order[InIndex], Ray, InOutClosestHit);
+						});
+						++NumRays;
+
+						if (HitIndex < 0 || static_cast<uint32>(HitIndex) == Target)
+						{
+							bVisible = true;
+							break;
+						}
+					}
+				}
+
+				if (bVisible)
+				{
+					MarkVisible(Target);
+				}
+			}
+			CellRays[Cell] = NumRays;
+		}
+	}, 1);
+
+	// 4. 통계와 압축
+	uint64 NumVisibleBits = 0;
+	for (uint32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		Stats.NumRays += CellRays[Cell];
+		for (uint32 Word = 0; Word < NumWords; ++Word)
+		{
+			NumVisibleBits += __builtin_popcountll(CellBits[static_cast<size_t>(Cell) * NumWords + Word]);
+		}
+	}
+
+	Stats.NumCells = NumCells;
+	Stats.RawBytes = static_cast<uint64>(NumCells) * NumWords * sizeof(uint64);
+	Stats.AverageVisibleRatio = static_cast<float>(static_cast<double>(NumVisibleBits) / (static_cast<double>(NumCells) * NumPrimitives));
+	CompressCells(CellBits, NumWords, Stats);
+	CanonicalToInput = std::move(Order);
+
+	Stats.BakeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	return Stats;
+}
+
+void FPotentiallyVisibleSet::Clear()
+{
+	Region = FBox::Empty();
+	CellSize = 1.0f;
+	CellDims[0] = CellDims[1] = CellDims[2] = 0;
+	NumPrimitives = 0;
+	SceneHash = 0;
+	CellSetIndices.clear();
+	SetOffsets.clear();
+	EncodedWords.clear();
+	CanonicalToInput.clear();
+}
+
+bool FPotentiallyVisibleSet::Bind(const TArray<FBox>& InBounds)
+{
+	CanonicalToInput.clear();
+	if (IsEmpty() || InBounds.size() != NumPrimitives)
+	{
+		return false;
+	}
+
+	TArray<uint32> Order;
+	ComputeCanonicalOrder(InBounds, Order);
+	if (HashCanonicalBounds(InBounds, Order) != SceneHash)
+	{
+		return false;
+	}
+
+	CanonicalToInput = std::move(Order);
+	return true;
+}
+
+/**
+ * @brief 내용이 같은 셀 비트셋을 하나로 합치고 각각을 런 길이로 압축한다
+ */
+void FPotentiallyVisibleSet::CompressCells(const TArray<uint64>& InCellBits, uint32 InNumWords, FPVSBakeStats& OutStats)
+{
+	const uint32 NumCells = static_cast<uint32>(InCellBits.size() / InNumWords);
+	CellSetIndices.resize(NumCells);
+
+	// 해시 -> 같은 해시를 가진 고유 비트셋의 첫 셀들
+	TMap<uint64, TArray<uint32>> SetsByHash;
+	TArray<uint32> SetFirstCells;
+
+	for (uint32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		const uint64* Bits = InCellBits.data() + static_cast<size_t>(Cell) * InNumWords;
+
+		uint64 Hash = 14695981039346656037ull;
+		for (uint32 Word = 0; Word < InNumWords; ++Word)
+		{
+			Hash = (Hash ^ Bits[Word]) * 1099511628211ull;
+		}
+
+		TArray<uint32>& Candidates = SetsByHash[Hash];
+		int32 FoundSet = -1;
+		for (uint32 SetIndex : Candidates)
+		{
+			const uint64* Other = InCellBits.data() + static_cast<size_t>(SetFirstCells[SetIndex]) * InNumWords;
+			if (memcmp(Bits, Other, InNumWords * sizeof(uint64)) == 0)
+			{
+				FoundSet = static_cast<int32>(SetIndex);
+				break;
+			}
+		}
+
+		if (FoundSet < 0)
+		{
+			FoundSet = static_cast<int32>(SetFirstCells.size());
+			Candidates.push_back(static_cast<uint32>(FoundSet));
+			SetFirstCells.push_back(Cell);
+			SetOffsets.push_back(static_cast<uint32>(EncodedWords.size()));
+			EncodeBits(Bits, InNumWords, EncodedWords);
+		}
+		CellSetIndices[Cell] = static_cast<uint32>(FoundSet);
+	}
+
+	OutStats.NumUniqueSets = static_cast<uint32>(SetOffsets.size());
+	OutStats.CompressedBytes = CellSetIndices.size() * sizeof(uint32) + SetOffsets.size() * sizeof(uint32) + EncodedWords.size() * sizeof(uint64);
+}
+
+void FPotentiallyVisibleSet::EncodeBits(const uint64* InWords, uint32 InNumWords, TArray<uint64>& OutEncoded)
+{
+	uint32 Word = 0;
+	while (Word < InNumWords)
+	{
+		const uint64 Value = InWords[Word];
+		if (Value == 0 || Value == ALL_ONES)
+		{
+			uint32 End = Word + 1;
+			while (End < InNumWords && InWords[End] == Value)
+			{
+				++End;
+			}
+			const uint64 Kind = Value == 0 ? Run_Zeros : Run_Ones;
+			OutEncoded.push_back((static_cast<uint64>(End - Word) << 2) | Kind);
+			Word = End;
+		}
+		else
+		{
+			uint32 End = Word + 1;
+			while (End < InNumWords && InWords[End] != 0 && InWords[End] != ALL_ONES)
+			{
+				++End;
+			}
+			OutEncoded.push_back((static_cast<uint64>(End - Word) << 2) | Run_Literal);
+			OutEncoded.insert(OutEncoded.end(), InWords + Word, InWords + End);
+			Word = End;
+		}
+	}
+}
+
+int32 FPotentiallyVisibleSet::FindCell(const FVector& InLocation) const
+{
+	if (IsEmpty())
+	{
+		return -1;
+	}
+
+	const float Location[3] = { InLocation.X, InLocation.Y, InLocation.Z };
+	uint32 Coord[3];
+	for (int Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Offset = (Location[Axis] - Region.Min[Axis]) / CellSize;
+		if (Offset < 0.0f || Offset >= static_cast<float>(CellDims[Axis]))
+		{
+			return -1;
+		}
+		Coord[Axis] = static_cast<uint32>(Offset);
+	}
+
+	return static_cast<int32>(Coord[0] + CellDims[0] * (Coord[1] + CellDims[1] * Coord[2]));
+}
+
+void FPotentiallyVisibleSet::DecodeCell(uint32 InCell, TArray<uint64>& OutBits) const
+{
+	const uint32 NumWords = (NumPrimitives + 63) / 64;
+	OutBits.resize(NumWords);
+
+	const uint64* Token = EncodedWords.data() + SetOffsets[CellSetIndices[InCell]];
+	uint32 Word = 0;
+	while (Word < NumWords)
+	{
+		const uint32 Count = static_cast<uint32>(*Token >> 2);
+		const uint64 Kind = *Token & 3;
+		++Token;
+
+		if (Kind == Run_Literal)
+		{
+			memcpy(OutBits.data() + Word, Token, Count * sizeof(uint64));
+			Token += Count;
+		}
+		else
+		{
+			std::fill(OutBits.begin() + Word, OutBits.begin() + Word + Count, Kind == Run_Ones ? ALL_ONES : 0);
+		}
+		Word += Count;
+	}
+}
+
+const TArray<uint64>* FPotentiallyVisibleSet::FindVisibleBits(const FVector& InLocation, FPVSLookup& InOutLookup) const
+{
+	const int32 Cell = IsBound() ? FindCell(InLocation) : -1;
+	if (Cell < 0)
+	{
+		InOutLookup.Cell = -1;
+		return nullptr;
+	}
+
+	if (Cell != InOutLookup.Cell)
+	{
+		DecodeCell(static_cast<uint32>(Cell), InOutLookup.CanonicalBits);
+
+		// 정렬 순서 비트를 Bind한 배열의 인덱스로 옮긴다
+		InOutLookup.Bits.assign(InOutLookup.CanonicalBits.size(), 0);
+		for (uint32 Canonical = 0; Canonical < NumPrimitives; ++Canonical)
+		{
+			if (IsVisible(InOutLookup.CanonicalBits, Canonical))
+			{
+				const uint32 Index = CanonicalToInput[Canonical];
+				InOutLookup.Bits[Index >> 6] |= 1ull << (Index & 63);
+			}
+		}
+
+		InOutLookup.Cell = Cell;
+		++InOutLookup.NumCellChanges;
+	}
+	return &InOutLookup.Bits;
+}
+
+uint64 FPotentiallyVisibleSet::ComputeSceneHash(const TArray<FBox>& InBounds)
+{
+	TArray<uint32> Order;
+	ComputeCanonicalOrder(InBounds, Order);
+	return HashCanonicalBounds(InBounds, Order);
+}
+
+void FPotentiallyVisibleSet::ComputeCanonicalOrder(const TArray<FBox>& InBounds, TArray<uint32>& OutOrder)
+{
+	TArray<TStaticArray<int64, 6>> Keys(InBounds.size());
+	for (size_t Index = 0; Index < InBounds.size(); ++Index)
+	{
+		for (int Axis = 0; Axis < 3; ++Axis)
+		{
+			Keys[Index][Axis] = std::llround(InBounds[Index].Min[Axis] * 100.0f);
+			Keys[Index][Axis + 3] = std::llround(InBounds[Index].Max[Axis] * 100.0f);
+		}
+	}
+
+	OutOrder.resize(InBounds.size());
+	for (uint32 Index = 0; Index < static_cast<uint32>(OutOrder.size()); ++Index)
+	{
+		OutOrder[Index] = Index;
+	}
+	std::stable_sort(OutOrder.begin(), OutOrder.end(), [&Keys](uint32 InA, uint32 InB)
+	{
+		return Keys[InA] < Keys[InB];
+	});
+}
+
+uint64 FPotentiallyVisibleSet::HashCanonicalBounds(const TArray<FBox>& InBounds, const TArray<uint32>& InOrder)
+{
+	uint64 Hash = 14695981039346656037ull;
+	auto HashValue = [&Hash](int64 InValue)
+	{
+		const uint8* Bytes = reinterpret_cast<const uint8*>(&InValue);
+		for (size_t i = 0; i < sizeof(InValue); ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * 1099511628211ull;
+		}
+	};
+
+	HashValue(static_cast<int64>(InBounds.size()));
+	for (uint32 Index : InOrder)
+	{
+		const FBox& Bounds = InBounds[Index];
+		for (int Axis = 0; Axis < 3; ++Axis)
+		{
+			HashValue(std::llround(Bounds.Min[Axis] * 100.0f));
+			HashValue(std::llround(Bounds.Max[Axis] * 100.0f));
+		}
+	}
+	return Hash;
+}
+
+void FPotentiallyVisibleSet::Serialize(bool bInIsLoading, JSON& InOutHandle)
+{
+	if (bInIsLoading)
+	{
+		Clear();
+
+		FVector RegionMin;
+		FVector RegionMax;
+		FVector Dims;
+		FString HashString;
+		FString DataString;
+		if (!FJsonSerializer::ReadVector(InOutHandle, "RegionMin", RegionMin) ||
+			!FJsonSerializer::ReadVector(InOutHandle, "RegionMax", RegionMax) ||
+			!FJsonSerializer::ReadVector(InOutHandle, "CellDims", Dims) ||
+			!FJsonSerializer::ReadFloat(InOutHandle, "CellSize", CellSize, 1.0f) ||
+			!FJsonSerializer::ReadUint32(InOutHandle, "NumPrimitives", NumPrimitives) ||
+			!FJsonSerializer::ReadString(InOutHandle, "SceneHash", HashString) ||
+			!FJsonSerializer::ReadString(InOutHandle, "Data", DataString))
+		{
+			Clear();
+			return;
+		}
+
+		Region = FBox::Make(RegionMin, RegionMax);
+		CellDims[0] = static_cast<uint32>(Dims.X);
+		CellDims[1] = static_cast<uint32>(Dims.Y);
+		CellDims[2] = static_cast<uint32>(Dims.Z);
+		SceneHash = std::strtoull(HashString.c_str(), nullptr, 16);
+
+		TArray<uint8> Bytes;
+		size_t Offset = 0;
+		if (!DecodeBase64(DataString, Bytes) ||
+			!ReadBytes(Bytes, Offset, CellSetIndices) ||
+			!ReadBytes(Bytes, Offset, SetOffsets) ||
+			!ReadBytes(Bytes, Offset, EncodedWords) ||
+			CellSetIndices.size() != static_cast<size_t>(CellDims[0]) * CellDims[1] * CellDims[2])
+		{
+			UE_LOG_ERROR("PVS: 저장된 데이터가 손상되어 무시합니다");
+			Clear();
+		}
+	}
+	else
+	{
+		char HashString[17];
+		snprintf(HashString, sizeof(HashString), "%016llx", static_cast<unsigned long long>(SceneHash));
+
+		TArray<uint8> Bytes;
+		AppendBytes(Bytes, CellSetIndices);
+		AppendBytes(Bytes, SetOffsets);
+		AppendBytes(Bytes, EncodedWords);
+
+		InOutHandle["RegionMin"] = FJsonSerializer::VectorToJson(Region.GetMin());
+		InOutHandle["RegionMax"] = FJsonSerializer::VectorToJson(Region.GetMax());
+		InOutHandle["CellDims"] = FJsonSerializer::VectorToJson(FVector(static_cast<float>(CellDims[0]), static_cast<float>(CellDims[1]), static_cast<float>(CellDims[2])));
+		InOutHandle["CellSize"] = CellSize;
+		InOutHandle["NumPrimitives"] = static_cast<int>(NumPrimitives);
+		InOutHandle["SceneHash"] = FString(HashString);
+		InOutHandle["Data"] = EncodeBase64(Bytes);
+	}
+}
@@ -0,0 +1,226 @@
+#include "pch.h"
+#include "Manager/BVH/public/PrimitiveBVH.h"
+
+#include "Editor/Public/FrustumCull.h"
+
+void FPrimitiveBVH::Clear()
+{
+	Nodes.clear();
+	ItemBounds.clear();
+	ItemIndices.clear();
+	RootIndex = -1;
+}
+
+void FPrimitiveBVH::Build(const TArray<FBox>& InBounds, int MaxLeafSize)
+{
+	Clear();
+
+	if (InBounds.empty())
+	{
+		return;
+	}
+
+	TArray<FBuildItem> Items;
+	Items.reserve(InBounds.size());
+	for (size_t i = 0; i < InBounds.size(); ++i)
+	{
+		Items.push_back({ InBounds[i], InBounds[i].GetCenter(), static_cast<uint32>(i) });
+	}
+
+	// 이진 트리의 노드 수는 최대 2N - 1
+	Nodes.reserve(Items.size() * 2);
+	RootIndex = BuildRecursive(Items, 0, static_cast<int>(Items.size()), MaxLeafSize);
+
+	ItemBounds.resize(Items.size());
+	ItemIndices.resize(Items.size());
+	for (size_t i = 0; i < Items.size(); ++i)
+	{
+		ItemBounds[i] = Items[i].Bounds;
+		ItemIndices[i] = Items[i].Index;
+	}
+}
+
+int FPrimitiveBVH::BuildRecursive(TArray<FBuildItem>& InItems, int Start, int Count, int MaxLeafSize)
+{
+	FBVHNode Node;
+
+	// 1. Compute bounds for this node
+	FBox Bounds = FBox::Empty();
+	for (int i = 0; i < Count; i++)
+	{
+		Bounds.Expand(InItems[Start + i].Bounds);
+	}
+	Node.Bounds = Bounds;
+
+	// 2. Leaf condition
+	if (Count <= MaxLeafSize)
+	{
+		Node.bIsLeaf = true;
+		Node.Start = Start;
+		Node.Count = Count;
+
+		int NodeIndex = static_cast<int>(Nodes.size());
+		Nodes.push_back(Node);
+		return NodeIndex;
+	}
+
+	// 3. Choose split axis (largest variance of centers)
+	FVector Mean(0, 0, 0);
+	for (int i = 0; i < Count; i++)
+	{
+		Mean += InItems[Start + i].Center;
+	}
+	Mean /= (float)Count;
+
+	__m128 Var = _mm_setzero_ps();
+	const __m128 MeanV = _mm_setr_ps(Mean.X, Mean.Y, Mean.Z, 0.0f);
+	for (int i = 0; i < Count; i++)
+	{
+		const FVector& Center = InItems[Start + i].Center;
+		const __m128 D = _mm_sub_ps(_mm_setr_ps(Center.X, Center.Y, Center.Z, 0.0f), MeanV);
+		Var = _mm_add_ps(Var, _mm_mul_ps(D, D));
+	}
+
+	alignas(16) float Tmp[4];
+	_mm_store_ps(Tmp, Var);
+
+	int Axis = 0;
+	if (Tmp[1] > Tmp[0]) Axis = 1;
+	if (Tmp[2] > Tmp[Axis]) Axis = 2;
+
+	int Mid = Start + Count / 2;
+	// 4. Sort items along chosen axis
+	std::nth_element(
+		InItems.begin() + Start,
+		InItems.begin() + Mid,
+		InItems.begin() + Start + Count,
+		[Axis](const FBuildItem& A, const FBuildItem& B)
+		{
+			return A.Center[Axis] < B.Center[Axis];
+		});
+
+	// 5. Recurse children
+	int LeftIndex = BuildRecursive(InItems, Start, Mid - Start, MaxLeafSize);
+	int RightIndex = BuildRecursive(InItems, Mid, Count - (Mid - Start), MaxLeafSize);
+
+	Node.LeftChild = LeftIndex;
+	Node.RightChild = RightIndex;
+
+	int NodeIndex = static_cast<int>(Nodes.size());
+	Nodes.push_back(Node);
+	return NodeIndex;
+}
+
+void FPrimitiveBVH::Refit(const TArray<FBox>& InBounds)
+{
+	if (RootIndex < 0 || InBounds.size() != ItemIndices.size())
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < ItemIndices.size(); ++i)
+	{
+		ItemBounds[i] = InBounds[ItemIndices[i]];
+	}
+
+	// 자식이 부모보다 먼저 push되므로 (후위 순서) 앞에서부터 한 번 훑으면 바닥부터 갱신된다
+	for (FBVHNode& Node : Nodes)
+	{
+		if (Node.bIsLeaf)
+		{
+			FBox Bounds = FBox::Empty();
+			for (int i = 0; i < Node.Count; i++)
+			{
+				Bounds.Expand(ItemBounds[Node.Start + i]);
+			}
+			Node.Bounds = Bounds;
+		}
+		else
+		{
+			Node.Bounds = FBox::Union(Nodes[Node.LeftChild].Bounds, Nodes[Node.RightChild].Bounds);
+		}
+	}
+}
+
+void FPrimitiveBVH::FrustumCull(FFrustumCull& InFrustum, TArray<uint32>& OutIndices) const
+{
+	OutIndices.clear();
+
+	// 루트가 음수 == BVH 트리가 없다.
+	if (RootIndex < 0)
+	{
+		return;
+	}
+
+	TraverseForCulling(RootIndex, InFrustum, ToBaseType(EFrustumPlane::All), OutIndices);
+}
+
+void FPrimitiveBVH::TraverseForCulling(uint32 NodeIndex, FFrustumCull& InFrustum, uint32 InMask, TArray<uint32>& OutIndices) const
+{
+	const FBVHNode& Node = Nodes[NodeIndex];
+
+	uint32 ChildMask = 0;
+	EFrustumTestResult OverallResult = EFrustumTestResult::CompletelyInside;
+
+	// Near/Far 평면을 먼저 검사 (더 높은 확률로 culling 가능)
+	static const int PlaneOrder[6] = { 4, 5, 0, 1, 2, 3 }; // Near, Far, Left, Right, Bottom, Top
+
+	// 부모가 완전히 통과한 평면은 InMask에서 빠져 있으므로 다시 검사하지 않는다
+	for (int Order = 0; Order < 6; Order++)
+	{
+		const int i = PlaneOrder[Order];
+		const uint32 PlaneFlag = 1u << i;
+		if (!(InMask & PlaneFlag))
+		{
+			continue;
+		}
+
+		EFrustumTestResult Result = InFrustum.TestAABBWithPlane(Node.Bounds, static_cast<EPlaneIndex>(i));
+		if (Result == EFrustumTestResult::CompletelyOutside)
+		{
+			return;
+		}
+		if (Result == EFrustumTestResult::Intersect)
+		{
+			OverallResult = EFrustumTestResult::Intersect;
+			ChildMask |= PlaneFlag;
+		}
+	}
+
+	// 완전히 안쪽이면 자손 전체를 검사 없이 추가
+	if (OverallResult == EFrustumTestResult::CompletelyInside)
+	{
+		AddAllItems(NodeIndex, OutIndices);
+		return;
+	}
+
+	// 교차하는 리프는 항목마다 개별 검사
+	if (Node.bIsLeaf)
+	{
+		const int End = Node.Start + Node.Count;
+		for (int i = Node.Start; i < End; i++)
+		{
+			if (InFrustum.IsInFrustum(ItemBounds[i]) == EFrustumTestResult::Inside)
+			{
+				OutIndices.push_back(ItemIndices[i]);
+			}
+		}
+		return;
+	}
+
+	TraverseForCulling(Node.LeftChild, InFrustum, ChildMask, OutIndices);
+	TraverseForCulling(Node.RightChild, InFrustum, ChildMask, OutIndices);
+}
+
+void FPrimitiveBVH::AddAllItems(uint32 NodeIndex, TArray<uint32>& OutIndices) const
+{
+	const FBVHNode& Node = Nodes[NodeIndex];
+	if (Node.bIsLeaf)
+	{
+		OutIndices.insert(OutIndices.end(), ItemIndices.begin() + Node.Start, ItemIndices.begin() + Node.Start + Node.Count);
+		return;
+	}
+
+	AddAllItems(Node.LeftChild, OutIndices);
+	AddAllItems(Node.RightChild, OutIndices);
+}
@@ -5,23 +5,14 @@
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/BatchLines.h"
 #include "Editor/Public/ObjectPicker.h"
-#include "Physics/Public/AABB.h"
+#include "Physics/Public/Box.h"
+#include "Manager/BVH/public/PrimitiveBVH.h"
 
 class UStaticMesh;
-struct FBVHNode
-{
-	FAABB Bounds;
-	int LeftChild = -1;
-	int RightChild = -1;
-	int Start = 0;   // leaf start index
-	int Count = 0;   // leaf count
-	bool bIsLeaf = false;
-
-	uint32 FrustumMask = 0;
-};
+class FWorldCloner;
 
 struct TriBVHNode {
-	FAABB Bounds;
+	FBox Bounds;
 	int LeftChild;    // -1 if leaf
 	int RightChild;   // -1 if leaf
 	int Start;        // index into triangle array
@@ -32,7 +23,7 @@ struct TriBVHNode {
 struct FBVHPrimitive
 {
 	FVector Center;
-	FAABB Bounds;
+	FBox Bounds;
 	TObjectPtr<UPrimitiveComponent> Primitive;
 	FMatrix WorldToModel;
 	EPrimitiveType PrimitiveType = EPrimitiveType::Cube;
@@ -55,28 +46,51 @@ public:
 	void Refit();
 	bool IsDebugDrawEnabled() const { return bDebugDrawEnabled; }
 	void ConvertComponentsToBVHPrimitives(const TArray<TObjectPtr<UPrimitiveComponent>>& InComponents, TArray<FBVHPrimitive>& OutPrimitives);
-	[[nodiscard]] const TArray<FBVHNode>& GetNodes() const { return Nodes; }
-	void FrustumCull(FFrustumCull& InFrustum, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents);
+	[[nodiscard]] const TArray<FBVHNode>& GetNodes() const { return Tree.GetNodes(); }
+	/** @param InVisibleMask 비어 있지 않으면 비트가 꺼진 프리미티브(BVH 인덱스 기준)는 프러스텀 검사 결과와 관계없이 뺀다 (PVS) */
+	void FrustumCull(FFrustumCull& InFrustum, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents,
+		const TArray<uint64>* InVisibleMask = nullptr);
+
+	TArray<FBox>& GetBoxes() { return Boxes; }
 
-	TArray<FAABB>& GetBoxes() { return Boxes; }
+	/** Build/Refit/Retarget로 프리미티브 배열이나 바운드가 바뀔 때마다 증가한다 (PVS를 다시 맞춰 볼 시점) */
+	uint64 GetVersion() const { return Version; }
+
+	/**
+	 * @brief PVS 베이크용 정밀 검사, 모델 레이 방향을 정규화하지 않아 거리가 월드 단위로 남는다
+	 * 읽기 전용이므로 베이크 작업 스레드에서 동시에 불러도 된다
+	 */
+	bool RaycastPrimitiveForVisibility(uint32 InIndex, const FRay& InRay, float& InOutClosestHit) const;
+
+	/**
+	 * @brief 현재 트리를 보관해 두고 프리미티브만 복제본으로 바꿔 같은 트리를 그대로 쓴다 (PIE 진입)
+	 * 복제 월드의 바운드는 원본과 같으므로 다시 빌드할 필요가 없다, 복제본이 없는 프리미티브가 있으면 아무것도 바꾸지 않고 false
+	 */
+	bool RetargetPrimitives(const FWorldCloner& InCloner);
+	/** @brief RetargetPrimitives로 보관한 트리로 되돌린다 (PIE 종료), 보관한 트리가 없으면 false */
+	bool RestoreRetargetedPrimitives();
+	void DiscardRetargetedPrimitives();
 
 private:
-	int BuildRecursive(int Start, int Count, int MaxLeafSize);
-	FAABB RefitRecursive(int NodeIndex);
-	// void QueryRecursive(int nodeIdx, const Frustum& frustum, TArray<int>& outVisible) const;
-	void RaycastIterative(const FRay& InRay, float& OutClosestHit, int& OutHitObject) const;
-	void RaycastRecursive(int NodeIndex, const FRay& InRay, float& OutClosestHit, int& OutHitObject) const;
-	void CollectNodeBounds(TArray<FAABB>& OutBounds) const;
-	void TraverseForCulling(uint32 NodeIndex, FFrustumCull& InFrustum, uint32 InMask, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents);
-	void AddAllPrimitives(uint32 NodeIndex, TArray<TObjectPtr<UPrimitiveComponent>>& OutVisibleComponents);
+	bool RaycastPrimitive(const FRay& InRay, const FBVHPrimitive& InPrimitive, float& InOutClosestHit) const;
+	void CollectNodeBounds(TArray<FBox>& OutBounds) const;
 
 	UObjectPicker ObjectPicker;
 
-	TArray<FBVHNode> Nodes;
+	// 공간 분할은 FPrimitiveBVH가 맡고, 여기서는 컴포넌트 정보와 정밀 검사만 다룬다
+	FPrimitiveBVH Tree;
 	TArray<FBVHPrimitive> Primitives;
-	int RootIndex = -1;
 	bool bDebugDrawEnabled = true;
 
-	TArray<FAABB> Boxes;
+	// Primitives와 같은 순서의 월드 바운드 (Build/Refit 입력)
+	TArray<FBox> Boxes;
+	TArray<uint32> VisibleIndices;
+	uint64 Version = 0;
+
+	// RetargetPrimitives 이전의 트리 (PIE 동안 에디터 레벨의 트리를 보관)
+	FPrimitiveBVH StashedTree;
+	TArray<FBVHPrimitive> StashedPrimitives;
+	TArray<FBox> StashedBoxes;
+	bool bHasStashedTree = false;
 };
 
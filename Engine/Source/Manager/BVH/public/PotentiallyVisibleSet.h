@@ -0,0 +1,136 @@
+#pragma once
+#include "Physics/Public/Box.h"
+
+#include <functional>
+
+namespace json
+{
+	class JSON;
+}
+
+/**
+ * @brief PVS 베이크 설정
+ */
+struct FPVSBakeSettings
+{
+	// 이동 가능 공간(씬 바운드)을 긴 축 기준으로 나누는 셀 수, 나머지 축은 같은 셀 크기로 나눈다
+	uint32 MaxCellsPerAxis = 8;
+	// 씬 바운드를 각 축 크기의 이 비율만큼 넓혀 바깥 가장자리의 카메라도 셀에 들어가게 한다
+	float RegionMargin = 0.1f;
+	// 셀 안에서 레이를 쏘는 시작점 수 (셀 중심 + 나머지는 무작위)
+	uint32 NumCellSamples = 4;
+	uint32 Seed = 1;
+};
+
+struct FPVSBakeStats
+{
+	uint32 NumCells = 0;
+	uint32 NumPrimitives = 0;
+	uint32 NumUniqueSets = 0;
+	uint64 NumRays = 0;
+	// 셀마다 비트셋을 그대로 저장했을 때와 압축 후 크기
+	uint64 RawBytes = 0;
+	uint64 CompressedBytes = 0;
+	// 셀 PVS에 든 프리미티브 비율의 평균 (1이면 아무것도 걸러내지 못함)
+	float AverageVisibleRatio = 0.0f;
+	double BakeMs = 0.0;
+};
+
+/**
+ * @brief 카메라 셀이 바뀔 때만 비트셋을 풀기 위한 조회 캐시
+ */
+struct FPVSLookup
+{
+	int32 Cell = -1;
+	// 호출자 인덱스 순서로 바꾼 비트셋
+	TArray<uint64> Bits;
+	TArray<uint64> CanonicalBits;
+	uint64 NumCellChanges = 0;
+};
+
+/**
+ * @brief 정적 레벨의 셀 -> 프리미티브 가시성 표 (Potentially Visible Set)
+ *
+ * 이동 가능 공간을 균일 격자로 나누고, 셀 안 시작점에서 각 프리미티브 바운드 위 목표점으로 레이를 쏴
+ * 다른 프리미티브에 먼저 막히지 않는 레이가 하나라도 있으면 그 셀에서 보인다고 기록한다
+ * 셀과 겹치는 프리미티브나 목표점까지 아무것도 맞지 않은 레이는 보이는 쪽으로 처리해 보수적으로 남긴다
+ *
+ * 셀 비트셋은 같은 내용끼리 하나로 합친 뒤 64비트 워드 단위 런 길이(0 / 1 / 그대로)로 압축해 보관한다
+ * 비트 순서는 바운드로 정렬한 순서라 저장/불러오기로 액터 순서가 바뀌어도 같은 배치면 그대로 쓸 수 있고,
+ * Bind로 지금 프리미티브 배열과 맞춰 본 뒤(씬 해시 비교) 조회 결과를 그 배열의 인덱스로 돌려준다
+ * D3D에 의존하지 않으므로 헤드리스 러너에서도 베이크/조회할 수 있다
+ */
+class FPotentiallyVisibleSet
+{
+public:
+	/**
+	 * @brief 프리미티브 하나의 정밀 레이 검사 (월드 레이, 방향은 정규화되어 있다)
+	 * InOutClosestHit보다 가까이 맞으면 거리를 줄이고 true, 여러 스레드에서 동시에 불린다
+	 */
+	using FRaycastFunction = std::function<bool(uint32 InIndex, const FRay& InRay, float& InOutClosestHit)>;
+
+	/**
+	 * @param InBounds 프리미티브 월드 바운드, 베이크가 끝나면 이 배열에 Bind된 상태가 된다
+	 * @param InRaycast 가림 판정에 쓰는 정밀 검사 (인덱스는 InBounds 기준), 바운드만으로 막으면 보수적이지 않으므로 메쉬 단위로 검사해야 한다
+	 */
+	FPVSBakeStats Bake(const TArray<FBox>& InBounds, const FRaycastFunction& InRaycast, const FPVSBakeSettings& InSettings);
+	void Clear();
+
+	/**
+	 * @brief 저장된 PVS를 지금 프리미티브 바운드 배열에 맞춘다
+	 * @return 배치가 베이크 때와 다르면 false, 이후 조회는 nullptr을 돌려준다
+	 */
+	bool Bind(const TArray<FBox>& InBounds);
+	bool IsBound() const { return !IsEmpty() && CanonicalToInput.size() == NumPrimitives; }
+
+	bool IsEmpty() const { return CellSetIndices.empty(); }
+	uint32 GetNumPrimitives() const { return NumPrimitives; }
+	uint32 GetNumCells() const { return static_cast<uint32>(CellSetIndices.size()); }
+	uint64 GetSceneHash() const { return SceneHash; }
+	const FBox& GetRegion() const { return Region; }
+
+	/** @return 위치가 든 셀, 영역 밖이거나 비어 있으면 -1 */
+	int32 FindCell(const FVector& InLocation) const;
+
+	/** 셀 비트셋을 정렬 순서 그대로 푼다 (비트 i가 1이면 정렬 순서 i번째 프리미티브가 보일 수 있다) */
+	void DecodeCell(uint32 InCell, TArray<uint64>& OutBits) const;
+
+	/**
+	 * @brief 카메라 위치의 셀 비트셋 (Bind한 배열의 인덱스 기준), 셀이 지난 조회와 같으면 다시 풀지 않는다
+	 * @return 영역 밖이거나 Bind되지 않았으면 nullptr (컬링에 쓰지 않는다)
+	 */
+	const TArray<uint64>* FindVisibleBits(const FVector& InLocation, FPVSLookup& InOutLookup) const;
+
+	static bool IsVisible(const TArray<uint64>& InBits, uint32 InIndex)
+	{
+		return (InBits[InIndex >> 6] >> (InIndex & 63)) & 1;
+	}
+
+	/** 바운드 값(0.01 단위로 양자화)으로 만든 해시, 배열 순서와 무관하며 저장된 PVS가 지금 레벨과 맞는지 확인할 때 쓴다 */
+	static uint64 ComputeSceneHash(const TArray<FBox>& InBounds);
+
+	void Serialize(bool bInIsLoading, json::JSON& InOutHandle);
+
+private:
+	/** 양자화한 바운드로 정렬한 순서 (정렬 순서 -> 입력 인덱스) */
+	static void ComputeCanonicalOrder(const TArray<FBox>& InBounds, TArray<uint32>& OutOrder);
+	static uint64 HashCanonicalBounds(const TArray<FBox>& InBounds, const TArray<uint32>& InOrder);
+
+	void CompressCells(const TArray<uint64>& InCellBits, uint32 InNumWords, FPVSBakeStats& OutStats);
+	static void EncodeBits(const uint64* InWords, uint32 InNumWords, TArray<uint64>& OutEncoded);
+
+	FBox Region = FBox::Empty();
+	float CellSize = 1.0f;
+	uint32 CellDims[3] = {};
+	uint32 NumPrimitives = 0;
+	uint64 SceneHash = 0;
+
+	// 셀 -> 고유 비트셋 인덱스, 고유 비트셋 -> EncodedWords 시작 위치
+	TArray<uint32> CellSetIndices;
+	TArray<uint32> SetOffsets;
+	// 토큰 (Count << 2 | Kind) 뒤에 Kind가 그대로(2)면 워드 Count개가 따른다
+	TArray<uint64> EncodedWords;
+
+	// Bind한 배열 기준 변환표, 저장하지 않는다
+	TArray<uint32> CanonicalToInput;
+};
@@ -0,0 +1,166 @@
+#pragma once
+#include "Physics/Public/Box.h"
+
+class FFrustumCull;
+
+struct FBVHNode
+{
+	FBox Bounds;
+	int LeftChild = -1;
+	int RightChild = -1;
+	int Start = 0;   // leaf start index
+	int Count = 0;   // leaf count
+	bool bIsLeaf = false;
+
+	uint32 FrustumMask = 0;
+};
+
+// 노드 하나가 캐시 라인 하나에 들어가도록 유지한다
+static_assert(sizeof(FBVHNode) <= 64, "FBVHNode should fit in a cache line");
+
+/**
+ * @brief 바운드 배열만으로 빌드/리핏/레이캐스트/프러스텀 컬링을 하는 BVH
+ * 컴포넌트를 모르므로 UBVHManager와 헤드리스 벤치마크가 같은 코드를 공유한다
+ * 항목은 입력 배열의 인덱스로 식별하며, 리프 순서로 재배치한 바운드 사본을 따로 보관한다
+ */
+class FPrimitiveBVH
+{
+public:
+	void Build(const TArray<FBox>& InBounds, int MaxLeafSize = 5);
+	void Clear();
+
+	/** 트리 구조는 그대로 두고 바운드만 다시 계산한다 (InBounds는 Build 때와 같은 순서/개수) */
+	void Refit(const TArray<FBox>& InBounds);
+
+	/**
+	 * @brief 가까운 노드부터 순회하며 리프 항목마다 InLeafTest(ItemIndex, InOutClosestHit)를 호출한다
+	 * InLeafTest가 true를 돌려주면 (InOutClosestHit를 줄였다면) 그 리프의 나머지 항목은 건너뛴다
+	 * @return 맞은 항목의 입력 인덱스, 없으면 -1
+	 */
+	template<typename LeafTestType>
+	int Raycast(const FRay& InRay, float& InOutClosestHit, LeafTestType&& InLeafTest) const;
+
+	/** 프러스텀 안에 있는 항목의 입력 인덱스를 모은다 */
+	void FrustumCull(FFrustumCull& InFrustum, TArray<uint32>& OutIndices) const;
+
+	bool IsEmpty() const { return RootIndex < 0; }
+	const TArray<FBVHNode>& GetNodes() const { return Nodes; }
+	uint32 GetNumItems() const { return static_cast<uint32>(ItemIndices.size()); }
+
+private:
+	struct FBuildItem
+	{
+		FBox Bounds;
+		FVector Center;
+		uint32 Index;
+	};
+
+	int BuildRecursive(TArray<FBuildItem>& InItems, int Start, int Count, int MaxLeafSize);
+	void TraverseForCulling(uint32 NodeIndex, FFrustumCull& InFrustum, uint32 InMask, TArray<uint32>& OutIndices) const;
+	void AddAllItems(uint32 NodeIndex, TArray<uint32>& OutIndices) const;
+
+	TArray<FBVHNode> Nodes;
+	// 리프 순서로 재배치된 항목 (Nodes[].Start/Count가 가리킨다)
+	TArray<FBox> ItemBounds;
+	TArray<uint32> ItemIndices;
+	int RootIndex = -1;
+};
+
+template<typename LeafTestType>
+int FPrimitiveBVH::Raycast(const FRay& InRay, float& InOutClosestHit, LeafTestType&& InLeafTest) const
+{
+	if (RootIndex < 0)
+	{
+		return -1;
+	}
+
+	struct FStackEntry
+	{
+		int NodeIndex;
+		float Distance;
+	};
+
+	// 레이의 역방향과 부호는 질의당 한 번만 계산한다
+	const FRayQuery Query(InRay);
+
+	FStackEntry Stack[64];
+	int StackPtr = 0;
+	constexpr int StackCapacity = static_cast<int>(sizeof(Stack) / sizeof(Stack[0]));
+
+	auto Push = [&](int InNode, float InDistance)
+	{
+		if (StackPtr < StackCapacity)
+		{
+			Stack[StackPtr++] = { InNode, InDistance };
+		}
+	};
+
+	int HitIndex = -1;
+	Push(RootIndex, 0.0f);
+
+	while (StackPtr > 0)
+	{
+		const FStackEntry Entry = Stack[--StackPtr];
+		const FBVHNode& Node = Nodes[Entry.NodeIndex];
+
+		float TMin = 0.0f;
+		if (!Node.Bounds.IntersectRay(Query, InOutClosestHit, TMin))
+		{
+			continue;
+		}
+
+		if (Node.bIsLeaf)
+		{
+			for (int i = 0; i < Node.Count; ++i)
+			{
+				const int Slot = Node.Start + i;
+
+				float BoxT = 0.0f;
+				if (!ItemBounds[Slot].IntersectRay(Query, InOutClosestHit, BoxT))
+				{
+					continue;
+				}
+
+				if (InLeafTest(ItemIndices[Slot], InOutClosestHit))
+				{
+					HitIndex = static_cast<int>(ItemIndices[Slot]);
+					break;
+				}
+			}
+			continue;
+		}
+
+		const int LeftChild = Node.LeftChild;
+		const int RightChild = Node.RightChild;
+
+		float LeftDistance = 0.0f;
+		const bool bHitLeft = (LeftChild != -1) && Nodes[LeftChild].Bounds.IntersectRay(Query, InOutClosestHit, LeftDistance);
+
+		float RightDistance = 0.0f;
+		const bool bHitRight = (RightChild != -1) && Nodes[RightChild].Bounds.IntersectRay(Query, InOutClosestHit, RightDistance);
+
+		if (bHitLeft && bHitRight)
+		{
+			if (LeftDistance < RightDistance)
+			{
+				Push(RightChild, RightDistance);
+				Push(LeftChild, LeftDistance);
+			}
+			else
+			{
+				Push(LeftChild, LeftDistance);
+				Push(RightChild, RightDistance);
+			}
+		}
+		else if (bHitLeft)
+		{
+			Push(LeftChild, LeftDistance);
+		}
+		else if (bHitRight)
+		{
+			Push(RightChild, RightDistance);
+		}
+	}
+
+	return HitIndex;
+}
@@ -0,0 +1,336 @@
+#include "pch.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
+
+#include "Core/Public/ScopeCycleCounter.h"
+
+IMPLEMENT_SINGLETON_CLASS_BASE(UProfilerManager)
+
+UProfilerManager::UProfilerManager() = default;
+
+UProfilerManager::~UProfilerManager() = default;
+
+void UProfilerManager::EndFrame()
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	// 메인 스레드 버퍼가 목록에 들어가도록 먼저 만든다
+	const uint32 MainThreadIndex = FThreadStats::GetThreadBuffer().GetThreadIndex();
+	FThreadStats::GetThreadBuffers(ThreadBuffers);
+
+	if (History.size() < MAX_HISTORY_FRAMES)
+	{
+		History.emplace_back();
+	}
+	FProfilerFrame& Frame = History[FrameNumber % MAX_HISTORY_FRAMES];
+
+	Frame.FrameNumber = FrameNumber;
+	Frame.EndCycles = NowCycles;
+	Frame.Events.clear();
+	Frame.ThreadRanges.clear();
+
+	uint64 NumDropped = 0;
+	for (FThreadStatBuffer* Buffer : ThreadBuffers)
+	{
+		const uint32 Begin = static_cast<uint32>(Frame.Events.size());
+		Buffer->Drain(Frame.Events);
+		Frame.ThreadRanges.emplace_back(Begin, static_cast<uint32>(Frame.Events.size()));
+		NumDropped += Buffer->GetNumDropped();
+	}
+	NumDroppedEvents = NumDropped;
+
+	// 첫 프레임은 시작 시각을 모르므로 가장 먼저 시작한 스코프로 대신한다
+	if (FrameStartCycles == 0)
+	{
+		FrameStartCycles = NowCycles;
+		for (const FStatEvent& Event : Frame.Events)
+		{
+			FrameStartCycles = std::min(FrameStartCycles, Event.StartCycles);
+		}
+	}
+	Frame.StartCycles = FrameStartCycles;
+
+	AggregateFrame(Frame, MainThreadIndex);
+
+	++FrameNumber;
+	FrameStartCycles = NowCycles;
+}
+
+int32 UProfilerManager::FindOrAddNode(int32 InParent, uint32 InStatIndex, bool bInWorkerThread)
+{
+	const uint64 ParentKey = InParent >= 0 ? static_cast<uint64>(InParent) + 2 : (bInWorkerThread ? 1 : 0);
+	const uint64 Key = (ParentKey << 32) | InStatIndex;
+
+	auto Iter = NodeLookup.find(Key);
+	if (Iter != NodeLookup.end())
+	{
+		return Iter->second;
+	}
+
+	FProfilerNode Node;
+	Node.StatIndex = InStatIndex;
+	Node.Parent = InParent;
+	Node.Depth = InParent >= 0 ? Nodes[InParent].Depth + 1 : 0;
+	Node.bWorkerThread = bInWorkerThread;
+
+	const int32 NodeIndex = static_cast<int32>(Nodes.size());
+	Nodes.push_back(Node);
+	NodeLookup.emplace(Key, NodeIndex);
+	return NodeIndex;
+}
+
+/**
+ * @brief 스레드마다 이벤트를 시작 시각 순으로 훑으며 깊이로 부모를 찾아 호출 경로 노드에 누적한다
+ * 이벤트는 스코프가 끝날 때 기록되므로 (후위 순서) 먼저 시작 시각으로 정렬한다
+ */
+void UProfilerManager::AggregateFrame(const FProfilerFrame& InFrame, uint32 InMainThreadIndex)
+{
+	for (uint32 ThreadIndex = 0; ThreadIndex < InFrame.ThreadRanges.size(); ++ThreadIndex)
+	{
+		const auto [Begin, End] = InFrame.ThreadRanges[ThreadIndex];
+		if (Begin == End)
+		{
+			continue;
+		}
+
+		SortedEventIndices.clear();
+		for (uint32 Index = Begin; Index < End; ++Index)
+		{
+			SortedEventIndices.push_back(Index);
+		}
+		std::sort(SortedEventIndices.begin(), SortedEventIndices.end(), [&InFrame](uint32 A, uint32 B)
+		{
+			const FStatEvent& EventA = InFrame.Events[A];
+			const FStatEvent& EventB = InFrame.Events[B];
+			return EventA.StartCycles != EventB.StartCycles ? EventA.StartCycles < EventB.StartCycles : EventA.Depth < EventB.Depth;
+		});
+
+		const bool bWorkerThread = ThreadIndex != InMainThreadIndex;
+
+		// (깊이, 노드) 스택
+		ScopeStack.clear();
+		for (uint32 EventIndex : SortedEventIndices)
+		{
+			const FStatEvent& Event = InFrame.Events[EventIndex];
+			while (!ScopeStack.empty() && ScopeStack.back().first >= Event.Depth)
+			{
+				ScopeStack.pop_back();
+			}
+
+			const int32 Parent = ScopeStack.empty() ? -1 : ScopeStack.back().second;
+			const int32 NodeIndex = FindOrAddNode(Parent, Event.StatIndex, bWorkerThread);
+			const double DurationMs = FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles);
+
+			FProfilerNode& Node = Nodes[NodeIndex];
+			Node.FrameInclusiveMs += DurationMs;
+			Node.FrameExclusiveMs += DurationMs;
+			++Node.FrameCalls;
+
+			if (Parent >= 0)
+			{
+				Nodes[Parent].FrameExclusiveMs -= DurationMs;
+			}
+
+			ScopeStack.emplace_back(Event.Depth, NodeIndex);
+		}
+	}
+
+	for (FProfilerNode& Node : Nodes)
+	{
+		Node.InclusiveMs += SMOOTHING * (Node.FrameInclusiveMs - Node.InclusiveMs);
+		Node.ExclusiveMs += SMOOTHING * (Node.FrameExclusiveMs - Node.ExclusiveMs);
+		Node.NumCalls += SMOOTHING * (static_cast<double>(Node.FrameCalls) - Node.NumCalls);
+
+		Node.FrameInclusiveMs = 0.0;
+		Node.FrameExclusiveMs = 0.0;
+		Node.FrameCalls = 0;
+	}
+}
+
+void UProfilerManager::GetHierarchy(TArray<FProfilerRow>& OutRows, double InMinInclusiveMs) const
+{
+	OutRows.clear();
+
+	TArray<TArray<int32>> Children(Nodes.size());
+	TArray<int32> Roots;
+	for (int32 Index = 0; Index < static_cast<int32>(Nodes.size()); ++Index)
+	{
+		if (Nodes[Index].InclusiveMs < InMinInclusiveMs)
+		{
+			continue;
+		}
+
+		if (Nodes[Index].Parent >= 0)
+		{
+			Children[Nodes[Index].Parent].push_back(Index);
+		}
+		else
+		{
+			Roots.push_back(Index);
+		}
+	}
+
+	// 메인 스레드 루트가 먼저, 같은 그룹 안에서는 오래 걸린 순
+	auto SortByTime = [this](int32 A, int32 B)
+	{
+		if (Nodes[A].bWorkerThread != Nodes[B].bWorkerThread)
+		{
+			return !Nodes[A].bWorkerThread;
+		}
+		return Nodes[A].InclusiveMs > Nodes[B].InclusiveMs;
+	};
+
+	std::function<void(int32)> AddRows = [&](int32 InNodeIndex)
+	{
+		const FProfilerNode& Node = Nodes[InNodeIndex];
+
+		FProfilerRow Row;
+		Row.Name = FStatRegistry::GetDescriptor(Node.StatIndex).Name;
+		Row.Depth = Node.Depth;
+		Row.bWorkerThread = Node.bWorkerThread;
+		Row.InclusiveMs = Node.InclusiveMs;
+		Row.ExclusiveMs = Node.ExclusiveMs;
+		Row.NumCalls = Node.NumCalls;
+		OutRows.push_back(Row);
+
+		TArray<int32>& NodeChildren = Children[InNodeIndex];
+		std::sort(NodeChildren.begin(), NodeChildren.end(), SortByTime);
+		for (int32 Child : NodeChildren)
+		{
+			AddRows(Child);
+		}
+	};
+
+	std::sort(Roots.begin(), Roots.end(), SortByTime);
+	for (int32 Root : Roots)
+	{
+		AddRows(Root);
+	}
+}
+
+uint64 UProfilerManager::GetOldestFrameNumber() const
+{
+	return FrameNumber > History.size() ? FrameNumber - History.size() : 0;
+}
+
+bool UProfilerManager::ExportRecentFrames(const FString& InPath, uint32 InNumFrames) const
+{
+	if (FrameNumber == 0 || InNumFrames == 0)
+	{
+		return false;
+	}
+
+	const uint64 LastFrame = FrameNumber - 1;
+	const uint64 FirstFrame = std::max(GetOldestFrameNumber(), LastFrame + 1 - std::min<uint64>(InNumFrames, LastFrame + 1));
+	return ExportChromeTrace(InPath, FirstFrame, LastFrame);
+}
+
+bool UProfilerManager::ExportChromeTrace(const FString& InPath, uint64 InFirstFrame, uint64 InLastFrame) const
+{
+	TArray<const FProfilerFrame*> Frames;
+	for (const FProfilerFrame& Frame : History)
+	{
+		if (Frame.FrameNumber >= InFirstFrame && Frame.FrameNumber <= InLastFrame && Frame.EndCycles != 0)
+		{
+			Frames.push_back(&Frame);
+		}
+	}
+
+	if (Frames.empty())
+	{
+		UE_LOG_WARNING("Profiler: 내보낼 프레임이 없습니다 (%llu ~ %llu)", InFirstFrame, InLastFrame);
+		return false;
+	}
+
+	std::sort(Frames.begin(), Frames.end(), [](const FProfilerFrame* A, const FProfilerFrame* B)
+	{
+		return A->FrameNumber < B->FrameNumber;
+	});
+
+	std::ofstream File(InPath);
+	if (!File.is_open())
+	{
+		UE_LOG_ERROR("Profiler: 트레이스 파일을 열 수 없습니다: %s", InPath.c_str());
+		return false;
+	}
+
+	// 프레임 경계를 걸쳐 시작한 스코프도 음수 시각이 되지 않도록 가장 이른 시각을 기준으로 삼는다
+	uint64 BaseCycles = Frames.front()->StartCycles;
+	for (const FProfilerFrame* Frame : Frames)
+	{
+		for (const FStatEvent& Event : Frame->Events)
+		{
+			BaseCycles = std::min(BaseCycles, Event.StartCycles);
+		}
+	}
+	auto ToMicroseconds = [BaseCycles](uint64 InCycles)
+	{
+		return FPlatformTime::ToMilliseconds(InCycles - BaseCycles) * 1000.0;
+	};
+
+	// 스탯 이름은 코드에 박힌 식별자이므로 따옴표/역슬래시만 처리한다
+	auto WriteEscaped = [&File](const char* InText)
+	{
+		for (const char* Char = InText; *Char; ++Char)
+		{
+			if (*Char == '"' || *Char == '\\')
+			{
+				File << '\\';
+			}
+			File << *Char;
+		}
+	};
+
+	File << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool bFirstEvent = true;
+	auto BeginEvent = [&]()
+	{
+		File << (bFirstEvent ? "" : ",\n");
+		bFirstEvent = false;
+	};
+
+	for (const FThreadStatBuffer* Buffer : ThreadBuffers)
+	{
+		BeginEvent();
+		File << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << Buffer->GetThreadIndex() << ",\"args\":{\"name\":\"";
+		WriteEscaped(FThreadStats::GetThreadName(*Buffer).c_str());
+		File << "\"}}";
+	}
+
+	// 프레임 구간은 스레드 트랙 뒤의 별도 트랙에 그린다
+	const size_t FrameTrackId = ThreadBuffers.size();
+	BeginEvent();
+	File << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << FrameTrackId << ",\"args\":{\"name\":\"Frames\"}}";
+
+	File << std::fixed << std::setprecision(3);
+	for (const FProfilerFrame* Frame : Frames)
+	{
+		BeginEvent();
+		File << "{\"name\":\"Frame " << Frame->FrameNumber << "\",\"cat\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" << FrameTrackId
+			<< ",\"ts\":" << ToMicroseconds(Frame->StartCycles)
+			<< ",\"dur\":" << FPlatformTime::ToMilliseconds(Frame->EndCycles - Frame->StartCycles) * 1000.0 << "}";
+
+		for (uint32 ThreadIndex = 0; ThreadIndex < Frame->ThreadRanges.size(); ++ThreadIndex)
+		{
+			const auto [Begin, End] = Frame->ThreadRanges[ThreadIndex];
+			for (uint32 Index = Begin; Index < End; ++Index)
+			{
+				const FStatEvent& Event = Frame->Events[Index];
+				const FStatDescriptor& Descriptor = FStatRegistry::GetDescriptor(Event.StatIndex);
+
+				BeginEvent();
+				File << "{\"name\":\"";
+				WriteEscaped(Descriptor.Name);
+				File << "\",\"cat\":\"";
+				WriteEscaped(Descriptor.Group);
+				File << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << ThreadIndex
+					<< ",\"ts\":" << ToMicroseconds(Event.StartCycles)
+					<< ",\"dur\":" << FPlatformTime::ToMilliseconds(Event.EndCycles - Event.StartCycles) * 1000.0 << "}";
+			}
+		}
+	}
+
+	File << "\n]}\n";
+
+	UE_LOG_SUCCESS("Profiler: %llu ~ %llu 프레임을 내보냈습니다: %s", Frames.front()->FrameNumber, Frames.back()->FrameNumber, InPath.c_str());
+	return true;
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include "Core/Public/Object.h"
+#include "Core/Public/ThreadStats.h"
+
+/**
+ * @brief 한 프레임 동안 모든 스레드에서 기록된 스코프 이벤트
+ */
+struct FProfilerFrame
+{
+	uint64 FrameNumber = 0;
+	uint64 StartCycles = 0;
+	uint64 EndCycles = 0;
+
+	// 스레드 버퍼 순서대로 이어 붙이며, ThreadRanges[i]는 i번째 스레드 버퍼의 [Begin, End)
+	TArray<FStatEvent> Events;
+	TArray<TPair<uint32, uint32>> ThreadRanges;
+};
+
+/**
+ * @brief 호출 경로(부모 노드 + 스탯)별로 합친 계층 노드
+ * 루트는 스레드 그룹(메인/워커)별로 나뉘며, 시간은 최근 프레임들의 지수 이동 평균이다
+ */
+struct FProfilerNode
+{
+	uint32 StatIndex = TStatId::INVALID_INDEX;
+	int32 Parent = -1;
+	uint32 Depth = 0;
+	bool bWorkerThread = false;
+
+	double InclusiveMs = 0.0;
+	double ExclusiveMs = 0.0;
+	double NumCalls = 0.0;
+
+	// 이번 프레임 누적값 (EndFrame에서 평균에 섞는다)
+	double FrameInclusiveMs = 0.0;
+	double FrameExclusiveMs = 0.0;
+	uint32 FrameCalls = 0;
+};
+
+/**
+ * @brief UStatOverlay에 표시할 한 줄 (깊이 우선 순서, 형제는 시간 내림차순)
+ */
+struct FProfilerRow
+{
+	const char* Name = "";
+	uint32 Depth = 0;
+	bool bWorkerThread = false;
+	double InclusiveMs = 0.0;
+	double ExclusiveMs = 0.0;
+	double NumCalls = 0.0;
+};
+
+/**
+ * @brief 스레드별 이벤트 버퍼를 프레임마다 모아 계층으로 집계하고, 최근 프레임을 보관해 Chrome trace로 내보낸다
+ * EndFrame()을 부르는 스레드를 메인 스레드로 본다
+ */
+UCLASS()
+class UProfilerManager : public UObject
+{
+	GENERATED_BODY()
+	DECLARE_SINGLETON_CLASS(UProfilerManager, UObject)
+
+public:
+	static constexpr uint32 MAX_HISTORY_FRAMES = 300;
+	// 이동 평균 가중치 (작을수록 오버레이 숫자가 덜 흔들린다)
+	static constexpr double SMOOTHING = 0.1;
+
+	/** 현재 프레임을 닫는다: 모든 스레드 버퍼를 비워 기록하고 계층 집계를 갱신한다 */
+	void EndFrame();
+
+	void GetHierarchy(TArray<FProfilerRow>& OutRows, double InMinInclusiveMs = 0.0) const;
+
+	/**
+	 * @brief 보관 중인 프레임 [InFirstFrame, InLastFrame]을 Chrome trace JSON으로 저장한다 (chrome://tracing, Perfetto)
+	 */
+	bool ExportChromeTrace(const FString& InPath, uint64 InFirstFrame, uint64 InLastFrame) const;
+	/** 가장 최근 InNumFrames 프레임을 내보낸다 */
+	bool ExportRecentFrames(const FString& InPath, uint32 InNumFrames) const;
+
+	uint64 GetFrameNumber() const { return FrameNumber; }
+	uint64 GetOldestFrameNumber() const;
+	uint64 GetNumDroppedEvents() const { return NumDroppedEvents; }
+
+private:
+	void AggregateFrame(const FProfilerFrame& InFrame, uint32 InMainThreadIndex);
+	int32 FindOrAddNode(int32 InParent, uint32 InStatIndex, bool bInWorkerThread);
+
+	TArray<FProfilerFrame> History;
+	uint64 FrameNumber = 0;
+	uint64 FrameStartCycles = 0;
+	uint64 NumDroppedEvents = 0;
+
+	TArray<FThreadStatBuffer*> ThreadBuffers;
+	TArray<FProfilerNode> Nodes;
+	// (부모 + 1) << 32 | 스탯 인덱스, 루트는 부모 자리에 스레드 그룹을 넣는다
+	TMap<uint64, int32> NodeLookup;
+
+	// 집계 작업용 (프레임마다 재사용)
+	TArray<TPair<uint32, int32>> ScopeStack;
+	TArray<uint32> SortedEventIndices;
+};
@@ -0,0 +1,412 @@
+#include "pch.h"
+#include "Manager/Transform/Public/TransformHierarchy.h"
+
+#include "Core/Public/JobSystem.h"
+
+namespace
+{
+	// 루트 하나는 대개 액터 하나라 서브트리가 작으므로 잡 하나에 여러 루트를 묶는다
+	constexpr uint32 ROOT_BATCH_SIZE = 64;
+}
+
+uint32 FTransformHierarchy::Add(void* InOwner, uint32 InParent, const FVector& InLocation, const FVector& InRotation, const FVector& InScale)
+{
+	uint32 Handle;
+	if (!FreeHandles.empty())
+	{
+		Handle = FreeHandles.back();
+		FreeHandles.pop_back();
+	}
+	else
+	{
+		Handle = static_cast<uint32>(Nodes.size());
+		Nodes.emplace_back();
+	}
+
+	const uint32 Order = static_cast<uint32>(OrderHandles.size());
+	const bool bIsRoot = !IsValid(InParent);
+
+	FNode& Node = Nodes[Handle];
+	Node.Owner = InOwner;
+	Node.Parent = bIsRoot ? INVALID_HANDLE : InParent;
+	Node.Order = Order;
+	Node.bAlive = true;
+	++NumAliveNodes;
+
+	OrderHandles.push_back(Handle);
+	ParentOrders.push_back(INVALID_HANDLE);
+	SubtreeEnds.push_back(Order + 1);
+	Locations.push_back(InLocation);
+	Rotations.push_back(InRotation);
+	Scales.push_back(InScale);
+	WorldMatrices.push_back(FMatrix::Identity());
+	LocalBounds.emplace_back();
+	WorldBounds.emplace_back();
+	DirtyFlags.push_back(1);
+	bHasDirtyNodes = true;
+
+	// 루트는 맨 뒤에 붙여도 순서가 유지되므로 다시 만들 필요가 없다
+	if (bIsRoot && !bOrderDirty)
+	{
+		RootOrders.push_back(Order);
+	}
+	else
+	{
+		bOrderDirty = true;
+	}
+
+	return Handle;
+}
+
+void FTransformHierarchy::Remove(uint32 InHandle)
+{
+	if (!IsValid(InHandle))
+	{
+		return;
+	}
+
+	// 자식 재연결과 순서 배열 슬롯 정리는 다음 RebuildOrder에서 한 번에 한다
+	// 레벨 해제처럼 노드를 대량으로 지울 때 지울 때마다 전체 노드를 훑지 않기 위함이며,
+	// 그때까지 Parent는 남겨 두고 핸들도 재사용하지 않는다
+	FNode& Removed = Nodes[InHandle];
+	Removed.Owner = nullptr;
+	Removed.bAlive = false;
+	--NumAliveNodes;
+	PendingFreeHandles.push_back(InHandle);
+	bOrderDirty = true;
+}
+
+void FTransformHierarchy::SetParent(uint32 InHandle, uint32 InParent)
+{
+	if (!IsValid(InHandle))
+	{
+		return;
+	}
+
+	const uint32 NewParent = IsValid(InParent) ? InParent : INVALID_HANDLE;
+	if (Nodes[InHandle].Parent == NewParent)
+	{
+		return;
+	}
+
+	// 새 부모의 조상 중에 자신이 있으면 순환이 생긴다
+	for (uint32 Ancestor = NewParent; Ancestor != INVALID_HANDLE; Ancestor = Nodes[Ancestor].Parent)
+	{
+		if (Ancestor == InHandle)
+		{
+			return;
+		}
+	}
+
+	Nodes[InHandle].Parent = NewParent;
+	DirtyFlags[Nodes[InHandle].Order] = 1;
+	bHasDirtyNodes = true;
+	bOrderDirty = true;
+}
+
+void FTransformHierarchy::SetLocalTransform(uint32 InHandle, const FVector& InLocation, const FVector& InRotation, const FVector& InScale)
+{
+	if (!IsValid(InHandle))
+	{
+		return;
+	}
+
+	const uint32 Order = Nodes[InHandle].Order;
+	Locations[Order] = InLocation;
+	Rotations[Order] = InRotation;
+	Scales[Order] = InScale;
+	DirtyFlags[Order] = 1;
+	bHasDirtyNodes = true;
+}
+
+void FTransformHierarchy::SetLocalBounds(uint32 InHandle, const FBox& InLocalBounds)
+{
+	if (!IsValid(InHandle))
+	{
+		return;
+	}
+
+	const uint32 Order = Nodes[InHandle].Order;
+	LocalBounds[Order] = InLocalBounds;
+	DirtyFlags[Order] = 1;
+	bHasDirtyNodes = true;
+}
+
+bool FTransformHierarchy::IsWorldDirty(uint32 InHandle)
+{
+	if (!IsValid(InHandle))
+	{
+		return false;
+	}
+
+	if (!bHasDirtyNodes && !bOrderDirty)
+	{
+		return false;
+	}
+
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	for (uint32 Order = Nodes[InHandle].Order; Order != INVALID_HANDLE; Order = ParentOrders[Order])
+	{
+		if (DirtyFlags[Order])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FTransformHierarchy::UpdateNode(uint32 InHandle)
+{
+	if (!IsValid(InHandle) || (!bHasDirtyNodes && !bOrderDirty))
+	{
+		return;
+	}
+
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	uint32 TopDirtyOrder = INVALID_HANDLE;
+	for (uint32 Order = Nodes[InHandle].Order; Order != INVALID_HANDLE; Order = ParentOrders[Order])
+	{
+		if (DirtyFlags[Order])
+		{
+			TopDirtyOrder = Order;
+		}
+	}
+
+	if (TopDirtyOrder != INVALID_HANDLE)
+	{
+		UpdateRange(TopDirtyOrder, SubtreeEnds[TopDirtyOrder]);
+	}
+}
+
+/**
+ * @brief 루트별 서브트리를 앞에서부터 훑으며 dirty 노드를 만나면 그 서브트리 전체를 다시 계산하고 건너뛴다
+ */
+void FTransformHierarchy::Update()
+{
+	NumUpdatedNodes.store(0, std::memory_order_relaxed);
+
+	if (!bHasDirtyNodes && !bOrderDirty)
+	{
+		return;
+	}
+
+	if (bOrderDirty)
+	{
+		RebuildOrder();
+	}
+
+	FJobSystem::ParallelFor(static_cast<uint32>(RootOrders.size()), [this](uint32 InBegin, uint32 InEnd)
+	{
+		for (uint32 RootIndex = InBegin; RootIndex < InEnd; ++RootIndex)
+		{
+			UpdateSubtree(RootOrders[RootIndex]);
+		}
+	}, ROOT_BATCH_SIZE);
+
+	bHasDirtyNodes = false;
+}
+
+const FMatrix& FTransformHierarchy::GetWorldMatrix(uint32 InHandle)
+{
+	assert(IsValid(InHandle));
+
+	UpdateNode(InHandle);
+	return WorldMatrices[Nodes[InHandle].Order];
+}
+
+const FBox& FTransformHierarchy::GetWorldBounds(uint32 InHandle)
+{
+	assert(IsValid(InHandle));
+
+	UpdateNode(InHandle);
+	return WorldBounds[Nodes[InHandle].Order];
+}
+
+/**
+ * @brief 살아 있는 노드를 부모 -> 자식 DFS 순서로 다시 늘어놓고 SoA를 그 순서로 옮긴다
+ * 삭제된 노드의 슬롯도 여기서 빠진다
+ */
+void FTransformHierarchy::RebuildOrder()
+{
+	const uint32 NumHandles = static_cast<uint32>(Nodes.size());
+
+	// 핸들 기준 자식 목록 (첫 자식 / 다음 형제)
+	TArray<uint32> FirstChildren(NumHandles, INVALID_HANDLE);
+	TArray<uint32> NextSiblings(NumHandles, INVALID_HANDLE);
+	TArray<uint32> Stack;
+	Stack.reserve(NumHandles);
+
+	for (uint32 Handle = NumHandles; Handle-- > 0;)
+	{
+		FNode& Node = Nodes[Handle];
+		if (!Node.bAlive)
+		{
+			continue;
+		}
+
+		// 지워진 부모는 살아 있는 가장 가까운 조상으로 건너뛰고, 월드 행렬이 바뀌므로 다시 계산한다
+		if (Node.Parent != INVALID_HANDLE && !Nodes[Node.Parent].bAlive)
+		{
+			uint32 Ancestor = Node.Parent;
+			while (Ancestor != INVALID_HANDLE && !Nodes[Ancestor].bAlive)
+			{
+				Ancestor = Nodes[Ancestor].Parent;
+			}
+			Node.Parent = Ancestor;
+			DirtyFlags[Node.Order] = 1;
+			bHasDirtyNodes = true;
+		}
+
+		if (Node.Parent == INVALID_HANDLE)
+		{
+			Stack.push_back(Handle);
+		}
+		else
+		{
+			NextSiblings[Handle] = FirstChildren[Node.Parent];
+			FirstChildren[Node.Parent] = Handle;
+		}
+	}
+
+	TArray<uint32> NewOrderHandles;
+	TArray<uint32> NewParentOrders;
+	TArray<FVector> NewLocations;
+	TArray<FVector> NewRotations;
+	TArray<FVector> NewScales;
+	TArray<FMatrix> NewWorldMatrices;
+	TArray<FBox> NewLocalBounds;
+	TArray<FBox> NewWorldBounds;
+	TArray<uint8> NewDirtyFlags;
+	NewOrderHandles.reserve(NumAliveNodes);
+	NewParentOrders.reserve(NumAliveNodes);
+	NewLocations.reserve(NumAliveNodes);
+	NewRotations.reserve(NumAliveNodes);
+	NewScales.reserve(NumAliveNodes);
+	NewWorldMatrices.reserve(NumAliveNodes);
+	NewLocalBounds.reserve(NumAliveNodes);
+	NewWorldBounds.reserve(NumAliveNodes);
+	NewDirtyFlags.reserve(NumAliveNodes);
+	RootOrders.clear();
+
+	// 스택 DFS는 서브트리를 연속 구간으로 내보낸다
+	while (!Stack.empty())
+	{
+		const uint32 Handle = Stack.back();
+		Stack.pop_back();
+
+		FNode& Node = Nodes[Handle];
+		const uint32 OldOrder = Node.Order;
+		const uint32 NewOrder = static_cast<uint32>(NewOrderHandles.size());
+
+		NewOrderHandles.push_back(Handle);
+		if (Node.Parent == INVALID_HANDLE)
+		{
+			NewParentOrders.push_back(INVALID_HANDLE);
+			RootOrders.push_back(NewOrder);
+		}
+		else
+		{
+			// 부모는 이미 새 순서를 받았다
+			NewParentOrders.push_back(Nodes[Node.Parent].Order);
+		}
+		NewLocations.push_back(Locations[OldOrder]);
+		NewRotations.push_back(Rotations[OldOrder]);
+		NewScales.push_back(Scales[OldOrder]);
+		NewWorldMatrices.push_back(WorldMatrices[OldOrder]);
+		NewLocalBounds.push_back(LocalBounds[OldOrder]);
+		NewWorldBounds.push_back(WorldBounds[OldOrder]);
+		NewDirtyFlags.push_back(DirtyFlags[OldOrder]);
+		Node.Order = NewOrder;
+
+		for (uint32 Child = FirstChildren[Handle]; Child != INVALID_HANDLE; Child = NextSiblings[Child])
+		{
+			Stack.push_back(Child);
+		}
+	}
+
+	// 전위 순서라 자식의 서브트리 끝을 뒤에서부터 부모로 올리면 된다
+	const uint32 NumOrders = static_cast<uint32>(NewOrderHandles.size());
+	SubtreeEnds.resize(NumOrders);
+	for (uint32 Order = 0; Order < NumOrders; ++Order)
+	{
+		SubtreeEnds[Order] = Order + 1;
+	}
+	for (uint32 Order = NumOrders; Order-- > 0;)
+	{
+		const uint32 ParentOrder = NewParentOrders[Order];
+		if (ParentOrder != INVALID_HANDLE)
+		{
+			SubtreeEnds[ParentOrder] = std::max(SubtreeEnds[ParentOrder], SubtreeEnds[Order]);
+		}
+	}
+
+	OrderHandles = std::move(NewOrderHandles);
+	ParentOrders = std::move(NewParentOrders);
+	Locations = std::move(NewLocations);
+	Rotations = std::move(NewRotations);
+	Scales = std::move(NewScales);
+	WorldMatrices = std::move(NewWorldMatrices);
+	LocalBounds = std::move(NewLocalBounds);
+	WorldBounds = std::move(NewWorldBounds);
+	DirtyFlags = std::move(NewDirtyFlags);
+
+	// 자식이 모두 재연결되었으므로 지운 핸들을 이제 재사용한다
+	for (uint32 Handle : PendingFreeHandles)
+	{
+		Nodes[Handle].Parent = INVALID_HANDLE;
+		FreeHandles.push_back(Handle);
+	}
+	PendingFreeHandles.clear();
+
+	bOrderDirty = false;
+}
+
+void FTransformHierarchy::UpdateSubtree(uint32 InOrder)
+{
+	const uint32 End = SubtreeEnds[InOrder];
+	for (uint32 Order = InOrder; Order < End;)
+	{
+		if (DirtyFlags[Order])
+		{
+			UpdateRange(Order, SubtreeEnds[Order]);
+			Order = SubtreeEnds[Order];
+		}
+		else
+		{
+			++Order;
+		}
+	}
+}
+
+/**
+ * @brief [InBegin, InEnd) 구간을 순서대로 다시 계산한다, InBegin의 부모는 이미 최신이어야 한다
+ */
+void FTransformHierarchy::UpdateRange(uint32 InBegin, uint32 InEnd)
+{
+	for (uint32 Order = InBegin; Order < InEnd; ++Order)
+	{
+		FMatrix LocalMatrix = FMatrix::GetModelMatrix(Locations[Order], FVector::GetDegreeToRadian(Rotations[Order]), Scales[Order]);
+
+		const uint32 ParentOrder = ParentOrders[Order];
+		WorldMatrices[Order] = ParentOrder == INVALID_HANDLE ? LocalMatrix : LocalMatrix * WorldMatrices[ParentOrder];
+		DirtyFlags[Order] = 0;
+
+		if (WorldUpdatedCallback)
+		{
+			WorldUpdatedCallback(Nodes[OrderHandles[Order]].Owner, WorldMatrices[Order]);
+		}
+	}
+
+	// 다시 계산한 구간은 순서 배열에서 연속이므로 바운드도 한 번에 옮긴다
+	FBox::TransformBoxes(&LocalBounds[InBegin], &WorldMatrices[InBegin], &WorldBounds[InBegin], InEnd - InBegin);
+
+	NumUpdatedNodes.fetch_add(InEnd - InBegin, std::memory_order_relaxed);
+}
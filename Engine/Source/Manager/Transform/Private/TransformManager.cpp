@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "Manager/Transform/Public/TransformManager.h"
+
+#include "Actor/Public/Actor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Core/Public/ScopeCycleCounter.h"
+
+DECLARE_CYCLE_STAT("Transform Update", STAT_TransformUpdate, Scene)
+
+IMPLEMENT_SINGLETON_CLASS_BASE(UTransformManager)
+
+UTransformManager::UTransformManager()
+{
+	Hierarchy.SetWorldUpdatedCallback(&UTransformManager::OnWorldUpdated);
+}
+
+UTransformManager::~UTransformManager() = default;
+
+void UTransformManager::RegisterComponent(USceneComponent* InComponent)
+{
+	if (!InComponent || InComponent->TransformHandle != FTransformHierarchy::INVALID_HANDLE)
+	{
+		return;
+	}
+
+	USceneComponent* Parent = InComponent->ParentAttachment;
+	if (Parent && Parent->TransformHandle == FTransformHierarchy::INVALID_HANDLE)
+	{
+		// 부모를 등록하면 자식 서브트리로 자신도 함께 등록된다
+		RegisterComponent(Parent);
+		if (InComponent->TransformHandle != FTransformHierarchy::INVALID_HANDLE)
+		{
+			return;
+		}
+	}
+
+	InComponent->TransformHandle = Hierarchy.Add(InComponent,
+		Parent ? Parent->TransformHandle : FTransformHierarchy::INVALID_HANDLE,
+		InComponent->RelativeLocation, InComponent->RelativeRotation, InComponent->RelativeScale3D);
+	InComponent->bIsTransformDirty = true;
+	InComponent->bIsTransformDirtyInverse = true;
+
+	// 프리미티브는 로컬 바운드도 넘겨 월드 바운드를 월드 행렬과 함께 갱신하게 한다
+	if (InComponent->GetComponentType() >= EComponentType::Primitive)
+	{
+		Hierarchy.SetLocalBounds(InComponent->TransformHandle, static_cast<UPrimitiveComponent*>(InComponent)->GetLocalBounds());
+	}
+
+	// 등록된 노드 아래에 등록되지 않은 자식이 남으면 부모가 움직여도 알 수 없으므로 서브트리째 등록한다
+	for (USceneComponent* Child : InComponent->Children)
+	{
+		if (Child && Child->ParentAttachment == InComponent)
+		{
+			RegisterComponent(Child);
+		}
+	}
+}
+
+void UTransformManager::UnregisterComponent(USceneComponent* InComponent)
+{
+	if (!InComponent || InComponent->TransformHandle == FTransformHierarchy::INVALID_HANDLE)
+	{
+		return;
+	}
+
+	Hierarchy.Remove(InComponent->TransformHandle);
+	InComponent->TransformHandle = FTransformHierarchy::INVALID_HANDLE;
+
+	// 이후로는 컴포넌트가 직접 계산하므로 캐시를 믿지 않는다 (소멸 중일 수 있어 자식은 건드리지 않는다)
+	InComponent->bIsTransformDirty = true;
+	InComponent->bIsTransformDirtyInverse = true;
+}
+
+void UTransformManager::RegisterActor(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	for (const TObjectPtr<UActorComponent>& Component : InActor->GetOwnedComponents())
+	{
+		if (Component && Component->GetComponentType() >= EComponentType::Scene)
+		{
+			RegisterComponent(Cast<USceneComponent>(Component));
+		}
+	}
+}
+
+void UTransformManager::UnregisterActor(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	for (const TObjectPtr<UActorComponent>& Component : InActor->GetOwnedComponents())
+	{
+		if (Component && Component->GetComponentType() >= EComponentType::Scene)
+		{
+			UnregisterComponent(Cast<USceneComponent>(Component));
+		}
+	}
+}
+
+void UTransformManager::UpdateParent(USceneComponent* InComponent)
+{
+	if (!InComponent)
+	{
+		return;
+	}
+
+	USceneComponent* Parent = InComponent->ParentAttachment;
+	if (InComponent->TransformHandle == FTransformHierarchy::INVALID_HANDLE)
+	{
+		// 등록된 부모 밑으로 들어오면 함께 갱신되도록 등록한다
+		if (Parent && Parent->TransformHandle != FTransformHierarchy::INVALID_HANDLE)
+		{
+			RegisterComponent(InComponent);
+		}
+		return;
+	}
+
+	if (Parent)
+	{
+		RegisterComponent(Parent);
+	}
+	Hierarchy.SetParent(InComponent->TransformHandle, Parent ? Parent->TransformHandle : FTransformHierarchy::INVALID_HANDLE);
+}
+
+void UTransformManager::Update()
+{
+	SCOPE_CYCLE_COUNTER(STAT_TransformUpdate);
+	Hierarchy.Update();
+}
+
+/**
+ * @brief 계층이 다시 계산한 월드 행렬을 컴포넌트 캐시에 옮긴다, 역행렬은 다음 조회 때 계산한다
+ */
+void UTransformManager::OnWorldUpdated(void* InOwner, const FMatrix& InWorldMatrix)
+{
+	USceneComponent* Component = static_cast<USceneComponent*>(InOwner);
+	Component->WorldTransformMatrix = InWorldMatrix;
+	Component->bIsTransformDirty = false;
+	Component->bIsTransformDirtyInverse = true;
+}
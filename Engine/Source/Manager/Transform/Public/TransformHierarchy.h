@@ -0,0 +1,92 @@
+#pragma once
+#include "Physics/Public/Box.h"
+
+#include <atomic>
+
+/**
+ * @brief 씬 트랜스폼 계층을 부모가 자식보다 앞에 오도록(DFS 순서) 펼쳐 둔 SoA 캐시
+ *
+ * 로컬 TRS와 월드 행렬을 순서 배열에 나란히 두고, 각 노드의 서브트리는 [Order, SubtreeEnd) 연속 구간이다
+ * 로컬 트랜스폼이 바뀌면 그 노드에 dirty 표시만 하고, Update에서 dirty 노드의 서브트리만 앞에서부터 한 번에 다시 계산한다
+ * (World = Local * ParentWorld, 부모는 항상 먼저 계산되어 있으므로 조상 체인을 다시 곱하지 않는다)
+ *
+ * 핸들은 추가/삭제/부모 변경에도 바뀌지 않는다, 구조가 바뀌면 다음 조회나 Update에서 순서를 한 번에 다시 만든다
+ * 루트마다 서브트리가 겹치지 않으므로 Update는 루트 단위로 FJobSystem::ParallelFor에 나눠 돈다
+ *
+ * 노드마다 로컬 바운드를 두면 월드 행렬을 다시 계산한 구간의 월드 AABB도 FBox::TransformBoxes로 함께 갱신해
+ * 순서 배열에 연속으로 둔다 (바운드가 없는 노드는 원점 크기 0 박스라 월드 위치 한 점이 된다)
+ */
+class FTransformHierarchy
+{
+public:
+	static constexpr uint32 INVALID_HANDLE = 0xFFFFFFFFu;
+
+	/** 월드 행렬을 다시 계산할 때마다 호출된다 (Update에서는 워커 스레드에서 불릴 수 있다) */
+	using FWorldUpdatedCallback = void(*)(void* InOwner, const FMatrix& InWorldMatrix);
+
+	/**
+	 * @param InParent INVALID_HANDLE이면 루트
+	 * @param InRotation 오일러 각 (Degree)
+	 */
+	uint32 Add(void* InOwner, uint32 InParent, const FVector& InLocation, const FVector& InRotation, const FVector& InScale);
+	/** 자식은 지운 노드의 부모에 다시 붙는다 */
+	void Remove(uint32 InHandle);
+	void SetParent(uint32 InHandle, uint32 InParent);
+	void SetLocalTransform(uint32 InHandle, const FVector& InLocation, const FVector& InRotation, const FVector& InScale);
+	void SetLocalBounds(uint32 InHandle, const FBox& InLocalBounds);
+
+	/** 자신이나 조상 중 하나라도 dirty면 true */
+	bool IsWorldDirty(uint32 InHandle);
+	/** InHandle을 덮는 가장 위쪽 dirty 서브트리만 다시 계산한다 (프레임 중간 조회용) */
+	void UpdateNode(uint32 InHandle);
+	/** 모든 dirty 서브트리를 다시 계산한다 (프레임에 한 번) */
+	void Update();
+
+	const FMatrix& GetWorldMatrix(uint32 InHandle);
+	const FBox& GetWorldBounds(uint32 InHandle);
+
+	void SetWorldUpdatedCallback(FWorldUpdatedCallback InCallback) { WorldUpdatedCallback = InCallback; }
+
+	bool IsValid(uint32 InHandle) const { return InHandle < Nodes.size() && Nodes[InHandle].bAlive; }
+	uint32 GetNumNodes() const { return NumAliveNodes; }
+	/** 마지막 Update에서 다시 계산한 노드 수 */
+	uint32 GetNumUpdatedNodes() const { return NumUpdatedNodes; }
+
+private:
+	struct FNode
+	{
+		void* Owner = nullptr;
+		uint32 Parent = INVALID_HANDLE;
+		uint32 Order = 0;
+		bool bAlive = false;
+	};
+
+	void RebuildOrder();
+	void UpdateSubtree(uint32 InOrder);
+	void UpdateRange(uint32 InBegin, uint32 InEnd);
+
+	// 핸들 -> 노드 (삭제된 핸들은 다음 RebuildOrder 이후 FreeHandles에서 재사용)
+	TArray<FNode> Nodes;
+	TArray<uint32> FreeHandles;
+	TArray<uint32> PendingFreeHandles;
+	uint32 NumAliveNodes = 0;
+
+	// 아래는 순서(Order) 기준 SoA, bOrderDirty가 아니면 부모가 항상 자식보다 앞에 있다
+	TArray<uint32> OrderHandles;
+	TArray<uint32> ParentOrders;
+	TArray<uint32> SubtreeEnds;
+	TArray<FVector> Locations;
+	TArray<FVector> Rotations;
+	TArray<FVector> Scales;
+	TArray<FMatrix> WorldMatrices;
+	TArray<FBox> LocalBounds;
+	TArray<FBox> WorldBounds;
+	TArray<uint8> DirtyFlags;
+
+	TArray<uint32> RootOrders;
+	bool bOrderDirty = false;
+	bool bHasDirtyNodes = false;
+
+	FWorldUpdatedCallback WorldUpdatedCallback = nullptr;
+	std::atomic<uint32> NumUpdatedNodes{ 0 };
+};
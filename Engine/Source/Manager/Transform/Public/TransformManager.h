@@ -0,0 +1,40 @@
+#pragma once
+#include "Core/Public/Object.h"
+#include "Manager/Transform/Public/TransformHierarchy.h"
+
+class AActor;
+class USceneComponent;
+
+/**
+ * @brief 레벨에 등록된 씬 컴포넌트의 월드 트랜스폼을 FTransformHierarchy로 모아 프레임마다 한 번에 갱신한다
+ *
+ * 등록된 컴포넌트는 로컬 트랜스폼이 바뀌어도 자식을 재귀로 더럽히지 않고 계층에 dirty 표시만 남긴다
+ * 다시 계산된 월드 행렬은 컴포넌트의 캐시에 바로 써 주므로 GetWorldTransformMatrix가 돌려주는 참조는 그대로 유효하다
+ */
+UCLASS()
+class UTransformManager : public UObject
+{
+	GENERATED_BODY()
+	DECLARE_SINGLETON_CLASS(UTransformManager, UObject)
+
+public:
+	/** 부모 체인과 자식 서브트리도 함께 등록한다 */
+	void RegisterComponent(USceneComponent* InComponent);
+	void UnregisterComponent(USceneComponent* InComponent);
+
+	void RegisterActor(AActor* InActor);
+	void UnregisterActor(AActor* InActor);
+
+	/** 부모가 바뀐 컴포넌트의 계층 연결을 갱신한다, 등록된 부모 밑으로 옮겨 온 컴포넌트는 새로 등록한다 */
+	void UpdateParent(USceneComponent* InComponent);
+
+	/** dirty 서브트리를 모두 다시 계산한다 (렌더링 전 프레임에 한 번) */
+	void Update();
+
+	FTransformHierarchy& GetHierarchy() { return Hierarchy; }
+
+private:
+	static void OnWorldUpdated(void* InOwner, const FMatrix& InWorldMatrix);
+
+	FTransformHierarchy Hierarchy;
+};
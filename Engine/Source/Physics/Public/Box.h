@@ -0,0 +1,229 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+#include "Global/Matrix.h"
+#include "Physics/Public/RayQuery.h"
+
+#include <type_traits>
+
+/**
+ * @brief 가속 구조(BVH)와 컬링에서 쓰는 vtable 없는 POD 박스 (32바이트)
+ * Min/Max를 16바이트 정렬된 float4로 두어 SSE 레지스터로 바로 읽고 쓴다 (W 레인은 항상 0)
+ * IBoundingVolume이 필요한 컴포넌트 경계에서만 FAABB로 변환해서 사용한다
+ */
+struct alignas(16) FBox
+{
+	float Min[4] = {};
+	float Max[4] = {};
+
+	/** Union의 항등원 (Min = +FLT_MAX, Max = -FLT_MAX) */
+	FORCEINLINE static FBox Empty()
+	{
+		FBox Box;
+		Box.Store(_mm_setr_ps(+FLT_MAX, +FLT_MAX, +FLT_MAX, 0.0f), _mm_setr_ps(-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f));
+		return Box;
+	}
+
+	FORCEINLINE static FBox Make(const FVector& InMin, const FVector& InMax)
+	{
+		FBox Box;
+		Box.Store(_mm_setr_ps(InMin.X, InMin.Y, InMin.Z, 0.0f), _mm_setr_ps(InMax.X, InMax.Y, InMax.Z, 0.0f));
+		return Box;
+	}
+
+	FORCEINLINE static FBox FromAABB(const FAABB& InAABB) { return Make(InAABB.Min, InAABB.Max); }
+
+	/** 한 축이라도 Min > Max이면 빈 박스 (Empty()와 아무것도 넣지 않은 Union 결과) */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return (_mm_movemask_ps(_mm_cmpgt_ps(LoadMin(), LoadMax())) & 0x7) != 0;
+	}
+	FAABB ToAABB() const { return FAABB(GetMin(), GetMax()); }
+
+	FVector GetMin() const { return FVector(Min[0], Min[1], Min[2]); }
+	FVector GetMax() const { return FVector(Max[0], Max[1], Max[2]); }
+	FVector GetCenter() const { return FVector((Min[0] + Max[0]) * 0.5f, (Min[1] + Max[1]) * 0.5f, (Min[2] + Max[2]) * 0.5f); }
+
+	FORCEINLINE __m128 LoadMin() const { return _mm_load_ps(Min); }
+	FORCEINLINE __m128 LoadMax() const { return _mm_load_ps(Max); }
+	FORCEINLINE void Store(__m128 InMin, __m128 InMax)
+	{
+		_mm_store_ps(Min, InMin);
+		_mm_store_ps(Max, InMax);
+	}
+
+	FORCEINLINE static FBox Union(const FBox& InA, const FBox& InB)
+	{
+		FBox Box;
+		Box.Store(_mm_min_ps(InA.LoadMin(), InB.LoadMin()), _mm_max_ps(InA.LoadMax(), InB.LoadMax()));
+		return Box;
+	}
+
+	FORCEINLINE void Expand(const FBox& InOther)
+	{
+		Store(_mm_min_ps(LoadMin(), InOther.LoadMin()), _mm_max_ps(LoadMax(), InOther.LoadMax()));
+	}
+
+	FORCEINLINE void ExpandPoint(const FVector& InPoint)
+	{
+		const __m128 Point = _mm_setr_ps(InPoint.X, InPoint.Y, InPoint.Z, 0.0f);
+		Store(_mm_min_ps(LoadMin(), Point), _mm_max_ps(LoadMax(), Point));
+	}
+
+	/** 경계가 맞닿는 경우도 겹침으로 본다 */
+	FORCEINLINE bool Overlaps(const FBox& InOther) const
+	{
+		const __m128 Inside = _mm_and_ps(_mm_cmple_ps(LoadMin(), InOther.LoadMax()), _mm_cmple_ps(InOther.LoadMin(), LoadMax()));
+		return (_mm_movemask_ps(Inside) & 0x7) == 0x7;
+	}
+
+	/** 퇴화된 (두께가 0 이하인) 박스는 0을 돌려준다 */
+	float GetSurfaceArea() const
+	{
+		const float DX = Max[0] - Min[0];
+		const float DY = Max[1] - Min[1];
+		const float DZ = Max[2] - Min[2];
+		if (DX <= 0.0f || DY <= 0.0f || DZ <= 0.0f)
+		{
+			return 0.0f;
+		}
+		return 2.0f * (DX * DY + DY * DZ + DZ * DX);
+	}
+
+	/**
+	 * @brief 아핀 변환 행렬(행 벡터 규약)로 옮긴 박스를 감싸는 AABB를 구한다 (Arvo)
+	 * 중심은 행렬로 옮기고 반지름은 3x3의 절댓값 행으로 옮기므로 8개 꼭짓점을 변환하지 않고 행 연산 3번으로 끝난다
+	 * 빈 박스는 빈 박스로 남긴다 (±FLT_MAX의 중심/반지름이 inf * 0 = NaN이 되기 때문)
+	 */
+	FORCEINLINE FBox TransformBy(const FMatrix& InMatrix) const
+	{
+		if (IsEmpty())
+		{
+			return Empty();
+		}
+
+		const __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		const __m128 Half = _mm_set1_ps(0.5f);
+
+		const __m128 BoxMin = LoadMin();
+		const __m128 BoxMax = LoadMax();
+		const __m128 Center = _mm_mul_ps(_mm_add_ps(BoxMin, BoxMax), Half);
+		const __m128 Extent = _mm_mul_ps(_mm_sub_ps(BoxMax, BoxMin), Half);
+
+		const __m128 Row0 = _mm_load_ps(InMatrix.Data[0]);
+		const __m128 Row1 = _mm_load_ps(InMatrix.Data[1]);
+		const __m128 Row2 = _mm_load_ps(InMatrix.Data[2]);
+
+		__m128 WorldCenter = _mm_load_ps(InMatrix.Data[3]);
+		WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(0, 0, 0, 0)), Row0));
+		WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(1, 1, 1, 1)), Row1));
+		WorldCenter = _mm_add_ps(WorldCenter, _mm_mul_ps(_mm_shuffle_ps(Center, Center, _MM_SHUFFLE(2, 2, 2, 2)), Row2));
+
+		__m128 WorldExtent = _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(0, 0, 0, 0)), _mm_and_ps(Row0, AbsMask));
+		WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(1, 1, 1, 1)), _mm_and_ps(Row1, AbsMask)));
+		WorldExtent = _mm_add_ps(WorldExtent, _mm_mul_ps(_mm_shuffle_ps(Extent, Extent, _MM_SHUFFLE(2, 2, 2, 2)), _mm_and_ps(Row2, AbsMask)));
+
+		FBox Box;
+		Box.Store(_mm_and_ps(_mm_sub_ps(WorldCenter, WorldExtent), XYZMask), _mm_and_ps(_mm_add_ps(WorldCenter, WorldExtent), XYZMask));
+		return Box;
+	}
+
+	/**
+	 * @brief 연속된 InCount개의 로컬 박스를 같은 인덱스의 행렬로 옮겨 OutBoxes에 쓴다
+	 * 세 배열은 같은 순서여야 하며, 구간 단위로 호출하면 다시 계산할 범위만 넘길 수 있다
+	 */
+	static void TransformBoxes(const FBox* InLocalBoxes, const FMatrix* InMatrices, FBox* OutBoxes, uint32 InCount)
+	{
+		for (uint32 Index = 0; Index < InCount; ++Index)
+		{
+			OutBoxes[Index] = InLocalBoxes[Index].TransformBy(InMatrices[Index]);
+		}
+	}
+
+	/**
+	 * @brief Slab 방식 Ray-Box 교차 검사 (FAABB::RaycastHit와 같은 규칙)
+	 * 시작점이 박스 안이면 먼 쪽 교차 거리를 돌려준다
+	 */
+	FORCEINLINE bool RaycastHit(const FRay& InRay, float* OutDistance) const
+	{
+		const __m128 Origin = _mm_loadu_ps(&InRay.Origin.X);
+		const __m128 Direction = _mm_loadu_ps(&InRay.Direction.X);
+		const __m128 BoxMin = LoadMin();
+		const __m128 BoxMax = LoadMax();
+
+		// 축과 평행한 레이는 시작점이 슬랩 안에 있어야 한다
+		const __m128 AbsDirection = _mm_andnot_ps(_mm_set1_ps(-0.0f), Direction);
+		const __m128 Parallel = _mm_cmplt_ps(AbsDirection, _mm_set1_ps(1e-8f));
+		const __m128 OutsideSlab = _mm_or_ps(_mm_cmplt_ps(Origin, BoxMin), _mm_cmpgt_ps(Origin, BoxMax));
+		if (_mm_movemask_ps(_mm_and_ps(Parallel, OutsideSlab)) & 0x7)
+		{
+			return false;
+		}
+
+		const __m128 InvDirection = _mm_div_ps(_mm_set1_ps(1.0f), Direction);
+		const __m128 T1 = _mm_mul_ps(_mm_sub_ps(BoxMin, Origin), InvDirection);
+		const __m128 T2 = _mm_mul_ps(_mm_sub_ps(BoxMax, Origin), InvDirection);
+		const __m128 Near = _mm_min_ps(T1, T2);
+		const __m128 Far = _mm_max_ps(T1, T2);
+
+		// X, Y, Z 레인만 모은다 (W 레인은 무시)
+		const __m128 NearMax = _mm_max_ss(_mm_max_ss(Near, _mm_shuffle_ps(Near, Near, _MM_SHUFFLE(3, 3, 3, 1))),
+			_mm_shuffle_ps(Near, Near, _MM_SHUFFLE(3, 3, 3, 2)));
+		const __m128 FarMin = _mm_min_ss(_mm_min_ss(Far, _mm_shuffle_ps(Far, Far, _MM_SHUFFLE(3, 3, 3, 1))),
+			_mm_shuffle_ps(Far, Far, _MM_SHUFFLE(3, 3, 3, 2)));
+
+		float TMin = _mm_cvtss_f32(NearMax);
+		const float TMax = _mm_cvtss_f32(FarMin);
+		if (TMin > TMax)
+		{
+			return false;
+		}
+
+		if (TMin < 0.0f)
+		{
+			TMin = TMax;
+		}
+		if (TMin < 0.0f)
+		{
+			return false;
+		}
+
+		if (OutDistance)
+		{
+			*OutDistance = TMin;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 미리 가공한 레이로 하는 분기 없는 슬랩 검사 (BVH 순회용)
+	 * 레이 부호로 가까운 면/먼 면을 고른 뒤 [0, InMaxDistance] 구간과 겹치는지만 본다
+	 * @param OutEnterDistance 박스에 들어가는 거리, 시작점이 박스 안이면 0
+	 */
+	FORCEINLINE bool IntersectRay(const FRayQuery& InQuery, float InMaxDistance, float& OutEnterDistance) const
+	{
+		const __m128 BoxMin = LoadMin();
+		const __m128 BoxMax = LoadMax();
+		const __m128 NearPlane = _mm_blendv_ps(BoxMin, BoxMax, InQuery.SignMask);
+		const __m128 FarPlane = _mm_blendv_ps(BoxMax, BoxMin, InQuery.SignMask);
+		const __m128 TNear = _mm_mul_ps(_mm_sub_ps(NearPlane, InQuery.Origin), InQuery.InvDirection);
+		const __m128 TFar = _mm_mul_ps(_mm_sub_ps(FarPlane, InQuery.Origin), InQuery.InvDirection);
+
+		// 누적값을 두 번째 피연산자로 두어 0 * inf로 생긴 NaN 레인은 무시된다
+		__m128 Enter = _mm_setzero_ps();
+		Enter = _mm_max_ss(TNear, Enter);
+		Enter = _mm_max_ss(_mm_shuffle_ps(TNear, TNear, _MM_SHUFFLE(1, 1, 1, 1)), Enter);
+		Enter = _mm_max_ss(_mm_movehl_ps(TNear, TNear), Enter);
+
+		__m128 Exit = _mm_set_ss(InMaxDistance);
+		Exit = _mm_min_ss(TFar, Exit);
+		Exit = _mm_min_ss(_mm_shuffle_ps(TFar, TFar, _MM_SHUFFLE(1, 1, 1, 1)), Exit);
+		Exit = _mm_min_ss(_mm_movehl_ps(TFar, TFar), Exit);
+
+		OutEnterDistance = _mm_cvtss_f32(Enter);
+		return _mm_comile_ss(Enter, Exit) != 0;
+	}
+};
+
+static_assert(sizeof(FBox) == 32, "FBox must stay two float4s");
+static_assert(std::is_trivially_copyable_v<FBox>, "FBox must be trivially copyable");
@@ -0,0 +1,28 @@
+#pragma once
+#include "Global/CoreTypes.h"
+
+#include <immintrin.h>
+
+/**
+ * @brief 슬랩 검사용으로 미리 가공해 둔 레이
+ * 원점, 역방향(1 / Direction), 방향 부호를 질의 시작 시 한 번만 계산해
+ * 박스마다 반복되던 재패킹과 나눗셈을 없앤다
+ * - 축과 평행한 성분은 역방향이 ±inf가 되며, 슬랩 밖이면 교차 구간이 비어 자연스럽게 걸러진다
+ */
+struct alignas(16) FRayQuery
+{
+	__m128 Origin;
+	__m128 InvDirection;
+	// 레인별 부호 비트가 켜져 있으면 해당 축 방향이 음수 (_mm_blendv_ps 마스크로 바로 쓴다)
+	__m128 SignMask;
+
+	explicit FRayQuery(const FRay& InRay)
+	{
+		const __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 Direction = _mm_and_ps(_mm_loadu_ps(&InRay.Direction.X), XYZMask);
+
+		Origin = _mm_and_ps(_mm_loadu_ps(&InRay.Origin.X), XYZMask);
+		InvDirection = _mm_div_ps(_mm_set1_ps(1.0f), Direction);
+		SignMask = _mm_and_ps(Direction, _mm_set1_ps(-0.0f));
+	}
+};
@@ -13,7 +13,7 @@ UFontRenderer::~UFontRenderer()
 }
 
 /// @brief 폰트 렌더러 초기화
-/// 셰이더 컴파일, 텍스처 로드, 버퍼 생성 등을 수행
+/// 셰이더 컴파일, 텍스처 로드, 버퍼와 렌더 스테이트 생성 등을 수행
 bool UFontRenderer::Initialize()
 {
     // 렌더러에서 Device와 DeviceContext 가져오기
@@ -55,8 +55,16 @@ bool UFontRenderer::Initialize()
         return false;
     }
 
-    // 간단한 테스트로 "HI" 문자만 렌더링하여 테스트
-    if (!CreateVertexBufferForText("HI", -30.0f, 0.0f, 30.0f, 30.0f))
+    // 렌더 스테이트 생성
+    if (!CreateRenderStates())
+    {
+        UE_LOG_ERROR("FontRenderer: 렌더 스테이트 생성 실패");
+        return false;
+    }
+
+    // 공용 정점 버퍼를 최소 용량으로 미리 만든다
+    bool bRecreated = false;
+    if (!EnsureVertexBufferCapacity(MIN_VERTEX_CAPACITY, bRecreated))
     {
         UE_LOG_ERROR("FontRenderer: 정점 버퍼 생성 실패");
         return false;
@@ -75,6 +83,7 @@ void UFontRenderer::Release()
         FontVertexBuffer->Release();
         FontVertexBuffer = nullptr;
     }
+    VertexCapacity = 0;
 
     if (FontConstantBuffer)
     {
@@ -82,6 +91,37 @@ void UFontRenderer::Release()
         FontConstantBuffer = nullptr;
     }
 
+    if (ViewProjConstantBuffer)
+    {
+        ViewProjConstantBuffer->Release();
+        ViewProjConstantBuffer = nullptr;
+    }
+
+    if (FontDataBuffer)
+    {
+        FontDataBuffer->Release();
+        FontDataBuffer = nullptr;
+    }
+
+    // 렌더 스테이트 해제
+    if (AlphaBlendState)
+    {
+        AlphaBlendState->Release();
+        AlphaBlendState = nullptr;
+    }
+
+    if (SolidRasterizerState)
+    {
+        SolidRasterizerState->Release();
+        SolidRasterizerState = nullptr;
+    }
+
+    if (DepthReadOnlyState)
+    {
+        DepthReadOnlyState->Release();
+        DepthReadOnlyState = nullptr;
+    }
+
     // 텍스처 및 샘플러 해제
     // if (FontAtlasTexture)
     // {
@@ -115,359 +155,171 @@ void UFontRenderer::Release()
     }
 }
 
-/// @brief Hello World 렌더링 (호환성을 위해 유지)
-/// @param WorldMatrix 월드 변환 행렬
-/// @param ViewProjectionMatrix 뷰-프로젝션 변환 행렬
-//void UFontRenderer::RenderHelloWorld(const FMatrix& WorldMatrix, const FMatrix& ViewProjectionMatrix)
-//{
-//    // "Hello, World!" 텍스트 렌더링
-//    RenderText("Hello, World!", WorldMatrix, ViewProjectionMatrix);
-//}
+/// @brief 프레임 시작
+/// 다음 업로드가 DISCARD로 새 메모리를 받도록 업로드 위치도 되돌린다
+void UFontRenderer::BeginFrame()
+{
+    TextBatcher.BeginFrame();
+    NumUploadedVertices = 0;
+}
 
-/// @brief 임의의 텍스트 렌더링
-void UFontRenderer::RenderText(const char* Text, const FMatrix& WorldMatrix, const FViewProjConstants& ViewProjectionCostants,
-	float CenterY, float StartZ, float CharWidth, float CharHeight)
+/// @brief 텍스트를 현재 뷰포트 배치에 추가
+void UFontRenderer::AddText(const char* Text, const FMatrix& WorldMatrix, float CenterY, float StartZ, float CharWidth, float CharHeight)
 {
-    if (!Text || strlen(Text) == 0)
+    FTextLayout Layout;
+    Layout.CenterY = CenterY;
+    Layout.StartZ = StartZ;
+    Layout.CharWidth = CharWidth;
+    Layout.CharHeight = CharHeight;
+
+    if (!TextBatcher.AddText(Text, WorldMatrix, Layout))
     {
         UE_LOG_WARNING("FontRenderer: 빈 텍스트 시도");
-        return;
     }
+}
 
-    // Renderer에서 Device와 DeviceContext 가져오기
-    URenderer& Renderer = URenderer::GetInstance();
-    ID3D11Device* Device = Renderer.GetDevice();
-    ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
-
-    if (!Device || !DeviceContext || !FontVertexShader || !FontPixelShader ||
-        !FontInputLayout || !FontAtlasTexture)
+/// @brief 현재 뷰포트 배치 렌더링
+/// 정점은 이미 월드 공간이므로 월드 행렬 슬롯은 단위 행렬 그대로 두고 뷰-프로젝션만 갱신한다
+/// 한 프레임의 뷰포트들은 공용 정점 버퍼의 뒤쪽에 NO_OVERWRITE로 이어 쓰므로 앞서 그린 구간을 건드리지 않는다
+void UFontRenderer::FlushText(const FViewProjConstants& ViewProjectionConstants)
+{
+    const FTextBatcher::FBatchRange Range = TextBatcher.EndBatch();
+    if (Range.NumVertices == 0)
     {
-        UE_LOG_ERROR("FontRenderer: 렌더링에 필요한 리소스가 null - Device:%p, Context:%p, VS:%p, PS:%p, Layout:%p, Tex:%p",
-            Device, DeviceContext, FontVertexShader, FontPixelShader, FontInputLayout, FontAtlasTexture);
         return;
     }
 
-    // 텍스트를 위한 새 정점 버퍼 생성
-    ID3D11Buffer* tempVertexBuffer = nullptr;
-    uint32 tempVertexCount = 0;
-
-    // 텍스트 길이 및 정점 개수 계산
-    size_t textLength = strlen(Text);
-    tempVertexCount = static_cast<uint32>(textLength * 6); // 각 문자당 6개 정점
-
-    // 정점 데이터 생성
-    TArray<FFontVertex> vertices;
-    vertices.reserve(tempVertexCount);
-
-	float StartY = CenterY - (textLength * CharWidth) / 2.0f;
-
-    // 각 문자에 대해 쿼드 생성
-    for (size_t i = 0; i < textLength; ++i)
-    {
-        char ch = Text[i];
-        uint32 asciiCode = static_cast<uint32>(ch);
-
-        // 간단한 쿼드 UV 좌표 (0~1 범위)
-        FVector2 uv_topLeft(0.0f, 0.0f);
-        FVector2 uv_topRight(1.0f, 0.0f);
-        FVector2 uv_bottomLeft(0.0f, 1.0f);
-        FVector2 uv_bottomRight(1.0f, 1.0f);
-
-        // 문자의 월드 좌표 계산
-        float y = StartY + i * CharWidth;
-        float z = StartZ;
-
-        // 쿼드의 4개 모서리 좌표
-        /*FVector topLeft(x, y + CharHeight, 0.0f);
-        FVector topRight(x + CharWidth, y + CharHeight, 0.0f);
-        FVector bottomLeft(x, y, 0.0f);
-        FVector bottomRight(x + CharWidth, y, 0.0f);*/
-
-		FVector topLeft(0.0f, y, z + CharHeight);
-		FVector topRight(0.0f, y + CharWidth, z + CharHeight);
-		FVector bottomLeft(0.0f, y, z);
-		FVector bottomRight(0.0f, y + CharWidth, z);
-
-        // 첫 번째 삼각형 (왼쪽 위, 오른쪽 위, 왼쪽 아래)
-        FFontVertex vertex1 = { topLeft, uv_topLeft, asciiCode };
-        FFontVertex vertex2 = { topRight, uv_topRight, asciiCode };
-        FFontVertex vertex3 = { bottomLeft, uv_bottomLeft, asciiCode };
-        vertices.push_back(vertex1);
-        vertices.push_back(vertex2);
-        vertices.push_back(vertex3);
-
-        // 두 번째 삼각형 (오른쪽 위, 오른쪽 아래, 왼쪽 아래)
-        FFontVertex vertex4 = { topRight, uv_topRight, asciiCode };
-        FFontVertex vertex5 = { bottomRight, uv_bottomRight, asciiCode };
-        FFontVertex vertex6 = { bottomLeft, uv_bottomLeft, asciiCode };
-        vertices.push_back(vertex4);
-        vertices.push_back(vertex5);
-        vertices.push_back(vertex6);
-    }
-
-    // 임시 정점 버퍼 생성
-    D3D11_BUFFER_DESC bufferDesc = {};
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = sizeof(FFontVertex) * tempVertexCount;
-    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    bufferDesc.CPUAccessFlags = 0;
-
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = vertices.data();
+    // Renderer에서 DeviceContext 가져오기
+    URenderer& Renderer = URenderer::GetInstance();
+    ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
 
-    HRESULT hr = Device->CreateBuffer(&bufferDesc, &initData, &tempVertexBuffer);
-    if (FAILED(hr))
+    if (!DeviceContext || !FontVertexShader || !FontPixelShader || !FontInputLayout || !FontAtlasTexture)
     {
-        UE_LOG_ERROR("FontRenderer: 임시 정점 버퍼 생성 실패 (HRESULT: 0x%08lX)", hr);
+        UE_LOG_ERROR("FontRenderer: 렌더링에 필요한 리소스가 null - Context:%p, VS:%p, PS:%p, Layout:%p, Tex:%p",
+            DeviceContext, FontVertexShader, FontPixelShader, FontInputLayout, FontAtlasTexture);
         return;
     }
 
-    // 1. 상수 버퍼 업데이트 (월드 행렬과 뷰-프로젝션 행렬)
-    struct WorldMatrixBuffer
-    {
-        FMatrix World;
-    } worldBuffer;
-    worldBuffer.World = WorldMatrix;
-
-    /*struct ViewProjectionBuffer
-    {
-        FMatrix ViewProjection;
-    } viewProjBuffer;
-    viewProjBuffer.ViewProjection = ViewProjectionMatrix;*/
-
-    // ViewProjection 상수 버퍼 생성 (슬롯 1)
-    ID3D11Buffer* viewProjConstantBuffer = nullptr;
-    D3D11_BUFFER_DESC viewProjBufferDesc = {};
-    viewProjBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    viewProjBufferDesc.ByteWidth = sizeof(ViewProjectionCostants);
-    viewProjBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    viewProjBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-    if (SUCCEEDED(Device->CreateBuffer(&viewProjBufferDesc, nullptr, &viewProjConstantBuffer)))
+    // 1. 이번 구간을 공용 정점 버퍼에 올린다
+    bool bRecreated = false;
+    if (!EnsureVertexBufferCapacity(TextBatcher.GetNumVertices(), bRecreated))
     {
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        if (SUCCEEDED(DeviceContext->Map(viewProjConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
-        {
-            memcpy(mappedResource.pData, &ViewProjectionCostants, sizeof(ViewProjectionCostants));
-            DeviceContext->Unmap(viewProjConstantBuffer, 0);
-        }
+        return;
     }
 
-    // 월드 매트릭스 상수 버퍼 업데이트 (슬롯 0)
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    if (SUCCEEDED(DeviceContext->Map(FontConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+    const D3D11_MAP MapType = (NumUploadedVertices == 0 || bRecreated) ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    if (FAILED(DeviceContext->Map(FontVertexBuffer, 0, MapType, 0, &MappedResource)))
     {
-        memcpy(mappedResource.pData, &worldBuffer, sizeof(worldBuffer));
-        DeviceContext->Unmap(FontConstantBuffer, 0);
+        UE_LOG_ERROR("FontRenderer: 정점 버퍼 Map 실패");
+        return;
     }
+    memcpy(static_cast<FFontVertex*>(MappedResource.pData) + Range.FirstVertex,
+           TextBatcher.GetVertices().data() + Range.FirstVertex, sizeof(FFontVertex) * Range.NumVertices);
+    DeviceContext->Unmap(FontVertexBuffer, 0);
+    NumUploadedVertices = Range.FirstVertex + Range.NumVertices;
 
-    // 폰트 데이터 상수 버퍼 생성 (슬롯 2)
-    ID3D11Buffer* fontDataBuffer = nullptr;
-    D3D11_BUFFER_DESC fontBufferDesc = {};
-    fontBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    fontBufferDesc.ByteWidth = sizeof(FFontConstantBuffer);
-    fontBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    fontBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-    if (SUCCEEDED(Device->CreateBuffer(&fontBufferDesc, nullptr, &fontDataBuffer)))
+    // 2. 뷰-프로젝션 상수 버퍼 업데이트 (슬롯 1)
+    if (SUCCEEDED(DeviceContext->Map(ViewProjConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource)))
     {
-        if (SUCCEEDED(DeviceContext->Map(fontDataBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
-        {
-            memcpy(mappedResource.pData, &ConstantBufferData, sizeof(ConstantBufferData));
-            DeviceContext->Unmap(fontDataBuffer, 0);
-        }
+        memcpy(MappedResource.pData, &ViewProjectionConstants, sizeof(ViewProjectionConstants));
+        DeviceContext->Unmap(ViewProjConstantBuffer, 0);
     }
 
-    // 2. 알파 블렌딩 활성화
-    ID3D11BlendState* prevBlendState = nullptr;
-    FLOAT prevBlendFactor[4];
-    UINT prevSampleMask;
-    DeviceContext->OMGetBlendState(&prevBlendState, prevBlendFactor, &prevSampleMask);
+    // 3. 알파 블렌딩 활성화
+    ID3D11BlendState* PrevBlendState = nullptr;
+    FLOAT PrevBlendFactor[4];
+    UINT PrevSampleMask;
+    DeviceContext->OMGetBlendState(&PrevBlendState, PrevBlendFactor, &PrevSampleMask);
 
-    ID3D11BlendState* alphaBlendState = nullptr;
-    D3D11_BLEND_DESC blendDesc = {};
-    blendDesc.RenderTarget[0].BlendEnable = TRUE;
-    blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
-    blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
-    blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
-    blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
-    blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
-    blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
-    blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+    FLOAT BlendFactor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    DeviceContext->OMSetBlendState(AlphaBlendState, BlendFactor, 0xFFFFFFFF);
 
-    if (SUCCEEDED(Device->CreateBlendState(&blendDesc, &alphaBlendState)))
-    {
-        FLOAT blendFactor[4] = {1.0f, 1.0f, 1.0f, 1.0f};
-        DeviceContext->OMSetBlendState(alphaBlendState, blendFactor, 0xFFFFFFFF);
-    }
-
-    // 3. 렌더링 파이프라인 설정
+    // 4. 렌더링 파이프라인 설정
     DeviceContext->IASetInputLayout(FontInputLayout);
 
-    UINT stride = sizeof(FFontVertex);
-    UINT offset = 0;
-    DeviceContext->IASetVertexBuffers(0, 1, &tempVertexBuffer, &stride, &offset);
-
+    UINT Stride = sizeof(FFontVertex);
+    UINT Offset = 0;
+    DeviceContext->IASetVertexBuffers(0, 1, &FontVertexBuffer, &Stride, &Offset);
     DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-	D3D11_RASTERIZER_DESC rasterDesc = {};
-	rasterDesc.FillMode = D3D11_FILL_SOLID;   // ← 와이어프레임 대신 Solid
-	rasterDesc.CullMode = D3D11_CULL_NONE;    // 보통은 Back-face culling
-	rasterDesc.FrontCounterClockwise = FALSE;
-	rasterDesc.DepthClipEnable = TRUE;
-
-	ID3D11RasterizerState* solidState = nullptr;
-	Device->CreateRasterizerState(&rasterDesc, &solidState);
-	DeviceContext->RSSetState(solidState);
+    DeviceContext->RSSetState(SolidRasterizerState);
+    DeviceContext->OMSetDepthStencilState(DepthReadOnlyState, 1);
 
-	D3D11_DEPTH_STENCIL_DESC dsDesc = {};
-	dsDesc.DepthEnable = TRUE;
-	dsDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
-	dsDesc.DepthFunc = D3D11_COMPARISON_LESS_EQUAL;
-
-	ID3D11DepthStencilState* depthDisabledState = nullptr;
-	Device->CreateDepthStencilState(&dsDesc, &depthDisabledState);
-	DeviceContext->OMSetDepthStencilState(depthDisabledState, 1);
-
-
-
-	//FRenderState RenderState = PrimitiveComponent->GetRenderState();
-
-	//// Get view mode from editor
-	//const EViewModeIndex ViewMode = ULevelManager::GetInstance().GetEditor()->GetViewMode();
-	//if (ViewMode == EViewModeIndex::VMI_Wireframe)
-	//{
-	//	RenderState.CullMode = ECullMode::None;
-	//	RenderState.FillMode = EFillMode::WireFrame;
-	//}
-	//ID3D11RasterizerState* LoadedRasterizerState = GetRasterizerState(RenderState);
-
-    // 4. 셰이더 설정
+    // 5. 셰이더 설정
     DeviceContext->VSSetShader(FontVertexShader, nullptr, 0);
     DeviceContext->PSSetShader(FontPixelShader, nullptr, 0);
 
-    // 5. 상수 버퍼 바인딩
+    // 6. 상수 버퍼 바인딩
     DeviceContext->VSSetConstantBuffers(0, 1, &FontConstantBuffer);
-    DeviceContext->VSSetConstantBuffers(1, 1, &viewProjConstantBuffer);
-    DeviceContext->VSSetConstantBuffers(2, 1, &fontDataBuffer);
+    DeviceContext->VSSetConstantBuffers(1, 1, &ViewProjConstantBuffer);
+    DeviceContext->VSSetConstantBuffers(2, 1, &FontDataBuffer);
 
-    // 6. 텍스처 및 샘플러 바인딩
+    // 7. 텍스처 및 샘플러 바인딩
     DeviceContext->PSSetShaderResources(0, 1, &FontAtlasTexture);
     DeviceContext->PSSetSamplers(0, 1, &FontSampler);
 
-    // 7. 드로우 콜
-    DeviceContext->Draw(tempVertexCount, 0);
-
-    // 8. 리소스 정리
-    DeviceContext->OMSetBlendState(prevBlendState, prevBlendFactor, prevSampleMask);
-    if (prevBlendState) prevBlendState->Release();
-    if (alphaBlendState) alphaBlendState->Release();
-    if (tempVertexBuffer) tempVertexBuffer->Release();
-    if (viewProjConstantBuffer) viewProjConstantBuffer->Release();
-    if (fontDataBuffer) fontDataBuffer->Release();
-	if (solidState) solidState->Release();
-	if (depthDisabledState) depthDisabledState->Release();
+    // 8. 드로우 콜 (뷰포트의 모든 텍스트)
+    DeviceContext->Draw(Range.NumVertices, Range.FirstVertex);
+
+    // 9. 블렌드 스테이트 복구
+    DeviceContext->OMSetBlendState(PrevBlendState, PrevBlendFactor, PrevSampleMask);
+    if (PrevBlendState) PrevBlendState->Release();
 }
 
-/// @brief 텍스트용 정점 버퍼 생성
-/// @param Text 렌더링할 텍스트
-/// @param StartX 시작 X 좌표
-/// @param StartY 시작 Y 좌표
-/// @param CharWidth 문자 너비
-/// @param CharHeight 문자 높이
-bool UFontRenderer::CreateVertexBufferForText(const char* Text, float StartX, float StartY, float CharWidth, float CharHeight)
+/// @brief 임의의 텍스트 렌더링
+void UFontRenderer::RenderText(const char* Text, const FMatrix& WorldMatrix, const FViewProjConstants& ViewProjectionCostants,
+	float CenterY, float StartZ, float CharWidth, float CharHeight)
 {
-    URenderer& Renderer = URenderer::GetInstance();
-    ID3D11Device* Device = Renderer.GetDevice();
+    TextBatcher.BeginBatch();
+    AddText(Text, WorldMatrix, CenterY, StartZ, CharWidth, CharHeight);
+    FlushText(ViewProjectionCostants);
+}
 
-    if (!Text || !Device)
+/// @brief 공용 동적 정점 버퍼 용량 확보
+/// 용량이 모자랄 때만 두 배로 키워 다시 만들고, 그 외에는 프레임마다 같은 버퍼를 Map으로 다시 쓴다
+bool UFontRenderer::EnsureVertexBufferCapacity(uint32 InNumVertices, bool& bOutRecreated)
+{
+    bOutRecreated = false;
+    if (FontVertexBuffer && InNumVertices <= VertexCapacity)
     {
-        return false;
+        return true;
     }
 
-    size_t TextLength = strlen(Text);
-    if (TextLength == 0)
+    URenderer& Renderer = URenderer::GetInstance();
+    ID3D11Device* Device = Renderer.GetDevice();
+    if (!Device)
     {
         return false;
     }
 
-    // 각 문자는 2개의 삼각형(6개의 정점)으로 구성된 쿼드
-    TArray<FFontVertex> vertices;
-    vertices.reserve(TextLength * 6);
-
-	const float AtlasCols = 16.0f;
-	const float AtlasRows = 16.0f;
-
-    // 각 문자에 대해 쿼드 생성
-	for (size_t i = 0; i < TextLength; ++i)
-	{
-		char ch = Text[i];
-		uint32 asciiCode = static_cast<uint32>(ch);
-
-		// ★★★ 간단한 쿼드 UV 좌표 (0~1 범위) ★★★
-		// 실제 UV 변환은 셰이더에서 처리
-		FVector2 uv_topLeft(0.0f, 0.0f);
-		FVector2 uv_topRight(1.0f, 0.0f);
-		FVector2 uv_bottomLeft(0.0f, 1.0f);
-		FVector2 uv_bottomRight(1.0f, 1.0f);
-
-		// 문자의 월드 좌표 계산
-		float x = StartX + i * CharWidth;
-		float y = StartY;
-
-		// 쿼드의 4개 모서리 좌표
-		FVector topLeft(x, y + CharHeight, 0.0f);
-		FVector topRight(x + CharWidth, y + CharHeight, 0.0f);
-		FVector bottomLeft(x, y, 0.0f);
-		FVector bottomRight(x + CharWidth, y, 0.0f);
-
-		// 첫 번째 삼각형 (왼쪽 위, 오른쪽 위, 왼쪽 아래) - 수정된 UV 적용
-		FFontVertex vertex1 = { topLeft, uv_topLeft, asciiCode };
-		FFontVertex vertex2 = { topRight, uv_topRight, asciiCode };
-		FFontVertex vertex3 = { bottomLeft, uv_bottomLeft, asciiCode };
-		vertices.push_back(vertex1);
-		vertices.push_back(vertex2);
-		vertices.push_back(vertex3);
-
-		// 두 번째 삼각형 (오른쪽 위, 오른쪽 아래, 왼쪽 아래) - 수정된 UV 적용
-		FFontVertex vertex4 = { topRight, uv_topRight, asciiCode };
-		FFontVertex vertex5 = { bottomRight, uv_bottomRight, asciiCode };
-		FFontVertex vertex6 = { bottomLeft, uv_bottomLeft, asciiCode };
-		vertices.push_back(vertex4);
-		vertices.push_back(vertex5);
-		vertices.push_back(vertex6);
-	}
-
-    VertexCount = static_cast<uint32>(vertices.size());
-
-    // 정점 버퍼 생성
-    D3D11_BUFFER_DESC bufferDesc = {};
-    bufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    bufferDesc.ByteWidth = sizeof(FFontVertex) * VertexCount;
-    bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    bufferDesc.CPUAccessFlags = 0;
+    const uint32 NewCapacity = std::max({ InNumVertices, VertexCapacity * 2, MIN_VERTEX_CAPACITY });
 
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = vertices.data();
+    D3D11_BUFFER_DESC BufferDesc = {};
+    BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    BufferDesc.ByteWidth = sizeof(FFontVertex) * NewCapacity;
+    BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-    HRESULT hr = Device->CreateBuffer(&bufferDesc, &initData, &FontVertexBuffer);
+    ID3D11Buffer* NewVertexBuffer = nullptr;
+    HRESULT hr = Device->CreateBuffer(&BufferDesc, nullptr, &NewVertexBuffer);
     if (FAILED(hr))
     {
-        UE_LOG_ERROR("FontRenderer: 정점 버퍼 생성 실패 (HRESULT: 0x%08lX)", hr);
+        UE_LOG_ERROR("FontRenderer: 정점 버퍼 생성 실패 (HRESULT: 0x%08lX, 정점 개수: %u)", hr, NewCapacity);
         return false;
     }
 
-    // 첫 번째 문자의 정점 데이터 디버그 출력
-    if (!vertices.empty())
+    if (FontVertexBuffer)
     {
-        const FFontVertex& firstVertex = vertices[0];
-        UE_LOG("FontRenderer Debug: 첫 번째 정점 - 위치: (%.2f, %.2f, %.2f), UV: (%.4f, %.4f), 문자: %c (%d)",
-            firstVertex.Position.X, firstVertex.Position.Y, firstVertex.Position.Z,
-            firstVertex.TexCoord.X, firstVertex.TexCoord.Y,
-            (char)firstVertex.CharIndex, firstVertex.CharIndex);
+        FontVertexBuffer->Release();
     }
 
-    UE_LOG_SUCCESS("FontRenderer: 정점 버퍼 생성 완료 ('%s', 정점 개수: %d)", Text, VertexCount);
+    FontVertexBuffer = NewVertexBuffer;
+    VertexCapacity = NewCapacity;
+    ++NumVertexBufferCreations;
+    bOutRecreated = true;
+
+    UE_LOG("FontRenderer: 정점 버퍼 용량 %u", VertexCapacity);
     return true;
 }
 
@@ -561,24 +413,108 @@ bool UFontRenderer::CreateSamplerState()
 }
 
 /// @brief 상수 버퍼 생성
+/// 월드 행렬(단위 행렬)과 폰트 데이터는 바뀌지 않으므로 초기값을 넣어 한 번만 만든다
 bool UFontRenderer::CreateConstantBuffer()
 {
     URenderer& Renderer = URenderer::GetInstance();
     ID3D11Device* Device = Renderer.GetDevice();
 
+    // 배치 정점은 이미 월드 공간이다
+    const FMatrix IdentityMatrix = FMatrix::Identity();
     D3D11_BUFFER_DESC bufferDesc = {};
-    bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    bufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
     bufferDesc.ByteWidth = sizeof(FMatrix);  // 월드 매트릭스용
     bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-    HRESULT hr = Device->CreateBuffer(&bufferDesc, nullptr, &FontConstantBuffer);
+    D3D11_SUBRESOURCE_DATA initData = {};
+    initData.pSysMem = &IdentityMatrix;
+
+    HRESULT hr = Device->CreateBuffer(&bufferDesc, &initData, &FontConstantBuffer);
     if (FAILED(hr))
     {
         UE_LOG_ERROR("FontRenderer: 상수 버퍼 생성 실패 (HRESULT: 0x%08lX)", hr);
         return false;
     }
 
+    // 뷰-프로젝션 상수 버퍼 (뷰포트마다 갱신)
+    D3D11_BUFFER_DESC viewProjBufferDesc = {};
+    viewProjBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    viewProjBufferDesc.ByteWidth = sizeof(FViewProjConstants);
+    viewProjBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    viewProjBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    hr = Device->CreateBuffer(&viewProjBufferDesc, nullptr, &ViewProjConstantBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG_ERROR("FontRenderer: 뷰-프로젝션 상수 버퍼 생성 실패 (HRESULT: 0x%08lX)", hr);
+        return false;
+    }
+
+    // 폰트 데이터 상수 버퍼
+    D3D11_BUFFER_DESC fontBufferDesc = {};
+    fontBufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    fontBufferDesc.ByteWidth = sizeof(FFontConstantBuffer);
+    fontBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+    D3D11_SUBRESOURCE_DATA fontInitData = {};
+    fontInitData.pSysMem = &ConstantBufferData;
+
+    hr = Device->CreateBuffer(&fontBufferDesc, &fontInitData, &FontDataBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG_ERROR("FontRenderer: 폰트 데이터 상수 버퍼 생성 실패 (HRESULT: 0x%08lX)", hr);
+        return false;
+    }
+
     UE_LOG_SUCCESS("FontRenderer: 상수 버퍼 생성 완료");
     return true;
 }
+
+/// @brief 렌더 스테이트 생성
+bool UFontRenderer::CreateRenderStates()
+{
+    URenderer& Renderer = URenderer::GetInstance();
+    ID3D11Device* Device = Renderer.GetDevice();
+
+    D3D11_BLEND_DESC blendDesc = {};
+    blendDesc.RenderTarget[0].BlendEnable = TRUE;
+    blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+    blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+    blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+    blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+    blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
+    blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+    blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+    if (FAILED(Device->CreateBlendState(&blendDesc, &AlphaBlendState)))
+    {
+        UE_LOG_ERROR("FontRenderer: 블렌드 스테이트 생성 실패");
+        return false;
+    }
+
+	D3D11_RASTERIZER_DESC rasterDesc = {};
+	rasterDesc.FillMode = D3D11_FILL_SOLID;   // ← 와이어프레임 대신 Solid
+	rasterDesc.CullMode = D3D11_CULL_NONE;    // 보통은 Back-face culling
+	rasterDesc.FrontCounterClockwise = FALSE;
+	rasterDesc.DepthClipEnable = TRUE;
+
+    if (FAILED(Device->CreateRasterizerState(&rasterDesc, &SolidRasterizerState)))
+    {
+        UE_LOG_ERROR("FontRenderer: 래스터라이저 스테이트 생성 실패");
+        return false;
+    }
+
+	D3D11_DEPTH_STENCIL_DESC dsDesc = {};
+	dsDesc.DepthEnable = TRUE;
+	dsDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
+	dsDesc.DepthFunc = D3D11_COMPARISON_LESS_EQUAL;
+
+    if (FAILED(Device->CreateDepthStencilState(&dsDesc, &DepthReadOnlyState)))
+    {
+        UE_LOG_ERROR("FontRenderer: 깊이 스텐실 스테이트 생성 실패");
+        return false;
+    }
+
+    UE_LOG_SUCCESS("FontRenderer: 렌더 스테이트 생성 완료");
+    return true;
+}
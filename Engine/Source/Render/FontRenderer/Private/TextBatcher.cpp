@@ -0,0 +1,166 @@
+#include "pch.h"
+#include "Render/FontRenderer/Public/TextBatcher.h"
+
+#include <immintrin.h>
+
+void FTextBatcher::BeginFrame()
+{
+	Vertices.clear();
+	BatchBegin = 0;
+	Stats = FStats();
+
+	++FrameCounter;
+	if (FrameCounter % CACHE_EVICT_FRAMES == 0)
+	{
+		EvictUnusedTexts();
+	}
+}
+
+void FTextBatcher::BeginBatch()
+{
+	BatchBegin = GetNumVertices();
+}
+
+bool FTextBatcher::AddText(const char* InText, const FMatrix& InWorldMatrix, const FTextLayout& InLayout)
+{
+	const size_t Length = InText ? strlen(InText) : 0;
+	if (Length == 0)
+	{
+		return false;
+	}
+
+	const FCachedText& CachedText = FindOrAddCachedText(InText, Length, InLayout);
+	const TArray<FFontVertex>& LocalVertices = CachedText.LocalVertices;
+
+	const size_t First = Vertices.size();
+	Vertices.resize(First + LocalVertices.size());
+
+	// 행 벡터 * 행렬 (ShaderFont.hlsl의 mul(float4(Position, 1), WorldMatrix)와 같다)
+	const __m128 Row0 = _mm_load_ps(InWorldMatrix.Data[0]);
+	const __m128 Row1 = _mm_load_ps(InWorldMatrix.Data[1]);
+	const __m128 Row2 = _mm_load_ps(InWorldMatrix.Data[2]);
+	const __m128 Row3 = _mm_load_ps(InWorldMatrix.Data[3]);
+
+	FFontVertex* Out = Vertices.data() + First;
+	for (const FFontVertex& Local : LocalVertices)
+	{
+		const __m128 Result = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Local.Position.X), Row0), _mm_mul_ps(_mm_set1_ps(Local.Position.Y), Row1)),
+			_mm_add_ps(_mm_mul_ps(_mm_set1_ps(Local.Position.Z), Row2), Row3));
+
+		// FVector도 alignas(16)이라 W 자리(패딩)까지 한 번에 쓴다
+		_mm_store_ps(&Out->Position.X, Result);
+		Out->TexCoord = Local.TexCoord;
+		Out->CharIndex = Local.CharIndex;
+		++Out;
+	}
+
+	++Stats.NumTexts;
+	Stats.NumVertices = GetNumVertices();
+	return true;
+}
+
+FTextBatcher::FBatchRange FTextBatcher::EndBatch()
+{
+	FBatchRange Range;
+	Range.FirstVertex = BatchBegin;
+	Range.NumVertices = GetNumVertices() - BatchBegin;
+	BatchBegin = GetNumVertices();
+	return Range;
+}
+
+void FTextBatcher::BuildLocalQuads(const char* InText, size_t InLength, const FTextLayout& InLayout, TArray<FFontVertex>& OutVertices)
+{
+	OutVertices.clear();
+	OutVertices.reserve(InLength * 6);
+
+	// 실제 아틀라스 UV 변환은 셰이더에서 문자 인덱스로 처리한다
+	const FVector2 UVTopLeft(0.0f, 0.0f);
+	const FVector2 UVTopRight(1.0f, 0.0f);
+	const FVector2 UVBottomLeft(0.0f, 1.0f);
+	const FVector2 UVBottomRight(1.0f, 1.0f);
+
+	const float StartY = InLayout.CenterY - (InLength * InLayout.CharWidth) / 2.0f;
+	const float Z = InLayout.StartZ;
+
+	for (size_t i = 0; i < InLength; ++i)
+	{
+		const uint32 AsciiCode = static_cast<uint32>(InText[i]);
+		const float Y = StartY + i * InLayout.CharWidth;
+
+		const FVector TopLeft(0.0f, Y, Z + InLayout.CharHeight);
+		const FVector TopRight(0.0f, Y + InLayout.CharWidth, Z + InLayout.CharHeight);
+		const FVector BottomLeft(0.0f, Y, Z);
+		const FVector BottomRight(0.0f, Y + InLayout.CharWidth, Z);
+
+		// 첫 번째 삼각형 (왼쪽 위, 오른쪽 위, 왼쪽 아래)
+		OutVertices.push_back({ TopLeft, UVTopLeft, AsciiCode });
+		OutVertices.push_back({ TopRight, UVTopRight, AsciiCode });
+		OutVertices.push_back({ BottomLeft, UVBottomLeft, AsciiCode });
+
+		// 두 번째 삼각형 (오른쪽 위, 오른쪽 아래, 왼쪽 아래)
+		OutVertices.push_back({ TopRight, UVTopRight, AsciiCode });
+		OutVertices.push_back({ BottomRight, UVBottomRight, AsciiCode });
+		OutVertices.push_back({ BottomLeft, UVBottomLeft, AsciiCode });
+	}
+}
+
+/**
+ * @brief FNV-1a 64비트 해시 (문자열 바이트 + 레이아웃 값)
+ */
+uint64 FTextBatcher::HashText(const char* InText, size_t InLength, const FTextLayout& InLayout)
+{
+	constexpr uint64 FNV_OFFSET = 14695981039346656037ull;
+	constexpr uint64 FNV_PRIME = 1099511628211ull;
+
+	uint64 Hash = FNV_OFFSET;
+	auto HashBytes = [&Hash](const void* InData, size_t InSize)
+	{
+		const uint8* Bytes = static_cast<const uint8*>(InData);
+		for (size_t i = 0; i < InSize; ++i)
+		{
+			Hash = (Hash ^ Bytes[i]) * FNV_PRIME;
+		}
+	};
+
+	HashBytes(InText, InLength);
+	HashBytes(&InLayout, sizeof(FTextLayout));
+	return Hash;
+}
+
+const FTextBatcher::FCachedText& FTextBatcher::FindOrAddCachedText(const char* InText, size_t InLength, const FTextLayout& InLayout)
+{
+	FCachedText& CachedText = Cache[HashText(InText, InLength, InLayout)];
+	CachedText.LastUsedFrame = FrameCounter;
+
+	// 해시가 충돌했을 수 있으므로 내용까지 비교한다, 다르면 그 자리에 다시 만든다
+	if (!CachedText.LocalVertices.empty() && CachedText.Layout == InLayout &&
+		CachedText.Text.size() == InLength && memcmp(CachedText.Text.data(), InText, InLength) == 0)
+	{
+		++Stats.NumCacheHits;
+		return CachedText;
+	}
+
+	++Stats.NumCacheMisses;
+	CachedText.Text.assign(InText, InLength);
+	CachedText.Layout = InLayout;
+	BuildLocalQuads(InText, InLength, InLayout, CachedText.LocalVertices);
+	return CachedText;
+}
+
+void FTextBatcher::EvictUnusedTexts()
+{
+	TArray<uint64> UnusedKeys;
+	for (const auto& [Key, CachedText] : Cache)
+	{
+		if (FrameCounter - CachedText.LastUsedFrame >= CACHE_EVICT_FRAMES)
+		{
+			UnusedKeys.push_back(Key);
+		}
+	}
+
+	for (uint64 Key : UnusedKeys)
+	{
+		Cache.erase(Key);
+	}
+}
@@ -1,18 +1,12 @@
 #pragma once
+#include "Render/FontRenderer/Public/TextBatcher.h"
 
 /// @brief 폰트 아틀라스를 사용한 텍스트 렌더링 클래스
 /// DejaVu Sans Mono.png 512x512 아틀라스에서 16x16 픽셀 글자를 렌더링
+/// 텍스트는 FTextBatcher에 월드 공간 쿼드로 모아 두었다가 뷰포트마다 드로우 한 번으로 그린다
 class UFontRenderer
 {
 public:
-    /// @brief 폰트 정점 구조체 - 위치, UV, 문자 인덱스 포함
-    struct FFontVertex
-    {
-        FVector Position;        // 3D 월드 좌표
-        FVector2 TexCoord;      // 쿼드 내 UV 좌표 (0~1)
-        uint32 CharIndex;       // ASCII 문자 코드
-    };
-
     /// @brief 폰트 데이터 상수 버퍼 구조체 (HLSL FontDataBuffer와 일치)
     struct FFontConstantBuffer
     {
@@ -26,36 +20,43 @@ public:
     UFontRenderer();
     ~UFontRenderer();
 
-    /// @brief 폰트 렌더러 초기화 - 셰이더, 텍스처, 버퍼 생성
+    /// @brief 폰트 렌더러 초기화 - 셰이더, 텍스처, 버퍼, 렌더 스테이트 생성
     bool Initialize();
 
     /// @brief 리소스 해제
     void Release();
 
-    /// @brief "Hello, World!" 텍스트를 화면에 렌더링 (호환성을 위해 유지)
-    /// @param WorldMatrix 월드 변환 행렬
-    /// @param ViewProjectionMatrix 뷰-프로젝션 변환 행렬
-    //void RenderHelloWorld(const FMatrix& WorldMatrix, const FMatrix& ViewProjectionMatrix);
+    /// @brief 프레임 시작 - 지난 프레임의 텍스트 배치를 비운다
+    void BeginFrame();
 
-    /// @brief 임의의 텍스트를 화면에 렌더링
+    /// @brief 텍스트를 현재 뷰포트 배치에 추가 (그리지는 않는다)
     /// @param Text 렌더링할 텍스트 문자열
     /// @param WorldMatrix 월드 변환 행렬
-    /// @param ViewProjectionMatrix 뷰-프로젝션 변환 행렬
     /// @param CenterY 중앙 Y 좌표 (모델 좌표계)
-    /// @param StartZ시작 Z 좌표 (모델 좌표계)
+    /// @param StartZ 시작 Z 좌표 (모델 좌표계)
     /// @param CharWidth 문자 너비
     /// @param CharHeight 문자 높이
+    void AddText(const char* Text, const FMatrix& WorldMatrix,
+                 float CenterY = 0.0f, float StartZ = -2.5f, float CharWidth = 1.0f, float CharHeight = 2.0f);
+
+    /// @brief 현재 뷰포트 배치를 공용 정점 버퍼에 올리고 드로우 한 번으로 그린다
+    /// @param ViewProjectionConstants 뷰-프로젝션 변환 행렬
+    void FlushText(const FViewProjConstants& ViewProjectionConstants);
+
+    /// @brief 임의의 텍스트 하나를 바로 렌더링 (AddText + FlushText)
     void RenderText(const char* Text, const FMatrix& WorldMatrix, const FViewProjConstants& ViewProjectionCostants,
                     float CenterY = 0.0f, float StartZ = -2.5f, float CharWidth = 1.0f, float CharHeight = 2.0f);
 
+    const FTextBatcher& GetBatcher() const { return TextBatcher; }
+
+    /// @brief 정점 버퍼를 새로 만든 횟수 (용량이 모자랄 때만 늘어난다)
+    uint32 GetNumVertexBufferCreations() const { return NumVertexBufferCreations; }
+
 private:
-    /// @brief 텍스트를 위한 정점 버퍼 생성
-    /// @param Text 렌더링할 텍스트 문자열
-    /// @param StartX 시작 X 좌표
-    /// @param StartY 시작 Y 좌표
-    /// @param CharWidth 문자 너비
-    /// @param CharHeight 문자 높이
-    bool CreateVertexBufferForText(const char* Text, float StartX, float StartY, float CharWidth, float CharHeight);
+    /// @brief 공용 동적 정점 버퍼 용량 확보, 모자라면 두 배로 키워 다시 만든다
+    /// @param InNumVertices 필요한 정점 수
+    /// @param bOutRecreated 버퍼를 새로 만들었으면 true
+    bool EnsureVertexBufferCapacity(uint32 InNumVertices, bool& bOutRecreated);
 
     /// @brief 셰이더 생성
     bool CreateShaders();
@@ -69,6 +70,12 @@ private:
     /// @brief 상수 버퍼 생성
     bool CreateConstantBuffer();
 
+    /// @brief 블렌드, 래스터라이저, 깊이 스텐실 스테이트 생성
+    bool CreateRenderStates();
+
+    // 정점 버퍼의 최소 용량 (글자 약 680개)
+    static constexpr uint32 MIN_VERTEX_CAPACITY = 4096;
+
     ID3D11VertexShader* FontVertexShader = nullptr;
     ID3D11PixelShader* FontPixelShader = nullptr;
     ID3D11InputLayout* FontInputLayout = nullptr;
@@ -77,9 +84,23 @@ private:
     ID3D11ShaderResourceView* FontAtlasTexture = nullptr;
     ID3D11SamplerState* FontSampler = nullptr;
 
+    /// @brief 렌더 스테이트 (초기화 때 한 번 만든다)
+    ID3D11BlendState* AlphaBlendState = nullptr;
+    ID3D11RasterizerState* SolidRasterizerState = nullptr;
+    ID3D11DepthStencilState* DepthReadOnlyState = nullptr;
+
+    /// @brief 프레임 동안 모든 뷰포트가 이어서 쓰는 공용 동적 정점 버퍼
     ID3D11Buffer* FontVertexBuffer = nullptr;
+    uint32 VertexCapacity = 0;
+    uint32 NumVertexBufferCreations = 0;
+    // 이번 프레임에 버퍼에 올린 정점 수, 0이면 다음 업로드는 DISCARD로 새 메모리를 받는다
+    uint32 NumUploadedVertices = 0;
+
+    /// @brief 상수 버퍼 (슬롯 0: 월드, 1: 뷰-프로젝션, 2: 폰트 데이터)
     ID3D11Buffer* FontConstantBuffer = nullptr;
+    ID3D11Buffer* ViewProjConstantBuffer = nullptr;
+    ID3D11Buffer* FontDataBuffer = nullptr;
 
-    uint32 VertexCount = 0;
     FFontConstantBuffer ConstantBufferData;
+    FTextBatcher TextBatcher;
 };
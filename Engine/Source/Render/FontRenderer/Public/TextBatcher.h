@@ -0,0 +1,100 @@
+#pragma once
+#include "Global/Matrix.h"
+#include "Global/Vector.h"
+
+/**
+ * @brief 폰트 정점 구조체 - 위치, UV, 문자 인덱스 포함
+ * FVector가 alignas(16)이라 TexCoord는 16, CharIndex는 24 바이트 오프셋 (ShaderFont.hlsl 입력 레이아웃과 일치)
+ */
+struct FFontVertex
+{
+	FVector Position;        // 3D 좌표
+	FVector2 TexCoord;       // 쿼드 내 UV 좌표 (0~1)
+	uint32 CharIndex;        // ASCII 문자 코드
+};
+
+/**
+ * @brief 모델 좌표계에서 한 줄 텍스트를 YZ 평면에 늘어놓는 방식
+ */
+struct FTextLayout
+{
+	float CenterY = 0.0f;    // 줄의 중앙 Y 좌표
+	float StartZ = -2.5f;    // 글자 아래쪽 Z 좌표
+	float CharWidth = 1.0f;
+	float CharHeight = 2.0f;
+
+	bool operator==(const FTextLayout& InOther) const
+	{
+		return CenterY == InOther.CenterY && StartZ == InOther.StartZ &&
+			CharWidth == InOther.CharWidth && CharHeight == InOther.CharHeight;
+	}
+};
+
+/**
+ * @brief 한 프레임의 텍스트 쿼드를 정점 배열 하나에 모으는 CPU 배처 (D3D에 의존하지 않는다)
+ *
+ * 문자열과 레이아웃이 같으면 모델 좌표계 쿼드를 내용 해시로 캐시해 두고, 매 프레임에는 월드 행렬만 곱해 이어 붙인다
+ * 월드 변환을 정점에 미리 적용하므로 라벨 수와 상관없이 뷰포트마다 드로우 한 번으로 그릴 수 있다
+ * 뷰포트 구간은 BeginBatch/EndBatch로 나누고, 한 프레임의 구간은 모두 같은 정점 배열에 이어서 쌓인다
+ */
+class FTextBatcher
+{
+public:
+	/** 한 뷰포트 구간이 차지하는 정점 범위 */
+	struct FBatchRange
+	{
+		uint32 FirstVertex = 0;
+		uint32 NumVertices = 0;
+	};
+
+	struct FStats
+	{
+		uint32 NumTexts = 0;
+		uint32 NumVertices = 0;
+		uint32 NumCacheHits = 0;
+		uint32 NumCacheMisses = 0;
+	};
+
+	/** 정점 배열과 통계를 비운다, 배열 용량은 다음 프레임에도 그대로 쓴다 */
+	void BeginFrame();
+
+	void BeginBatch();
+
+	/** 텍스트 하나의 쿼드를 월드 공간으로 옮겨 현재 구간에 붙인다, 빈 문자열이면 false */
+	bool AddText(const char* InText, const FMatrix& InWorldMatrix, const FTextLayout& InLayout = FTextLayout());
+
+	FBatchRange EndBatch();
+
+	const TArray<FFontVertex>& GetVertices() const { return Vertices; }
+	uint32 GetNumVertices() const { return static_cast<uint32>(Vertices.size()); }
+	const FStats& GetStats() const { return Stats; }
+	uint32 GetNumCachedTexts() const { return static_cast<uint32>(Cache.size()); }
+
+	/** 모델 좌표계 쿼드를 만든다 (글자당 삼각형 2개, 정점 6개) */
+	static void BuildLocalQuads(const char* InText, size_t InLength, const FTextLayout& InLayout, TArray<FFontVertex>& OutVertices);
+
+	// 이 프레임 수 동안 한 번도 쓰이지 않은 캐시 항목은 버린다
+	static constexpr uint64 CACHE_EVICT_FRAMES = 120;
+
+private:
+	struct FCachedText
+	{
+		FString Text;
+		FTextLayout Layout;
+		TArray<FFontVertex> LocalVertices;
+		uint64 LastUsedFrame = 0;
+	};
+
+	static uint64 HashText(const char* InText, size_t InLength, const FTextLayout& InLayout);
+	const FCachedText& FindOrAddCachedText(const char* InText, size_t InLength, const FTextLayout& InLayout);
+	void EvictUnusedTexts();
+
+	TArray<FFontVertex> Vertices;
+	uint32 BatchBegin = 0;
+
+	uint64 FrameCounter = 0;
+	FStats Stats;
+
+	// 문자열 + 레이아웃 해시 -> 모델 좌표계 쿼드
+	TMap<uint64, FCachedText> Cache;
+};
@@ -0,0 +1,306 @@
+#include "pch.h"
+#include "Render/Renderer/Public/D3D11RenderBackend.h"
+#include "Render/Renderer/Public/Pipeline.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Texture/Public/MaterialRenderProxy.h"
+
+FD3D11RenderBackend::FD3D11RenderBackend(URenderer& InRenderer, UPipeline& InPipeline, ID3D11Buffer* InConstantBufferModels,
+	ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw)
+	: Renderer(InRenderer)
+	, Pipeline(InPipeline)
+	, ConstantBufferModels(InConstantBufferModels)
+	, ConstantBufferColor(InConstantBufferColor)
+	, ConstantBufferMaterial(InConstantBufferMaterial)
+	, ConstantBufferMaterialDraw(InConstantBufferMaterialDraw)
+{
+}
+
+FD3D11RenderBackend::~FD3D11RenderBackend()
+{
+	Release();
+}
+
+void FD3D11RenderBackend::Release()
+{
+	ReleaseInstanceBuffer();
+
+	for (auto& Pair : MaterialBuffers)
+	{
+		if (Pair.second.Buffer)
+		{
+			Pair.second.Buffer->Release();
+		}
+	}
+	MaterialBuffers.clear();
+}
+
+void FD3D11RenderBackend::ReleaseInstanceBuffer()
+{
+	if (InstanceBuffer)
+	{
+		InstanceBuffer->Release();
+		InstanceBuffer = nullptr;
+	}
+	InstanceBufferCapacity = 0;
+}
+
+/**
+ * @brief 파괴된 재질(FMaterialRenderProxy)의 상수 버퍼를 해제한다
+ * Key는 UMaterial 주소라서 그대로 두면 버퍼가 계속 쌓이고, 같은 주소에 새 재질이 생겨도 이전 항목이 남는다
+ */
+void FD3D11RenderBackend::ReleaseDestroyedMaterials()
+{
+	ReleasedMaterialKeys.clear();
+	FMaterialRenderProxy::ConsumeReleasedKeys(ReleasedMaterialKeys);
+
+	for (const void* Key : ReleasedMaterialKeys)
+	{
+		auto Iter = MaterialBuffers.find(Key);
+		if (Iter == MaterialBuffers.end())
+		{
+			continue;
+		}
+
+		if (Iter->second.Buffer)
+		{
+			Iter->second.Buffer->Release();
+		}
+		MaterialBuffers.erase(Iter);
+	}
+}
+
+/**
+ * @brief 상수 버퍼 슬롯은 커맨드마다 바뀌지 않으므로 제출 시작 시 한 번만 바인딩한다
+ * 다른 패스(빌보드, 폰트 등)가 슬롯을 바꿨을 수 있으므로 바인딩 캐시도 여기서 비운다
+ */
+void FD3D11RenderBackend::BeginSubmit()
+{
+	ReleaseDestroyedMaterials();
+
+	Pipeline.SetConstantBuffer(0, true, ConstantBufferModels);
+	Pipeline.SetConstantBuffer(2, true, ConstantBufferColor);
+	Pipeline.SetConstantBuffer(3, false, ConstantBufferMaterialDraw);
+
+	BoundMaterialBuffer = nullptr;
+	for (uint32 Slot = 0; Slot < FDrawMaterialBinding::MAX_TEXTURE_SLOTS; ++Slot)
+	{
+		BoundShaderResources[Slot] = nullptr;
+		BoundSamplers[Slot] = nullptr;
+	}
+}
+
+void FD3D11RenderBackend::SetPipelineState(const FDrawPipelineState& InPipelineState, bool bInInstanced)
+{
+	FRenderHandle InputLayout = InPipelineState.InputLayout;
+	FRenderHandle VertexShader = InPipelineState.VertexShader;
+	FRenderHandle PixelShader = InPipelineState.PixelShader;
+
+	if (bInInstanced)
+	{
+		InputLayout = InPipelineState.InstancedInputLayout;
+		VertexShader = InPipelineState.InstancedVertexShader;
+		if (InPipelineState.InstancedPixelShader)
+		{
+			PixelShader = InPipelineState.InstancedPixelShader;
+		}
+	}
+
+	FPipelineInfo PipelineInfo = {
+		static_cast<ID3D11InputLayout*>(InputLayout),
+		static_cast<ID3D11VertexShader*>(VertexShader),
+		static_cast<ID3D11RasterizerState*>(InPipelineState.RasterizerState),
+		static_cast<ID3D11DepthStencilState*>(InPipelineState.DepthStencilState),
+		static_cast<ID3D11PixelShader*>(PixelShader),
+		static_cast<ID3D11BlendState*>(InPipelineState.BlendState),
+		static_cast<D3D11_PRIMITIVE_TOPOLOGY>(InPipelineState.Topology)
+	};
+	Pipeline.UpdatePipeline(PipelineInfo);
+}
+
+bool FD3D11RenderBackend::SetMaterial(const FDrawMaterialBinding& InMaterial)
+{
+	bool bUploaded = false;
+	ID3D11Buffer* MaterialBuffer = FindOrUpdateMaterialBuffer(InMaterial, bUploaded);
+
+	if (MaterialBuffer != BoundMaterialBuffer)
+	{
+		Pipeline.SetConstantBuffer(2, false, MaterialBuffer);
+		BoundMaterialBuffer = MaterialBuffer;
+	}
+
+	BindMaterialTextures(InMaterial);
+	return bUploaded;
+}
+
+void FD3D11RenderBackend::SetMaterialTime(float InTime)
+{
+	FMaterialDrawConstants DrawConstants;
+	DrawConstants.Time = InTime;
+	Renderer.UpdateConstant(Pipeline.GetDeviceContext(), ConstantBufferMaterialDraw, DrawConstants);
+}
+
+void FD3D11RenderBackend::SetGeometry(FRenderHandle InVertexBuffer, uint32 InStride, FRenderHandle InAttributeBuffer, uint32 InAttributeStride, FRenderHandle InIndexBuffer)
+{
+	Pipeline.SetVertexBuffer(static_cast<ID3D11Buffer*>(InVertexBuffer), InStride);
+	Pipeline.SetAttributeBuffer(static_cast<ID3D11Buffer*>(InAttributeBuffer), InAttributeStride);
+	if (InIndexBuffer)
+	{
+		Pipeline.SetIndexBuffer(static_cast<ID3D11Buffer*>(InIndexBuffer), 0);
+	}
+}
+
+void FD3D11RenderBackend::SetTransform(const FMatrix& InWorldMatrix)
+{
+	Renderer.UpdateConstant(Pipeline.GetDeviceContext(), ConstantBufferModels, InWorldMatrix);
+}
+
+void FD3D11RenderBackend::SetColor(const FVector4& InColor)
+{
+	Renderer.UpdateConstant(Pipeline.GetDeviceContext(), ConstantBufferColor, InColor);
+}
+
+void FD3D11RenderBackend::Draw(const FDrawCommand& InCommand)
+{
+	if (InCommand.IndexBuffer)
+	{
+		Pipeline.DrawIndexed(InCommand.IndexCount, InCommand.StartIndex, 0);
+	}
+	else
+	{
+		Pipeline.Draw(InCommand.VertexCount, 0);
+	}
+}
+
+/**
+ * @brief 프레임의 모든 인스턴스 데이터를 한 번의 Map으로 업로드하고 Slot 2에 바인딩한다
+ * @return 버퍼 생성이나 Map에 실패하면 false (Slot 2에는 이전 프레임 버퍼가 남아 있을 수 있다)
+ */
+bool FD3D11RenderBackend::SetInstanceData(const FInstanceData* InInstances, uint32 InNumInstances)
+{
+	if (!ReserveInstanceBuffer(InNumInstances))
+	{
+		return false;
+	}
+
+	ID3D11DeviceContext* DeviceContext = Pipeline.GetDeviceContext();
+	D3D11_MAPPED_SUBRESOURCE MappedSubResource = {};
+	HRESULT hr = DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedSubResource);
+	if (FAILED(hr))
+	{
+		UE_LOG_ERROR("Renderer: Instance buffer Map 실패 (HRESULT: 0x%08lX)", hr);
+		return false;
+	}
+	memcpy(MappedSubResource.pData, InInstances, sizeof(FInstanceData) * InNumInstances);
+	DeviceContext->Unmap(InstanceBuffer, 0);
+
+	Pipeline.SetInstanceBuffer(InstanceBuffer, sizeof(FInstanceData));
+	return true;
+}
+
+void FD3D11RenderBackend::DrawInstanced(const FDrawCommand& InCommand, uint32 InFirstInstance, uint32 InNumInstances)
+{
+	if (InCommand.IndexBuffer)
+	{
+		Pipeline.DrawIndexedInstanced(InCommand.IndexCount, InNumInstances, InCommand.StartIndex, InFirstInstance);
+	}
+	else
+	{
+		Pipeline.DrawInstanced(InCommand.VertexCount, InNumInstances, 0, InFirstInstance);
+	}
+}
+
+/**
+ * @brief 재질이 소유하는 상수 버퍼를 찾고, 재질이 바뀐 경우(Version 불일치)에만 다시 업로드한다
+ * Key가 없는 바인딩은 공용 동적 버퍼에 매번 업로드한다
+ */
+ID3D11Buffer* FD3D11RenderBackend::FindOrUpdateMaterialBuffer(const FDrawMaterialBinding& InMaterial, bool& bOutUploaded)
+{
+	bOutUploaded = false;
+
+	if (!InMaterial.Key)
+	{
+		Renderer.UpdateConstant(Pipeline.GetDeviceContext(), ConstantBufferMaterial, InMaterial.Constants);
+		bOutUploaded = true;
+		return ConstantBufferMaterial;
+	}
+
+	FMaterialBuffer& Entry = MaterialBuffers[InMaterial.Key];
+	if (!Entry.Buffer)
+	{
+		D3D11_BUFFER_DESC MaterialBufferDescription = {};
+		MaterialBufferDescription.ByteWidth = sizeof(FMaterialConstants) + 0xf & 0xfffffff0; // 16바이트 단위 정렬
+		MaterialBufferDescription.Usage = D3D11_USAGE_DEFAULT; // 재질이 바뀔 때만 갱신
+		MaterialBufferDescription.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+		HRESULT hr = Renderer.GetDevice()->CreateBuffer(&MaterialBufferDescription, nullptr, &Entry.Buffer);
+		if (FAILED(hr))
+		{
+			UE_LOG_ERROR("Renderer: Material constant buffer 생성 실패 (HRESULT: 0x%08lX)", hr);
+			MaterialBuffers.erase(InMaterial.Key);
+			Renderer.UpdateConstant(Pipeline.GetDeviceContext(), ConstantBufferMaterial, InMaterial.Constants);
+			bOutUploaded = true;
+			return ConstantBufferMaterial;
+		}
+		Entry.Version = 0;
+	}
+
+	if (Entry.Version != InMaterial.Version)
+	{
+		Pipeline.GetDeviceContext()->UpdateSubresource(Entry.Buffer, 0, nullptr, &InMaterial.Constants, 0, 0);
+		Entry.Version = InMaterial.Version;
+		bOutUploaded = true;
+	}
+
+	return Entry.Buffer;
+}
+
+void FD3D11RenderBackend::BindMaterialTextures(const FDrawMaterialBinding& InMaterial)
+{
+	for (uint32 Slot = 0; Slot < FDrawMaterialBinding::MAX_TEXTURE_SLOTS; ++Slot)
+	{
+		if (InMaterial.ShaderResources[Slot] && InMaterial.ShaderResources[Slot] != BoundShaderResources[Slot])
+		{
+			Pipeline.SetTexture(Slot, false, static_cast<ID3D11ShaderResourceView*>(InMaterial.ShaderResources[Slot]));
+			BoundShaderResources[Slot] = InMaterial.ShaderResources[Slot];
+		}
+
+		if (InMaterial.Samplers[Slot] && InMaterial.Samplers[Slot] != BoundSamplers[Slot])
+		{
+			Pipeline.SetSamplerState(Slot, false, static_cast<ID3D11SamplerState*>(InMaterial.Samplers[Slot]));
+			BoundSamplers[Slot] = InMaterial.Samplers[Slot];
+		}
+	}
+}
+
+bool FD3D11RenderBackend::ReserveInstanceBuffer(uint32 InNumInstances)
+{
+	if (InstanceBuffer && InNumInstances <= InstanceBufferCapacity)
+	{
+		return true;
+	}
+
+	uint32 NewCapacity = std::max(InstanceBufferCapacity * 2, 256u);
+	while (NewCapacity < InNumInstances)
+	{
+		NewCapacity *= 2;
+	}
+
+	ReleaseInstanceBuffer();
+
+	D3D11_BUFFER_DESC InstanceBufferDescription = {};
+	InstanceBufferDescription.ByteWidth = sizeof(FInstanceData) * NewCapacity;
+	InstanceBufferDescription.Usage = D3D11_USAGE_DYNAMIC;
+	InstanceBufferDescription.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	InstanceBufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	HRESULT hr = Renderer.GetDevice()->CreateBuffer(&InstanceBufferDescription, nullptr, &InstanceBuffer);
+	if (FAILED(hr))
+	{
+		UE_LOG_ERROR("Renderer: Instance buffer 생성 실패 (HRESULT: 0x%08lX)", hr);
+		InstanceBuffer = nullptr;
+		return false;
+	}
+
+	InstanceBufferCapacity = NewCapacity;
+	return true;
+}
@@ -0,0 +1,272 @@
+#include "pch.h"
+#include "Render/Renderer/Public/DebugDraw.h"
+
+std::mutex FDebugDraw::BufferMutex;
+TArray<std::unique_ptr<FDebugDraw::FThreadBuffer>> FDebugDraw::Buffers;
+
+std::mutex FDebugDraw::LayerMutex;
+TStaticArray<TArray<FDebugLineVertex>, static_cast<size_t>(EDebugDrawLayer::Count)> FDebugDraw::Layers;
+bool FDebugDraw::bLayersDirty = false;
+
+FDebugLineStream FDebugDraw::TransientVertices;
+TArray<FDebugLineVertex> FDebugDraw::PersistentVertices;
+uint64 FDebugDraw::PersistentVersion = 0;
+uint64 FDebugDraw::FrameNumber = 0;
+
+FDebugDraw::FThreadBuffer* FDebugDraw::CreateThreadBuffer()
+{
+	std::lock_guard<std::mutex> Lock(BufferMutex);
+	Buffers.push_back(std::make_unique<FThreadBuffer>());
+	return Buffers.back().get();
+}
+
+FDebugLineVertex* FDebugLineStream::Append(uint32 InNumVertices)
+{
+	const uint32 First = NumVertices;
+	NumVertices += InNumVertices;
+	if (NumVertices > Vertices.size())
+	{
+		Vertices.resize(std::max<size_t>(NumVertices, Vertices.size() * 2));
+	}
+	return Vertices.data() + First;
+}
+
+void FDebugDraw::DrawLine(const FVector& InStart, const FVector& InEnd, const FVector4& InColor)
+{
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+
+	FDebugLineVertex* Out = Buffer.Pending.Append(2);
+	Out[0] = { InStart, InColor };
+	Out[1] = { InEnd, InColor };
+}
+
+void FDebugDraw::DrawBox(const FAABB& InBox, const FVector4& InColor)
+{
+	const FVector& Min = InBox.Min;
+	const FVector& Max = InBox.Max;
+
+	// 비트 0: X, 1: Y, 2: Z (0이면 Min, 1이면 Max)
+	const FVector Corners[8] =
+	{
+		FVector(Min.X, Min.Y, Min.Z), FVector(Max.X, Min.Y, Min.Z),
+		FVector(Min.X, Max.Y, Min.Z), FVector(Max.X, Max.Y, Min.Z),
+		FVector(Min.X, Min.Y, Max.Z), FVector(Max.X, Min.Y, Max.Z),
+		FVector(Min.X, Max.Y, Max.Z), FVector(Max.X, Max.Y, Max.Z),
+	};
+
+	static constexpr uint8 Edges[12][2] =
+	{
+		{ 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },	// X 방향
+		{ 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },	// Y 방향
+		{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },	// Z 방향
+	};
+
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+
+	FDebugLineVertex* Out = Buffer.Pending.Append(24);
+	for (const auto& Edge : Edges)
+	{
+		*Out++ = { Corners[Edge[0]], InColor };
+		*Out++ = { Corners[Edge[1]], InColor };
+	}
+}
+
+void FDebugDraw::DrawSphere(const FVector& InCenter, float InRadius, const FVector4& InColor, uint32 InNumSegments)
+{
+	InNumSegments = std::max(InNumSegments, 4u);
+
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+
+	FDebugLineVertex* Out = Buffer.Pending.Append(InNumSegments * 6);
+
+	const float Step = 2.0f * PI / static_cast<float>(InNumSegments);
+	float PrevCos = 1.0f;
+	float PrevSin = 0.0f;
+	for (uint32 i = 1; i <= InNumSegments; ++i)
+	{
+		const float Cos = cosf(Step * i);
+		const float Sin = sinf(Step * i);
+
+		// XY, YZ, ZX 평면의 원
+		*Out++ = { InCenter + FVector(PrevCos, PrevSin, 0.0f) * InRadius, InColor };
+		*Out++ = { InCenter + FVector(Cos, Sin, 0.0f) * InRadius, InColor };
+		*Out++ = { InCenter + FVector(0.0f, PrevCos, PrevSin) * InRadius, InColor };
+		*Out++ = { InCenter + FVector(0.0f, Cos, Sin) * InRadius, InColor };
+		*Out++ = { InCenter + FVector(PrevSin, 0.0f, PrevCos) * InRadius, InColor };
+		*Out++ = { InCenter + FVector(Sin, 0.0f, Cos) * InRadius, InColor };
+
+		PrevCos = Cos;
+		PrevSin = Sin;
+	}
+}
+
+void FDebugDraw::DrawFrustum(const FMatrix& InViewProjectionInverse, const FVector4& InColor)
+{
+	// DrawBox와 같은 모서리 순서: 비트 0: X, 1: Y, 2: 깊이 (0이면 Near)
+	FAABB NDCBox(FVector(-1.0f, -1.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f));
+	FVector Corners[8];
+	for (uint32 i = 0; i < 8; ++i)
+	{
+		const FVector4 Clip(
+			(i & 1) ? NDCBox.Max.X : NDCBox.Min.X,
+			(i & 2) ? NDCBox.Max.Y : NDCBox.Min.Y,
+			(i & 4) ? NDCBox.Max.Z : NDCBox.Min.Z,
+			1.0f);
+		const FVector4 World = FMatrix::VectorMultiply(Clip, InViewProjectionInverse);
+		const float InvW = World.W != 0.0f ? 1.0f / World.W : 1.0f;
+		Corners[i] = FVector(World.X * InvW, World.Y * InvW, World.Z * InvW);
+	}
+
+	static constexpr uint8 Edges[12][2] =
+	{
+		{ 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+		{ 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+		{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },
+	};
+
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+
+	FDebugLineVertex* Out = Buffer.Pending.Append(24);
+	for (const auto& Edge : Edges)
+	{
+		*Out++ = { Corners[Edge[0]], InColor };
+		*Out++ = { Corners[Edge[1]], InColor };
+	}
+}
+
+void FDebugDraw::DrawRay(const FVector& InOrigin, const FVector& InDirection, float InLength, const FVector4& InColor)
+{
+	DrawLine(InOrigin, InOrigin + InDirection * InLength, InColor);
+}
+
+void FDebugDraw::DrawLines(const FDebugLineVertex* InVertices, uint32 InNumVertices)
+{
+	if (!InVertices || InNumVertices < 2)
+	{
+		return;
+	}
+
+	// 선이 끊기지 않게 짝이 없는 마지막 정점은 버린다
+	InNumVertices &= ~1u;
+
+	FThreadBuffer& Buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> Lock(Buffer.Mutex);
+
+	FDebugLineVertex* Out = Buffer.Pending.Append(InNumVertices);
+	std::copy(InVertices, InVertices + InNumVertices, Out);
+}
+
+void FDebugDraw::SetPersistentLayer(EDebugDrawLayer InLayer, TArray<FDebugLineVertex>&& InVertices)
+{
+	std::lock_guard<std::mutex> Lock(LayerMutex);
+	Layers[static_cast<size_t>(InLayer)] = std::move(InVertices);
+	bLayersDirty = true;
+}
+
+void FDebugDraw::ClearPersistentLayer(EDebugDrawLayer InLayer)
+{
+	std::lock_guard<std::mutex> Lock(LayerMutex);
+	TArray<FDebugLineVertex>& Layer = Layers[static_cast<size_t>(InLayer)];
+	if (Layer.empty())
+	{
+		return;
+	}
+
+	Layer.clear();
+	bLayersDirty = true;
+}
+
+void FDebugDraw::MergeFrame()
+{
+	// BufferMutex는 새 스레드가 처음 그릴 때만 잡으므로 합치는 동안 쥐고 있어도 된다
+	std::lock_guard<std::mutex> BuffersLock(BufferMutex);
+
+	// 스레드 버퍼는 잠깐만 잠그고 Pending을 Drained로 바꿔 가져간다, 복사는 스레드 버퍼 잠금 밖에서 한다
+	FThreadBuffer* OnlyFilledBuffer = nullptr;
+	uint32 NumFilledBuffers = 0;
+	for (const auto& Buffer : Buffers)
+	{
+		std::lock_guard<std::mutex> Lock(Buffer->Mutex);
+		Buffer->Drained.Reset();
+		std::swap(Buffer->Pending, Buffer->Drained);
+		if (Buffer->Drained.Num() > 0)
+		{
+			OnlyFilledBuffer = Buffer.get();
+			++NumFilledBuffers;
+		}
+	}
+
+	TransientVertices.Reset();
+	if (NumFilledBuffers == 1)
+	{
+		// 한 스레드만 그렸으면 복사 없이 배열을 통째로 바꾼다 (다음 프레임에 그 스레드가 지금 배열을 이어 쓴다)
+		std::swap(TransientVertices, OnlyFilledBuffer->Drained);
+	}
+	else
+	{
+		for (const auto& Buffer : Buffers)
+		{
+			const FDebugLineStream& Drained = Buffer->Drained;
+			std::copy(Drained.GetData(), Drained.GetData() + Drained.Num(), TransientVertices.Append(Drained.Num()));
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(LayerMutex);
+		if (bLayersDirty)
+		{
+			size_t NumPersistentVertices = 0;
+			for (const TArray<FDebugLineVertex>& Layer : Layers)
+			{
+				NumPersistentVertices += Layer.size();
+			}
+
+			PersistentVertices.clear();
+			PersistentVertices.reserve(NumPersistentVertices);
+			for (const TArray<FDebugLineVertex>& Layer : Layers)
+			{
+				PersistentVertices.insert(PersistentVertices.end(), Layer.begin(), Layer.end());
+			}
+
+			bLayersDirty = false;
+			++PersistentVersion;
+		}
+	}
+
+	++FrameNumber;
+}
+
+FRingBufferAllocator::FAllocation FRingBufferAllocator::Allocate(uint32 InNumElements)
+{
+	FAllocation Allocation;
+	// 새로 만든 버퍼의 첫 업로드도 DISCARD로 시작한다
+	Allocation.bDiscard = Offset == 0;
+
+	if (InNumElements > Capacity)
+	{
+		uint32 NewCapacity = std::max(Capacity, 1u);
+		while (NewCapacity < InNumElements)
+		{
+			NewCapacity *= 2;
+		}
+
+		Capacity = NewCapacity;
+		Offset = 0;
+		Allocation.bResized = true;
+		Allocation.bDiscard = true;
+	}
+	else if (Offset + InNumElements > Capacity)
+	{
+		Offset = 0;
+		++NumWraps;
+		Allocation.bDiscard = true;
+	}
+
+	Allocation.FirstElement = Offset;
+	Offset += InNumElements;
+	return Allocation;
+}
@@ -0,0 +1,430 @@
+#include "pch.h"
+#include "Render/Renderer/Public/DrawCommandList.h"
+#include "Render/Renderer/Public/RenderBackend.h"
+
+namespace
+{
+	constexpr uint32 PASS_BITS = 4;
+	constexpr uint32 PIPELINE_BITS = 12;
+	constexpr uint32 MATERIAL_BITS = 16;
+	constexpr uint32 MESH_BITS = 16;
+	constexpr uint32 DEPTH_BITS = 16;
+
+	constexpr uint64 FieldMask(uint32 InBits)
+	{
+		return (1ull << InBits) - 1ull;
+	}
+
+	static_assert(FDrawCommandList::MAX_SORT_PIPELINES == FieldMask(PIPELINE_BITS) + 1);
+	static_assert(FDrawCommandList::MAX_SORT_MATERIALS == FieldMask(MATERIAL_BITS));
+	static_assert(FDrawCommandList::MAX_SORT_MESHES == FieldMask(MESH_BITS) + 1);
+
+	/** 필드에 들어가지 않는 값을 잘라내지 않고 최대값으로 포화시킨다 (마스킹하면 작은 인덱스와 겹쳐 순서가 뒤섞인다) */
+	constexpr uint64 SaturateField(uint64 InValue, uint32 InBits)
+	{
+		return InValue < FieldMask(InBits) ? InValue : FieldMask(InBits);
+	}
+
+	bool IsSameColor(const FVector4& InA, const FVector4& InB)
+	{
+		return InA.X == InB.X && InA.Y == InB.Y && InA.Z == InB.Z && InA.W == InB.W;
+	}
+}
+
+/**
+ * @brief 다음 프레임 기록을 위해 리스트를 비운다 (할당된 용량은 유지)
+ */
+void FDrawCommandList::Reset()
+{
+	Commands.clear();
+	Pipelines.clear();
+	Materials.clear();
+	Transforms.clear();
+	MeshIndices.clear();
+	MaterialIndices.clear();
+	Batches.clear();
+	InstanceData.clear();
+}
+
+/**
+ * @brief 파이프라인 상태 테이블에서 동일한 상태를 찾고, 없으면 추가한다
+ * 프레임당 파이프라인 조합은 수 개 수준이라 선형 탐색으로 충분하다
+ */
+uint32 FDrawCommandList::FindOrAddPipeline(const FDrawPipelineState& InPipelineState)
+{
+	for (uint32 Index = 0; Index < static_cast<uint32>(Pipelines.size()); ++Index)
+	{
+		if (Pipelines[Index] == InPipelineState)
+		{
+			return Index;
+		}
+	}
+
+	assert(Pipelines.size() < MAX_SORT_PIPELINES && "Too many pipelines for the sort key");
+	Pipelines.push_back(InPipelineState);
+	return static_cast<uint32>(Pipelines.size() - 1);
+}
+
+/**
+ * @brief 메쉬 섹션 (Vertex Buffer, 시작 인덱스)에 대한 정렬용 인덱스를 반환한다
+ * LOD는 별도의 Vertex Buffer를 사용하므로 자연스럽게 다른 메쉬로 구분된다
+ */
+uint32 FDrawCommandList::FindOrAddMesh(FRenderHandle InVertexBuffer, uint32 InStartIndex)
+{
+	const TPair<FRenderHandle, uint32> Key(InVertexBuffer, InStartIndex);
+	auto Iter = MeshIndices.find(Key);
+	if (Iter != MeshIndices.end())
+	{
+		return Iter->second;
+	}
+
+	const uint32 NewIndex = static_cast<uint32>(MeshIndices.size());
+	assert(NewIndex < MAX_SORT_MESHES && "Too many meshes for the sort key");
+	MeshIndices.emplace(Key, NewIndex);
+	return NewIndex;
+}
+
+/**
+ * @brief 재질 바인딩을 테이블에 추가한다
+ * 같은 Key(UMaterial)는 프레임 동안 하나의 항목을 공유한다. Key가 없으면 항상 새 항목을 만든다
+ */
+uint32 FDrawCommandList::AddMaterial(const FDrawMaterialBinding& InBinding)
+{
+	if (InBinding.Key)
+	{
+		auto Iter = MaterialIndices.find(InBinding.Key);
+		if (Iter != MaterialIndices.end())
+		{
+			return Iter->second;
+		}
+	}
+
+	Materials.push_back(InBinding);
+	const uint32 NewIndex = static_cast<uint32>(Materials.size() - 1);
+	assert(NewIndex < MAX_SORT_MATERIALS && "Too many materials for the sort key");
+
+	if (InBinding.Key)
+	{
+		MaterialIndices.emplace(InBinding.Key, NewIndex);
+	}
+
+	return NewIndex;
+}
+
+uint32 FDrawCommandList::AddTransform(const FMatrix& InWorldMatrix)
+{
+	Transforms.push_back(InWorldMatrix);
+	return static_cast<uint32>(Transforms.size() - 1);
+}
+
+/**
+ * @brief 정렬 키를 계산해 커맨드를 기록한다
+ * @param InViewDepth 카메라 전방 기준 뷰 공간 깊이
+ * @param InMaxDepth 깊이 양자화에 사용할 최대 거리 (보통 카메라 FarZ)
+ */
+void FDrawCommandList::AddCommand(FDrawCommand& InCommand, EDrawPass InPass, float InViewDepth, float InMaxDepth)
+{
+	uint16 Depth = QuantizeDepth(InViewDepth, InMaxDepth);
+
+	// 반투명은 뒤에서 앞으로 그려야 하므로 깊이를 뒤집는다
+	if (InPass == EDrawPass::Translucent)
+	{
+		Depth = static_cast<uint16>(0xFFFF - Depth);
+	}
+
+	InCommand.SortKey = MakeSortKey(InPass, InCommand.PipelineIndex, InCommand.MaterialIndex, InCommand.MeshIndex, Depth);
+	Commands.push_back(InCommand);
+}
+
+uint64 FDrawCommandList::MakeSortKey(EDrawPass InPass, uint32 InPipelineIndex, uint32 InMaterialIndex, uint32 InMeshIndex, uint16 InDepth)
+{
+	const uint64 Pass = static_cast<uint64>(InPass) & FieldMask(PASS_BITS);
+	const uint64 Pipeline = SaturateField(InPipelineIndex, PIPELINE_BITS);
+	// 재질이 없는 커맨드(INVALID_INDEX)는 0으로 모아서 가장 먼저 그린다
+	const uint64 Material = InMaterialIndex == FDrawCommand::INVALID_INDEX ? 0 : SaturateField(static_cast<uint64>(InMaterialIndex) + 1, MATERIAL_BITS);
+	const uint64 Mesh = SaturateField(InMeshIndex, MESH_BITS);
+	const uint64 Depth = static_cast<uint64>(InDepth) & FieldMask(DEPTH_BITS);
+
+	constexpr uint32 PassShift = 64 - PASS_BITS;
+
+	if (InPass == EDrawPass::Translucent)
+	{
+		constexpr uint32 DepthShift = PassShift - DEPTH_BITS;
+		constexpr uint32 PipelineShift = DepthShift - PIPELINE_BITS;
+		constexpr uint32 MaterialShift = PipelineShift - MATERIAL_BITS;
+		constexpr uint32 MeshShift = MaterialShift - MESH_BITS;
+
+		return (Pass << PassShift) | (Depth << DepthShift) | (Pipeline << PipelineShift) |
+			(Material << MaterialShift) | (Mesh << MeshShift);
+	}
+
+	constexpr uint32 PipelineShift = PassShift - PIPELINE_BITS;
+	constexpr uint32 MaterialShift = PipelineShift - MATERIAL_BITS;
+	constexpr uint32 MeshShift = MaterialShift - MESH_BITS;
+
+	return (Pass << PassShift) | (Pipeline << PipelineShift) | (Material << MaterialShift) |
+		(Mesh << MeshShift) | Depth;
+}
+
+uint16 FDrawCommandList::QuantizeDepth(float InViewDepth, float InMaxDepth)
+{
+	if (InMaxDepth <= 0.0f || InViewDepth <= 0.0f)
+	{
+		return 0;
+	}
+
+	const float Normalized = std::min(InViewDepth / InMaxDepth, 1.0f);
+	return static_cast<uint16>(Normalized * 65535.0f);
+}
+
+/**
+ * @brief (Key, Index) 쌍에 대한 LSD 기수 정렬 (8-bit digit, 최대 8 pass)
+ * 모든 키가 같은 digit을 갖는 pass는 건너뛰므로 상위 비트가 대부분 비어있는 키에서 빠르다
+ * 안정 정렬이므로 키가 같은 커맨드는 기록 순서를 유지한다
+ */
+void FDrawCommandList::RadixSort(TArray<TPair<uint64, uint32>>& InOutEntries, TArray<TPair<uint64, uint32>>& InScratch)
+{
+	const size_t Count = InOutEntries.size();
+	if (Count < 2)
+	{
+		return;
+	}
+
+	InScratch.resize(Count);
+
+	TArray<TPair<uint64, uint32>>* Source = &InOutEntries;
+	TArray<TPair<uint64, uint32>>* Destination = &InScratch;
+
+	for (uint32 Shift = 0; Shift < 64; Shift += 8)
+	{
+		uint32 Histogram[256] = {};
+		for (const auto& Entry : *Source)
+		{
+			++Histogram[(Entry.first >> Shift) & 0xFF];
+		}
+
+		// 모든 원소가 한 버킷에 몰려 있으면 이 digit은 순서에 영향이 없다
+		if (Histogram[((*Source)[0].first >> Shift) & 0xFF] == Count)
+		{
+			continue;
+		}
+
+		uint32 Offset = 0;
+		for (uint32& Bucket : Histogram)
+		{
+			const uint32 BucketCount = Bucket;
+			Bucket = Offset;
+			Offset += BucketCount;
+		}
+
+		for (const auto& Entry : *Source)
+		{
+			(*Destination)[Histogram[(Entry.first >> Shift) & 0xFF]++] = Entry;
+		}
+
+		std::swap(Source, Destination);
+	}
+
+	if (Source != &InOutEntries)
+	{
+		InOutEntries.swap(*Source);
+	}
+}
+
+/**
+ * @brief 정렬 키 기준으로 커맨드를 재배치한다
+ */
+void FDrawCommandList::Sort()
+{
+	SortEntries.clear();
+	SortEntries.reserve(Commands.size());
+	for (uint32 Index = 0; Index < static_cast<uint32>(Commands.size()); ++Index)
+	{
+		SortEntries.emplace_back(Commands[Index].SortKey, Index);
+	}
+
+	RadixSort(SortEntries, SortScratch);
+
+	SortedCommands.clear();
+	SortedCommands.reserve(Commands.size());
+	for (const auto& Entry : SortEntries)
+	{
+		SortedCommands.push_back(Commands[Entry.second]);
+	}
+
+	Commands.swap(SortedCommands);
+}
+
+/**
+ * @brief 정렬된 커맨드를 드로우 배치로 묶고 인스턴스 스트림을 채운다
+ * 정렬 후 연속으로 놓인, 트랜스폼/색상 외 상태가 모두 같은 Opaque 커맨드를 하나의 배치로 합친다
+ * 반투명 커맨드는 깊이 순서를 지켜야 하므로 합치지 않는다
+ * @param bInEnableInstancing false면 모든 커맨드를 개별 드로우로 제출한다
+ */
+void FDrawCommandList::BuildBatches(bool bInEnableInstancing)
+{
+	Batches.clear();
+	InstanceData.clear();
+
+	const uint32 NumCommands = static_cast<uint32>(Commands.size());
+	uint32 Begin = 0;
+	while (Begin < NumCommands)
+	{
+		const FDrawCommand& First = Commands[Begin];
+		uint32 End = Begin + 1;
+
+		const bool bIsOpaque = (First.SortKey >> (64 - PASS_BITS)) == static_cast<uint64>(EDrawPass::Opaque);
+		if (bInEnableInstancing && bIsOpaque && Pipelines[First.PipelineIndex].SupportsInstancing())
+		{
+			while (End < NumCommands && First.CanInstanceWith(Commands[End]))
+			{
+				++End;
+			}
+		}
+
+		FDrawBatch Batch;
+		Batch.CommandIndex = Begin;
+		Batch.NumInstances = End - Begin;
+
+		if (Batch.NumInstances > 1)
+		{
+			Batch.FirstInstance = static_cast<uint32>(InstanceData.size());
+			for (uint32 Index = Begin; Index < End; ++Index)
+			{
+				FInstanceData Instance;
+				Instance.World = Transforms[Commands[Index].TransformIndex];
+				Instance.Color = Commands[Index].Color;
+				InstanceData.push_back(Instance);
+			}
+		}
+
+		Batches.push_back(Batch);
+		Begin = End;
+	}
+}
+
+/**
+ * @brief 배치 단위로 정렬된 커맨드를 백엔드로 재생한다
+ * 직전 커맨드와 다른 상태만 백엔드에 전달하고, 전달한 횟수를 통계로 남긴다
+ * @note BuildBatches 이후에 호출해야 한다
+ */
+void FDrawCommandList::Submit(IRenderBackend& InBackend, FDrawStats& OutStats) const
+{
+	OutStats.NumCommands += static_cast<uint32>(Commands.size());
+	if (Batches.empty())
+	{
+		return;
+	}
+
+	InBackend.BeginSubmit();
+
+	// 인스턴스 스트림을 올리지 못하면 Slot 2가 비어 있거나 지난 프레임 데이터이므로 인스턴싱 배치를 개별 드로우로 푼다
+	bool bInstancingAvailable = false;
+	if (!InstanceData.empty())
+	{
+		bInstancingAvailable = InBackend.SetInstanceData(InstanceData.data(), static_cast<uint32>(InstanceData.size()));
+		if (bInstancingAvailable)
+		{
+			++OutStats.NumBufferMaps;
+		}
+	}
+
+	uint32 CurrentPipeline = FDrawCommand::INVALID_INDEX;
+	bool bCurrentInstanced = false;
+	uint32 CurrentMaterial = FDrawCommand::INVALID_INDEX;
+	uint32 CurrentTransform = FDrawCommand::INVALID_INDEX;
+	FRenderHandle CurrentVertexBuffer = nullptr;
+	FRenderHandle CurrentAttributeBuffer = nullptr;
+	FRenderHandle CurrentIndexBuffer = nullptr;
+	uint32 CurrentStride = 0;
+	FVector4 CurrentColor;
+	bool bHasColor = false;
+	float CurrentMaterialTime = 0.0f;
+	bool bHasMaterialTime = false;
+
+	for (const FDrawBatch& Batch : Batches)
+	{
+		const FDrawCommand& Command = Commands[Batch.CommandIndex];
+		const bool bInstanced = Batch.NumInstances > 1 && bInstancingAvailable;
+
+		if (Command.PipelineIndex != CurrentPipeline || bInstanced != bCurrentInstanced)
+		{
+			InBackend.SetPipelineState(Pipelines[Command.PipelineIndex], bInstanced);
+			CurrentPipeline = Command.PipelineIndex;
+			bCurrentInstanced = bInstanced;
+			++OutStats.NumPipelineChanges;
+		}
+
+		if (Command.MaterialIndex != FDrawCommand::INVALID_INDEX)
+		{
+			if (Command.MaterialIndex != CurrentMaterial)
+			{
+				// 백엔드가 캐시한 재질 상수가 최신이면 바인딩만 바뀌고 업로드는 일어나지 않는다
+				if (InBackend.SetMaterial(Materials[Command.MaterialIndex]))
+				{
+					++OutStats.NumBufferMaps;
+				}
+				CurrentMaterial = Command.MaterialIndex;
+				++OutStats.NumMaterialChanges;
+			}
+
+			if (!bHasMaterialTime || Command.MaterialTime != CurrentMaterialTime)
+			{
+				InBackend.SetMaterialTime(Command.MaterialTime);
+				CurrentMaterialTime = Command.MaterialTime;
+				bHasMaterialTime = true;
+				++OutStats.NumConstantUpdates;
+				++OutStats.NumBufferMaps;
+			}
+		}
+
+		if (Command.VertexBuffer != CurrentVertexBuffer || Command.IndexBuffer != CurrentIndexBuffer ||
+			Command.VertexStride != CurrentStride || Command.AttributeBuffer != CurrentAttributeBuffer)
+		{
+			InBackend.SetGeometry(Command.VertexBuffer, Command.VertexStride, Command.AttributeBuffer, Command.AttributeStride, Command.IndexBuffer);
+			CurrentVertexBuffer = Command.VertexBuffer;
+			CurrentAttributeBuffer = Command.AttributeBuffer;
+			CurrentIndexBuffer = Command.IndexBuffer;
+			CurrentStride = Command.VertexStride;
+			++OutStats.NumGeometryChanges;
+		}
+
+		if (bInstanced)
+		{
+			InBackend.DrawInstanced(Command, Batch.FirstInstance, Batch.NumInstances);
+			++OutStats.NumDrawCalls;
+			++OutStats.NumInstancedDraws;
+			OutStats.NumInstances += Batch.NumInstances;
+			continue;
+		}
+
+		// 배치의 커맨드는 트랜스폼/색상만 다르므로 나머지 상태는 위에서 한 번만 설정하면 된다
+		for (uint32 Index = Batch.CommandIndex; Index < Batch.CommandIndex + Batch.NumInstances; ++Index)
+		{
+			const FDrawCommand& BatchCommand = Commands[Index];
+
+			if (BatchCommand.TransformIndex != CurrentTransform)
+			{
+				InBackend.SetTransform(Transforms[BatchCommand.TransformIndex]);
+				CurrentTransform = BatchCommand.TransformIndex;
+				++OutStats.NumConstantUpdates;
+				++OutStats.NumBufferMaps;
+			}
+
+			if (BatchCommand.bUseColor && (!bHasColor || !IsSameColor(BatchCommand.Color, CurrentColor)))
+			{
+				InBackend.SetColor(BatchCommand.Color);
+				CurrentColor = BatchCommand.Color;
+				bHasColor = true;
+				++OutStats.NumConstantUpdates;
+				++OutStats.NumBufferMaps;
+			}
+
+			InBackend.Draw(BatchCommand);
+			++OutStats.NumDrawCalls;
+			++OutStats.NumInstances;
+		}
+	}
+
+	InBackend.EndSubmit();
+}
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "Render/Renderer/Public/NullRenderBackend.h"
+#include "Texture/Public/MaterialRenderProxy.h"
+
+void FNullRenderBackend::BeginSubmit()
+{
+	ReleasedMaterialKeys.clear();
+	FMaterialRenderProxy::ConsumeReleasedKeys(ReleasedMaterialKeys);
+	for (const void* Key : ReleasedMaterialKeys)
+	{
+		UploadedMaterialVersions.erase(Key);
+	}
+}
+
+void FNullRenderBackend::SetPipelineState(const FDrawPipelineState& InPipelineState, bool bInInstanced)
+{
+	Record(ECall::SetPipelineState);
+}
+
+bool FNullRenderBackend::SetMaterial(const FDrawMaterialBinding& InMaterial)
+{
+	Record(ECall::SetMaterial);
+
+	if (InMaterial.Key)
+	{
+		auto Iter = UploadedMaterialVersions.find(InMaterial.Key);
+		if (Iter != UploadedMaterialVersions.end() && Iter->second == InMaterial.Version)
+		{
+			return false;
+		}
+		UploadedMaterialVersions[InMaterial.Key] = InMaterial.Version;
+	}
+
+	++NumMaterialUploads;
+	return true;
+}
+
+void FNullRenderBackend::SetMaterialTime(float InTime)
+{
+	Record(ECall::SetMaterialTime);
+}
+
+void FNullRenderBackend::SetGeometry(FRenderHandle InVertexBuffer, uint32 InStride, FRenderHandle InAttributeBuffer, uint32 InAttributeStride, FRenderHandle InIndexBuffer)
+{
+	Record(ECall::SetGeometry);
+}
+
+void FNullRenderBackend::SetTransform(const FMatrix& InWorldMatrix)
+{
+	Record(ECall::SetTransform);
+}
+
+void FNullRenderBackend::SetColor(const FVector4& InColor)
+{
+	Record(ECall::SetColor);
+}
+
+void FNullRenderBackend::Draw(const FDrawCommand& InCommand)
+{
+	Record(ECall::Draw);
+	++NumDrawnInstances;
+
+	if (bRecordCalls)
+	{
+		RecordedSortKeys.push_back(InCommand.SortKey);
+	}
+}
+
+bool FNullRenderBackend::SetInstanceData(const FInstanceData* InInstances, uint32 InNumInstances)
+{
+	Record(ECall::SetInstanceData);
+
+	if (bFailInstanceUploads)
+	{
+		return false;
+	}
+
+	if (bRecordCalls)
+	{
+		UploadedInstances.assign(InInstances, InInstances + InNumInstances);
+	}
+	return true;
+}
+
+void FNullRenderBackend::DrawInstanced(const FDrawCommand& InCommand, uint32 InFirstInstance, uint32 InNumInstances)
+{
+	Record(ECall::DrawInstanced);
+	NumDrawnInstances += InNumInstances;
+
+	if (bRecordCalls)
+	{
+		RecordedSortKeys.push_back(InCommand.SortKey);
+	}
+}
+
+void FNullRenderBackend::Reset()
+{
+	for (uint32& Count : CallCounts)
+	{
+		Count = 0;
+	}
+	RecordedCalls.clear();
+	RecordedSortKeys.clear();
+	UploadedInstances.clear();
+	NumDrawnInstances = 0;
+	UploadedMaterialVersions.clear();
+	NumMaterialUploads = 0;
+}
+
+void FNullRenderBackend::Record(ECall InCall)
+{
+	++CallCounts[static_cast<uint8>(InCall)];
+
+	if (bRecordCalls)
+	{
+		RecordedCalls.push_back(InCall);
+	}
+}
@@ -1,19 +1,24 @@
 #include "pch.h"
 
-#include "cpp-thread-pool/thread_pool.h"
-
 #include "Global/CoreTypes.h"
 #include "Level/Public/Level.h"
 #include "Editor/Public/EditorEngine.h"
 #include "Render/Renderer/Public/OcclusionRenderer.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/Camera.h"
+#include "Core/Public/ScopeCycleCounter.h"
+#include "Core/Public/JobSystem.h"
+#include "Manager/Transform/Public/TransformManager.h"
 
 #include <d3dcompiler.h>
 #pragma comment(lib, "d3dcompiler")
 
 #define MULTI_THREADING
 
+DECLARE_CYCLE_STAT("Occlusion Bounding Volumes", STAT_OcclusionBoundingVolumes, Occlusion)
+DECLARE_CYCLE_STAT("Occlusion Rasterize Rows", STAT_OcclusionRasterizeRows, Occlusion)
+DECLARE_CYCLE_STAT("Occlusion Test Chunk", STAT_OcclusionTestChunk, Occlusion)
+
 IMPLEMENT_SINGLETON_CLASS_BASE(UOcclusionRenderer)
 
 UOcclusionRenderer::UOcclusionRenderer() = default;
@@ -41,6 +46,7 @@ void UOcclusionRenderer::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext*
 
 	CreateShader(Device);
 	CreateHiZResource(Device);
+	ResizeSoftwareOcclusionBuffer();
 }
 
 void UOcclusionRenderer::Release()
@@ -66,37 +72,21 @@ void UOcclusionRenderer::BuildScreenSpaceBoundingVolumes(
 	BoundingVolumes.clear();
 	BoundingVolumes.resize(PrimitiveComponents.size());
 
-	PrimitiveComponentUUIDs.clear();
-	PrimitiveComponentUUIDs.resize(PrimitiveComponents.size());
+	PrimitiveSceneSlots.clear();
+	PrimitiveSceneSlots.resize(PrimitiveComponents.size(), UPrimitiveComponent::INVALID_SCENE_SLOT);
 
 	FViewProjConstants ViewProj = InCamera->GetFViewProjConstants();
 	FMatrix ViewProjMatrix = ViewProj.View * ViewProj.Projection;
 
-#ifdef MULTI_THREADING
-	static ThreadPool Pool(NUM_WORKER_THREADS); // Initialize thread pool once
-
-	const size_t NumPrimitives = PrimitiveComponents.size();
-	const size_t ChunkSize = (NumPrimitives + NUM_WORKER_THREADS - 1) / NUM_WORKER_THREADS;
-
-	std::vector<std::future<void>> Futures;
-	for (size_t i = 0; i < NUM_WORKER_THREADS; ++i)
-	{
-		const size_t StartIndex = i * ChunkSize;
-		const size_t EndIndex = std::min(StartIndex + ChunkSize, NumPrimitives);
-
-		if (StartIndex >= EndIndex) continue;
-
-		Futures.emplace_back(Pool.Enqueue([this, StartIndex, EndIndex, &PrimitiveComponents, ViewProjMatrix]()
-		{
-			ProcessBoundingVolume(StartIndex, EndIndex, PrimitiveComponents, ViewProjMatrix);
-		}));
-	}
+	// 워커는 캐시된 월드 바운드를 읽기만 하도록 dirty 구간을 먼저 갱신해 둔다
+	UTransformManager::GetInstance().Update();
 
-	for (auto& Future : Futures)
+#ifdef MULTI_THREADING
+	FJobSystem::ParallelFor(static_cast<uint32>(PrimitiveComponents.size()), [this, &PrimitiveComponents, &ViewProjMatrix](uint32 StartIndex, uint32 EndIndex)
 	{
-		Future.get(); // Wait for all tasks to complete
-	}
-
+		SCOPE_CYCLE_COUNTER(STAT_OcclusionBoundingVolumes);
+		ProcessBoundingVolume(StartIndex, EndIndex, PrimitiveComponents, ViewProjMatrix);
+	}, BOUNDING_VOLUME_BATCH_SIZE);
 #else // Single-threaded version
 	ProcessBoundingVolume(0, PrimitiveComponents.size(), PrimitiveComponents, ViewProjMatrix);
 #endif
@@ -112,11 +102,12 @@ void UOcclusionRenderer::ProcessBoundingVolume(size_t InStartIndex, size_t InEnd
 			BoundingVolumes[i] = { FVector4(0, 0, 0, 0), FVector4(0, 0, 0, 0) };
 			continue;
 		}
-		PrimitiveComponentUUIDs[i] = InPrimitiveComponents[i]->GetUUID();
+		PrimitiveSceneSlots[i] = InPrimitiveComponents[i]->GetSceneSlot();
 
-		// --- (1) 월드 공간 AABB 가져오기 ---
-		FVector WorldMin, WorldMax;
-		Primitive->GetWorldAABB(WorldMin, WorldMax);
+		// --- (1) 월드 공간 AABB 가져오기 (계층이 갱신해 둔 캐시) ---
+		const FBox WorldBounds = Primitive->GetWorldBounds();
+		const FVector WorldMin = WorldBounds.GetMin();
+		const FVector WorldMax = WorldBounds.GetMax();
 
 		// --- (2) 8개 코너 생성 ---
 		FVector corners[8] = {
@@ -135,6 +126,7 @@ void UOcclusionRenderer::ProcessBoundingVolume(size_t InStartIndex, size_t InEnd
 		FVector4 ClipMax(-FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX);
 
 		// --- (4) 각 코너 변환 후 Min/Max 업데이트 ---
+		bool bCrossesNearPlane = false;
 		for (int j = 0; j < 8; ++j)
 		{
 			FVector4 clipPos = FMatrix::VectorMultiply(
@@ -142,7 +134,11 @@ void UOcclusionRenderer::ProcessBoundingVolume(size_t InStartIndex, size_t InEnd
 				InViewProjMatrix
 			);
 
-			if (clipPos.W <= 0.0f) continue; // Discard points behind or on the projection plane
+			if (clipPos.W <= 0.0f) // Discard points behind or on the projection plane
+			{
+				bCrossesNearPlane = true;
+				continue;
+			}
 
 			FVector4 ndcPos(
 				clipPos.X / clipPos.W,
@@ -166,6 +162,14 @@ void UOcclusionRenderer::ProcessBoundingVolume(size_t InStartIndex, size_t InEnd
 			ClipMax.Z = std::max(ClipMax.Z, ndcPos.Z);
 			ClipMax.W = std::max(ClipMax.W, ndcPos.W);
 		}
+		// 카메라 뒤로 넘어간 코너가 있으면 남은 코너만으로는 화면 영역을 알 수 없으므로
+		// 화면 전체 + 가장 가까운 깊이로 잡아 절대 가려지지 않게 한다
+		if (bCrossesNearPlane)
+		{
+			ClipMin = FVector4(-1.0f, -1.0f, 0.0f, 1.0f);
+			ClipMax = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+		}
+
 		// --- (5) 결과 저장 ---
 		BoundingVolumes[i] = { ClipMin, ClipMax };
 	}
@@ -374,9 +378,12 @@ void UOcclusionRenderer::OcclusionTest(ID3D11Device* InDevice, ID3D11DeviceConte
 		uint32 CulledObjectCount = 0;
 		for (size_t i = 0; i < BoundingVolumes.size(); ++i)
 		{
-			auto& history = VisibilityHistory[PrimitiveComponentUUIDs[i]];
-			history <<= 1;
-			history |= (flags[i] == 1 ? 1u : 0u);
+			const uint32 SceneSlot = PrimitiveSceneSlots[i];
+			if (SceneSlot < VisibilityHistory.size())
+			{
+				uint8& History = VisibilityHistory[SceneSlot];
+				History = static_cast<uint8>(((History << 1) | (flags[i] == 1 ? 1u : 0u)) & OCCLUSION_HISTORY_MASK);
+			}
 			if (flags[i] == 0)
 			{
 				CulledObjectCount++;
@@ -397,6 +404,226 @@ void UOcclusionRenderer::OcclusionTest(ID3D11Device* InDevice, ID3D11DeviceConte
 	if (BVBuffer) BVBuffer->Release();
 }
 
+void UOcclusionRenderer::SetBackend(EOcclusionBackend InBackend)
+{
+	if (Backend == InBackend)
+	{
+		return;
+	}
+
+	// 다른 방식의 이력이 섞이지 않도록 초기화한다
+	Backend = InBackend;
+	std::fill(VisibilityHistory.begin(), VisibilityHistory.end(), OCCLUSION_HISTORY_MASK);
+}
+
+void UOcclusionRenderer::ResizeSoftwareOcclusionBuffer()
+{
+	// 화면 비율을 유지하는 저해상도 버퍼
+	uint32 BufferWidth = FSoftwareOcclusionBuffer::DEFAULT_WIDTH;
+	uint32 BufferHeight = FSoftwareOcclusionBuffer::DEFAULT_HEIGHT;
+	if (Width > 0 && Height > 0)
+	{
+		BufferHeight = std::max(1u, static_cast<uint32>(static_cast<uint64>(BufferWidth) * Height / Width));
+	}
+	SoftwareOcclusionBuffer.Resize(BufferWidth, BufferHeight);
+}
+
+/**
+ * @brief 화면에서 크게 보이는 프리미티브를 오클루더로 골라 클립 공간 삼각형을 버퍼에 넣는다
+ * 화면 면적이 큰 순서로 최대 MAX_SOFTWARE_OCCLUDERS개, 전체 삼각형 예산 안에서만 사용한다
+ */
+void UOcclusionRenderer::AddSoftwareOccluders(const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents, const FMatrix& InViewProjMatrix)
+{
+	TArray<TPair<float, size_t>> Candidates;
+	for (size_t i = 0; i < InPrimitiveComponents.size(); ++i)
+	{
+		const auto& Primitive = InPrimitiveComponents[i];
+		if (!Primitive || Primitive->GetTopology() != D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST)
+		{
+			continue;
+		}
+
+		const TArray<FMeshPosition>* Positions = Primitive->GetPositionsData();
+		if (!Positions || Positions->empty())
+		{
+			continue;
+		}
+
+		const FBoundingVolume& Bounds = BoundingVolumes[i];
+		if (Bounds.Min.X > Bounds.Max.X || Bounds.Min.Y > Bounds.Max.Y)
+		{
+			continue;
+		}
+
+		const float ScreenArea = (Bounds.Max.X - Bounds.Min.X) * (Bounds.Max.Y - Bounds.Min.Y) * 0.25f;
+		if (ScreenArea >= MIN_SOFTWARE_OCCLUDER_SCREEN_AREA)
+		{
+			Candidates.emplace_back(ScreenArea, i);
+		}
+	}
+
+	const size_t NumCandidates = std::min(Candidates.size(), MAX_SOFTWARE_OCCLUDERS);
+	std::partial_sort(Candidates.begin(), Candidates.begin() + NumCandidates, Candidates.end(),
+		[](const TPair<float, size_t>& A, const TPair<float, size_t>& B) { return A.first > B.first; });
+
+	uint32 TriangleBudget = MAX_SOFTWARE_OCCLUDER_TRIANGLES;
+	for (size_t Candidate = 0; Candidate < NumCandidates; ++Candidate)
+	{
+		const auto& Primitive = InPrimitiveComponents[Candidates[Candidate].second];
+		const TArray<FMeshPosition>* Positions = Primitive->GetPositionsData();
+		const TArray<uint32>* Indices = Primitive->GetIndicesData();
+
+		const uint32 NumIndices = Indices ? static_cast<uint32>(Indices->size()) : 0;
+		const uint32 NumTriangles = (Indices ? NumIndices : static_cast<uint32>(Positions->size())) / 3;
+		if (NumTriangles == 0 || NumTriangles > TriangleBudget)
+		{
+			continue;
+		}
+		TriangleBudget -= NumTriangles;
+
+		FMatrix WorldViewProj = Primitive->GetWorldTransformMatrix();
+		WorldViewProj *= InViewProjMatrix;
+
+		OccluderClipVertices.resize(Positions->size());
+		for (size_t Vertex = 0; Vertex < Positions->size(); ++Vertex)
+		{
+			const FMeshPosition& Position = (*Positions)[Vertex];
+			OccluderClipVertices[Vertex] = FMatrix::VectorMultiply(FVector4(Position.X, Position.Y, Position.Z, 1.0f), WorldViewProj);
+		}
+
+		SoftwareOcclusionBuffer.AddTriangles(OccluderClipVertices.data(), static_cast<uint32>(OccluderClipVertices.size()),
+			Indices ? Indices->data() : nullptr, NumIndices);
+		++NumSoftwareOccluders;
+	}
+}
+
+void UOcclusionRenderer::SoftwareOcclusionTest(UCamera* InCamera, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents)
+{
+	NumSoftwareOccluders = 0;
+	NumSoftwareCulled = 0;
+
+	if (!InCamera || InPrimitiveComponents.empty() || BoundingVolumes.size() != InPrimitiveComponents.size())
+	{
+		return;
+	}
+
+	if (SoftwareOcclusionBuffer.GetWidth() == 0)
+	{
+		ResizeSoftwareOcclusionBuffer();
+	}
+
+	FViewProjConstants ViewProj = InCamera->GetFViewProjConstants();
+	FMatrix ViewProjMatrix = ViewProj.View * ViewProj.Projection;
+
+	// ========================================================= //
+	// 1. 오클루더 선택 및 삼각형 준비
+	// ========================================================= //
+	SoftwareOcclusionBuffer.Clear();
+	AddSoftwareOccluders(InPrimitiveComponents, ViewProjMatrix);
+
+	const size_t NumPrimitives = InPrimitiveComponents.size();
+	SoftwareVisibility.assign(NumPrimitives, 1);
+
+	auto TestVisibility = [this, &InPrimitiveComponents](size_t InStartIndex, size_t InEndIndex)
+	{
+		for (size_t i = InStartIndex; i < InEndIndex; ++i)
+		{
+			if (InPrimitiveComponents[i])
+			{
+				SoftwareVisibility[i] = SoftwareOcclusionBuffer.IsVisible(BoundingVolumes[i].Min, BoundingVolumes[i].Max) ? 1 : 0;
+			}
+		}
+	};
+
+	// ========================================================= //
+	// 2. 래스터화 (행 단위 분할) → 3. 바운딩 박스 검사 (프리미티브 단위 분할)
+	// ========================================================= //
+	if (NumSoftwareOccluders > 0)
+	{
+#ifdef MULTI_THREADING
+		// 오클루더가 몰린 행이나 화면 밖 프리미티브가 몰린 구간이 있어도 남는 워커가 나머지 범위를 훔쳐 간다
+		FJobSystem::ParallelFor(SoftwareOcclusionBuffer.GetHeight(), [this](uint32 RowBegin, uint32 RowEnd)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_OcclusionRasterizeRows);
+			SoftwareOcclusionBuffer.RasterizeRows(RowBegin, RowEnd);
+		}, RASTER_ROW_BATCH_SIZE);
+
+		FJobSystem::ParallelFor(static_cast<uint32>(NumPrimitives), [&TestVisibility](uint32 StartIndex, uint32 EndIndex)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_OcclusionTestChunk);
+			TestVisibility(StartIndex, EndIndex);
+		}, VISIBILITY_TEST_BATCH_SIZE);
+#else
+		SoftwareOcclusionBuffer.Rasterize();
+		TestVisibility(0, NumPrimitives);
+#endif
+	}
+
+	// ========================================================= //
+	// 4. 결과 반영: 같은 프레임의 결과이므로 이력을 누적하지 않고 덮어쓴다
+	// ========================================================= //
+	for (size_t i = 0; i < NumPrimitives; ++i)
+	{
+		if (!InPrimitiveComponents[i])
+		{
+			continue;
+		}
+
+		if (!SoftwareVisibility[i])
+		{
+			++NumSoftwareCulled;
+		}
+
+		const uint32 SceneSlot = PrimitiveSceneSlots[i];
+		if (SceneSlot < VisibilityHistory.size())
+		{
+			VisibilityHistory[SceneSlot] = SoftwareVisibility[i] ? OCCLUSION_HISTORY_MASK : 0;
+		}
+	}
+}
+
+void UOcclusionRenderer::RegisterPrimitive(UPrimitiveComponent* InPrimitiveComponent)
+{
+	if (!InPrimitiveComponent || InPrimitiveComponent->GetSceneSlot() != UPrimitiveComponent::INVALID_SCENE_SLOT)
+	{
+		return;
+	}
+
+	uint32 SceneSlot;
+	if (!FreeSceneSlots.empty())
+	{
+		SceneSlot = FreeSceneSlots.back();
+		FreeSceneSlots.pop_back();
+	}
+	else
+	{
+		SceneSlot = static_cast<uint32>(VisibilityHistory.size());
+		VisibilityHistory.push_back(0);
+	}
+
+	// 새 프리미티브는 검사 결과가 나오기 전까지 보이는 것으로 처리한다
+	VisibilityHistory[SceneSlot] = OCCLUSION_HISTORY_MASK;
+	InPrimitiveComponent->SetSceneSlot(SceneSlot);
+}
+
+void UOcclusionRenderer::UnregisterPrimitive(UPrimitiveComponent* InPrimitiveComponent)
+{
+	if (!InPrimitiveComponent)
+	{
+		return;
+	}
+
+	const uint32 SceneSlot = InPrimitiveComponent->GetSceneSlot();
+	if (SceneSlot >= VisibilityHistory.size())
+	{
+		return;
+	}
+
+	VisibilityHistory[SceneSlot] = OCCLUSION_HISTORY_MASK;
+	FreeSceneSlots.push_back(SceneSlot);
+	InPrimitiveComponent->SetSceneSlot(UPrimitiveComponent::INVALID_SCENE_SLOT);
+}
+
 bool UOcclusionRenderer::IsPrimitiveVisible(const UPrimitiveComponent* InPrimitiveComponent) const
 {
 	if (!InPrimitiveComponent)
@@ -404,13 +631,13 @@ bool UOcclusionRenderer::IsPrimitiveVisible(const UPrimitiveComponent* InPrimiti
 		return true;
 	}
 
-	uint32 PrimitiveComponentUUID = InPrimitiveComponent->GetUUID();
-	auto It = VisibilityHistory.find(PrimitiveComponentUUID);
-	if (It != VisibilityHistory.end())
+	// 레벨에 등록되지 않은 프리미티브는 이력이 없으므로 항상 보인다
+	const uint32 SceneSlot = InPrimitiveComponent->GetSceneSlot();
+	if (SceneSlot >= VisibilityHistory.size())
 	{
-		return It->second.any();
+		return true;
 	}
-	return true;
+	return VisibilityHistory[SceneSlot] != 0;
 }
 
 void UOcclusionRenderer::CreateShader(ID3D11Device* InDevice)
@@ -47,7 +47,21 @@ void UPipeline::SetIndexBuffer(ID3D11Buffer* indexBuffer, uint32 stride)
 void UPipeline::SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride)
 {
 	uint32 Offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	DeviceContext->IASetVertexBuffers(VERTEX_SLOT, 1, &VertexBuffer, &Stride, &Offset);
+}
+
+/// @brief 쿠킹된 메쉬의 속성 스트림(노멀, UV)을 Slot 1에 바인딩
+void UPipeline::SetAttributeBuffer(ID3D11Buffer* AttributeBuffer, uint32 Stride)
+{
+	uint32 Offset = 0;
+	DeviceContext->IASetVertexBuffers(ATTRIBUTE_SLOT, 1, &AttributeBuffer, &Stride, &Offset);
+}
+
+/// @brief 인스턴스 버퍼를 Slot 2에 바인딩
+void UPipeline::SetInstanceBuffer(ID3D11Buffer* InstanceBuffer, uint32 Stride)
+{
+	uint32 Offset = 0;
+	DeviceContext->IASetVertexBuffers(INSTANCE_SLOT, 1, &InstanceBuffer, &Stride, &Offset);
 }
 
 /// @brief 상수 버퍼를 설정
@@ -96,3 +110,14 @@ void UPipeline::DrawIndexed(uint32 indexCount, uint32 startIndexLocation, uint32
 {
 	DeviceContext->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
 }
+
+/// @brief 인스턴스 버퍼를 사용하는 드로우 호출
+void UPipeline::DrawInstanced(uint32 VertexCount, uint32 InstanceCount, uint32 StartVertexLocation, uint32 StartInstanceLocation)
+{
+	DeviceContext->DrawInstanced(VertexCount, InstanceCount, StartVertexLocation, StartInstanceLocation);
+}
+
+void UPipeline::DrawIndexedInstanced(uint32 IndexCount, uint32 InstanceCount, uint32 StartIndexLocation, uint32 StartInstanceLocation)
+{
+	DeviceContext->DrawIndexedInstanced(IndexCount, InstanceCount, StartIndexLocation, 0, StartInstanceLocation);
+}
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "Render/Renderer/Public/RenderThread.h"
+
+#include "Core/Public/ScopeCycleCounter.h"
+
+DECLARE_CYCLE_STAT("Wait For Render Thread", STAT_WaitForRenderThread, Renderer)
+DECLARE_CYCLE_STAT("Render Frame", STAT_RenderFrame, Renderer)
+
+FRenderViewSnapshot& FRenderFrame::AddView()
+{
+	if (NumViews == Views.size())
+	{
+		Views.emplace_back();
+	}
+
+	FRenderViewSnapshot& View = Views[NumViews++];
+	View.DrawCommands.Reset();
+	View.Stats = {};
+	return View;
+}
+
+void FRenderFrame::Reset(uint64 InFrameNumber, float InDeltaSeconds)
+{
+	FrameNumber = InFrameNumber;
+	DeltaSeconds = InDeltaSeconds;
+	NumViews = 0;
+}
+
+FRenderThread::~FRenderThread()
+{
+	Stop();
+}
+
+void FRenderThread::Start(FRenderFunction InRenderFunction, bool bInUseThread)
+{
+	Stop();
+
+	RenderFunction = std::move(InRenderFunction);
+	NumWrittenFrames = 0;
+	NumRenderedFrames = 0;
+	GameThreadWaitMs = 0.0;
+
+	if (bInUseThread)
+	{
+		Thread = std::thread(&FRenderThread::ThreadMain, this);
+	}
+}
+
+void FRenderThread::Stop()
+{
+	if (!Thread.joinable())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		bStopping = true;
+	}
+	FrameWritten.notify_one();
+	Thread.join();
+	bStopping = false;
+}
+
+/**
+ * @brief 다음 슬롯을 비워 돌려준다, 렌더 스레드가 MAX_FRAMES_IN_FLIGHT만큼 밀려 있으면 하나가 끝날 때까지 기다린다
+ */
+FRenderFrame& FRenderThread::BeginFrame(uint64 InFrameNumber, float InDeltaSeconds)
+{
+	assert(!bWriting && "BeginFrame called twice without EndFrame");
+
+	std::unique_lock<std::mutex> Lock(QueueMutex);
+	if (NumWrittenFrames - NumRenderedFrames >= MAX_FRAMES_IN_FLIGHT)
+	{
+		FScopeCycleCounter WaitCounter(GET_STATID(STAT_WaitForRenderThread));
+		FrameRendered.wait(Lock, [this] { return NumWrittenFrames - NumRenderedFrames < MAX_FRAMES_IN_FLIGHT; });
+		GameThreadWaitMs += WaitCounter.Finish();
+	}
+
+	FRenderFrame& Frame = Frames[NumWrittenFrames % MAX_FRAMES_IN_FLIGHT];
+	bWriting = true;
+	Lock.unlock();
+
+	Frame.Reset(InFrameNumber, InDeltaSeconds);
+	return Frame;
+}
+
+void FRenderThread::EndFrame()
+{
+	if (!IsThreaded())
+	{
+		FRenderFrame& Frame = Frames[NumWrittenFrames % MAX_FRAMES_IN_FLIGHT];
+		if (RenderFunction)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RenderFrame);
+			RenderFunction(Frame);
+		}
+		++NumWrittenFrames;
+		++NumRenderedFrames;
+		bWriting = false;
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(QueueMutex);
+		++NumWrittenFrames;
+		bWriting = false;
+	}
+	FrameWritten.notify_one();
+}
+
+void FRenderThread::Flush()
+{
+	if (!IsThreaded())
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> Lock(QueueMutex);
+	FrameRendered.wait(Lock, [this] { return NumRenderedFrames == NumWrittenFrames; });
+}
+
+uint64 FRenderThread::GetNumRenderedFrames()
+{
+	std::lock_guard<std::mutex> Lock(QueueMutex);
+	return NumRenderedFrames;
+}
+
+/**
+ * @brief 넘겨받은 순서대로 프레임을 제출한다, 멈출 때는 남은 프레임을 모두 처리한 뒤 끝낸다
+ */
+void FRenderThread::ThreadMain()
+{
+	FThreadStats::SetThreadName("Render");
+
+	while (true)
+	{
+		FRenderFrame* Frame = nullptr;
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			FrameWritten.wait(Lock, [this] { return NumRenderedFrames < NumWrittenFrames || bStopping; });
+			if (NumRenderedFrames == NumWrittenFrames)
+			{
+				break;
+			}
+			Frame = &Frames[NumRenderedFrames % MAX_FRAMES_IN_FLIGHT];
+		}
+
+		if (RenderFunction)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_RenderFrame);
+			RenderFunction(*Frame);
+		}
+
+		{
+			std::lock_guard<std::mutex> Lock(QueueMutex);
+			++NumRenderedFrames;
+		}
+		FrameRendered.notify_all();
+	}
+}
@@ -11,33 +11,34 @@
 #include "Editor/Public/ViewportClient.h"
 #include "Editor/Public/Camera.h"
 #include "Level/Public/Level.h"
+#include "Manager/Transform/Public/TransformManager.h"
 #include "Manager/UI/Public/UIManager.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Texture/Public/Material.h"
+#include "Texture/Public/MaterialRenderProxy.h"
 #include "Texture/Public/Texture.h"
 #include "Texture/Public/TextureRenderProxy.h"
 #include "Source/Component/Mesh/Public/StaticMesh.h"
+#include "Component/Mesh/Public/MeshVertexCooker.h"
 
 #include "Render/Renderer/Public/OcclusionRenderer.h"
+#include "Render/Renderer/Public/D3D11RenderBackend.h"
+#include "Render/Renderer/Public/DebugDraw.h"
 
-#include "cpp-thread-pool/thread_pool.h"
+#include "Core/Public/JobSystem.h"
 
-#ifdef _
-#define PROFILE_SCOPE(name, expr) \
-    { \
-        auto __start = std::chrono::high_resolution_clock::now(); \
-        expr; \
-        auto __end = std::chrono::high_resolution_clock::now(); \
-        double __ms = std::chrono::duration<double, std::milli>(__end - __start).count(); \
-        UE_LOG("%s took %.3f ms", name, __ms); \
-    }
-#endif
+#include "Core/Public/ScopeCycleCounter.h"
 
+// 렌더러 구간을 프로파일러 스탯으로 기록한다 (STAT PROFILER / STAT TRACE로 확인)
 #define PROFILE_SCOPE(name, expr) \
 { \
+	static const TStatId ProfileStatId = FStatRegistry::Register(name, "Renderer"); \
+	FScopeCycleCounter ProfileCounter(ProfileStatId); \
 	expr; \
 }
 
+DECLARE_CYCLE_STAT("Record Deferred Chunk", STAT_RecordDeferredChunk, Renderer)
+
 IMPLEMENT_SINGLETON_CLASS_BASE(URenderer)
 
 URenderer::URenderer() = default;
@@ -58,6 +59,11 @@ void URenderer::Init(HWND InWindowHandle)
 	CreateConstantBuffer();
 	CreateBillboardResources();
 
+	DrawBackend = new FD3D11RenderBackend(*this, *Pipeline, ConstantBufferModels, ConstantBufferColor, ConstantBufferMaterial, ConstantBufferMaterialDraw);
+
+	// 에디터 요소(기즈모, 텍스트, 빌보드, ImGui)가 아직 스냅샷에 담기지 않으므로 인라인 모드로 시작한다
+	RenderThread.Start([this](FRenderFrame& InFrame) { SubmitFrame(InFrame); }, false);
+
 	// FontRenderer 초기화
 	FontRenderer = new UFontRenderer();
 	if (!FontRenderer->Initialize())
@@ -97,6 +103,7 @@ void URenderer::Init(HWND InWindowHandle)
 		ID3D11Buffer* ThreadCBModels = nullptr;
 		ID3D11Buffer* ThreadCBColors = nullptr;
 		ID3D11Buffer* ThreadCBMaterials = nullptr;
+		ID3D11Buffer* ThreadCBMaterialDraws = nullptr;
 
 		// Create Model Constant Buffer
 		D3D11_BUFFER_DESC ModelConstantBufferDescription = {};
@@ -124,12 +131,24 @@ void URenderer::Init(HWND InWindowHandle)
 		MaterialConstantBufferDescription.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 		GetDevice()->CreateBuffer(&MaterialConstantBufferDescription, nullptr, &ThreadCBMaterials);
 		ThreadConstantBufferMaterials.push_back(ThreadCBMaterials);
+
+		// Create Per-Draw Material Constant Buffer (Time)
+		D3D11_BUFFER_DESC MaterialDrawConstantBufferDescription = {};
+		MaterialDrawConstantBufferDescription.ByteWidth = sizeof(FMaterialDrawConstants) + 0xf & 0xfffffff0;
+		MaterialDrawConstantBufferDescription.Usage = D3D11_USAGE_DYNAMIC;
+		MaterialDrawConstantBufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		MaterialDrawConstantBufferDescription.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		GetDevice()->CreateBuffer(&MaterialDrawConstantBufferDescription, nullptr, &ThreadCBMaterialDraws);
+		ThreadConstantBufferMaterialDraws.push_back(ThreadCBMaterialDraws);
 	}
 #endif
 }
 
 void URenderer::Release()
 {
+	RenderThread.Stop();
+	SafeDelete(DrawBackend);
+
 	ReleaseConstantBuffer();
 	ReleaseDefaultShader();
 	ReleaseDepthStencilState();
@@ -181,6 +200,15 @@ void URenderer::Release()
 	}
 	ThreadConstantBufferMaterials.clear();
 
+	for (ID3D11Buffer* Buffer : ThreadConstantBufferMaterialDraws)
+	{
+		if (Buffer)
+		{
+			Buffer->Release();
+		}
+	}
+	ThreadConstantBufferMaterialDraws.clear();
+
 	for (ID3D11CommandList* CommandList : CommandLists)
 	{
 		if (CommandList)
@@ -262,6 +290,47 @@ void URenderer::CreateDefaultShader()
 
 	VertexShaderCSO->Release();
 	PixelShaderCSO->Release();
+
+	// Instancing 변형
+	ID3DBlob* InstancedVertexShaderCSO = nullptr;
+	ID3DBlob* InstancedPixelShaderCSO = nullptr;
+
+	D3DCompileFromFile(L"Asset/Shader/SampleShader.hlsl", nullptr, nullptr, "mainVSInstanced", "vs_5_0", 0, 0,
+		&InstancedVertexShaderCSO, nullptr);
+	D3DCompileFromFile(L"Asset/Shader/SampleShader.hlsl", nullptr, nullptr, "mainPSInstanced", "ps_5_0", 0, 0,
+		&InstancedPixelShaderCSO, nullptr);
+
+	if (!InstancedVertexShaderCSO || !InstancedPixelShaderCSO)
+	{
+		UE_LOG_WARNING("Renderer: Instancing shader 컴파일 실패 - 기본 셰이더는 인스턴싱 없이 그립니다");
+		if (InstancedVertexShaderCSO) { InstancedVertexShaderCSO->Release(); }
+		if (InstancedPixelShaderCSO) { InstancedPixelShaderCSO->Release(); }
+		return;
+	}
+
+	GetDevice()->CreateVertexShader(InstancedVertexShaderCSO->GetBufferPointer(),
+		InstancedVertexShaderCSO->GetBufferSize(), nullptr, &InstancedDefaultVertexShader);
+	GetDevice()->CreatePixelShader(InstancedPixelShaderCSO->GetBufferPointer(),
+		InstancedPixelShaderCSO->GetBufferSize(), nullptr, &InstancedDefaultPixelShader);
+
+	D3D11_INPUT_ELEMENT_DESC InstancedDefaultLayout[] =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(FNormalVertex, Position), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(FNormalVertex, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, offsetof(FNormalVertex, Color), D3D11_INPUT_PER_VERTEX_DATA, 0	},
+		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(FNormalVertex, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0	},
+		{ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, Color), D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+	};
+
+	GetDevice()->CreateInputLayout(InstancedDefaultLayout, ARRAYSIZE(InstancedDefaultLayout), InstancedVertexShaderCSO->GetBufferPointer(),
+		InstancedVertexShaderCSO->GetBufferSize(), &InstancedDefaultInputLayout);
+
+	InstancedVertexShaderCSO->Release();
+	InstancedPixelShaderCSO->Release();
 }
 
 void URenderer::CreateTextureShader()
@@ -281,12 +350,12 @@ void URenderer::CreateTextureShader()
 	GetDevice()->CreatePixelShader(TexturePSBlob->GetBufferPointer(),
 		TexturePSBlob->GetBufferSize(), nullptr, &TexturePixelShader);
 
+	// 쿠킹된 정점 스트림: Slot 0 위치(FMeshPosition), Slot 1 속성(FMeshAttribute)
 	D3D11_INPUT_ELEMENT_DESC TextureLayout[] =
 	{
-		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(FNormalVertex, Position), D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(FNormalVertex, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, offsetof(FNormalVertex, Color), D3D11_INPUT_PER_VERTEX_DATA, 0	},
-		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(FNormalVertex, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0	}
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, UPipeline::VERTEX_SLOT, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, UPipeline::ATTRIBUTE_SLOT, offsetof(FMeshAttribute, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, UPipeline::ATTRIBUTE_SLOT, offsetof(FMeshAttribute, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0 }
 	};
 	GetDevice()->CreateInputLayout(TextureLayout, ARRAYSIZE(TextureLayout), TextureVSBlob->GetBufferPointer(),
 		TextureVSBlob->GetBufferSize(), &TextureInputLayout);
@@ -296,6 +365,35 @@ void URenderer::CreateTextureShader()
 
 	TextureVSBlob->Release();
 	TexturePSBlob->Release();
+
+	// Instancing 변형 (Pixel Shader는 기존 것을 그대로 사용)
+	ID3DBlob* InstancedTextureVSBlob = nullptr;
+	D3DCompileFromFile(L"Asset/Shader/TextureShader.hlsl", nullptr, nullptr, "mainVSInstanced", "vs_5_0", 0, 0,
+		&InstancedTextureVSBlob, nullptr);
+
+	if (!InstancedTextureVSBlob)
+	{
+		UE_LOG_WARNING("Renderer: Instancing texture shader 컴파일 실패 - 스태틱 메쉬는 인스턴싱 없이 그립니다");
+		return;
+	}
+
+	GetDevice()->CreateVertexShader(InstancedTextureVSBlob->GetBufferPointer(),
+		InstancedTextureVSBlob->GetBufferSize(), nullptr, &InstancedTextureVertexShader);
+
+	D3D11_INPUT_ELEMENT_DESC InstancedTextureLayout[] =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, UPipeline::VERTEX_SLOT, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, UPipeline::ATTRIBUTE_SLOT, offsetof(FMeshAttribute, Normal), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, UPipeline::ATTRIBUTE_SLOT, offsetof(FMeshAttribute, TexCoord), D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		{ "INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, UPipeline::INSTANCE_SLOT, offsetof(FInstanceData, World) + 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+	};
+	GetDevice()->CreateInputLayout(InstancedTextureLayout, ARRAYSIZE(InstancedTextureLayout), InstancedTextureVSBlob->GetBufferPointer(),
+		InstancedTextureVSBlob->GetBufferSize(), &InstancedTextureInputLayout);
+
+	InstancedTextureVSBlob->Release();
 }
 
 /**
@@ -321,6 +419,12 @@ void URenderer::ReleaseBillboardResources()
 		BillboardVertexBuffer = nullptr;
 	}
 
+	if (BillboardAttributeBuffer)
+	{
+		BillboardAttributeBuffer->Release();
+		BillboardAttributeBuffer = nullptr;
+	}
+
 	if (BillboardIndexBuffer)
 	{
 		BillboardIndexBuffer->Release();
@@ -356,6 +460,37 @@ void URenderer::ReleaseDefaultShader()
 		DefaultVertexShader->Release();
 		DefaultVertexShader = nullptr;
 	}
+
+	// Instancing Shader
+	if (InstancedDefaultInputLayout)
+	{
+		InstancedDefaultInputLayout->Release();
+		InstancedDefaultInputLayout = nullptr;
+	}
+
+	if (InstancedDefaultPixelShader)
+	{
+		InstancedDefaultPixelShader->Release();
+		InstancedDefaultPixelShader = nullptr;
+	}
+
+	if (InstancedDefaultVertexShader)
+	{
+		InstancedDefaultVertexShader->Release();
+		InstancedDefaultVertexShader = nullptr;
+	}
+
+	if (InstancedTextureInputLayout)
+	{
+		InstancedTextureInputLayout->Release();
+		InstancedTextureInputLayout = nullptr;
+	}
+
+	if (InstancedTextureVertexShader)
+	{
+		InstancedTextureVertexShader->Release();
+		InstancedTextureVertexShader = nullptr;
+	}
 }
 
 /**
@@ -383,33 +518,56 @@ void URenderer::ReleaseDepthStencilState()
 }
 
 // Renderer.cpp
+/**
+ * @brief 뷰포트마다 컬링과 드로우 커맨드 기록을 FRenderViewSnapshot에 담아 FRenderThread로 넘긴다
+ * 렌더 스레드는 인라인 모드라 EndFrame에서 SubmitFrame이 바로 뷰포트 순서대로 레벨과 에디터 요소를 그린다
+ */
 void URenderer::Tick(float DeltaSeconds)
 {
+	FrameDrawStats = {};
+
+	// 이번 프레임에 움직인 트랜스폼을 컬링/드로우 전에 한 번에 갱신한다
+	UTransformManager::GetInstance().Update();
+
 	RenderBegin();
+
+	FRenderFrame& RenderFrame = RenderThread.BeginFrame(RenderFrameNumber++, DeltaSeconds);
 	// FViewportClient로부터 모든 뷰포트를 가져옵니다.
 	for (FViewportClient& ViewportClient : ViewportClient->GetViewports())
 	{
 		// 0. 현재 뷰포트가 닫혀있다면 렌더링을 하지 않습니다.
-		if (ViewportClient.GetViewportInfo().Width < 1.0f || ViewportClient.GetViewportInfo().Height < 1.0f) { continue; }
+		const D3D11_VIEWPORT ViewportInfo = ViewportClient.GetViewportInfo();
+		if (ViewportInfo.Width < 1.0f || ViewportInfo.Height < 1.0f) { continue; }
 
-		// 1. 현재 뷰포트의 영역을 설정합니다.
-		ViewportClient.Apply(GetDeviceContext());
-
-		// 2. 현재 뷰포트의 카메라 정보를 가져옵니다.
+		// 1. 현재 뷰포트의 카메라를 갱신합니다.
 		UCamera* CurrentCamera = &ViewportClient.Camera;
+		CurrentCamera->Update(ViewportInfo);
 
-		// 3. 해당 카메라의 View/Projection 행렬로 상수 버퍼를 업데이트합니다.
-		CurrentCamera->Update(ViewportClient.GetViewportInfo());
-		Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
-		UpdateConstant(GetDeviceContext(), ConstantBufferViewProj, CurrentCamera->GetFViewProjConstants());
-
-		// 4. 씬(레벨, 에디터 요소 등)을 이 뷰포트와 카메라 기준으로 렌더링합니다.
-		RenderLevel(CurrentCamera, ViewportClient);
+		// 2. 뷰포트 영역과 카메라 값을 스냅샷에 복사합니다.
+		FRenderViewSnapshot& View = RenderFrame.AddView();
+		View.Viewport = FRect{ ViewportInfo.TopLeftX, ViewportInfo.TopLeftY, ViewportInfo.Width, ViewportInfo.Height };
+		View.ViewProj = CurrentCamera->GetFViewProjConstants();
+		View.CameraLocation = CurrentCamera->GetLocation();
+		View.FarClip = CurrentCamera->GetFarZ();
 
-		// 5. 에디터를 렌더링합니다.
-		GEngine->GetEditor()->RenderEditor(*Pipeline, CurrentCamera);
+		const uint32 ViewIndex = RenderFrame.GetNumViews() - 1;
+		if (EditorViews.size() <= ViewIndex)
+		{
+			EditorViews.emplace_back();
+		}
+		FEditorViewContext& EditorView = EditorViews[ViewIndex];
+		EditorView.ViewportClient = &ViewportClient;
+		EditorView.Camera = CurrentCamera;
+		EditorView.Billboards.clear();
+		EditorView.TextRenders.clear();
+
+		// 3. 씬을 이 카메라 기준으로 컬링하고 드로우 커맨드로 기록합니다.
+		RecordLevel(CurrentCamera, View.DrawCommands, EditorView);
 	}
 
+	// 4. 기록한 뷰포트를 차례로 제출합니다 (레벨 -> 빌보드/텍스트 -> 에디터).
+	RenderThread.EndFrame();
+
 	// 최상위 에디터/GUI는 프레임에 1회만
 	UUIManager::GetInstance().Render();
 	UStatOverlay::GetInstance().Render();
@@ -417,6 +575,57 @@ void URenderer::Tick(float DeltaSeconds)
 	RenderEnd(); // Present 1회
 }
 
+/**
+ * @brief 인라인 렌더 스레드의 RenderFunction, 뷰포트마다 원래 순서(레벨 -> 빌보드/텍스트 -> 에디터)대로 그린다
+ */
+void URenderer::SubmitFrame(FRenderFrame& InFrame)
+{
+	for (uint32 ViewIndex = 0; ViewIndex < InFrame.GetNumViews(); ++ViewIndex)
+	{
+		FRenderViewSnapshot& View = InFrame.GetView(ViewIndex);
+		SubmitView(View, EditorViews[ViewIndex]);
+		FrameDrawStats += View.Stats;
+	}
+}
+
+void URenderer::SubmitView(FRenderViewSnapshot& InView, FEditorViewContext& InEditorView)
+{
+	// 1. 스냅샷의 뷰포트 영역과 View/Projection 행렬을 적용합니다.
+	const D3D11_VIEWPORT ViewportInfo = { InView.Viewport.Left, InView.Viewport.Top, InView.Viewport.Width, InView.Viewport.Height, 0.0f, 1.0f };
+	GetDeviceContext()->RSSetViewports(1, &ViewportInfo);
+	Pipeline->SetConstantBuffer(1, true, ConstantBufferViewProj);
+	UpdateConstant(GetDeviceContext(), ConstantBufferViewProj, InView.ViewProj);
+
+#ifdef MULTI_THREADING
+	// 디퍼드 컨텍스트 경로는 기록과 그리기를 나누지 않으므로 제출 단계에서 컬링부터 한다
+	if (GEngine->GetCurrentLevel())
+	{
+		RenderLevel_MultiThreaded(InEditorView.Camera, *InEditorView.ViewportClient, GatherVisiblePrimitives(InEditorView.Camera));
+	}
+#else
+	// 2. 기록한 드로우 커맨드를 정렬하고, 같은 메쉬/재질/상태끼리 인스턴싱 배치로 묶어 D3D11 백엔드로 재생합니다.
+	InView.DrawCommands.Sort();
+	InView.DrawCommands.BuildBatches(bInstancing);
+	if (DrawBackend)
+	{
+		InView.DrawCommands.Submit(*DrawBackend, InView.Stats);
+	}
+
+	// 3. 빌보드와 텍스트는 다른 프리미티브를 모두 그린 뒤에 그립니다.
+	for (TObjectPtr<UBillboardComponent> BillboardComponent : InEditorView.Billboards)
+	{
+		if (BillboardComponent)
+		{
+			RenderBillboard(BillboardComponent.Get(), InEditorView.Camera);
+		}
+	}
+	RenderTexts(InEditorView.TextRenders, InEditorView.Camera);
+#endif
+
+	// 4. 에디터를 렌더링합니다.
+	GEngine->GetEditor()->RenderEditor(*Pipeline, InEditorView.Camera);
+}
+
 
 /**
  * @brief Render Prepare Step
@@ -432,19 +641,22 @@ void URenderer::RenderBegin() const
 
 	GetDeviceContext()->OMSetRenderTargets(1, rtvs, DeviceResources->GetDepthStencilView());
 	DeviceResources->UpdateViewport();
+
+	if (FontRenderer)
+	{
+		FontRenderer->BeginFrame();
+	}
+
+	// 지난 렌더 이후 모든 스레드가 넣은 디버그 선을 이번 프레임 스트림 하나로 모은다
+	FDebugDraw::MergeFrame();
 }
 
 /**
- * @brief Buffer에 데이터 입력 및 Draw
+ * @brief 카메라 절두체 안의 프리미티브를 모으고, 켜져 있으면 오클루전 컬링까지 한다 (결과는 IsPrimitiveVisible로 확인)
  */
-void URenderer::RenderLevel(UCamera* InCurrentCamera, FViewportClient& InViewportClient)
+TArray<TObjectPtr<UPrimitiveComponent>> URenderer::GatherVisiblePrimitives(UCamera* InCurrentCamera)
 {
-	if (!GEngine->GetCurrentLevel())
-	{
-		return;
-	}
-
-	const auto PrimitiveComponents = GEngine->GetCurrentLevel()->GetVisiblePrimitiveComponents(InCurrentCamera);
+	TArray<TObjectPtr<UPrimitiveComponent>> PrimitiveComponents = GEngine->GetCurrentLevel()->GetVisiblePrimitiveComponents(InCurrentCamera);
 
 	// ImGui 창 옆 키고 끌 수 있는 메뉴 넣기
 	if (bOcclusionCulling)
@@ -452,17 +664,26 @@ void URenderer::RenderLevel(UCamera* InCurrentCamera, FViewportClient& InViewpor
 		PerformOcclusionCulling(InCurrentCamera, PrimitiveComponents);
 	}
 
-#ifdef MULTI_THREADING
-	RenderLevel_MultiThreaded(InCurrentCamera, InViewportClient, PrimitiveComponents);
-#else
-	RenderLevel_SingleThreaded(InCurrentCamera, InViewportClient, PrimitiveComponents);
-#endif
+	return PrimitiveComponents;
 }
 
 void URenderer::PerformOcclusionCulling(UCamera* InCurrentCamera, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents)
 {
 	auto& OcclusionRenderer = UOcclusionRenderer::GetInstance();
 
+	// Software 방식은 이전 프레임 깊이나 GPU 동기화 없이 같은 프레임에 CPU에서 검사한다
+	if (OcclusionRenderer.GetBackend() == EOcclusionBackend::Software)
+	{
+		PROFILE_SCOPE("BuildScreenSpaceBoundingVolumes",
+			OcclusionRenderer.BuildScreenSpaceBoundingVolumes(GetDeviceContext(), InCurrentCamera, InPrimitiveComponents)
+		);
+
+		PROFILE_SCOPE("SoftwareOcclusionTest",
+			OcclusionRenderer.SoftwareOcclusionTest(InCurrentCamera, InPrimitiveComponents)
+		);
+		return;
+	}
+
 	if (bIsFirstPass)
 	{
 		//bIsFirstPass = false;
@@ -487,7 +708,7 @@ void URenderer::PerformOcclusionCulling(UCamera* InCurrentCamera, const TArray<T
 	GetDeviceContext()->OMSetRenderTargets(1, &RTV, DeviceResources->GetDepthStencilView());
 }
 
-void URenderer::RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial)
+void URenderer::RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw)
 {
 	switch (InPrimitiveComponent->GetPrimitiveType())
 	{
@@ -496,7 +717,7 @@ void URenderer::RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveCompon
 		// Billboards and text are rendered on the main thread after all other primitives
 		break;
 	case EPrimitiveType::StaticMesh:
-		RenderStaticMesh(InPipeline, Cast<UStaticMeshComponent>(InPrimitiveComponent), InRasterizerState, InConstantBufferModels, InConstantBufferMaterial);
+		RenderStaticMesh(InPipeline, Cast<UStaticMeshComponent>(InPrimitiveComponent), InRasterizerState, InConstantBufferModels, InConstantBufferMaterial, InConstantBufferMaterialDraw);
 		break;
 	default:
 		RenderPrimitiveDefault(InPipeline, InPrimitiveComponent, InRasterizerState, InConstantBufferModels, InConstantBufferColor);
@@ -504,15 +725,27 @@ void URenderer::RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveCompon
 	}
 }
 
-void URenderer::RenderLevel_SingleThreaded(UCamera* InCurrentCamera, FViewportClient& InViewportClient, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents)
+/**
+ * @brief 보이는 프리미티브를 드로우 커맨드로 기록하고, 빌보드와 텍스트는 제출 단계에서 그리도록 따로 모은다
+ * 오클루전 결과는 뷰포트마다 덮어쓰므로 컬링 직후 여기서 바로 읽는다
+ */
+void URenderer::RecordLevel(UCamera* InCurrentCamera, FDrawCommandList& OutDrawCommands, FEditorViewContext& OutEditorView)
 {
+#ifdef MULTI_THREADING
+	// 디퍼드 컨텍스트 경로는 SubmitView에서 컬링과 기록을 함께 한다
+	return;
+#else
+	if (!GEngine->GetCurrentLevel())
+	{
+		return;
+	}
+
+	const TArray<TObjectPtr<UPrimitiveComponent>> PrimitiveComponents = GatherVisiblePrimitives(InCurrentCamera);
 	auto& OcclusionRenderer = UOcclusionRenderer::GetInstance();
-	TObjectPtr<UTextRenderComponent> TextRender = nullptr;
-	TArray<TObjectPtr<UBillboardComponent>> Billboards;
 
-	for (size_t i = 0; i < InPrimitiveComponents.size(); ++i)
+	for (size_t i = 0; i < PrimitiveComponents.size(); ++i)
 	{
-		auto PrimitiveComponent = InPrimitiveComponents[i];
+		auto PrimitiveComponent = PrimitiveComponents[i];
 
 		if (!PrimitiveComponent || !PrimitiveComponent->IsVisible() || !OcclusionRenderer.IsPrimitiveVisible(PrimitiveComponent))
 		{
@@ -530,57 +763,167 @@ void URenderer::RenderLevel_SingleThreaded(UCamera* InCurrentCamera, FViewportCl
 
 		if (PrimitiveComponent->GetPrimitiveType() == EPrimitiveType::TextRender)
 		{
-			TextRender = Cast<UTextRenderComponent>(PrimitiveComponent);
+			OutEditorView.TextRenders.push_back(Cast<UTextRenderComponent>(PrimitiveComponent));
 		}
 		else if (PrimitiveComponent->GetPrimitiveType() == EPrimitiveType::Billboard)
 		{
-			Billboards.push_back(Cast<UBillboardComponent>(PrimitiveComponent));
+			OutEditorView.Billboards.push_back(Cast<UBillboardComponent>(PrimitiveComponent));
 		}
 		else
 		{
-			RenderPrimitiveComponent(*Pipeline, PrimitiveComponent, LoadedRasterizerState, ConstantBufferModels, ConstantBufferColor, ConstantBufferMaterial);
+			RecordPrimitiveComponent(OutDrawCommands, PrimitiveComponent, LoadedRasterizerState, InCurrentCamera);
 		}
 	}
+#endif
+}
 
-	for (TObjectPtr<UBillboardComponent> BillboardComponent : Billboards)
+/**
+ * @brief 프리미티브를 즉시 그리지 않고 드로우 커맨드로 기록한다
+ * 정렬 키의 깊이는 카메라 전방 기준 컴포넌트 원점의 뷰 공간 깊이를 사용한다
+ */
+void URenderer::RecordPrimitiveComponent(FDrawCommandList& OutDrawCommands, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, UCamera* InCurrentCamera)
+{
+	const FMatrix& WorldMatrix = InPrimitiveComponent->GetWorldTransformMatrix();
+	const FVector WorldLocation(WorldMatrix.Data[3][0], WorldMatrix.Data[3][1], WorldMatrix.Data[3][2]);
+	const float ViewDepth = (WorldLocation - InCurrentCamera->GetLocation()).Dot(InCurrentCamera->GetForward());
+	const float MaxDepth = InCurrentCamera->GetFarZ();
+
+	switch (InPrimitiveComponent->GetPrimitiveType())
 	{
-		if (BillboardComponent)
+	case EPrimitiveType::TextRender:
+	case EPrimitiveType::Billboard:
+		// Billboards and text are rendered after all other primitives
+		break;
+	case EPrimitiveType::StaticMesh:
+		RecordStaticMesh(OutDrawCommands, Cast<UStaticMeshComponent>(InPrimitiveComponent), InRasterizerState, ViewDepth, MaxDepth);
+		break;
+	default:
+		RecordPrimitiveDefault(OutDrawCommands, InPrimitiveComponent, InRasterizerState, ViewDepth, MaxDepth);
+		break;
+	}
+}
+
+void URenderer::RecordStaticMesh(FDrawCommandList& OutDrawCommands, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, float InViewDepth, float InMaxDepth)
+{
+	if (!InMeshComp || !InMeshComp->GetStaticMesh()) return;
+
+	FStaticMesh* MeshAsset = InMeshComp->GetStaticMesh()->GetStaticMeshAsset();
+	if (!MeshAsset)    return;
+
+	FDrawPipelineState PipelineState;
+	PipelineState.InputLayout = TextureInputLayout;
+	PipelineState.VertexShader = TextureVertexShader;
+	PipelineState.RasterizerState = InRasterizerState;
+	PipelineState.DepthStencilState = DefaultDepthStencilState;
+	PipelineState.PixelShader = TexturePixelShader;
+	PipelineState.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	PipelineState.InstancedInputLayout = InstancedTextureInputLayout;
+	PipelineState.InstancedVertexShader = InstancedTextureVertexShader;
+
+	FDrawCommand Command;
+	Command.PipelineIndex = OutDrawCommands.FindOrAddPipeline(PipelineState);
+	Command.TransformIndex = OutDrawCommands.AddTransform(InMeshComp->GetWorldTransformMatrix());
+	Command.VertexBuffer = InMeshComp->GetVertexBuffer();
+	Command.IndexBuffer = InMeshComp->GetIndexBuffer();
+	Command.VertexStride = sizeof(FMeshPosition);
+	Command.AttributeBuffer = InMeshComp->GetAttributeBuffer();
+	Command.AttributeStride = sizeof(FMeshAttribute);
+	Command.MeshIndex = OutDrawCommands.FindOrAddMesh(Command.VertexBuffer, 0);
+
+	// If no material is assigned, render the entire mesh in a single draw
+	if (MeshAsset->MaterialInfo.empty() || InMeshComp->GetStaticMesh()->GetNumMaterials() == 0)
+	{
+		Command.IndexCount = static_cast<uint32>(MeshAsset->Indices.size());
+		OutDrawCommands.AddCommand(Command, EDrawPass::Opaque, InViewDepth, InMaxDepth);
+		return;
+	}
+
+	if (InMeshComp->IsScrollEnabled())
+	{
+		UTimeManager& TimeManager = UTimeManager::GetInstance();
+		InMeshComp->SetElapsedTime(InMeshComp->GetElapsedTime() + TimeManager.GetDeltaSeconds());
+	}
+
+	for (const FMeshSection& Section : MeshAsset->Sections)
+	{
+		Command.IndexCount = Section.IndexCount;
+		Command.StartIndex = Section.StartIndex;
+		Command.MeshIndex = OutDrawCommands.FindOrAddMesh(Command.VertexBuffer, Section.StartIndex);
+		Command.MaterialIndex = FDrawCommand::INVALID_INDEX;
+
+		// 재질 상수와 텍스처 바인딩은 UMaterial이 미리 만들어 둔 것을 그대로 사용하고, 스크롤 시간만 드로우별로 넘긴다
+		UMaterial* Material = Section.MaterialSlot != FMeshSection::INVALID_MATERIAL_SLOT
+			? InMeshComp->GetMaterial(static_cast<int32>(Section.MaterialSlot)) : nullptr;
+		if (Material && Material->GetRenderProxy())
 		{
-			RenderBillboard(BillboardComponent.Get(), InCurrentCamera);
+			Command.MaterialIndex = OutDrawCommands.AddMaterial(Material->GetRenderProxy()->GetBinding());
+			Command.MaterialTime = InMeshComp->GetElapsedTime();
 		}
+
+		OutDrawCommands.AddCommand(Command, EDrawPass::Opaque, InViewDepth, InMaxDepth);
 	}
+}
 
-	if (TextRender)
+void URenderer::RecordPrimitiveDefault(FDrawCommandList& OutDrawCommands, UPrimitiveComponent* InPrimitiveComp, ID3D11RasterizerState* InRasterizerState, float InViewDepth, float InMaxDepth)
+{
+	FDrawPipelineState PipelineState;
+	PipelineState.InputLayout = DefaultInputLayout;
+	PipelineState.VertexShader = DefaultVertexShader;
+	PipelineState.RasterizerState = InRasterizerState;
+	PipelineState.DepthStencilState = DefaultDepthStencilState;
+	PipelineState.PixelShader = DefaultPixelShader;
+	PipelineState.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	PipelineState.InstancedInputLayout = InstancedDefaultInputLayout;
+	PipelineState.InstancedVertexShader = InstancedDefaultVertexShader;
+	PipelineState.InstancedPixelShader = InstancedDefaultPixelShader;
+
+	FDrawCommand Command;
+	Command.PipelineIndex = OutDrawCommands.FindOrAddPipeline(PipelineState);
+	Command.TransformIndex = OutDrawCommands.AddTransform(InPrimitiveComp->GetWorldTransformMatrix());
+	Command.VertexBuffer = InPrimitiveComp->GetVertexBuffer();
+	Command.VertexStride = Stride;
+	Command.MeshIndex = OutDrawCommands.FindOrAddMesh(Command.VertexBuffer);
+	Command.Color = InPrimitiveComp->GetColor();
+	Command.bUseColor = true;
+
+	if (InPrimitiveComp->GetIndexBuffer() && InPrimitiveComp->GetIndicesData())
+	{
+		Command.IndexBuffer = InPrimitiveComp->GetIndexBuffer();
+		Command.IndexCount = InPrimitiveComp->GetNumIndices();
+	}
+	else
 	{
-		RenderText(TextRender, InCurrentCamera);
+		Command.VertexCount = static_cast<uint32>(InPrimitiveComp->GetNumVertices());
 	}
+
+	OutDrawCommands.AddCommand(Command, EDrawPass::Opaque, InViewDepth, InMaxDepth);
 }
 
 void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportClient& InViewportClient, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents)
 {
-	static ThreadPool Pool(NUM_WORKER_THREADS);
-
 	const size_t NumPrimitives = InPrimitiveComponents.size();
 	const size_t ChunkSize = (NumPrimitives + NUM_WORKER_THREADS - 1) / NUM_WORKER_THREADS;
 
 	CommandLists.clear();
 	CommandLists.resize(NUM_WORKER_THREADS, nullptr);
 
-	std::vector<std::future<void>> Futures;
-	for (size_t i = 0; i < NUM_WORKER_THREADS; ++i)
+	// 디퍼드 컨텍스트 하나당 연속된 구간 하나를 기록해야 실행 순서가 유지되므로 컨텍스트 단위로 나눈다
+	FJobSystem::ParallelFor(static_cast<uint32>(NUM_WORKER_THREADS), [this, ChunkSize, NumPrimitives, &InPrimitiveComponents, &InViewportClient](uint32 ContextBegin, uint32 ContextEnd)
 	{
-		const size_t StartIndex = i * ChunkSize;
-		const size_t EndIndex = std::min(StartIndex + ChunkSize, NumPrimitives);
+		for (size_t i = ContextBegin; i < ContextEnd; ++i)
+		{
+			const size_t StartIndex = i * ChunkSize;
+			const size_t EndIndex = std::min(StartIndex + ChunkSize, NumPrimitives);
 
-		if (StartIndex >= EndIndex) continue;
+			if (StartIndex >= EndIndex) continue;
+
+			SCOPE_CYCLE_COUNTER(STAT_RecordDeferredChunk);
 
-		Futures.emplace_back(Pool.Enqueue([this, StartIndex, EndIndex, &InPrimitiveComponents, i, &InViewportClient]()
-		{
 			ID3D11DeviceContext* DeferredContext = DeferredContexts[i];
 			if (!DeferredContext)
 			{
-				UE_LOG("DeferredContext is null in worker thread %d! Skipping rendering for this chunk.", i);
-				return;
+				UE_LOG("DeferredContext is null in worker thread %d! Skipping rendering for this chunk.", static_cast<int32>(i));
+				continue;
 			}
 			UPipeline ThreadPipeline(DeferredContext);
 			InViewportClient.Apply(DeferredContext);
@@ -593,6 +936,7 @@ void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportCli
 			ID3D11Buffer* ThreadCBModels = ThreadConstantBufferModels[i];
 			ID3D11Buffer* ThreadCBColors = ThreadConstantBufferColors[i];
 			ID3D11Buffer* ThreadCBMaterials = ThreadConstantBufferMaterials[i];
+			ID3D11Buffer* ThreadCBMaterialDraws = ThreadConstantBufferMaterialDraws[i];
 
 			for (size_t j = StartIndex; j < EndIndex; ++j)
 			{
@@ -611,16 +955,11 @@ void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportCli
 				}
 				ID3D11RasterizerState* LoadedRasterizerState = GetRasterizerState(RenderState);
 
-				RenderPrimitiveComponent(ThreadPipeline, PrimitiveComponent, LoadedRasterizerState, ThreadCBModels, ThreadCBColors, ThreadCBMaterials);
+				RenderPrimitiveComponent(ThreadPipeline, PrimitiveComponent, LoadedRasterizerState, ThreadCBModels, ThreadCBColors, ThreadCBMaterials, ThreadCBMaterialDraws);
 			}
 			DeferredContext->FinishCommandList(FALSE, &CommandLists[i]);
-		}));
-	}
-
-	for (auto& Future : Futures)
-	{
-		Future.get();
-	}
+		}
+	}, 1);
 
 	for (ID3D11CommandList* CommandList : CommandLists)
 	{
@@ -632,7 +971,7 @@ void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportCli
 	}
 	CommandLists.clear();
 
-	TObjectPtr<UTextRenderComponent> TextRender = nullptr;
+	TArray<TObjectPtr<UTextRenderComponent>> TextRenders;
 	TArray<TObjectPtr<UBillboardComponent>> Billboards;
 	auto& OcclusionRenderer = UOcclusionRenderer::GetInstance();
 
@@ -646,8 +985,7 @@ void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportCli
 
 		if (PrimitiveComponent->GetPrimitiveType() == EPrimitiveType::TextRender)
 		{
-			// Render the last text component found (they typically represent selection info)
-			TextRender = Cast<UTextRenderComponent>(PrimitiveComponent);
+			TextRenders.push_back(Cast<UTextRenderComponent>(PrimitiveComponent));
 		}
 		else if (PrimitiveComponent->GetPrimitiveType() == EPrimitiveType::Billboard)
 		{
@@ -663,10 +1001,7 @@ void URenderer::RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportCli
 		}
 	}
 
-	if (TextRender)
-	{
-		RenderText(TextRender, InCurrentCamera);
-	}
+	RenderTexts(TextRenders, InCurrentCamera);
 }
 
 /**
@@ -756,6 +1091,39 @@ void URenderer::RenderEditorPrimitiveIndexed(UPipeline& InPipeline, const FEdito
     InPipeline.SetVertexBuffer(InEditorPrimitive.Vertexbuffer, InStride);
     InPipeline.DrawIndexed(InEditorPrimitive.NumIndices, 0, 0);
 }
+/**
+ * @brief 정점 버퍼의 일부 구간만 그리는 Editor Primitive 렌더링 함수 (정점에 월드 좌표와 색이 이미 들어 있는 경우)
+ * @param InEditorPrimitive 렌더링할 에디터 프리미티브, NumVertices만큼 그린다
+ * @param InRenderState 렌더링 상태
+ * @param InStride 정점 스트라이드
+ * @param InStartVertex 그리기 시작할 정점 위치
+ */
+void URenderer::RenderEditorPrimitiveRange(UPipeline& InPipeline, const FEditorPrimitive& InEditorPrimitive, const FRenderState& InRenderState,
+    uint32 InStride, uint32 InStartVertex)
+{
+    if (!InEditorPrimitive.Vertexbuffer || InEditorPrimitive.NumVertices == 0)
+    {
+        return;
+    }
+
+    ID3D11DepthStencilState* DepthStencilState =
+        InEditorPrimitive.bShouldAlwaysVisible ? DisabledDepthStencilState : DefaultDepthStencilState;
+
+    FPipelineInfo PipelineInfo = {
+        InEditorPrimitive.InputLayout ? InEditorPrimitive.InputLayout : DefaultInputLayout,
+        InEditorPrimitive.VertexShader ? InEditorPrimitive.VertexShader : DefaultVertexShader,
+        GetRasterizerState(InRenderState),
+        DepthStencilState,
+        InEditorPrimitive.PixelShader ? InEditorPrimitive.PixelShader : DefaultPixelShader,
+        nullptr,
+        InEditorPrimitive.Topology
+    };
+
+    InPipeline.UpdatePipeline(PipelineInfo);
+
+    InPipeline.SetVertexBuffer(InEditorPrimitive.Vertexbuffer, InStride);
+    InPipeline.Draw(InEditorPrimitive.NumVertices, InStartVertex);
+}
 /**
  * @brief 스왑 체인의 백 버퍼와 프론트 버퍼를 교체하여 화면에 출력
  */
@@ -766,7 +1134,7 @@ void URenderer::RenderEnd() const
 	GetSwapChain()->Present(0, 0); // 1: VSync 활성화
 }
 
-void URenderer::RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferMaterial)
+void URenderer::RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw)
 {
     if (!InMeshComp || !InMeshComp->GetStaticMesh()) return;
 
@@ -795,7 +1163,8 @@ void URenderer::RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* In
         // InMeshComp->GetRelativeScale3D()
     );
 
-    InPipeline.SetVertexBuffer(InMeshComp->GetVertexBuffer(), sizeof(FNormalVertex));
+    InPipeline.SetVertexBuffer(InMeshComp->GetVertexBuffer(), sizeof(FMeshPosition));
+    InPipeline.SetAttributeBuffer(InMeshComp->GetAttributeBuffer(), sizeof(FMeshAttribute));
     InPipeline.SetIndexBuffer(InMeshComp->GetIndexBuffer(), 0);
 
     // If no material is assigned, render the entire mesh using the default shader
@@ -811,48 +1180,34 @@ void URenderer::RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* In
         InMeshComp->SetElapsedTime(InMeshComp->GetElapsedTime() + TimeManager.GetDeltaSeconds());
     }
 
+    // 스크롤 시간은 재질과 무관하므로 메쉬당 한 번만 올린다
+    InPipeline.SetConstantBuffer(2, false, InConstantBufferMaterial);
+    InPipeline.SetConstantBuffer(3, false, InConstantBufferMaterialDraw);
+    FMaterialDrawConstants DrawConstants;
+    DrawConstants.Time = InMeshComp->GetElapsedTime();
+    UpdateConstant(InPipeline.GetDeviceContext(), InConstantBufferMaterialDraw, DrawConstants);
+
+    // 재질이 미리 만들어 둔 바인딩을 사용하고, 직전 섹션과 같은 재질이면 다시 올리지 않는다
+    const FMaterialRenderProxy* BoundMaterial = nullptr;
     for (const FMeshSection& Section : MeshAsset->Sections)
     {
-        UMaterial* Material = InMeshComp->GetMaterial(Section.MaterialSlot);
-        if (Material)
+        UMaterial* Material = Section.MaterialSlot != FMeshSection::INVALID_MATERIAL_SLOT
+            ? InMeshComp->GetMaterial(static_cast<int32>(Section.MaterialSlot)) : nullptr;
+        const FMaterialRenderProxy* MaterialProxy = Material ? Material->GetRenderProxy() : nullptr;
+        if (MaterialProxy && MaterialProxy != BoundMaterial)
         {
-            FMaterialConstants MaterialConstants = {};
-            FVector AmbientColor = Material->GetAmbientColor();
-            MaterialConstants.Ka = FVector4(AmbientColor.X, AmbientColor.Y, AmbientColor.Z, 1.0f);
-            FVector DiffuseColor = Material->GetDiffuseColor();
-            MaterialConstants.Kd = FVector4(DiffuseColor.X, DiffuseColor.Y, DiffuseColor.Z, 1.0f);
-            FVector SpecularColor = Material->GetSpecularColor();
-            MaterialConstants.Ks = FVector4(SpecularColor.X, SpecularColor.Y, SpecularColor.Z, 1.0f);
-            MaterialConstants.Ns = Material->GetSpecularExponent();
-            MaterialConstants.Ni = Material->GetRefractionIndex();
-            MaterialConstants.D = Material->GetDissolveFactor();
-            MaterialConstants.MaterialFlags = 0; // Placeholder
-            MaterialConstants.Time = InMeshComp->GetElapsedTime();
-
-            // Update Constant Buffer
-            InPipeline.SetConstantBuffer(2, false, InConstantBufferMaterial);
-            UpdateConstant(InPipeline.GetDeviceContext(), InConstantBufferMaterial, MaterialConstants);
-
-            if (Material->GetDiffuseTexture()){
-                auto* Proxy = Material->GetDiffuseTexture()->GetRenderProxy();
-                InPipeline.SetTexture(0, false, Proxy->GetSRV());
-                InPipeline.SetSamplerState(0, false, Proxy->GetSampler());
-            }
-            if (Material->GetAmbientTexture()){
-                auto* Proxy = Material->GetAmbientTexture()->GetRenderProxy();
-                InPipeline.SetTexture(1, false, Proxy->GetSRV());
-                InPipeline.SetSamplerState(1, false, Proxy->GetSampler());
-            }
-            if (Material->GetSpecularTexture()){
-                auto* Proxy = Material->GetSpecularTexture()->GetRenderProxy();
-                InPipeline.SetTexture(2, false, Proxy->GetSRV());
-                InPipeline.SetSamplerState(2, false, Proxy->GetSampler());
-            }
-            if (Material->GetAlphaTexture()){
-                auto* Proxy = Material->GetAlphaTexture()->GetRenderProxy();
-                InPipeline.SetTexture(4, false, Proxy->GetSRV());
-                InPipeline.SetSamplerState(4, false, Proxy->GetSampler());
+            const FDrawMaterialBinding& Binding = MaterialProxy->GetBinding();
+            UpdateConstant(InPipeline.GetDeviceContext(), InConstantBufferMaterial, Binding.Constants);
+
+            for (uint32 Slot = 0; Slot < FDrawMaterialBinding::MAX_TEXTURE_SLOTS; ++Slot)
+            {
+                if (Binding.ShaderResources[Slot])
+                {
+                    InPipeline.SetTexture(Slot, false, static_cast<ID3D11ShaderResourceView*>(Binding.ShaderResources[Slot]));
+                    InPipeline.SetSamplerState(Slot, false, static_cast<ID3D11SamplerState*>(Binding.Samplers[Slot]));
+                }
             }
+            BoundMaterial = MaterialProxy;
         }
         InPipeline.DrawIndexed(Section.IndexCount, Section.StartIndex, 0);
     }
@@ -878,10 +1233,10 @@ void URenderer::RenderBillboard(UBillboardComponent* InBillboardComp, UCamera* I
 		return;
 	}
 
-	if (!BillboardVertexBuffer || !BillboardIndexBuffer || !BillboardBlendState)
+	if (!BillboardVertexBuffer || !BillboardAttributeBuffer || !BillboardIndexBuffer || !BillboardBlendState)
 	{
 		CreateBillboardResources();
-		if (!BillboardVertexBuffer || !BillboardIndexBuffer || !BillboardBlendState)
+		if (!BillboardVertexBuffer || !BillboardAttributeBuffer || !BillboardIndexBuffer || !BillboardBlendState)
 		{
 			return;
 		}
@@ -921,18 +1276,42 @@ void URenderer::RenderBillboard(UBillboardComponent* InBillboardComp, UCamera* I
 	MaterialConstants.D = 1.0f;
 	Pipeline->SetConstantBuffer(2, false, ConstantBufferMaterial);
 	UpdateConstant(GetDeviceContext(), ConstantBufferMaterial, MaterialConstants);
+	Pipeline->SetConstantBuffer(3, false, ConstantBufferMaterialDraw);
+	UpdateConstant(GetDeviceContext(), ConstantBufferMaterialDraw, FMaterialDrawConstants());
 
 	Pipeline->SetTexture(0, false, RenderProxy->GetSRV());
 	Pipeline->SetSamplerState(0, false, RenderProxy->GetSampler());
 
-	Pipeline->SetVertexBuffer(BillboardVertexBuffer, sizeof(FNormalVertex));
+	Pipeline->SetVertexBuffer(BillboardVertexBuffer, sizeof(FMeshPosition));
+	Pipeline->SetAttributeBuffer(BillboardAttributeBuffer, sizeof(FMeshAttribute));
 	Pipeline->SetIndexBuffer(BillboardIndexBuffer, 0);
 	Pipeline->DrawIndexed(6, 0, 0);
 }
 
+/**
+ * @brief 뷰포트의 텍스트를 모두 FontRenderer 배치에 모아 드로우 한 번으로 그린다
+ */
+void URenderer::RenderTexts(const TArray<TObjectPtr<UTextRenderComponent>>& InTextRenderComps, UCamera* InCurrentCamera)
+{
+	if (!InCurrentCamera || !FontRenderer || InTextRenderComps.empty())	return;
+
+	for (const TObjectPtr<UTextRenderComponent>& TextRenderComp : InTextRenderComps)
+	{
+		if (TextRenderComp)
+		{
+			RenderText(TextRenderComp.Get(), InCurrentCamera);
+		}
+	}
+
+	FontRenderer->FlushText(InCurrentCamera->GetFViewProjConstants());
+}
+
+/**
+ * @brief 텍스트 하나를 FontRenderer 배치에 추가한다, 실제 드로우는 RenderTexts의 FlushText에서 한다
+ */
 void URenderer::RenderText(UTextRenderComponent* InTextRenderComp, UCamera* InCurrentCamera)
 {
-	if (!InCurrentCamera)	return;
+	if (!InCurrentCamera || !FontRenderer)	return;
 
 	FString RenderedString;
 
@@ -949,11 +1328,10 @@ void URenderer::RenderText(UTextRenderComponent* InTextRenderComp, UCamera* InCu
 		}
 	}
 
-	const FViewProjConstants& ViewProjConstData = InCurrentCamera->GetFViewProjConstants();
 	FMatrix Translation = FMatrix::TranslationMatrix(InTextRenderComp->GetOwner()->GetActorLocation() + InTextRenderComp->GetRelativeLocation());
 	FMatrix Rotation = FMatrix::RotationMatrix(InTextRenderComp->GetRelativeRotation());
 	FMatrix Scale = FMatrix::ScaleMatrix(InTextRenderComp->GetRelativeScale3D());
-	FontRenderer->RenderText(RenderedString.c_str(), Scale * Rotation * Translation, ViewProjConstData);
+	FontRenderer->AddText(RenderedString.c_str(), Scale * Rotation * Translation);
 }
 
 void URenderer::RenderPrimitiveDefault(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor)
@@ -999,12 +1377,12 @@ void URenderer::RenderPrimitiveDefault(UPipeline& InPipeline, UPrimitiveComponen
     }
 }
 /**
- * @brief FVertex 타입용 정점 Buffer 생성 함수
+ * @brief 변경되지 않는 정점 Buffer 생성 함수 (FNormalVertex, 쿠킹된 위치/속성 스트림 공용)
  * @param InVertices 정점 데이터 포인터
  * @param InByteWidth 버퍼 크기 (바이트 단위)
  * @return 생성된 D3D11 정점 버퍼
  */
-ID3D11Buffer* URenderer::CreateVertexBuffer(FNormalVertex* InVertices, uint32 InByteWidth) const
+ID3D11Buffer* URenderer::CreateVertexBuffer(const void* InVertices, uint32 InByteWidth) const
 {
 	D3D11_BUFFER_DESC VertexBufferDescription = {};
 	VertexBufferDescription.ByteWidth = InByteWidth;
@@ -1085,6 +1463,9 @@ void URenderer::OnResize(uint32 InWidth, uint32 InHeight)
 
 	if (InWidth == 0 || InHeight == 0) return;
 
+	// 제출 중인 프레임이 옛 렌더 타겟을 쓰지 않도록 먼저 비운다
+	RenderThread.Flush();
+
 	UStatOverlay::GetInstance().PreResize();
 
 	DeviceResources->OnWindowSizeChanged(InWidth, InHeight);
@@ -1250,11 +1631,22 @@ void URenderer::CreateConstantBuffer()
 
 		GetDevice()->CreateBuffer(&MaterialConstantBufferDescription, nullptr, &ConstantBufferMaterial);
 	}
+
+	// 드로우별 재질 값(스크롤 시간)용 상수 버퍼 생성 (PS Slot 3)
+	{
+		D3D11_BUFFER_DESC MaterialDrawConstantBufferDescription = {};
+		MaterialDrawConstantBufferDescription.ByteWidth = sizeof(FMaterialDrawConstants) + 0xf & 0xfffffff0; // 16바이트 단위 정렬
+		MaterialDrawConstantBufferDescription.Usage = D3D11_USAGE_DYNAMIC; // 드로우마다 CPU에서 업데이트
+		MaterialDrawConstantBufferDescription.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		MaterialDrawConstantBufferDescription.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+		GetDevice()->CreateBuffer(&MaterialDrawConstantBufferDescription, nullptr, &ConstantBufferMaterialDraw);
+	}
 }
 
 void URenderer::CreateBillboardResources()
 {
-	if (BillboardVertexBuffer && BillboardIndexBuffer && BillboardBlendState)
+	if (BillboardVertexBuffer && BillboardAttributeBuffer && BillboardIndexBuffer && BillboardBlendState)
 	{
 		return;
 	}
@@ -1280,15 +1672,30 @@ void URenderer::CreateBillboardResources()
 	BillboardVertices[3].Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
 	BillboardVertices[3].TexCoord = FVector2(0.0f, 0.0f);
 
+	// 빌보드도 TextureShader를 쓰므로 스태틱 메쉬와 같은 위치/속성 스트림으로 쿠킹한다
+	TArray<FMeshPosition> BillboardPositions;
+	TArray<FMeshAttribute> BillboardAttributes;
+	FMeshVertexCooker::CookVertices(TArray<FNormalVertex>(std::begin(BillboardVertices), std::end(BillboardVertices)),
+		BillboardPositions, BillboardAttributes);
+
 	if (!BillboardVertexBuffer)
 	{
-		BillboardVertexBuffer = CreateVertexBuffer(BillboardVertices, static_cast<uint32>(sizeof(BillboardVertices)));
+		BillboardVertexBuffer = CreateVertexBuffer(BillboardPositions.data(), static_cast<uint32>(BillboardPositions.size() * sizeof(FMeshPosition)));
 		if (!BillboardVertexBuffer)
 		{
 			UE_LOG_ERROR("Renderer: Failed to create billboard vertex buffer");
 		}
 	}
 
+	if (!BillboardAttributeBuffer)
+	{
+		BillboardAttributeBuffer = CreateVertexBuffer(BillboardAttributes.data(), static_cast<uint32>(BillboardAttributes.size() * sizeof(FMeshAttribute)));
+		if (!BillboardAttributeBuffer)
+		{
+			UE_LOG_ERROR("Renderer: Failed to create billboard attribute buffer");
+		}
+	}
+
 	uint32 BillboardIndices[6] = { 0, 1, 2, 0, 2, 3 };
 	if (!BillboardIndexBuffer)
 	{
@@ -1347,6 +1754,12 @@ void URenderer::ReleaseConstantBuffer()
 		ConstantBufferMaterial->Release();
 		ConstantBufferMaterial = nullptr;
 	}
+
+	if (ConstantBufferMaterialDraw)
+	{
+		ConstantBufferMaterialDraw->Release();
+		ConstantBufferMaterialDraw = nullptr;
+	}
 }
 
 void URenderer::UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const UPrimitiveComponent* InPrimitive) const
@@ -1451,11 +1864,21 @@ void URenderer::UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffe
             MaterialConstants->Ni = InMaterial.Ni;
             MaterialConstants->D = InMaterial.D;
             MaterialConstants->MaterialFlags = InMaterial.MaterialFlags;
-            MaterialConstants->Time = InMaterial.Time;
         }
         InDeviceContext->Unmap(InConstantBuffer, 0);
     }
 }
+void URenderer::UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const FMaterialDrawConstants& InDrawConstants) const
+{
+    if (InConstantBuffer)
+    {
+        D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR = {};
+
+        InDeviceContext->Map(InConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &ConstantBufferMSR);
+        memcpy(ConstantBufferMSR.pData, &InDrawConstants, sizeof(FMaterialDrawConstants));
+        InDeviceContext->Unmap(InConstantBuffer, 0);
+    }
+}
 bool URenderer::UpdateVertexBuffer(ID3D11Buffer* InVertexBuffer, const TArray<FVector>& InVertices) const
 {
 	if (!GetDeviceContext() || !InVertexBuffer || InVertices.empty())
@@ -0,0 +1,236 @@
+#include "pch.h"
+#include "Render/Renderer/Public/SoftwareOcclusionBuffer.h"
+
+#include <immintrin.h>
+
+namespace
+{
+	// W가 이 값 이하인 정점은 Near 평면에 걸친 것으로 본다
+	constexpr float NEAR_W_EPSILON = 1e-4f;
+	constexpr float MIN_TRIANGLE_AREA = 1e-6f;
+}
+
+void FSoftwareOcclusionBuffer::Resize(uint32 InWidth, uint32 InHeight)
+{
+	Width = (std::max(InWidth, 4u) + 3u) & ~3u;
+	Height = std::max(InHeight, 1u);
+
+	Depth.assign(static_cast<size_t>(Width) * Height, 1.0f);
+	Triangles.clear();
+}
+
+void FSoftwareOcclusionBuffer::Clear()
+{
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+	Triangles.clear();
+}
+
+void FSoftwareOcclusionBuffer::AddTriangles(const FVector4* InClipVertices, uint32 InNumVertices, const uint32* InIndices, uint32 InNumIndices)
+{
+	if (!InClipVertices || Depth.empty())
+	{
+		return;
+	}
+
+	const uint32 NumCorners = InIndices ? InNumIndices : InNumVertices;
+	for (uint32 Corner = 0; Corner + 2 < NumCorners; Corner += 3)
+	{
+		uint32 VertexIndices[3] = { Corner, Corner + 1, Corner + 2 };
+		if (InIndices)
+		{
+			VertexIndices[0] = InIndices[Corner];
+			VertexIndices[1] = InIndices[Corner + 1];
+			VertexIndices[2] = InIndices[Corner + 2];
+		}
+
+		if (VertexIndices[0] >= InNumVertices || VertexIndices[1] >= InNumVertices || VertexIndices[2] >= InNumVertices)
+		{
+			continue;
+		}
+
+		FScreenTriangle Triangle;
+		float MaxDepth = 0.0f;
+		bool bCrossesNearPlane = false;
+
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const FVector4& Clip = InClipVertices[VertexIndices[i]];
+			if (Clip.W <= NEAR_W_EPSILON)
+			{
+				bCrossesNearPlane = true;
+				break;
+			}
+
+			const float InvW = 1.0f / Clip.W;
+			Triangle.X[i] = (Clip.X * InvW * 0.5f + 0.5f) * static_cast<float>(Width);
+			Triangle.Y[i] = (0.5f - Clip.Y * InvW * 0.5f) * static_cast<float>(Height);
+			MaxDepth = std::max(MaxDepth, Clip.Z * InvW);
+		}
+
+		// Far 평면 너머의 삼각형은 아무것도 가리지 못한다
+		if (bCrossesNearPlane || MaxDepth >= 1.0f)
+		{
+			continue;
+		}
+		Triangle.MaxDepth = MaxDepth;
+
+		// 내부 판정을 한 방향으로 통일하기 위해 면적이 양수가 되도록 정렬한다
+		const float Area = (Triangle.X[1] - Triangle.X[0]) * (Triangle.Y[2] - Triangle.Y[0]) -
+			(Triangle.Y[1] - Triangle.Y[0]) * (Triangle.X[2] - Triangle.X[0]);
+		if (std::abs(Area) < MIN_TRIANGLE_AREA)
+		{
+			continue;
+		}
+		if (Area < 0.0f)
+		{
+			std::swap(Triangle.X[1], Triangle.X[2]);
+			std::swap(Triangle.Y[1], Triangle.Y[2]);
+		}
+
+		const float MinX = std::min({ Triangle.X[0], Triangle.X[1], Triangle.X[2] });
+		const float MaxX = std::max({ Triangle.X[0], Triangle.X[1], Triangle.X[2] });
+		const float MinY = std::min({ Triangle.Y[0], Triangle.Y[1], Triangle.Y[2] });
+		const float MaxY = std::max({ Triangle.Y[0], Triangle.Y[1], Triangle.Y[2] });
+
+		Triangle.MinX = std::max(static_cast<int32>(std::floor(MinX)), 0);
+		Triangle.MaxX = std::min(static_cast<int32>(std::ceil(MaxX)), static_cast<int32>(Width) - 1);
+		Triangle.MinY = std::max(static_cast<int32>(std::floor(MinY)), 0);
+		Triangle.MaxY = std::min(static_cast<int32>(std::ceil(MaxY)), static_cast<int32>(Height) - 1);
+
+		if (Triangle.MinX > Triangle.MaxX || Triangle.MinY > Triangle.MaxY)
+		{
+			continue;
+		}
+
+		Triangles.push_back(Triangle);
+	}
+}
+
+void FSoftwareOcclusionBuffer::RasterizeRows(uint32 InRowBegin, uint32 InRowEnd)
+{
+	const int32 RowBegin = static_cast<int32>(std::min(InRowBegin, Height));
+	const int32 RowEnd = static_cast<int32>(std::min(InRowEnd, Height));
+	if (RowBegin >= RowEnd)
+	{
+		return;
+	}
+
+	for (const FScreenTriangle& Triangle : Triangles)
+	{
+		if (Triangle.MaxY < RowBegin || Triangle.MinY >= RowEnd)
+		{
+			continue;
+		}
+		RasterizeTriangle(Triangle, RowBegin, RowEnd);
+	}
+}
+
+/**
+ * @brief 삼각형 하나를 4픽셀 단위로 래스터화한다
+ * 세 변의 Edge Function이 모두 0 이상인 레인만 마스크로 남기고, 그 레인의 깊이를 min으로 갱신한다
+ */
+void FSoftwareOcclusionBuffer::RasterizeTriangle(const FScreenTriangle& InTriangle, int32 InRowBegin, int32 InRowEnd)
+{
+	// E_ij(P) = A * Px + B * Py + C (i -> j 변의 왼쪽이 양수)
+	__m128 EdgeA[3];
+	__m128 EdgeB[3];
+	__m128 EdgeC[3];
+	for (int32 Edge = 0; Edge < 3; ++Edge)
+	{
+		const int32 Next = (Edge + 1) % 3;
+		const float X0 = InTriangle.X[Edge];
+		const float Y0 = InTriangle.Y[Edge];
+		const float DeltaX = InTriangle.X[Next] - X0;
+		const float DeltaY = InTriangle.Y[Next] - Y0;
+
+		EdgeA[Edge] = _mm_set1_ps(-DeltaY);
+		EdgeB[Edge] = _mm_set1_ps(DeltaX);
+		EdgeC[Edge] = _mm_set1_ps(DeltaY * X0 - DeltaX * Y0);
+	}
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 TriangleDepth = _mm_set1_ps(InTriangle.MaxDepth);
+	const __m128 LaneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+
+	const int32 StartY = std::max(InTriangle.MinY, InRowBegin);
+	const int32 EndY = std::min(InTriangle.MaxY, InRowEnd - 1);
+	const int32 StartX = InTriangle.MinX & ~3;
+	const int32 EndX = InTriangle.MaxX;
+
+	for (int32 Y = StartY; Y <= EndY; ++Y)
+	{
+		const __m128 PixelY = _mm_set1_ps(static_cast<float>(Y) + 0.5f);
+		__m128 RowEdge[3];
+		for (int32 Edge = 0; Edge < 3; ++Edge)
+		{
+			RowEdge[Edge] = _mm_add_ps(_mm_mul_ps(EdgeB[Edge], PixelY), EdgeC[Edge]);
+		}
+
+		float* Row = Depth.data() + static_cast<size_t>(Y) * Width;
+		for (int32 X = StartX; X <= EndX; X += 4)
+		{
+			const __m128 PixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(X)), LaneOffset);
+
+			__m128 Inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(EdgeA[0], PixelX), RowEdge[0]), Zero);
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(EdgeA[1], PixelX), RowEdge[1]), Zero));
+			Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(EdgeA[2], PixelX), RowEdge[2]), Zero));
+
+			if (_mm_movemask_ps(Inside) == 0)
+			{
+				continue;
+			}
+
+			const __m128 OldDepth = _mm_loadu_ps(Row + X);
+			const __m128 NewDepth = _mm_min_ps(OldDepth, TriangleDepth);
+			_mm_storeu_ps(Row + X, _mm_or_ps(_mm_and_ps(Inside, NewDepth), _mm_andnot_ps(Inside, OldDepth)));
+		}
+	}
+}
+
+bool FSoftwareOcclusionBuffer::IsVisible(const FVector4& InNdcMin, const FVector4& InNdcMax) const
+{
+	// 버퍼가 없거나 박스가 유효하지 않으면 (예: 카메라 뒤) 보이는 것으로 처리한다
+	if (Depth.empty() || InNdcMin.X > InNdcMax.X || InNdcMin.Y > InNdcMax.Y)
+	{
+		return true;
+	}
+
+	const auto ToPixel = [](float InValue, uint32 InSize)
+	{
+		const int32 Pixel = static_cast<int32>(std::floor(InValue * static_cast<float>(InSize)));
+		return std::clamp(Pixel, 0, static_cast<int32>(InSize) - 1);
+	};
+
+	const int32 MinX = ToPixel(InNdcMin.X * 0.5f + 0.5f, Width);
+	const int32 MaxX = ToPixel(InNdcMax.X * 0.5f + 0.5f, Width);
+	const int32 MinY = ToPixel(0.5f - InNdcMax.Y * 0.5f, Height);
+	const int32 MaxY = ToPixel(0.5f - InNdcMin.Y * 0.5f, Height);
+
+	const __m128 NearestDepth = _mm_set1_ps(std::max(InNdcMin.Z, 0.0f));
+	const int32 StartX = MinX & ~3;
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const float* Row = Depth.data() + static_cast<size_t>(Y) * Width;
+		for (int32 X = StartX; X <= MaxX; X += 4)
+		{
+			int32 LaneMask = 0xF;
+			if (X < MinX)
+			{
+				LaneMask &= 0xF << (MinX - X);
+			}
+			if (X + 3 > MaxX)
+			{
+				LaneMask &= 0xF >> (X + 3 - MaxX);
+			}
+
+			const __m128 NotOccluded = _mm_cmple_ps(NearestDepth, _mm_loadu_ps(Row + X));
+			if (_mm_movemask_ps(NotOccluded) & LaneMask)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Render/Renderer/Public/RenderBackend.h"
+
+class UPipeline;
+class URenderer;
+
+/**
+ * @brief FDrawCommandList를 D3D11 호출로 재생하는 얇은 백엔드
+ * 상수 버퍼 슬롯 배치는 기존 RenderStaticMesh / RenderPrimitiveDefault 경로와 동일하다
+ * - Slot 0 (VS): Model, Slot 2 (VS): Color, Slot 2 (PS): Material, Slot 3 (PS): 드로우별 재질 값 (Time)
+ * - Vertex Buffer Slot 0: 위치, Slot 1: 쿠킹된 속성 (스태틱 메쉬), Slot 2: 인스턴스 스트림 (FInstanceData)
+ */
+class FD3D11RenderBackend : public IRenderBackend
+{
+public:
+	FD3D11RenderBackend(URenderer& InRenderer, UPipeline& InPipeline, ID3D11Buffer* InConstantBufferModels,
+		ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw);
+	~FD3D11RenderBackend() override;
+
+	void Release();
+
+	void BeginSubmit() override;
+
+	void SetPipelineState(const FDrawPipelineState& InPipelineState, bool bInInstanced) override;
+	bool SetMaterial(const FDrawMaterialBinding& InMaterial) override;
+	void SetMaterialTime(float InTime) override;
+	void SetGeometry(FRenderHandle InVertexBuffer, uint32 InStride, FRenderHandle InAttributeBuffer, uint32 InAttributeStride, FRenderHandle InIndexBuffer) override;
+	void SetTransform(const FMatrix& InWorldMatrix) override;
+	void SetColor(const FVector4& InColor) override;
+	void Draw(const FDrawCommand& InCommand) override;
+	bool SetInstanceData(const FInstanceData* InInstances, uint32 InNumInstances) override;
+	void DrawInstanced(const FDrawCommand& InCommand, uint32 InFirstInstance, uint32 InNumInstances) override;
+
+private:
+	bool ReserveInstanceBuffer(uint32 InNumInstances);
+	void ReleaseInstanceBuffer();
+	void ReleaseDestroyedMaterials();
+	ID3D11Buffer* FindOrUpdateMaterialBuffer(const FDrawMaterialBinding& InMaterial, bool& bOutUploaded);
+	void BindMaterialTextures(const FDrawMaterialBinding& InMaterial);
+
+	URenderer& Renderer;
+	UPipeline& Pipeline;
+
+	ID3D11Buffer* ConstantBufferModels = nullptr;
+	ID3D11Buffer* ConstantBufferColor = nullptr;
+	ID3D11Buffer* ConstantBufferMaterial = nullptr;
+	ID3D11Buffer* ConstantBufferMaterialDraw = nullptr;
+
+	// 재질(Key)별로 소유하는 상수 버퍼. Version이 바뀐 경우에만 UpdateSubresource로 다시 올린다
+	struct FMaterialBuffer
+	{
+		ID3D11Buffer* Buffer = nullptr;
+		uint64 Version = 0;
+	};
+	TMap<const void*, FMaterialBuffer> MaterialBuffers;
+	// FMaterialRenderProxy가 파괴되며 넘긴 Key를 모으는 임시 버퍼 (프레임 간 재사용)
+	TArray<const void*> ReleasedMaterialKeys;
+
+	// 제출 중 마지막으로 바인딩한 재질 리소스 (같은 슬롯에 같은 리소스를 다시 바인딩하지 않는다)
+	ID3D11Buffer* BoundMaterialBuffer = nullptr;
+	FRenderHandle BoundShaderResources[FDrawMaterialBinding::MAX_TEXTURE_SLOTS] = {};
+	FRenderHandle BoundSamplers[FDrawMaterialBinding::MAX_TEXTURE_SLOTS] = {};
+
+	// 프레임마다 WRITE_DISCARD로 다시 채우는 동적 인스턴스 버퍼 (부족할 때만 2배로 재생성)
+	ID3D11Buffer* InstanceBuffer = nullptr;
+	uint32 InstanceBufferCapacity = 0;
+};
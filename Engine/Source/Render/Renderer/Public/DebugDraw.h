@@ -0,0 +1,143 @@
+#pragma once
+#include "Global/Matrix.h"
+#include "Global/Vector.h"
+#include "Physics/Public/AABB.h"
+
+#include <mutex>
+
+/**
+ * @brief 디버그 선 정점 (BatchLineVS.hlsl 입력과 일치: POSITION 0, COLOR 16 바이트 오프셋)
+ * 정점 두 개가 선 하나 (LINELIST)
+ */
+struct FDebugLineVertex
+{
+	FVector Position;
+	FVector4 Color;
+};
+
+/**
+ * @brief 한 프레임 동안 계속 뒤에 붙이는 디버그 정점 배열
+ * FVector 생성자가 인라인되지 않아 정점마다 생성 비용이 크므로, 배열은 줄이지 않고 앞 NumVertices개만 유효한 것으로 쓴다
+ */
+struct FDebugLineStream
+{
+	TArray<FDebugLineVertex> Vertices;
+	uint32 NumVertices = 0;
+
+	/** 끝에 InNumVertices개 자리를 잡아 첫 정점을 돌려준다, 모자라면 두 배로 키운다 */
+	FDebugLineVertex* Append(uint32 InNumVertices);
+	void Reset() { NumVertices = 0; }
+
+	const FDebugLineVertex* GetData() const { return Vertices.data(); }
+	uint32 Num() const { return NumVertices; }
+};
+
+/**
+ * @brief 프레임이 지나도 남는 디버그 레이어, 내용을 바꿀 때만 다시 올린다
+ */
+enum class EDebugDrawLayer : uint8
+{
+	Grid,
+	Custom,
+
+	Count
+};
+
+/**
+ * @brief 즉시 모드 디버그 드로우 (D3D에 의존하지 않는다)
+ *
+ * 선, 박스, 구, 절두체, 광선을 어느 스레드에서든 넣을 수 있다
+ * 스레드마다 처음 그릴 때 만든 버퍼에 쌓고, 메인 스레드가 프레임마다 한 번 MergeFrame으로 모아 정점 스트림 하나로 만든다
+ * 한 프레임만 그리는 선(Transient)과 그리드처럼 계속 남는 레이어(Persistent)는 따로 보관하므로
+ * 레이어는 바뀔 때만 다시 올리고, 프레임 선은 개수와 상관없이 드로우 한 번으로 그릴 수 있다
+ */
+class FDebugDraw
+{
+public:
+	static void DrawLine(const FVector& InStart, const FVector& InEnd, const FVector4& InColor);
+	static void DrawBox(const FAABB& InBox, const FVector4& InColor);
+	/** 축마다 원 하나씩, 큰 원 세 개로 그린다 */
+	static void DrawSphere(const FVector& InCenter, float InRadius, const FVector4& InColor, uint32 InNumSegments = 16);
+	/** 뷰-프로젝션 역행렬로 NDC 상자(깊이 0~1)의 모서리 8개를 월드로 옮겨 그린다 */
+	static void DrawFrustum(const FMatrix& InViewProjectionInverse, const FVector4& InColor);
+	static void DrawRay(const FVector& InOrigin, const FVector& InDirection, float InLength, const FVector4& InColor);
+	/** 미리 만든 선 목록을 그대로 넣는다 (정점 수는 짝수) */
+	static void DrawLines(const FDebugLineVertex* InVertices, uint32 InNumVertices);
+
+	static void SetPersistentLayer(EDebugDrawLayer InLayer, TArray<FDebugLineVertex>&& InVertices);
+	static void ClearPersistentLayer(EDebugDrawLayer InLayer);
+
+	/**
+	 * @brief 메인 스레드 전용: 스레드 버퍼를 모두 비워 이번 프레임의 Transient 스트림을 만들고,
+	 * 레이어가 바뀌었으면 Persistent 스트림도 다시 만든다
+	 */
+	static void MergeFrame();
+
+	/** 아래 값은 MergeFrame 이후 다음 MergeFrame까지 유지된다 */
+	static const FDebugLineStream& GetTransientVertices() { return TransientVertices; }
+	static const TArray<FDebugLineVertex>& GetPersistentVertices() { return PersistentVertices; }
+	/** 레이어가 바뀌어 Persistent 스트림을 다시 만들 때마다 증가한다 */
+	static uint64 GetPersistentVersion() { return PersistentVersion; }
+	static uint64 GetFrameNumber() { return FrameNumber; }
+
+private:
+	/** 스레드 하나의 추가 버퍼, 소유 스레드가 쓰고 MergeFrame이 Pending과 Drained를 바꿔 가져간다 */
+	struct FThreadBuffer
+	{
+		std::mutex Mutex;
+		FDebugLineStream Pending;
+		FDebugLineStream Drained;
+	};
+
+	static FORCEINLINE FThreadBuffer& GetThreadBuffer()
+	{
+		static thread_local FThreadBuffer* ThreadBuffer = nullptr;
+		if (!ThreadBuffer)
+		{
+			ThreadBuffer = CreateThreadBuffer();
+		}
+		return *ThreadBuffer;
+	}
+
+	static FThreadBuffer* CreateThreadBuffer();
+
+	static std::mutex BufferMutex;
+	static TArray<std::unique_ptr<FThreadBuffer>> Buffers;
+
+	static std::mutex LayerMutex;
+	static TStaticArray<TArray<FDebugLineVertex>, static_cast<size_t>(EDebugDrawLayer::Count)> Layers;
+	static bool bLayersDirty;
+
+	static FDebugLineStream TransientVertices;
+	static TArray<FDebugLineVertex> PersistentVertices;
+	static uint64 PersistentVersion;
+	static uint64 FrameNumber;
+};
+
+/**
+ * @brief 동적 정점 버퍼를 링처럼 이어 쓰는 오프셋 계산기 (GPU 리소스는 소유하지 않는다)
+ * 남은 공간에 들어가면 NO_OVERWRITE로 이어 쓰고, 모자라면 처음으로 돌아가 DISCARD한다
+ * 한 번에 용량보다 많이 요청하면 두 배씩 키운 새 용량을 돌려주므로 호출자가 버퍼를 다시 만든다
+ */
+class FRingBufferAllocator
+{
+public:
+	struct FAllocation
+	{
+		uint32 FirstElement = 0;
+		bool bDiscard = false;
+		bool bResized = false;
+	};
+
+	explicit FRingBufferAllocator(uint32 InCapacity) : Capacity(InCapacity) {}
+
+	FAllocation Allocate(uint32 InNumElements);
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 GetNumWraps() const { return NumWraps; }
+
+private:
+	uint32 Capacity = 0;
+	uint32 Offset = 0;
+	uint32 NumWraps = 0;
+};
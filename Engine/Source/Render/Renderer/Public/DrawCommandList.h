@@ -0,0 +1,244 @@
+#pragma once
+#include "Global/Types.h"
+#include "Global/Matrix.h"
+#include "Global/CoreTypes.h"
+
+class IRenderBackend;
+
+/**
+ * @brief 백엔드에 독립적인 GPU 리소스 핸들
+ * D3D11 백엔드에서는 ID3D11* 포인터를 그대로 담고, Null 백엔드에서는 식별자로만 사용한다
+ */
+using FRenderHandle = void*;
+
+/**
+ * @brief 드로우 커맨드가 속하는 렌더 패스
+ * 정렬 키의 최상위 비트에 기록되므로 값이 작은 패스가 먼저 그려진다
+ */
+enum class EDrawPass : uint8
+{
+	Opaque = 0,
+	Translucent = 1,
+};
+
+/**
+ * @brief 드로우 커맨드가 참조하는 파이프라인 상태 묶음
+ * FPipelineInfo와 동일한 구성이지만 D3D11 타입에 의존하지 않는다
+ */
+struct FDrawPipelineState
+{
+	FRenderHandle InputLayout = nullptr;
+	FRenderHandle VertexShader = nullptr;
+	FRenderHandle RasterizerState = nullptr;
+	FRenderHandle DepthStencilState = nullptr;
+	FRenderHandle PixelShader = nullptr;
+	FRenderHandle BlendState = nullptr;
+	uint32 Topology = 0;
+
+	/** 인스턴싱 변형. InstancedVertexShader가 없으면 해당 파이프라인은 인스턴싱하지 않는다 */
+	FRenderHandle InstancedInputLayout = nullptr;
+	FRenderHandle InstancedVertexShader = nullptr;
+	FRenderHandle InstancedPixelShader = nullptr;
+
+	bool SupportsInstancing() const { return InstancedVertexShader != nullptr; }
+
+	bool operator==(const FDrawPipelineState& InOther) const
+	{
+		return InputLayout == InOther.InputLayout && VertexShader == InOther.VertexShader &&
+			RasterizerState == InOther.RasterizerState && DepthStencilState == InOther.DepthStencilState &&
+			PixelShader == InOther.PixelShader && BlendState == InOther.BlendState && Topology == InOther.Topology &&
+			InstancedInputLayout == InOther.InstancedInputLayout && InstancedVertexShader == InOther.InstancedVertexShader &&
+			InstancedPixelShader == InOther.InstancedPixelShader;
+	}
+};
+
+/**
+ * @brief 재질 상수와 텍스처 바인딩 묶음
+ * Key가 있으면 백엔드가 재질별 상수 버퍼를 캐시하고 Version이 바뀔 때만 다시 업로드한다
+ * @note Slot 0: Diffuse, 1: Ambient, 2: Specular, 4: Alpha (TextureShader.hlsl 기준)
+ */
+struct FDrawMaterialBinding
+{
+	static constexpr uint32 MAX_TEXTURE_SLOTS = 5;
+
+	const void* Key = nullptr;
+	uint64 Version = 0;
+
+	FMaterialConstants Constants = {};
+	FRenderHandle ShaderResources[MAX_TEXTURE_SLOTS] = {};
+	FRenderHandle Samplers[MAX_TEXTURE_SLOTS] = {};
+};
+
+/**
+ * @brief 정렬 가능한 단일 드로우 커맨드
+ * 무거운 데이터(파이프라인, 재질, 트랜스폼)는 FDrawCommandList의 테이블에 두고 인덱스만 보관한다
+ */
+struct FDrawCommand
+{
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	uint64 SortKey = 0;
+
+	uint32 PipelineIndex = 0;
+	uint32 MaterialIndex = INVALID_INDEX;
+	uint32 TransformIndex = 0;
+	uint32 MeshIndex = 0;
+
+	FRenderHandle VertexBuffer = nullptr;
+	FRenderHandle IndexBuffer = nullptr;
+	uint32 VertexStride = 0;
+	/** 쿠킹된 메쉬의 속성 스트림 (노멀, UV). FNormalVertex를 쓰는 프리미티브는 nullptr */
+	FRenderHandle AttributeBuffer = nullptr;
+	uint32 AttributeStride = 0;
+	uint32 VertexCount = 0;
+	uint32 IndexCount = 0;
+	uint32 StartIndex = 0;
+
+	/** Default 셰이더용 색상. 재질이 없는 프리미티브에서만 사용된다 */
+	FVector4 Color = FVector4(1.0f, 1.0f, 1.0f, 1.0f);
+	bool bUseColor = false;
+
+	/** 재질 상수와 분리된 드로우별 값 (스크롤 시간). 재질이 있는 커맨드에서만 사용된다 */
+	float MaterialTime = 0.0f;
+
+	/** 같은 인스턴싱 그룹으로 묶일 수 있는지 (트랜스폼/색상을 제외한 모든 상태가 같은지) */
+	bool CanInstanceWith(const FDrawCommand& InOther) const
+	{
+		return PipelineIndex == InOther.PipelineIndex && MaterialIndex == InOther.MaterialIndex &&
+			VertexBuffer == InOther.VertexBuffer && IndexBuffer == InOther.IndexBuffer &&
+			VertexStride == InOther.VertexStride && AttributeBuffer == InOther.AttributeBuffer &&
+			AttributeStride == InOther.AttributeStride && VertexCount == InOther.VertexCount &&
+			IndexCount == InOther.IndexCount && StartIndex == InOther.StartIndex && bUseColor == InOther.bUseColor &&
+			MaterialTime == InOther.MaterialTime;
+	}
+};
+
+/**
+ * @brief 인스턴스 스트림(Vertex Buffer Slot 2)에 기록되는 인스턴스별 데이터
+ */
+struct FInstanceData
+{
+	FMatrix World;
+	FVector4 Color;
+};
+
+/**
+ * @brief 정렬된 커맨드 중 하나의 드로우 콜로 제출되는 구간
+ * NumInstances가 1이면 일반 드로우, 2 이상이면 InstanceData[FirstInstance...]를 사용하는 인스턴싱 드로우
+ */
+struct FDrawBatch
+{
+	uint32 CommandIndex = 0;
+	uint32 FirstInstance = 0;
+	uint32 NumInstances = 1;
+};
+
+/**
+ * @brief 한 프레임(뷰포트) 동안의 드로우 제출 통계
+ */
+struct FDrawStats
+{
+	uint32 NumCommands = 0;
+	uint32 NumDrawCalls = 0;
+	uint32 NumPipelineChanges = 0;
+	uint32 NumMaterialChanges = 0;
+	uint32 NumGeometryChanges = 0;
+	uint32 NumConstantUpdates = 0;
+	uint32 NumInstancedDraws = 0;
+	uint32 NumInstances = 0;
+	uint32 NumBufferMaps = 0;
+
+	uint32 GetTotalStateChanges() const
+	{
+		return NumPipelineChanges + NumMaterialChanges + NumGeometryChanges + NumConstantUpdates;
+	}
+
+	FDrawStats& operator+=(const FDrawStats& InOther)
+	{
+		NumCommands += InOther.NumCommands;
+		NumDrawCalls += InOther.NumDrawCalls;
+		NumPipelineChanges += InOther.NumPipelineChanges;
+		NumMaterialChanges += InOther.NumMaterialChanges;
+		NumGeometryChanges += InOther.NumGeometryChanges;
+		NumConstantUpdates += InOther.NumConstantUpdates;
+		NumInstancedDraws += InOther.NumInstancedDraws;
+		NumInstances += InOther.NumInstances;
+		NumBufferMaps += InOther.NumBufferMaps;
+		return *this;
+	}
+};
+
+/**
+ * @brief 프레임 동안 기록된 드로우 커맨드를 정렬 후 백엔드로 재생하는 리스트
+ *
+ * 64-bit 정렬 키 레이아웃 (상위 비트부터)
+ * - Opaque      : Pass(4) | Pipeline(12) | Material(16) | Mesh(16) | Depth(16, front-to-back)
+ * - Translucent : Pass(4) | Depth(16, back-to-front) | Pipeline(12) | Material(16) | Mesh(16)
+ *
+ * Mesh는 (Vertex Buffer, 시작 인덱스) 단위이므로 같은 메쉬 섹션의 커맨드가 정렬 후 연속으로 놓이고,
+ * BuildBatches가 이 연속 구간을 하나의 인스턴싱 드로우로 묶는다
+ *
+ * 키 필드보다 많은 파이프라인/재질/메쉬가 한 프레임에 들어오면 Debug에서는 assert로 알리고,
+ * Release에서는 넘친 인덱스를 필드 최대값으로 모은다 (정렬 순서는 유지되고 묶음 효율만 떨어진다)
+ */
+class FDrawCommandList
+{
+public:
+	static constexpr uint32 MAX_SORT_PIPELINES = 1u << 12;
+	// 재질 필드는 재질 없음(0)을 위해 하나를 비워 둔다
+	static constexpr uint32 MAX_SORT_MATERIALS = (1u << 16) - 1;
+	static constexpr uint32 MAX_SORT_MESHES = 1u << 16;
+
+	void Reset();
+
+	uint32 FindOrAddPipeline(const FDrawPipelineState& InPipelineState);
+	uint32 FindOrAddMesh(FRenderHandle InVertexBuffer, uint32 InStartIndex = 0);
+	uint32 AddMaterial(const FDrawMaterialBinding& InBinding);
+	uint32 AddTransform(const FMatrix& InWorldMatrix);
+
+	void AddCommand(FDrawCommand& InCommand, EDrawPass InPass, float InViewDepth, float InMaxDepth);
+
+	void Sort();
+	void BuildBatches(bool bInEnableInstancing);
+	void Submit(IRenderBackend& InBackend, FDrawStats& OutStats) const;
+
+	static uint64 MakeSortKey(EDrawPass InPass, uint32 InPipelineIndex, uint32 InMaterialIndex, uint32 InMeshIndex, uint16 InDepth);
+	static uint16 QuantizeDepth(float InViewDepth, float InMaxDepth);
+	static void RadixSort(TArray<TPair<uint64, uint32>>& InOutEntries, TArray<TPair<uint64, uint32>>& InScratch);
+
+	const TArray<FDrawCommand>& GetCommands() const { return Commands; }
+	const TArray<FDrawPipelineState>& GetPipelines() const { return Pipelines; }
+	const TArray<FDrawMaterialBinding>& GetMaterials() const { return Materials; }
+	const TArray<FMatrix>& GetTransforms() const { return Transforms; }
+	const TArray<FDrawBatch>& GetBatches() const { return Batches; }
+	const TArray<FInstanceData>& GetInstanceData() const { return InstanceData; }
+	size_t Num() const { return Commands.size(); }
+	bool IsEmpty() const { return Commands.empty(); }
+
+private:
+	TArray<FDrawCommand> Commands;
+	TArray<FDrawPipelineState> Pipelines;
+	TArray<FDrawMaterialBinding> Materials;
+	TArray<FMatrix> Transforms;
+
+	TArray<FDrawBatch> Batches;
+	TArray<FInstanceData> InstanceData;
+
+	struct FMeshKeyHasher
+	{
+		size_t operator()(const TPair<FRenderHandle, uint32>& InKey) const noexcept
+		{
+			size_t H = std::hash<FRenderHandle>()(InKey.first);
+			H ^= static_cast<size_t>(InKey.second) + 0x9e3779b97f4a7c15ULL + (H << 6) + (H >> 2);
+			return H;
+		}
+	};
+
+	TFlatMap<TPair<FRenderHandle, uint32>, uint32, FMeshKeyHasher> MeshIndices;
+	TFlatMap<const void*, uint32> MaterialIndices;
+
+	// 정렬용 임시 버퍼 (프레임 간 재사용)
+	TArray<TPair<uint64, uint32>> SortEntries;
+	TArray<TPair<uint64, uint32>> SortScratch;
+	TArray<FDrawCommand> SortedCommands;
+};
@@ -0,0 +1,69 @@
+#pragma once
+#include "Render/Renderer/Public/RenderBackend.h"
+
+/**
+ * @brief GPU 없이 동작하는 기록용 백엔드
+ * 백엔드 호출 순서와 횟수만 남기므로 정렬/배칭/상태 변경 수를 디바이스 없이 검증하거나 측정할 수 있다
+ */
+class FNullRenderBackend : public IRenderBackend
+{
+public:
+	enum class ECall : uint8
+	{
+		SetPipelineState,
+		SetMaterial,
+		SetMaterialTime,
+		SetGeometry,
+		SetTransform,
+		SetColor,
+		Draw,
+		SetInstanceData,
+		DrawInstanced,
+	};
+
+	void BeginSubmit() override;
+	void SetPipelineState(const FDrawPipelineState& InPipelineState, bool bInInstanced) override;
+	bool SetMaterial(const FDrawMaterialBinding& InMaterial) override;
+	void SetMaterialTime(float InTime) override;
+	void SetGeometry(FRenderHandle InVertexBuffer, uint32 InStride, FRenderHandle InAttributeBuffer, uint32 InAttributeStride, FRenderHandle InIndexBuffer) override;
+	void SetTransform(const FMatrix& InWorldMatrix) override;
+	void SetColor(const FVector4& InColor) override;
+	void Draw(const FDrawCommand& InCommand) override;
+	bool SetInstanceData(const FInstanceData* InInstances, uint32 InNumInstances) override;
+	void DrawInstanced(const FDrawCommand& InCommand, uint32 InFirstInstance, uint32 InNumInstances) override;
+
+	void Reset();
+
+	uint32 GetNumCalls(ECall InCall) const { return CallCounts[static_cast<uint8>(InCall)]; }
+	const TArray<ECall>& GetRecordedCalls() const { return RecordedCalls; }
+	const TArray<uint64>& GetRecordedSortKeys() const { return RecordedSortKeys; }
+	const TArray<FInstanceData>& GetUploadedInstances() const { return UploadedInstances; }
+	uint32 GetNumDrawnInstances() const { return NumDrawnInstances; }
+	uint32 GetNumMaterialUploads() const { return NumMaterialUploads; }
+	uint32 GetNumCachedMaterials() const { return static_cast<uint32>(UploadedMaterialVersions.size()); }
+
+	void SetRecordCalls(bool bInRecordCalls) { bRecordCalls = bInRecordCalls; }
+	/** 인스턴스 버퍼 생성/Map 실패를 흉내낸다 */
+	void SetFailInstanceUploads(bool bInFail) { bFailInstanceUploads = bInFail; }
+
+private:
+	void Record(ECall InCall);
+
+	static constexpr uint8 NUM_CALL_TYPES = static_cast<uint8>(ECall::DrawInstanced) + 1;
+
+	uint32 CallCounts[NUM_CALL_TYPES] = {};
+	TArray<ECall> RecordedCalls;
+	TArray<uint64> RecordedSortKeys;
+	TArray<FInstanceData> UploadedInstances;
+	uint32 NumDrawnInstances = 0;
+
+	// D3D11 백엔드와 같은 규칙으로 재질별 업로드 여부를 흉내낸다 (Key -> 마지막으로 올린 Version)
+	// 파괴된 재질의 항목은 D3D11 백엔드처럼 제출 시작 때 지운다
+	TMap<const void*, uint64> UploadedMaterialVersions;
+	TArray<const void*> ReleasedMaterialKeys;
+	uint32 NumMaterialUploads = 0;
+
+	// 벤치마크에서는 카운트만 남기고 호출 기록은 끈다
+	bool bRecordCalls = true;
+	bool bFailInstanceUploads = false;
+};
@@ -1,15 +1,26 @@
 #pragma once
 
-#include <bitset>
-
 #include <d3d11.h>
 
 #include "Global/Types.h"
 #include "Global/Vector.h"
 #include "Core/Public/Object.h"
 #include "Core/Public/ObjectPtr.h"
+#include "Render/Renderer/Public/SoftwareOcclusionBuffer.h"
 
 class UPrimitiveComponent;
+class UCamera;
+
+/**
+ * @brief 오클루전 컬링 방식
+ * - HiZ: 이전 프레임 깊이로 GPU Compute에서 검사 (한 프레임 늦고, Flush가 필요)
+ * - Software: 큰 오클루더를 CPU 저해상도 깊이 버퍼에 래스터화해 같은 프레임에 검사
+ */
+enum class EOcclusionBackend : uint8
+{
+	HiZ,
+	Software,
+};
 
 struct FBoundingVolume
 {
@@ -43,6 +54,7 @@ public:
 
 		ReleaseHiZResource();
 		CreateHiZResource(Device);
+		ResizeSoftwareOcclusionBuffer();
 	}
 
 	void BuildScreenSpaceBoundingVolumes(ID3D11DeviceContext* InDeviceContext, UCamera* InCamera, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents);
@@ -51,11 +63,44 @@ public:
 
 	void OcclusionTest(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext);
 
+	/**
+	 * @brief Software Occlusion: 오클루더를 래스터화하고 BuildScreenSpaceBoundingVolumes의 결과를 같은 프레임에 검사한다
+	 * @note BuildScreenSpaceBoundingVolumes 이후에 호출해야 한다
+	 */
+	void SoftwareOcclusionTest(UCamera* InCamera, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents);
+
+	/**
+	 * @brief 프리미티브에 씬 슬롯을 할당한다 (이미 슬롯이 있으면 무시)
+	 * 가시성 이력은 슬롯으로 인덱싱되는 조밀한 배열에 저장되며, 해제된 슬롯은 재사용된다
+	 * @note 렌더링 중(워커 스레드가 이력을 읽는 동안)에는 호출하지 않는다
+	 */
+	void RegisterPrimitive(UPrimitiveComponent* InPrimitiveComponent);
+	void UnregisterPrimitive(UPrimitiveComponent* InPrimitiveComponent);
+
+	/** @brief 슬롯 인덱스로 읽기만 하므로 워커 스레드에서 동시에 호출해도 안전하다 */
 	bool IsPrimitiveVisible(const UPrimitiveComponent* InPrimitiveComponent) const;
 
+	EOcclusionBackend GetBackend() const { return Backend; }
+	void SetBackend(EOcclusionBackend InBackend);
+
+	const FSoftwareOcclusionBuffer& GetSoftwareOcclusionBuffer() const { return SoftwareOcclusionBuffer; }
+	uint32 GetNumSoftwareOccluders() const { return NumSoftwareOccluders; }
+	uint32 GetNumSoftwareCulled() const { return NumSoftwareCulled; }
+	uint32 GetNumSceneSlots() const { return static_cast<uint32>(VisibilityHistory.size() - FreeSceneSlots.size()); }
+
 private:
-	static constexpr size_t NUM_WORKER_THREADS = 8;
+	// 잡 시스템 ParallelFor의 최소 분할 단위
+	static constexpr uint32 BOUNDING_VOLUME_BATCH_SIZE = 64;
+	static constexpr uint32 RASTER_ROW_BATCH_SIZE = 16;
+	static constexpr uint32 VISIBILITY_TEST_BATCH_SIZE = 64;
 	static constexpr size_t OCCLUSION_HISTORY_SIZE = 4;
+	static constexpr uint8 OCCLUSION_HISTORY_MASK = (1u << OCCLUSION_HISTORY_SIZE) - 1;
+	static_assert(OCCLUSION_HISTORY_SIZE <= 8, "Occlusion history must fit in uint8");
+
+	/** Software Occlusion 오클루더 선택 기준 */
+	static constexpr size_t MAX_SOFTWARE_OCCLUDERS = 32;
+	static constexpr uint32 MAX_SOFTWARE_OCCLUDER_TRIANGLES = 16384;
+	static constexpr float MIN_SOFTWARE_OCCLUDER_SCREEN_AREA = 0.01f; // 화면 면적 대비 비율
 
 	void CreateShader(ID3D11Device* InDevice);
 	void CreateHiZResource(ID3D11Device* InDevice);
@@ -65,6 +110,9 @@ private:
 
 	void ProcessBoundingVolume(size_t InStartIndex, size_t InEndIndex, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents, const FMatrix& InViewProjMatrix);
 
+	void ResizeSoftwareOcclusionBuffer();
+	void AddSoftwareOccluders(const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents, const FMatrix& InViewProjMatrix);
+
 
 	/** @note: UOcclusionRenderer에서는 Device와 DeviceContext의 수명을 관리하지 않음*/
 	ID3D11Device* Device = nullptr;
@@ -95,7 +143,7 @@ private:
 	[[deprecated]] ID3D11Buffer* BoundingVolumeBuffer = nullptr;
 	[[deprecated]] ID3D11ShaderResourceView* BoundingVolumeShaderResourceView = nullptr;
 	TArray<FBoundingVolume> BoundingVolumes;
-	TArray<uint32> PrimitiveComponentUUIDs;
+	TArray<uint32> PrimitiveSceneSlots;
 
 	ID3D11Buffer* HiZOcclusionConstantBuffer = nullptr;
 	ID3D11SamplerState* HiZSamplerState = nullptr;
@@ -103,7 +151,15 @@ private:
 	uint32 Width;
 	uint32 Height;
 
-	TMap<uint32, std::bitset<OCCLUSION_HISTORY_SIZE>> VisibilityHistory;
-
-	//ThreadPool Pool;
+	/** @brief: 씬 슬롯별 가시성 이력 (하위 OCCLUSION_HISTORY_SIZE 비트, 모두 0이면 최근 프레임 동안 계속 가려짐) */
+	TArray<uint8> VisibilityHistory;
+	TArray<uint32> FreeSceneSlots;
+
+	/** @brief: Software occlusion resources */
+	EOcclusionBackend Backend = EOcclusionBackend::HiZ;
+	FSoftwareOcclusionBuffer SoftwareOcclusionBuffer;
+	TArray<FVector4> OccluderClipVertices;
+	TArray<uint8> SoftwareVisibility;
+	uint32 NumSoftwareOccluders = 0;
+	uint32 NumSoftwareCulled = 0;
 };
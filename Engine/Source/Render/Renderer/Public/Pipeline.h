@@ -23,6 +23,15 @@ public:
 
 	void SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride);
 
+	void SetAttributeBuffer(ID3D11Buffer* AttributeBuffer, uint32 Stride);
+
+	void SetInstanceBuffer(ID3D11Buffer* InstanceBuffer, uint32 Stride);
+
+	/** @brief 정점 스트림 슬롯: 위치(또는 FNormalVertex) / 쿠킹된 속성 / 인스턴스 */
+	static constexpr uint32 VERTEX_SLOT = 0;
+	static constexpr uint32 ATTRIBUTE_SLOT = 1;
+	static constexpr uint32 INSTANCE_SLOT = 2;
+
 	void SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer);
 
 	void SetTexture(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* Srv);
@@ -33,6 +42,10 @@ public:
 
 	void DrawIndexed(uint32 indexCount, uint32 startIndexLocation, uint32 baseVertexLocation);
 
+	void DrawInstanced(uint32 VertexCount, uint32 InstanceCount, uint32 StartVertexLocation, uint32 StartInstanceLocation);
+
+	void DrawIndexedInstanced(uint32 IndexCount, uint32 InstanceCount, uint32 StartIndexLocation, uint32 StartInstanceLocation);
+
 	ID3D11DeviceContext* GetDeviceContext() const { return DeviceContext; }
 
 private:
@@ -0,0 +1,32 @@
+#pragma once
+#include "Render/Renderer/Public/DrawCommandList.h"
+
+/**
+ * @brief FDrawCommandList를 실제 그래픽스 API 호출로 재생하는 백엔드 인터페이스
+ * FDrawCommandList::Submit이 중복 상태를 걸러낸 뒤 변경이 필요한 경우에만 호출한다
+ */
+class IRenderBackend
+{
+public:
+	virtual ~IRenderBackend() = default;
+
+	virtual void BeginSubmit() {}
+	virtual void EndSubmit() {}
+
+	virtual void SetPipelineState(const FDrawPipelineState& InPipelineState, bool bInInstanced) = 0;
+	/** @return 재질 상수를 실제로 업로드했으면 true (캐시된 상수를 다시 바인딩만 했으면 false) */
+	virtual bool SetMaterial(const FDrawMaterialBinding& InMaterial) = 0;
+	virtual void SetMaterialTime(float InTime) = 0;
+	/** 위치(또는 FNormalVertex) 스트림과, 쿠킹된 메쉬라면 속성 스트림을 함께 바인딩한다 (없으면 nullptr) */
+	virtual void SetGeometry(FRenderHandle InVertexBuffer, uint32 InStride, FRenderHandle InAttributeBuffer, uint32 InAttributeStride, FRenderHandle InIndexBuffer) = 0;
+	virtual void SetTransform(const FMatrix& InWorldMatrix) = 0;
+	virtual void SetColor(const FVector4& InColor) = 0;
+	virtual void Draw(const FDrawCommand& InCommand) = 0;
+
+	/**
+	 * 프레임의 인스턴스 스트림 전체를 한 번에 업로드한다 (Submit당 최대 1회)
+	 * @return 업로드와 바인딩에 성공했으면 true, 실패하면 Submit은 인스턴싱 배치를 개별 드로우로 제출한다
+	 */
+	virtual bool SetInstanceData(const FInstanceData* InInstances, uint32 InNumInstances) = 0;
+	virtual void DrawInstanced(const FDrawCommand& InCommand, uint32 InFirstInstance, uint32 InNumInstances) = 0;
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include "Render/Renderer/Public/DrawCommandList.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief 뷰포트 하나의 렌더 스냅샷
+ * 게임 스레드가 채운 뒤에는 렌더 스레드만 읽으므로 컴포넌트나 카메라 객체를 가리키지 않고 값만 복사해 둔다
+ */
+struct FRenderViewSnapshot
+{
+	FRect Viewport;
+	FViewProjConstants ViewProj;
+	FVector CameraLocation;
+	float FarClip = 1000.0f;
+
+	// 가시 프리미티브의 트랜스폼 / 메쉬 / 재질 / 파이프라인 핸들 (정렬과 배칭은 렌더 스레드에서)
+	FDrawCommandList DrawCommands;
+
+	// 렌더 스레드가 제출하면서 채운다
+	FDrawStats Stats;
+};
+
+/**
+ * @brief 한 프레임의 렌더 스냅샷 (뷰포트별)
+ * 슬롯과 뷰 배열은 프레임 간 재사용되므로 스냅샷을 만드는 데 매 프레임 할당이 일어나지 않는다
+ */
+struct FRenderFrame
+{
+	uint64 FrameNumber = 0;
+	float DeltaSeconds = 0.0f;
+
+	/** 이전 프레임이 쓰던 뷰 슬롯을 비워 돌려준다 */
+	FRenderViewSnapshot& AddView();
+
+	uint32 GetNumViews() const { return NumViews; }
+	FRenderViewSnapshot& GetView(uint32 InIndex) { return Views[InIndex]; }
+	const FRenderViewSnapshot& GetView(uint32 InIndex) const { return Views[InIndex]; }
+
+	void Reset(uint64 InFrameNumber, float InDeltaSeconds);
+
+private:
+	TArray<FRenderViewSnapshot> Views;
+	uint32 NumViews = 0;
+};
+
+/**
+ * @brief 게임 스레드가 만든 프레임 스냅샷을 받아 제출하는 렌더 스레드
+ *
+ * 게임 스레드는 BeginFrame으로 빈 슬롯을 받아 스냅샷을 채우고 EndFrame으로 넘긴 뒤 바로 다음 프레임으로 넘어간다
+ * 렌더 스레드는 넘겨받은 순서대로 RenderFunction을 호출한다
+ * 슬롯은 MAX_FRAMES_IN_FLIGHT개뿐이라 렌더 스레드가 밀리면 게임 스레드가 BeginFrame에서 기다린다 (입력 지연 상한)
+ *
+ * Start하지 않으면 EndFrame에서 RenderFunction을 바로 호출하므로 같은 코드가 단일 스레드로도 동작한다
+ *
+ * @note 헤드리스 러너(Null 백엔드)는 스레드 모드로, D3D11 에디터(URenderer)는 아직 인라인 모드로 쓴다
+ * ID3D11DeviceContext가 스레드 안전하지 않으므로 에디터를 스레드 모드로 돌리려면 에디터 프리미티브, 빌보드/텍스트,
+ * ImGui 그리기 데이터, Present까지 모두 스냅샷으로 옮겨 렌더 스레드 한 곳에서만 컨텍스트를 쓰도록 해야 한다
+ */
+class FRenderThread
+{
+public:
+	static constexpr uint32 MAX_FRAMES_IN_FLIGHT = 2;
+
+	using FRenderFunction = std::function<void(FRenderFrame&)>;
+
+	~FRenderThread();
+
+	/** @param bInUseThread false면 스레드 없이 EndFrame에서 즉시 렌더링한다 */
+	void Start(FRenderFunction InRenderFunction, bool bInUseThread = true);
+	/** 남은 프레임을 모두 제출하고 스레드를 멈춘다 */
+	void Stop();
+
+	FRenderFrame& BeginFrame(uint64 InFrameNumber, float InDeltaSeconds);
+	void EndFrame();
+
+	/** 넘긴 프레임이 모두 제출될 때까지 기다린다 (리소스 해제, 리사이즈 전) */
+	void Flush();
+
+	bool IsThreaded() const { return Thread.joinable(); }
+
+	/** 빈 슬롯을 기다리느라 게임 스레드가 멈춘 누적 시간 */
+	double GetGameThreadWaitMs() const { return GameThreadWaitMs; }
+	uint64 GetNumRenderedFrames();
+
+private:
+	void ThreadMain();
+
+	FRenderFunction RenderFunction;
+	std::thread Thread;
+
+	FRenderFrame Frames[MAX_FRAMES_IN_FLIGHT];
+	// 단조 증가 카운터, 슬롯은 카운터 % MAX_FRAMES_IN_FLIGHT
+	uint64 NumWrittenFrames = 0;
+	uint64 NumRenderedFrames = 0;
+	bool bWriting = false;
+	bool bStopping = false;
+
+	std::mutex QueueMutex;
+	std::condition_variable FrameWritten;
+	std::condition_variable FrameRendered;
+
+	double GameThreadWaitMs = 0.0;
+};
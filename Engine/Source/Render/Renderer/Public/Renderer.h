@@ -9,6 +9,8 @@
 #include "Core/Public/Object.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Editor/Public/EditorPrimitive.h"
+#include "Render/Renderer/Public/DrawCommandList.h"
+#include "Render/Renderer/Public/RenderThread.h"
 
 class UPipeline;
 class UDeviceResources;
@@ -22,6 +24,7 @@ class UFontRenderer;
 class FViewport;
 class UCamera;
 class FViewportClient;
+class FD3D11RenderBackend;
 
 /**
  * @brief Rendering Pipeline 전반을 처리하는 클래스
@@ -77,15 +80,17 @@ public:
 	// Render
 	void Tick(float DeltaSeconds);
 	void RenderBegin() const;
-	void RenderLevel(UCamera* InCurrentCamera, FViewportClient& InViewportClient);
 	void RenderEnd() const;
-	void RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferMaterial);
+	void RenderStaticMesh(UPipeline& InPipeline, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw);
 	void RenderBillboard(UBillboardComponent* InBillboardComp, UCamera* InCurrentCamera);
-	void RenderText(UTextRenderComponent* InBillBoardComp, UCamera* InCurrentCamera);
+	void RenderTexts(const TArray<TObjectPtr<UTextRenderComponent>>& InTextRenderComps, UCamera* InCurrentCamera);
+	void RenderText(UTextRenderComponent* InTextRenderComp, UCamera* InCurrentCamera);
 	void RenderPrimitiveDefault(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComp, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor);
 	void RenderEditorPrimitive(UPipeline& InPipeline, const FEditorPrimitive& InEditorPrimitive, const FRenderState& InRenderState);
 	void RenderEditorPrimitiveIndexed(UPipeline& InPipeline, const FEditorPrimitive& InEditorPrimitive, const FRenderState& InRenderState,
 	                            bool bInUseBaseConstantBuffer, uint32 InStride, uint32 InIndexBufferStride);
+	void RenderEditorPrimitiveRange(UPipeline& InPipeline, const FEditorPrimitive& InEditorPrimitive, const FRenderState& InRenderState,
+	                            uint32 InStride, uint32 InStartVertex);
 
 	void OnResize(uint32 Inwidth = 0, uint32 InHeight = 0);
 
@@ -93,7 +98,7 @@ public:
 	void CreateVertexShaderAndInputLayout(const wstring& InFilePath,
 		const TArray<D3D11_INPUT_ELEMENT_DESC>& InInputLayoutDescriptions,
 		ID3D11VertexShader** OutVertexShader, ID3D11InputLayout** OutInputLayout);
-	ID3D11Buffer* CreateVertexBuffer(FNormalVertex* InVertices, uint32 InByteWidth) const;
+	ID3D11Buffer* CreateVertexBuffer(const void* InVertices, uint32 InByteWidth) const;
 	ID3D11Buffer* CreateVertexBuffer(FVector* InVertices, uint32 InByteWidth, bool bCpuAccess) const;
 	ID3D11Buffer* CreateIndexBuffer(const void* InIndices, uint32 InByteWidth) const;
 	void CreatePixelShader(const wstring& InFilePath, ID3D11PixelShader** InPixelShader) const;
@@ -105,6 +110,7 @@ public:
 	void UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const FMatrix& InMatrix) const;
 	void UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const FVector4& InColor) const;
 	void UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const FMaterialConstants& InMaterial) const;
+	void UpdateConstant(ID3D11DeviceContext* InDeviceContext, ID3D11Buffer* InConstantBuffer, const FMaterialDrawConstants& InDrawConstants) const;
 
 	static void ReleaseVertexBuffer(ID3D11Buffer* InVertexBuffer);
 	static void ReleaseIndexBuffer(ID3D11Buffer* InIndexBuffer);
@@ -122,21 +128,55 @@ public:
 	FViewport* GetViewportClient() const { return ViewportClient; }
 	bool GetIsResizing() const { return bIsResizing; }
 	bool GetOcclusionCullingEnabled() const { return bOcclusionCulling; }
+	bool GetInstancingEnabled() const { return bInstancing; }
+	const FDrawStats& GetFrameDrawStats() const { return FrameDrawStats; }
 
 	void SetIsResizing(bool isResizing) { bIsResizing = isResizing; }
 	void SetOcclusionCullingEnabled(bool bEnabled) { bOcclusionCulling = bEnabled; }
+	void SetInstancingEnabled(bool bEnabled) { bInstancing = bEnabled; }
 	void ResetOcclusionCullingState() { bIsFirstPass = true; }
 
 private:
+	/**
+	 * @brief 스냅샷에 아직 담지 못한 뷰포트별 에디터 그리기 대상 (FRenderFrame의 뷰와 같은 순서)
+	 * 게임 스레드 객체를 가리키므로 렌더 스레드가 인라인 모드일 때만 제출 단계에서 쓸 수 있다
+	 */
+	struct FEditorViewContext
+	{
+		FViewportClient* ViewportClient = nullptr;
+		UCamera* Camera = nullptr;
+		TArray<TObjectPtr<UBillboardComponent>> Billboards;
+		TArray<TObjectPtr<UTextRenderComponent>> TextRenders;
+	};
+
+	TArray<TObjectPtr<UPrimitiveComponent>> GatherVisiblePrimitives(UCamera* InCurrentCamera);
 	void PerformOcclusionCulling(UCamera* InCurrentCamera, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents);
-	void RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial);
-	void RenderLevel_SingleThreaded(UCamera* InCurrentCamera, FViewportClient& InViewportClient, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents);
+	void RenderPrimitiveComponent(UPipeline& InPipeline, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, ID3D11Buffer* InConstantBufferModels, ID3D11Buffer* InConstantBufferColor, ID3D11Buffer* InConstantBufferMaterial, ID3D11Buffer* InConstantBufferMaterialDraw);
 	void RenderLevel_MultiThreaded(UCamera* InCurrentCamera, FViewportClient& InViewportClient, const TArray<TObjectPtr<UPrimitiveComponent>>& InPrimitiveComponents);
+
+	// Draw command recording (게임 스레드)
+	void RecordLevel(UCamera* InCurrentCamera, FDrawCommandList& OutDrawCommands, FEditorViewContext& OutEditorView);
+	void RecordPrimitiveComponent(FDrawCommandList& OutDrawCommands, UPrimitiveComponent* InPrimitiveComponent, ID3D11RasterizerState* InRasterizerState, UCamera* InCurrentCamera);
+	void RecordStaticMesh(FDrawCommandList& OutDrawCommands, UStaticMeshComponent* InMeshComp, ID3D11RasterizerState* InRasterizerState, float InViewDepth, float InMaxDepth);
+	void RecordPrimitiveDefault(FDrawCommandList& OutDrawCommands, UPrimitiveComponent* InPrimitiveComp, ID3D11RasterizerState* InRasterizerState, float InViewDepth, float InMaxDepth);
+
+	// Submit (FRenderThread의 RenderFunction)
+	void SubmitFrame(FRenderFrame& InFrame);
+	void SubmitView(FRenderViewSnapshot& InView, FEditorViewContext& InEditorView);
+
 	UPipeline* Pipeline = nullptr;
 	UDeviceResources* DeviceResources = nullptr;
 	UFontRenderer* FontRenderer = nullptr;
 	TArray<UPrimitiveComponent*> PrimitiveComponents;
 
+	// Tick이 뷰포트마다 FRenderViewSnapshot을 채워 넘기고, EndFrame에서 SubmitFrame이 같은 스레드로 바로 제출한다 (인라인 모드)
+	// 에디터 기즈모, 빌보드, 텍스트는 EditorViews로, ImGui와 Present는 EndFrame 뒤에 그리므로 아직 스레드 모드로 Start하지 않는다
+	FRenderThread RenderThread;
+	TArray<FEditorViewContext> EditorViews;
+	uint64 RenderFrameNumber = 0;
+	FDrawStats FrameDrawStats;
+	FD3D11RenderBackend* DrawBackend = nullptr;
+
 	ID3D11DepthStencilState* DefaultDepthStencilState = nullptr;
 	ID3D11DepthStencilState* DisabledDepthStencilState = nullptr;
 	ID3D11Buffer* ConstantBufferModels = nullptr;
@@ -144,6 +184,7 @@ private:
 	ID3D11Buffer* ConstantBufferColor = nullptr;
 	ID3D11Buffer* ConstantBufferBatchLine = nullptr;
 	ID3D11Buffer* ConstantBufferMaterial = nullptr;
+	ID3D11Buffer* ConstantBufferMaterialDraw = nullptr;
 
 	FLOAT ClearColor[4] = { 0.025f, 0.025f, 0.025f, 1.0f };
 
@@ -154,7 +195,16 @@ private:
 	ID3D11VertexShader* TextureVertexShader = nullptr;
 	ID3D11PixelShader* TexturePixelShader = nullptr;
 	ID3D11InputLayout* TextureInputLayout = nullptr;
+
+	// Instancing 변형 (Vertex Buffer Slot 2에서 월드 행렬/색상을 읽는다)
+	ID3D11VertexShader* InstancedDefaultVertexShader = nullptr;
+	ID3D11PixelShader* InstancedDefaultPixelShader = nullptr;
+	ID3D11InputLayout* InstancedDefaultInputLayout = nullptr;
+	ID3D11VertexShader* InstancedTextureVertexShader = nullptr;
+	ID3D11InputLayout* InstancedTextureInputLayout = nullptr;
+
 	ID3D11Buffer* BillboardVertexBuffer = nullptr;
+	ID3D11Buffer* BillboardAttributeBuffer = nullptr;
 	ID3D11Buffer* BillboardIndexBuffer = nullptr;
 	ID3D11BlendState* BillboardBlendState = nullptr;
 
@@ -190,7 +240,7 @@ private:
 		}
 	};
 
-	TMap<FRasterKey, ID3D11RasterizerState*, FRasterKeyHasher> RasterCache;
+	TFlatMap<FRasterKey, ID3D11RasterizerState*, FRasterKeyHasher> RasterCache;
 
 	ID3D11RasterizerState* GetRasterizerState(const FRenderState& InRenderState);
 
@@ -198,6 +248,7 @@ private:
 
 	bool bIsFirstPass = true;
 	bool bOcclusionCulling = true;
+	bool bInstancing = true;
 
 	constexpr static size_t NUM_WORKER_THREADS = 4;
 
@@ -205,5 +256,6 @@ private:
 	TArray<ID3D11Buffer*> ThreadConstantBufferModels;
 	TArray<ID3D11Buffer*> ThreadConstantBufferColors;
 	TArray<ID3D11Buffer*> ThreadConstantBufferMaterials;
+	TArray<ID3D11Buffer*> ThreadConstantBufferMaterialDraws;
 	TArray<ID3D11CommandList*> CommandLists;
 };
@@ -0,0 +1,71 @@
+#pragma once
+#include "Global/Types.h"
+#include "Global/Vector.h"
+
+/**
+ * @brief CPU에서 동작하는 저해상도 마스크 깊이 버퍼 (Software Occlusion Culling)
+ *
+ * 큰 오클루더의 삼각형을 저해상도 깊이 버퍼에 래스터화한 뒤, 화면 공간 바운딩 박스가
+ * 버퍼보다 완전히 뒤에 있는지를 같은 프레임 안에서 검사한다
+ * - 깊이는 NDC Z [0, 1] (작을수록 가깝다), 초기값은 1 (Far)
+ * - 픽셀은 SSE로 4개씩 처리하며, 삼각형 내부 마스크가 켜진 레인만 깊이를 갱신한다
+ * - 오클루더는 삼각형의 가장 먼 깊이로 기록하므로 결과는 항상 보수적이다 (보이는 물체를 가리지 않음)
+ *
+ * GPU 리소스를 사용하지 않으므로 디바이스 없이 테스트/벤치마크할 수 있다
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+	static constexpr uint32 DEFAULT_WIDTH = 320;
+	static constexpr uint32 DEFAULT_HEIGHT = 192;
+
+	void Resize(uint32 InWidth, uint32 InHeight);
+
+	/** 깊이 버퍼를 Far로 채우고 준비된 삼각형을 비운다 */
+	void Clear();
+
+	/**
+	 * @brief 클립 공간 정점으로 이루어진 삼각형 리스트를 화면 공간으로 변환해 래스터화 대기열에 넣는다
+	 * @param InIndices nullptr이면 정점 순서대로 3개씩 삼각형으로 본다
+	 * @note Near 평면에 걸친 삼각형은 버린다 (오클루더를 빼는 쪽은 항상 안전하다)
+	 */
+	void AddTriangles(const FVector4* InClipVertices, uint32 InNumVertices, const uint32* InIndices, uint32 InNumIndices);
+
+	/**
+	 * @brief 준비된 삼각형을 [InRowBegin, InRowEnd) 행에만 래스터화한다
+	 * 서로 겹치지 않는 행 범위라면 여러 워커 스레드에서 동시에 호출할 수 있다
+	 */
+	void RasterizeRows(uint32 InRowBegin, uint32 InRowEnd);
+	void Rasterize() { RasterizeRows(0, Height); }
+
+	/**
+	 * @brief NDC 공간 박스(X, Y: [-1, 1], Z: [0, 1])가 가려지지 않았는지 검사한다
+	 * 박스의 가장 가까운 깊이가 사각형 내 어느 한 픽셀이라도 버퍼 깊이 이하이면 보인다
+	 */
+	bool IsVisible(const FVector4& InNdcMin, const FVector4& InNdcMax) const;
+
+	uint32 GetWidth() const { return Width; }
+	uint32 GetHeight() const { return Height; }
+	uint32 GetNumTriangles() const { return static_cast<uint32>(Triangles.size()); }
+	const TArray<float>& GetDepth() const { return Depth; }
+
+private:
+	struct FScreenTriangle
+	{
+		float X[3];
+		float Y[3];
+		float MaxDepth;
+		int32 MinX;
+		int32 MaxX;
+		int32 MinY;
+		int32 MaxY;
+	};
+
+	void RasterizeTriangle(const FScreenTriangle& InTriangle, int32 InRowBegin, int32 InRowEnd);
+
+	// 행 단위 4픽셀 SIMD 처리를 위해 Width는 4의 배수로 맞춘다
+	uint32 Width = 0;
+	uint32 Height = 0;
+	TArray<float> Depth;
+	TArray<FScreenTriangle> Triangles;
+};
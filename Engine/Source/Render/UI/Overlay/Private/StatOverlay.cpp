@@ -63,6 +63,8 @@ void UStatOverlay::Render()
 
 	if (IsStatEnabled(EStatType::FPS))		{ RenderFPS(); }
 	if (IsStatEnabled(EStatType::Memory))	{ RenderMemory(); }
+	if (IsStatEnabled(EStatType::Render))	{ RenderDrawStats(); }
+	if (IsStatEnabled(EStatType::Profiler))	{ RenderProfiler(); }
 
 	D2DRenderTarget->EndDraw();
 }
@@ -135,16 +137,91 @@ void UStatOverlay::RenderFPS()
 
 void UStatOverlay::RenderMemory()
 {
-	float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+	float MemoryMB = static_cast<float>(TotalAllocationBytes.load(std::memory_order_relaxed)) / (1024.0f * 1024.0f);
 
 	char MemoryBuffer[64];
-	sprintf_s(MemoryBuffer, sizeof(MemoryBuffer), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+	sprintf_s(MemoryBuffer, sizeof(MemoryBuffer), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount.load(std::memory_order_relaxed));
 	FString MemoryText = MemoryBuffer;
 
 	float OffsetY = IsStatEnabled(EStatType::FPS) ? 20.0f : 0.0f;
 	RenderText(MemoryText, OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 0.0f);
 }
 
+void UStatOverlay::RenderDrawStats()
+{
+	const FDrawStats& Stats = URenderer::GetInstance().GetFrameDrawStats();
+
+	char DrawBuffer[128];
+	sprintf_s(DrawBuffer, sizeof(DrawBuffer), "Draw Calls: %u (%u commands)", Stats.NumDrawCalls, Stats.NumCommands);
+
+	char StateBuffer[128];
+	sprintf_s(StateBuffer, sizeof(StateBuffer), "State Changes: %u (PSO %u, Mat %u, Geo %u, CB %u)",
+		Stats.GetTotalStateChanges(),
+		Stats.NumPipelineChanges,
+		Stats.NumMaterialChanges,
+		Stats.NumGeometryChanges,
+		Stats.NumConstantUpdates);
+
+	char InstanceBuffer[128];
+	sprintf_s(InstanceBuffer, sizeof(InstanceBuffer), "Instancing: %u draws, %u instances, %u maps",
+		Stats.NumInstancedDraws,
+		Stats.NumInstances,
+		Stats.NumBufferMaps);
+
+	// FPS는 Picking 줄까지 두 줄을 사용한다
+	float OffsetY = 0.0f;
+	if (IsStatEnabled(EStatType::FPS))		{ OffsetY += 40.0f; }
+	if (IsStatEnabled(EStatType::Memory))	{ OffsetY += 20.0f; }
+
+	RenderText(DrawBuffer, OverlayX, OverlayY + OffsetY, 0.5f, 0.8f, 1.0f);
+	RenderText(StateBuffer, OverlayX, OverlayY + OffsetY + 20.0f, 0.5f, 0.8f, 1.0f);
+	RenderText(InstanceBuffer, OverlayX, OverlayY + OffsetY + 40.0f, 0.5f, 0.8f, 1.0f);
+}
+
+/**
+ * @brief 프로파일러 스코프를 호출 계층대로 들여 써서 출력한다 (평활된 Inclusive / Exclusive / 호출 수)
+ */
+void UStatOverlay::RenderProfiler()
+{
+	constexpr double MIN_DISPLAY_MS = 0.01;
+	constexpr size_t MAX_DISPLAY_ROWS = 32;
+
+	UProfilerManager::GetInstance().GetHierarchy(ProfilerRows, MIN_DISPLAY_MS);
+
+	float OffsetY = 0.0f;
+	if (IsStatEnabled(EStatType::FPS))		{ OffsetY += 40.0f; }
+	if (IsStatEnabled(EStatType::Memory))	{ OffsetY += 20.0f; }
+	if (IsStatEnabled(EStatType::Render))	{ OffsetY += 60.0f; }
+
+	RenderText("Scope                          Incl ms   Excl ms  Calls", OverlayX, OverlayY + OffsetY, 1.0f, 1.0f, 1.0f);
+	OffsetY += 20.0f;
+
+	const size_t NumRows = std::min(ProfilerRows.size(), MAX_DISPLAY_ROWS);
+	for (size_t Index = 0; Index < NumRows; ++Index)
+	{
+		const FProfilerRow& Row = ProfilerRows[Index];
+
+		char RowBuffer[128];
+		sprintf_s(RowBuffer, sizeof(RowBuffer), "%*s%-*s %8.3f  %8.3f  %5.1f",
+			static_cast<int>(Row.Depth) * 2, "",
+			std::max(0, 28 - static_cast<int>(Row.Depth) * 2), Row.Name,
+			Row.InclusiveMs, Row.ExclusiveMs, Row.NumCalls);
+
+		// 워커 스레드 스코프는 색을 달리한다
+		const float G = Row.bWorkerThread ? 0.7f : 1.0f;
+		RenderText(RowBuffer, OverlayX, OverlayY + OffsetY, 0.6f, G, Row.bWorkerThread ? 1.0f : 0.6f);
+		OffsetY += 20.0f;
+	}
+
+	const uint64 NumDropped = UProfilerManager::GetInstance().GetNumDroppedEvents();
+	if (NumDropped > 0)
+	{
+		char DroppedBuffer[64];
+		sprintf_s(DroppedBuffer, sizeof(DroppedBuffer), "Dropped events: %llu", NumDropped);
+		RenderText(DroppedBuffer, OverlayX, OverlayY + OffsetY, 1.0f, 0.3f, 0.3f);
+	}
+}
+
 void UStatOverlay::RenderText(const FString& Text, float X, float Y, float R, float G, float B)
 {
 	if (!D2DRenderTarget || !TextBrush || !TextFormat) return;
@@ -152,7 +229,7 @@ void UStatOverlay::RenderText(const FString& Text, float X, float Y, float R, fl
 	TextBrush->SetColor(D2D1::ColorF(R, G, B));
 	std::wstring wText = ToWString(Text);
 
-	D2D1_RECT_F layoutRect = D2D1::RectF(X, Y, X + 400.0f, Y + 20.0f);
+	D2D1_RECT_F layoutRect = D2D1::RectF(X, Y, X + 520.0f, Y + 20.0f);
 	D2DRenderTarget->DrawText(
 		wText.c_str(),
 		static_cast<UINT32>(wText.length()),
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
 #include <d2d1.h>
 #include <dwrite.h>
 
@@ -8,7 +9,9 @@ enum class EStatType : uint8
 	None = 0,
 	FPS = 1 << 0,      // 1
 	Memory = 1 << 1,   // 2
-	All = FPS | Memory // 3
+	Render = 1 << 2,   // 4
+	Profiler = 1 << 3, // 8
+	All = FPS | Memory | Render | Profiler // 15
 };
 
 UCLASS()
@@ -29,6 +32,8 @@ public:
 	// Stat control methods
 	void ShowFPS(bool bShow) { bShow ? EnableStat(EStatType::FPS) : DisableStat(EStatType::FPS); }
 	void ShowMemory(bool bShow) { bShow ? EnableStat(EStatType::Memory) : DisableStat(EStatType::Memory); }
+	void ShowRender(bool bShow) { bShow ? EnableStat(EStatType::Render) : DisableStat(EStatType::Render); }
+	void ShowProfiler(bool bShow) { bShow ? EnableStat(EStatType::Profiler) : DisableStat(EStatType::Profiler); }
 	void ShowAll(bool bShow) { SetStatType(bShow ? EStatType::All : EStatType::None); }
 
 	double LastPickingTime = 0.0;
@@ -38,6 +43,8 @@ public:
 private:
 	void RenderFPS();
 	void RenderMemory();
+	void RenderDrawStats();
+	void RenderProfiler();
 	void RenderText(const FString& Text, float X, float Y, float R, float G, float B);
 
 	// FPS Stats
@@ -48,6 +55,9 @@ private:
 	float OverlayX = 18.0f;
 	float OverlayY = 55.0f;
 
+	// 프로파일러 계층 출력용 (프레임마다 재사용)
+	TArray<FProfilerRow> ProfilerRows;
+
 	uint8 StatMask = static_cast<uint8>(EStatType::None);
 
 	// Helper methods
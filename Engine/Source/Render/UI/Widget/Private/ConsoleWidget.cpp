@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "Render/UI/Widget/Public/ConsoleWidget.h"
+#include "Editor/Public/EditorEngine.h"
+#include "Level/Public/Level.h"
 #include "Render/UI/Overlay/Public/StatOverlay.h"
+#include "Manager/Profiler/Public/ProfilerManager.h"
 #include "Utility/Public/UELogParser.h"
 
 IMPLEMENT_SINGLETON_CLASS(UConsoleWidget, UWidget)
@@ -9,6 +12,13 @@ UConsoleWidget::UConsoleWidget() = default;
 
 UConsoleWidget::~UConsoleWidget()
 {
+	if (ConsoleLogSink)
+	{
+		FLogger::RemoveSink(ConsoleLogSink);
+		delete ConsoleLogSink;
+		ConsoleLogSink = nullptr;
+	}
+
 	CleanupSystemRedirect();
 	ClearLog();
 }
@@ -28,6 +38,13 @@ void UConsoleWidget::Initialize()
 	OriginalConsoleOutput = nullptr;
 	OriginalConsoleError = nullptr;
 
+	// UE_LOG 출력을 받는다
+	if (!ConsoleLogSink)
+	{
+		ConsoleLogSink = new FConsoleLogSink(this);
+		FLogger::AddSink(ConsoleLogSink);
+	}
+
 	AddLog(ELogType::Success, "ConsoleWindow: Game Console 초기화 성공");
 	AddLog(ELogType::System, "ConsoleWindow: Logging System Ready");
 }
@@ -54,6 +71,14 @@ int ConsoleStreamBuffer::overflow(int InCharacter)
 	return InCharacter;
 }
 
+void FConsoleLogSink::Write(ELogType InType, const char* InPrefix, const char* InMessage)
+{
+	if (Console)
+	{
+		Console->AddLogEntry(InType, InMessage);
+	}
+}
+
 streamsize ConsoleStreamBuffer::xsputn(const char* InString, streamsize InCount)
 {
 	for (std::streamsize i = 0; i < InCount; ++i)
@@ -74,7 +99,17 @@ void UConsoleWidget::RenderWidget()
 	ImGui::SameLine();
 	if (ImGui::Button("Copy"))
 	{
-		ImGui::LogToClipboard();
+		// 화면에 보이는 줄만 그리므로 LogToClipboard 대신 링 전체를 모아 복사한다
+		FString ClipboardText;
+		{
+			std::lock_guard<std::mutex> Lock(LogMutex);
+			for (uint32 Row = 0; Row < NumLogItems; ++Row)
+			{
+				ClipboardText += LogItems[(LogHead + Row) % MAX_LOG_ENTRIES].Message;
+				ClipboardText += '\n';
+			}
+		}
+		ImGui::SetClipboardText(ClipboardText.c_str());
 	}
 
 	// ImGui::SameLine();
@@ -87,23 +122,32 @@ void UConsoleWidget::RenderWidget()
 	if (ImGui::BeginChild("LogOutput", ImVec2(0, -ReservedHeight), ImGuiChildFlags_NavFlattened,
 	                      ImGuiWindowFlags_HorizontalScrollbar))
 	{
-		// 로그 리스트 출력
-		for (const auto& LogEntry : LogItems)
-		{
-			// ELogType을 기반으로 색상 결정
-			ImVec4 Color = GetColorByLogType(LogEntry.Type);
-			bool bShouldApplyColor = (LogEntry.Type != ELogType::Info);
+		std::lock_guard<std::mutex> Lock(LogMutex);
 
-			if (bShouldApplyColor)
+		// 로그 리스트 출력 (보이는 줄만 그린다)
+		ImGuiListClipper Clipper;
+		Clipper.Begin(static_cast<int>(NumLogItems));
+		while (Clipper.Step())
+		{
+			for (int Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
 			{
-				ImGui::PushStyleColor(ImGuiCol_Text, Color);
-			}
+				const FLogEntry& LogEntry = LogItems[(LogHead + Row) % MAX_LOG_ENTRIES];
 
-			ImGui::TextUnformatted(LogEntry.Message.c_str());
+				// ELogType을 기반으로 색상 결정
+				ImVec4 Color = GetColorByLogType(LogEntry.Type);
+				bool bShouldApplyColor = (LogEntry.Type != ELogType::Info);
 
-			if (bShouldApplyColor)
-			{
-				ImGui::PopStyleColor();
+				if (bShouldApplyColor)
+				{
+					ImGui::PushStyleColor(ImGuiCol_Text, Color);
+				}
+
+				ImGui::TextUnformatted(LogEntry.Message.c_str());
+
+				if (bShouldApplyColor)
+				{
+					ImGui::PopStyleColor();
+				}
 			}
 		}
 
@@ -154,7 +198,39 @@ void UConsoleWidget::Update()
 
 void UConsoleWidget::ClearLog()
 {
-	LogItems.clear();
+	std::lock_guard<std::mutex> Lock(LogMutex);
+	LogHead = 0;
+	NumLogItems = 0;
+}
+
+/**
+ * @brief 로그 링에 한 줄 추가 (로거 스레드에서도 호출된다)
+ * 가득 차면 가장 오래된 줄을 덮어쓰며, 문자열 버퍼는 재사용된다
+ */
+void UConsoleWidget::AddLogEntry(ELogType InType, const char* InMessage)
+{
+	std::lock_guard<std::mutex> Lock(LogMutex);
+
+	if (LogItems.empty())
+	{
+		LogItems.resize(MAX_LOG_ENTRIES);
+	}
+
+	const uint32 Index = (LogHead + NumLogItems) % MAX_LOG_ENTRIES;
+	if (NumLogItems < MAX_LOG_ENTRIES)
+	{
+		++NumLogItems;
+	}
+	else
+	{
+		LogHead = (LogHead + 1) % MAX_LOG_ENTRIES;
+	}
+
+	LogItems[Index].Type = InType;
+	LogItems[Index].Message.assign(InMessage);
+
+	// Auto Scroll
+	bIsScrollToBottom = true;
 }
 
 /**
@@ -238,18 +314,9 @@ void UConsoleWidget::AddLogInternal(ELogType InType, const char* fmt, va_list In
 	(void)vsnprintf(Buffer, LogLength + 1, fmt, ArgumentsCopy);
 	va_end(ArgumentsCopy);
 
-	// 기본 Info 타입으로 log 추가
-	FLogEntry LogEntry;
-	LogEntry.Type = InType;
-
-	// Log buffer 복사 후 제거
-	LogEntry.Message = FString(Buffer);
+	// 로그 링에 복사 후 버퍼 제거
+	AddLogEntry(InType, Buffer);
 	delete[] Buffer;
-
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
 }
 
 /**
@@ -283,10 +350,7 @@ void UConsoleWidget::AddSystemLog(const char* InText, bool bInIsError)
 		LogEntry.Message.pop_back();
 	}
 
-	LogItems.push_back(LogEntry);
-
-	// Auto Scroll
-	bIsScrollToBottom = true;
+	AddLogEntry(LogEntry.Type, LogEntry.Message.c_str());
 }
 
 /**
@@ -390,8 +454,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry LogEntry;
 				LogEntry.Type = ELogType::UELog;
 				LogEntry.Message = FString(Result.FormattedMessage);
-				LogItems.push_back(LogEntry);
-				bIsScrollToBottom = true;
+				AddLogEntry(LogEntry.Type, LogEntry.Message.c_str());
 			}
 			else
 			{
@@ -399,8 +462,7 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 				FLogEntry ErrorEntry;
 				ErrorEntry.Type = ELogType::Error;
 				ErrorEntry.Message = "UELogParser: UE_LOG 파싱 오류: " + FString(Result.ErrorMessage);
-				LogItems.push_back(ErrorEntry);
-				bIsScrollToBottom = true;
+				AddLogEntry(ErrorEntry.Type, ErrorEntry.Message.c_str());
 			}
 		}
 		catch (const std::exception& e)
@@ -408,16 +470,14 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 예외 발생: " + FString(e.what());
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			AddLogEntry(ErrorEntry.Type, ErrorEntry.Message.c_str());
 		}
 		catch (...)
 		{
 			FLogEntry ErrorEntry;
 			ErrorEntry.Type = ELogType::Error;
 			ErrorEntry.Message = "UELogParser: 알 수 없는 오류가 발생했습니다.";
-			LogItems.push_back(ErrorEntry);
-			bIsScrollToBottom = true;
+			AddLogEntry(ErrorEntry.Type, ErrorEntry.Message.c_str());
 		}
 	}
 
@@ -438,6 +498,30 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// PIE 진입/종료 지연 시간 측정
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.substr(0, 9) == "bench pie")
+	{
+		uint32 NumIterations = 10;
+		if (CommandLower.length() > 10)
+		{
+			NumIterations = static_cast<uint32>(std::max(1, atoi(CommandLower.c_str() + 10)));
+		}
+
+		AddLog(ELogType::System, "Running PIE benchmark (%u iterations)", NumIterations);
+		GEngine->RunPIEBenchmark(NumIterations);
+	}
+
+	// PVS 베이크/해제/정보
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 4 && CommandLower.substr(0, 4) == "pvs ")
+	{
+		FString PVSCommand = CommandLower.substr(4);
+		HandlePVSCommand(PVSCommand);
+	}
+
 	// Help 명령어 입력
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -448,7 +532,14 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  HELP - Show This Help");
 		AddLog(ELogType::Info, "  STAT FPS - Show FPS overlay");
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
+		AddLog(ELogType::Info, "  STAT RENDER - Show draw call / state change overlay");
+		AddLog(ELogType::Info, "  STAT PROFILER - Show hierarchical scope timings");
+		AddLog(ELogType::Info, "  STAT TRACE [N] - Export last N frames as Chrome trace (default 60)");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
+		AddLog(ELogType::Info, "  BENCH PIE [N] - Measure StartPIE/EndPIE latency over N runs (default 10)");
+		AddLog(ELogType::Info, "  PVS BAKE [N] - Bake potentially visible sets, N cells on the longest axis (default 8)");
+		AddLog(ELogType::Info, "  PVS CLEAR - Remove the baked PVS from the current level");
+		AddLog(ELogType::Info, "  PVS STATS - Show PVS cells and validity");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -470,7 +561,8 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		ExecuteTerminalCommand(InCommand);
 	}
 
-	// 스크롤 하단으로 이동
+	// 스크롤 하단으로 이동 (로거 스레드도 쓰는 값이므로 잠그고 쓴다)
+	std::lock_guard<std::mutex> Lock(LogMutex);
 	bIsScrollToBottom = true;
 }
 
@@ -488,6 +580,34 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowMemory(true);
 		AddLog(ELogType::Success, "Memory overlay enabled");
 	}
+	else if (StatCommand == "render")
+	{
+		StatOverlay.ShowRender(true);
+		AddLog(ELogType::Success, "Render overlay enabled");
+	}
+	else if (StatCommand == "profiler")
+	{
+		StatOverlay.ShowProfiler(true);
+		AddLog(ELogType::Success, "Profiler overlay enabled");
+	}
+	else if (StatCommand.substr(0, 5) == "trace")
+	{
+		// chrome://tracing 또는 Perfetto에서 열 수 있는 JSON으로 최근 프레임을 저장한다
+		uint32 NumFrames = 60;
+		if (StatCommand.length() > 6)
+		{
+			NumFrames = static_cast<uint32>(std::max(1, atoi(StatCommand.c_str() + 6)));
+		}
+
+		if (UProfilerManager::GetInstance().ExportRecentFrames("ProfilerTrace.json", NumFrames))
+		{
+			AddLog(ELogType::Success, "Trace exported: ProfilerTrace.json (%u frames)", NumFrames);
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Trace export failed");
+		}
+	}
 	else if (StatCommand == "none")
 	{
 		StatOverlay.ShowAll(false);
@@ -496,7 +616,53 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.c_str());
-		AddLog(ELogType::Info, "Available: fps, memory, none");
+		AddLog(ELogType::Info, "Available: fps, memory, render, profiler, trace [N], none");
+	}
+}
+
+void UConsoleWidget::HandlePVSCommand(const FString& PVSCommand)
+{
+	ULevel* Level = GEngine->GetCurrentLevel();
+	if (!Level)
+	{
+		AddLog(ELogType::Error, "PVS: no current level");
+		return;
+	}
+
+	if (PVSCommand.substr(0, 4) == "bake")
+	{
+		FPVSBakeSettings Settings;
+		if (PVSCommand.length() > 5)
+		{
+			Settings.MaxCellsPerAxis = static_cast<uint32>(std::max(1, atoi(PVSCommand.c_str() + 5)));
+		}
+
+		const FPVSBakeStats Stats = Level->BakePVS(Settings);
+		AddLog(ELogType::Success, "PVS baked: %u cells, %u primitives, %llu rays, %.2f ms", Stats.NumCells, Stats.NumPrimitives,
+			static_cast<unsigned long long>(Stats.NumRays), Stats.BakeMs);
+		AddLog(ELogType::Info, "  %u unique sets, %llu -> %llu bytes, avg visible %.1f%%", Stats.NumUniqueSets,
+			static_cast<unsigned long long>(Stats.RawBytes), static_cast<unsigned long long>(Stats.CompressedBytes), Stats.AverageVisibleRatio * 100.0f);
+	}
+	else if (PVSCommand == "clear")
+	{
+		Level->ClearPVS();
+		AddLog(ELogType::Success, "PVS cleared");
+	}
+	else if (PVSCommand == "stats")
+	{
+		const FPotentiallyVisibleSet& PVS = Level->GetPVS();
+		if (PVS.IsEmpty())
+		{
+			AddLog(ELogType::Info, "PVS: none (use PVS BAKE)");
+			return;
+		}
+		AddLog(ELogType::Info, "PVS: %u cells, %u primitives, %s", PVS.GetNumCells(), PVS.GetNumPrimitives(),
+			PVS.IsBound() ? "matches level" : "level changed since bake, not used");
+	}
+	else
+	{
+		AddLog(ELogType::Error, "Unknown pvs command: %s", PVSCommand.c_str());
+		AddLog(ELogType::Info, "Available: bake [N], clear, stats");
 	}
 }
 
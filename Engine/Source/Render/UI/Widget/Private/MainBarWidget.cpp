@@ -10,6 +10,7 @@
 #include "Actor/Public/Actor.h"
 #include "Component/Mesh/Public/StaticMeshComponent.h"
 #include "Render/Renderer/Public/Renderer.h"
+#include "Render/Renderer/Public/OcclusionRenderer.h"
 
 
 IMPLEMENT_CLASS(UMainBarWidget, UWidget)
@@ -490,8 +491,28 @@ void UMainBarWidget::RenderOcclusionCullingMenu()
 
 		ImGui::Separator();
 
+		// 오클루전 컬링 방식 선택
+		UOcclusionRenderer& OcclusionRenderer = UOcclusionRenderer::GetInstance();
+		const EOcclusionBackend CurrentBackend = OcclusionRenderer.GetBackend();
+		if (ImGui::MenuItem("HiZ (GPU, 이전 프레임 깊이)", nullptr, CurrentBackend == EOcclusionBackend::HiZ))
+		{
+			OcclusionRenderer.SetBackend(EOcclusionBackend::HiZ);
+			UE_LOG("MainBarWidget: Occlusion Culling 방식 - HiZ");
+		}
+		if (ImGui::MenuItem("Software (CPU, 같은 프레임)", nullptr, CurrentBackend == EOcclusionBackend::Software))
+		{
+			OcclusionRenderer.SetBackend(EOcclusionBackend::Software);
+			UE_LOG("MainBarWidget: Occlusion Culling 방식 - Software");
+		}
+
+		ImGui::Separator();
+
 		// 현재 상태 표시
 		ImGui::Text("현재 상태: %s", bOcclusionCullingEnabled ? "활성화됨" : "비활성화됨");
+		if (CurrentBackend == EOcclusionBackend::Software)
+		{
+			ImGui::Text("오클루더: %u, 컬링: %u", OcclusionRenderer.GetNumSoftwareOccluders(), OcclusionRenderer.GetNumSoftwareCulled());
+		}
 
 		ImGui::EndMenu();
 	}
@@ -35,6 +35,24 @@ private:
 	bool bIsError;
 };
 
+/**
+ * @brief Logger Sink
+ * 로거 스레드에서 서식화된 UE_LOG를 ConsoleWidget의 로그 링으로 전달
+ */
+class FConsoleLogSink : public ILogSink
+{
+public:
+	FConsoleLogSink(UConsoleWidget* InConsole)
+		: Console(InConsole)
+	{
+	}
+
+	void Write(ELogType InType, const char* InPrefix, const char* InMessage) override;
+
+private:
+	UConsoleWidget* Console;
+};
+
 /**
  * @brief Console Widget
  * 콘솔의 실제 기능을 담당하는 위젯 (로그 표시, 명령어 처리 등)
@@ -55,11 +73,13 @@ public:
 	void AddLog(const char* fmt, ...);
 	void AddLog(ELogType InType, const char* fmt, ...);
 	void AddSystemLog(const char* InText, bool bInIsError = false);
+	void AddLogEntry(ELogType InType, const char* InMessage);
 	void ClearLog();
 
 	// Console command
 	void ProcessCommand(const char* InCommand);
 	void HandleStatCommand(const FString& StatCommand);
+	void HandlePVSCommand(const FString& PVSCommand);
 	void ExecuteTerminalCommand(const char* InCommand);
 
 	// Use external terminal
@@ -77,7 +97,13 @@ private:
 	int HistoryPosition;
 
 	// Log output
+	// 고정 크기 링 (가득 차면 가장 오래된 로그를 덮어쓴다), 로거 스레드도 쓰므로 LogMutex로 보호한다
+	static constexpr uint32 MAX_LOG_ENTRIES = 2048;
 	TArray<FLogEntry> LogItems;
+	uint32 LogHead = 0;
+	uint32 NumLogItems = 0;
+	std::mutex LogMutex;
+	FConsoleLogSink* ConsoleLogSink = nullptr;
 	bool bIsAutoScroll;
 	bool bIsScrollToBottom;
 
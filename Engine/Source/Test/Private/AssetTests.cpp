@@ -0,0 +1,259 @@
+#include "pch.h"
+#include "Test/Public/Test.h"
+
+#include "Component/Mesh/Public/MeshOptimizer.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/AssetLoader.h"
+#include "Manager/Asset/Public/CookedMeshCache.h"
+#include "Texture/Public/CookedTextureCache.h"
+#include "Texture/Public/SyntheticTexture.h"
+#include "Texture/Public/TextureCooker.h"
+
+namespace
+{
+	constexpr uint32 SEED = 20251001;
+	constexpr uint32 TEXTURE_SIZE = 512;
+	constexpr uint32 TEXTURE_CACHE_ENTRIES = 8;
+
+	struct FTextureQualityCase
+	{
+		ETextureFormat Format;
+		ESyntheticTexture Source;
+		// 비교할 채널과 이보다 낮으면 실패로 보는 PSNR (dB)
+		uint32 ChannelMask;
+		double MinPSNR;
+	};
+
+	/** 512x512에서 잰 값: BC1 41.09, BC3 42.34, BC5 54.21, BC7 46.45 dB */
+	const FTextureQualityCase TEXTURE_QUALITY_CASES[] =
+	{
+		{ ETextureFormat::BC1, ESyntheticTexture::Color, 0x7, 38.0 },
+		{ ETextureFormat::BC3, ESyntheticTexture::ColorAlpha, 0xF, 38.0 },
+		{ ETextureFormat::BC5, ESyntheticTexture::Normal, 0x3, 50.0 },
+		{ ETextureFormat::BC7, ESyntheticTexture::ColorAlpha, 0xF, 42.0 },
+	};
+
+	/** @brief 삼각형 하나를 정점 내용(위치 + 속성) 해시 세 개로, 감김을 유지한 채 가장 작은 값이 앞에 오도록 돌린다 */
+	std::array<uint64, 3> MakeTriangleKey(const FStaticMesh& InMesh, const uint32* InTriangle)
+	{
+		std::array<uint64, 3> Key;
+		for (uint32 k = 0; k < 3; ++k)
+		{
+			uint8 Bytes[sizeof(FMeshPosition) + sizeof(FMeshAttribute)];
+			memcpy(Bytes, &InMesh.Positions[InTriangle[k]], sizeof(FMeshPosition));
+			memcpy(Bytes + sizeof(FMeshPosition), &InMesh.Attributes[InTriangle[k]], sizeof(FMeshAttribute));
+			Key[k] = FAssetRegistry::HashBytes(Bytes, sizeof(Bytes));
+		}
+		std::rotate(Key.begin(), std::min_element(Key.begin(), Key.end()), Key.end());
+		return Key;
+	}
+
+	/** @brief 섹션마다 삼각형 집합과 감김이 같은지 (순서만 바뀌었는지) */
+	bool HasSameTriangles(const FStaticMesh& InSource, const FStaticMesh& InOptimized)
+	{
+		if (InSource.Indices.size() != InOptimized.Indices.size() || InSource.Sections.size() != InOptimized.Sections.size())
+		{
+			return false;
+		}
+
+		TArray<FMeshSection> Ranges = InSource.Sections;
+		if (Ranges.empty())
+		{
+			Ranges.push_back({ 0, static_cast<uint32>(InSource.Indices.size()), 0 });
+		}
+
+		TArray<std::array<uint64, 3>> SourceKeys;
+		TArray<std::array<uint64, 3>> OptimizedKeys;
+		for (const FMeshSection& Section : Ranges)
+		{
+			SourceKeys.clear();
+			OptimizedKeys.clear();
+			for (uint32 i = 0; i + 2 < Section.IndexCount; i += 3)
+			{
+				SourceKeys.push_back(MakeTriangleKey(InSource, &InSource.Indices[Section.StartIndex + i]));
+				OptimizedKeys.push_back(MakeTriangleKey(InOptimized, &InOptimized.Indices[Section.StartIndex + i]));
+			}
+			std::sort(SourceKeys.begin(), SourceKeys.end());
+			std::sort(OptimizedKeys.begin(), OptimizedKeys.end());
+			if (SourceKeys != OptimizedKeys)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief 애셋 쿠킹 결과의 품질과 캐시 왕복을 GPU 없이 확인한다
+ */
+void RunAssetTests(FTestContext& InContext)
+{
+	InContext.Run("Texture.EncodePSNR", [&]
+	{
+		// 포맷마다 CPU 디코더로 되돌린 이미지의 PSNR이 기준 이상이어야 한다
+		for (const FTextureQualityCase& Case : TEXTURE_QUALITY_CASES)
+		{
+			const FTextureImage Source = FSyntheticTexture::Make(Case.Source, TEXTURE_SIZE, SEED);
+			const uint32 NumBlocks = (TEXTURE_SIZE / 4) * (TEXTURE_SIZE / 4);
+
+			TArray<uint8> Encoded;
+			FTextureCooker::Encode(Source, Case.Format, Encoded);
+			TEST_CHECK(InContext, Encoded.size() == static_cast<size_t>(NumBlocks) * FTextureCooker::GetBlockBytes(Case.Format));
+
+			FTextureImage Decoded;
+			if (!TEST_CHECK(InContext, FTextureCooker::Decode(Encoded.data(), Source.Width, Source.Height, Case.Format, Decoded)))
+			{
+				continue;
+			}
+
+			const double PSNR = FTextureCooker::ComputePSNR(Source, Decoded, Case.ChannelMask);
+			if (!TEST_CHECK(InContext, PSNR >= Case.MinPSNR))
+			{
+				printf("    %s: PSNR %.2f dB, 기준 %.1f dB\n", FTextureCooker::GetFormatName(Case.Format), PSNR, Case.MinPSNR);
+			}
+		}
+	});
+
+	InContext.Run("Texture.CacheReadback", [&]
+	{
+		// 캐시 파일에서 한 번에 읽은 텍스처가 쿠킹 결과와 바이트 단위로 같아야 한다
+		const FTextureImage Source = FSyntheticTexture::Make(ESyntheticTexture::Color, TEXTURE_SIZE, SEED);
+		FTextureCookSettings Settings;
+		FCookedTexture Cooked;
+		FTextureCooker::Cook(Source, Settings, Cooked);
+		TEST_CHECK(InContext, !Cooked.Mips.empty() && !Cooked.Data.empty());
+
+		const FString CachePath = (std::filesystem::temp_directory_path() / "gtl_test.gtc").string();
+		{
+			FCookedTextureCache Cache;
+			for (uint32 i = 0; i < TEXTURE_CACHE_ENTRIES; ++i)
+			{
+				FCookedTexture Copy = Cooked;
+				Cache.Add(i + 1, Settings.GetHash(), std::move(Copy));
+			}
+			TEST_CHECK(InContext, Cache.Save(CachePath));
+		}
+
+		FCookedTextureCache Cache;
+		TEST_CHECK(InContext, Cache.Load(CachePath));
+
+		bool bSameData = true;
+		for (uint32 i = 0; i < TEXTURE_CACHE_ENTRIES; ++i)
+		{
+			const FCookedTextureView* View = Cache.Find(i + 1, Settings.GetHash());
+			bSameData = bSameData && View && View->Format == Cooked.Format && View->Width == Cooked.Width && View->Height == Cooked.Height &&
+				View->NumMips == Cooked.Mips.size() && memcmp(View->Mips, Cooked.Mips.data(), sizeof(FCookedMip) * Cooked.Mips.size()) == 0 &&
+				memcmp(View->Data, Cooked.Data.data(), Cooked.Data.size()) == 0;
+		}
+		TEST_CHECK(InContext, bSameData);
+
+		// 설정이 다르면 같은 원본이라도 찾지 못한다
+		FTextureCookSettings OtherSettings;
+		OtherSettings.Format = ETextureFormat::BC1;
+		TEST_CHECK(InContext, Cache.Find(1, OtherSettings.GetHash()) == nullptr);
+		TEST_CHECK(InContext, Cache.Find(TEXTURE_CACHE_ENTRIES + 1, Settings.GetHash()) == nullptr);
+
+		std::error_code ErrorCode;
+		std::filesystem::remove(CachePath, ErrorCode);
+	});
+
+	InContext.Run("MeshOptimize.Data", [&]
+	{
+		// Data/의 모든 메시에서 최적화가 삼각형(감김 포함)을 보존하고 ACMR을 나쁘게 만들지 않아야 한다
+		FAssetLoadSettings Settings;
+		Settings.RootDirectory = InContext.GetOptions().DataDirectory;
+		Settings.ObjConfig.bIsBinaryEnabled = true;
+		Settings.ObjConfig.bUVToUEBasis = true;
+		Settings.ObjConfig.bPositionToUEBasis = true;
+		Settings.ObjConfig.bOptimizeMesh = false;
+
+		FAssetLoader Loader;
+		Loader.Load(Settings);
+
+		uint32 NumMeshes = 0;
+		for (const FLoadedStaticMesh& Loaded : Loader.GetStaticMeshes())
+		{
+			if (!Loaded.Asset)
+			{
+				continue;
+			}
+			++NumMeshes;
+
+			FStaticMesh Optimized = *Loaded.Asset;
+			FMeshOptimizer::OptimizeStaticMesh(Optimized);
+
+			const FVertexCacheStats Before = FMeshOptimizer::AnalyzeStaticMesh(*Loaded.Asset);
+			const FVertexCacheStats After = FMeshOptimizer::AnalyzeStaticMesh(Optimized);
+			const bool bSameTriangles = TEST_CHECK(InContext, HasSameTriangles(*Loaded.Asset, Optimized));
+			const bool bNotWorse = TEST_CHECK(InContext, After.NumTransformed <= Before.NumTransformed);
+			if (!bSameTriangles || !bNotWorse)
+			{
+				printf("    %s: ACMR %.3f -> %.3f\n", Loader.GetRegistry().GetEntry(Loaded.EntryIndex).Path.ToString().c_str(),
+					Before.GetACMR(), After.GetACMR());
+			}
+		}
+		TEST_CHECK(InContext, NumMeshes > 0);
+	});
+
+	InContext.Run("MeshOptimize.CookedCache", [&]
+	{
+		// 캐시에서 가져온 최적화 결과가 최적화기를 직접 돌린 결과와 같아야 하고, 최적화기 버전이 다르면 버려야 한다
+		const FString CachePath = (std::filesystem::temp_directory_path() / "gtl_test_meshes.gmc").string();
+		std::error_code ErrorCode;
+		std::filesystem::remove(CachePath, ErrorCode);
+
+		FAssetLoadSettings Settings;
+		Settings.RootDirectory = InContext.GetOptions().DataDirectory;
+		Settings.ObjConfig.bIsBinaryEnabled = true;
+		Settings.ObjConfig.bUVToUEBasis = true;
+		Settings.ObjConfig.bPositionToUEBasis = true;
+
+		FAssetLoader Reference;
+		const FAssetLoadStats ReferenceStats = Reference.Load(Settings);
+
+		Settings.CookedMeshCachePath = CachePath;
+		FAssetLoader Cold;
+		const FAssetLoadStats ColdStats = Cold.Load(Settings);
+		TEST_CHECK(InContext, ColdStats.NumCachedStaticMeshes == 0);
+
+		FAssetLoader Warm;
+		const FAssetLoadStats WarmStats = Warm.Load(Settings);
+		const uint32 NumLoaded = ReferenceStats.NumStaticMeshes - ReferenceStats.NumFailedStaticMeshes;
+		TEST_CHECK(InContext, NumLoaded > 0);
+		TEST_CHECK(InContext, WarmStats.NumCachedStaticMeshes == NumLoaded);
+
+		bool bSameMeshes = Warm.GetStaticMeshes().size() == Reference.GetStaticMeshes().size();
+		for (size_t i = 0; bSameMeshes && i < Warm.GetStaticMeshes().size(); ++i)
+		{
+			const FStaticMesh* Expected = Reference.GetStaticMeshes()[i].Asset.get();
+			const FStaticMesh* Actual = Warm.GetStaticMeshes()[i].Asset.get();
+			if (!Expected || !Actual)
+			{
+				bSameMeshes = !Expected && !Actual;
+				continue;
+			}
+			bSameMeshes = Actual->Indices == Expected->Indices && Actual->Positions.size() == Expected->Positions.size() &&
+				memcmp(Actual->Positions.data(), Expected->Positions.data(), Actual->Positions.size() * sizeof(FMeshPosition)) == 0 &&
+				Actual->Attributes.size() == Expected->Attributes.size() &&
+				memcmp(Actual->Attributes.data(), Expected->Attributes.data(), Actual->Attributes.size() * sizeof(FMeshAttribute)) == 0;
+		}
+		TEST_CHECK(InContext, bSameMeshes);
+
+		// 헤더의 최적화기 버전(세 번째 uint32)을 바꾸면 캐시를 통째로 버린다
+		TArray<uint8> FileBytes;
+		if (TEST_CHECK(InContext, FAssetRegistry::ReadFileBytes(CachePath, FileBytes) && FileBytes.size() > 12))
+		{
+			const uint32 StaleVersion = FMeshOptimizer::OPTIMIZER_VERSION + 1;
+			memcpy(FileBytes.data() + 8, &StaleVersion, sizeof(StaleVersion));
+			std::ofstream(CachePath, std::ios::binary | std::ios::trunc).write(reinterpret_cast<const char*>(FileBytes.data()),
+				static_cast<std::streamsize>(FileBytes.size()));
+
+			FCookedMeshCache StaleCache;
+			TEST_CHECK(InContext, !StaleCache.Load(CachePath));
+			TEST_CHECK(InContext, StaleCache.Num() == 0);
+		}
+
+		std::filesystem::remove(CachePath, ErrorCode);
+	});
+}
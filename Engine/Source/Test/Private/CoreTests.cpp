@@ -0,0 +1,550 @@
+#include "pch.h"
+#include "Test/Public/Test.h"
+
+#include "Core/Public/PlatformTime.h"
+#include "Manager/Transform/Public/TransformHierarchy.h"
+
+#include <random>
+#include <thread>
+
+namespace
+{
+	/** @brief 두 맵의 원소가 같은지 (크기, 그리고 한쪽의 모든 원소가 다른 쪽에 같은 값으로 있는지) */
+	template<typename FlatMapType, typename StdMapType>
+	bool HasSameElements(const FlatMapType& InFlatMap, const StdMapType& InStdMap)
+	{
+		if (InFlatMap.size() != InStdMap.size())
+		{
+			return false;
+		}
+
+		size_t NumVisited = 0;
+		for (const auto& [Key, Value] : InFlatMap)
+		{
+			auto Iter = InStdMap.find(Key);
+			if (Iter == InStdMap.end() || Iter->second != Value)
+			{
+				return false;
+			}
+			++NumVisited;
+		}
+		return NumVisited == InStdMap.size();
+	}
+
+	/**
+	 * @brief FTransformHierarchy와 같은 연산을 핸들 배열에 그대로 적용하는 단순 모델
+	 * 월드 행렬은 매번 조상 체인을 곱해서 구한다 (USceneComponent가 계층 캐시 이전에 쓰던 방식)
+	 */
+	class FNaiveHierarchy
+	{
+	public:
+		struct FNode
+		{
+			uint32 Parent = FTransformHierarchy::INVALID_HANDLE;
+			FVector Location;
+			FVector Rotation;
+			FVector Scale = FVector(1.0f, 1.0f, 1.0f);
+			bool bAlive = false;
+		};
+
+		void Add(uint32 InHandle, uint32 InParent, const FVector& InLocation, const FVector& InRotation, const FVector& InScale)
+		{
+			if (InHandle >= Nodes.size())
+			{
+				Nodes.resize(InHandle + 1);
+			}
+			Nodes[InHandle] = { IsAlive(InParent) ? InParent : FTransformHierarchy::INVALID_HANDLE, InLocation, InRotation, InScale, true };
+		}
+
+		/** 자식은 지운 노드의 부모(살아 있는 가장 가까운 조상)에 바로 붙인다 */
+		void Remove(uint32 InHandle)
+		{
+			for (FNode& Node : Nodes)
+			{
+				if (Node.bAlive && Node.Parent == InHandle)
+				{
+					Node.Parent = Nodes[InHandle].Parent;
+				}
+			}
+			Nodes[InHandle].bAlive = false;
+		}
+
+		/** @return 순환이 생겨 거부되면 false */
+		bool SetParent(uint32 InHandle, uint32 InParent)
+		{
+			const uint32 NewParent = IsAlive(InParent) ? InParent : FTransformHierarchy::INVALID_HANDLE;
+			for (uint32 Ancestor = NewParent; Ancestor != FTransformHierarchy::INVALID_HANDLE; Ancestor = Nodes[Ancestor].Parent)
+			{
+				if (Ancestor == InHandle)
+				{
+					return false;
+				}
+			}
+			Nodes[InHandle].Parent = NewParent;
+			return true;
+		}
+
+		FMatrix GetWorldMatrix(uint32 InHandle) const
+		{
+			const FNode& Node = Nodes[InHandle];
+			FMatrix World = FMatrix::GetModelMatrix(Node.Location, FVector::GetDegreeToRadian(Node.Rotation), Node.Scale);
+			if (Node.Parent != FTransformHierarchy::INVALID_HANDLE)
+			{
+				World = World * GetWorldMatrix(Node.Parent);
+			}
+			return World;
+		}
+
+		/** @return InHandle을 포함한 서브트리의 노드 수 */
+		uint32 GetSubtreeSize(uint32 InHandle) const
+		{
+			uint32 Size = 0;
+			for (uint32 Handle = 0; Handle < static_cast<uint32>(Nodes.size()); ++Handle)
+			{
+				for (uint32 Ancestor = Handle; Nodes[Handle].bAlive && Ancestor != FTransformHierarchy::INVALID_HANDLE; Ancestor = Nodes[Ancestor].Parent)
+				{
+					if (Ancestor == InHandle)
+					{
+						++Size;
+						break;
+					}
+				}
+			}
+			return Size;
+		}
+
+		uint32 GetRoot(uint32 InHandle) const
+		{
+			while (Nodes[InHandle].Parent != FTransformHierarchy::INVALID_HANDLE)
+			{
+				InHandle = Nodes[InHandle].Parent;
+			}
+			return InHandle;
+		}
+
+		bool IsAlive(uint32 InHandle) const { return InHandle < Nodes.size() && Nodes[InHandle].bAlive; }
+
+		TArray<uint32> GetAliveHandles() const
+		{
+			TArray<uint32> Handles;
+			for (uint32 Handle = 0; Handle < static_cast<uint32>(Nodes.size()); ++Handle)
+			{
+				if (Nodes[Handle].bAlive)
+				{
+					Handles.push_back(Handle);
+				}
+			}
+			return Handles;
+		}
+
+		TArray<FNode> Nodes;
+	};
+
+	class FHierarchyRandom
+	{
+	public:
+		explicit FHierarchyRandom(uint32 InSeed) : Engine(InSeed) {}
+
+		uint32 GetIndex(uint32 InCount) { return Engine() % InCount; }
+		float GetRange(float InMin, float InMax) { return InMin + (InMax - InMin) * static_cast<float>(Engine() >> 8) * (1.0f / 16777216.0f); }
+		FVector GetVector(float InMin, float InMax) { return FVector(GetRange(InMin, InMax), GetRange(InMin, InMax), GetRange(InMin, InMax)); }
+
+		// 깊은 체인에서도 값이 폭주하지 않도록 스케일은 1 근처로 둔다
+		FVector GetLocation() { return GetVector(-10.0f, 10.0f); }
+		FVector GetRotation() { return GetVector(-180.0f, 180.0f); }
+		FVector GetScale() { return GetVector(0.8f, 1.25f); }
+
+	private:
+		std::mt19937 Engine;
+	};
+
+	/** @return 모든 살아 있는 노드의 월드 행렬 중 단순 모델과 가장 크게 다른 상대 오차 */
+	double GetMaxWorldError(FTransformHierarchy& InHierarchy, const FNaiveHierarchy& InNaive)
+	{
+		double MaxError = 0.0;
+		for (uint32 Handle : InNaive.GetAliveHandles())
+		{
+			const FMatrix& Actual = InHierarchy.GetWorldMatrix(Handle);
+			const FMatrix Expected = InNaive.GetWorldMatrix(Handle);
+
+			double Error = 0.0;
+			double Scale = 1.0;
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					Error = std::max(Error, static_cast<double>(std::abs(Actual.Data[Row][Col] - Expected.Data[Row][Col])));
+					Scale = std::max(Scale, static_cast<double>(std::abs(Expected.Data[Row][Col])));
+				}
+			}
+			MaxError = std::max(MaxError, Error / Scale);
+		}
+		return MaxError;
+	}
+
+	/** @brief 루트 NumRoots개에 나머지 노드를 이미 있는 노드 중 하나의 자식으로 붙인 무작위 숲 */
+	void BuildRandomForest(FTransformHierarchy& InHierarchy, FNaiveHierarchy& InNaive, FHierarchyRandom& InRandom, uint32 InNumNodes, uint32 InNumRoots)
+	{
+		TArray<uint32> Handles;
+		for (uint32 Index = 0; Index < InNumNodes; ++Index)
+		{
+			const uint32 Parent = Index < InNumRoots ? FTransformHierarchy::INVALID_HANDLE : Handles[InRandom.GetIndex(static_cast<uint32>(Handles.size()))];
+			const FVector Location = InRandom.GetLocation();
+			const FVector Rotation = InRandom.GetRotation();
+			const FVector Scale = InRandom.GetScale();
+
+			const uint32 Handle = InHierarchy.Add(nullptr, Parent, Location, Rotation, Scale);
+			InNaive.Add(Handle, Parent, Location, Rotation, Scale);
+			Handles.push_back(Handle);
+		}
+	}
+
+	constexpr double HIERARCHY_TOLERANCE = 1e-5;
+}
+
+/**
+ * @brief TFlatMap을 std::unordered_map과, FTransformHierarchy를 조상 체인을 곱하는 단순 모델과 같은 연산 순서로 돌려 결과가 같은지 확인한다
+ * PlatformTime은 보정한 TSC 주기가 기준 시계와 맞는지 본다
+ */
+void RunCoreTests(FTestContext& InContext)
+{
+	InContext.Run("FlatMap.Fuzz", [&]
+	{
+		// 키 범위를 좁혀 삽입/삭제가 같은 키에 반복되도록 한다 (Tombstone 재사용과 같은 크기 재해시가 일어난다)
+		std::mt19937 Random(20251001);
+		TFlatMap<uint32, uint32> FlatMap;
+		std::unordered_map<uint32, uint32> StdMap;
+
+		bool bSameResults = true;
+		for (uint32 Step = 0; Step < 200000; ++Step)
+		{
+			const uint32 Key = Random() % 4096;
+			const uint32 Value = Random();
+			switch (Random() % 6)
+			{
+			case 0:
+				bSameResults &= FlatMap.insert({ Key, Value }).second == StdMap.insert({ Key, Value }).second;
+				break;
+			case 1:
+				FlatMap[Key] = Value;
+				StdMap[Key] = Value;
+				break;
+			case 2:
+				bSameResults &= FlatMap.emplace(Key, Value).second == StdMap.emplace(Key, Value).second;
+				break;
+			case 3:
+			case 4:
+				bSameResults &= FlatMap.erase(Key) == StdMap.erase(Key);
+				break;
+			default:
+			{
+				auto FlatIter = FlatMap.find(Key);
+				auto StdIter = StdMap.find(Key);
+				bSameResults &= (FlatIter == FlatMap.end()) == (StdIter == StdMap.end());
+				bSameResults &= FlatIter == FlatMap.end() || FlatIter->second == StdIter->second;
+				break;
+			}
+			}
+		}
+
+		TEST_CHECK(InContext, bSameResults);
+		TEST_CHECK(InContext, HasSameElements(FlatMap, StdMap));
+	});
+
+	InContext.Run("FlatMap.EraseDuringIteration", [&]
+	{
+		TFlatMap<uint32, uint32> FlatMap;
+		std::unordered_map<uint32, uint32> StdMap;
+		for (uint32 Key = 0; Key < 10000; ++Key)
+		{
+			FlatMap[Key * 7919u] = Key;
+			StdMap[Key * 7919u] = Key;
+		}
+
+		// 홀수 값만 지우면서 끝까지 순회한다
+		for (auto Iter = FlatMap.begin(); Iter != FlatMap.end();)
+		{
+			Iter = (Iter->second & 1) ? FlatMap.erase(Iter) : std::next(Iter);
+		}
+		for (auto Iter = StdMap.begin(); Iter != StdMap.end();)
+		{
+			Iter = (Iter->second & 1) ? StdMap.erase(Iter) : std::next(Iter);
+		}
+
+		TEST_CHECK(InContext, FlatMap.size() == 5000);
+		TEST_CHECK(InContext, HasSameElements(FlatMap, StdMap));
+	});
+
+	InContext.Run("FlatMap.MoveOnlyValue", [&]
+	{
+		TFlatMap<FString, std::unique_ptr<uint32>> FlatMap;
+		for (uint32 Index = 0; Index < 1000; ++Index)
+		{
+			FlatMap.try_emplace("Key" + std::to_string(Index), std::make_unique<uint32>(Index));
+		}
+
+		// 재해시로 원소가 이동한 뒤에도 값이 그대로여야 한다
+		bool bValuesKept = FlatMap.size() == 1000;
+		for (uint32 Index = 0; Index < 1000; ++Index)
+		{
+			auto Iter = FlatMap.find("Key" + std::to_string(Index));
+			bValuesKept &= Iter != FlatMap.end() && Iter->second && *Iter->second == Index;
+		}
+		TEST_CHECK(InContext, bValuesKept);
+
+		TFlatMap<FString, std::unique_ptr<uint32>> Moved = std::move(FlatMap);
+		TEST_CHECK(InContext, Moved.size() == 1000);
+		TEST_CHECK(InContext, FlatMap.empty());
+	});
+
+	InContext.Run("TransformHierarchy.SubtreeRanges", [&]
+	{
+		// 노드 하나를 바꾸면 정확히 그 서브트리만 다시 계산해야 한다
+		// RebuildOrder가 전위 순서를 만들고 SubtreeEnds가 서브트리를 빈틈없이 덮을 때만 개수가 맞는다
+		FHierarchyRandom Random(20251001);
+		FTransformHierarchy Hierarchy;
+		FNaiveHierarchy Naive;
+		BuildRandomForest(Hierarchy, Naive, Random, 500, 8);
+		Hierarchy.Update();
+		TEST_CHECK(InContext, Hierarchy.GetNumUpdatedNodes() == 500);
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+
+		bool bSameCounts = true;
+		for (uint32 Step = 0; Step < 200; ++Step)
+		{
+			const uint32 Handle = Random.GetIndex(500);
+			FNaiveHierarchy::FNode& Node = Naive.Nodes[Handle];
+			Node.Location = Random.GetLocation();
+			Hierarchy.SetLocalTransform(Handle, Node.Location, Node.Rotation, Node.Scale);
+			Hierarchy.Update();
+			bSameCounts &= Hierarchy.GetNumUpdatedNodes() == Naive.GetSubtreeSize(Handle);
+		}
+		TEST_CHECK(InContext, bSameCounts);
+
+		// 조상과 자손이 같이 dirty면 조상 서브트리 한 번으로 끝난다, 바뀐 게 없으면 아무것도 다시 계산하지 않는다
+		const uint32 Leaf = Naive.GetAliveHandles().back();
+		const uint32 Root = Naive.GetRoot(Leaf);
+		Hierarchy.SetLocalTransform(Leaf, Naive.Nodes[Leaf].Location, Naive.Nodes[Leaf].Rotation, Naive.Nodes[Leaf].Scale);
+		Hierarchy.SetLocalTransform(Root, Naive.Nodes[Root].Location, Naive.Nodes[Root].Rotation, Naive.Nodes[Root].Scale);
+		Hierarchy.Update();
+		TEST_CHECK(InContext, Hierarchy.GetNumUpdatedNodes() == Naive.GetSubtreeSize(Root));
+		Hierarchy.Update();
+		TEST_CHECK(InContext, Hierarchy.GetNumUpdatedNodes() == 0);
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+	});
+
+	InContext.Run("TransformHierarchy.RemoveReparents", [&]
+	{
+		// A -> B -> C -> D 체인에서 B, C를 지우면 D는 A에 붙는다
+		FTransformHierarchy Hierarchy;
+		FNaiveHierarchy Naive;
+		const FVector Scale(1.0f, 1.0f, 1.0f);
+		uint32 Handles[4];
+		for (uint32 Index = 0; Index < 4; ++Index)
+		{
+			const uint32 Parent = Index == 0 ? FTransformHierarchy::INVALID_HANDLE : Handles[Index - 1];
+			const FVector Location(static_cast<float>(Index + 1), 0.0f, 0.0f);
+			const FVector Rotation(0.0f, 0.0f, 30.0f * static_cast<float>(Index));
+			Handles[Index] = Hierarchy.Add(nullptr, Parent, Location, Rotation, Scale);
+			Naive.Add(Handles[Index], Parent, Location, Rotation, Scale);
+		}
+		Hierarchy.Update();
+
+		Hierarchy.Remove(Handles[1]);
+		Naive.Remove(Handles[1]);
+		Hierarchy.Remove(Handles[2]);
+		Naive.Remove(Handles[2]);
+		TEST_CHECK(InContext, !Hierarchy.IsValid(Handles[1]) && !Hierarchy.IsValid(Handles[2]));
+		TEST_CHECK(InContext, Hierarchy.GetNumNodes() == 2);
+
+		// 순서를 다시 만들기 전에는 지운 핸들을 재사용하지 않는다 (D가 아직 지운 노드를 부모로 가리킨다)
+		const uint32 Early = Hierarchy.Add(nullptr, FTransformHierarchy::INVALID_HANDLE, Scale, FVector(), Scale);
+		Naive.Add(Early, FTransformHierarchy::INVALID_HANDLE, Scale, FVector(), Scale);
+		TEST_CHECK(InContext, Early != Handles[1] && Early != Handles[2]);
+
+		// 재연결로 D의 월드 행렬이 바뀌었으므로 dirty로 본다
+		TEST_CHECK(InContext, Hierarchy.IsWorldDirty(Handles[3]));
+		TEST_CHECK(InContext, Naive.Nodes[Handles[3]].Parent == Handles[0]);
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+
+		// 순서를 다시 만든 뒤에는 지운 핸들을 재사용한다
+		const uint32 Reused = Hierarchy.Add(nullptr, Handles[3], Scale, FVector(), Scale);
+		Naive.Add(Reused, Handles[3], Scale, FVector(), Scale);
+		TEST_CHECK(InContext, Reused == Handles[1] || Reused == Handles[2]);
+
+		// 루트를 지우면 자식은 루트가 된다
+		Hierarchy.Remove(Handles[0]);
+		Naive.Remove(Handles[0]);
+		Hierarchy.Update();
+		TEST_CHECK(InContext, Naive.Nodes[Handles[3]].Parent == FTransformHierarchy::INVALID_HANDLE);
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+		TEST_CHECK(InContext, Hierarchy.GetNumNodes() == 3);
+	});
+
+	InContext.Run("TransformHierarchy.SetParentRejectsCycles", [&]
+	{
+		FTransformHierarchy Hierarchy;
+		FNaiveHierarchy Naive;
+		FHierarchyRandom Random(20251002);
+		uint32 Handles[3];
+		for (uint32 Index = 0; Index < 3; ++Index)
+		{
+			const uint32 Parent = Index == 0 ? FTransformHierarchy::INVALID_HANDLE : Handles[Index - 1];
+			const FVector Location = Random.GetLocation();
+			const FVector Rotation = Random.GetRotation();
+			const FVector Scale = Random.GetScale();
+			Handles[Index] = Hierarchy.Add(nullptr, Parent, Location, Rotation, Scale);
+			Naive.Add(Handles[Index], Parent, Location, Rotation, Scale);
+		}
+		Hierarchy.Update();
+		const FMatrix RootWorld = Hierarchy.GetWorldMatrix(Handles[0]);
+
+		// 자손이나 자신 아래로 옮기는 것은 무시된다
+		Hierarchy.SetParent(Handles[0], Handles[2]);
+		Hierarchy.SetParent(Handles[0], Handles[0]);
+		Hierarchy.SetParent(Handles[1], Handles[2]);
+		TEST_CHECK(InContext, !Hierarchy.IsWorldDirty(Handles[0]));
+		TEST_CHECK(InContext, memcmp(&RootWorld, &Hierarchy.GetWorldMatrix(Handles[0]), sizeof(FMatrix)) == 0);
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+
+		// 순환이 아닌 이동은 받아들인다: C를 루트로, 그다음 A를 C 아래로
+		Hierarchy.SetParent(Handles[2], FTransformHierarchy::INVALID_HANDLE);
+		TEST_CHECK(InContext, Naive.SetParent(Handles[2], FTransformHierarchy::INVALID_HANDLE));
+		Hierarchy.SetParent(Handles[0], Handles[2]);
+		TEST_CHECK(InContext, Naive.SetParent(Handles[0], Handles[2]));
+		TEST_CHECK(InContext, Hierarchy.IsWorldDirty(Handles[1]));
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+	});
+
+	InContext.Run("TransformHierarchy.UpdateNodeMidFrame", [&]
+	{
+		// 프레임 중간 조회는 조회한 노드를 덮는 서브트리만 계산하고, 나머지는 다음 Update가 처리한다
+		FHierarchyRandom Random(20251003);
+		FTransformHierarchy Hierarchy;
+		FNaiveHierarchy Naive;
+		BuildRandomForest(Hierarchy, Naive, Random, 64, 2);
+		Hierarchy.Update();
+
+		const uint32 Roots[2] = { 0, 1 };
+		for (uint32 Root : Roots)
+		{
+			FNaiveHierarchy::FNode& Node = Naive.Nodes[Root];
+			Node.Rotation = Random.GetRotation();
+			Hierarchy.SetLocalTransform(Root, Node.Location, Node.Rotation, Node.Scale);
+		}
+
+		// 첫 번째 루트 아래의 잎 노드 (숲은 앞 두 노드만 루트로 만든다)
+		const TArray<uint32> Handles = Naive.GetAliveHandles();
+		const auto LeafIter = std::find_if(Handles.rbegin(), Handles.rend(), [&](uint32 InHandle)
+		{
+			return InHandle != Roots[0] && Naive.GetRoot(InHandle) == Roots[0] && Naive.GetSubtreeSize(InHandle) == 1;
+		});
+		TEST_CHECK(InContext, LeafIter != Handles.rend());
+		const uint32 Leaf = LeafIter != Handles.rend() ? *LeafIter : Roots[0];
+
+		TEST_CHECK(InContext, Hierarchy.IsWorldDirty(Leaf));
+		const FMatrix LeafWorld = Hierarchy.GetWorldMatrix(Leaf);
+		const FMatrix ExpectedLeafWorld = Naive.GetWorldMatrix(Leaf);
+		TEST_CHECK(InContext, memcmp(&LeafWorld, &ExpectedLeafWorld, sizeof(FMatrix)) == 0);
+		TEST_CHECK(InContext, !Hierarchy.IsWorldDirty(Leaf));
+		TEST_CHECK(InContext, !Hierarchy.IsWorldDirty(Roots[0]));
+		TEST_CHECK(InContext, Hierarchy.IsWorldDirty(Roots[1]));
+
+		Hierarchy.Update();
+		TEST_CHECK(InContext, Hierarchy.GetNumUpdatedNodes() == Naive.GetSubtreeSize(Roots[1]));
+		TEST_CHECK(InContext, !Hierarchy.IsWorldDirty(Roots[1]));
+		TEST_CHECK_NEAR(InContext, GetMaxWorldError(Hierarchy, Naive), 0.0, HIERARCHY_TOLERANCE);
+	});
+
+	InContext.Run("TransformHierarchy.Fuzz", [&]
+	{
+		// 무작위 추가/이동/부모 변경/삭제/중간 조회를 섞고 주기적으로 모든 노드를 조상 체인 곱과 비교한다
+		FHierarchyRandom Random(20251004);
+		FTransformHierarchy Hierarchy;
+		FNaiveHierarchy Naive;
+		BuildRandomForest(Hierarchy, Naive, Random, 200, 4);
+
+		double MaxError = 0.0;
+		bool bSameNodeCount = true;
+		uint32 NumRejectedCycles = 0;
+		for (uint32 Step = 0; Step < 4000; ++Step)
+		{
+			const TArray<uint32> Alive = Naive.GetAliveHandles();
+			const uint32 Handle = Alive[Random.GetIndex(static_cast<uint32>(Alive.size()))];
+			const uint32 Other = Alive[Random.GetIndex(static_cast<uint32>(Alive.size()))];
+
+			switch (Random.GetIndex(8))
+			{
+			case 0:
+			{
+				const uint32 Parent = Random.GetIndex(4) == 0 ? FTransformHierarchy::INVALID_HANDLE : Other;
+				const FVector Location = Random.GetLocation();
+				const FVector Rotation = Random.GetRotation();
+				const FVector Scale = Random.GetScale();
+				const uint32 NewHandle = Hierarchy.Add(nullptr, Parent, Location, Rotation, Scale);
+				Naive.Add(NewHandle, Parent, Location, Rotation, Scale);
+				break;
+			}
+			case 1:
+				if (Alive.size() > 20)
+				{
+					Hierarchy.Remove(Handle);
+					Naive.Remove(Handle);
+				}
+				break;
+			case 2:
+			{
+				const uint32 Parent = Random.GetIndex(4) == 0 ? FTransformHierarchy::INVALID_HANDLE : Other;
+				Hierarchy.SetParent(Handle, Parent);
+				NumRejectedCycles += Naive.SetParent(Handle, Parent) ? 0 : 1;
+				break;
+			}
+			case 3:
+				(void)Hierarchy.GetWorldMatrix(Handle);
+				break;
+			case 4:
+				Hierarchy.Update();
+				break;
+			default:
+			{
+				FNaiveHierarchy::FNode& Node = Naive.Nodes[Handle];
+				Node.Location = Random.GetLocation();
+				Node.Rotation = Random.GetRotation();
+				Node.Scale = Random.GetScale();
+				Hierarchy.SetLocalTransform(Handle, Node.Location, Node.Rotation, Node.Scale);
+				break;
+			}
+			}
+
+			bSameNodeCount &= Hierarchy.GetNumNodes() == Naive.GetAliveHandles().size();
+			if (Step % 200 == 199)
+			{
+				if (Step % 400 == 399)
+				{
+					Hierarchy.Update();
+				}
+				MaxError = std::max(MaxError, GetMaxWorldError(Hierarchy, Naive));
+			}
+		}
+
+		TEST_CHECK(InContext, bSameNodeCount);
+		TEST_CHECK(InContext, NumRejectedCycles > 0);
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, HIERARCHY_TOLERANCE);
+	});
+
+	InContext.Run("PlatformTime.Calibration", [&]
+	{
+		// 보정한 사이클 주기로 바꾼 시간이 기준 시계로 잰 같은 구간과 맞아야 한다 (잠드는 동안 TSC도 계속 흐른다)
+		FWindowsPlatformTime::InitTiming();
+		const uint64 ReferenceStart = FWindowsPlatformTime::ReferenceCycles64();
+		const uint64 StartCycles = FWindowsPlatformTime::Cycles64();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		const uint64 EndCycles = FWindowsPlatformTime::Cycles64();
+		const uint64 ReferenceEnd = FWindowsPlatformTime::ReferenceCycles64();
+
+		const double Ms = FWindowsPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+		const double ReferenceMs = static_cast<double>(ReferenceEnd - ReferenceStart) * 1000.0 / static_cast<double>(FWindowsPlatformTime::GetFrequency());
+		TEST_CHECK(InContext, ReferenceMs >= 50.0);
+		TEST_CHECK_NEAR(InContext, Ms, ReferenceMs, ReferenceMs * 0.01);
+	});
+}
@@ -0,0 +1,574 @@
+#include "pch.h"
+#include "Test/Public/Test.h"
+
+#include "Physics/Public/Box.h"
+
+#include <random>
+
+namespace
+{
+	constexpr uint32 NUM_MATRICES = 2000;
+	constexpr uint32 SEED = 20251001;
+
+	// SSE 커널과 double 스칼라 기준값의 허용 오차 (기준 행렬의 가장 큰 성분에 대한 상대값)
+	constexpr double MATRIX_TOLERANCE = 1e-5;
+
+	struct FRandomTRS
+	{
+		FVector Location;
+		FVector Rotation;
+		FVector Scale;
+	};
+
+	class FTestRandom
+	{
+	public:
+		explicit FTestRandom(uint32 InSeed) : Engine(InSeed) {}
+
+		float GetRange(float InMin, float InMax) { return InMin + (InMax - InMin) * static_cast<float>(Engine() >> 8) * (1.0f / 16777216.0f); }
+		FVector GetVector(float InMin, float InMax) { return FVector(GetRange(InMin, InMax), GetRange(InMin, InMax), GetRange(InMin, InMax)); }
+
+		FRandomTRS GetTRS()
+		{
+			return { GetVector(-100.0f, 100.0f), GetVector(-PI, PI), GetVector(0.2f, 5.0f) };
+		}
+
+	private:
+		std::mt19937 Engine;
+	};
+
+	/** @brief 행 우선 4x4 double 행렬, SSE 커널의 비교 기준 */
+	struct FReferenceMatrix
+	{
+		double M[4][4];
+
+		explicit FReferenceMatrix(const FMatrix& InMatrix)
+		{
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					M[Row][Col] = InMatrix.Data[Row][Col];
+				}
+			}
+		}
+
+		double Minor(int32 InRow, int32 InCol) const
+		{
+			double Sub[3][3];
+			for (int32 Row = 0, SubRow = 0; Row < 4; ++Row)
+			{
+				if (Row == InRow)
+				{
+					continue;
+				}
+				for (int32 Col = 0, SubCol = 0; Col < 4; ++Col)
+				{
+					if (Col != InCol)
+					{
+						Sub[SubRow][SubCol++] = M[Row][Col];
+					}
+				}
+				++SubRow;
+			}
+
+			return Sub[0][0] * (Sub[1][1] * Sub[2][2] - Sub[1][2] * Sub[2][1])
+				- Sub[0][1] * (Sub[1][0] * Sub[2][2] - Sub[1][2] * Sub[2][0])
+				+ Sub[0][2] * (Sub[1][0] * Sub[2][1] - Sub[1][1] * Sub[2][0]);
+		}
+
+		/** 여인수 전개 역행렬 (SSE 이전 FMatrix::Inverse와 같은 방식) */
+		FReferenceMatrix Inverse() const
+		{
+			FReferenceMatrix Result = *this;
+
+			double Determinant = 0.0;
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				Determinant += ((Col & 1) ? -1.0 : 1.0) * M[0][Col] * Minor(0, Col);
+			}
+
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					const double Sign = ((Row + Col) & 1) ? -1.0 : 1.0;
+					Result.M[Col][Row] = Sign * Minor(Row, Col) / Determinant;
+				}
+			}
+			return Result;
+		}
+
+		FReferenceMatrix Multiply(const FReferenceMatrix& InOther) const
+		{
+			FReferenceMatrix Result = *this;
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					Result.M[Row][Col] = M[Row][0] * InOther.M[0][Col] + M[Row][1] * InOther.M[1][Col]
+						+ M[Row][2] * InOther.M[2][Col] + M[Row][3] * InOther.M[3][Col];
+				}
+			}
+			return Result;
+		}
+
+		double GetMaxAbs() const
+		{
+			double MaxAbs = 0.0;
+			for (int32 Row = 0; Row < 4; ++Row)
+			{
+				for (int32 Col = 0; Col < 4; ++Col)
+				{
+					MaxAbs = std::max(MaxAbs, std::abs(M[Row][Col]));
+				}
+			}
+			return MaxAbs;
+		}
+	};
+
+	/** @return 두 행렬의 가장 큰 성분 차이를 기준 행렬 크기로 나눈 값 */
+	double GetRelativeError(const FMatrix& InActual, const FReferenceMatrix& InExpected)
+	{
+		double MaxError = 0.0;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				MaxError = std::max(MaxError, std::abs(InActual.Data[Row][Col] - InExpected.M[Row][Col]));
+			}
+		}
+		return MaxError / std::max(1.0, InExpected.GetMaxAbs());
+	}
+
+	/** @brief 부모의 비균등 스케일 때문에 기울어진(shear) 월드 행렬 */
+	FMatrix MakeShearedMatrix(FTestRandom& InRandom)
+	{
+		const FRandomTRS Parent = InRandom.GetTRS();
+		const FRandomTRS Child = InRandom.GetTRS();
+		FMatrix ChildMatrix = FMatrix::GetModelMatrix(Child.Location, Child.Rotation, Child.Scale);
+		return ChildMatrix * FMatrix::GetModelMatrix(Parent.Location, Parent.Rotation, Parent.Scale);
+	}
+
+	FRay MakeRay(const FVector& InOrigin, const FVector& InDirection)
+	{
+		return { FVector4(InOrigin.X, InOrigin.Y, InOrigin.Z, 1.0f), FVector4(InDirection.X, InDirection.Y, InDirection.Z, 0.0f) };
+	}
+
+	/**
+	 * @brief double 스칼라 슬랩 검사, FBox::IntersectRay의 비교 기준
+	 * 경계면은 박스 안으로 보고, 축과 평행한 성분은 시작점이 슬랩 안(경계 포함)에 있어야 한다
+	 * @param OutExit 교차 구간의 끝 (판정이 애매한 스칠 때를 걸러내는 데 쓴다)
+	 */
+	bool ReferenceIntersectRay(const FBox& InBox, const FRay& InRay, float InMaxDistance, double& OutEnter, double& OutExit)
+	{
+		OutEnter = 0.0;
+		OutExit = InMaxDistance;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const double Origin = InRay.Origin[Axis];
+			const double Direction = InRay.Direction[Axis];
+			if (Direction == 0.0)
+			{
+				if (Origin < InBox.Min[Axis] || Origin > InBox.Max[Axis])
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const double T1 = (InBox.Min[Axis] - Origin) / Direction;
+			const double T2 = (InBox.Max[Axis] - Origin) / Direction;
+			OutEnter = std::max(OutEnter, std::min(T1, T2));
+			OutExit = std::min(OutExit, std::max(T1, T2));
+		}
+		return OutEnter <= OutExit;
+	}
+
+	bool IntersectRay(const FBox& InBox, const FRay& InRay, float InMaxDistance, float& OutEnter)
+	{
+		return InBox.IntersectRay(FRayQuery(InRay), InMaxDistance, OutEnter);
+	}
+
+	/** @brief 8개 꼭짓점을 double로 옮겨 감싸는 박스 (Arvo 이전 GetWorldAABB와 같은 방식), FBox::TransformBy의 비교 기준 */
+	void ReferenceTransformBox(const FBox& InBox, const FMatrix& InMatrix, double OutMin[3], double OutMax[3])
+	{
+		const FReferenceMatrix Matrix(InMatrix);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutMin[Axis] = +DBL_MAX;
+			OutMax[Axis] = -DBL_MAX;
+		}
+
+		for (uint32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const double Point[3] = {
+				(Corner & 1) ? InBox.Max[0] : InBox.Min[0],
+				(Corner & 2) ? InBox.Max[1] : InBox.Min[1],
+				(Corner & 4) ? InBox.Max[2] : InBox.Min[2] };
+
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const double World = Point[0] * Matrix.M[0][Axis] + Point[1] * Matrix.M[1][Axis] + Point[2] * Matrix.M[2][Axis] + Matrix.M[3][Axis];
+				OutMin[Axis] = std::min(OutMin[Axis], World);
+				OutMax[Axis] = std::max(OutMax[Axis], World);
+			}
+		}
+	}
+
+	/** @return 두 박스의 가장 큰 경계 차이를 기준 박스 크기로 나눈 값 */
+	double GetBoxRelativeError(const FBox& InActual, const double InExpectedMin[3], const double InExpectedMax[3])
+	{
+		double MaxError = 0.0;
+		double MaxAbs = 1.0;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			MaxError = std::max(MaxError, std::abs(InActual.Min[Axis] - InExpectedMin[Axis]));
+			MaxError = std::max(MaxError, std::abs(InActual.Max[Axis] - InExpectedMax[Axis]));
+			MaxAbs = std::max({ MaxAbs, std::abs(InExpectedMin[Axis]), std::abs(InExpectedMax[Axis]) });
+		}
+		return MaxError / MaxAbs;
+	}
+
+	/** @brief 무작위 축에 음수 스케일(거울상)을 준 TRS 행렬 */
+	FMatrix MakeMirroredMatrix(FTestRandom& InRandom)
+	{
+		FRandomTRS TRS = InRandom.GetTRS();
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (InRandom.GetRange(0.0f, 1.0f) < 0.5f)
+			{
+				TRS.Scale[Axis] = -TRS.Scale[Axis];
+			}
+		}
+		return FMatrix::GetModelMatrix(TRS.Location, TRS.Rotation, TRS.Scale);
+	}
+}
+
+/**
+ * @brief SSE 행렬 커널을 double 스칼라 계산과 비교한다
+ * 일반 / 아핀 / TRS 역행렬, 곱, 전치, 벡터 변환을 무작위 TRS와 기울어진 행렬에서 확인한다
+ */
+void RunMathTests(FTestContext& InContext)
+{
+	InContext.Run("Matrix.Inverse", [&]
+	{
+		FTestRandom Random(SEED);
+		double MaxError = 0.0;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			const FMatrix Matrix = (i & 1) ? MakeShearedMatrix(Random) : [&]
+			{
+				const FRandomTRS TRS = Random.GetTRS();
+				return FMatrix::GetModelMatrix(TRS.Location, TRS.Rotation, TRS.Scale);
+			}();
+			MaxError = std::max(MaxError, GetRelativeError(Matrix.Inverse(), FReferenceMatrix(Matrix).Inverse()));
+		}
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Matrix.InverseSingular", [&]
+	{
+		const FMatrix Singular(
+			1.0f, 2.0f, 3.0f, 0.0f,
+			2.0f, 4.0f, 6.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			0.0f, 0.0f, 0.0f, 1.0f);
+		TEST_CHECK_NEAR(InContext, GetRelativeError(Singular.Inverse(), FReferenceMatrix(FMatrix::Identity())), 0.0, 0.0);
+	});
+
+	InContext.Run("Matrix.InverseAffine", [&]
+	{
+		FTestRandom Random(SEED + 1);
+		double MaxError = 0.0;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			const FMatrix Matrix = MakeShearedMatrix(Random);
+			MaxError = std::max(MaxError, GetRelativeError(Matrix.InverseAffine(), FReferenceMatrix(Matrix).Inverse()));
+		}
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Matrix.ModelMatrixInverse", [&]
+	{
+		FTestRandom Random(SEED + 2);
+		double MaxError = 0.0;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			const FRandomTRS TRS = Random.GetTRS();
+			const FMatrix Model = FMatrix::GetModelMatrix(TRS.Location, TRS.Rotation, TRS.Scale);
+			const FMatrix Inverse = FMatrix::GetModelMatrixInverse(TRS.Location, TRS.Rotation, TRS.Scale);
+			MaxError = std::max(MaxError, GetRelativeError(Inverse, FReferenceMatrix(Model).Inverse()));
+		}
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Matrix.Multiply", [&]
+	{
+		FTestRandom Random(SEED + 3);
+		double MaxError = 0.0;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			FMatrix Left = MakeShearedMatrix(Random);
+			const FMatrix Right = MakeShearedMatrix(Random);
+			MaxError = std::max(MaxError, GetRelativeError(Left * Right, FReferenceMatrix(Left).Multiply(FReferenceMatrix(Right))));
+		}
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Matrix.Transpose", [&]
+	{
+		FTestRandom Random(SEED + 4);
+		const FMatrix Matrix = MakeShearedMatrix(Random);
+		const FMatrix Transposed = Matrix.Transpose();
+
+		bool bExact = true;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				bExact = bExact && Transposed.Data[Row][Col] == Matrix.Data[Col][Row];
+			}
+		}
+		TEST_CHECK(InContext, bExact);
+	});
+
+	InContext.Run("Matrix.VectorMultiply", [&]
+	{
+		FTestRandom Random(SEED + 5);
+		double MaxError = 0.0;
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			const FMatrix Matrix = MakeShearedMatrix(Random);
+			const FReferenceMatrix Reference(Matrix);
+			const double Scale = std::max(1.0, Reference.GetMaxAbs());
+
+			const FVector4 Vector4(Random.GetRange(-10.0f, 10.0f), Random.GetRange(-10.0f, 10.0f), Random.GetRange(-10.0f, 10.0f), 1.0f);
+			const FVector4 Result4 = FMatrix::VectorMultiply(Vector4, Matrix);
+			const double Input4[4] = { Vector4.X, Vector4.Y, Vector4.Z, Vector4.W };
+			const double Output4[4] = { Result4.X, Result4.Y, Result4.Z, Result4.W };
+
+			// FVector 버전은 W = 0 (방향)으로 변환한다
+			const FVector Vector3 = Random.GetVector(-10.0f, 10.0f);
+			const FVector Result3 = FMatrix::VectorMultiply(Vector3, Matrix);
+			const double Input3[3] = { Vector3.X, Vector3.Y, Vector3.Z };
+			const double Output3[3] = { Result3.X, Result3.Y, Result3.Z };
+
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				double Expected4 = 0.0;
+				double Expected3 = 0.0;
+				for (int32 Row = 0; Row < 4; ++Row)
+				{
+					Expected4 += Input4[Row] * Reference.M[Row][Col];
+					Expected3 += Row < 3 ? Input3[Row] * Reference.M[Row][Col] : 0.0;
+				}
+
+				MaxError = std::max(MaxError, std::abs(Output4[Col] - Expected4) / (Scale * 10.0));
+				if (Col < 3)
+				{
+					MaxError = std::max(MaxError, std::abs(Output3[Col] - Expected3) / (Scale * 10.0));
+				}
+			}
+		}
+		TEST_CHECK_NEAR(InContext, MaxError, 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Box.TransformBy", [&]
+	{
+		// 회전, 음수 스케일, 부모 비균등 스케일로 기울어진 행렬에서 8 꼭짓점 방식과 같은 박스를 만들어야 한다
+		FTestRandom Random(SEED + 7);
+		double MaxError[3] = {};
+		for (uint32 i = 0; i < NUM_MATRICES; ++i)
+		{
+			const FVector Center = Random.GetVector(-50.0f, 50.0f);
+			const FVector Extent = Random.GetVector(0.0f, 10.0f);
+			const FBox LocalBox = FBox::Make(Center - Extent, Center + Extent);
+
+			const FRandomTRS TRS = Random.GetTRS();
+			const FMatrix Matrices[3] = {
+				FMatrix::GetModelMatrix(TRS.Location, TRS.Rotation, TRS.Scale),
+				MakeMirroredMatrix(Random),
+				MakeShearedMatrix(Random) };
+
+			for (uint32 Kind = 0; Kind < 3; ++Kind)
+			{
+				double ExpectedMin[3];
+				double ExpectedMax[3];
+				ReferenceTransformBox(LocalBox, Matrices[Kind], ExpectedMin, ExpectedMax);
+				MaxError[Kind] = std::max(MaxError[Kind], GetBoxRelativeError(LocalBox.TransformBy(Matrices[Kind]), ExpectedMin, ExpectedMax));
+			}
+		}
+
+		TEST_CHECK_NEAR(InContext, MaxError[0], 0.0, MATRIX_TOLERANCE);
+		TEST_CHECK_NEAR(InContext, MaxError[1], 0.0, MATRIX_TOLERANCE);
+		TEST_CHECK_NEAR(InContext, MaxError[2], 0.0, MATRIX_TOLERANCE);
+	});
+
+	InContext.Run("Box.TransformByDegenerate", [&]
+	{
+		FTestRandom Random(SEED + 8);
+		const FMatrix Matrix = MakeMirroredMatrix(Random);
+
+		// 빈 박스는 항등 행렬(0 성분)에서도 NaN이 아닌 빈 박스로 남는다
+		TEST_CHECK(InContext, FBox::Empty().TransformBy(FMatrix::Identity()).IsEmpty());
+		TEST_CHECK(InContext, FBox::Empty().TransformBy(Matrix).IsEmpty());
+
+		// 점 박스는 점 하나로 옮겨진다
+		const FVector Point(3.0f, -2.0f, 7.0f);
+		double ExpectedMin[3];
+		double ExpectedMax[3];
+		ReferenceTransformBox(FBox::Make(Point, Point), Matrix, ExpectedMin, ExpectedMax);
+		const FBox PointBox = FBox::Make(Point, Point).TransformBy(Matrix);
+		TEST_CHECK(InContext, !PointBox.IsEmpty());
+		TEST_CHECK_NEAR(InContext, GetBoxRelativeError(PointBox, ExpectedMin, ExpectedMax), 0.0, MATRIX_TOLERANCE);
+
+		// 결과의 W 레인은 항상 0이다 (SSE 비교에서 W 레인을 따로 거르지 않는 곳이 있다)
+		const FBox Moved = FBox::Make(FVector(-1.0f, -1.0f, -1.0f), FVector(1.0f, 1.0f, 1.0f)).TransformBy(Matrix);
+		TEST_CHECK(InContext, Moved.Min[3] == 0.0f && Moved.Max[3] == 0.0f);
+	});
+
+	InContext.Run("Box.TransformBoxes", [&]
+	{
+		// 구간 변환은 원소별 TransformBy와 비트 단위로 같아야 한다 (빈 박스가 섞여 있어도)
+		FTestRandom Random(SEED + 9);
+		constexpr uint32 NUM_BOXES = 257;
+		TArray<FBox> LocalBoxes;
+		TArray<FMatrix> Matrices;
+		for (uint32 i = 0; i < NUM_BOXES; ++i)
+		{
+			const FVector Center = Random.GetVector(-50.0f, 50.0f);
+			const FVector Extent = Random.GetVector(0.0f, 10.0f);
+			LocalBoxes.push_back(i % 17 == 0 ? FBox::Empty() : FBox::Make(Center - Extent, Center + Extent));
+			Matrices.push_back((i & 1) ? MakeMirroredMatrix(Random) : MakeShearedMatrix(Random));
+		}
+
+		TArray<FBox> WorldBoxes(NUM_BOXES);
+		FBox::TransformBoxes(LocalBoxes.data(), Matrices.data(), WorldBoxes.data(), NUM_BOXES);
+
+		bool bSame = true;
+		for (uint32 i = 0; i < NUM_BOXES; ++i)
+		{
+			const FBox Expected = LocalBoxes[i].TransformBy(Matrices[i]);
+			bSame = bSame && memcmp(&Expected, &WorldBoxes[i], sizeof(FBox)) == 0;
+		}
+		TEST_CHECK(InContext, bSame);
+	});
+
+	InContext.Run("Box.IntersectRayCases", [&]
+	{
+		const FBox Box = FBox::Make(FVector(0.0f, 0.0f, 0.0f), FVector(1.0f, 1.0f, 1.0f));
+		float Enter = -1.0f;
+
+		// 축과 평행한 레이가 슬랩 경계면 위에 있으면 (0 * inf = NaN 레인) 박스에 닿는 것으로 본다
+		TEST_CHECK(InContext, IntersectRay(Box, MakeRay(FVector(0.0f, 0.5f, -5.0f), FVector(0.0f, 0.0f, 1.0f)), 100.0f, Enter) && Enter == 5.0f);
+		TEST_CHECK(InContext, IntersectRay(Box, MakeRay(FVector(1.0f, 1.0f, -5.0f), FVector(0.0f, 0.0f, 1.0f)), 100.0f, Enter) && Enter == 5.0f);
+		TEST_CHECK(InContext, IntersectRay(Box, MakeRay(FVector(1.0f, 0.5f, -5.0f), FVector(-0.0f, 0.0f, 1.0f)), 100.0f, Enter) && Enter == 5.0f);
+		TEST_CHECK(InContext, !IntersectRay(Box, MakeRay(FVector(1.001f, 0.5f, -5.0f), FVector(0.0f, 0.0f, 1.0f)), 100.0f, Enter));
+		TEST_CHECK(InContext, !IntersectRay(Box, MakeRay(FVector(0.5f, -0.001f, -5.0f), FVector(0.0f, 0.0f, 1.0f)), 100.0f, Enter));
+
+		// 음수 방향, 뒤에 있는 박스
+		TEST_CHECK(InContext, IntersectRay(Box, MakeRay(FVector(0.5f, 0.5f, 5.0f), FVector(0.0f, 0.0f, -1.0f)), 100.0f, Enter) && Enter == 4.0f);
+		TEST_CHECK(InContext, IntersectRay(Box, MakeRay(FVector(3.0f, 3.0f, 0.5f), FVector(-1.0f, -1.0f, 0.0f)), 100.0f, Enter) && Enter == 2.0f);
+		TEST_CHECK(InContext, !IntersectRay(Box, MakeRay(FVector(0.5f, 0.5f, 5.0f), FVector(0.0f, 0.0f, 1.0f)), 100.0f, Enter));
+
+		// 시작점이 박스 안이면 IntersectRay는 0, RaycastHit는 먼 쪽 교차 거리를 돌려준다
+		const FRay InsideRay = MakeRay(FVector(0.25f, 0.5f, 0.5f), FVector(1.0f, 0.0f, 0.0f));
+		TEST_CHECK(InContext, IntersectRay(Box, InsideRay, 100.0f, Enter) && Enter == 0.0f);
+		float HitDistance = -1.0f;
+		TEST_CHECK(InContext, Box.RaycastHit(InsideRay, &HitDistance) && HitDistance == 0.75f);
+
+		// MaxDistance보다 먼 박스는 걸러내고, 경계는 포함한다
+		const FRay FrontRay = MakeRay(FVector(0.5f, 0.5f, -5.0f), FVector(0.0f, 0.0f, 1.0f));
+		TEST_CHECK(InContext, !IntersectRay(Box, FrontRay, 4.9f, Enter));
+		TEST_CHECK(InContext, IntersectRay(Box, FrontRay, 5.0f, Enter) && Enter == 5.0f);
+		TEST_CHECK(InContext, IntersectRay(Box, FrontRay, 5.5f, Enter) && Enter == 5.0f);
+		TEST_CHECK(InContext, IntersectRay(Box, InsideRay, 0.0f, Enter) && Enter == 0.0f);
+	});
+
+	InContext.Run("Box.IntersectRay", [&]
+	{
+		// 무작위 박스/레이를 스칼라 슬랩 검사와 비교한다
+		// 방향 성분 일부를 0(또는 -0)으로, 그 축의 시작점 일부를 경계면 위로 두어 평행 레이와 경계 경우를 섞는다
+		FTestRandom Random(SEED + 6);
+		uint32 NumMismatches = 0;
+		uint32 NumHits = 0;
+		uint32 NumParallelHits = 0;
+		double MaxEnterError = 0.0;
+
+		for (uint32 i = 0; i < 20000; ++i)
+		{
+			const FVector Center = Random.GetVector(-10.0f, 10.0f);
+			const FVector Extent = Random.GetVector(0.1f, 5.0f);
+			const FBox Box = FBox::Make(Center - Extent, Center + Extent);
+
+			// 절반은 박스 근처의 점을 겨눠 맞는 경우를 충분히 만든다
+			FVector Origin = Random.GetVector(-20.0f, 20.0f);
+			FVector Direction = Random.GetVector(-1.0f, 1.0f);
+			if (i & 1)
+			{
+				const FVector Target = Center + FVector(Extent.X * Random.GetRange(-1.5f, 1.5f), Extent.Y * Random.GetRange(-1.5f, 1.5f),
+					Extent.Z * Random.GetRange(-1.5f, 1.5f));
+				Direction = (Target - Origin) * 0.1f;
+			}
+			bool bParallel = false;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float Choice = Random.GetRange(0.0f, 1.0f);
+				if (Choice < 0.3f)
+				{
+					Direction[Axis] = Choice < 0.15f ? 0.0f : -0.0f;
+					bParallel = true;
+
+					const float PlaneChoice = Random.GetRange(0.0f, 1.0f);
+					if (PlaneChoice < 0.2f)
+					{
+						Origin[Axis] = Box.Min[Axis];
+					}
+					else if (PlaneChoice < 0.4f)
+					{
+						Origin[Axis] = Box.Max[Axis];
+					}
+				}
+			}
+			if (Direction.X == 0.0f && Direction.Y == 0.0f && Direction.Z == 0.0f)
+			{
+				Direction.Z = -1.0f;
+			}
+
+			const FRay Ray = MakeRay(Origin, Direction);
+			const float MaxDistance = Random.GetRange(1.0f, 80.0f);
+
+			double ExpectedEnter = 0.0;
+			double ExpectedExit = 0.0;
+			const bool bExpectedHit = ReferenceIntersectRay(Box, Ray, MaxDistance, ExpectedEnter, ExpectedExit);
+
+			// 구간이 거의 닫힌 스침은 float 역수 곱과 double 나눗셈의 반올림 차이로 판정이 갈릴 수 있다
+			const double Scale = std::max(1.0, std::abs(ExpectedEnter));
+			if (std::abs(ExpectedExit - ExpectedEnter) < 1e-4 * Scale)
+			{
+				continue;
+			}
+
+			float Enter = -1.0f;
+			const bool bHit = IntersectRay(Box, Ray, MaxDistance, Enter);
+			if (bHit != bExpectedHit)
+			{
+				++NumMismatches;
+				continue;
+			}
+			if (bHit)
+			{
+				++NumHits;
+				NumParallelHits += bParallel ? 1 : 0;
+				MaxEnterError = std::max(MaxEnterError, std::abs(Enter - ExpectedEnter) / Scale);
+			}
+		}
+
+		TEST_CHECK(InContext, NumMismatches == 0);
+		TEST_CHECK_NEAR(InContext, MaxEnterError, 0.0, 1e-5);
+		// 무작위 입력이 실제로 맞는 경우, 평행 레이로 맞는 경우를 충분히 만들었는지
+		TEST_CHECK(InContext, NumHits > 1000);
+		TEST_CHECK(InContext, NumParallelHits > 200);
+	});
+}
@@ -0,0 +1,556 @@
+#include "pch.h"
+#include "Test/Public/Test.h"
+
+#include "Render/Renderer/Public/DrawCommandList.h"
+#include "Render/Renderer/Public/NullRenderBackend.h"
+#include "Render/Renderer/Public/RenderThread.h"
+#include "Texture/Public/MaterialRenderProxy.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+namespace
+{
+	constexpr float MAX_DEPTH = 100.0f;
+
+	FRenderHandle MakeHandle(uintptr_t InValue)
+	{
+		return reinterpret_cast<FRenderHandle>(InValue);
+	}
+
+	/**
+	 * @brief 정렬/배칭 결과를 손으로 따라갈 수 있는 작은 프레임
+	 *
+	 * 기록 순서는 일부러 섞어 두었다. 커맨드마다 자기 번호를 TransformIndex로 가지므로 정렬 후 순서를 번호로 확인한다
+	 * - Pipeline 0 (인스턴싱 가능), Pipeline 1 (인스턴싱 불가)
+	 * - Material 0, 1 (Key 있음), Mesh A, B
+	 *
+	 * 번호  Pass         Pipeline  Material  Mesh  Depth  비고
+	 * 0     Opaque       1         없음      B     50     색상 사용
+	 * 1     Opaque       0         1         A     30
+	 * 2     Opaque       0         0         A     40
+	 * 3     Opaque       0         0         A     10
+	 * 4     Opaque       0         0         A     20
+	 * 5     Opaque       0         0         B     5
+	 * 6     Translucent  0         0         A     10
+	 * 7     Translucent  0         0         A     90
+	 *
+	 * 정렬 후: Opaque는 Pipeline > Material > Mesh > 앞에서 뒤, Translucent는 뒤에서 앞
+	 * -> 3, 4, 2, 5, 1, 0, 7, 6
+	 */
+	struct FTestFrame
+	{
+		static constexpr uint32 NUM_COMMANDS = 8;
+
+		int32 MaterialKeys[2] = {};
+		FDrawCommandList List;
+
+		FTestFrame()
+		{
+			FDrawPipelineState InstancedPipeline;
+			InstancedPipeline.VertexShader = MakeHandle(0x100);
+			InstancedPipeline.PixelShader = MakeHandle(0x101);
+			InstancedPipeline.InstancedVertexShader = MakeHandle(0x102);
+
+			FDrawPipelineState DefaultPipeline;
+			DefaultPipeline.VertexShader = MakeHandle(0x200);
+			DefaultPipeline.PixelShader = MakeHandle(0x201);
+
+			const uint32 Pipelines[2] = { List.FindOrAddPipeline(InstancedPipeline), List.FindOrAddPipeline(DefaultPipeline) };
+
+			FDrawMaterialBinding Materials[2];
+			Materials[0].Key = &MaterialKeys[0];
+			Materials[1].Key = &MaterialKeys[1];
+			const uint32 MaterialIndices[2] = { List.AddMaterial(Materials[0]), List.AddMaterial(Materials[1]) };
+
+			// 메쉬 번호는 처음 본 순서로 매겨지므로 A, B를 먼저 등록해 둔다
+			const FRenderHandle VertexBuffers[2] = { MakeHandle(0x10), MakeHandle(0x20) };
+			const uint32 MeshIndices[2] = { List.FindOrAddMesh(VertexBuffers[0]), List.FindOrAddMesh(VertexBuffers[1]) };
+
+			struct FRow
+			{
+				EDrawPass Pass;
+				uint32 Pipeline;
+				int32 Material;
+				bool bMeshB;
+				float Depth;
+			};
+			const FRow Rows[NUM_COMMANDS] = {
+				{ EDrawPass::Opaque, 1, -1, true, 50.0f },
+				{ EDrawPass::Opaque, 0, 1, false, 30.0f },
+				{ EDrawPass::Opaque, 0, 0, false, 40.0f },
+				{ EDrawPass::Opaque, 0, 0, false, 10.0f },
+				{ EDrawPass::Opaque, 0, 0, false, 20.0f },
+				{ EDrawPass::Opaque, 0, 0, true, 5.0f },
+				{ EDrawPass::Translucent, 0, 0, false, 10.0f },
+				{ EDrawPass::Translucent, 0, 0, false, 90.0f },
+			};
+
+			for (uint32 Index = 0; Index < NUM_COMMANDS; ++Index)
+			{
+				const FRow& Row = Rows[Index];
+
+				FDrawCommand Command;
+				Command.PipelineIndex = Pipelines[Row.Pipeline];
+				Command.MaterialIndex = Row.Material >= 0 ? MaterialIndices[Row.Material] : FDrawCommand::INVALID_INDEX;
+				Command.VertexBuffer = VertexBuffers[Row.bMeshB ? 1 : 0];
+				Command.IndexBuffer = MakeHandle(Row.bMeshB ? 0x21 : 0x11);
+				Command.MeshIndex = MeshIndices[Row.bMeshB ? 1 : 0];
+				Command.VertexStride = 12;
+				Command.IndexCount = 36;
+				Command.bUseColor = Row.Material < 0;
+				Command.Color = FVector4(1.0f, 0.0f, 0.0f, 1.0f);
+
+				// 트랜스폼 번호 = 기록 순서, 월드 행렬의 이동값에도 번호를 남긴다
+				FMatrix World = FMatrix::Identity();
+				World.Data[3][0] = static_cast<float>(Index);
+				Command.TransformIndex = List.AddTransform(World);
+
+				List.AddCommand(Command, Row.Pass, Row.Depth, MAX_DEPTH);
+			}
+		}
+
+		TArray<uint32> GetCommandOrder() const
+		{
+			TArray<uint32> Order;
+			for (const FDrawCommand& Command : List.GetCommands())
+			{
+				Order.push_back(Command.TransformIndex);
+			}
+			return Order;
+		}
+	};
+
+	/** 뷰 하나에 같은 메쉬 커맨드를 InNumCommands개 기록한다 */
+	void RecordTestView(FRenderFrame& InFrame, uint32 InNumCommands)
+	{
+		FRenderViewSnapshot& View = InFrame.AddView();
+		FDrawCommandList& List = View.DrawCommands;
+
+		FDrawCommand Command;
+		Command.PipelineIndex = List.FindOrAddPipeline(FDrawPipelineState());
+		Command.VertexBuffer = MakeHandle(0x10);
+		Command.IndexBuffer = MakeHandle(0x11);
+		Command.MeshIndex = List.FindOrAddMesh(Command.VertexBuffer);
+		Command.VertexStride = 12;
+		Command.IndexCount = 36;
+
+		for (uint32 Index = 0; Index < InNumCommands; ++Index)
+		{
+			Command.TransformIndex = List.AddTransform(FMatrix::Identity());
+			List.AddCommand(Command, EDrawPass::Opaque, static_cast<float>(Index), MAX_DEPTH);
+		}
+	}
+
+	/**
+	 * @brief 헤드리스 러너와 같은 방식으로 프레임을 Null 백엔드에 제출하고, 받은 순서를 남기는 RenderFunction
+	 * 기록은 렌더 스레드에서만 하고, 게임 스레드는 Flush/Stop 뒤에만 읽는다
+	 */
+	struct FRenderThreadRecorder
+	{
+		FNullRenderBackend Backend;
+		TArray<uint64> FrameNumbers;
+		TArray<uint32> DrawCalls;
+
+		void Render(FRenderFrame& InFrame)
+		{
+			uint32 NumDrawCalls = 0;
+			for (uint32 ViewIndex = 0; ViewIndex < InFrame.GetNumViews(); ++ViewIndex)
+			{
+				FRenderViewSnapshot& View = InFrame.GetView(ViewIndex);
+				View.DrawCommands.Sort();
+				View.DrawCommands.BuildBatches(false);
+				Backend.Reset();
+				View.DrawCommands.Submit(Backend, View.Stats);
+				NumDrawCalls += Backend.GetNumCalls(FNullRenderBackend::ECall::Draw);
+			}
+
+			FrameNumbers.push_back(InFrame.FrameNumber);
+			DrawCalls.push_back(NumDrawCalls);
+		}
+	};
+
+	/** 프레임마다 커맨드 수를 다르게 해서 다른 슬롯의 스냅샷이 섞이면 드러나게 한다 */
+	uint32 GetTestCommandCount(uint64 InFrameNumber)
+	{
+		return static_cast<uint32>(InFrameNumber % 5) + 1;
+	}
+
+	void WriteTestFrames(FRenderThread& InRenderThread, uint64 InNumFrames)
+	{
+		for (uint64 FrameNumber = 0; FrameNumber < InNumFrames; ++FrameNumber)
+		{
+			FRenderFrame& Frame = InRenderThread.BeginFrame(FrameNumber, 0.016f);
+			RecordTestView(Frame, GetTestCommandCount(FrameNumber));
+			InRenderThread.EndFrame();
+		}
+	}
+
+	bool HasRenderedInOrder(const FRenderThreadRecorder& InRecorder, uint64 InNumFrames)
+	{
+		if (InRecorder.FrameNumbers.size() != InNumFrames || InRecorder.DrawCalls.size() != InNumFrames)
+		{
+			return false;
+		}
+
+		for (uint64 FrameNumber = 0; FrameNumber < InNumFrames; ++FrameNumber)
+		{
+			if (InRecorder.FrameNumbers[FrameNumber] != FrameNumber || InRecorder.DrawCalls[FrameNumber] != GetTestCommandCount(FrameNumber))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief FDrawCommandList의 정렬 순서, 배치 수, 상태 변경 수와 FRenderThread의 프레임 전달을 Null 백엔드로 확인한다
+ */
+void RunRenderTests(FTestContext& InContext)
+{
+	InContext.Run("DrawCommandList.RadixSort", [&]
+	{
+		// 상위 비트만 다른 키, 같은 키가 많은 경우 모두 std::stable_sort와 같아야 한다
+		std::mt19937_64 Random(20251001);
+		TArray<TPair<uint64, uint32>> Entries;
+		for (uint32 Index = 0; Index < 4096; ++Index)
+		{
+			const uint64 Key = (Index & 1) ? (Random() & 0xF0000000000000FFull) : (Random() % 64);
+			Entries.emplace_back(Key, Index);
+		}
+
+		TArray<TPair<uint64, uint32>> Expected = Entries;
+		std::stable_sort(Expected.begin(), Expected.end(), [](const TPair<uint64, uint32>& InA, const TPair<uint64, uint32>& InB)
+		{
+			return InA.first < InB.first;
+		});
+
+		TArray<TPair<uint64, uint32>> Scratch;
+		FDrawCommandList::RadixSort(Entries, Scratch);
+		TEST_CHECK(InContext, Entries == Expected);
+	});
+
+	InContext.Run("DrawCommandList.SortOrder", [&]
+	{
+		FTestFrame Frame;
+		Frame.List.Sort();
+
+		const TArray<uint32> Expected = { 3, 4, 2, 5, 1, 0, 7, 6 };
+		TEST_CHECK(InContext, Frame.GetCommandOrder() == Expected);
+
+		const TArray<FDrawCommand>& Commands = Frame.List.GetCommands();
+		for (size_t Index = 1; Index < Commands.size(); ++Index)
+		{
+			TEST_CHECK(InContext, Commands[Index - 1].SortKey <= Commands[Index].SortKey);
+		}
+	});
+
+	InContext.Run("DrawCommandList.SortKeySaturates", [&]
+	{
+		// 필드 상한을 넘은 인덱스는 작은 인덱스와 겹치지 않고 가장 뒤로 모인다
+		const uint64 LastPipeline = FDrawCommandList::MakeSortKey(EDrawPass::Opaque, FDrawCommandList::MAX_SORT_PIPELINES - 1, 0, 0, 0);
+		const uint64 OverPipeline = FDrawCommandList::MakeSortKey(EDrawPass::Opaque, FDrawCommandList::MAX_SORT_PIPELINES, 0, 0, 0);
+		TEST_CHECK(InContext, OverPipeline == LastPipeline);
+		TEST_CHECK(InContext, OverPipeline > FDrawCommandList::MakeSortKey(EDrawPass::Opaque, 0, 0, 0, 0));
+
+		const uint64 LastMaterial = FDrawCommandList::MakeSortKey(EDrawPass::Opaque, 0, FDrawCommandList::MAX_SORT_MATERIALS - 1, 0, 0);
+		const uint64 OverMaterial = FDrawCommandList::MakeSortKey(EDrawPass::Opaque, 0, FDrawCommandList::MAX_SORT_MATERIALS, 0, 0);
+		const uint64 NoMaterial = FDrawCommandList::MakeSortKey(EDrawPass::Opaque, 0, FDrawCommand::INVALID_INDEX, 0, 0);
+		TEST_CHECK(InContext, OverMaterial == LastMaterial);
+		TEST_CHECK(InContext, NoMaterial < FDrawCommandList::MakeSortKey(EDrawPass::Opaque, 0, 0, 0, 0));
+
+		const uint64 LastMesh = FDrawCommandList::MakeSortKey(EDrawPass::Translucent, 0, 0, FDrawCommandList::MAX_SORT_MESHES - 1, 0);
+		const uint64 OverMesh = FDrawCommandList::MakeSortKey(EDrawPass::Translucent, 0, 0, FDrawCommandList::MAX_SORT_MESHES + 5, 0);
+		TEST_CHECK(InContext, OverMesh == LastMesh);
+		TEST_CHECK(InContext, OverMesh < FDrawCommandList::MakeSortKey(EDrawPass::Translucent, 0, 1, 0, 0));
+	});
+
+	InContext.Run("DrawCommandList.StateChanges", [&]
+	{
+		FTestFrame Frame;
+		Frame.List.Sort();
+		Frame.List.BuildBatches(false);
+
+		FNullRenderBackend Backend;
+		FDrawStats Stats;
+		Frame.List.Submit(Backend, Stats);
+
+		// 3, 4, 2, 5, 1, 0, 7, 6 순서로 직전과 다른 상태만 바뀐다
+		TEST_CHECK(InContext, Frame.List.GetBatches().size() == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Stats.NumCommands == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Stats.NumDrawCalls == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Stats.NumInstancedDraws == 0);
+		// Pipeline: 3(P0), 0(P1), 7(P0)
+		TEST_CHECK(InContext, Stats.NumPipelineChanges == 3);
+		// Material: 3(M0), 1(M1), 7(M0), 재질 없는 0은 바인딩을 건드리지 않는다
+		TEST_CHECK(InContext, Stats.NumMaterialChanges == 3);
+		// Mesh: 3(A), 5(B), 1(A), 0(B), 7(A)
+		TEST_CHECK(InContext, Stats.NumGeometryChanges == 5);
+		// 재질 시간 1 + 커맨드별 트랜스폼 8 + 색상 1
+		TEST_CHECK(InContext, Stats.NumConstantUpdates == 10);
+		TEST_CHECK(InContext, Stats.GetTotalStateChanges() == 21);
+
+		// 같은 Version의 재질은 다시 올리지 않는다
+		TEST_CHECK(InContext, Backend.GetNumMaterialUploads() == 2);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::Draw) == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::SetPipelineState) == Stats.NumPipelineChanges);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::SetGeometry) == Stats.NumGeometryChanges);
+
+		TArray<uint64> ExpectedKeys;
+		for (const FDrawCommand& Command : Frame.List.GetCommands())
+		{
+			ExpectedKeys.push_back(Command.SortKey);
+		}
+		TEST_CHECK(InContext, Backend.GetRecordedSortKeys() == ExpectedKeys);
+	});
+
+	InContext.Run("DrawCommandList.Instancing", [&]
+	{
+		FTestFrame Frame;
+		Frame.List.Sort();
+		Frame.List.BuildBatches(true);
+
+		FNullRenderBackend Backend;
+		FDrawStats Stats;
+		Frame.List.Submit(Backend, Stats);
+
+		// 3, 4, 2만 한 배치로 합쳐진다. 5는 메쉬, 1은 재질이 다르고, 0은 인스턴싱 불가 파이프라인, 7, 6은 반투명
+		const TArray<FDrawBatch>& Batches = Frame.List.GetBatches();
+		TEST_CHECK(InContext, Batches.size() == 6);
+		TEST_CHECK(InContext, !Batches.empty() && Batches[0].NumInstances == 3);
+		for (size_t Index = 1; Index < Batches.size(); ++Index)
+		{
+			TEST_CHECK(InContext, Batches[Index].NumInstances == 1);
+		}
+
+		// 인스턴스 스트림은 정렬 순서대로 각 커맨드의 월드 행렬과 색상을 담는다
+		const TArray<FInstanceData>& Instances = Frame.List.GetInstanceData();
+		TEST_CHECK(InContext, Instances.size() == 3);
+		const float ExpectedIds[3] = { 3.0f, 4.0f, 2.0f };
+		for (size_t Index = 0; Index < std::min<size_t>(Instances.size(), 3); ++Index)
+		{
+			TEST_CHECK(InContext, Instances[Index].World.Data[3][0] == ExpectedIds[Index]);
+		}
+
+		TEST_CHECK(InContext, Stats.NumDrawCalls == 6);
+		TEST_CHECK(InContext, Stats.NumInstancedDraws == 1);
+		TEST_CHECK(InContext, Stats.NumInstances == FTestFrame::NUM_COMMANDS);
+		// Pipeline: 배치(P0 인스턴싱), 5(P0 일반), 0(P1), 7(P0)
+		TEST_CHECK(InContext, Stats.NumPipelineChanges == 4);
+		TEST_CHECK(InContext, Stats.NumMaterialChanges == 3);
+		TEST_CHECK(InContext, Stats.NumGeometryChanges == 5);
+		// 재질 시간 1 + 인스턴싱되지 않은 5개의 트랜스폼 + 색상 1
+		TEST_CHECK(InContext, Stats.NumConstantUpdates == 7);
+		// 인스턴스 스트림 1 + 재질 업로드 2 + 상수 갱신 7
+		TEST_CHECK(InContext, Stats.NumBufferMaps == 10);
+
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::SetInstanceData) == 1);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::DrawInstanced) == 1);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::Draw) == 5);
+		TEST_CHECK(InContext, Backend.GetNumDrawnInstances() == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Backend.GetUploadedInstances().size() == 3);
+	});
+
+	InContext.Run("DrawCommandList.InstanceUploadFailure", [&]
+	{
+		FTestFrame Frame;
+		Frame.List.Sort();
+		Frame.List.BuildBatches(true);
+
+		FNullRenderBackend Backend;
+		Backend.SetFailInstanceUploads(true);
+		FDrawStats Stats;
+		Frame.List.Submit(Backend, Stats);
+
+		// 인스턴스 스트림이 없으면 인스턴싱 배치(3, 4, 2)는 일반 파이프라인으로 하나씩 그린다
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::SetInstanceData) == 1);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::DrawInstanced) == 0);
+		TEST_CHECK(InContext, Backend.GetNumCalls(FNullRenderBackend::ECall::Draw) == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Stats.NumInstancedDraws == 0);
+		TEST_CHECK(InContext, Stats.NumDrawCalls == FTestFrame::NUM_COMMANDS);
+		TEST_CHECK(InContext, Stats.NumInstances == FTestFrame::NUM_COMMANDS);
+
+		// 상태 변경은 인스턴싱을 끈 제출과 같고, 실패한 인스턴스 업로드는 Map으로 세지 않는다
+		TEST_CHECK(InContext, Stats.NumPipelineChanges == 3);
+		TEST_CHECK(InContext, Stats.NumConstantUpdates == 10);
+		TEST_CHECK(InContext, Stats.NumBufferMaps == 2 + 10);
+
+		TArray<uint64> ExpectedKeys;
+		for (const FDrawCommand& Command : Frame.List.GetCommands())
+		{
+			ExpectedKeys.push_back(Command.SortKey);
+		}
+		TEST_CHECK(InContext, Backend.GetRecordedSortKeys() == ExpectedKeys);
+	});
+
+	InContext.Run("RenderThread.InOrder", [&]
+	{
+		constexpr uint64 NUM_FRAMES = 64;
+
+		FRenderThreadRecorder Recorder;
+		FRenderThread RenderThread;
+		RenderThread.Start([&Recorder](FRenderFrame& InFrame) { Recorder.Render(InFrame); });
+		TEST_CHECK(InContext, RenderThread.IsThreaded());
+
+		WriteTestFrames(RenderThread, NUM_FRAMES);
+		RenderThread.Flush();
+
+		// 슬롯을 재사용해도 쓴 순서대로, 쓴 내용 그대로 제출된다
+		TEST_CHECK(InContext, HasRenderedInOrder(Recorder, NUM_FRAMES));
+	});
+
+	InContext.Run("RenderThread.BlocksAtMaxFramesInFlight", [&]
+	{
+		// 렌더 스레드를 첫 프레임에서 붙잡아 둔다
+		std::mutex GateMutex;
+		std::condition_variable GateOpened;
+		bool bGateOpen = false;
+
+		FRenderThreadRecorder Recorder;
+		FRenderThread RenderThread;
+		RenderThread.Start([&](FRenderFrame& InFrame)
+		{
+			{
+				std::unique_lock<std::mutex> Lock(GateMutex);
+				GateOpened.wait(Lock, [&] { return bGateOpen; });
+			}
+			Recorder.Render(InFrame);
+		});
+
+		WriteTestFrames(RenderThread, FRenderThread::MAX_FRAMES_IN_FLIGHT);
+
+		// 슬롯이 모두 찼으므로 다음 BeginFrame은 렌더 스레드가 하나를 끝낼 때까지 돌아오지 않아야 한다
+		std::atomic<bool> bBeginFrameReturned = false;
+		std::thread GameThread([&]
+		{
+			FRenderFrame& Frame = RenderThread.BeginFrame(FRenderThread::MAX_FRAMES_IN_FLIGHT, 0.016f);
+			bBeginFrameReturned = true;
+			RecordTestView(Frame, GetTestCommandCount(FRenderThread::MAX_FRAMES_IN_FLIGHT));
+			RenderThread.EndFrame();
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		TEST_CHECK(InContext, !bBeginFrameReturned);
+		TEST_CHECK(InContext, RenderThread.GetNumRenderedFrames() == 0);
+
+		{
+			std::lock_guard<std::mutex> Lock(GateMutex);
+			bGateOpen = true;
+		}
+		GateOpened.notify_all();
+		GameThread.join();
+		RenderThread.Flush();
+
+		TEST_CHECK(InContext, bBeginFrameReturned);
+		TEST_CHECK(InContext, RenderThread.GetGameThreadWaitMs() > 0.0);
+		TEST_CHECK(InContext, HasRenderedInOrder(Recorder, FRenderThread::MAX_FRAMES_IN_FLIGHT + 1));
+	});
+
+	InContext.Run("RenderThread.FlushDrainsAll", [&]
+	{
+		constexpr uint64 NUM_FRAMES = 16;
+
+		// 렌더 스레드를 게임 스레드보다 느리게 해서 Flush 시점에 밀린 프레임이 남게 한다
+		FRenderThreadRecorder Recorder;
+		FRenderThread RenderThread;
+		RenderThread.Start([&Recorder](FRenderFrame& InFrame)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			Recorder.Render(InFrame);
+		});
+
+		WriteTestFrames(RenderThread, NUM_FRAMES);
+		RenderThread.Flush();
+
+		TEST_CHECK(InContext, RenderThread.GetNumRenderedFrames() == NUM_FRAMES);
+		TEST_CHECK(InContext, HasRenderedInOrder(Recorder, NUM_FRAMES));
+		TEST_CHECK(InContext, RenderThread.IsThreaded());
+	});
+
+	InContext.Run("RenderThread.StopDrainsAll", [&]
+	{
+		constexpr uint64 NUM_FRAMES = 16;
+
+		FRenderThreadRecorder Recorder;
+		FRenderThread RenderThread;
+		RenderThread.Start([&Recorder](FRenderFrame& InFrame)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			Recorder.Render(InFrame);
+		});
+
+		// Flush 없이 바로 멈춰도 이미 넘긴 프레임은 모두 제출한 뒤에 끝난다
+		WriteTestFrames(RenderThread, NUM_FRAMES);
+		RenderThread.Stop();
+
+		TEST_CHECK(InContext, !RenderThread.IsThreaded());
+		TEST_CHECK(InContext, RenderThread.GetNumRenderedFrames() == NUM_FRAMES);
+		TEST_CHECK(InContext, HasRenderedInOrder(Recorder, NUM_FRAMES));
+	});
+
+	InContext.Run("MaterialRenderProxy.ReleasePrunesBackend", [&]
+	{
+		int32 MaterialKey = 0;
+		auto Proxy = std::make_unique<FMaterialRenderProxy>();
+		FDrawMaterialBinding Binding;
+		Binding.Key = &MaterialKey;
+		Proxy->SetBinding(Binding);
+
+		FDrawCommandList List;
+		FDrawCommand Command;
+		Command.PipelineIndex = List.FindOrAddPipeline(FDrawPipelineState());
+		Command.MaterialIndex = List.AddMaterial(Proxy->GetBinding());
+		Command.TransformIndex = List.AddTransform(FMatrix::Identity());
+		List.AddCommand(Command, EDrawPass::Opaque, 1.0f, MAX_DEPTH);
+		List.Sort();
+		List.BuildBatches(false);
+
+		FNullRenderBackend Backend;
+		FDrawStats Stats;
+		List.Submit(Backend, Stats);
+		TEST_CHECK(InContext, Backend.GetNumMaterialUploads() == 1);
+		TEST_CHECK(InContext, Backend.GetNumCachedMaterials() == 1);
+
+		// 재질이 파괴되면 다음 제출 시작 때 백엔드의 재질별 항목이 사라진다
+		Proxy.reset();
+		Backend.BeginSubmit();
+		TEST_CHECK(InContext, Backend.GetNumCachedMaterials() == 0);
+	});
+
+	InContext.Run("MaterialRenderProxy.UniqueVersions", [&]
+	{
+		// 여러 스레드에서 동시에 갱신해도 Version이 겹치지 않아야 한다
+		constexpr uint32 NUM_THREADS = 4;
+		constexpr uint32 NUM_UPDATES = 2000;
+
+		TArray<TArray<uint64>> Versions(NUM_THREADS);
+		TArray<std::thread> Threads;
+		for (uint32 ThreadIndex = 0; ThreadIndex < NUM_THREADS; ++ThreadIndex)
+		{
+			Threads.emplace_back([&Versions, ThreadIndex]
+			{
+				FMaterialRenderProxy Proxy;
+				for (uint32 Update = 0; Update < NUM_UPDATES; ++Update)
+				{
+					Proxy.SetBinding(FDrawMaterialBinding());
+					Versions[ThreadIndex].push_back(Proxy.GetVersion());
+				}
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		TArray<uint64> AllVersions;
+		for (const TArray<uint64>& ThreadVersions : Versions)
+		{
+			AllVersions.insert(AllVersions.end(), ThreadVersions.begin(), ThreadVersions.end());
+		}
+		std::sort(AllVersions.begin(), AllVersions.end());
+		TEST_CHECK(InContext, std::adjacent_find(AllVersions.begin(), AllVersions.end()) == AllVersions.end());
+		TEST_CHECK(InContext, AllVersions.size() == NUM_THREADS * NUM_UPDATES);
+	});
+}
@@ -0,0 +1,75 @@
+#include "pch.h"
+#include "Test/Public/Test.h"
+
+bool FTestContext::ShouldRun(const FString& InName) const
+{
+	if (Options.Filter.empty())
+	{
+		return true;
+	}
+
+	return (Suite + "/" + InName).find(Options.Filter) != FString::npos;
+}
+
+bool FTestContext::Check(bool bInCondition, const char* InExpression, const char* InFile, int32 InLine)
+{
+	if (!bInCondition)
+	{
+		++NumFailedChecks;
+		printf("    %s:%d: CHECK(%s) failed\n", InFile, InLine, InExpression);
+	}
+	return bInCondition;
+}
+
+bool FTestContext::CheckNear(double InActual, double InExpected, double InTolerance, const char* InExpression, const char* InFile, int32 InLine)
+{
+	const bool bNear = std::abs(InActual - InExpected) <= InTolerance;
+	if (!bNear)
+	{
+		++NumFailedChecks;
+		printf("    %s:%d: CHECK(%s) failed: %.9g vs %.9g (tolerance %.3g)\n", InFile, InLine, InExpression, InActual, InExpected, InTolerance);
+	}
+	return bNear;
+}
+
+void FTestContext::BeginTest(const FString& InName)
+{
+	CurrentName = InName;
+	NumFailedChecks = 0;
+}
+
+void FTestContext::EndTest()
+{
+	++NumTests;
+	NumFailedTests += NumFailedChecks > 0 ? 1 : 0;
+
+	printf("  [%s] %s/%s\n", NumFailedChecks > 0 ? "FAIL" : " OK ", Suite.c_str(), CurrentName.c_str());
+	fflush(stdout);
+}
+
+void FTestRunner::AddSuite(const FString& InName, FTestSuiteFunction InFunction)
+{
+	Suites.emplace_back(InName, InFunction);
+}
+
+int32 FTestRunner::Run(const FTestOptions& InOptions)
+{
+	uint32 NumTests = 0;
+	uint32 NumFailedTests = 0;
+
+	for (const auto& [Name, Function] : Suites)
+	{
+		// 로거 스레드 출력과 결과가 섞이지 않도록 먼저 비운다
+		FLogger::Flush();
+		printf("[%s]\n", Name.c_str());
+		FTestContext Context(InOptions, Name);
+		Function(Context);
+
+		NumTests += Context.GetNumTests();
+		NumFailedTests += Context.GetNumFailedTests();
+	}
+
+	FLogger::Flush();
+	printf("\n%u test(s), %u failed\n", NumTests, NumFailedTests);
+	return NumFailedTests > 0 ? 1 : 0;
+}
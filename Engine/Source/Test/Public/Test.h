@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @brief 테스트 실행 옵션
+ */
+struct FTestOptions
+{
+	// 이름(Suite/Name)에 이 문자열이 들어간 항목만 실행한다 (비어 있으면 전체)
+	FString Filter;
+	FString DataDirectory = "Data";
+};
+
+/**
+ * @brief 스위트 하나를 실행하는 동안 항목별 검사 결과를 모은다
+ *
+ * Run(Name, Body)는 Body 안의 TEST_CHECK가 하나라도 실패하면 그 항목을 실패로 기록한다
+ * 검사가 실패해도 Body는 끝까지 실행되어 한 번에 모든 실패를 볼 수 있다
+ */
+class FTestContext
+{
+public:
+	FTestContext(const FTestOptions& InOptions, const FString& InSuite)
+		: Options(InOptions), Suite(InSuite)
+	{
+	}
+
+	const FTestOptions& GetOptions() const { return Options; }
+	bool ShouldRun(const FString& InName) const;
+	FString GetDataPath(const FString& InRelativePath) const { return Options.DataDirectory + "/" + InRelativePath; }
+
+	template<typename BodyType>
+	void Run(const FString& InName, BodyType&& InBody)
+	{
+		if (!ShouldRun(InName))
+		{
+			return;
+		}
+
+		BeginTest(InName);
+		InBody();
+		EndTest();
+	}
+
+	bool Check(bool bInCondition, const char* InExpression, const char* InFile, int32 InLine);
+	bool CheckNear(double InActual, double InExpected, double InTolerance, const char* InExpression, const char* InFile, int32 InLine);
+
+	uint32 GetNumTests() const { return NumTests; }
+	uint32 GetNumFailedTests() const { return NumFailedTests; }
+
+private:
+	void BeginTest(const FString& InName);
+	void EndTest();
+
+	const FTestOptions& Options;
+	FString Suite;
+	FString CurrentName;
+	uint32 NumTests = 0;
+	uint32 NumFailedTests = 0;
+	uint32 NumFailedChecks = 0;
+};
+
+#define TEST_CHECK(Context, Expression) (Context).Check(static_cast<bool>(Expression), #Expression, __FILE__, __LINE__)
+#define TEST_CHECK_NEAR(Context, Actual, Expected, Tolerance) \
+	(Context).CheckNear(static_cast<double>(Actual), static_cast<double>(Expected), static_cast<double>(Tolerance), #Actual " ~= " #Expected, __FILE__, __LINE__)
+
+using FTestSuiteFunction = void(*)(FTestContext&);
+
+/**
+ * @brief 등록된 스위트를 차례로 실행하고 실패한 항목을 모아 보여준다
+ */
+class FTestRunner
+{
+public:
+	void AddSuite(const FString& InName, FTestSuiteFunction InFunction);
+
+	/** @return 실패한 항목이 있으면 1, 아니면 0 */
+	int32 Run(const FTestOptions& InOptions);
+
+private:
+	TArray<TPair<FString, FTestSuiteFunction>> Suites;
+};
+
+// 스위트 진입점 (Test/Private/*Tests.cpp)
+void RunAssetTests(FTestContext& InContext);
+void RunCoreTests(FTestContext& InContext);
+void RunMathTests(FTestContext& InContext);
+void RunRenderTests(FTestContext& InContext);
@@ -0,0 +1,264 @@
+#include "pch.h"
+#include "Texture/Public/CookedTextureCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+	struct FCacheFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 CookerVersion;
+		uint32 NumEntries;
+		uint32 NumMips;
+		uint32 Padding;
+		uint64 DataOffset;
+	};
+
+	struct FCacheFileEntry
+	{
+		uint64 SourceHash;
+		uint64 SettingsHash;
+		// 데이터 영역 시작 기준
+		uint64 DataOffset;
+		uint32 Format;
+		uint32 Width;
+		uint32 Height;
+		uint32 NumMips;
+		uint32 FirstMip;
+		uint32 Padding;
+	};
+
+	static_assert(sizeof(FCacheFileHeader) == 32, "Cache file header layout changed");
+	static_assert(sizeof(FCacheFileEntry) == 48, "Cache file entry layout changed");
+	static_assert(sizeof(FCookedMip) == 32, "Cooked mip layout changed");
+
+	constexpr uint64 DATA_ALIGNMENT = 16;
+
+	uint64 AlignUp(uint64 InValue, uint64 InAlignment)
+	{
+		return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	/** @brief 밉 표가 가리키는 데이터 끝 (텍스처 데이터 크기) */
+	uint64 GetTextureDataSize(const FCookedTextureView& InView)
+	{
+		uint64 Size = 0;
+		for (uint32 i = 0; i < InView.NumMips; ++i)
+		{
+			Size = std::max(Size, InView.Mips[i].Offset + InView.Mips[i].Size);
+		}
+		return Size;
+	}
+}
+
+bool FCookedTextureCache::Load(const FString& InPath)
+{
+	Clear();
+
+	std::ifstream File(InPath, std::ios::binary | std::ios::ate);
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize FileSize = File.tellg();
+	if (FileSize < static_cast<std::streamsize>(sizeof(FCacheFileHeader)))
+	{
+		return false;
+	}
+
+	// 파일 전체를 한 번에 읽는다
+	LoadedFile.resize(static_cast<size_t>(FileSize));
+	File.seekg(0, std::ios::beg);
+	if (!File.read(reinterpret_cast<char*>(LoadedFile.data()), FileSize))
+	{
+		Clear();
+		return false;
+	}
+
+	FCacheFileHeader Header;
+	memcpy(&Header, LoadedFile.data(), sizeof(Header));
+	if (Header.Magic != FILE_MAGIC || Header.Version != FILE_VERSION || Header.CookerVersion != FTextureCooker::COOKER_VERSION)
+	{
+		UE_LOG_WARNING("CookedTextureCache: 버전이 맞지 않아 캐시를 버립니다: %s", InPath.c_str());
+		Clear();
+		return false;
+	}
+
+	const uint64 EntryTableOffset = sizeof(FCacheFileHeader);
+	const uint64 MipTableOffset = EntryTableOffset + static_cast<uint64>(Header.NumEntries) * sizeof(FCacheFileEntry);
+	const uint64 MipTableEnd = MipTableOffset + static_cast<uint64>(Header.NumMips) * sizeof(FCookedMip);
+	if (MipTableEnd > Header.DataOffset || Header.DataOffset > static_cast<uint64>(FileSize))
+	{
+		UE_LOG_ERROR("CookedTextureCache: 손상된 캐시 파일입니다: %s", InPath.c_str());
+		Clear();
+		return false;
+	}
+
+	const FCookedMip* MipTable = reinterpret_cast<const FCookedMip*>(LoadedFile.data() + MipTableOffset);
+	const uint8* DataSection = LoadedFile.data() + Header.DataOffset;
+	const uint64 DataSectionSize = static_cast<uint64>(FileSize) - Header.DataOffset;
+
+	Entries.reserve(Header.NumEntries);
+	for (uint32 i = 0; i < Header.NumEntries; ++i)
+	{
+		FCacheFileEntry FileEntry;
+		memcpy(&FileEntry, LoadedFile.data() + EntryTableOffset + i * sizeof(FCacheFileEntry), sizeof(FileEntry));
+
+		FEntry Entry;
+		Entry.SourceHash = FileEntry.SourceHash;
+		Entry.SettingsHash = FileEntry.SettingsHash;
+		Entry.View.Format = static_cast<ETextureFormat>(FileEntry.Format);
+		Entry.View.Width = FileEntry.Width;
+		Entry.View.Height = FileEntry.Height;
+		Entry.View.NumMips = FileEntry.NumMips;
+		Entry.View.Mips = MipTable + FileEntry.FirstMip;
+		Entry.View.Data = DataSection + FileEntry.DataOffset;
+
+		const bool bValidMips = FileEntry.NumMips > 0 && static_cast<uint64>(FileEntry.FirstMip) + FileEntry.NumMips <= Header.NumMips;
+		if (FileEntry.Format >= static_cast<uint32>(ETextureFormat::Count) || !bValidMips ||
+			FileEntry.DataOffset + GetTextureDataSize(Entry.View) > DataSectionSize)
+		{
+			UE_LOG_ERROR("CookedTextureCache: 손상된 캐시 파일입니다: %s", InPath.c_str());
+			Clear();
+			return false;
+		}
+
+		KeyToEntry[MakeKey(Entry.SourceHash, Entry.SettingsHash)] = static_cast<uint32>(Entries.size());
+		Entries.push_back(Entry);
+	}
+
+	return true;
+}
+
+bool FCookedTextureCache::Save(const FString& InPath)
+{
+	// 엔트리마다 데이터 위치를 먼저 정한다
+	FCacheFileHeader Header = {};
+	Header.Magic = FILE_MAGIC;
+	Header.Version = FILE_VERSION;
+	Header.CookerVersion = FTextureCooker::COOKER_VERSION;
+	Header.NumEntries = static_cast<uint32>(Entries.size());
+
+	TArray<FCacheFileEntry> FileEntries(Entries.size());
+	uint64 DataSize = 0;
+	for (size_t i = 0; i < Entries.size(); ++i)
+	{
+		const FCookedTextureView& View = Entries[i].View;
+		FCacheFileEntry& FileEntry = FileEntries[i];
+		FileEntry = {};
+		FileEntry.SourceHash = Entries[i].SourceHash;
+		FileEntry.SettingsHash = Entries[i].SettingsHash;
+		FileEntry.Format = static_cast<uint32>(View.Format);
+		FileEntry.Width = View.Width;
+		FileEntry.Height = View.Height;
+		FileEntry.NumMips = View.NumMips;
+		FileEntry.FirstMip = Header.NumMips;
+		FileEntry.DataOffset = DataSize;
+
+		Header.NumMips += View.NumMips;
+		DataSize = AlignUp(DataSize + GetTextureDataSize(View), DATA_ALIGNMENT);
+	}
+
+	const uint64 MipTableOffset = sizeof(FCacheFileHeader) + FileEntries.size() * sizeof(FCacheFileEntry);
+	Header.DataOffset = AlignUp(MipTableOffset + static_cast<uint64>(Header.NumMips) * sizeof(FCookedMip), DATA_ALIGNMENT);
+
+	TArray<uint8> Buffer(Header.DataOffset + DataSize, 0);
+	memcpy(Buffer.data(), &Header, sizeof(Header));
+	if (!FileEntries.empty())
+	{
+		memcpy(Buffer.data() + sizeof(Header), FileEntries.data(), FileEntries.size() * sizeof(FCacheFileEntry));
+	}
+	for (size_t i = 0; i < Entries.size(); ++i)
+	{
+		const FCookedTextureView& View = Entries[i].View;
+		memcpy(Buffer.data() + MipTableOffset + static_cast<uint64>(FileEntries[i].FirstMip) * sizeof(FCookedMip), View.Mips, View.NumMips * sizeof(FCookedMip));
+		memcpy(Buffer.data() + Header.DataOffset + FileEntries[i].DataOffset, View.Data, GetTextureDataSize(View));
+	}
+
+	// 쓰다가 끊겨도 이전 캐시가 남도록 임시 파일에 쓴 뒤 바꾼다
+	std::error_code ErrorCode;
+	const std::filesystem::path Path(InPath);
+	if (Path.has_parent_path())
+	{
+		std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+	}
+
+	const std::filesystem::path TempPath = Path.string() + ".tmp";
+	{
+		std::ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+		if (!File.is_open() || !File.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size())))
+		{
+			UE_LOG_ERROR("CookedTextureCache: 캐시 파일을 쓰지 못했습니다: %s", InPath.c_str());
+			return false;
+		}
+	}
+
+	std::filesystem::rename(TempPath, Path, ErrorCode);
+	if (ErrorCode)
+	{
+		UE_LOG_ERROR("CookedTextureCache: 캐시 파일을 바꾸지 못했습니다: %s", InPath.c_str());
+		std::filesystem::remove(TempPath, ErrorCode);
+		return false;
+	}
+
+	bIsDirty = false;
+	return true;
+}
+
+const FCookedTextureView* FCookedTextureCache::Find(uint64 InSourceHash, uint64 InSettingsHash) const
+{
+	auto Iter = KeyToEntry.find(MakeKey(InSourceHash, InSettingsHash));
+	if (Iter == KeyToEntry.end())
+	{
+		return nullptr;
+	}
+
+	const FEntry& Entry = Entries[Iter->second];
+	if (Entry.SourceHash != InSourceHash || Entry.SettingsHash != InSettingsHash)
+	{
+		return nullptr;
+	}
+	return &Entry.View;
+}
+
+void FCookedTextureCache::Add(uint64 InSourceHash, uint64 InSettingsHash, FCookedTexture&& InTexture)
+{
+	auto Texture = std::make_unique<FCookedTexture>(std::move(InTexture));
+
+	FEntry Entry;
+	Entry.SourceHash = InSourceHash;
+	Entry.SettingsHash = InSettingsHash;
+	Entry.View.Format = Texture->Format;
+	Entry.View.Width = Texture->Width;
+	Entry.View.Height = Texture->Height;
+	Entry.View.NumMips = static_cast<uint32>(Texture->Mips.size());
+	Entry.View.Mips = Texture->Mips.data();
+	Entry.View.Data = Texture->Data.data();
+	AddedTextures.push_back(std::move(Texture));
+
+	const uint64 Key = MakeKey(InSourceHash, InSettingsHash);
+	auto Iter = KeyToEntry.find(Key);
+	if (Iter != KeyToEntry.end())
+	{
+		Entries[Iter->second] = Entry;
+	}
+	else
+	{
+		KeyToEntry.emplace(Key, static_cast<uint32>(Entries.size()));
+		Entries.push_back(Entry);
+	}
+	bIsDirty = true;
+}
+
+void FCookedTextureCache::Clear()
+{
+	Entries.clear();
+	KeyToEntry.clear();
+	LoadedFile = TArray<uint8>();
+	AddedTextures.clear();
+	bIsDirty = false;
+}
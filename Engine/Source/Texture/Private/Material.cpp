@@ -1,10 +1,32 @@
 #include "pch.h"
 #include "Texture/Public/Material.h"
+#include "Texture/Public/MaterialRenderProxy.h"
 #include "Texture/Public/Texture.h"
 #include "Texture/Public/TextureRenderProxy.h"
 
 IMPLEMENT_CLASS(UMaterial, UObject)
 
+namespace
+{
+	// TextureShader.hlsl의 HAS_*_MAP 플래그와 동일한 비트
+	constexpr uint32 MATERIAL_FLAG_DIFFUSE_MAP = 1 << 0;
+	constexpr uint32 MATERIAL_FLAG_AMBIENT_MAP = 1 << 1;
+	constexpr uint32 MATERIAL_FLAG_SPECULAR_MAP = 1 << 2;
+	constexpr uint32 MATERIAL_FLAG_NORMAL_MAP = 1 << 3;
+	constexpr uint32 MATERIAL_FLAG_ALPHA_MAP = 1 << 4;
+	constexpr uint32 MATERIAL_FLAG_BUMP_MAP = 1 << 5;
+}
+
+UMaterial::UMaterial()
+{
+	UpdateRenderProxy();
+}
+
+UMaterial::UMaterial(const FName& InName)
+{
+	UpdateRenderProxy();
+}
+
 UMaterial::~UMaterial()
 {
 	SafeDelete(DiffuseTexture);
@@ -13,4 +35,54 @@ UMaterial::~UMaterial()
 	SafeDelete(NormalTexture);
 	SafeDelete(AlphaTexture);
 	SafeDelete(BumpTexture);
+	SafeDelete(RenderProxy);
+}
+
+/**
+ * @brief 재질 상수 블록과 텍스처 바인딩을 다시 만든다
+ * 드로우마다 getter를 거쳐 상수를 재구성하지 않도록 재질이 바뀌는 시점(Setter)에서만 호출된다
+ */
+void UMaterial::UpdateRenderProxy()
+{
+	if (!RenderProxy)
+	{
+		RenderProxy = new FMaterialRenderProxy();
+	}
+
+	FDrawMaterialBinding Binding;
+	Binding.Key = this;
+	Binding.Constants.Ka = FVector4(MaterialData.Ka.X, MaterialData.Ka.Y, MaterialData.Ka.Z, 1.0f);
+	Binding.Constants.Kd = FVector4(MaterialData.Kd.X, MaterialData.Kd.Y, MaterialData.Kd.Z, 1.0f);
+	Binding.Constants.Ks = FVector4(MaterialData.Ks.X, MaterialData.Ks.Y, MaterialData.Ks.Z, 1.0f);
+	Binding.Constants.Ns = MaterialData.Ns;
+	Binding.Constants.Ni = MaterialData.Ni;
+	Binding.Constants.D = MaterialData.D;
+	Binding.Constants.MaterialFlags = 0;
+
+	auto BindTexture = [&Binding](uint32 InSlot, uint32 InFlag, UTexture* InTexture)
+	{
+		if (!InTexture || !InTexture->GetRenderProxy())
+		{
+			return;
+		}
+
+		Binding.Constants.MaterialFlags |= InFlag;
+		if (InSlot < FDrawMaterialBinding::MAX_TEXTURE_SLOTS)
+		{
+			Binding.ShaderResources[InSlot] = InTexture->GetRenderProxy()->GetSRV();
+			Binding.Samplers[InSlot] = InTexture->GetRenderProxy()->GetSampler();
+		}
+	};
+
+	// Slot 0: Diffuse, 1: Ambient, 2: Specular, 4: Alpha (TextureShader.hlsl 기준)
+	BindTexture(0, MATERIAL_FLAG_DIFFUSE_MAP, DiffuseTexture);
+	BindTexture(1, MATERIAL_FLAG_AMBIENT_MAP, AmbientTexture);
+	BindTexture(2, MATERIAL_FLAG_SPECULAR_MAP, SpecularTexture);
+	BindTexture(4, MATERIAL_FLAG_ALPHA_MAP, AlphaTexture);
+
+	// Normal / Bump는 아직 셰이더에서 바인딩하지 않으므로 플래그만 남긴다
+	if (NormalTexture) { Binding.Constants.MaterialFlags |= MATERIAL_FLAG_NORMAL_MAP; }
+	if (BumpTexture) { Binding.Constants.MaterialFlags |= MATERIAL_FLAG_BUMP_MAP; }
+
+	RenderProxy->SetBinding(Binding);
 }
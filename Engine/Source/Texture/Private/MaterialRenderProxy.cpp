@@ -0,0 +1,37 @@
+#include "pch.h"
+#include "Texture/Public/MaterialRenderProxy.h"
+
+std::atomic<uint64> FMaterialRenderProxy::NextVersion{ 1 };
+std::mutex FMaterialRenderProxy::ReleasedKeysMutex;
+TArray<const void*> FMaterialRenderProxy::ReleasedKeys;
+
+FMaterialRenderProxy::~FMaterialRenderProxy()
+{
+	if (!Binding.Key)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(ReleasedKeysMutex);
+	ReleasedKeys.push_back(Binding.Key);
+}
+
+void FMaterialRenderProxy::SetBinding(const FDrawMaterialBinding& InBinding)
+{
+	// 같은 프록시의 Key가 바뀌면 이전 Key의 리소스도 더 이상 쓰이지 않는다
+	if (Binding.Key && Binding.Key != InBinding.Key)
+	{
+		std::lock_guard<std::mutex> Lock(ReleasedKeysMutex);
+		ReleasedKeys.push_back(Binding.Key);
+	}
+
+	Binding = InBinding;
+	Binding.Version = NextVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FMaterialRenderProxy::ConsumeReleasedKeys(TArray<const void*>& OutKeys)
+{
+	std::lock_guard<std::mutex> Lock(ReleasedKeysMutex);
+	OutKeys.insert(OutKeys.end(), ReleasedKeys.begin(), ReleasedKeys.end());
+	ReleasedKeys.clear();
+}
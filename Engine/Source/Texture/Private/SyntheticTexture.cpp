@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "Texture/Public/SyntheticTexture.h"
+
+#include <random>
+
+FTextureImage FSyntheticTexture::Make(ESyntheticTexture InType, uint32 InSize, uint32 InSeed)
+{
+	// FBenchmarkRandom과 같은 수열 (벤치마크 결과와 PSNR 기록을 그대로 비교할 수 있다)
+	std::mt19937 Random(InSeed);
+	auto GetRange = [&Random](float InMin, float InMax)
+	{
+		return InMin + (InMax - InMin) * static_cast<float>(Random() >> 8) * (1.0f / 16777216.0f);
+	};
+
+	FTextureImage Image;
+	Image.Resize(InSize, InSize);
+	for (uint32 y = 0; y < InSize; ++y)
+	{
+		for (uint32 x = 0; x < InSize; ++x)
+		{
+			const float U = static_cast<float>(x) / InSize;
+			const float V = static_cast<float>(y) / InSize;
+			uint8* Pixel = &Image.Pixels[(static_cast<size_t>(y) * InSize + x) * 4];
+
+			if (InType == ESyntheticTexture::Normal)
+			{
+				// h = sin(a u) * sin(b v)의 기울기
+				const float A = 2.0f * PI * 6.0f;
+				const float B = 2.0f * PI * 4.0f;
+				const float DhDu = 0.15f * A / InSize * cosf(A * U) * sinf(B * V) * InSize / 8.0f;
+				const float DhDv = 0.15f * B / InSize * sinf(A * U) * cosf(B * V) * InSize / 8.0f;
+				FVector Normal(-DhDu, -DhDv, 1.0f);
+				Normal = Normal / Normal.Length();
+				Pixel[0] = static_cast<uint8>((Normal.X * 0.5f + 0.5f) * 255.0f + 0.5f);
+				Pixel[1] = static_cast<uint8>((Normal.Y * 0.5f + 0.5f) * 255.0f + 0.5f);
+				Pixel[2] = static_cast<uint8>((Normal.Z * 0.5f + 0.5f) * 255.0f + 0.5f);
+				Pixel[3] = 255;
+				continue;
+			}
+
+			const float Stripe = 0.5f + 0.5f * sinf(U * 40.0f + V * 12.0f);
+			const bool bInsideBox = (x / 64 + y / 64) % 3 == 0;
+			const float Noise = GetRange(-0.03f, 0.03f);
+			const float R = std::clamp(U * 0.7f + Stripe * 0.2f + (bInsideBox ? 0.1f : 0.0f) + Noise, 0.0f, 1.0f);
+			const float G = std::clamp(V * 0.6f + 0.2f * sinf(V * 25.0f) + Noise, 0.0f, 1.0f);
+			const float Blue = std::clamp(0.3f + 0.4f * Stripe * (1.0f - U) + (bInsideBox ? 0.3f : 0.0f) + Noise, 0.0f, 1.0f);
+			Pixel[0] = static_cast<uint8>(R * 255.0f + 0.5f);
+			Pixel[1] = static_cast<uint8>(G * 255.0f + 0.5f);
+			Pixel[2] = static_cast<uint8>(Blue * 255.0f + 0.5f);
+
+			float Alpha = 1.0f;
+			if (InType == ESyntheticTexture::ColorAlpha)
+			{
+				const float DistanceU = U - 0.5f;
+				const float DistanceV = V - 0.5f;
+				Alpha = (DistanceU * DistanceU + DistanceV * DistanceV < 0.04f) ? 0.0f : 0.3f + 0.7f * V;
+			}
+			Pixel[3] = static_cast<uint8>(Alpha * 255.0f + 0.5f);
+		}
+	}
+	return Image;
+}
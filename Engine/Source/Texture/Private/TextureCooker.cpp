@@ -0,0 +1,1203 @@
+#include "pch.h"
+#include "Texture/Public/TextureCooker.h"
+
+#include "Core/Public/JobSystem.h"
+
+#include <cfloat>
+
+namespace
+{
+	/**
+	 * @brief 필터링용 RGBA float 이미지
+	 */
+	struct FFloatImage
+	{
+		uint32 Width = 0;
+		uint32 Height = 0;
+		TArray<float> Pixels;
+
+		void Resize(uint32 InWidth, uint32 InHeight)
+		{
+			Width = InWidth;
+			Height = InHeight;
+			Pixels.assign(static_cast<size_t>(InWidth) * InHeight * 4, 0.0f);
+		}
+	};
+
+	struct FFilterTap
+	{
+		uint32 Index;
+		float Weight;
+	};
+
+	// Kaiser 창 sinc (nvtt 기본값과 같은 폭 3, alpha 4)
+	constexpr float KAISER_WIDTH = 3.0f;
+	constexpr float KAISER_ALPHA = 4.0f;
+
+	// 같은 이미지면 PSNR을 이 값으로 돌려준다
+	constexpr double MAX_PSNR = 100.0;
+
+	// BC7 4비트 인덱스 보간 가중치 (/64)
+	constexpr int32 BC7_WEIGHTS_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	float SRGBToLinear(float InValue)
+	{
+		return InValue <= 0.04045f ? InValue / 12.92f : powf((InValue + 0.055f) / 1.055f, 2.4f);
+	}
+
+	float LinearToSRGB(float InValue)
+	{
+		return InValue <= 0.0031308f ? InValue * 12.92f : 1.055f * powf(InValue, 1.0f / 2.4f) - 0.055f;
+	}
+
+	const TStaticArray<float, 256>& GetSRGBToLinearTable()
+	{
+		static const TStaticArray<float, 256> Table = []
+		{
+			TStaticArray<float, 256> Values;
+			for (uint32 i = 0; i < 256; ++i)
+			{
+				Values[i] = SRGBToLinear(static_cast<float>(i) / 255.0f);
+			}
+			return Values;
+		}();
+		return Table;
+	}
+
+	uint8 ToByte(float InValue)
+	{
+		return static_cast<uint8>(std::clamp(InValue, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	void ToFloatImage(const FTextureImage& InImage, bool bInSRGB, FFloatImage& OutImage)
+	{
+		const TStaticArray<float, 256>& LinearTable = GetSRGBToLinearTable();
+
+		OutImage.Resize(InImage.Width, InImage.Height);
+		const size_t NumValues = InImage.Pixels.size();
+		for (size_t i = 0; i < NumValues; ++i)
+		{
+			const uint8 Value = InImage.Pixels[i];
+			// 알파는 sRGB가 아니다
+			OutImage.Pixels[i] = (bInSRGB && (i & 3) != 3) ? LinearTable[Value] : static_cast<float>(Value) * (1.0f / 255.0f);
+		}
+	}
+
+	void ToByteImage(const FFloatImage& InImage, bool bInSRGB, FTextureImage& OutImage)
+	{
+		OutImage.Resize(InImage.Width, InImage.Height);
+		const size_t NumValues = InImage.Pixels.size();
+		for (size_t i = 0; i < NumValues; ++i)
+		{
+			const float Value = InImage.Pixels[i];
+			OutImage.Pixels[i] = ToByte((bInSRGB && (i & 3) != 3) ? LinearToSRGB(std::clamp(Value, 0.0f, 1.0f)) : Value);
+		}
+	}
+
+	/** @brief 필터 링잉으로 범위를 벗어난 값을 자르고, 노멀맵이면 다시 정규화한다 */
+	void NormalizeFloatImage(FFloatImage& InOutImage, bool bInNormalMap)
+	{
+		for (size_t i = 0; i < InOutImage.Pixels.size(); i += 4)
+		{
+			float* Pixel = &InOutImage.Pixels[i];
+			if (bInNormalMap)
+			{
+				FVector Normal(Pixel[0] * 2.0f - 1.0f, Pixel[1] * 2.0f - 1.0f, Pixel[2] * 2.0f - 1.0f);
+				const float Length = Normal.Length();
+				if (Length > 1e-6f)
+				{
+					Normal = Normal / Length;
+				}
+				Pixel[0] = Normal.X * 0.5f + 0.5f;
+				Pixel[1] = Normal.Y * 0.5f + 0.5f;
+				Pixel[2] = Normal.Z * 0.5f + 0.5f;
+			}
+
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				Pixel[Channel] = std::clamp(Pixel[Channel], 0.0f, 1.0f);
+			}
+		}
+	}
+
+	float Sinc(float InX)
+	{
+		InX *= PI;
+		return fabsf(InX) < 1e-4f ? 1.0f : sinf(InX) / InX;
+	}
+
+	float BesselI0(float InX)
+	{
+		float Sum = 1.0f;
+		float Term = 1.0f;
+		const float HalfX = InX * 0.5f;
+		for (uint32 k = 1; k < 32; ++k)
+		{
+			const float Factor = HalfX / static_cast<float>(k);
+			Term *= Factor * Factor;
+			Sum += Term;
+			if (Term < Sum * 1e-8f)
+			{
+				break;
+			}
+		}
+		return Sum;
+	}
+
+	float EvaluateFilter(EMipFilter InFilter, float InX)
+	{
+		if (InFilter == EMipFilter::Box)
+		{
+			return fabsf(InX) <= 0.5f ? 1.0f : 0.0f;
+		}
+
+		if (fabsf(InX) >= KAISER_WIDTH)
+		{
+			return 0.0f;
+		}
+		const float T = InX / KAISER_WIDTH;
+		return Sinc(InX) * BesselI0(KAISER_ALPHA * sqrtf(1.0f - T * T)) / BesselI0(KAISER_ALPHA);
+	}
+
+	/**
+	 * @brief 한 축의 목적 픽셀마다 원본 픽셀 가중치를 만든다 (가장자리는 클램프)
+	 * 필터 좌표는 목적 픽셀 단위라 축소 배율만큼 원본에서 넓게 읽는다
+	 */
+	void BuildFilterTaps(uint32 InSourceSize, uint32 InDestSize, EMipFilter InFilter, TArray<TArray<FFilterTap>>& OutTaps)
+	{
+		const float Scale = static_cast<float>(InSourceSize) / static_cast<float>(InDestSize);
+		const float FilterScale = std::max(Scale, 1.0f);
+		const float Support = (InFilter == EMipFilter::Box ? 0.5f : KAISER_WIDTH) * FilterScale;
+
+		OutTaps.assign(InDestSize, {});
+		for (uint32 i = 0; i < InDestSize; ++i)
+		{
+			TArray<FFilterTap>& Taps = OutTaps[i];
+			const float Center = (static_cast<float>(i) + 0.5f) * Scale;
+			const int32 First = static_cast<int32>(floorf(Center - Support));
+			const int32 Last = static_cast<int32>(ceilf(Center + Support));
+
+			float TotalWeight = 0.0f;
+			for (int32 j = First; j <= Last; ++j)
+			{
+				const float Weight = EvaluateFilter(InFilter, (static_cast<float>(j) + 0.5f - Center) / FilterScale);
+				if (Weight == 0.0f)
+				{
+					continue;
+				}
+
+				const uint32 Index = static_cast<uint32>(std::clamp(j, 0, static_cast<int32>(InSourceSize) - 1));
+				Taps.push_back({ Index, Weight });
+				TotalWeight += Weight;
+			}
+
+			if (fabsf(TotalWeight) < 1e-6f)
+			{
+				Taps.clear();
+				Taps.push_back({ std::min(static_cast<uint32>(Center), InSourceSize - 1), 1.0f });
+				continue;
+			}
+
+			for (FFilterTap& Tap : Taps)
+			{
+				Tap.Weight /= TotalWeight;
+			}
+		}
+	}
+
+	void ResampleFloatImage(const FFloatImage& InImage, uint32 InWidth, uint32 InHeight, EMipFilter InFilter, FFloatImage& OutImage)
+	{
+		TArray<TArray<FFilterTap>> HorizontalTaps;
+		TArray<TArray<FFilterTap>> VerticalTaps;
+		BuildFilterTaps(InImage.Width, InWidth, InFilter, HorizontalTaps);
+		BuildFilterTaps(InImage.Height, InHeight, InFilter, VerticalTaps);
+
+		// 가로 먼저 줄인 뒤 세로로 줄인다
+		FFloatImage Temp;
+		Temp.Resize(InWidth, InImage.Height);
+		FJobSystem::ParallelFor(InImage.Height, [&](uint32 InBegin, uint32 InEnd)
+		{
+			for (uint32 y = InBegin; y < InEnd; ++y)
+			{
+				const float* SourceRow = &InImage.Pixels[static_cast<size_t>(y) * InImage.Width * 4];
+				float* DestRow = &Temp.Pixels[static_cast<size_t>(y) * InWidth * 4];
+				for (uint32 x = 0; x < InWidth; ++x)
+				{
+					float Sum[4] = {};
+					for (const FFilterTap& Tap : HorizontalTaps[x])
+					{
+						const float* Source = SourceRow + Tap.Index * 4;
+						for (uint32 Channel = 0; Channel < 4; ++Channel)
+						{
+							Sum[Channel] += Source[Channel] * Tap.Weight;
+						}
+					}
+					std::copy(Sum, Sum + 4, DestRow + x * 4);
+				}
+			}
+		}, 16);
+
+		OutImage.Resize(InWidth, InHeight);
+		FJobSystem::ParallelFor(InHeight, [&](uint32 InBegin, uint32 InEnd)
+		{
+			for (uint32 y = InBegin; y < InEnd; ++y)
+			{
+				float* DestRow = &OutImage.Pixels[static_cast<size_t>(y) * InWidth * 4];
+				for (const FFilterTap& Tap : VerticalTaps[y])
+				{
+					const float* SourceRow = &Temp.Pixels[static_cast<size_t>(Tap.Index) * InWidth * 4];
+					for (uint32 i = 0; i < InWidth * 4; ++i)
+					{
+						DestRow[i] += SourceRow[i] * Tap.Weight;
+					}
+				}
+			}
+		}, 16);
+	}
+
+	/**
+	 * @brief 블록 단위 읽기/쓰기용 비트 스트림 (LSB부터)
+	 */
+	struct FBlockBits
+	{
+		uint8* Data;
+		uint32 Position = 0;
+
+		void Write(uint32 InValue, uint32 InNumBits)
+		{
+			for (uint32 i = 0; i < InNumBits; ++i, ++Position)
+			{
+				if ((InValue >> i) & 1)
+				{
+					Data[Position >> 3] |= static_cast<uint8>(1u << (Position & 7));
+				}
+			}
+		}
+
+		uint32 Read(uint32 InNumBits)
+		{
+			uint32 Value = 0;
+			for (uint32 i = 0; i < InNumBits; ++i, ++Position)
+			{
+				Value |= static_cast<uint32>((Data[Position >> 3] >> (Position & 7)) & 1) << i;
+			}
+			return Value;
+		}
+	};
+
+	// --- BC1 (색상 블록) ---
+
+	uint16 PackColor565(const float InColor[3])
+	{
+		const uint32 R = static_cast<uint32>(std::clamp(InColor[0], 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+		const uint32 G = static_cast<uint32>(std::clamp(InColor[1], 0.0f, 255.0f) * (63.0f / 255.0f) + 0.5f);
+		const uint32 B = static_cast<uint32>(std::clamp(InColor[2], 0.0f, 255.0f) * (31.0f / 255.0f) + 0.5f);
+		return static_cast<uint16>((R << 11) | (G << 5) | B);
+	}
+
+	void UnpackColor565(uint16 InColor, int32 OutColor[3])
+	{
+		const int32 R = (InColor >> 11) & 31;
+		const int32 G = (InColor >> 5) & 63;
+		const int32 B = InColor & 31;
+		OutColor[0] = (R << 3) | (R >> 2);
+		OutColor[1] = (G << 2) | (G >> 4);
+		OutColor[2] = (B << 3) | (B >> 2);
+	}
+
+	/** @param bInFourColor false면 3색 + 투명 검정 (BC1에서 Color0 <= Color1일 때) */
+	void MakeColorPalette(uint16 InColor0, uint16 InColor1, bool bInFourColor, int32 OutPalette[4][4])
+	{
+		int32 Color0[3];
+		int32 Color1[3];
+		UnpackColor565(InColor0, Color0);
+		UnpackColor565(InColor1, Color1);
+
+		for (uint32 Channel = 0; Channel < 3; ++Channel)
+		{
+			OutPalette[0][Channel] = Color0[Channel];
+			OutPalette[1][Channel] = Color1[Channel];
+			if (bInFourColor)
+			{
+				OutPalette[2][Channel] = (2 * Color0[Channel] + Color1[Channel] + 1) / 3;
+				OutPalette[3][Channel] = (Color0[Channel] + 2 * Color1[Channel] + 1) / 3;
+			}
+			else
+			{
+				OutPalette[2][Channel] = (Color0[Channel] + Color1[Channel] + 1) / 2;
+				OutPalette[3][Channel] = 0;
+			}
+		}
+		OutPalette[0][3] = OutPalette[1][3] = OutPalette[2][3] = 255;
+		OutPalette[3][3] = bInFourColor ? 255 : 0;
+	}
+
+	uint32 SelectColorIndices(const uint8 InBlock[16][4], const int32 InPalette[4][4], uint32 OutIndices[16])
+	{
+		uint32 TotalError = 0;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			uint32 BestError = UINT32_MAX;
+			for (uint32 Index = 0; Index < 4; ++Index)
+			{
+				uint32 Error = 0;
+				for (uint32 Channel = 0; Channel < 3; ++Channel)
+				{
+					const int32 Delta = static_cast<int32>(InBlock[i][Channel]) - InPalette[Index][Channel];
+					Error += static_cast<uint32>(Delta * Delta);
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					OutIndices[i] = Index;
+				}
+			}
+			TotalError += BestError;
+		}
+		return TotalError;
+	}
+
+	/**
+	 * @brief N차원 색 분포의 주축 (거듭제곱법)
+	 * @return 분산이 거의 없으면 false (모든 픽셀이 같은 색)
+	 */
+	template<uint32 NumChannels>
+	bool ComputePrincipalAxis(const float InPixels[16][4], float OutMean[4], float OutAxis[4])
+	{
+		for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			float Sum = 0.0f;
+			for (uint32 i = 0; i < 16; ++i)
+			{
+				Sum += InPixels[i][Channel];
+			}
+			OutMean[Channel] = Sum / 16.0f;
+		}
+
+		float Covariance[NumChannels][NumChannels] = {};
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			float Delta[NumChannels];
+			for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Delta[Channel] = InPixels[i][Channel] - OutMean[Channel];
+			}
+			for (uint32 Row = 0; Row < NumChannels; ++Row)
+			{
+				for (uint32 Column = 0; Column < NumChannels; ++Column)
+				{
+					Covariance[Row][Column] += Delta[Row] * Delta[Column];
+				}
+			}
+		}
+
+		// 대각 성분이 가장 큰 축에서 시작한다
+		uint32 LargestChannel = 0;
+		float Trace = 0.0f;
+		for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Trace += Covariance[Channel][Channel];
+			if (Covariance[Channel][Channel] > Covariance[LargestChannel][LargestChannel])
+			{
+				LargestChannel = Channel;
+			}
+		}
+		if (Trace < 1e-3f)
+		{
+			return false;
+		}
+
+		float Axis[NumChannels] = {};
+		Axis[LargestChannel] = 1.0f;
+		for (uint32 Iteration = 0; Iteration < 8; ++Iteration)
+		{
+			float Next[NumChannels] = {};
+			float Length = 0.0f;
+			for (uint32 Row = 0; Row < NumChannels; ++Row)
+			{
+				for (uint32 Column = 0; Column < NumChannels; ++Column)
+				{
+					Next[Row] += Covariance[Row][Column] * Axis[Column];
+				}
+				Length += Next[Row] * Next[Row];
+			}
+			if (Length < 1e-12f)
+			{
+				break;
+			}
+
+			const float InvLength = 1.0f / sqrtf(Length);
+			for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Axis[Channel] = Next[Channel] * InvLength;
+			}
+		}
+
+		for (uint32 Channel = 0; Channel < 4; ++Channel)
+		{
+			OutAxis[Channel] = Channel < NumChannels ? Axis[Channel] : 0.0f;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief 주축 위 투영의 양 끝을 끝점으로 잡는다 (양 끝 이상치에 덜 끌리도록 1/16만큼 안쪽으로)
+	 */
+	template<uint32 NumChannels>
+	void ComputeAxisEndpoints(const float InPixels[16][4], const float InMean[4], const float InAxis[4], float OutEndpoint0[4], float OutEndpoint1[4])
+	{
+		float MinProjection = FLT_MAX;
+		float MaxProjection = -FLT_MAX;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			float Projection = 0.0f;
+			for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Projection += (InPixels[i][Channel] - InMean[Channel]) * InAxis[Channel];
+			}
+			MinProjection = std::min(MinProjection, Projection);
+			MaxProjection = std::max(MaxProjection, Projection);
+		}
+
+		const float Inset = (MaxProjection - MinProjection) / 16.0f;
+		MinProjection += Inset;
+		MaxProjection -= Inset;
+		for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutEndpoint0[Channel] = InMean[Channel] + InAxis[Channel] * MaxProjection;
+			OutEndpoint1[Channel] = InMean[Channel] + InAxis[Channel] * MinProjection;
+		}
+	}
+
+	/**
+	 * @brief 인덱스를 고정하고 끝점을 최소 제곱으로 다시 푼다
+	 * @param InWeights 인덱스별 Endpoint1 비율 (0이면 Endpoint0)
+	 * @return 모든 픽셀이 한 인덱스라 풀 수 없으면 false
+	 */
+	template<uint32 NumChannels>
+	bool RefineEndpoints(const float InPixels[16][4], const uint32 InIndices[16], const float* InWeights, float OutEndpoint0[4], float OutEndpoint1[4])
+	{
+		float AlphaAlpha = 0.0f;
+		float AlphaBeta = 0.0f;
+		float BetaBeta = 0.0f;
+		float AlphaX[4] = {};
+		float BetaX[4] = {};
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			const float Beta = InWeights[InIndices[i]];
+			const float Alpha = 1.0f - Beta;
+			AlphaAlpha += Alpha * Alpha;
+			AlphaBeta += Alpha * Beta;
+			BetaBeta += Beta * Beta;
+			for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				AlphaX[Channel] += Alpha * InPixels[i][Channel];
+				BetaX[Channel] += Beta * InPixels[i][Channel];
+			}
+		}
+
+		const float Determinant = AlphaAlpha * BetaBeta - AlphaBeta * AlphaBeta;
+		if (fabsf(Determinant) < 1e-6f)
+		{
+			return false;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		for (uint32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			OutEndpoint0[Channel] = std::clamp((AlphaX[Channel] * BetaBeta - BetaX[Channel] * AlphaBeta) * InvDeterminant, 0.0f, 255.0f);
+			OutEndpoint1[Channel] = std::clamp((BetaX[Channel] * AlphaAlpha - AlphaX[Channel] * AlphaBeta) * InvDeterminant, 0.0f, 255.0f);
+		}
+		return true;
+	}
+
+	void WriteColorBlock(uint16 InColor0, uint16 InColor1, const uint32 InIndices[16], uint8* OutBlock)
+	{
+		uint32 IndexBits = 0;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			IndexBits |= InIndices[i] << (i * 2);
+		}
+		memcpy(OutBlock, &InColor0, 2);
+		memcpy(OutBlock + 2, &InColor1, 2);
+		memcpy(OutBlock + 4, &IndexBits, 4);
+	}
+
+	/**
+	 * @brief BC1 색상 블록 (항상 4색 모드, BC3의 색상 블록으로도 쓴다)
+	 * 주축 끝점에서 시작해 565 양자화 -> 인덱스 선택 -> 최소 제곱 보정을 두 번 반복하고 오차가 가장 작은 결과를 쓴다
+	 */
+	void EncodeColorBlock(const uint8 InBlock[16][4], uint8* OutBlock)
+	{
+		float Pixels[16][4];
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				Pixels[i][Channel] = static_cast<float>(InBlock[i][Channel]);
+			}
+		}
+
+		float Mean[4];
+		float Axis[4];
+		float Endpoint0[4] = {};
+		float Endpoint1[4] = {};
+		if (ComputePrincipalAxis<3>(Pixels, Mean, Axis))
+		{
+			ComputeAxisEndpoints<3>(Pixels, Mean, Axis, Endpoint0, Endpoint1);
+		}
+		else
+		{
+			std::copy(Mean, Mean + 3, Endpoint0);
+			std::copy(Mean, Mean + 3, Endpoint1);
+		}
+
+		// 팔레트 인덱스별 Endpoint1 비율 (0, 1, 1/3, 2/3)
+		static constexpr float ColorWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+		uint16 BestColor0 = 0;
+		uint16 BestColor1 = 0;
+		uint32 BestIndices[16] = {};
+		uint32 BestError = UINT32_MAX;
+		for (uint32 Iteration = 0; Iteration < 3; ++Iteration)
+		{
+			const uint16 Color0 = PackColor565(Endpoint0);
+			const uint16 Color1 = PackColor565(Endpoint1);
+
+			int32 Palette[4][4];
+			MakeColorPalette(Color0, Color1, true, Palette);
+
+			uint32 Indices[16];
+			const uint32 Error = SelectColorIndices(InBlock, Palette, Indices);
+			if (Error < BestError)
+			{
+				BestError = Error;
+				BestColor0 = Color0;
+				BestColor1 = Color1;
+				std::copy(Indices, Indices + 16, BestIndices);
+			}
+
+			if (Error == 0 || !RefineEndpoints<3>(Pixels, Indices, ColorWeights, Endpoint0, Endpoint1))
+			{
+				break;
+			}
+		}
+
+		// 4색 모드는 Color0 > Color1이어야 한다, 뒤집으면 인덱스 0<->1, 2<->3이 바뀐다
+		if (BestColor0 < BestColor1)
+		{
+			std::swap(BestColor0, BestColor1);
+			for (uint32& Index : BestIndices)
+			{
+				Index ^= 1;
+			}
+		}
+		else if (BestColor0 == BestColor1)
+		{
+			std::fill(BestIndices, BestIndices + 16, 0u);
+		}
+
+		WriteColorBlock(BestColor0, BestColor1, BestIndices, OutBlock);
+	}
+
+	void DecodeColorBlock(const uint8* InBlock, bool bInForceFourColor, uint8 OutBlock[16][4])
+	{
+		uint16 Color0;
+		uint16 Color1;
+		uint32 IndexBits;
+		memcpy(&Color0, InBlock, 2);
+		memcpy(&Color1, InBlock + 2, 2);
+		memcpy(&IndexBits, InBlock + 4, 4);
+
+		int32 Palette[4][4];
+		MakeColorPalette(Color0, Color1, bInForceFourColor || Color0 > Color1, Palette);
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			const int32* Color = Palette[(IndexBits >> (i * 2)) & 3];
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				OutBlock[i][Channel] = static_cast<uint8>(Color[Channel]);
+			}
+		}
+	}
+
+	// --- BC4 (단일 채널 블록, BC3 알파와 BC5 두 채널에 쓴다) ---
+
+	void MakeSingleChannelPalette(uint8 InValue0, uint8 InValue1, int32 OutPalette[8])
+	{
+		OutPalette[0] = InValue0;
+		OutPalette[1] = InValue1;
+		if (InValue0 > InValue1)
+		{
+			for (int32 i = 2; i < 8; ++i)
+			{
+				OutPalette[i] = ((8 - i) * InValue0 + (i - 1) * InValue1 + 3) / 7;
+			}
+		}
+		else
+		{
+			for (int32 i = 2; i < 6; ++i)
+			{
+				OutPalette[i] = ((6 - i) * InValue0 + (i - 1) * InValue1 + 2) / 5;
+			}
+			OutPalette[6] = 0;
+			OutPalette[7] = 255;
+		}
+	}
+
+	uint32 SelectSingleChannelIndices(const uint8 InValues[16], const int32 InPalette[8], uint64& OutIndexBits)
+	{
+		uint32 TotalError = 0;
+		OutIndexBits = 0;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			uint32 BestIndex = 0;
+			int32 BestError = INT32_MAX;
+			for (uint32 Index = 0; Index < 8; ++Index)
+			{
+				const int32 Error = abs(static_cast<int32>(InValues[i]) - InPalette[Index]);
+				if (Error < BestError)
+				{
+					BestError = Error;
+					BestIndex = Index;
+				}
+			}
+			OutIndexBits |= static_cast<uint64>(BestIndex) << (i * 3);
+			TotalError += static_cast<uint32>(BestError * BestError);
+		}
+		return TotalError;
+	}
+
+	/**
+	 * @brief 8단계 모드(끝점 = 최대/최소)와, 0/255가 섞였을 때 6단계 모드(나머지 값의 범위 + 0/255 고정값)를 모두 보고 오차가 작은 쪽을 쓴다
+	 */
+	void EncodeSingleChannelBlock(const uint8 InValues[16], uint8* OutBlock)
+	{
+		uint8 MinValue = 255;
+		uint8 MaxValue = 0;
+		uint8 InnerMin = 255;
+		uint8 InnerMax = 0;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			MinValue = std::min(MinValue, InValues[i]);
+			MaxValue = std::max(MaxValue, InValues[i]);
+			if (InValues[i] != 0 && InValues[i] != 255)
+			{
+				InnerMin = std::min(InnerMin, InValues[i]);
+				InnerMax = std::max(InnerMax, InValues[i]);
+			}
+		}
+
+		int32 Palette[8];
+		MakeSingleChannelPalette(MaxValue, MinValue, Palette);
+		uint64 IndexBits;
+		uint32 Error = SelectSingleChannelIndices(InValues, Palette, IndexBits);
+		uint8 Value0 = MaxValue;
+		uint8 Value1 = MinValue;
+
+		if (Error > 0 && InnerMin <= InnerMax && (MinValue == 0 || MaxValue == 255))
+		{
+			MakeSingleChannelPalette(InnerMin, InnerMax, Palette);
+			uint64 SixIndexBits;
+			const uint32 SixError = SelectSingleChannelIndices(InValues, Palette, SixIndexBits);
+			if (SixError < Error)
+			{
+				Error = SixError;
+				IndexBits = SixIndexBits;
+				Value0 = InnerMin;
+				Value1 = InnerMax;
+			}
+		}
+
+		OutBlock[0] = Value0;
+		OutBlock[1] = Value1;
+		for (uint32 i = 0; i < 6; ++i)
+		{
+			OutBlock[2 + i] = static_cast<uint8>(IndexBits >> (i * 8));
+		}
+	}
+
+	void DecodeSingleChannelBlock(const uint8* InBlock, uint8 OutValues[16])
+	{
+		int32 Palette[8];
+		MakeSingleChannelPalette(InBlock[0], InBlock[1], Palette);
+
+		uint64 IndexBits = 0;
+		for (uint32 i = 0; i < 6; ++i)
+		{
+			IndexBits |= static_cast<uint64>(InBlock[2 + i]) << (i * 8);
+		}
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			OutValues[i] = static_cast<uint8>(Palette[(IndexBits >> (i * 3)) & 7]);
+		}
+	}
+
+	// --- BC7 모드 6 (한 구역, RGBA 7비트 + P비트 끝점, 4비트 인덱스) ---
+
+	void MakeBC7Palette(const int32 InEndpoint0[4], const int32 InEndpoint1[4], int32 OutPalette[16][4])
+	{
+		for (uint32 Index = 0; Index < 16; ++Index)
+		{
+			const int32 Weight = BC7_WEIGHTS_4[Index];
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				OutPalette[Index][Channel] = ((64 - Weight) * InEndpoint0[Channel] + Weight * InEndpoint1[Channel] + 32) >> 6;
+			}
+		}
+	}
+
+	uint32 SelectBC7Indices(const uint8 InBlock[16][4], const int32 InPalette[16][4], uint32 OutIndices[16])
+	{
+		uint32 TotalError = 0;
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			uint32 BestError = UINT32_MAX;
+			for (uint32 Index = 0; Index < 16; ++Index)
+			{
+				uint32 Error = 0;
+				for (uint32 Channel = 0; Channel < 4; ++Channel)
+				{
+					const int32 Delta = static_cast<int32>(InBlock[i][Channel]) - InPalette[Index][Channel];
+					Error += static_cast<uint32>(Delta * Delta);
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					OutIndices[i] = Index;
+				}
+			}
+			TotalError += BestError;
+		}
+		return TotalError;
+	}
+
+	/** @brief 끝점 하나를 P비트와 함께 7비트로 양자화한다 (8비트 값 = 7비트 << 1 | P) */
+	void QuantizeBC7Endpoint(const float InEndpoint[4], uint32 InPBit, int32 OutQuantized[4], int32 OutExpanded[4])
+	{
+		for (uint32 Channel = 0; Channel < 4; ++Channel)
+		{
+			const float Value = (std::clamp(InEndpoint[Channel], 0.0f, 255.0f) - static_cast<float>(InPBit)) * 0.5f;
+			OutQuantized[Channel] = std::clamp(static_cast<int32>(Value + 0.5f), 0, 127);
+			OutExpanded[Channel] = (OutQuantized[Channel] << 1) | static_cast<int32>(InPBit);
+		}
+	}
+
+	void EncodeBC7Block(const uint8 InBlock[16][4], uint8* OutBlock)
+	{
+		float Pixels[16][4];
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				Pixels[i][Channel] = static_cast<float>(InBlock[i][Channel]);
+			}
+		}
+
+		float Mean[4];
+		float Axis[4];
+		float Endpoint0[4];
+		float Endpoint1[4];
+		if (ComputePrincipalAxis<4>(Pixels, Mean, Axis))
+		{
+			ComputeAxisEndpoints<4>(Pixels, Mean, Axis, Endpoint0, Endpoint1);
+		}
+		else
+		{
+			std::copy(Mean, Mean + 4, Endpoint0);
+			std::copy(Mean, Mean + 4, Endpoint1);
+		}
+
+		float BC7Weights[16];
+		for (uint32 Index = 0; Index < 16; ++Index)
+		{
+			BC7Weights[Index] = static_cast<float>(BC7_WEIGHTS_4[Index]) / 64.0f;
+		}
+
+		int32 BestQuantized[2][4] = {};
+		uint32 BestPBits[2] = {};
+		uint32 BestIndices[16] = {};
+		uint32 BestError = UINT32_MAX;
+		for (uint32 Iteration = 0; Iteration < 3; ++Iteration)
+		{
+			uint32 IterationError = UINT32_MAX;
+			uint32 IterationIndices[16] = {};
+
+			// P비트 조합 네 가지를 모두 본다
+			for (uint32 PBits = 0; PBits < 4; ++PBits)
+			{
+				int32 Quantized[2][4];
+				int32 Expanded[2][4];
+				QuantizeBC7Endpoint(Endpoint0, PBits & 1, Quantized[0], Expanded[0]);
+				QuantizeBC7Endpoint(Endpoint1, PBits >> 1, Quantized[1], Expanded[1]);
+
+				int32 Palette[16][4];
+				MakeBC7Palette(Expanded[0], Expanded[1], Palette);
+
+				uint32 Indices[16];
+				const uint32 Error = SelectBC7Indices(InBlock, Palette, Indices);
+				if (Error < IterationError)
+				{
+					IterationError = Error;
+					std::copy(Indices, Indices + 16, IterationIndices);
+				}
+				if (Error < BestError)
+				{
+					BestError = Error;
+					memcpy(BestQuantized, Quantized, sizeof(Quantized));
+					BestPBits[0] = PBits & 1;
+					BestPBits[1] = PBits >> 1;
+					std::copy(Indices, Indices + 16, BestIndices);
+				}
+			}
+
+			if (IterationError == 0 || !RefineEndpoints<4>(Pixels, IterationIndices, BC7Weights, Endpoint0, Endpoint1))
+			{
+				break;
+			}
+		}
+
+		// 첫 픽셀(앵커)의 인덱스 최상위 비트는 저장하지 않으므로 0이 되도록 끝점을 뒤집는다
+		if (BestIndices[0] & 8)
+		{
+			std::swap(BestQuantized[0], BestQuantized[1]);
+			std::swap(BestPBits[0], BestPBits[1]);
+			for (uint32& Index : BestIndices)
+			{
+				Index = 15 - Index;
+			}
+		}
+
+		memset(OutBlock, 0, 16);
+		FBlockBits Bits{ OutBlock };
+		Bits.Write(1u << 6, 7);
+		for (uint32 Channel = 0; Channel < 4; ++Channel)
+		{
+			Bits.Write(static_cast<uint32>(BestQuantized[0][Channel]), 7);
+			Bits.Write(static_cast<uint32>(BestQuantized[1][Channel]), 7);
+		}
+		Bits.Write(BestPBits[0], 1);
+		Bits.Write(BestPBits[1], 1);
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			Bits.Write(BestIndices[i], i == 0 ? 3 : 4);
+		}
+	}
+
+	/** @return 모드 6이 아니면 false (이 쿠커는 모드 6만 만든다) */
+	bool DecodeBC7Block(const uint8* InBlock, uint8 OutBlock[16][4])
+	{
+		if ((InBlock[0] & 0x7F) != (1u << 6))
+		{
+			return false;
+		}
+
+		FBlockBits Bits{ const_cast<uint8*>(InBlock) };
+		Bits.Read(7);
+
+		int32 Endpoints[2][4];
+		for (uint32 Channel = 0; Channel < 4; ++Channel)
+		{
+			Endpoints[0][Channel] = static_cast<int32>(Bits.Read(7)) << 1;
+			Endpoints[1][Channel] = static_cast<int32>(Bits.Read(7)) << 1;
+		}
+		const int32 PBit0 = static_cast<int32>(Bits.Read(1));
+		const int32 PBit1 = static_cast<int32>(Bits.Read(1));
+		for (uint32 Channel = 0; Channel < 4; ++Channel)
+		{
+			Endpoints[0][Channel] |= PBit0;
+			Endpoints[1][Channel] |= PBit1;
+		}
+
+		int32 Palette[16][4];
+		MakeBC7Palette(Endpoints[0], Endpoints[1], Palette);
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			const uint32 Index = Bits.Read(i == 0 ? 3 : 4);
+			for (uint32 Channel = 0; Channel < 4; ++Channel)
+			{
+				OutBlock[i][Channel] = static_cast<uint8>(Palette[Index][Channel]);
+			}
+		}
+		return true;
+	}
+
+	/** @brief 4x4 블록을 읽는다, 이미지 밖은 가장자리 픽셀로 채운다 */
+	void GatherBlock(const FTextureImage& InImage, uint32 InBlockX, uint32 InBlockY, uint8 OutBlock[16][4])
+	{
+		for (uint32 y = 0; y < 4; ++y)
+		{
+			const uint32 PixelY = std::min(InBlockY * 4 + y, InImage.Height - 1);
+			for (uint32 x = 0; x < 4; ++x)
+			{
+				const uint32 PixelX = std::min(InBlockX * 4 + x, InImage.Width - 1);
+				memcpy(OutBlock[y * 4 + x], &InImage.Pixels[(static_cast<size_t>(PixelY) * InImage.Width + PixelX) * 4], 4);
+			}
+		}
+	}
+
+	void ScatterBlock(const uint8 InBlock[16][4], uint32 InBlockX, uint32 InBlockY, FTextureImage& OutImage)
+	{
+		for (uint32 y = 0; y < 4 && InBlockY * 4 + y < OutImage.Height; ++y)
+		{
+			for (uint32 x = 0; x < 4 && InBlockX * 4 + x < OutImage.Width; ++x)
+			{
+				const size_t PixelIndex = static_cast<size_t>(InBlockY * 4 + y) * OutImage.Width + InBlockX * 4 + x;
+				memcpy(&OutImage.Pixels[PixelIndex * 4], InBlock[y * 4 + x], 4);
+			}
+		}
+	}
+}
+
+uint64 FTextureCookSettings::GetHash() const
+{
+	constexpr uint64 Prime = 0x100000001b3ULL;
+	uint64 Hash = 0xcbf29ce484222325ULL;
+	for (const uint64 Value : { static_cast<uint64>(FTextureCooker::COOKER_VERSION), static_cast<uint64>(Format),
+		static_cast<uint64>(MipFilter), static_cast<uint64>(bGenerateMips), static_cast<uint64>(bSRGB), static_cast<uint64>(bNormalMap) })
+	{
+		Hash = (Hash ^ Value) * Prime;
+	}
+	return Hash;
+}
+
+bool FTextureCooker::Cook(const FTextureImage& InImage, const FTextureCookSettings& InSettings, FCookedTexture& OutTexture)
+{
+	if (!InImage.IsValid())
+	{
+		UE_LOG_ERROR("TextureCooker: 잘못된 원본 이미지 (%ux%u)", InImage.Width, InImage.Height);
+		return false;
+	}
+
+	TArray<FTextureImage> Mips;
+	GenerateMips(InImage, InSettings, Mips);
+
+	OutTexture.Format = InSettings.Format;
+	OutTexture.Width = Mips[0].Width;
+	OutTexture.Height = Mips[0].Height;
+	OutTexture.Mips.clear();
+	OutTexture.Data.clear();
+
+	uint64 TotalSize = 0;
+	for (const FTextureImage& Mip : Mips)
+	{
+		TotalSize += GetMipSize(InSettings.Format, Mip.Width, Mip.Height);
+	}
+	OutTexture.Data.reserve(TotalSize);
+
+	TArray<uint8> MipData;
+	for (const FTextureImage& Mip : Mips)
+	{
+		Encode(Mip, InSettings.Format, MipData);
+
+		FCookedMip& CookedMip = OutTexture.Mips.emplace_back();
+		CookedMip.Width = Mip.Width;
+		CookedMip.Height = Mip.Height;
+		CookedMip.RowPitch = GetRowPitch(InSettings.Format, Mip.Width);
+		CookedMip.Offset = OutTexture.Data.size();
+		CookedMip.Size = MipData.size();
+		OutTexture.Data.insert(OutTexture.Data.end(), MipData.begin(), MipData.end());
+	}
+	return true;
+}
+
+void FTextureCooker::GenerateMips(const FTextureImage& InImage, const FTextureCookSettings& InSettings, TArray<FTextureImage>& OutMips)
+{
+	OutMips.clear();
+
+	FFloatImage Current;
+	ToFloatImage(InImage, InSettings.bSRGB, Current);
+
+	const uint32 TopWidth = (InImage.Width + 3) & ~3u;
+	const uint32 TopHeight = (InImage.Height + 3) & ~3u;
+	if (TopWidth != InImage.Width || TopHeight != InImage.Height)
+	{
+		FFloatImage Resized;
+		ResampleFloatImage(Current, TopWidth, TopHeight, InSettings.MipFilter, Resized);
+		NormalizeFloatImage(Resized, InSettings.bNormalMap);
+		Current = std::move(Resized);
+		ToByteImage(Current, InSettings.bSRGB, OutMips.emplace_back());
+	}
+	else
+	{
+		OutMips.push_back(InImage);
+	}
+
+	if (!InSettings.bGenerateMips)
+	{
+		return;
+	}
+
+	// 밉마다 바로 위 밉(float)에서 줄여 누적 양자화 오차를 피한다
+	while (Current.Width > 1 || Current.Height > 1)
+	{
+		FFloatImage Next;
+		ResampleFloatImage(Current, std::max(Current.Width / 2, 1u), std::max(Current.Height / 2, 1u), InSettings.MipFilter, Next);
+		NormalizeFloatImage(Next, InSettings.bNormalMap);
+		ToByteImage(Next, InSettings.bSRGB, OutMips.emplace_back());
+		Current = std::move(Next);
+	}
+}
+
+void FTextureCooker::Resample(const FTextureImage& InImage, uint32 InWidth, uint32 InHeight, const FTextureCookSettings& InSettings, FTextureImage& OutImage)
+{
+	FFloatImage Source;
+	ToFloatImage(InImage, InSettings.bSRGB, Source);
+
+	FFloatImage Dest;
+	ResampleFloatImage(Source, InWidth, InHeight, InSettings.MipFilter, Dest);
+	NormalizeFloatImage(Dest, InSettings.bNormalMap);
+	ToByteImage(Dest, InSettings.bSRGB, OutImage);
+}
+
+void FTextureCooker::Encode(const FTextureImage& InImage, ETextureFormat InFormat, TArray<uint8>& OutData)
+{
+	const uint32 NumBlocksX = (InImage.Width + 3) / 4;
+	const uint32 NumBlocksY = (InImage.Height + 3) / 4;
+	const uint32 BlockBytes = GetBlockBytes(InFormat);
+	const uint32 RowPitch = GetRowPitch(InFormat, InImage.Width);
+	OutData.resize(static_cast<size_t>(RowPitch) * NumBlocksY);
+
+	// 블록 줄 단위로 나눈다 (한 줄이 2048 텍스처면 512 블록)
+	FJobSystem::ParallelFor(NumBlocksY, [&](uint32 InBegin, uint32 InEnd)
+	{
+		uint8 Block[16][4];
+		uint8 Channel[16];
+		for (uint32 BlockY = InBegin; BlockY < InEnd; ++BlockY)
+		{
+			uint8* Out = OutData.data() + static_cast<size_t>(BlockY) * RowPitch;
+			for (uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX, Out += BlockBytes)
+			{
+				GatherBlock(InImage, BlockX, BlockY, Block);
+				switch (InFormat)
+				{
+				case ETextureFormat::BC1:
+					EncodeColorBlock(Block, Out);
+					break;
+				case ETextureFormat::BC3:
+					for (uint32 i = 0; i < 16; ++i)
+					{
+						Channel[i] = Block[i][3];
+					}
+					EncodeSingleChannelBlock(Channel, Out);
+					EncodeColorBlock(Block, Out + 8);
+					break;
+				case ETextureFormat::BC5:
+					for (uint32 Component = 0; Component < 2; ++Component)
+					{
+						for (uint32 i = 0; i < 16; ++i)
+						{
+							Channel[i] = Block[i][Component];
+						}
+						EncodeSingleChannelBlock(Channel, Out + Component * 8);
+					}
+					break;
+				case ETextureFormat::BC7:
+				default:
+					EncodeBC7Block(Block, Out);
+					break;
+				}
+			}
+		}
+	}, 4);
+}
+
+bool FTextureCooker::Decode(const uint8* InData, uint32 InWidth, uint32 InHeight, ETextureFormat InFormat, FTextureImage& OutImage)
+{
+	OutImage.Resize(InWidth, InHeight);
+
+	const uint32 NumBlocksX = (InWidth + 3) / 4;
+	const uint32 NumBlocksY = (InHeight + 3) / 4;
+	const uint32 BlockBytes = GetBlockBytes(InFormat);
+
+	bool bSucceeded = true;
+	uint8 Block[16][4];
+	uint8 Channel[16];
+	for (uint32 BlockY = 0; BlockY < NumBlocksY; ++BlockY)
+	{
+		for (uint32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+		{
+			const uint8* In = InData + (static_cast<size_t>(BlockY) * NumBlocksX + BlockX) * BlockBytes;
+			switch (InFormat)
+			{
+			case ETextureFormat::BC1:
+				DecodeColorBlock(In, false, Block);
+				break;
+			case ETextureFormat::BC3:
+				DecodeColorBlock(In + 8, true, Block);
+				DecodeSingleChannelBlock(In, Channel);
+				for (uint32 i = 0; i < 16; ++i)
+				{
+					Block[i][3] = Channel[i];
+				}
+				break;
+			case ETextureFormat::BC5:
+				for (uint32 Component = 0; Component < 2; ++Component)
+				{
+					DecodeSingleChannelBlock(In + Component * 8, Channel);
+					for (uint32 i = 0; i < 16; ++i)
+					{
+						Block[i][Component] = Channel[i];
+					}
+				}
+				for (uint32 i = 0; i < 16; ++i)
+				{
+					Block[i][2] = 0;
+					Block[i][3] = 255;
+				}
+				break;
+			case ETextureFormat::BC7:
+			default:
+				if (!DecodeBC7Block(In, Block))
+				{
+					memset(Block, 0, sizeof(Block));
+					bSucceeded = false;
+				}
+				break;
+			}
+			ScatterBlock(Block, BlockX, BlockY, OutImage);
+		}
+	}
+	return bSucceeded;
+}
+
+double FTextureCooker::ComputePSNR(const FTextureImage& InReference, const FTextureImage& InImage, uint32 InChannelMask)
+{
+	if (InReference.Width != InImage.Width || InReference.Height != InImage.Height || !InReference.IsValid() || !InImage.IsValid())
+	{
+		return 0.0;
+	}
+
+	uint64 SquaredError = 0;
+	uint64 NumSamples = 0;
+	for (size_t i = 0; i < InReference.Pixels.size(); ++i)
+	{
+		if (!((InChannelMask >> (i & 3)) & 1))
+		{
+			continue;
+		}
+		const int32 Delta = static_cast<int32>(InReference.Pixels[i]) - static_cast<int32>(InImage.Pixels[i]);
+		SquaredError += static_cast<uint64>(Delta * Delta);
+		++NumSamples;
+	}
+
+	if (SquaredError == 0 || NumSamples == 0)
+	{
+		return MAX_PSNR;
+	}
+
+	const double MeanSquaredError = static_cast<double>(SquaredError) / static_cast<double>(NumSamples);
+	return std::min(MAX_PSNR, 10.0 * log10(255.0 * 255.0 / MeanSquaredError));
+}
+
+const char* FTextureCooker::GetFormatName(ETextureFormat InFormat)
+{
+	switch (InFormat)
+	{
+	case ETextureFormat::BC1: return "BC1";
+	case ETextureFormat::BC3: return "BC3";
+	case ETextureFormat::BC5: return "BC5";
+	case ETextureFormat::BC7: return "BC7";
+	default: return "Unknown";
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "Texture/Public/TextureCooker.h"
+
+/**
+ * @brief 캐시 안 쿠킹 텍스처 하나 (Mips/Data는 캐시가 가진 메모리를 가리킨다)
+ */
+struct FCookedTextureView
+{
+	ETextureFormat Format = ETextureFormat::BC7;
+	uint32 Width = 0;
+	uint32 Height = 0;
+	uint32 NumMips = 0;
+	const FCookedMip* Mips = nullptr;
+	// FCookedMip::Offset의 기준
+	const uint8* Data = nullptr;
+};
+
+/**
+ * @brief 원본 내용 해시 + 쿠킹 설정 해시로 찾는 쿠킹 텍스처 캐시 파일
+ *
+ * 파일 레이아웃: 헤더 | 엔트리 표 | 밉 표 | 텍스처 데이터 (데이터는 16바이트 정렬)
+ * 불러올 때 파일 전체를 한 번에 읽고 표만 훑어 색인을 만든다, 텍스처 데이터는 복사하지 않고 그 버퍼를 그대로 가리킨다
+ * 버전(파일 포맷 + 쿠커 버전)이 다르면 통째로 버린다
+ */
+class FCookedTextureCache
+{
+public:
+	/** @return 파일이 없거나 버전이 맞지 않으면 false (빈 캐시로 시작한다) */
+	bool Load(const FString& InPath);
+	bool Save(const FString& InPath);
+
+	/** @return 없으면 nullptr, 포인터는 Add나 Load를 다시 부르기 전까지 유효하다 */
+	const FCookedTextureView* Find(uint64 InSourceHash, uint64 InSettingsHash) const;
+
+	/** 같은 키가 있으면 덮어쓴다 */
+	void Add(uint64 InSourceHash, uint64 InSettingsHash, FCookedTexture&& InTexture);
+
+	void Clear();
+
+	uint32 Num() const { return static_cast<uint32>(Entries.size()); }
+	bool IsDirty() const { return bIsDirty; }
+	// 마지막 Load에서 읽은 파일 크기
+	uint64 GetLoadedBytes() const { return LoadedFile.size(); }
+
+	static constexpr uint32 FILE_MAGIC = 0x43585447; // "GTXC"
+	static constexpr uint32 FILE_VERSION = 1;
+
+private:
+	struct FEntry
+	{
+		uint64 SourceHash = 0;
+		uint64 SettingsHash = 0;
+		FCookedTextureView View;
+	};
+
+	static uint64 MakeKey(uint64 InSourceHash, uint64 InSettingsHash)
+	{
+		return InSourceHash ^ (InSettingsHash * 0x9e3779b97f4a7c15ULL);
+	}
+
+	TArray<FEntry> Entries;
+	TMap<uint64, uint32> KeyToEntry;
+
+	// 파일에서 읽은 원본 버퍼 (View가 가리킨다)
+	TArray<uint8> LoadedFile;
+	// Add로 넣은 텍스처, 주소가 바뀌지 않게 unique_ptr로 보관한다
+	TArray<std::unique_ptr<FCookedTexture>> AddedTextures;
+	bool bIsDirty = false;
+};
@@ -1,7 +1,8 @@
 #pragma once
-#include "Core/Public/Object.h";
+#include "Core/Public/Object.h"
 
 class UTexture;
+struct FMaterialRenderProxy;
 
 /**
  * @note: This struct is exactly same as the one defined in ObjImporter.h.
@@ -24,16 +25,16 @@ struct FMaterial
 	FVector Ke;
 
 	/** Specular exponent (Ns). Defines the size of the specular highlight. */
-	float Ns;
+	float Ns = 0.0f;
 
 	/** Optical density or index of refraction (Ni). */
-	float Ni;
+	float Ni = 1.0f;
 
 	/** Dissolve factor (d). 1.0 is fully opaque. */
-	float D;
+	float D = 1.0f;
 
 	/** Illumination model (illum). */
-	int32 Illumination;
+	int32 Illumination = 0;
 
 	/** Ambient texture map (map_Ka). */
 	FString KaMap;
@@ -61,10 +62,13 @@ class UMaterial : public UObject
 	DECLARE_CLASS(UMaterial, UObject)
 
 public:
-	UMaterial() {};
-	UMaterial(const FName& InName) {};
+	UMaterial();
+	UMaterial(const FName& InName);
 	~UMaterial() override;
 
+	const FMaterial& GetMaterialData() const { return MaterialData; }
+	void SetMaterialData(const FMaterial& InMaterialData) { MaterialData = InMaterialData; UpdateRenderProxy(); }
+
 	FVector GetAmbientColor() const { return MaterialData.Ka; }
 	FVector GetDiffuseColor() const { return MaterialData.Kd; }
 	FVector GetSpecularColor() const { return MaterialData.Ks; }
@@ -80,14 +84,19 @@ public:
 	UTexture* GetAlphaTexture() const { return AlphaTexture; }
 	UTexture* GetBumpTexture() const { return BumpTexture; }
 
-	void SetDiffuseTexture(UTexture* InTexture) { DiffuseTexture = InTexture; }
-	void SetAmbientTexture(UTexture* InTexture) { AmbientTexture = InTexture; }
-	void SetSpecularTexture(UTexture* InTexture) { SpecularTexture = InTexture; }
-	void SetNormalTexture(UTexture* InTexture) { NormalTexture = InTexture; }
-	void SetAlphaTexture(UTexture* InTexture) { AlphaTexture = InTexture; }
-	void SetBumpTexture(UTexture* InTexture) { BumpTexture = InTexture; }
+	void SetDiffuseTexture(UTexture* InTexture) { DiffuseTexture = InTexture; UpdateRenderProxy(); }
+	void SetAmbientTexture(UTexture* InTexture) { AmbientTexture = InTexture; UpdateRenderProxy(); }
+	void SetSpecularTexture(UTexture* InTexture) { SpecularTexture = InTexture; UpdateRenderProxy(); }
+	void SetNormalTexture(UTexture* InTexture) { NormalTexture = InTexture; UpdateRenderProxy(); }
+	void SetAlphaTexture(UTexture* InTexture) { AlphaTexture = InTexture; UpdateRenderProxy(); }
+	void SetBumpTexture(UTexture* InTexture) { BumpTexture = InTexture; UpdateRenderProxy(); }
+
+	// 재질 상수 블록과 텍스처 바인딩 캐시 (재질이 바뀔 때만 다시 만들어진다)
+	const FMaterialRenderProxy* GetRenderProxy() const { return RenderProxy; }
 
 private:
+	void UpdateRenderProxy();
+
 	UTexture* DiffuseTexture = nullptr;
 	UTexture* AmbientTexture = nullptr;
 	UTexture* SpecularTexture = nullptr;
@@ -96,4 +105,6 @@ private:
 	UTexture* BumpTexture = nullptr;
 
 	FMaterial MaterialData;
+
+	FMaterialRenderProxy* RenderProxy = nullptr;
 };
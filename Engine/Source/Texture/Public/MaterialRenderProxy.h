@@ -0,0 +1,41 @@
+#pragma once
+#include "Render/Renderer/Public/DrawCommandList.h"
+
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief UMaterial의 렌더링용 캐시 (재질 상수 블록 + 텍스처 바인딩)
+ * 재질 데이터나 텍스처가 바뀔 때만 UMaterial이 다시 만들어 넣고, 드로우 시에는 그대로 읽기만 한다
+ * 갱신될 때마다 전역적으로 유일한 Version을 받으므로 백엔드는 (Key, Version)만 비교해 업로드 여부를 정한다
+ * 프록시가 파괴되면 Key를 해제 목록에 넣고, 백엔드가 다음 제출 때 그 Key로 만든 재질별 리소스를 정리한다
+ */
+struct FMaterialRenderProxy
+{
+public:
+	FMaterialRenderProxy() = default;
+	~FMaterialRenderProxy();
+
+	FMaterialRenderProxy(const FMaterialRenderProxy&) = delete;
+	FMaterialRenderProxy& operator=(const FMaterialRenderProxy&) = delete;
+
+	const FDrawMaterialBinding& GetBinding() const { return Binding; }
+	uint64 GetVersion() const { return Binding.Version; }
+
+	void SetBinding(const FDrawMaterialBinding& InBinding);
+
+	/**
+	 * @brief 마지막 호출 이후 파괴된 프록시의 Key를 꺼낸다
+	 * 재질은 게임 스레드에서 파괴되고 백엔드는 렌더 스레드에서 제출할 수 있으므로 잠금으로 보호한다
+	 */
+	static void ConsumeReleasedKeys(TArray<const void*>& OutKeys);
+
+private:
+	FDrawMaterialBinding Binding;
+
+	// 여러 스레드가 재질을 갱신해도 Version이 겹치지 않도록 atomic
+	static std::atomic<uint64> NextVersion;
+
+	static std::mutex ReleasedKeysMutex;
+	static TArray<const void*> ReleasedKeys;
+};
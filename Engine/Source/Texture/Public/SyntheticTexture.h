@@ -0,0 +1,19 @@
+#pragma once
+#include "Texture/Public/TextureCooker.h"
+
+enum class ESyntheticTexture : uint8
+{
+	Color,
+	ColorAlpha,
+	Normal,
+};
+
+/**
+ * @brief 압축 품질과 처리량을 볼 합성 텍스처 (테스트와 벤치마크가 같은 이미지를 쓴다)
+ * Color: 부드러운 그라디언트 + 무늬 + 날카로운 경계 + 약한 노이즈, ColorAlpha: 여기에 알파 그라디언트와 구멍,
+ * Normal: 높이 함수에서 구한 탄젠트 공간 노멀 (RGB = XYZ * 0.5 + 0.5)
+ */
+struct FSyntheticTexture
+{
+	static FTextureImage Make(ESyntheticTexture InType, uint32 InSize, uint32 InSeed);
+};
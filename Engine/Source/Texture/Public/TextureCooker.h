@@ -0,0 +1,121 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 쿠킹 결과 블록 압축 포맷 (모두 4x4 블록 단위)
+ * BC1: RGB 4bpp, BC3: RGB + 보간 알파 8bpp, BC5: RG 두 채널 8bpp (노멀맵), BC7: RGBA 8bpp (모드 6만 사용)
+ */
+enum class ETextureFormat : uint8
+{
+	BC1,
+	BC3,
+	BC5,
+	BC7,
+
+	Count
+};
+
+enum class EMipFilter : uint8
+{
+	Box,
+	Kaiser,
+};
+
+/**
+ * @brief RGBA8 이미지 (행 사이 여백 없음)
+ */
+struct FTextureImage
+{
+	uint32 Width = 0;
+	uint32 Height = 0;
+	TArray<uint8> Pixels;
+
+	void Resize(uint32 InWidth, uint32 InHeight)
+	{
+		Width = InWidth;
+		Height = InHeight;
+		Pixels.assign(static_cast<size_t>(InWidth) * InHeight * 4, 0);
+	}
+
+	bool IsValid() const { return Width > 0 && Height > 0 && Pixels.size() == static_cast<size_t>(Width) * Height * 4; }
+};
+
+struct FTextureCookSettings
+{
+	ETextureFormat Format = ETextureFormat::BC7;
+	EMipFilter MipFilter = EMipFilter::Kaiser;
+	bool bGenerateMips = true;
+	// 색상 텍스처면 sRGB를 선형으로 풀어 필터링한다 (결과는 다시 sRGB 값으로 저장한다)
+	bool bSRGB = true;
+	// 노멀맵이면 밉마다 RG(B)를 다시 정규화한다
+	bool bNormalMap = false;
+
+	/** 쿠킹 결과에 영향을 주는 값만 섞은 해시 (캐시 키) */
+	uint64 GetHash() const;
+};
+
+/**
+ * @brief 밉 하나의 위치 (쿠킹 캐시 파일에도 이 레이아웃 그대로 기록한다)
+ */
+struct FCookedMip
+{
+	uint32 Width = 0;
+	uint32 Height = 0;
+	// 블록 한 줄의 바이트 수 (D3D11_SUBRESOURCE_DATA::SysMemPitch)
+	uint32 RowPitch = 0;
+	uint32 Padding = 0;
+	// 텍스처 데이터 시작 기준
+	uint64 Offset = 0;
+	uint64 Size = 0;
+};
+
+struct FCookedTexture
+{
+	ETextureFormat Format = ETextureFormat::BC7;
+	uint32 Width = 0;
+	uint32 Height = 0;
+	TArray<FCookedMip> Mips;
+	TArray<uint8> Data;
+};
+
+/**
+ * @brief CPU 텍스처 쿠커: 밉 체인 생성 + BC1/BC3/BC5/BC7 인코딩
+ * 인코딩은 블록 줄 단위로 FJobSystem에 나눠 돌린다
+ * 검증용으로 같은 포맷의 CPU 디코더와 PSNR 계산을 함께 둔다 (GPU 없이 품질을 잴 수 있다)
+ * D3D에 의존하지 않는다, 원본 이미지 디코딩(WIC)은 호출자가 맡는다
+ */
+class FTextureCooker
+{
+public:
+	/**
+	 * @brief 밉 체인을 만들고 각 밉을 블록 압축한다
+	 * BC 텍스처의 최상위 밉 크기는 4의 배수여야 하므로 아니면 같은 필터로 4의 배수까지 늘린다
+	 */
+	static bool Cook(const FTextureImage& InImage, const FTextureCookSettings& InSettings, FCookedTexture& OutTexture);
+
+	/** @brief OutMips[0]은 원본(크기 조정 후), 이후 한 변씩 절반으로 1x1까지 */
+	static void GenerateMips(const FTextureImage& InImage, const FTextureCookSettings& InSettings, TArray<FTextureImage>& OutMips);
+
+	/** @brief 이미지 크기 조정 (축마다 분리 필터, 축소 시 필터 폭을 배율만큼 넓힌다) */
+	static void Resample(const FTextureImage& InImage, uint32 InWidth, uint32 InHeight, const FTextureCookSettings& InSettings, FTextureImage& OutImage);
+
+	static void Encode(const FTextureImage& InImage, ETextureFormat InFormat, TArray<uint8>& OutData);
+	static bool Decode(const uint8* InData, uint32 InWidth, uint32 InHeight, ETextureFormat InFormat, FTextureImage& OutImage);
+
+	/**
+	 * @brief 두 이미지의 PSNR (dB), 같은 크기여야 한다
+	 * @param InChannelMask 비교할 채널 (비트 0: R, 1: G, 2: B, 3: A)
+	 */
+	static double ComputePSNR(const FTextureImage& InReference, const FTextureImage& InImage, uint32 InChannelMask = 0x7);
+
+	static uint32 GetBlockBytes(ETextureFormat InFormat) { return InFormat == ETextureFormat::BC1 ? 8 : 16; }
+	static uint32 GetRowPitch(ETextureFormat InFormat, uint32 InWidth) { return ((InWidth + 3) / 4) * GetBlockBytes(InFormat); }
+	static uint64 GetMipSize(ETextureFormat InFormat, uint32 InWidth, uint32 InHeight)
+	{
+		return static_cast<uint64>(GetRowPitch(InFormat, InWidth)) * ((InHeight + 3) / 4);
+	}
+	static const char* GetFormatName(ETextureFormat InFormat);
+
+	/** 인코더/디코더 결과가 바뀌면 올린다 (쿠킹 캐시가 통째로 무효화된다) */
+	static constexpr uint32 COOKER_VERSION = 1;
+};
@@ -162,8 +162,6 @@ UObject* UWorld::Duplicate(FObjectDuplicationParameters Parameters)
 {
 	auto DupObject = static_cast<UWorld*>(Super::Duplicate(Parameters));
 
-	DupObject->WorldType = WorldType;
-
 	if (Level)
 	{
 		if (auto It = Parameters.DuplicationSeed.find(Level); It != Parameters.DuplicationSeed.end())
@@ -182,3 +180,10 @@ UObject* UWorld::Duplicate(FObjectDuplicationParameters Parameters)
 
 	return DupObject;
 }
+
+void UWorld::CopyPropertiesFrom(const UObject* InSource)
+{
+	Super::CopyPropertiesFrom(InSource);
+
+	WorldType = static_cast<const UWorld*>(InSource)->WorldType;
+}
@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "World/Public/WorldCloner.h"
+
+#include "Actor/Public/Actor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Editor/Public/FrustumCull.h"
+#include "Level/Public/Level.h"
+#include "World/Public/World.h"
+
+UWorld* FWorldCloner::Clone(UWorld* InSourceWorld, UObject* InOuter)
+{
+	SourceObjects.clear();
+	ClonedObjects.clear();
+	CloneIndices.clear();
+
+	if (!InSourceWorld)
+	{
+		return nullptr;
+	}
+
+	GatherSourceObjects(InSourceWorld);
+	ClonedObjects.assign(SourceObjects.size(), nullptr);
+
+	// 복제본이 GUObjectArray에 들어갈 자리를 한 번에 잡는다
+	TArray<TObjectPtr<UObject>>& ObjectArray = GetUObjectArray();
+	ObjectArray.reserve(ObjectArray.size() + SourceObjects.size());
+
+	UWorld* DestWorld = NewObject<UWorld>(InOuter);
+	DestWorld->CopyPropertiesFrom(InSourceWorld);
+	AddClone(InSourceWorld, DestWorld);
+
+	ULevel* SourceLevel = InSourceWorld->GetLevel();
+	if (!SourceLevel)
+	{
+		return DestWorld;
+	}
+
+	// 이름을 받는 생성자는 "Object_N" 이름 문자열을 만들지 않는다
+	ULevel* DestLevel = new ULevel(SourceLevel->GetName());
+	DestLevel->SetOuter(DestWorld);
+	DestLevel->CopyPropertiesFrom(SourceLevel);
+	DestWorld->SetLevel(DestLevel);
+	AddClone(SourceLevel, DestLevel);
+
+	DestLevel->Actors.reserve(SourceLevel->Actors.size());
+	for (AActor* Actor : SourceLevel->Actors)
+	{
+		if (Actor)
+		{
+			CloneActor(Actor, DestLevel);
+		}
+	}
+
+	// 모든 복제본이 만들어진 뒤에 참조를 옮긴다
+	for (AActor* Actor : SourceLevel->Actors)
+	{
+		if (Actor)
+		{
+			RemapActorReferences(Actor);
+		}
+	}
+	RemapLevelReferences(SourceLevel, DestLevel);
+
+	return DestWorld;
+}
+
+UObject* FWorldCloner::FindClone(const UObject* InSource) const
+{
+	if (!InSource)
+	{
+		return nullptr;
+	}
+
+	const uint32 InternalIndex = InSource->GetInternalIndex();
+	if (InternalIndex >= CloneIndices.size() || CloneIndices[InternalIndex] == INVALID_INDEX)
+	{
+		return nullptr;
+	}
+
+	return ClonedObjects[CloneIndices[InternalIndex]];
+}
+
+/**
+ * @brief 월드 -> 레벨 -> 액터 -> 소유 컴포넌트 순서로 한 번 훑으며 원본마다 조밀한 인덱스를 매긴다
+ */
+void FWorldCloner::GatherSourceObjects(UWorld* InSourceWorld)
+{
+	CloneIndices.assign(GetUObjectArray().size(), INVALID_INDEX);
+
+	ULevel* SourceLevel = InSourceWorld->GetLevel();
+	const size_t NumActors = SourceLevel ? SourceLevel->Actors.size() : 0;
+	// 액터 하나에 루트 컴포넌트 하나가 대부분이다
+	SourceObjects.reserve(2 + NumActors * 2);
+
+	AddSourceObject(InSourceWorld);
+	if (!SourceLevel)
+	{
+		return;
+	}
+
+	AddSourceObject(SourceLevel);
+	for (AActor* Actor : SourceLevel->Actors)
+	{
+		if (!Actor)
+		{
+			continue;
+		}
+
+		AddSourceObject(Actor);
+		for (UActorComponent* Component : Actor->OwnedComponents)
+		{
+			if (Component)
+			{
+				AddSourceObject(Component);
+			}
+		}
+	}
+}
+
+uint32 FWorldCloner::AddSourceObject(UObject* InSource)
+{
+	const uint32 Index = static_cast<uint32>(SourceObjects.size());
+	SourceObjects.push_back(InSource);
+	CloneIndices[InSource->GetInternalIndex()] = Index;
+	return Index;
+}
+
+void FWorldCloner::AddClone(UObject* InSource, UObject* InClone)
+{
+	ClonedObjects[CloneIndices[InSource->GetInternalIndex()]] = InClone;
+}
+
+/**
+ * @brief 액터와 소유 컴포넌트의 복제본을 만들고 값을 옮긴다, 참조는 RemapActorReferences에서 옮긴다
+ */
+void FWorldCloner::CloneActor(AActor* InSourceActor, ULevel* InDestLevel)
+{
+	AActor* DestActor = static_cast<AActor*>(InSourceActor->GetClass()->CreateDefaultObject().Get());
+	DestActor->SetName(InSourceActor->GetName());
+	DestActor->SetOuter(InDestLevel);
+	DestActor->CopyPropertiesFrom(InSourceActor);
+	AddClone(InSourceActor, DestActor);
+	InDestLevel->Actors.emplace_back(DestActor);
+
+	const TArray<TObjectPtr<UActorComponent>>& SourceComponents = InSourceActor->OwnedComponents;
+	const size_t NumDefaultComponents = DestActor->OwnedComponents.size();
+	DestActor->OwnedComponents.reserve(SourceComponents.size());
+
+	for (size_t Index = 0; Index < SourceComponents.size(); ++Index)
+	{
+		UActorComponent* SourceComponent = SourceComponents[Index];
+		if (!SourceComponent)
+		{
+			continue;
+		}
+
+		// 생성자가 만든 기본 서브오브젝트는 원본과 같은 순서로 만들어지므로 자리와 클래스가 맞으면 그대로 쓴다
+		UActorComponent* DestComponent = nullptr;
+		if (Index < NumDefaultComponents && DestActor->OwnedComponents[Index]->GetClass() == SourceComponent->GetClass())
+		{
+			DestComponent = DestActor->OwnedComponents[Index];
+		}
+		else
+		{
+			DestComponent = static_cast<UActorComponent*>(SourceComponent->GetClass()->CreateDefaultObject().Get());
+			DestComponent->SetOuter(DestActor);
+			DestActor->OwnedComponents.emplace_back(DestComponent);
+		}
+
+		DestComponent->SetName(SourceComponent->GetName());
+		DestComponent->CopyPropertiesFrom(SourceComponent);
+		AddClone(SourceComponent, DestComponent);
+	}
+}
+
+void FWorldCloner::RemapActorReferences(const AActor* InSourceActor)
+{
+	AActor* DestActor = FindClone(InSourceActor);
+	DestActor->SetRootComponent(FindClone(InSourceActor->GetRootComponent()));
+
+	for (UActorComponent* SourceComponent : InSourceActor->OwnedComponents)
+	{
+		UActorComponent* DestComponent = FindClone(SourceComponent);
+		if (!DestComponent)
+		{
+			continue;
+		}
+
+		DestComponent->SetOwner(FindClone(SourceComponent->GetOwner()));
+
+		if (SourceComponent->GetComponentType() < EComponentType::Scene)
+		{
+			continue;
+		}
+
+		// 월드 밖을 가리키던 참조는 복제본에서 끊긴다
+		const USceneComponent* SourceSceneComponent = static_cast<const USceneComponent*>(SourceComponent);
+		USceneComponent* DestSceneComponent = static_cast<USceneComponent*>(DestComponent);
+		DestSceneComponent->ParentAttachment = FindClone(SourceSceneComponent->ParentAttachment);
+
+		DestSceneComponent->Children.clear();
+		DestSceneComponent->Children.reserve(SourceSceneComponent->Children.size());
+		for (USceneComponent* Child : SourceSceneComponent->Children)
+		{
+			if (USceneComponent* DestChild = FindClone(Child))
+			{
+				DestSceneComponent->Children.push_back(DestChild);
+			}
+		}
+	}
+}
+
+void FWorldCloner::RemapLevelReferences(const ULevel* InSourceLevel, ULevel* InDestLevel)
+{
+	if (InSourceLevel->Frustum && InDestLevel->Frustum)
+	{
+		InDestLevel->Frustum->CopyPropertiesFrom(InSourceLevel->Frustum);
+	}
+
+	InDestLevel->LevelPrimitiveComponents.clear();
+	InDestLevel->LevelPrimitiveComponents.reserve(InSourceLevel->LevelPrimitiveComponents.size());
+	for (UPrimitiveComponent* Component : InSourceLevel->LevelPrimitiveComponents)
+	{
+		if (UPrimitiveComponent* DestComponent = FindClone(Component))
+		{
+			InDestLevel->LevelPrimitiveComponents.push_back(DestComponent);
+		}
+	}
+}
@@ -64,12 +64,13 @@ public:
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 	UObject* Duplicate(FObjectDuplicationParameters Parameters) override;
+	void CopyPropertiesFrom(const UObject* InSource) override;
 
 private:
-	ULevel* Level;
+	ULevel* Level = nullptr;
 	EWorldType WorldType{EWorldType::None};
 
-	FFrustumCull* Frustum;
+	FFrustumCull* Frustum = nullptr;
 
 	void SwitchToLevel(ULevel* InNewLevel);
 	static path GetLevelDirectory();
@@ -0,0 +1,50 @@
+#pragma once
+#include "Core/Public/Object.h"
+
+class UWorld;
+class ULevel;
+class AActor;
+
+/**
+ * @brief PIE 진입용 월드 벌크 복제기
+ *
+ * 레벨을 한 번 순회해 원본 오브젝트(월드, 레벨, 액터, 컴포넌트)를 조밀한 배열에 모으고
+ * 복제본도 미리 크기를 잡은 배열에 한 번에 만든 뒤, CopyPropertiesFrom으로 값을 옮긴다
+ * 참조(Owner, RootComponent, ParentAttachment, Children, 레벨 목록)는 UObject 내부 인덱스 -> 복제본 인덱스 테이블로 옮기므로
+ * 오브젝트마다 FObjectDuplicationParameters를 만들고 시드 맵을 조회하는 Duplicate 체인을 타지 않는다
+ *
+ * 복제가 끝난 뒤에도 FindClone으로 원본 -> 복제본을 찾을 수 있다 (가속 구조 재사용 등)
+ */
+class FWorldCloner
+{
+public:
+	UWorld* Clone(UWorld* InSourceWorld, UObject* InOuter);
+
+	/** 이번 복제에 포함되지 않은 오브젝트면 nullptr */
+	UObject* FindClone(const UObject* InSource) const;
+
+	template <typename T>
+	T* FindClone(const T* InSource) const
+	{
+		return static_cast<T*>(FindClone(static_cast<const UObject*>(InSource)));
+	}
+
+	uint32 GetNumClonedObjects() const { return static_cast<uint32>(ClonedObjects.size()); }
+
+private:
+	static constexpr uint32 INVALID_INDEX = 0xFFFFFFFFu;
+
+	void GatherSourceObjects(UWorld* InSourceWorld);
+	uint32 AddSourceObject(UObject* InSource);
+	void AddClone(UObject* InSource, UObject* InClone);
+
+	void CloneActor(AActor* InSourceActor, ULevel* InDestLevel);
+	void RemapActorReferences(const AActor* InSourceActor);
+	void RemapLevelReferences(const ULevel* InSourceLevel, ULevel* InDestLevel);
+
+	// 순회 순서대로 모은 원본과 같은 인덱스의 복제본
+	TArray<UObject*> SourceObjects;
+	TArray<UObject*> ClonedObjects;
+	// UObject 내부 인덱스 -> SourceObjects 인덱스
+	TArray<uint32> CloneIndices;
+};
@@ -0,0 +1,40 @@
+#include "pch.h"
+#include "Source/Test/Public/Test.h"
+
+/**
+ * @brief 테스트 진입점 (GTLTests 타깃 전용, ctest로도 실행된다)
+ * 사용법: GTLTests [--filter S] [--data DIR]
+ * 실패한 항목이 있으면 종료 코드 1을 돌려준다
+ */
+int main(int argc, char** argv)
+{
+	FTestOptions Options;
+
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		const FString Argument = argv[Index];
+		const bool bHasValue = Index + 1 < argc;
+
+		if (Argument == "--filter" && bHasValue)
+		{
+			Options.Filter = argv[++Index];
+		}
+		else if (Argument == "--data" && bHasValue)
+		{
+			Options.DataDirectory = argv[++Index];
+		}
+		else
+		{
+			printf("Usage: %s [--filter S] [--data DIR]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	FTestRunner Runner;
+	Runner.AddSuite("Core", RunCoreTests);
+	Runner.AddSuite("Math", RunMathTests);
+	Runner.AddSuite("Render", RunRenderTests);
+	Runner.AddSuite("Asset", RunAssetTests);
+
+	return Runner.Run(Options);
+}
@@ -3,6 +3,10 @@
 #define NOMINMAX
 #define _ENABLE_EXTENDED_ALIGNED_STORAGE  // SIMD 16-byte 정렬 지원
 
+// GTL_HEADLESS: Windows/D3D 없이 코어만 빌드하는 CMake 타깃 (벤치마크/테스트용)
+#ifdef GTL_HEADLESS
+#include "Source/Global/HeadlessPlatform.h"
+#else
 // Window Library
 #include <windows.h>
 #include <wrl.h>
@@ -14,6 +18,7 @@
 // D2D Library
 #include <d2d1.h>
 #include <dwrite.h>
+#endif
 
 // Standard Library
 #include <cmath>
@@ -38,6 +43,7 @@
 #include "Source/Global/CoreTypes.h"
 #include "Source/Global/Macro.h"
 #include "Source/Global/Function.h"
+#include "Source/Core/Public/Logger.h"
 
 using std::clamp;
 using std::unordered_map;
@@ -57,7 +63,9 @@ using std::sort;
 using std::shared_ptr;
 using std::unique_ptr;
 using std::streamsize;
+#ifndef GTL_HEADLESS
 using Microsoft::WRL::ComPtr;
+#endif
 
 // File System
 namespace filesystem = std::filesystem;
@@ -65,12 +73,15 @@ using filesystem::path;
 using filesystem::exists;
 using filesystem::create_directories;
 
+#ifndef GTL_HEADLESS
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "Source/Render/UI/Window/Public/ConsoleWindow.h"
+#endif
 
 // DT Include
 #include "Source/Manager/Time/Public/TimeManager.h"
 
+#ifndef GTL_HEADLESS
 // 빌드 조건에 따른 Library 분류
 #ifdef _DEBUG
 #define DIRECTX_TOOL_KIT R"(DirectXTK\DirectXTK_debug)"
@@ -90,3 +101,4 @@ using filesystem::create_directories;
 #else
 #pragma comment(lib, "thread_pool")
 #endif
+#endif